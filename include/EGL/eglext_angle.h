@@ -447,8 +447,25 @@ EGLAPI void EGLAPIENTRY eglSetValidationEnabledANGLE(EGLBoolean validationState)
 #ifndef EGL_ANGLE_memory_usage_report
 #define EGL_ANGLE_memory_usage_report 1
 #define EGL_CONTEXT_MEMORY_USAGE_ANGLE 0x3462
+#define EGL_CONTEXT_MEMORY_USAGE_CATEGORY_COUNT_ANGLE 0x346B
+#define EGL_CONTEXT_MEMORY_USAGE_BREAKDOWN_ANGLE 0x346C
 #endif /* EGL_ANGLE_memory_usage_report */
 
+#ifndef EGL_ANGLE_memory_pressure
+#define EGL_ANGLE_memory_pressure 1
+#define EGL_MEMORY_PRESSURE_MODERATE_ANGLE 0x346D
+#define EGL_MEMORY_PRESSURE_CRITICAL_ANGLE 0x346E
+typedef void (EGLAPIENTRYP PFNEGLHANDLEMEMORYPRESSUREANGLEPROC)(EGLDisplay dpy, EGLContext ctx, EGLint level);
+#ifdef EGL_EGLEXT_PROTOTYPES
+EGLAPI void EGLAPIENTRY eglHandleMemoryPressureANGLE(EGLDisplay dpy, EGLContext ctx, EGLint level);
+#endif
+#endif /* EGL_ANGLE_memory_pressure */
+
+#ifndef EGL_ANGLE_max_frame_latency
+#define EGL_ANGLE_max_frame_latency 1
+#define EGL_MAX_FRAME_LATENCY_ANGLE 0x346A
+#endif /* EGL_ANGLE_max_frame_latency */
+
 // clang-format on
 
 #endif  // INCLUDE_EGL_EGLEXT_ANGLE_
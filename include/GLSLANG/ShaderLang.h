@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 371
+#define ANGLE_SH_VERSION 374
 
 enum ShShaderSpec
 {
@@ -399,6 +399,10 @@ struct ShCompileOptions
     // Allow compiler to use specialization constant to do pre-rotation and y flip.
     uint64_t useSpecializationConstant : 1;
 
+    // Along with useSpecializationConstant, use a specialization constant for the viewport and
+    // fragment flip values instead of the flipXY driver uniform.
+    uint64_t useSpecializationConstantForFlip : 1;
+
     // Ask compiler to generate Vulkan transform feedback emulation support code.
     uint64_t addVulkanXfbEmulationSupportCode : 1;
 
@@ -818,6 +822,18 @@ bool Compile(const ShHandle handle,
              size_t numStrings,
              const ShCompileOptions &compileOptions);
 
+// Runs only the preprocessor over the given shader source, and returns a normalized form of the
+// result: the preprocessed token stream along with the directives that affect compilation.  Shaders
+// that differ only in comments, whitespace or unused macros have the same normalized source, and
+// compile to the same results given the same compiler and compile options.
+// If preprocessing fails, the return value is false and the shader should be compiled normally.
+// Parameters are the same as Compile(), and normalizedSourceOut receives the normalized source.
+bool GetNormalizedPreprocessedSource(const ShHandle handle,
+                                     const char *const shaderStrings[],
+                                     size_t numStrings,
+                                     const ShCompileOptions &compileOptions,
+                                     std::string *normalizedSourceOut);
+
 // Clears the results from the previous compilation.
 void ClearResults(const ShHandle handle);
 
@@ -844,6 +860,11 @@ const std::string &GetObjectCode(const ShHandle handle);
 // handle: Specifies the compiler
 const BinaryBlob &GetObjectBinaryBlob(const ShHandle handle);
 
+// Returns the memory held by the compiler's pool allocators, which is kept between compilations.
+// Parameters:
+// handle: Specifies the compiler
+size_t GetPoolMemorySize(const ShHandle handle);
+
 // Returns a full binary for a compiled shader, to be loaded with glShaderBinary during runtime.
 // Parameters:
 // handle: Specifies the compiler
@@ -1005,8 +1026,9 @@ enum class SpecializationConstantId : uint32_t
 {
     SurfaceRotation = 0,
     Dither          = 1,
+    Flip            = 2,
 
-    InvalidEnum = 2,
+    InvalidEnum = 3,
     EnumCount   = InvalidEnum,
 };
 
@@ -1014,8 +1036,9 @@ enum class SpecConstUsage : uint32_t
 {
     Rotation = 0,
     Dither   = 1,
+    Flip     = 2,
 
-    InvalidEnum = 2,
+    InvalidEnum = 3,
     EnumCount   = InvalidEnum,
 };
 
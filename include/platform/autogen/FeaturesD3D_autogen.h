@@ -170,6 +170,36 @@ struct FeaturesD3D : FeatureSetBase
         &members,
     };
 
+    FeatureInfo asyncCompileVertexExecutables = {
+        "asyncCompileVertexExecutables",
+        FeatureCategory::D3DFeatures,
+        &members,
+    };
+
+    FeatureInfo wrapStreamingBuffersWithoutDiscard = {
+        "wrapStreamingBuffersWithoutDiscard",
+        FeatureCategory::D3DFeatures,
+        &members,
+    };
+
+    FeatureInfo prewarmInputLayouts = {
+        "prewarmInputLayouts",
+        FeatureCategory::D3DFeatures,
+        &members,
+    };
+
+    FeatureInfo poolUploadStagingTextures = {
+        "poolUploadStagingTextures",
+        FeatureCategory::D3DFeatures,
+        &members,
+    };
+
+    FeatureInfo convertUnpackBufferOnGPU = {
+        "convertUnpackBufferOnGPU",
+        FeatureCategory::D3DFeatures,
+        &members,
+    };
+
 };
 
 inline FeaturesD3D::FeaturesD3D()  = default;
@@ -650,6 +650,18 @@ struct FeaturesGL : FeatureSetBase
         &members,
     };
 
+    FeatureInfo usePersistentMappedStreamingBuffer = {
+        "usePersistentMappedStreamingBuffer",
+        FeatureCategory::OpenGLFeatures,
+        &members,
+    };
+
+    FeatureInfo useMultiBind = {
+        "useMultiBind",
+        FeatureCategory::OpenGLFeatures,
+        &members,
+    };
+
 };
 
 inline FeaturesGL::FeaturesGL()  = default;
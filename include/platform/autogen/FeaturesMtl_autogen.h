@@ -362,6 +362,24 @@ struct FeaturesMtl : FeatureSetBase
         &members,
     };
 
+    FeatureInfo usePipelineBinaryArchive = {
+        "usePipelineBinaryArchive",
+        FeatureCategory::MetalFeatures,
+        &members,
+    };
+
+    FeatureInfo useHeapsForRenderTargetTextures = {
+        "useHeapsForRenderTargetTextures",
+        FeatureCategory::MetalFeatures,
+        &members,
+    };
+
+    FeatureInfo encodeRenderPassesInParallel = {
+        "encodeRenderPassesInParallel",
+        FeatureCategory::MetalFeatures,
+        &members,
+    };
+
 };
 
 inline FeaturesMtl::FeaturesMtl()  = default;
@@ -74,6 +74,18 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo useSmallImageMemoryPools = {
+        "useSmallImageMemoryPools",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo defragmentBufferPools = {
+        "defragmentBufferPools",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsMemoryBudget = {
         "supportsMemoryBudget",
         FeatureCategory::VulkanFeatures,
@@ -326,6 +338,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo removeDeadCodeInSpirv = {
+        "removeDeadCodeInSpirv",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo preferAggregateBarrierCalls = {
         "preferAggregateBarrierCalls",
         FeatureCategory::VulkanWorkarounds,
@@ -380,6 +398,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo inferAttachmentStoreOps = {
+        "inferAttachmentStoreOps",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsDepthClipControl = {
         "supportsDepthClipControl",
         FeatureCategory::VulkanFeatures,
@@ -428,6 +452,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo preferTransientMultisampledRenderbuffers = {
+        "preferTransientMultisampledRenderbuffers",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo waitIdleBeforeSwapchainRecreation = {
         "waitIdleBeforeSwapchainRecreation",
         FeatureCategory::VulkanWorkarounds,
@@ -506,6 +536,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo bakeFlipInSpecConst = {
+        "bakeFlipInSpecConst",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo exposeNonConformantExtensionsAndVersions = {
         "exposeNonConformantExtensionsAndVersions",
         FeatureCategory::VulkanWorkarounds,
@@ -536,6 +572,36 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo createDedicatedAsyncQueue = {
+        "createDedicatedAsyncQueue",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo batchQueueSubmitsAcrossContexts = {
+        "batchQueueSubmitsAcrossContexts",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo submitPromotedContextCommandsAtRenderPassEnd = {
+        "submitPromotedContextCommandsAtRenderPassEnd",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo recycleTextureImages = {
+        "recycleTextureImages",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo bakeStaticImmutableSamplers = {
+        "bakeStaticImmutableSamplers",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo useMultipleDescriptorsForExternalFormats = {
         "useMultipleDescriptorsForExternalFormats",
         FeatureCategory::VulkanWorkarounds,
@@ -554,6 +620,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsCalibratedTimestamps = {
+        "supportsCalibratedTimestamps",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsPipelineCreationFeedback = {
         "supportsPipelineCreationFeedback",
         FeatureCategory::VulkanFeatures,
@@ -788,6 +860,18 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsExtendedDynamicState3 = {
+        "supportsExtendedDynamicState3",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo useColorBlendEquationDynamicState = {
+        "useColorBlendEquationDynamicState",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsFragmentShadingRate = {
         "supportsFragmentShadingRate",
         FeatureCategory::VulkanFeatures,
@@ -932,6 +1016,18 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo asyncGraphicsPipelineCreationOnCacheMiss = {
+        "asyncGraphicsPipelineCreationOnCacheMiss",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo skipDrawOnPendingGraphicsPipeline = {
+        "skipDrawOnPendingGraphicsPipeline",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo slowDownMonolithicPipelineCreationForTesting = {
         "slowDownMonolithicPipelineCreationForTesting",
         FeatureCategory::VulkanWorkarounds,
@@ -974,6 +1070,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsShaderObject = {
+        "supportsShaderObject",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsMixedReadWriteDepthStencilLayouts = {
         "supportsMixedReadWriteDepthStencilLayouts",
         FeatureCategory::VulkanFeatures,
@@ -1088,6 +1190,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo supportsDescriptorIndexing = {
+        "supportsDescriptorIndexing",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsFormatFeatureFlags2 = {
         "supportsFormatFeatureFlags2",
         FeatureCategory::VulkanFeatures,
@@ -1232,6 +1340,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo useVkEventForBufferBarrier = {
+        "useVkEventForBufferBarrier",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsSynchronization2 = {
         "supportsSynchronization2",
         FeatureCategory::VulkanFeatures,
@@ -1382,6 +1496,12 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo shardPipelineCacheInBlobCache = {
+        "shardPipelineCacheInBlobCache",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo descriptorSetCache = {
         "descriptorSetCache",
         FeatureCategory::VulkanFeatures,
@@ -1406,12 +1526,48 @@ struct FeaturesVk : FeatureSetBase
         &members,
     };
 
+    FeatureInfo parallelRenderPassCommandEncoding = {
+        "parallelRenderPassCommandEncoding",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
     FeatureInfo supportsImageCompressionControlSwapchain = {
         "supportsImageCompressionControlSwapchain",
         FeatureCategory::VulkanFeatures,
         &members,
     };
 
+    FeatureInfo supportsDescriptorBuffer = {
+        "supportsDescriptorBuffer",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo reuseStreamedVertexData = {
+        "reuseStreamedVertexData",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo shareRendererAcrossDisplays = {
+        "shareRendererAcrossDisplays",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo supportsPresentWait = {
+        "supportsPresentWait",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
+    FeatureInfo adaptSwapchainImageCount = {
+        "adaptSwapchainImageCount",
+        FeatureCategory::VulkanFeatures,
+        &members,
+    };
+
 };
 
 inline FeaturesVk::FeaturesVk()  = default;
@@ -111,6 +111,12 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo cacheCompiledShaderByPreprocessedSource = {
+        "cacheCompiledShaderByPreprocessedSource",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
     FeatureInfo dumpShaderSource = {
         "dumpShaderSource",
         FeatureCategory::FrontendFeatures,
@@ -189,6 +195,36 @@ struct FrontendFeatures : FeatureSetBase
         &members,
     };
 
+    FeatureInfo uncompressedProgramCache = {
+        "uncompressedProgramCache",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo cacheProgramsAsynchronously = {
+        "cacheProgramsAsynchronously",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo deferPostLinkTasksUntilUse = {
+        "deferPostLinkTasksUntilUse",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo skipStateInvalidationOnMakeCurrent = {
+        "skipStateInvalidationOnMakeCurrent",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
+    FeatureInfo deliverDebugCallbacksAsynchronously = {
+        "deliverDebugCallbacksAsynchronously",
+        FeatureCategory::FrontendFeatures,
+        &members,
+    };
+
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
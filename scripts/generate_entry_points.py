@@ -211,6 +211,14 @@ CONTEXT_PRIVATE_LIST = [
     'glSampleCoveragex',
     'glShadeModel',
 ]
+# These are the state queries which don't require the share group lock when the queried pname is
+# answered by PrivateState alone (see PrivateState::IsPrivateStateQuery).
+STATE_QUERY_LIST = [
+    'glGetBooleanv',
+    'glGetFloatv',
+    'glGetIntegerv',
+]
+
 CONTEXT_PRIVATE_WILDCARDS = [
     'glBlendFunc*',
     'glBlendEquation*',
@@ -3107,6 +3115,11 @@ def get_context_lock(api, cmd_name):
     if disable_share_group_lock(api, cmd_name):
         return ""
 
+    # State queries only hold the share group lock if the queried state is not entirely
+    # context-private.
+    if cmd_name in STATE_QUERY_LIST:
+        return "SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname);"
+
     return "SCOPED_SHARE_CONTEXT_LOCK(context);"
 
 
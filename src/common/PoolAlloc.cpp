@@ -486,6 +486,24 @@ void PoolAllocator::unlock()
     mLocked = false;
 }
 
+size_t PoolAllocator::getReservedMemorySize() const
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    size_t pageCount = 0;
+    for (const PageHeader *page = mInUseList; page != nullptr; page = page->nextPage)
+    {
+        pageCount += page->pageCount;
+    }
+    for (const PageHeader *page = mFreeList; page != nullptr; page = page->nextPage)
+    {
+        pageCount += page->pageCount;
+    }
+    return pageCount * mPageSize;
+#else
+    return 0;
+#endif
+}
+
 //
 // Check all allocations in a list for damage by calling check on each.
 //
@@ -138,6 +138,29 @@ class PoolAllocator : angle::NonCopyable
     void lock();
     void unlock();
 
+    // Statistics of the allocate() calls made over the lifetime of the allocator, which are always
+    // zero when the pool allocator is disabled.
+    size_t getAllocationCount() const
+    {
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+        return static_cast<size_t>(mNumCalls);
+#else
+        return 0;
+#endif
+    }
+    size_t getAllocatedBytes() const
+    {
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+        return mTotalBytes;
+#else
+        return 0;
+#endif
+    }
+
+    // The memory held by the allocator, including the unused pages kept for future allocations.
+    // Unknown, and zero, when the pool allocator is disabled.
+    size_t getReservedMemorySize() const;
+
   private:
     size_t mAlignment;  // all returned allocations will be aligned at
                         // this granularity, which will be a power of 2
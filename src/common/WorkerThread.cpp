@@ -20,8 +20,10 @@
 #endif  // !defined(ANGLE_STD_ASYNC_WORKERS) && & !defined(ANGLE_ENABLE_WINDOWS_UWP)
 
 #if ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
+#    include <algorithm>
+#    include <atomic>
+#    include <deque>
 #    include <future>
-#    include <queue>
 #    include <thread>
 #endif  // ANGLE_DELEGATE_WORKERS || ANGLE_STD_ASYNC_WORKERS
 
@@ -63,13 +65,15 @@ WorkerThreadPool::~WorkerThreadPool() = default;
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
     // Thread safety: This function is thread-safe because the task is run on the calling thread
     // itself.
@@ -84,6 +88,56 @@ bool SingleThreadedWorkerPool::isAsync()
 
 #if ANGLE_STD_ASYNC_WORKERS
 
+// The event of a task posted to AsyncWorkerPool, which can be canceled until a thread starts the
+// task.
+class CancelableWaitableEvent final : public WaitableEvent
+{
+  public:
+    CancelableWaitableEvent()           = default;
+    ~CancelableWaitableEvent() override = default;
+
+    void wait() override { mDoneEvent.wait(); }
+    bool isReady() override { return mDoneEvent.isReady(); }
+    bool cancel() override;
+
+    // Returns false if the task is canceled.  Otherwise, the task can no longer be canceled.
+    bool markAsStarted();
+    void markAsReady() { mDoneEvent.markAsReady(); }
+
+  private:
+    enum class State : uint8_t
+    {
+        Pending,
+        Started,
+        Canceled,
+    };
+    std::atomic<State> mState{State::Pending};
+    AsyncWaitableEvent mDoneEvent;
+};
+
+bool CancelableWaitableEvent::cancel()
+{
+    State expected = State::Pending;
+    if (mState.compare_exchange_strong(expected, State::Canceled))
+    {
+        mDoneEvent.markAsReady();
+        return true;
+    }
+    return expected == State::Canceled;
+}
+
+bool CancelableWaitableEvent::markAsStarted()
+{
+    State expected = State::Pending;
+    return mState.compare_exchange_strong(expected, State::Started);
+}
+
+// The threads are created on demand, up to the thread count the pool is created with.  Every thread
+// has a deque per priority for the tasks that are posted by the tasks it runs, which it runs last
+// in, first out.  The other tasks are queued in the pool.  An idle thread takes the highest
+// priority task it finds, first from its own deques, then from the pool's queues, and otherwise
+// steals the oldest task from the deques of other threads.  The tasks are coarse (compiles, links,
+// pipeline creation), so a single mutex protects all the queues.
 class AsyncWorkerPool final : public WorkerThreadPool
 {
   public:
@@ -91,29 +145,56 @@ class AsyncWorkerPool final : public WorkerThreadPool
 
     ~AsyncWorkerPool() override;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
+    void setConcurrencyLimit(size_t limit) override;
+
   private:
-    void createThreads();
+    struct Task
+    {
+        std::shared_ptr<CancelableWaitableEvent> event;
+        std::shared_ptr<Closure> closure;
+    };
+    static constexpr size_t kPriorityCount = static_cast<size_t>(WorkerTaskPriority::EnumCount);
+    using TaskQueues                       = std::array<std::deque<Task>, kPriorityCount>;
 
-    using Task = std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>;
+    struct Worker
+    {
+        AsyncWorkerPool *pool = nullptr;
+        TaskQueues localTasks;
+        std::thread thread;
+    };
 
     // Thread's main loop
-    void threadLoop();
+    void threadLoop(Worker *worker);
+
+    bool takeTask(Worker *worker, Task *taskOut);
+    size_t getBusyThreadCount() const { return mWorkers.size() - mIdleThreadCount; }
+
+    // The worker of the current thread, if it's a thread of any pool.
+    static thread_local Worker *tCurrentWorker;
 
     bool mTerminated = false;
     std::mutex mMutex;                 // Protects access to the fields in this class
     std::condition_variable mCondVar;  // Signals when work is available in the queue
-    std::queue<Task> mTaskQueue;
-    std::deque<std::thread> mThreads;
-    size_t mDesiredThreadCount;
+    TaskQueues mTasks;
+    std::vector<std::unique_ptr<Worker>> mWorkers;
+    size_t mPendingTaskCount = 0;
+    // The threads that are not running a task, including the ones that are just created.
+    size_t mIdleThreadCount = 0;
+    const size_t mMaxThreadCount;
+    size_t mConcurrencyLimit;
 };
 
+thread_local AsyncWorkerPool::Worker *AsyncWorkerPool::tCurrentWorker = nullptr;
+
 // AsyncWorkerPool implementation.
 
-AsyncWorkerPool::AsyncWorkerPool(size_t numThreads) : mDesiredThreadCount(numThreads)
+AsyncWorkerPool::AsyncWorkerPool(size_t numThreads)
+    : mMaxThreadCount(numThreads), mConcurrencyLimit(numThreads)
 {
     ASSERT(numThreads != 0);
 }
@@ -125,72 +206,114 @@ AsyncWorkerPool::~AsyncWorkerPool()
         mTerminated = true;
     }
     mCondVar.notify_all();
-    for (auto &thread : mThreads)
+    for (std::unique_ptr<Worker> &worker : mWorkers)
     {
-        ASSERT(thread.get_id() != std::this_thread::get_id());
-        thread.join();
+        ASSERT(worker->thread.get_id() != std::this_thread::get_id());
+        worker->thread.join();
     }
 }
 
-void AsyncWorkerPool::createThreads()
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                               WorkerTaskPriority priority)
 {
-    if (mDesiredThreadCount == mThreads.size())
+    // Thread safety: This function is thread-safe because access to the task queues is protected
+    // by |mMutex|.
+    auto waitable = std::make_shared<CancelableWaitableEvent>();
     {
-        return;
-    }
-    ASSERT(mThreads.empty());
+        std::lock_guard<std::mutex> lock(mMutex);
 
-    for (size_t i = 0; i < mDesiredThreadCount; ++i)
-    {
-        mThreads.emplace_back(&AsyncWorkerPool::threadLoop, this);
+        const size_t priorityIndex = static_cast<size_t>(priority);
+        Worker *currentWorker      = tCurrentWorker;
+        TaskQueues &queues =
+            currentWorker && currentWorker->pool == this ? currentWorker->localTasks : mTasks;
+        queues[priorityIndex].push_back({waitable, task});
+        ++mPendingTaskCount;
+
+        // Lazily create a thread if there are more tasks than threads to take them.
+        if (mIdleThreadCount < mPendingTaskCount && mWorkers.size() < mConcurrencyLimit)
+        {
+            mWorkers.push_back(std::make_unique<Worker>());
+            Worker *worker = mWorkers.back().get();
+            worker->pool   = this;
+            worker->thread = std::thread(&AsyncWorkerPool::threadLoop, this, worker);
+            ++mIdleThreadCount;
+        }
     }
+    mCondVar.notify_one();
+    return waitable;
 }
 
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(const std::shared_ptr<Closure> &task)
+bool AsyncWorkerPool::takeTask(Worker *worker, Task *taskOut)
 {
-    // Thread safety: This function is thread-safe because access to |mTaskQueue| is protected by
-    // |mMutex|.
-    auto waitable = std::make_shared<AsyncWaitableEvent>();
+    for (size_t priorityIndex = 0; priorityIndex < kPriorityCount; ++priorityIndex)
     {
-        std::lock_guard<std::mutex> lock(mMutex);
+        std::deque<Task> &localTasks = worker->localTasks[priorityIndex];
+        if (!localTasks.empty())
+        {
+            *taskOut = std::move(localTasks.back());
+            localTasks.pop_back();
+            return true;
+        }
 
-        // Lazily create the threads on first task
-        createThreads();
+        std::deque<Task> &tasks = mTasks[priorityIndex];
+        if (!tasks.empty())
+        {
+            *taskOut = std::move(tasks.front());
+            tasks.pop_front();
+            return true;
+        }
 
-        mTaskQueue.push(std::make_pair(waitable, task));
+        for (std::unique_ptr<Worker> &otherWorker : mWorkers)
+        {
+            std::deque<Task> &otherTasks = otherWorker->localTasks[priorityIndex];
+            if (!otherTasks.empty())
+            {
+                *taskOut = std::move(otherTasks.front());
+                otherTasks.pop_front();
+                return true;
+            }
+        }
     }
-    mCondVar.notify_one();
-    return waitable;
+    return false;
 }
 
-void AsyncWorkerPool::threadLoop()
+void AsyncWorkerPool::threadLoop(Worker *worker)
 {
     angle::SetCurrentThreadName("ANGLE-Worker");
+    tCurrentWorker = worker;
 
+    std::unique_lock<std::mutex> lock(mMutex);
     while (true)
     {
-        Task task;
+        mCondVar.wait(lock, [this] {
+            return mTerminated ||
+                   (mPendingTaskCount > 0 && getBusyThreadCount() < mConcurrencyLimit);
+        });
+        if (mTerminated)
         {
-            std::unique_lock<std::mutex> lock(mMutex);
-            mCondVar.wait(lock, [this] { return !mTaskQueue.empty() || mTerminated; });
-            if (mTerminated)
-            {
-                return;
-            }
-            task = mTaskQueue.front();
-            mTaskQueue.pop();
+            return;
         }
 
-        auto &waitable = task.first;
-        auto &closure  = task.second;
+        Task task;
+        bool taken = takeTask(worker, &task);
+        ASSERT(taken);
+        --mPendingTaskCount;
+        --mIdleThreadCount;
+        lock.unlock();
 
         // Note: always add an ANGLE_TRACE_EVENT* macro in the closure.  Then the job will show up
         // in traces.
-        (*closure)();
+        if (task.event->markAsStarted())
+        {
+            (*task.closure)();
+        }
         // Release shared_ptr<Closure> before notifying the event to allow for destructor based
         // dependencies (example: anglebug.com/42267099)
-        task.second.reset();
-        waitable->markAsReady();
+        task.closure.reset();
+        task.event->markAsReady();
+
+        lock.lock();
+        ++mIdleThreadCount;
     }
 }
 
@@ -199,6 +322,16 @@ bool AsyncWorkerPool::isAsync()
     return true;
 }
 
+void AsyncWorkerPool::setConcurrencyLimit(size_t limit)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mConcurrencyLimit = limit == 0 ? mMaxThreadCount : std::min(limit, mMaxThreadCount);
+    }
+    // Threads that were kept from taking a task may now take one.
+    mCondVar.notify_all();
+}
+
 #endif  // ANGLE_STD_ASYNC_WORKERS
 
 #if ANGLE_DELEGATE_WORKERS
@@ -209,7 +342,8 @@ class DelegateWorkerPool final : public WorkerThreadPool
     DelegateWorkerPool(PlatformMethods *platform) : mPlatform(platform) {}
     ~DelegateWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                  WorkerTaskPriority priority) override;
 
     bool isAsync() override;
 
@@ -248,7 +382,8 @@ class DelegateWorkerTask
 
 ANGLE_NO_SANITIZE_CFI_ICALL
 std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(
-    const std::shared_ptr<Closure> &task)
+    const std::shared_ptr<Closure> &task,
+    WorkerTaskPriority priority)
 {
     if (mPlatform->postWorkerTask == nullptr)
     {
@@ -293,8 +428,10 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(size_t numThreads,
 #if ANGLE_STD_ASYNC_WORKERS
     if (!pool && multithreaded)
     {
-        pool = std::shared_ptr<WorkerThreadPool>(new AsyncWorkerPool(
-            numThreads == 0 ? std::thread::hardware_concurrency() : numThreads));
+        // hardware_concurrency() may return 0 if the core count is unknown.
+        const size_t coreCount = std::max(std::thread::hardware_concurrency(), 1u);
+        pool                   = std::shared_ptr<WorkerThreadPool>(
+            new AsyncWorkerPool(numThreads == 0 ? coreCount : numThreads));
     }
 #endif
     if (!pool)
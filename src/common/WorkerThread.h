@@ -46,6 +46,11 @@ class WaitableEvent : angle::NonCopyable
     // Peeks whether the event is ready. If ready, wait() will not block.
     virtual bool isReady() = 0;
 
+    // Cancels the task if no thread has started it yet.  Returns true if the task is not going to
+    // run, in which case the event is ready.  Only tasks of pools that own their threads can be
+    // canceled.
+    virtual bool cancel() { return false; }
+
     template <class T>
     // Waits on multiple events. T should be some container of std::shared_ptr<WaitableEvent>.
     static void WaitMany(T *waitables)
@@ -100,6 +105,21 @@ class AsyncWaitableEvent final : public WaitableEvent
     std::condition_variable mCondition;
 };
 
+// The priority of a task posted to a WorkerThreadPool.  The pending tasks of a higher priority are
+// always started first.
+enum class WorkerTaskPriority : uint8_t
+{
+    // The result is going to be waited on soon, such as that of a compile or link.
+    BlockingSoon,
+    // Work that makes something faster later, such as warming up pipelines.
+    Background,
+    // Work whose result may never be needed, such as storing to the blob cache.
+    Idle,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
 // Request WorkerThreads from the WorkerThreadPool. Each pool can keep worker threads around so
 // we avoid the costly spin up and spin down time.
 class WorkerThreadPool : angle::NonCopyable
@@ -118,10 +138,21 @@ class WorkerThreadPool : angle::NonCopyable
 
     // Returns an event to wait on for the task to finish.  If the pool fails to create the task,
     // returns null.  This function is thread-safe.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task) = 0;
+    std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task)
+    {
+        return postWorkerTask(task, WorkerTaskPriority::BlockingSoon);
+    }
+    // Tasks posted by a task running in the pool are preferably run by the same thread.  Pools that
+    // delegate to the platform ignore the priority.
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(const std::shared_ptr<Closure> &task,
+                                                          WorkerTaskPriority priority) = 0;
 
     virtual bool isAsync() = 0;
 
+    // Limits the number of tasks running at the same time, for example in response to a thermal
+    // hint from the platform.  Zero removes the limit.  Ignored by pools that don't own threads.
+    virtual void setConcurrencyLimit(size_t limit) {}
+
   private:
 };
 
@@ -7,7 +7,10 @@
 //   Simple tests for the worker thread class.
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <array>
+#include <mutex>
+#include <vector>
 
 #include "common/WorkerThread.h"
 
@@ -48,4 +51,155 @@ TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+// A task that waits until it's released.
+class GateTask : public Closure
+{
+  public:
+    void operator()() override
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondVar.wait(lock, [this] { return mReleased; });
+    }
+
+    void release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mReleased = true;
+        }
+        mCondVar.notify_all();
+    }
+
+  private:
+    std::mutex mMutex;
+    std::condition_variable mCondVar;
+    bool mReleased = false;
+};
+
+// A task that records the order it runs in.
+class OrderedTask : public Closure
+{
+  public:
+    OrderedTask(std::vector<int> *order, std::mutex *orderMutex, int id)
+        : mOrder(order), mOrderMutex(orderMutex), mId(id)
+    {}
+
+    void operator()() override
+    {
+        std::lock_guard<std::mutex> lock(*mOrderMutex);
+        mOrder->push_back(mId);
+    }
+
+  private:
+    std::vector<int> *mOrder;
+    std::mutex *mOrderMutex;
+    int mId;
+};
+
+// Tests that pending tasks are started in the order of their priority.
+TEST(WorkerPoolTest, Priorities)
+{
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(2, ANGLEPlatformCurrent());
+    if (!pool->isAsync())
+    {
+        return;
+    }
+
+    // Run one task at a time, so the tasks are started in a known order.
+    pool->setConcurrencyLimit(1);
+
+    std::shared_ptr<GateTask> gate = std::make_shared<GateTask>();
+    std::vector<std::shared_ptr<WaitableEvent>> waitables;
+    waitables.push_back(pool->postWorkerTask(gate));
+
+    std::vector<int> order;
+    std::mutex orderMutex;
+    waitables.push_back(pool->postWorkerTask(std::make_shared<OrderedTask>(&order, &orderMutex, 0),
+                                             WorkerTaskPriority::Idle));
+    waitables.push_back(pool->postWorkerTask(std::make_shared<OrderedTask>(&order, &orderMutex, 1),
+                                             WorkerTaskPriority::Background));
+    waitables.push_back(pool->postWorkerTask(std::make_shared<OrderedTask>(&order, &orderMutex, 2),
+                                             WorkerTaskPriority::BlockingSoon));
+    waitables.push_back(pool->postWorkerTask(std::make_shared<OrderedTask>(&order, &orderMutex, 3),
+                                             WorkerTaskPriority::Background));
+
+    gate->release();
+    WaitableEvent::WaitMany(&waitables);
+
+    EXPECT_EQ(order, (std::vector<int>{2, 1, 3, 0}));
+}
+
+// Tests that a task can be canceled until it's started.
+TEST(WorkerPoolTest, Cancel)
+{
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(2, ANGLEPlatformCurrent());
+    if (!pool->isAsync())
+    {
+        return;
+    }
+
+    pool->setConcurrencyLimit(1);
+
+    std::shared_ptr<GateTask> gate          = std::make_shared<GateTask>();
+    std::shared_ptr<WaitableEvent> gateDone = pool->postWorkerTask(gate);
+
+    std::vector<int> order;
+    std::mutex orderMutex;
+    std::shared_ptr<WaitableEvent> canceled = pool->postWorkerTask(
+        std::make_shared<OrderedTask>(&order, &orderMutex, 0), WorkerTaskPriority::Background);
+    std::shared_ptr<WaitableEvent> notCanceled = pool->postWorkerTask(
+        std::make_shared<OrderedTask>(&order, &orderMutex, 1), WorkerTaskPriority::Background);
+
+    EXPECT_TRUE(canceled->cancel());
+    EXPECT_TRUE(canceled->isReady());
+
+    gate->release();
+    gateDone->wait();
+    notCanceled->wait();
+
+    // Tasks that are done can't be canceled.
+    EXPECT_FALSE(notCanceled->cancel());
+    EXPECT_EQ(order, (std::vector<int>{1}));
+}
+
+// Tests that the tasks posted by tasks running in the pool are run.
+TEST(WorkerPoolTest, TasksPostedFromTasks)
+{
+    class PostingTask : public Closure
+    {
+      public:
+        PostingTask(WorkerThreadPool *pool, std::vector<int> *order, std::mutex *orderMutex)
+            : mPool(pool), mOrder(order), mOrderMutex(orderMutex)
+        {}
+
+        void operator()() override
+        {
+            for (int id = 0; id < 4; ++id)
+            {
+                waitables.push_back(mPool->postWorkerTask(
+                    std::make_shared<OrderedTask>(mOrder, mOrderMutex, id)));
+            }
+        }
+
+        std::vector<std::shared_ptr<WaitableEvent>> waitables;
+
+      private:
+        WorkerThreadPool *mPool;
+        std::vector<int> *mOrder;
+        std::mutex *mOrderMutex;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+
+    std::vector<int> order;
+    std::mutex orderMutex;
+    std::shared_ptr<PostingTask> task =
+        std::make_shared<PostingTask>(pool.get(), &order, &orderMutex);
+    pool->postWorkerTask(task)->wait();
+    WaitableEvent::WaitMany(&task->waitables);
+
+    std::sort(order.begin(), order.end());
+    EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3}));
+}
+
 }  // anonymous namespace
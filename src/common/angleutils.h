@@ -105,6 +105,7 @@ struct PerfMonitorTriplet
     FN(vkQueueSubmitCallsPerFrame)                 \
     FN(commandQueueWaitSemaphoresTotal)            \
     FN(renderPasses)                               \
+    FN(renderPassMergeCandidates)                  \
     FN(writeDescriptorSets)                        \
     FN(flushedOutsideRenderPassCommandBuffers)     \
     FN(swapchainCreate)                            \
@@ -141,9 +142,13 @@ struct PerfMonitorTriplet
     FN(pipelineCreationTotalCacheHitsDurationNs)   \
     FN(pipelineCreationTotalCacheMissesDurationNs) \
     FN(monolithicPipelineCreation)                 \
+    FN(pendingGraphicsPipelineFallbacks)           \
+    FN(pendingGraphicsPipelineSkippedDraws)        \
+    FN(pendingGraphicsPipelineWaits)               \
     FN(descriptorSetAllocations)                   \
     FN(descriptorSetCacheTotalSize)                \
     FN(descriptorSetCacheKeySizeBytes)             \
+    FN(descriptorSetCacheEvictions)                \
     FN(uniformsAndXfbDescriptorSetCacheHits)       \
     FN(uniformsAndXfbDescriptorSetCacheMisses)     \
     FN(uniformsAndXfbDescriptorSetCacheTotalSize)  \
@@ -162,7 +167,9 @@ struct PerfMonitorTriplet
     FN(bufferSuballocationCalls)                   \
     FN(dynamicBufferAllocations)                   \
     FN(framebufferCacheSize)                       \
-    FN(pendingSubmissionGarbageObjects)
+    FN(pendingSubmissionGarbageObjects)            \
+    FN(appThreadGarbageCleanupDurationNs)          \
+    FN(cleanUpThreadGarbageCleanupDurationNs)
 
 #define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint64_t COUNTER;
 
@@ -54,6 +54,7 @@ constexpr const char *LogSeverityName(int severity)
     return (severity >= 0 && severity < LOG_NUM_SEVERITIES) ? g_logSeverityNames[severity]
                                                             : "UNKNOWN";
 }
+}  // namespace
 
 bool ShouldCreateLogMessage(LogSeverity severity)
 {
@@ -69,8 +70,6 @@ bool ShouldCreateLogMessage(LogSeverity severity)
 #endif
 }
 
-}  // namespace
-
 namespace priv
 {
 
@@ -0,0 +1,190 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_point_timing.cpp:
+//   Implements the per-entry-point CPU time histograms.
+//
+
+#include "common/entry_point_timing.h"
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
+#    include <algorithm>
+#    include <array>
+#    include <atomic>
+#    include <map>
+#    include <memory>
+#    include <mutex>
+
+#    include "common/base/anglebase/no_destructor.h"
+#    include "common/mathutil.h"
+
+namespace angle
+{
+namespace
+{
+// Bucket N holds the calls that took [2^(N-1), 2^N) nanoseconds.  The last bucket also holds
+// anything slower.
+constexpr size_t kBucketCount = 32;
+// Larger than the number of entry points; calls to entry points past it are not recorded.
+constexpr size_t kMaxEntryPoints = 4096;
+
+using BucketCounts = std::array<uint32_t, kBucketCount>;
+
+// Padded to a cache line so the histograms of different threads never share one.
+struct alignas(64) Histogram
+{
+    std::array<std::atomic<uint32_t>, kBucketCount> buckets = {};
+};
+
+struct ThreadTimings
+{
+    // Only the owning thread writes the histograms, and allocates them on first use.
+    std::array<std::atomic<Histogram *>, kMaxEntryPoints> histograms = {};
+    // The counts at the last collection.  Only accessed with the registry locked.
+    std::map<size_t, BucketCounts> lastCollected;
+};
+
+// The timings of threads that have exited are kept, so their calls are still collected.
+struct Registry
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadTimings>> threads;
+};
+
+Registry &GetRegistry()
+{
+    static angle::base::NoDestructor<Registry> sRegistry;
+    return *sRegistry;
+}
+
+ThreadTimings *GetThreadTimings()
+{
+    thread_local ThreadTimings *tThreadTimings = nullptr;
+    if (tThreadTimings == nullptr)
+    {
+        Registry &registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.threads.emplace_back(new ThreadTimings);
+        tThreadTimings = registry.threads.back().get();
+    }
+    return tThreadTimings;
+}
+
+size_t GetBucketIndex(uint64_t nanoseconds)
+{
+    if (nanoseconds == 0)
+    {
+        return 0;
+    }
+    return std::min<size_t>(gl::ScanReverse(nanoseconds) + 1, kBucketCount - 1);
+}
+
+uint64_t GetPercentile(const BucketCounts &counts, uint64_t callCount, uint64_t percent)
+{
+    const uint64_t target = (callCount * percent + 99) / 100;
+    uint64_t cumulative   = 0;
+    for (size_t bucket = 0; bucket < kBucketCount; ++bucket)
+    {
+        cumulative += counts[bucket];
+        if (cumulative >= target)
+        {
+            return uint64_t(1) << bucket;
+        }
+    }
+    return uint64_t(1) << (kBucketCount - 1);
+}
+}  // anonymous namespace
+
+void RecordEntryPointTime(EntryPoint entryPoint, uint64_t nanoseconds)
+{
+    const size_t index = static_cast<size_t>(entryPoint);
+    if (index >= kMaxEntryPoints)
+    {
+        return;
+    }
+
+    ThreadTimings *threadTimings = GetThreadTimings();
+    Histogram *histogram = threadTimings->histograms[index].load(std::memory_order_relaxed);
+    if (histogram == nullptr)
+    {
+        histogram = new Histogram;
+        threadTimings->histograms[index].store(histogram, std::memory_order_release);
+    }
+
+    // There is a single writer, so a relaxed load and store is enough and avoids a locked
+    // instruction.
+    std::atomic<uint32_t> &bucket = histogram->buckets[GetBucketIndex(nanoseconds)];
+    bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+std::vector<EntryPointTiming> CollectEntryPointTimings()
+{
+    std::map<size_t, BucketCounts> merged;
+
+    {
+        Registry &registry = GetRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        for (std::unique_ptr<ThreadTimings> &threadTimings : registry.threads)
+        {
+            for (size_t index = 0; index < kMaxEntryPoints; ++index)
+            {
+                const Histogram *histogram =
+                    threadTimings->histograms[index].load(std::memory_order_acquire);
+                if (histogram == nullptr)
+                {
+                    continue;
+                }
+
+                BucketCounts &last   = threadTimings->lastCollected[index];
+                BucketCounts &counts = merged[index];
+                for (size_t bucket = 0; bucket < kBucketCount; ++bucket)
+                {
+                    const uint32_t current =
+                        histogram->buckets[bucket].load(std::memory_order_relaxed);
+                    counts[bucket] += current - last[bucket];
+                    last[bucket] = current;
+                }
+            }
+        }
+    }
+
+    std::vector<EntryPointTiming> timings;
+    for (const auto &indexAndCounts : merged)
+    {
+        const BucketCounts &counts = indexAndCounts.second;
+
+        uint64_t callCount = 0;
+        for (uint32_t count : counts)
+        {
+            callCount += count;
+        }
+        if (callCount == 0)
+        {
+            continue;
+        }
+
+        EntryPointTiming timing;
+        timing.entryPoint     = static_cast<EntryPoint>(indexAndCounts.first);
+        timing.callCount      = callCount;
+        timing.p50Nanoseconds = GetPercentile(counts, callCount, 50);
+        timing.p99Nanoseconds = GetPercentile(counts, callCount, 99);
+        timings.push_back(timing);
+    }
+
+    std::sort(timings.begin(), timings.end(),
+              [](const EntryPointTiming &a, const EntryPointTiming &b) {
+                  if (a.p99Nanoseconds != b.p99Nanoseconds)
+                  {
+                      return a.p99Nanoseconds > b.p99Nanoseconds;
+                  }
+                  return a.callCount > b.callCount;
+              });
+
+    return timings;
+}
+}  // namespace angle
+
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
@@ -0,0 +1,65 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// entry_point_timing.h:
+//   Optional per-entry-point CPU time histograms, enabled with angle_enable_entry_point_timing.
+//
+
+#ifndef COMMON_ENTRY_POINT_TIMING_H_
+#define COMMON_ENTRY_POINT_TIMING_H_
+
+#include "common/entry_points_enum_autogen.h"
+#include "common/platform.h"
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
+#    include <stdint.h>
+#    include <chrono>
+#    include <vector>
+
+namespace angle
+{
+struct EntryPointTiming
+{
+    EntryPoint entryPoint;
+    uint64_t callCount;
+    // Upper bounds of the histogram buckets the percentiles fall in.
+    uint64_t p50Nanoseconds;
+    uint64_t p99Nanoseconds;
+};
+
+// Every thread records into its own histograms, so recording doesn't contend with other threads.
+void RecordEntryPointTime(EntryPoint entryPoint, uint64_t nanoseconds);
+
+// Returns the timings of the entry points called since the last collection, from all threads,
+// sorted from the slowest p99 down.
+std::vector<EntryPointTiming> CollectEntryPointTimings();
+
+class ScopedEntryPointTimer final
+{
+  public:
+    explicit ScopedEntryPointTimer(EntryPoint entryPoint)
+        : mEntryPoint(entryPoint), mStart(std::chrono::steady_clock::now())
+    {}
+    ~ScopedEntryPointTimer()
+    {
+        const auto elapsed = std::chrono::steady_clock::now() - mStart;
+        RecordEntryPointTime(
+            mEntryPoint,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+
+  private:
+    EntryPoint mEntryPoint;
+    std::chrono::steady_clock::time_point mStart;
+};
+}  // namespace angle
+
+#    define ANGLE_SCOPED_ENTRY_POINT_TIMER(entryPoint) \
+        angle::ScopedEntryPointTimer entryPointTimer(angle::EntryPoint::entryPoint)
+#else
+#    define ANGLE_SCOPED_ENTRY_POINT_TIMER(entryPoint) (void(0))
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
+
+#endif  // COMMON_ENTRY_POINT_TIMING_H_
@@ -364,6 +364,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "eglGetSyncValuesCHROMIUM";
         case EntryPoint::EGLHandleGPUSwitchANGLE:
             return "eglHandleGPUSwitchANGLE";
+        case EntryPoint::EGLHandleMemoryPressureANGLE:
+            return "eglHandleMemoryPressureANGLE";
         case EntryPoint::EGLInitialize:
             return "eglInitialize";
         case EntryPoint::EGLLabelObjectKHR:
@@ -188,6 +188,7 @@ enum class EntryPoint
     EGLGetSyncAttribKHR,
     EGLGetSyncValuesCHROMIUM,
     EGLHandleGPUSwitchANGLE,
+    EGLHandleMemoryPressureANGLE,
     EGLInitialize,
     EGLLabelObjectKHR,
     EGLLockSurfaceKHR,
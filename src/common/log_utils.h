@@ -20,6 +20,7 @@
 #include <string>
 
 #include "common/angleutils.h"
+#include "common/entry_point_timing.h"
 #include "common/entry_points_enum_autogen.h"
 #include "common/platform.h"
 
@@ -38,6 +39,8 @@ constexpr LogSeverity LOG_FATAL          = 4;
 constexpr LogSeverity LOG_NUM_SEVERITIES = 5;
 
 void Trace(LogSeverity severity, const char *message);
+// Whether Trace() outputs messages of |severity| in this build.
+bool ShouldCreateLogMessage(LogSeverity severity);
 
 // This class more or less represents a particular log message.  You
 // create an instance of LogMessage and then stream stuff to it.
@@ -219,6 +222,7 @@ std::ostream &FmtHex(std::ostream &os, T value)
 #if defined(ANGLE_TRACE_ENABLED)
 #    if defined(_MSC_VER)
 #        define EVENT(context, entryPoint, message, ...)                                     \
+            ANGLE_SCOPED_ENTRY_POINT_TIMER(entryPoint);                                      \
             gl::ScopedPerfEventHelper scopedPerfEventHelper##__LINE__(                       \
                 context, angle::EntryPoint::entryPoint);                                     \
             do                                                                               \
@@ -232,6 +236,7 @@ std::ostream &FmtHex(std::ostream &os, T value)
             } while (0)
 #    else
 #        define EVENT(context, entryPoint, message, ...)                                          \
+            ANGLE_SCOPED_ENTRY_POINT_TIMER(entryPoint);                                           \
             gl::ScopedPerfEventHelper scopedPerfEventHelper(context,                              \
                                                             angle::EntryPoint::entryPoint);       \
             do                                                                                    \
@@ -245,7 +250,7 @@ std::ostream &FmtHex(std::ostream &os, T value)
             } while (0)
 #    endif  // _MSC_VER
 #else
-#    define EVENT(message, ...) (void(0))
+#    define EVENT(context, entryPoint, message, ...) ANGLE_SCOPED_ENTRY_POINT_TIMER(entryPoint)
 #endif
 
 // Note that gSwallowStream is used instead of an arbitrary LOG() stream to avoid the creation of an
@@ -0,0 +1,479 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// track_event.cpp:
+//   Implements the Perfetto protobuf tracing backend.  The trace file is a sequence of
+//   Trace.packet fields, each holding a TracePacket, which is what Perfetto's trace processor and
+//   UI load.  Every thread writes its packets on its own trusted sequence, with its own interned
+//   names.
+//
+
+#include "common/track_event.h"
+
+#if defined(ANGLE_ENABLE_TRACK_EVENT_TRACING)
+#    include <stdio.h>
+#    include <string.h>
+#    include <atomic>
+#    include <chrono>
+#    include <mutex>
+#    include <sstream>
+#    include <string>
+#    include <vector>
+
+#    include "common/angleutils.h"
+#    include "common/base/anglebase/no_destructor.h"
+#    include "common/debug.h"
+#    include "common/string_utils.h"
+#    include "common/system_utils.h"
+
+namespace angle
+{
+namespace track_event
+{
+namespace
+{
+constexpr char kTraceFileVarName[]       = "ANGLE_TRACK_EVENT_FILE";
+constexpr char kTraceCategoriesVarName[] = "ANGLE_TRACK_EVENT_CATEGORIES";
+constexpr char kAndroidTraceFile[]       = "debug.angle.track_event.file";
+constexpr char kAndroidTraceCategories[] = "debug.angle.track_event.categories";
+
+constexpr const char *kCategoryNames[] = {"gpu.angle", "gpu.angle.gpu",
+                                          "gpu.angle.texture_metrics", "other"};
+static_assert(ArraySize(kCategoryNames) == static_cast<size_t>(Category::EnumCount),
+              "Missing category name");
+
+// A thread's buffer is written to the file once it is this large, or this old.
+constexpr size_t kFlushThresholdBytes        = 64 * 1024;
+constexpr uint64_t kFlushIntervalNanoseconds = 1'000'000'000;
+
+// Field numbers from Perfetto's protos/perfetto/trace/trace.proto and the messages it includes.
+constexpr uint32_t kTracePacketField = 1;
+
+constexpr uint32_t kPacketTimestampField               = 8;
+constexpr uint32_t kPacketTrustedPacketSequenceIdField = 10;
+constexpr uint32_t kPacketTrackEventField              = 11;
+constexpr uint32_t kPacketInternedDataField            = 12;
+constexpr uint32_t kPacketSequenceFlagsField           = 13;
+constexpr uint32_t kPacketTimestampClockIdField        = 58;
+constexpr uint32_t kPacketTrackDescriptorField         = 60;
+
+constexpr uint32_t kSequenceIncrementalStateCleared = 1;
+constexpr uint32_t kSequenceNeedsIncrementalState   = 2;
+// std::chrono::steady_clock is CLOCK_MONOTONIC where Perfetto records traces.
+constexpr uint32_t kBuiltinClockMonotonic = 3;
+
+constexpr uint32_t kTrackEventCategoryIidsField = 3;
+constexpr uint32_t kTrackEventTypeField         = 9;
+constexpr uint32_t kTrackEventNameIidField      = 10;
+constexpr uint32_t kTrackEventTrackUuidField    = 11;
+constexpr uint32_t kTrackEventNameField         = 23;
+constexpr uint32_t kTrackEventCounterValueField = 30;
+
+constexpr uint32_t kTrackEventTypeSliceBegin = 1;
+constexpr uint32_t kTrackEventTypeSliceEnd   = 2;
+constexpr uint32_t kTrackEventTypeInstant    = 3;
+constexpr uint32_t kTrackEventTypeCounter    = 4;
+
+constexpr uint32_t kInternedEventCategoriesField = 1;
+constexpr uint32_t kInternedEventNamesField      = 2;
+constexpr uint32_t kInternedIidField             = 1;
+constexpr uint32_t kInternedNameField            = 2;
+
+constexpr uint32_t kTrackDescriptorUuidField       = 1;
+constexpr uint32_t kTrackDescriptorNameField       = 2;
+constexpr uint32_t kTrackDescriptorParentUuidField = 5;
+constexpr uint32_t kTrackDescriptorCounterField    = 8;
+
+// Arbitrary, but unlikely to collide with the uuids of tracks from other producers.
+constexpr uint64_t kProcessTrackUuid     = 0x414E474C45000000ull;
+constexpr uint64_t kThreadTrackUuidBase  = kProcessTrackUuid + 0x10000;
+constexpr uint64_t kCounterTrackUuidBase = kProcessTrackUuid + 0x20000;
+
+constexpr uint32_t kVarintWireType          = 0;
+constexpr uint32_t kLengthDelimitedWireType = 2;
+// Lengths of nested messages are written in this many bytes, as redundant varints, so they can be
+// filled in once the message is complete.
+constexpr size_t kNestedLengthBytes = 4;
+
+class ProtoWriter final : angle::NonCopyable
+{
+  public:
+    explicit ProtoWriter(std::vector<uint8_t> *buffer) : mBuffer(buffer) {}
+
+    void writeVarint(uint32_t field, uint64_t value)
+    {
+        writeTag(field, kVarintWireType);
+        writeRawVarint(value);
+    }
+
+    void writeString(uint32_t field, const char *str)
+    {
+        const size_t length = strlen(str);
+        writeTag(field, kLengthDelimitedWireType);
+        writeRawVarint(length);
+        mBuffer->insert(mBuffer->end(), str, str + length);
+    }
+
+    size_t beginNested(uint32_t field)
+    {
+        writeTag(field, kLengthDelimitedWireType);
+        const size_t lengthOffset = mBuffer->size();
+        mBuffer->resize(lengthOffset + kNestedLengthBytes);
+        return lengthOffset;
+    }
+
+    void endNested(size_t lengthOffset)
+    {
+        size_t length = mBuffer->size() - lengthOffset - kNestedLengthBytes;
+        ASSERT(length < (1u << (7 * kNestedLengthBytes)));
+        for (size_t byte = 0; byte < kNestedLengthBytes; ++byte)
+        {
+            const uint8_t continuation = byte + 1 < kNestedLengthBytes ? 0x80 : 0;
+            (*mBuffer)[lengthOffset + byte] = static_cast<uint8_t>((length & 0x7F) | continuation);
+            length >>= 7;
+        }
+    }
+
+  private:
+    void writeTag(uint32_t field, uint32_t wireType) { writeRawVarint(field << 3 | wireType); }
+
+    void writeRawVarint(uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            mBuffer->push_back(static_cast<uint8_t>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        mBuffer->push_back(static_cast<uint8_t>(value));
+    }
+
+    std::vector<uint8_t> *mBuffer;
+};
+
+struct Tracer
+{
+    std::mutex mutex;
+    FILE *file = nullptr;
+    // The interned names, indexed by their id minus one.
+    std::vector<const char *> names;
+    std::atomic<uint32_t> nextSequenceId{1};
+};
+
+Tracer &GetTracer()
+{
+    static angle::base::NoDestructor<Tracer> sTracer;
+    return *sTracer;
+}
+
+uint64_t GetTimestampNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+class ThreadWriter final : angle::NonCopyable
+{
+  public:
+    ThreadWriter()
+        : mSequenceId(GetTracer().nextSequenceId++),
+          mTrackUuid(kThreadTrackUuidBase + mSequenceId),
+          mLastFlushTime(GetTimestampNanoseconds())
+    {
+        writeSequenceStart();
+    }
+    ~ThreadWriter() { flush(); }
+
+    void writeEvent(Category category,
+                    uint32_t type,
+                    uint64_t nameId,
+                    const char *name,
+                    uint64_t trackUuid,
+                    int64_t counterValue)
+    {
+        if (nameId != 0)
+        {
+            internName(nameId);
+        }
+
+        const uint64_t timestamp = GetTimestampNanoseconds();
+
+        ProtoWriter writer(&mBuffer);
+        const size_t packet = beginPacket(&writer, timestamp);
+        writer.writeVarint(kPacketSequenceFlagsField, kSequenceNeedsIncrementalState);
+
+        const size_t trackEvent = writer.beginNested(kPacketTrackEventField);
+        writer.writeVarint(kTrackEventTypeField, type);
+        // The thread tracks aren't described with the thread's pid and tid, so they are not the
+        // default track of the sequence, and are always given explicitly.
+        writer.writeVarint(kTrackEventTrackUuidField, trackUuid);
+        if (type == kTrackEventTypeCounter)
+        {
+            writer.writeVarint(kTrackEventCounterValueField, static_cast<uint64_t>(counterValue));
+        }
+        else
+        {
+            writer.writeVarint(kTrackEventCategoryIidsField, static_cast<uint64_t>(category) + 1);
+        }
+        if (name != nullptr)
+        {
+            writer.writeString(kTrackEventNameField, name);
+        }
+        else if (nameId != 0 && type != kTrackEventTypeCounter)
+        {
+            writer.writeVarint(kTrackEventNameIidField, nameId);
+        }
+        writer.endNested(trackEvent);
+
+        writer.endNested(packet);
+
+        if (mBuffer.size() >= kFlushThresholdBytes ||
+            timestamp - mLastFlushTime >= kFlushIntervalNanoseconds)
+        {
+            flush();
+            mLastFlushTime = timestamp;
+        }
+    }
+
+    void writeCounter(Category category, uint64_t nameId, int64_t value)
+    {
+        const uint64_t trackUuid = kCounterTrackUuidBase + nameId;
+        if (!isNameWritten(nameId, &mWrittenCounterTracks))
+        {
+            writeCounterTrack(trackUuid, nameId);
+        }
+        writeEvent(category, kTrackEventTypeCounter, 0, nullptr, trackUuid, value);
+    }
+
+    uint64_t getTrackUuid() const { return mTrackUuid; }
+
+  private:
+    size_t beginPacket(ProtoWriter *writer, uint64_t timestamp)
+    {
+        const size_t packet = writer->beginNested(kTracePacketField);
+        writer->writeVarint(kPacketTimestampField, timestamp);
+        writer->writeVarint(kPacketTimestampClockIdField, kBuiltinClockMonotonic);
+        writer->writeVarint(kPacketTrustedPacketSequenceIdField, mSequenceId);
+        return packet;
+    }
+
+    // Clears the incremental state, describes the thread's track, and interns the category names.
+    void writeSequenceStart()
+    {
+        const uint64_t timestamp = GetTimestampNanoseconds();
+        ProtoWriter writer(&mBuffer);
+
+        size_t packet = beginPacket(&writer, timestamp);
+        writer.writeVarint(kPacketSequenceFlagsField, kSequenceIncrementalStateCleared);
+        size_t descriptor = writer.beginNested(kPacketTrackDescriptorField);
+        writer.writeVarint(kTrackDescriptorUuidField, kProcessTrackUuid);
+        writer.writeString(kTrackDescriptorNameField, "ANGLE");
+        writer.endNested(descriptor);
+        writer.endNested(packet);
+
+        std::ostringstream threadName;
+        threadName << "ANGLE thread " << mSequenceId;
+        packet     = beginPacket(&writer, timestamp);
+        descriptor = writer.beginNested(kPacketTrackDescriptorField);
+        writer.writeVarint(kTrackDescriptorUuidField, mTrackUuid);
+        writer.writeVarint(kTrackDescriptorParentUuidField, kProcessTrackUuid);
+        writer.writeString(kTrackDescriptorNameField, threadName.str().c_str());
+        writer.endNested(descriptor);
+        writer.endNested(packet);
+
+        packet = beginPacket(&writer, timestamp);
+        writer.writeVarint(kPacketSequenceFlagsField, kSequenceNeedsIncrementalState);
+        const size_t internedData = writer.beginNested(kPacketInternedDataField);
+        for (size_t category = 0; category < ArraySize(kCategoryNames); ++category)
+        {
+            const size_t entry = writer.beginNested(kInternedEventCategoriesField);
+            writer.writeVarint(kInternedIidField, category + 1);
+            writer.writeString(kInternedNameField, kCategoryNames[category]);
+            writer.endNested(entry);
+        }
+        writer.endNested(internedData);
+        writer.endNested(packet);
+    }
+
+    void writeCounterTrack(uint64_t trackUuid, uint64_t nameId)
+    {
+        ProtoWriter writer(&mBuffer);
+        const size_t packet     = beginPacket(&writer, GetTimestampNanoseconds());
+        const size_t descriptor = writer.beginNested(kPacketTrackDescriptorField);
+        writer.writeVarint(kTrackDescriptorUuidField, trackUuid);
+        writer.writeVarint(kTrackDescriptorParentUuidField, kProcessTrackUuid);
+        writer.writeString(kTrackDescriptorNameField, getName(nameId));
+        writer.endNested(writer.beginNested(kTrackDescriptorCounterField));
+        writer.endNested(descriptor);
+        writer.endNested(packet);
+    }
+
+    void internName(uint64_t nameId)
+    {
+        if (isNameWritten(nameId, &mWrittenNames))
+        {
+            return;
+        }
+
+        ProtoWriter writer(&mBuffer);
+        const size_t packet = beginPacket(&writer, GetTimestampNanoseconds());
+        writer.writeVarint(kPacketSequenceFlagsField, kSequenceNeedsIncrementalState);
+        const size_t internedData = writer.beginNested(kPacketInternedDataField);
+        const size_t entry        = writer.beginNested(kInternedEventNamesField);
+        writer.writeVarint(kInternedIidField, nameId);
+        writer.writeString(kInternedNameField, getName(nameId));
+        writer.endNested(entry);
+        writer.endNested(internedData);
+        writer.endNested(packet);
+    }
+
+    // Marks the name as written, and returns whether it already was.
+    static bool isNameWritten(uint64_t nameId, std::vector<bool> *written)
+    {
+        if (nameId >= written->size())
+        {
+            written->resize(nameId + 1, false);
+        }
+        const bool wasWritten = (*written)[nameId];
+        (*written)[nameId]    = true;
+        return wasWritten;
+    }
+
+    static const char *getName(uint64_t nameId)
+    {
+        Tracer &tracer = GetTracer();
+        std::lock_guard<std::mutex> lock(tracer.mutex);
+        ASSERT(nameId > 0 && nameId <= tracer.names.size());
+        return tracer.names[nameId - 1];
+    }
+
+    void flush()
+    {
+        if (mBuffer.empty())
+        {
+            return;
+        }
+
+        Tracer &tracer = GetTracer();
+        {
+            std::lock_guard<std::mutex> lock(tracer.mutex);
+            if (tracer.file != nullptr)
+            {
+                fwrite(mBuffer.data(), 1, mBuffer.size(), tracer.file);
+                fflush(tracer.file);
+            }
+        }
+        mBuffer.clear();
+    }
+
+    const uint32_t mSequenceId;
+    const uint64_t mTrackUuid;
+    uint64_t mLastFlushTime;
+    std::vector<uint8_t> mBuffer;
+    std::vector<bool> mWrittenNames;
+    std::vector<bool> mWrittenCounterTracks;
+};
+
+ThreadWriter &GetThreadWriter()
+{
+    thread_local ThreadWriter tThreadWriter;
+    return tThreadWriter;
+}
+
+uint32_t ParseCategories(const std::string &categories)
+{
+    if (categories.empty())
+    {
+        return (1u << static_cast<uint32_t>(Category::EnumCount)) - 1;
+    }
+
+    uint32_t enabledCategories = 0;
+    for (const std::string &category :
+         SplitString(categories, ",", TRIM_WHITESPACE, SPLIT_WANT_NONEMPTY))
+    {
+        for (size_t index = 0; index < ArraySize(kCategoryNames); ++index)
+        {
+            if (category == kCategoryNames[index])
+            {
+                enabledCategories |= 1u << index;
+            }
+        }
+    }
+    return enabledCategories;
+}
+}  // anonymous namespace
+
+uint32_t InitializeTracing()
+{
+    const std::string path =
+        GetEnvironmentVarOrAndroidProperty(kTraceFileVarName, kAndroidTraceFile);
+    if (path.empty())
+    {
+        return 0;
+    }
+
+    Tracer &tracer = GetTracer();
+    {
+        std::lock_guard<std::mutex> lock(tracer.mutex);
+        tracer.file = fopen(path.c_str(), "wb");
+    }
+    if (tracer.file == nullptr)
+    {
+        ERR() << "Failed to open the track event trace file " << path;
+        return 0;
+    }
+
+    INFO() << "Writing track events to " << path;
+    return ParseCategories(
+        GetEnvironmentVarOrAndroidProperty(kTraceCategoriesVarName, kAndroidTraceCategories));
+}
+
+uint64_t InternName(const char *name)
+{
+    Tracer &tracer = GetTracer();
+    std::lock_guard<std::mutex> lock(tracer.mutex);
+    tracer.names.push_back(name);
+    return tracer.names.size();
+}
+
+void WriteSliceBegin(Category category, uint64_t nameId)
+{
+    ThreadWriter &writer = GetThreadWriter();
+    writer.writeEvent(category, kTrackEventTypeSliceBegin, nameId, nullptr, writer.getTrackUuid(),
+                      0);
+}
+
+void WriteSliceEnd(Category category)
+{
+    ThreadWriter &writer = GetThreadWriter();
+    writer.writeEvent(category, kTrackEventTypeSliceEnd, 0, nullptr, writer.getTrackUuid(), 0);
+}
+
+void WriteInstant(Category category, uint64_t nameId)
+{
+    ThreadWriter &writer = GetThreadWriter();
+    writer.writeEvent(category, kTrackEventTypeInstant, nameId, nullptr, writer.getTrackUuid(), 0);
+}
+
+void WriteSliceBeginWithName(Category category, const char *name)
+{
+    ThreadWriter &writer = GetThreadWriter();
+    writer.writeEvent(category, kTrackEventTypeSliceBegin, 0, name, writer.getTrackUuid(), 0);
+}
+
+void WriteInstantWithName(Category category, const char *name)
+{
+    ThreadWriter &writer = GetThreadWriter();
+    writer.writeEvent(category, kTrackEventTypeInstant, 0, name, writer.getTrackUuid(), 0);
+}
+
+void WriteCounter(Category category, uint64_t nameId, int64_t value)
+{
+    GetThreadWriter().writeCounter(category, nameId, value);
+}
+}  // namespace track_event
+}  // namespace angle
+
+#endif  // defined(ANGLE_ENABLE_TRACK_EVENT_TRACING)
@@ -0,0 +1,144 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// track_event.h:
+//   A low overhead tracing backend, enabled with angle_enable_track_event_tracing, that writes
+//   ANGLE's trace events straight to a file in the Perfetto protobuf trace format instead of
+//   going through the platform methods.
+//
+
+#ifndef COMMON_TRACK_EVENT_H_
+#define COMMON_TRACK_EVENT_H_
+
+#include "common/platform.h"
+
+#if defined(ANGLE_ENABLE_TRACK_EVENT_TRACING)
+#    include <stdint.h>
+
+namespace angle
+{
+namespace track_event
+{
+// The categories are known at compile time, so checking whether one is enabled is a bit test.
+enum class Category : uint32_t
+{
+    Angle,
+    AngleGpu,
+    AngleTextureMetrics,
+    Other,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+constexpr bool StringsEqual(const char *a, const char *b)
+{
+    return *a == *b && (*a == '\0' || StringsEqual(a + 1, b + 1));
+}
+
+constexpr Category GetCategory(const char *name)
+{
+    return StringsEqual(name, "gpu.angle")                   ? Category::Angle
+           : StringsEqual(name, "gpu.angle.gpu")             ? Category::AngleGpu
+           : StringsEqual(name, "gpu.angle.texture_metrics") ? Category::AngleTextureMetrics
+                                                             : Category::Other;
+}
+
+// Reads ANGLE_TRACK_EVENT_FILE and ANGLE_TRACK_EVENT_CATEGORIES (or their Android property
+// equivalents) and returns the mask of enabled categories.  Nothing is enabled without a file.
+uint32_t InitializeTracing();
+
+inline bool IsCategoryEnabled(Category category)
+{
+    static const uint32_t sEnabledCategories = InitializeTracing();
+    return ((sEnabledCategories >> static_cast<uint32_t>(category)) & 1) != 0;
+}
+
+// Returns the id that refers to |name| in the trace.  |name| must have static lifetime.  Every
+// name is interned once per call site, and only written to the trace once per thread.
+uint64_t InternName(const char *name);
+
+// Events are written to a per-thread buffer, which is appended to the trace file when it grows
+// large, periodically, and when the thread exits.
+void WriteSliceBegin(Category category, uint64_t nameId);
+void WriteSliceEnd(Category category);
+void WriteInstant(Category category, uint64_t nameId);
+// For names that don't have static lifetime; they are copied in the trace with every event.
+void WriteSliceBeginWithName(Category category, const char *name);
+void WriteInstantWithName(Category category, const char *name);
+// Counters are shown as separate tracks named after the counter.
+void WriteCounter(Category category, uint64_t nameId, int64_t value);
+
+class ScopedSlice final
+{
+  public:
+    // The name is only interned if the category is enabled.
+    ScopedSlice(Category category, uint64_t (*getNameId)())
+        : mCategory(category), mEnabled(IsCategoryEnabled(category))
+    {
+        if (mEnabled)
+        {
+            WriteSliceBegin(category, getNameId());
+        }
+    }
+    ~ScopedSlice()
+    {
+        if (mEnabled)
+        {
+            WriteSliceEnd(mCategory);
+        }
+    }
+
+  private:
+    Category mCategory;
+    bool mEnabled;
+};
+}  // namespace track_event
+}  // namespace angle
+
+// |name| must be a string literal, which is interned the first time the call site is reached.
+#    define ANGLE_TRACK_EVENT_NAME_ID_GETTER(name)                                     \
+        []() -> uint64_t {                                                             \
+            static const uint64_t kNameId = ::angle::track_event::InternName("" name); \
+            return kNameId;                                                            \
+        }
+#    define ANGLE_TRACK_EVENT_NAME_ID(name) ANGLE_TRACK_EVENT_NAME_ID_GETTER(name)()
+
+#    define ANGLE_TRACK_EVENT_ENABLED(category)                                              \
+        ::angle::track_event::IsCategoryEnabled(::angle::track_event::GetCategory(category))
+
+#    define ANGLE_TRACK_EVENT_WRITE(category, writer, ...)                        \
+        do                                                                        \
+        {                                                                         \
+            constexpr ::angle::track_event::Category kTrackEventCategory =        \
+                ::angle::track_event::GetCategory(category);                      \
+            if (::angle::track_event::IsCategoryEnabled(kTrackEventCategory))     \
+            {                                                                     \
+                ::angle::track_event::writer(kTrackEventCategory, ##__VA_ARGS__); \
+            }                                                                     \
+        } while (0)
+
+#    define ANGLE_TRACK_EVENT_BEGIN(category, name)                                         \
+        ANGLE_TRACK_EVENT_WRITE(category, WriteSliceBegin, ANGLE_TRACK_EVENT_NAME_ID(name))
+#    define ANGLE_TRACK_EVENT_END(category) ANGLE_TRACK_EVENT_WRITE(category, WriteSliceEnd)
+#    define ANGLE_TRACK_EVENT_INSTANT(category, name)                                    \
+        ANGLE_TRACK_EVENT_WRITE(category, WriteInstant, ANGLE_TRACK_EVENT_NAME_ID(name))
+#    define ANGLE_TRACK_EVENT_COPY_BEGIN(category, name)                 \
+        ANGLE_TRACK_EVENT_WRITE(category, WriteSliceBeginWithName, name)
+#    define ANGLE_TRACK_EVENT_COPY_INSTANT(category, name)            \
+        ANGLE_TRACK_EVENT_WRITE(category, WriteInstantWithName, name)
+#    define ANGLE_TRACK_EVENT_COUNTER(category, name, value)                             \
+        ANGLE_TRACK_EVENT_WRITE(category, WriteCounter, ANGLE_TRACK_EVENT_NAME_ID(name), \
+                                static_cast<int64_t>(value))
+
+#    define ANGLE_TRACK_EVENT_CONCAT_IMPL(a, b) a##b
+#    define ANGLE_TRACK_EVENT_CONCAT(a, b) ANGLE_TRACK_EVENT_CONCAT_IMPL(a, b)
+#    define ANGLE_TRACK_EVENT(category, name)                                                    \
+        ::angle::track_event::ScopedSlice ANGLE_TRACK_EVENT_CONCAT(trackEventSlice, __LINE__)(   \
+            ::angle::track_event::GetCategory(category), ANGLE_TRACK_EVENT_NAME_ID_GETTER(name))
+
+#endif  // defined(ANGLE_ENABLE_TRACK_EVENT_TRACING)
+
+#endif  // COMMON_TRACK_EVENT_H_
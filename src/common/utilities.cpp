@@ -12,6 +12,8 @@
 #include "common/platform.h"
 #include "common/string_utils.h"
 
+#include <algorithm>
+#include <limits>
 #include <set>
 
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
@@ -21,74 +23,474 @@
 #    include <wrl/wrappers/corewrappers.h>
 #endif
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    endif
+#    include <immintrin.h>
+#    define ANGLE_INDEX_RANGE_USE_SSE
+// The kernels are selected at runtime, so they are compiled for their instruction set regardless
+// of the target's baseline.
+#    if defined(__GNUC__) || defined(__clang__)
+#        define ANGLE_INDEX_RANGE_SSE41_TARGET __attribute__((target("sse4.1")))
+#        define ANGLE_INDEX_RANGE_AVX2_TARGET __attribute__((target("avx2")))
+#        define ANGLE_INDEX_RANGE_XSAVE_TARGET __attribute__((target("xsave")))
+#    else
+#        define ANGLE_INDEX_RANGE_SSE41_TARGET
+#        define ANGLE_INDEX_RANGE_AVX2_TARGET
+#        define ANGLE_INDEX_RANGE_XSAVE_TARGET
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    if defined(_M_ARM64)
+#        include <arm64_neon.h>
+#    else
+#        include <arm_neon.h>
+#    endif
+#    define ANGLE_INDEX_RANGE_USE_NEON
+#endif
+
 namespace
 {
 
+// Minimum and maximum indices in a range of indices, and the number of primitive restart indices
+// found in it.  The primitive restart index is always the maximum value of the index type, so it
+// never affects the minimum; it's only masked out when computing the maximum.
 template <class IndexType>
-gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
-                                      size_t count,
-                                      bool primitiveRestartEnabled,
-                                      GLuint primitiveRestartIndex)
+struct IndexMinMax
 {
-    ASSERT(count > 0);
+    IndexType minIndex  = std::numeric_limits<IndexType>::max();
+    IndexType maxIndex  = 0;
+    size_t restartCount = 0;
+};
 
-    IndexType minIndex                = 0;
-    IndexType maxIndex                = 0;
-    size_t nonPrimitiveRestartIndices = 0;
+template <class IndexType>
+void ComputeTypedIndexMinMaxScalar(const IndexType *indices,
+                                   size_t count,
+                                   bool primitiveRestartEnabled,
+                                   IndexMinMax<IndexType> *minMax)
+{
+    constexpr IndexType kRestartIndex = std::numeric_limits<IndexType>::max();
 
     if (primitiveRestartEnabled)
     {
-        // Find the first non-primitive restart index to initialize the min and max values
-        size_t i = 0;
-        for (; i < count; i++)
+        for (size_t i = 0; i < count; i++)
         {
-            if (indices[i] != primitiveRestartIndex)
+            const IndexType index = indices[i];
+            if (index == kRestartIndex)
             {
-                minIndex = indices[i];
-                maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
-                break;
+                minMax->restartCount++;
+                continue;
             }
+            minMax->minIndex = std::min(minMax->minIndex, index);
+            minMax->maxIndex = std::max(minMax->maxIndex, index);
         }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            minMax->minIndex = std::min(minMax->minIndex, indices[i]);
+            minMax->maxIndex = std::max(minMax->maxIndex, indices[i]);
+        }
+    }
+}
+
+// SIMD kernels process as many indices as they can in whole vectors and return the number of
+// indices processed.  The remaining indices are processed by the scalar kernel.
+#if defined(ANGLE_INDEX_RANGE_USE_SSE)
+
+bool SupportsSSE41()
+{
+#    if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 1)
+    {
+        return false;
+    }
+    __cpuid(info, 1);
+    return (info[2] >> 19) & 1;
+#    else
+    return __builtin_cpu_supports("sse4.1");
+#    endif
+}
+
+ANGLE_INDEX_RANGE_XSAVE_TARGET bool SupportsAVX2()
+{
+#    if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+
+    // The OS must also preserve the YMM registers.
+    __cpuid(info, 1);
+    const bool hasOSXSave = (info[2] >> 27) & 1;
+    const bool hasAVX     = (info[2] >> 28) & 1;
+    if (!hasOSXSave || !hasAVX || (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+
+    __cpuidex(info, 7, 0);
+    return (info[1] >> 5) & 1;
+#    else
+    return __builtin_cpu_supports("avx2");
+#    endif
+}
+
+template <class IndexType>
+struct SSE41Ops;
+template <>
+struct SSE41Ops<uint8_t>
+{
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i Min(__m128i a, __m128i b)
+    {
+        return _mm_min_epu8(a, b);
+    }
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i Max(__m128i a, __m128i b)
+    {
+        return _mm_max_epu8(a, b);
+    }
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i CmpEq(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+};
+template <>
+struct SSE41Ops<uint16_t>
+{
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i Min(__m128i a, __m128i b)
+    {
+        return _mm_min_epu16(a, b);
+    }
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i Max(__m128i a, __m128i b)
+    {
+        return _mm_max_epu16(a, b);
+    }
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i CmpEq(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+};
+template <>
+struct SSE41Ops<uint32_t>
+{
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i Min(__m128i a, __m128i b)
+    {
+        return _mm_min_epu32(a, b);
+    }
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i Max(__m128i a, __m128i b)
+    {
+        return _mm_max_epu32(a, b);
+    }
+    ANGLE_INDEX_RANGE_SSE41_TARGET static __m128i CmpEq(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+};
+
+template <class IndexType>
+ANGLE_INDEX_RANGE_SSE41_TARGET size_t ComputeTypedIndexMinMaxSSE41(const IndexType *indices,
+                                                                   size_t count,
+                                                                   bool primitiveRestartEnabled,
+                                                                   IndexMinMax<IndexType> *minMax)
+{
+    using Ops                = SSE41Ops<IndexType>;
+    constexpr size_t kLanes  = sizeof(__m128i) / sizeof(IndexType);
+    const __m128i allOnes    = _mm_set1_epi8(-1);
+    __m128i minVec           = allOnes;
+    __m128i maxVec           = _mm_setzero_si128();
+    size_t restartMaskBits   = 0;
+    const size_t vectorCount = count - count % kLanes;
 
-        // Loop over the rest of the indices
-        for (; i < count; i++)
+    if (primitiveRestartEnabled)
+    {
+        for (size_t i = 0; i < vectorCount; i += kLanes)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                if (minIndex > indices[i])
-                {
-                    minIndex = indices[i];
-                }
-                if (maxIndex < indices[i])
-                {
-                    maxIndex = indices[i];
-                }
-                nonPrimitiveRestartIndices++;
-            }
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            const __m128i isRestart = Ops::CmpEq(value, allOnes);
+            minVec                  = Ops::Min(minVec, value);
+            maxVec                  = Ops::Max(maxVec, _mm_andnot_si128(isRestart, value));
+            restartMaskBits += gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(isRestart)));
         }
     }
     else
     {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
-        nonPrimitiveRestartIndices = count;
+        for (size_t i = 0; i < vectorCount; i += kLanes)
+        {
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            minVec              = Ops::Min(minVec, value);
+            maxVec              = Ops::Max(maxVec, value);
+        }
+    }
+
+    alignas(16) IndexType mins[kLanes];
+    alignas(16) IndexType maxs[kLanes];
+    _mm_store_si128(reinterpret_cast<__m128i *>(mins), minVec);
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxs), maxVec);
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        minMax->minIndex = std::min(minMax->minIndex, mins[lane]);
+        minMax->maxIndex = std::max(minMax->maxIndex, maxs[lane]);
+    }
+
+    // Every restart index sets one mask bit per byte.
+    minMax->restartCount += restartMaskBits / sizeof(IndexType);
+    return vectorCount;
+}
 
-        for (size_t i = 1; i < count; i++)
+template <class IndexType>
+struct AVX2Ops;
+template <>
+struct AVX2Ops<uint8_t>
+{
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu8(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu8(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i CmpEq(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+};
+template <>
+struct AVX2Ops<uint16_t>
+{
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu16(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu16(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i CmpEq(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+};
+template <>
+struct AVX2Ops<uint32_t>
+{
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i Min(__m256i a, __m256i b)
+    {
+        return _mm256_min_epu32(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i Max(__m256i a, __m256i b)
+    {
+        return _mm256_max_epu32(a, b);
+    }
+    ANGLE_INDEX_RANGE_AVX2_TARGET static __m256i CmpEq(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+};
+
+template <class IndexType>
+ANGLE_INDEX_RANGE_AVX2_TARGET size_t ComputeTypedIndexMinMaxAVX2(const IndexType *indices,
+                                                                 size_t count,
+                                                                 bool primitiveRestartEnabled,
+                                                                 IndexMinMax<IndexType> *minMax)
+{
+    using Ops                = AVX2Ops<IndexType>;
+    constexpr size_t kLanes  = sizeof(__m256i) / sizeof(IndexType);
+    const __m256i allOnes    = _mm256_set1_epi8(-1);
+    __m256i minVec           = allOnes;
+    __m256i maxVec           = _mm256_setzero_si256();
+    size_t restartMaskBits   = 0;
+    const size_t vectorCount = count - count % kLanes;
+
+    if (primitiveRestartEnabled)
+    {
+        for (size_t i = 0; i < vectorCount; i += kLanes)
         {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
+            const __m256i value =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            const __m256i isRestart = Ops::CmpEq(value, allOnes);
+            minVec                  = Ops::Min(minVec, value);
+            maxVec                  = Ops::Max(maxVec, _mm256_andnot_si256(isRestart, value));
+            restartMaskBits +=
+                gl::BitCount(static_cast<uint32_t>(_mm256_movemask_epi8(isRestart)));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < vectorCount; i += kLanes)
+        {
+            const __m256i value =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            minVec = Ops::Min(minVec, value);
+            maxVec = Ops::Max(maxVec, value);
         }
     }
 
-    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
-                          nonPrimitiveRestartIndices);
+    alignas(32) IndexType mins[kLanes];
+    alignas(32) IndexType maxs[kLanes];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(mins), minVec);
+    _mm256_store_si256(reinterpret_cast<__m256i *>(maxs), maxVec);
+    for (size_t lane = 0; lane < kLanes; ++lane)
+    {
+        minMax->minIndex = std::min(minMax->minIndex, mins[lane]);
+        minMax->maxIndex = std::max(minMax->maxIndex, maxs[lane]);
+    }
+
+    // Every restart index sets one mask bit per byte.
+    minMax->restartCount += restartMaskBits / sizeof(IndexType);
+    return vectorCount;
+}
+
+template <class IndexType>
+size_t ComputeTypedIndexMinMaxSIMD(const IndexType *indices,
+                                   size_t count,
+                                   bool primitiveRestartEnabled,
+                                   IndexMinMax<IndexType> *minMax)
+{
+    static const bool kSupportsAVX2  = SupportsAVX2();
+    static const bool kSupportsSSE41 = SupportsSSE41();
+
+    if (kSupportsAVX2)
+    {
+        return ComputeTypedIndexMinMaxAVX2(indices, count, primitiveRestartEnabled, minMax);
+    }
+    if (kSupportsSSE41)
+    {
+        return ComputeTypedIndexMinMaxSSE41(indices, count, primitiveRestartEnabled, minMax);
+    }
+    return 0;
+}
+
+#elif defined(ANGLE_INDEX_RANGE_USE_NEON)
+
+template <class IndexType>
+struct NEONOps;
+template <>
+struct NEONOps<uint8_t>
+{
+    using Vec = uint8x16_t;
+    static Vec Load(const uint8_t *indices) { return vld1q_u8(indices); }
+    static Vec Dup(uint8_t value) { return vdupq_n_u8(value); }
+    static Vec Min(Vec a, Vec b) { return vminq_u8(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u8(a, b); }
+    static Vec CmpEq(Vec a, Vec b) { return vceqq_u8(a, b); }
+    static Vec AndNot(Vec a, Vec mask) { return vbicq_u8(a, mask); }
+    static uint8_t ReduceMin(Vec a) { return vminvq_u8(a); }
+    static uint8_t ReduceMax(Vec a) { return vmaxvq_u8(a); }
+    static size_t CountMask(Vec mask) { return vaddvq_u8(vshrq_n_u8(mask, 7)); }
+};
+template <>
+struct NEONOps<uint16_t>
+{
+    using Vec = uint16x8_t;
+    static Vec Load(const uint16_t *indices) { return vld1q_u16(indices); }
+    static Vec Dup(uint16_t value) { return vdupq_n_u16(value); }
+    static Vec Min(Vec a, Vec b) { return vminq_u16(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u16(a, b); }
+    static Vec CmpEq(Vec a, Vec b) { return vceqq_u16(a, b); }
+    static Vec AndNot(Vec a, Vec mask) { return vbicq_u16(a, mask); }
+    static uint16_t ReduceMin(Vec a) { return vminvq_u16(a); }
+    static uint16_t ReduceMax(Vec a) { return vmaxvq_u16(a); }
+    static size_t CountMask(Vec mask) { return vaddvq_u16(vshrq_n_u16(mask, 15)); }
+};
+template <>
+struct NEONOps<uint32_t>
+{
+    using Vec = uint32x4_t;
+    static Vec Load(const uint32_t *indices) { return vld1q_u32(indices); }
+    static Vec Dup(uint32_t value) { return vdupq_n_u32(value); }
+    static Vec Min(Vec a, Vec b) { return vminq_u32(a, b); }
+    static Vec Max(Vec a, Vec b) { return vmaxq_u32(a, b); }
+    static Vec CmpEq(Vec a, Vec b) { return vceqq_u32(a, b); }
+    static Vec AndNot(Vec a, Vec mask) { return vbicq_u32(a, mask); }
+    static uint32_t ReduceMin(Vec a) { return vminvq_u32(a); }
+    static uint32_t ReduceMax(Vec a) { return vmaxvq_u32(a); }
+    static size_t CountMask(Vec mask) { return vaddvq_u32(vshrq_n_u32(mask, 31)); }
+};
+
+template <class IndexType>
+size_t ComputeTypedIndexMinMaxSIMD(const IndexType *indices,
+                                   size_t count,
+                                   bool primitiveRestartEnabled,
+                                   IndexMinMax<IndexType> *minMax)
+{
+    using Ops                = NEONOps<IndexType>;
+    using Vec                = typename Ops::Vec;
+    constexpr size_t kLanes  = sizeof(Vec) / sizeof(IndexType);
+    const Vec allOnes        = Ops::Dup(std::numeric_limits<IndexType>::max());
+    Vec minVec               = allOnes;
+    Vec maxVec               = Ops::Dup(0);
+    size_t restartCount      = 0;
+    const size_t vectorCount = count - count % kLanes;
+
+    if (primitiveRestartEnabled)
+    {
+        for (size_t i = 0; i < vectorCount; i += kLanes)
+        {
+            const Vec value     = Ops::Load(indices + i);
+            const Vec isRestart = Ops::CmpEq(value, allOnes);
+            minVec              = Ops::Min(minVec, value);
+            maxVec              = Ops::Max(maxVec, Ops::AndNot(value, isRestart));
+            restartCount += Ops::CountMask(isRestart);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < vectorCount; i += kLanes)
+        {
+            const Vec value = Ops::Load(indices + i);
+            minVec          = Ops::Min(minVec, value);
+            maxVec          = Ops::Max(maxVec, value);
+        }
+    }
+
+    minMax->minIndex = std::min(minMax->minIndex, Ops::ReduceMin(minVec));
+    minMax->maxIndex = std::max(minMax->maxIndex, Ops::ReduceMax(maxVec));
+    minMax->restartCount += restartCount;
+    return vectorCount;
+}
+
+#else
+
+template <class IndexType>
+size_t ComputeTypedIndexMinMaxSIMD(const IndexType *indices,
+                                   size_t count,
+                                   bool primitiveRestartEnabled,
+                                   IndexMinMax<IndexType> *minMax)
+{
+    return 0;
+}
+
+#endif
+
+template <class IndexType>
+gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
+                                      size_t count,
+                                      bool primitiveRestartEnabled,
+                                      GLuint primitiveRestartIndex)
+{
+    ASSERT(count > 0);
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
+
+    IndexMinMax<IndexType> minMax;
+    const size_t simdCount =
+        ComputeTypedIndexMinMaxSIMD(indices, count, primitiveRestartEnabled, &minMax);
+    ComputeTypedIndexMinMaxScalar(indices + simdCount, count - simdCount, primitiveRestartEnabled,
+                                  &minMax);
+
+    const size_t nonPrimitiveRestartIndices = count - minMax.restartCount;
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        return gl::IndexRange(0, 0, 0);
+    }
+
+    return gl::IndexRange(static_cast<size_t>(minMax.minIndex),
+                          static_cast<size_t>(minMax.maxIndex), nonPrimitiveRestartIndices);
 }
 
 }  // anonymous namespace
@@ -205,4 +205,84 @@ TEST(Utilities, ConstStrLen)
     EXPECT_EQ(3u, n2);
 }
 
+
+template <typename IndexType>
+gl::IndexRange ComputeReferenceIndexRange(const IndexType *indices,
+                                          size_t count,
+                                          bool primitiveRestartEnabled)
+{
+    constexpr IndexType kRestartIndex = std::numeric_limits<IndexType>::max();
+
+    bool found         = false;
+    IndexType minIndex = 0;
+    IndexType maxIndex = 0;
+    size_t indexCount  = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (primitiveRestartEnabled && indices[i] == kRestartIndex)
+        {
+            continue;
+        }
+        minIndex = found ? std::min(minIndex, indices[i]) : indices[i];
+        maxIndex = found ? std::max(maxIndex, indices[i]) : indices[i];
+        found    = true;
+        ++indexCount;
+    }
+    return gl::IndexRange(minIndex, maxIndex, indexCount);
+}
+
+template <typename IndexType>
+void TestComputeIndexRange(gl::DrawElementsType indexType)
+{
+    constexpr IndexType kRestartIndex = std::numeric_limits<IndexType>::max();
+
+    // Cover counts that are not multiple of the vector sizes, and offsets that are not aligned.
+    std::vector<IndexType> indices(1027);
+    for (size_t i = 0; i < indices.size(); ++i)
+    {
+        indices[i] = static_cast<IndexType>((i * 7919u + 13u) % kRestartIndex);
+        if (i % 11 == 5)
+        {
+            indices[i] = kRestartIndex;
+        }
+    }
+
+    for (size_t offset : {0, 1, 3})
+    {
+        for (size_t count : {1, 2, 7, 15, 16, 17, 31, 33, 64, 100, 1000})
+        {
+            for (bool primitiveRestartEnabled : {false, true})
+            {
+                const IndexType *data = indices.data() + offset;
+                const gl::IndexRange expected =
+                    ComputeReferenceIndexRange(data, count, primitiveRestartEnabled);
+                const gl::IndexRange actual =
+                    gl::ComputeIndexRange(indexType, data, count, primitiveRestartEnabled);
+                EXPECT_EQ(expected.start, actual.start) << offset << " " << count;
+                EXPECT_EQ(expected.end, actual.end) << offset << " " << count;
+                EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount)
+                    << offset << " " << count;
+            }
+        }
+    }
+
+    // All primitive restart indices.
+    std::vector<IndexType> restartIndices(100, kRestartIndex);
+    gl::IndexRange range =
+        gl::ComputeIndexRange(indexType, restartIndices.data(), restartIndices.size(), true);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+    range = gl::ComputeIndexRange(indexType, restartIndices.data(), restartIndices.size(), false);
+    EXPECT_EQ(kRestartIndex, range.start);
+    EXPECT_EQ(kRestartIndex, range.end);
+    EXPECT_EQ(restartIndices.size(), range.vertexIndexCount);
+}
+
+// Test that ComputeIndexRange matches a simple reference implementation for all index types.
+TEST(Utilities, ComputeIndexRange)
+{
+    TestComputeIndexRange<GLubyte>(gl::DrawElementsType::UnsignedByte);
+    TestComputeIndexRange<GLushort>(gl::DrawElementsType::UnsignedShort);
+    TestComputeIndexRange<GLuint>(gl::DrawElementsType::UnsignedInt);
+}
+
 }  // anonymous namespace
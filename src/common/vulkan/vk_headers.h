@@ -119,6 +119,9 @@ extern PFN_vkCmdSetPatchControlPointsEXT vkCmdSetPatchControlPointsEXT;
 extern PFN_vkCmdSetPrimitiveRestartEnableEXT vkCmdSetPrimitiveRestartEnableEXT;
 extern PFN_vkCmdSetRasterizerDiscardEnableEXT vkCmdSetRasterizerDiscardEnableEXT;
 
+// VK_EXT_extended_dynamic_state3
+extern PFN_vkCmdSetColorBlendEquationEXT vkCmdSetColorBlendEquationEXT;
+
 // VK_EXT_vertex_input_dynamic_state
 extern PFN_vkCmdSetVertexInputEXT vkCmdSetVertexInputEXT;
 
@@ -129,6 +132,14 @@ extern PFN_vkCmdSetFragmentShadingRateKHR vkCmdSetFragmentShadingRateKHR;
 // VK_GOOGLE_display_timing
 extern PFN_vkGetPastPresentationTimingGOOGLE vkGetPastPresentationTimingGOOGLE;
 
+// VK_KHR_present_wait
+extern PFN_vkWaitForPresentKHR vkWaitForPresentKHR;
+
+// VK_EXT_calibrated_timestamps
+extern PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT
+    vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+extern PFN_vkGetCalibratedTimestampsEXT vkGetCalibratedTimestampsEXT;
+
 // VK_EXT_host_image_copy
 extern PFN_vkCopyImageToImageEXT vkCopyImageToImageEXT;
 extern PFN_vkCopyImageToMemoryEXT vkCopyImageToMemoryEXT;
@@ -136,6 +147,13 @@ extern PFN_vkCopyMemoryToImageEXT vkCopyMemoryToImageEXT;
 extern PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT;
 extern PFN_vkGetImageSubresourceLayout2EXT vkGetImageSubresourceLayout2EXT;
 
+// VK_EXT_descriptor_buffer
+extern PFN_vkGetDescriptorSetLayoutSizeEXT vkGetDescriptorSetLayoutSizeEXT;
+extern PFN_vkGetDescriptorSetLayoutBindingOffsetEXT vkGetDescriptorSetLayoutBindingOffsetEXT;
+extern PFN_vkGetDescriptorEXT vkGetDescriptorEXT;
+extern PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT;
+extern PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT;
+
 // VK_KHR_dynamic_rendering
 extern PFN_vkCmdBeginRenderingKHR vkCmdBeginRenderingKHR;
 extern PFN_vkCmdEndRenderingKHR vkCmdEndRenderingKHR;
@@ -116,6 +116,7 @@ extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
     if (!IsOutputSPIRV(shaderOutput))
     {
         hasUnsupportedOptions = hasUnsupportedOptions || options.useSpecializationConstant ||
+                                options.useSpecializationConstantForFlip ||
                                 options.addVulkanXfbEmulationSupportCode ||
                                 options.roundOutputAfterDithering ||
                                 options.addAdvancedBlendEquationsEmulation;
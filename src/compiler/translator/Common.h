@@ -21,6 +21,19 @@
 #include "common/debug.h"
 #include "compiler/translator/PoolAlloc.h"
 
+// The name of the function calling validateAST or TIntermTraverser::updateTree, which is the pass
+// that just ran.  It names the phases of the compile phase stats.
+#if defined(__has_builtin)
+#    if __has_builtin(__builtin_FUNCTION)
+#        define ANGLE_COMPILER_PASS_NAME __builtin_FUNCTION()
+#    endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1926
+#    define ANGLE_COMPILER_PASS_NAME __builtin_FUNCTION()
+#endif
+#if !defined(ANGLE_COMPILER_PASS_NAME)
+#    define ANGLE_COMPILER_PASS_NAME "Unknown"
+#endif
+
 namespace sh
 {
 
@@ -7,6 +7,7 @@
 #include "compiler/translator/Compiler.h"
 
 #include <sstream>
+#include <tuple>
 
 #include "angle_gl.h"
 
@@ -14,6 +15,7 @@
 #include "common/CompiledShaderState.h"
 #include "common/PackedEnums.h"
 #include "common/angle_version_info.h"
+#include "compiler/preprocessor/Token.h"
 
 #include "compiler/translator/CallDAG.h"
 #include "compiler/translator/CollectVariables.h"
@@ -61,6 +63,7 @@
 #include "compiler/translator/tree_ops/glsl/apple/RewriteDoWhile.h"
 #include "compiler/translator/tree_ops/glsl/apple/UnfoldShortCircuitAST.h"
 #include "compiler/translator/tree_util/BuiltIn.h"
+#include "compiler/translator/tree_util/FindASTFeatures.h"
 #include "compiler/translator/tree_util/IntermNodePatternMatcher.h"
 #include "compiler/translator/tree_util/ReplaceShadowingVariables.h"
 #include "compiler/translator/tree_util/ReplaceVariable.h"
@@ -160,6 +163,83 @@ void DumpFuzzerCase(char const *const *shaderStrings,
     fclose(f);
 }
 #endif  // defined(ANGLE_FUZZER_CORPUS_OUTPUT_DIR)
+
+// Forwards the directives to TDirectiveHandler so that extension macros are defined exactly as they
+// would be during compilation, and records the directives in the normalized source as they are not
+// part of the token stream.
+class NormalizingDirectiveHandler final : public angle::pp::DirectiveHandler, angle::NonCopyable
+{
+  public:
+    NormalizingDirectiveHandler(TDirectiveHandler *directiveHandler, std::string *normalizedSource)
+        : mDirectiveHandler(directiveHandler), mNormalizedSource(normalizedSource)
+    {}
+
+    void handleError(const angle::pp::SourceLocation &loc, const std::string &msg) override
+    {
+        mDirectiveHandler->handleError(loc, msg);
+    }
+
+    void handlePragma(const angle::pp::SourceLocation &loc,
+                      const std::string &name,
+                      const std::string &value,
+                      bool stdgl) override
+    {
+        mNormalizedSource->append(stdgl ? "\n#pragma STDGL " : "\n#pragma ");
+        mNormalizedSource->append(name);
+        mNormalizedSource->append("(");
+        mNormalizedSource->append(value);
+        mNormalizedSource->append(")\n");
+        mDirectiveHandler->handlePragma(loc, name, value, stdgl);
+    }
+
+    void handleExtension(const angle::pp::SourceLocation &loc,
+                         const std::string &name,
+                         const std::string &behavior) override
+    {
+        mNormalizedSource->append("\n#extension ");
+        mNormalizedSource->append(name);
+        mNormalizedSource->append(":");
+        mNormalizedSource->append(behavior);
+        mNormalizedSource->append("\n");
+        mDirectiveHandler->handleExtension(loc, name, behavior);
+    }
+
+    void handleVersion(const angle::pp::SourceLocation &loc,
+                       int version,
+                       ShShaderSpec spec,
+                       angle::pp::MacroSet *macro_set) override
+    {
+        mNormalizedSource->append("\n#version ");
+        mNormalizedSource->append(std::to_string(version));
+        mNormalizedSource->append("\n");
+        mDirectiveHandler->handleVersion(loc, version, spec, macro_set);
+    }
+
+  private:
+    TDirectiveHandler *mDirectiveHandler;
+    std::string *mNormalizedSource;
+};
+
+const char *GetOutputPhaseName(ShShaderOutput output)
+{
+    if (IsOutputSPIRV(output))
+    {
+        return "OutputSPIRV";
+    }
+    if (IsOutputHLSL(output))
+    {
+        return "OutputHLSL";
+    }
+    if (IsOutputMSL(output))
+    {
+        return "OutputMSL";
+    }
+    if (IsOutputWGSL(output))
+    {
+        return "OutputWGSL";
+    }
+    return IsOutputNULL(output) ? "OutputNULL" : "OutputGLSL";
+}
 }  // anonymous namespace
 
 bool IsGLSL130OrNewer(ShShaderOutput output)
@@ -375,7 +455,10 @@ TCompiler::TCompiler(sh::GLenum type, ShShaderSpec spec, ShShaderOutput output)
       mHasAnyPreciseType(false),
       mAdvancedBlendEquations(0),
       mUsesDerivatives(false),
-      mCompileOptions{}
+      mCompileOptions{},
+      mPhaseStatsEnabled(false),
+      mPhaseStartAllocationCount(0),
+      mPhaseStartAllocatedBytes(0)
 {}
 
 TCompiler::~TCompiler() {}
@@ -428,30 +511,20 @@ TIntermBlock *TCompiler::compileTreeForTesting(const char *const shaderStrings[]
     return compileTreeImpl(shaderStrings, numStrings, compileOptions);
 }
 
-TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
-                                         size_t numStrings,
-                                         const ShCompileOptions &compileOptions)
+void TCompiler::initExtensionBehavior(const ShCompileOptions &compileOptions,
+                                      TExtensionBehavior *extensionBehavior) const
 {
-    // Remember the compile options for helper functions such as validateAST.
-    mCompileOptions = compileOptions;
-
-    clearResults();
-
-    ASSERT(numStrings > 0);
-    ASSERT(GetGlobalPoolAllocator());
-
-    // Reset the extension behavior for each compilation unit.
-    ResetExtensionBehavior(mResources, mExtensionBehavior, compileOptions);
+    ResetExtensionBehavior(mResources, *extensionBehavior, compileOptions);
 
     // If gl_DrawID is not supported, remove it from the available extensions
     // Currently we only allow emulation of gl_DrawID
     const bool glDrawIDSupported = compileOptions.emulateGLDrawID;
     if (!glDrawIDSupported)
     {
-        auto it = mExtensionBehavior.find(TExtension::ANGLE_multi_draw);
-        if (it != mExtensionBehavior.end())
+        auto it = extensionBehavior->find(TExtension::ANGLE_multi_draw);
+        if (it != extensionBehavior->end())
         {
-            mExtensionBehavior.erase(it);
+            extensionBehavior->erase(it);
         }
     }
 
@@ -459,12 +532,28 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     if (!glBaseVertexBaseInstanceSupported)
     {
         auto it =
-            mExtensionBehavior.find(TExtension::ANGLE_base_vertex_base_instance_shader_builtin);
-        if (it != mExtensionBehavior.end())
+            extensionBehavior->find(TExtension::ANGLE_base_vertex_base_instance_shader_builtin);
+        if (it != extensionBehavior->end())
         {
-            mExtensionBehavior.erase(it);
+            extensionBehavior->erase(it);
         }
     }
+}
+
+TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
+                                         size_t numStrings,
+                                         const ShCompileOptions &compileOptions)
+{
+    // Remember the compile options for helper functions such as validateAST.
+    mCompileOptions = compileOptions;
+
+    clearResults();
+
+    ASSERT(numStrings > 0);
+    ASSERT(GetGlobalPoolAllocator());
+
+    // Reset the extension behavior for each compilation unit.
+    initExtensionBehavior(compileOptions, &mExtensionBehavior);
 
     // First string is path of source file if flag is set. The actual source follows.
     size_t firstSource = 0;
@@ -491,6 +580,11 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
         return nullptr;
     }
 
+    if (mPhaseStatsEnabled)
+    {
+        endPhase("Parse");
+    }
+
     if (!postParseChecks(parseContext))
     {
         return nullptr;
@@ -704,11 +798,20 @@ bool TCompiler::getShaderBinary(const ShHandle compilerHandle,
     return true;
 }
 
-bool TCompiler::validateAST(TIntermNode *root)
+bool TCompiler::validateAST(TIntermNode *root, const char *passName)
 {
+    if (mPhaseStatsEnabled)
+    {
+        endPhase(passName);
+    }
+
     if (mCompileOptions.validateAST)
     {
         bool valid = ValidateAST(root, &mDiagnostics, mValidateASTOptions);
+        if (mPhaseStatsEnabled)
+        {
+            endPhase("ValidateAST");
+        }
 
 #if defined(ANGLE_ENABLE_ASSERTS)
         if (!valid)
@@ -726,6 +829,34 @@ bool TCompiler::validateAST(TIntermNode *root)
     return true;
 }
 
+void TCompiler::beginPhase()
+{
+    mPhaseStartTime = std::chrono::steady_clock::now();
+    std::tie(mPhaseStartAllocationCount, mPhaseStartAllocatedBytes) = getAllocationStats();
+}
+
+void TCompiler::endPhase(const char *name)
+{
+    const std::chrono::steady_clock::time_point startTime = mPhaseStartTime;
+    const size_t startAllocationCount                     = mPhaseStartAllocationCount;
+    const size_t startAllocatedBytes                      = mPhaseStartAllocatedBytes;
+    beginPhase();
+
+    // Passes may run more than once, so a phase accumulates every run of its pass.
+    CompilePhaseStats &stats = mPhaseStats[name];
+    stats.nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             mPhaseStartTime - startTime)
+                             .count();
+    stats.allocationCount += mPhaseStartAllocationCount - startAllocationCount;
+    stats.allocatedBytes += mPhaseStartAllocatedBytes - startAllocatedBytes;
+}
+
+std::pair<size_t, size_t> TCompiler::getAllocationStats() const
+{
+    return {allocator.getAllocationCount() + scratchAllocator.getAllocationCount(),
+            allocator.getAllocatedBytes() + scratchAllocator.getAllocatedBytes()};
+}
+
 bool TCompiler::disableValidateFunctionCall()
 {
     bool wasEnabled                          = mValidateASTOptions.validateFunctionCall;
@@ -969,24 +1100,32 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
     }
 
+    // Find out which constructs the shader uses, so the following passes that only transform
+    // constructs that are absent can be skipped instead of traversing the whole tree.  None of the
+    // passes below introduce loops, switches, multi-declarations or struct specifiers, and those
+    // that introduce other tracked constructs update |astFeatures| accordingly.
+    ASTFeatures astFeatures = FindASTFeatures(root);
+
     // This pass might emit short circuits so keep it before the short circuit unfolding
-    if (compileOptions.rewriteDoWhileLoops)
+    if (compileOptions.rewriteDoWhileLoops && astFeatures.hasDoWhileLoop)
     {
         if (!RewriteDoWhile(this, root, &mSymbolTable))
         {
             return false;
         }
+        astFeatures.hasShortCircuitOperator = true;
     }
 
-    if (compileOptions.addAndTrueToLoopCondition)
+    if (compileOptions.addAndTrueToLoopCondition && astFeatures.hasLoop)
     {
         if (!AddAndTrueToLoopCondition(this, root))
         {
             return false;
         }
+        astFeatures.hasShortCircuitOperator = true;
     }
 
-    if (compileOptions.unfoldShortCircuit)
+    if (compileOptions.unfoldShortCircuit && astFeatures.hasShortCircuitOperator)
     {
         if (!UnfoldShortCircuitAST(this, root))
         {
@@ -1040,35 +1179,40 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         }
     }
 
-    if (compileOptions.simplifyLoopConditions)
+    if (astFeatures.hasLoop)
     {
-        if (!SimplifyLoopConditions(this, root, &getSymbolTable()))
+        if (compileOptions.simplifyLoopConditions)
         {
-            return false;
+            if (!SimplifyLoopConditions(this, root, &getSymbolTable()))
+            {
+                return false;
+            }
         }
-    }
-    else
-    {
-        // Split multi declarations and remove calls to array length().
-        // Note that SimplifyLoopConditions needs to be run before any other AST transformations
-        // that may need to generate new statements from loop conditions or loop expressions.
-        if (!SimplifyLoopConditions(this, root,
-                                    IntermNodePatternMatcher::kMultiDeclaration |
-                                        IntermNodePatternMatcher::kArrayLengthMethod,
-                                    &getSymbolTable()))
+        else
         {
-            return false;
+            // Split multi declarations and remove calls to array length().
+            // Note that SimplifyLoopConditions needs to be run before any other AST
+            // transformations that may need to generate new statements from loop conditions or
+            // loop expressions.
+            if (!SimplifyLoopConditions(this, root,
+                                        IntermNodePatternMatcher::kMultiDeclaration |
+                                            IntermNodePatternMatcher::kArrayLengthMethod,
+                                        &getSymbolTable()))
+            {
+                return false;
+            }
         }
     }
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(*this, *root, mCompileOptions.separateCompoundStructDeclarations))
+    if ((astFeatures.hasMultiDeclaration || astFeatures.hasStructSpecifier) &&
+        !SeparateDeclarations(*this, *root, mCompileOptions.separateCompoundStructDeclarations))
     {
         return false;
     }
 
-    if (IsWebGLBasedSpec(mShaderSpec))
+    if (IsWebGLBasedSpec(mShaderSpec) && astFeatures.hasLoop)
     {
         // Remove infinite loops, they are not supposed to exist in shaders.
         bool anyInfiniteLoops = false;
@@ -1096,20 +1240,24 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     mValidateASTOptions.validateMultiDeclarations = true;
 
-    if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
-                               &getSymbolTable()))
+    if (astFeatures.hasArrayLengthMethod)
     {
-        return false;
-    }
+        if (!SplitSequenceOperator(this, root, IntermNodePatternMatcher::kArrayLengthMethod,
+                                   &getSymbolTable()))
+        {
+            return false;
+        }
 
-    if (!RemoveArrayLengthMethod(this, root))
-    {
-        return false;
-    }
-    // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new constants.
-    if (!FoldExpressions(this, root, &mDiagnostics))
-    {
-        return false;
+        if (!RemoveArrayLengthMethod(this, root))
+        {
+            return false;
+        }
+        // Fold the expressions again, because |RemoveArrayLengthMethod| can introduce new
+        // constants.
+        if (!FoldExpressions(this, root, &mDiagnostics))
+        {
+            return false;
+        }
     }
 
     if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
@@ -1123,7 +1271,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
-    if (!PruneEmptyCases(this, root))
+    if (astFeatures.hasSwitch && !PruneEmptyCases(this, root))
     {
         return false;
     }
@@ -1345,6 +1493,10 @@ bool TCompiler::compile(const char *const shaderStrings[],
     }
 
     TScopedPoolAllocator scopedAlloc(&allocator);
+    if (mPhaseStatsEnabled)
+    {
+        beginPhase();
+    }
     TIntermBlock *root = compileTreeImpl(shaderStrings, numStrings, compileOptions);
 
     if (root)
@@ -1361,6 +1513,13 @@ bool TCompiler::compile(const char *const shaderStrings[],
             {
                 return false;
             }
+
+            // The passes of the backend end their phases through validateAST, so what remains is
+            // generating the output.
+            if (mPhaseStatsEnabled)
+            {
+                endPhase(GetOutputPhaseName(mOutputType));
+            }
         }
 
         if (mShaderType == GL_VERTEX_SHADER)
@@ -1404,6 +1563,79 @@ bool TCompiler::compile(const char *const shaderStrings[],
     return false;
 }
 
+bool TCompiler::getNormalizedPreprocessedSource(const char *const shaderStrings[],
+                                                size_t numStrings,
+                                                const ShCompileOptions &compileOptions,
+                                                std::string *normalizedSourceOut)
+{
+    normalizedSourceOut->clear();
+
+    // First string is path of source file if flag is set.
+    size_t firstSource = compileOptions.sourcePath ? 1 : 0;
+    if (numStrings <= firstSource)
+    {
+        return true;
+    }
+
+    TScopedPoolAllocator scopedAlloc(&allocator);
+    if (mPhaseStatsEnabled)
+    {
+        beginPhase();
+    }
+
+    TExtensionBehavior extensionBehavior;
+    initExtensionBehavior(compileOptions, &extensionBehavior);
+
+    // Diagnostics are dropped; a shader that fails to preprocess is compiled normally, which
+    // produces the errors.
+    TInfoSinkBase infoSink;
+    TDiagnostics diagnostics(infoSink);
+    int shaderVersion = 100;
+    TDirectiveHandler directiveHandler(extensionBehavior, diagnostics, shaderVersion, mShaderType);
+    NormalizingDirectiveHandler normalizingHandler(&directiveHandler, normalizedSourceOut);
+
+    angle::pp::Preprocessor preprocessor(&diagnostics, &normalizingHandler,
+                                         angle::pp::PreprocessorSettings(mShaderSpec));
+    if (!preprocessor.init(numStrings - firstSource, &shaderStrings[firstSource], nullptr))
+    {
+        return false;
+    }
+
+    // Matches the setup in glslang_scan(), where the shader version is not yet known.
+    if (mResources.FragmentPrecisionHigh == 1)
+    {
+        preprocessor.predefineMacro("GL_FRAGMENT_PRECISION_HIGH", 1);
+    }
+    preprocessor.setMaxTokenSize(GetGlobalMaxTokenSize(mShaderSpec));
+
+    // Token locations only affect the translated source if line directives are output.
+    const bool includeLocations = compileOptions.lineDirectives;
+
+    angle::pp::Token token;
+    preprocessor.lex(&token);
+    while (token.type != angle::pp::Token::LAST)
+    {
+        if (includeLocations)
+        {
+            normalizedSourceOut->append(std::to_string(token.location.file));
+            normalizedSourceOut->append(":");
+            normalizedSourceOut->append(std::to_string(token.location.line));
+            normalizedSourceOut->append(" ");
+        }
+        normalizedSourceOut->append(token.text);
+        normalizedSourceOut->append(" ");
+
+        preprocessor.lex(&token);
+    }
+
+    if (mPhaseStatsEnabled)
+    {
+        endPhase("Preprocess");
+    }
+
+    return diagnostics.numErrors() == 0;
+}
+
 bool TCompiler::initBuiltInSymbolTable(const ShBuiltInResources &resources)
 {
     if (resources.MaxDrawBuffers < 1)
@@ -16,6 +16,9 @@
 
 #include <GLSLANG/ShaderVars.h>
 
+#include <chrono>
+#include <map>
+
 #include "common/PackedEnums.h"
 #include "compiler/translator/BuiltInFunctionEmulator.h"
 #include "compiler/translator/CallDAG.h"
@@ -42,6 +45,16 @@ class TranslatorMSL;
 using MetadataFlagBits   = angle::PackedEnumBitSet<sh::MetadataFlags, uint32_t>;
 using SpecConstUsageBits = angle::PackedEnumBitSet<vk::SpecConstUsage, uint32_t>;
 
+// The time spent in one phase of compilation and the pool allocations made during it, summed
+// over the compilations since the stats were reset.
+struct CompilePhaseStats
+{
+    uint64_t nanoseconds   = 0;
+    size_t allocationCount = 0;
+    size_t allocatedBytes  = 0;
+};
+using CompilePhaseStatsMap = std::map<std::string, CompilePhaseStats>;
+
 //
 // Helper function to check if the shader type is GLSL.
 //
@@ -77,6 +90,9 @@ class TShHandleBase
     // Memory allocator. Allocates and tracks memory required by the compiler.
     // Deallocates all memory when compiler is destructed.
     angle::PoolAllocator allocator;
+    // Memory allocator for the temporary data of analysis passes, see
+    // TScopedScratchPoolAllocator.
+    angle::PoolAllocator scratchAllocator;
 };
 
 struct TFunctionMetadata
@@ -108,6 +124,15 @@ class TCompiler : public TShHandleBase
                  size_t numStrings,
                  const ShCompileOptions &compileOptions);
 
+    // Runs only the preprocessor over the shader, and writes the resulting token stream along with
+    // the directives that affect compilation to |normalizedSourceOut|.  Shaders that differ only
+    // in comments, whitespace or unused macros produce the same output.  Returns false if
+    // preprocessing fails.
+    bool getNormalizedPreprocessedSource(const char *const shaderStrings[],
+                                         size_t numStrings,
+                                         const ShCompileOptions &compileOptions,
+                                         std::string *normalizedSourceOut);
+
     // Get results of the last compilation.
     int getShaderVersion() const { return mShaderVersion; }
     TInfoSink &getInfoSink() { return mInfoSink; }
@@ -139,6 +164,11 @@ class TCompiler : public TShHandleBase
     ShHashFunction64 getHashFunction() const { return mResources.HashFunction; }
     NameMap &getNameMap() { return mNameMap; }
     TSymbolTable &getSymbolTable() { return mSymbolTable; }
+    angle::PoolAllocator *getScratchAllocator() { return &scratchAllocator; }
+    size_t getPoolMemorySize() const
+    {
+        return allocator.getReservedMemorySize() + scratchAllocator.getReservedMemorySize();
+    }
     ShShaderSpec getShaderSpec() const { return mShaderSpec; }
     ShShaderOutput getOutputType() const { return mOutputType; }
     const ShBuiltInResources &getBuiltInResources() const { return mResources; }
@@ -208,8 +238,9 @@ class TCompiler : public TShHandleBase
                          const ShCompileOptions &compileOptions,
                          ShaderBinaryBlob *const binaryOut);
 
-    // Validate the AST and produce errors if it is inconsistent.
-    bool validateAST(TIntermNode *root);
+    // Validate the AST and produce errors if it is inconsistent.  This is called after every pass,
+    // so it also ends the pass's phase in the compile phase stats.
+    bool validateAST(TIntermNode *root, const char *passName = ANGLE_COMPILER_PASS_NAME);
     // Some transformations may need to temporarily disable validation until they are complete.  A
     // set of disable/enable helpers are used for this purpose.
     bool disableValidateFunctionCall();
@@ -220,6 +251,14 @@ class TCompiler : public TShHandleBase
     // it's expected to no longer transform.
     void enableValidateNoMoreTransformations();
 
+    // Compile phase stats, for the compiler perf tests.  When enabled, every compilation is split
+    // into "Parse" (which includes preprocessing), one phase per pass named after the function
+    // that ran it, and the backend's output generation named after the output type.  Preprocessing
+    // on its own is the "Preprocess" phase of getNormalizedPreprocessedSource.
+    void setPhaseStatsEnabled(bool enabled) { mPhaseStatsEnabled = enabled; }
+    const CompilePhaseStatsMap &getPhaseStats() const { return mPhaseStats; }
+    void resetPhaseStats() { mPhaseStats.clear(); }
+
     bool areClipDistanceOrCullDistanceUsed() const
     {
         return mClipDistanceSize > 0 || mCullDistanceSize > 0;
@@ -313,6 +352,10 @@ class TCompiler : public TShHandleBase
                                   size_t numStrings,
                                   const ShCompileOptions &compileOptions);
 
+    // Sets up the extension behavior of a compilation unit based on the resources and options.
+    void initExtensionBehavior(const ShCompileOptions &compileOptions,
+                               TExtensionBehavior *extensionBehavior) const;
+
     // Fetches and stores shader metadata that is not stored within the AST itself, such as shader
     // version.
     void setASTMetadata(const TParseContext &parseContext);
@@ -396,6 +439,18 @@ class TCompiler : public TShHandleBase
     TPragma mPragma;
 
     ShCompileOptions mCompileOptions;
+
+    // Starts a new phase of the compile phase stats.  endPhase adds the time and allocations since
+    // the start of the current phase to |name|, and starts the next one.
+    void beginPhase();
+    void endPhase(const char *name);
+    std::pair<size_t, size_t> getAllocationStats() const;
+
+    bool mPhaseStatsEnabled;
+    CompilePhaseStatsMap mPhaseStats;
+    std::chrono::steady_clock::time_point mPhaseStartTime;
+    size_t mPhaseStartAllocationCount;
+    size_t mPhaseStartAllocatedBytes;
 };
 
 //
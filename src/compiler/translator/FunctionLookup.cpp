@@ -56,14 +56,22 @@ ImmutableString TFunctionLookup::getMangledName() const
 ImmutableString TFunctionLookup::GetMangledName(const char *functionName,
                                                 const TIntermSequence &arguments)
 {
-    std::string newName(functionName);
-    newName += kFunctionMangledNameSeparator;
+    // This is done for every function call, so build the name directly in the pool instead of
+    // going through a heap-allocated std::string.
+    size_t nameLength = strlen(functionName) + 1u;
+    for (TIntermNode *argument : arguments)
+    {
+        nameLength += strlen(argument->getAsTyped()->getType().getMangledName());
+    }
+
+    ImmutableStringBuilder newName(nameLength);
+    newName << functionName << kFunctionMangledNameSeparator;
 
     for (TIntermNode *argument : arguments)
     {
-        newName += argument->getAsTyped()->getType().getMangledName();
+        newName << argument->getAsTyped()->getType().getMangledName();
     }
-    return ImmutableString(newName);
+    return newName;
 }
 
 bool TFunctionLookup::isConstructor() const
@@ -60,6 +60,18 @@ ImmutableString HashName(const ImmutableString &name,
 {
     const ImmutableString kUnhashedNamePrefix(kUserDefinedNamePrefix);
 
+    // Each user symbol is typically referenced many times during output.  Once its name is mapped,
+    // reuse the mapped name instead of building and hashing it again.  The map is only cleared at
+    // the start of the next compilation, so its strings outlive the returned ImmutableString.
+    if (nameMap)
+    {
+        NameMap::const_iterator it = nameMap->find(name.data());
+        if (it != nameMap->end())
+        {
+            return ImmutableString(it->second.c_str(), it->second.size());
+        }
+    }
+
     if (hashFunction == nullptr)
     {
         if (name.length() + kUnhashedNamePrefix.length() > kESSLMaxIdentifierLength)
@@ -7789,9 +7789,12 @@ TIntermTyped *TParseContext::addNonConstructorFunctionCallImpl(TFunctionLookup *
     }
     else
     {
+        // The same mangled name is used to look up both user-defined and built-in functions.
+        const ImmutableString mangledName = fnCall->getMangledName();
+
         // There are no inner functions, so it's enough to look for user-defined functions in the
         // global scope.
-        const TSymbol *symbol = symbolTable.findGlobal(fnCall->getMangledName());
+        const TSymbol *symbol = symbolTable.findGlobal(mangledName);
 
         if (symbol != nullptr)
         {
@@ -7806,7 +7809,7 @@ TIntermTyped *TParseContext::addNonConstructorFunctionCallImpl(TFunctionLookup *
             return callNode;
         }
 
-        symbol = symbolTable.findBuiltIn(fnCall->getMangledName(), mShaderVersion);
+        symbol = symbolTable.findBuiltIn(mangledName, mShaderVersion);
 
         if (symbol != nullptr)
         {
@@ -38,3 +38,17 @@ void SetGlobalPoolAllocator(angle::PoolAllocator *poolAllocator)
     ASSERT(PoolIndex != TLS_INVALID_INDEX);
     angle::SetTLSValue(PoolIndex, poolAllocator);
 }
+
+TScopedScratchPoolAllocator::TScopedScratchPoolAllocator(angle::PoolAllocator *scratchAllocator)
+    : mScratchAllocator(scratchAllocator), mParentAllocator(GetGlobalPoolAllocator())
+{
+    ASSERT(mParentAllocator != nullptr);
+    mScratchAllocator->push();
+    SetGlobalPoolAllocator(mScratchAllocator);
+}
+
+TScopedScratchPoolAllocator::~TScopedScratchPoolAllocator()
+{
+    SetGlobalPoolAllocator(mParentAllocator);
+    mScratchAllocator->pop();
+}
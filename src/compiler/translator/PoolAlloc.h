@@ -99,4 +99,25 @@ class pool_allocator
     angle::PoolAllocator &getAllocator() const { return *GetGlobalPoolAllocator(); }
 };
 
+//
+// Redirects the global pool allocator to a scratch allocator for the duration of a scope, after
+// which everything allocated from the scratch allocator is released at once.  This is meant for
+// passes that only analyze the tree, whose bookkeeping (such as the storage of TVector and TMap)
+// would otherwise be held in the global pool until the end of the compile.  Released pages are
+// kept by the scratch allocator and reused by the next pass.
+//
+// Nothing allocated in this scope may be referenced after it, so no AST nodes, types or symbols
+// may be created in it.
+//
+class [[nodiscard]] TScopedScratchPoolAllocator
+{
+  public:
+    TScopedScratchPoolAllocator(angle::PoolAllocator *scratchAllocator);
+    ~TScopedScratchPoolAllocator();
+
+  private:
+    angle::PoolAllocator *mScratchAllocator;
+    angle::PoolAllocator *mParentAllocator;
+};
+
 #endif  // COMPILER_TRANSLATOR_POOLALLOC_H_
@@ -414,6 +414,19 @@ bool Compile(const ShHandle handle,
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
+bool GetNormalizedPreprocessedSource(const ShHandle handle,
+                                     const char *const shaderStrings[],
+                                     size_t numStrings,
+                                     const ShCompileOptions &compileOptions,
+                                     std::string *normalizedSourceOut)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->getNormalizedPreprocessedSource(shaderStrings, numStrings, compileOptions,
+                                                     normalizedSourceOut);
+}
+
 void ClearResults(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
@@ -471,6 +484,14 @@ const BinaryBlob &GetObjectBinaryBlob(const ShHandle handle)
     return infoSink.obj.getBinary();
 }
 
+size_t GetPoolMemorySize(const ShHandle handle)
+{
+    TCompiler *compiler = GetCompilerFromHandle(handle);
+    ASSERT(compiler);
+
+    return compiler->getPoolMemorySize();
+}
+
 bool GetShaderBinary(const ShHandle handle,
                      const char *const shaderStrings[],
                      size_t numStrings,
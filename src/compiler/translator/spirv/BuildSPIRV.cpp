@@ -2258,25 +2258,14 @@ spirv::Blob SPIRVBuilder::getSpirv()
 {
     ASSERT(mConditionalStack.empty());
 
-    spirv::Blob result;
-
     const spirv::IdRef nonSemanticOverviewId = getNewId({});
 
-    // Reserve a minimum amount of memory.
-    //
-    //   5 for header +
-    //   a number of capabilities +
-    //   size of already generated instructions.
-    //
-    // The actual size is larger due to other metadata instructions such as extensions,
-    // OpExtInstImport, OpEntryPoint, OpExecutionMode etc.
-    result.reserve(5 + mCapabilities.size() * 2 + mSpirvDebug.size() + mSpirvDecorations.size() +
-                   mSpirvTypeAndConstantDecls.size() + mSpirvTypePointerDecls.size() +
-                   mSpirvFunctionTypeDecls.size() + mSpirvVariableDecls.size() +
-                   mSpirvFunctions.size());
+    // The header and the metadata instructions are generated in a small blob of their own, so that
+    // the size of the module is known before it is gathered into a single allocation.
+    spirv::Blob header;
 
     // Generate the SPIR-V header.
-    spirv::WriteSpirvHeader(&result,
+    spirv::WriteSpirvHeader(&header,
                             mCompileOptions.emitSPIRV14 ? spirv::kVersion_1_4 : spirv::kVersion_1_3,
                             mNextAvailableId);
 
@@ -2285,24 +2274,24 @@ spirv::Blob SPIRVBuilder::getSpirv()
     // - OpCapability instructions.
     for (spv::Capability capability : mCapabilities)
     {
-        spirv::WriteCapability(&result, capability);
+        spirv::WriteCapability(&header, capability);
     }
 
     // - OpExtension instructions
-    writeExtensions(&result);
+    writeExtensions(&header);
 
     // Enable the SPV_KHR_non_semantic_info extension to more efficiently communicate information to
     // the SPIR-V transformer in the Vulkan backend.  The relevant instructions are all stripped
     // away during SPIR-V transformation so the driver never needs to support it.
-    spirv::WriteExtension(&result, "SPV_KHR_non_semantic_info");
+    spirv::WriteExtension(&header, "SPV_KHR_non_semantic_info");
 
     // - OpExtInstImport
-    spirv::WriteExtInstImport(&result, getExtInstImportIdStd(), "GLSL.std.450");
-    spirv::WriteExtInstImport(&result, spirv::IdRef(vk::spirv::kIdNonSemanticInstructionSet),
+    spirv::WriteExtInstImport(&header, getExtInstImportIdStd(), "GLSL.std.450");
+    spirv::WriteExtInstImport(&header, spirv::IdRef(vk::spirv::kIdNonSemanticInstructionSet),
                               "NonSemantic.ANGLE");
 
     // - OpMemoryModel
-    spirv::WriteMemoryModel(&result, spv::AddressingModelLogical, spv::MemoryModelGLSL450);
+    spirv::WriteMemoryModel(&header, spv::AddressingModelLogical, spv::MemoryModelGLSL450);
 
     // - OpEntryPoint
     constexpr gl::ShaderMap<spv::ExecutionModel> kExecutionModels = {
@@ -2313,21 +2302,35 @@ spirv::Blob SPIRVBuilder::getSpirv()
         {gl::ShaderType::Fragment, spv::ExecutionModelFragment},
         {gl::ShaderType::Compute, spv::ExecutionModelGLCompute},
     };
-    spirv::WriteEntryPoint(&result, kExecutionModels[mShaderType],
+    spirv::WriteEntryPoint(&header, kExecutionModels[mShaderType],
                            spirv::IdRef(vk::spirv::kIdEntryPoint), "main",
                            mEntryPointInterfaceList);
 
     // - OpExecutionMode instructions
-    writeExecutionModes(&result);
+    writeExecutionModes(&header);
 
     // - OpSource and OpSourceExtension instructions.
     //
     // This is to support debuggers and capture/replay tools and isn't strictly necessary.
-    spirv::WriteSource(&result, spv::SourceLanguageGLSL, spirv::LiteralInteger(450), nullptr,
+    spirv::WriteSource(&header, spv::SourceLanguageGLSL, spirv::LiteralInteger(450), nullptr,
                        nullptr);
-    writeSourceExtensions(&result);
+    writeSourceExtensions(&header);
+
+    // The types/constants/variables section is the first place non-semantic instructions can be
+    // output.  These instructions rely on at least the OpVoid type.  The kNonSemanticTypeSectionEnd
+    // instruction additionally carries an overview of the SPIR-V and thus requires a few OpConstant
+    // values.
+    spirv::Blob nonSemanticOverview;
+    writeNonSemanticOverview(&nonSemanticOverview, nonSemanticOverviewId);
 
-    // Append the already generated sections in order
+    spirv::Blob result;
+    result.reserve(header.size() + mSpirvDebug.size() + mSpirvDecorations.size() +
+                   mSpirvTypeAndConstantDecls.size() + mSpirvTypePointerDecls.size() +
+                   mSpirvFunctionTypeDecls.size() + mSpirvVariableDecls.size() +
+                   nonSemanticOverview.size() + mSpirvFunctions.size());
+
+    // Append the sections in order
+    result.insert(result.end(), header.begin(), header.end());
     result.insert(result.end(), mSpirvDebug.begin(), mSpirvDebug.end());
     result.insert(result.end(), mSpirvDecorations.begin(), mSpirvDecorations.end());
     result.insert(result.end(), mSpirvTypeAndConstantDecls.begin(),
@@ -2335,16 +2338,9 @@ spirv::Blob SPIRVBuilder::getSpirv()
     result.insert(result.end(), mSpirvTypePointerDecls.begin(), mSpirvTypePointerDecls.end());
     result.insert(result.end(), mSpirvFunctionTypeDecls.begin(), mSpirvFunctionTypeDecls.end());
     result.insert(result.end(), mSpirvVariableDecls.begin(), mSpirvVariableDecls.end());
-
-    // The types/constants/variables section is the first place non-semantic instructions can be
-    // output.  These instructions rely on at least the OpVoid type.  The kNonSemanticTypeSectionEnd
-    // instruction additionally carries an overview of the SPIR-V and thus requires a few OpConstant
-    // values.
-    writeNonSemanticOverview(&result, nonSemanticOverviewId);
-
+    result.insert(result.end(), nonSemanticOverview.begin(), nonSemanticOverview.end());
     result.insert(result.end(), mSpirvFunctions.begin(), mSpirvFunctions.end());
 
-    result.shrink_to_fit();
     return result;
 }
 
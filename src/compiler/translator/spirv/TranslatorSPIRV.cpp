@@ -573,7 +573,11 @@ TIntermSequence *GetMainSequence(TIntermBlock *root)
     TIntermTyped *rotatedXY = new TIntermTernary(swapXY, swappedXY, xy);
 
     // (swapXY ? position.yx : position.xy) * flipXY
-    TIntermTyped *flipXY = driverUniforms->getFlipXY(symbolTable, DriverUniformFlip::PreFragment);
+    TIntermTyped *flipXY = specConst->getFlipXY(DriverUniformFlip::PreFragment);
+    if (flipXY == nullptr)
+    {
+        flipXY = driverUniforms->getFlipXY(symbolTable, DriverUniformFlip::PreFragment);
+    }
     TIntermTyped *rotatedFlippedXY = new TIntermBinary(EOpMul, rotatedXY, flipXY);
 
     // (gl_Position.z + gl_Position.w) / 2
@@ -631,8 +635,12 @@ TIntermSequence *GetMainSequence(TIntermBlock *root)
                                              SpecConst *specConst,
                                              const DriverUniform *driverUniforms)
 {
-    TIntermTyped *flipXY = driverUniforms->getFlipXY(symbolTable, DriverUniformFlip::Fragment);
-    TIntermTyped *pivot  = driverUniforms->getHalfRenderArea();
+    TIntermTyped *flipXY = specConst->getFlipXY(DriverUniformFlip::Fragment);
+    if (flipXY == nullptr)
+    {
+        flipXY = driverUniforms->getFlipXY(symbolTable, DriverUniformFlip::Fragment);
+    }
+    TIntermTyped *pivot = driverUniforms->getHalfRenderArea();
 
     TIntermTyped *swapXY = specConst->getSwapXY();
     if (swapXY == nullptr)
@@ -1042,8 +1050,12 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
             if (usesPointCoord)
             {
-                TIntermTyped *flipNegXY =
-                    driverUniforms->getNegFlipXY(&getSymbolTable(), DriverUniformFlip::Fragment);
+                TIntermTyped *flipNegXY = specConst->getNegFlipXY(DriverUniformFlip::Fragment);
+                if (flipNegXY == nullptr)
+                {
+                    flipNegXY = driverUniforms->getNegFlipXY(&getSymbolTable(),
+                                                             DriverUniformFlip::Fragment);
+                }
                 TIntermConstantUnion *pivot = CreateFloatNode(0.5f, EbpMedium);
                 TIntermTyped *swapXY        = specConst->getSwapXY();
                 if (swapXY == nullptr)
@@ -1060,8 +1072,12 @@ bool TranslatorSPIRV::translateImpl(TIntermBlock *root,
 
             if (useSamplePosition)
             {
-                TIntermTyped *flipXY =
-                    driverUniforms->getFlipXY(&getSymbolTable(), DriverUniformFlip::Fragment);
+                TIntermTyped *flipXY = specConst->getFlipXY(DriverUniformFlip::Fragment);
+                if (flipXY == nullptr)
+                {
+                    flipXY =
+                        driverUniforms->getFlipXY(&getSymbolTable(), DriverUniformFlip::Fragment);
+                }
                 TIntermConstantUnion *pivot = CreateFloatNode(0.5f, EbpMedium);
                 TIntermTyped *swapXY        = specConst->getSwapXY();
                 if (swapXY == nullptr)
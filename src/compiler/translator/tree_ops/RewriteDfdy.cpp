@@ -88,7 +88,11 @@ bool Traverser::visitAggregate(Visit visit, TIntermAggregate *node)
     TIntermTyped *swapYMultiplier = MakeSwapYMultiplier(swapXY->deepCopy());
 
     // Get flip multiplier
-    TIntermTyped *flipXY = mDriverUniforms->getFlipXY(mSymbolTable, DriverUniformFlip::Fragment);
+    TIntermTyped *flipXY = mSpecConst->getFlipXY(DriverUniformFlip::Fragment);
+    if (flipXY == nullptr)
+    {
+        flipXY = mDriverUniforms->getFlipXY(mSymbolTable, DriverUniformFlip::Fragment);
+    }
 
     // Multiply the flip and rotation multipliers
     TIntermTyped *xMultiplier =
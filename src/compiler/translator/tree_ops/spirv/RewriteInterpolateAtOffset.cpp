@@ -128,7 +128,11 @@ const TFunction *Traverser::getRotateFunc()
         swapXY = mDriverUniforms->getSwapXY();
     }
 
-    TIntermTyped *flipXY = mDriverUniforms->getFlipXY(mSymbolTable, DriverUniformFlip::Fragment);
+    TIntermTyped *flipXY = mSpecConst->getFlipXY(DriverUniformFlip::Fragment);
+    if (flipXY == nullptr)
+    {
+        flipXY = mDriverUniforms->getFlipXY(mSymbolTable, DriverUniformFlip::Fragment);
+    }
 
     TIntermSwizzle *offsetYX = new TIntermSwizzle(new TIntermSymbol(offsetParam), {1, 0});
 
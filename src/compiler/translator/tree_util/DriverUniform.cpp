@@ -283,24 +283,12 @@ TIntermTyped *DriverUniform::getHalfRenderArea() const
 
 TIntermTyped *DriverUniform::getFlipXY(TSymbolTable *symbolTable, DriverUniformFlip stage) const
 {
-    TIntermTyped *flipXY = createDriverUniformRef(kFlipXY);
-    TIntermTyped *values =
-        CreateBuiltInUnaryFunctionCallNode("unpackSnorm4x8", flipXY, *symbolTable, 310);
-
-    if (stage == DriverUniformFlip::Fragment)
-    {
-        return new TIntermSwizzle(values, {0, 1});
-    }
-
-    return new TIntermSwizzle(values, {2, 3});
+    return UnpackFlipXY(createDriverUniformRef(kFlipXY), symbolTable, stage);
 }
 
 TIntermTyped *DriverUniform::getNegFlipXY(TSymbolTable *symbolTable, DriverUniformFlip stage) const
 {
-    TIntermTyped *flipXY = getFlipXY(symbolTable, stage);
-
-    constexpr std::array<float, 2> kMultiplier = {1, -1};
-    return new TIntermBinary(EOpMul, flipXY, CreateVecNode(kMultiplier.data(), 2, EbpLow));
+    return MakeNegFlipXY(getFlipXY(symbolTable, stage));
 }
 
 TIntermTyped *DriverUniform::getDither() const
@@ -462,4 +450,25 @@ TIntermTyped *MakeSwapYMultiplier(TIntermTyped *swapped)
     };
     return TIntermAggregate::CreateConstructor(*StaticType::GetBasic<EbtFloat, EbpLow>(), &args);
 }
+
+TIntermTyped *UnpackFlipXY(TIntermTyped *packedFlipXY,
+                           TSymbolTable *symbolTable,
+                           DriverUniformFlip stage)
+{
+    TIntermTyped *values =
+        CreateBuiltInUnaryFunctionCallNode("unpackSnorm4x8", packedFlipXY, *symbolTable, 310);
+
+    if (stage == DriverUniformFlip::Fragment)
+    {
+        return new TIntermSwizzle(values, {0, 1});
+    }
+
+    return new TIntermSwizzle(values, {2, 3});
+}
+
+TIntermTyped *MakeNegFlipXY(TIntermTyped *flipXY)
+{
+    constexpr std::array<float, 2> kMultiplier = {1, -1};
+    return new TIntermBinary(EOpMul, flipXY, CreateVecNode(kMultiplier.data(), 2, EbpLow));
+}
 }  // namespace sh
@@ -107,6 +107,15 @@ class DriverUniformExtended : public DriverUniform
 TIntermTyped *MakeSwapXMultiplier(TIntermTyped *swapped);
 TIntermTyped *MakeSwapYMultiplier(TIntermTyped *swapped);
 
+// Unpacks the flip values of the given stage out of a uint that is laid out like the flipXY driver
+// uniform, i.e. four snorm8 values with the fragment flip in .xy and the pre-rasterization flip in
+// .zw.  Used for both the driver uniform and its specialization constant replacement.
+TIntermTyped *UnpackFlipXY(TIntermTyped *packedFlipXY,
+                           TSymbolTable *symbolTable,
+                           DriverUniformFlip stage);
+// Returns vec2(flipXY.x, -flipXY.y)
+TIntermTyped *MakeNegFlipXY(TIntermTyped *flipXY);
+
 }  // namespace sh
 
 #endif  // COMPILER_TRANSLATOR_TREEUTIL_DRIVERUNIFORM_H_
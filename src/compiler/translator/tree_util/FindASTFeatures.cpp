@@ -0,0 +1,93 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FindASTFeatures.cpp: Finds which constructs are present in the AST.
+
+#include "compiler/translator/tree_util/FindASTFeatures.h"
+
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+namespace
+{
+class FindASTFeaturesTraverser : public TIntermTraverser
+{
+  public:
+    FindASTFeaturesTraverser(ASTFeatures *features)
+        : TIntermTraverser(true, false, false), mFeatures(features)
+    {}
+
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        mFeatures->hasLoop = true;
+        if (node->getType() == ELoopDoWhile)
+        {
+            mFeatures->hasDoWhileLoop = true;
+        }
+        return true;
+    }
+
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        mFeatures->hasSwitch = true;
+        return true;
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        if (node->getOp() == EOpLogicalAnd || node->getOp() == EOpLogicalOr)
+        {
+            mFeatures->hasShortCircuitOperator = true;
+        }
+        return true;
+    }
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        if (node->getOp() == EOpArrayLength)
+        {
+            mFeatures->hasArrayLengthMethod = true;
+        }
+        return true;
+    }
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        const TIntermSequence &sequence = *node->getSequence();
+        if (sequence.size() > 1)
+        {
+            mFeatures->hasMultiDeclaration = true;
+        }
+        if (!sequence.empty() && sequence.front()->getAsTyped()->getType().isStructSpecifier())
+        {
+            mFeatures->hasStructSpecifier = true;
+        }
+        return true;
+    }
+
+    void visitFunctionPrototype(TIntermFunctionPrototype *node) override
+    {
+        if (node->getType().isStructSpecifier())
+        {
+            mFeatures->hasStructSpecifier = true;
+        }
+    }
+
+  private:
+    ASTFeatures *mFeatures;
+};
+}  // anonymous namespace
+
+ASTFeatures FindASTFeatures(TIntermBlock *root)
+{
+    ASTFeatures features;
+    FindASTFeaturesTraverser traverser(&features);
+    root->traverse(&traverser);
+    return features;
+}
+}  // namespace sh
@@ -0,0 +1,36 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// FindASTFeatures.h: Finds which constructs are present in the AST, so that transformations that
+// only act on constructs that are absent can be skipped without traversing the tree.
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_FINDASTFEATURES_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_FINDASTFEATURES_H_
+
+namespace sh
+{
+class TIntermBlock;
+
+struct ASTFeatures
+{
+    // Any loop, and do-while loops specifically.
+    bool hasLoop        = false;
+    bool hasDoWhileLoop = false;
+    bool hasSwitch      = false;
+    // The && and || operators.
+    bool hasShortCircuitOperator = false;
+    // .length() calls that were not constant folded during parse.
+    bool hasArrayLengthMethod = false;
+    // Declarations with more than one declarator, such as "int a, b;".
+    bool hasMultiDeclaration = false;
+    // Declarations or function prototypes that also declare a struct, such as "struct S {...} s;".
+    bool hasStructSpecifier = false;
+};
+
+ASTFeatures FindASTFeatures(TIntermBlock *root);
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_FINDASTFEATURES_H_
@@ -649,6 +649,10 @@ class PropagatePreciseTraverser : public TIntermTraverser
 
 void FindPreciseNodes(TCompiler *compiler, TIntermBlock *root)
 {
+    // Only flags on existing nodes are changed, so the information gathered to do that can be
+    // released right after.
+    TScopedScratchPoolAllocator scratchAllocator(compiler->getScratchAllocator());
+
     ASTInfo info;
 
     InfoGatherTraverser infoGather(&info);
@@ -509,7 +509,9 @@ bool TIntermTraverser::CompareInsertion(const NodeInsertMultipleEntry &a,
     return a.position < b.position;
 }
 
-bool TIntermTraverser::updateTree(TCompiler *compiler, TIntermNode *node)
+bool TIntermTraverser::updateTree(TCompiler *compiler,
+                                  TIntermNode *node,
+                                  const char *passName)
 {
     // Sort the insertions so that insertion position is increasing and same position insertions are
     // not reordered. The insertions are processed in reverse order so that multiple insertions to
@@ -583,7 +585,7 @@ bool TIntermTraverser::updateTree(TCompiler *compiler, TIntermNode *node)
 
     clearReplacementQueue();
 
-    return compiler->validateAST(node);
+    return compiler->validateAST(node, passName);
 }
 
 void TIntermTraverser::clearReplacementQueue()
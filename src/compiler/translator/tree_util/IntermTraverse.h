@@ -93,8 +93,10 @@ class TIntermTraverser : angle::NonCopyable
     // this function after traversal to perform them.
     //
     // Compiler is used to validate the tree.  Node is the same given to traverse().  Returns false
-    // if the tree is invalid after update.
-    [[nodiscard]] bool updateTree(TCompiler *compiler, TIntermNode *node);
+    // if the tree is invalid after update.  The pass name defaults to the caller's function.
+    [[nodiscard]] bool updateTree(TCompiler *compiler,
+                                  TIntermNode *node,
+                                  const char *passName = ANGLE_COMPILER_PASS_NAME);
 
   protected:
     void setMaxAllowedDepth(int depth);
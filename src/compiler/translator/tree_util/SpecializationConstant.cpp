@@ -22,6 +22,7 @@ namespace
 constexpr ImmutableString kSurfaceRotationSpecConstVarName =
     ImmutableString("ANGLESurfaceRotation");
 constexpr ImmutableString kDitherSpecConstVarName = ImmutableString("ANGLEDither");
+constexpr ImmutableString kFlipSpecConstVarName   = ImmutableString("ANGLEFlip");
 
 const TType *MakeSpecConst(const TType &type, vk::SpecializationConstantId id)
 {
@@ -44,7 +45,8 @@ SpecConst::SpecConst(TSymbolTable *symbolTable,
     : mSymbolTable(symbolTable),
       mCompileOptions(compileOptions),
       mSurfaceRotationVar(nullptr),
-      mDitherVar(nullptr)
+      mDitherVar(nullptr),
+      mFlipVar(nullptr)
 {
     if (shaderType == GL_FRAGMENT_SHADER || shaderType == GL_COMPUTE_SHADER)
     {
@@ -81,6 +83,14 @@ void SpecConst::declareSpecConsts(TIntermBlock *root)
 
         root->insertStatement(0, decl);
     }
+
+    if (mFlipVar != nullptr)
+    {
+        TIntermDeclaration *decl = new TIntermDeclaration();
+        decl->appendDeclarator(new TIntermBinary(EOpInitialize, getFlip(), CreateUIntNode(0)));
+
+        root->insertStatement(0, decl);
+    }
 }
 
 TIntermSymbol *SpecConst::getRotation()
@@ -119,4 +129,34 @@ TIntermTyped *SpecConst::getDither()
     }
     return new TIntermSymbol(mDitherVar);
 }
+
+TIntermSymbol *SpecConst::getFlip()
+{
+    if (mFlipVar == nullptr)
+    {
+        const TType *type = MakeSpecConst(*StaticType::GetBasic<EbtUInt, EbpHigh>(),
+                                          vk::SpecializationConstantId::Flip);
+
+        mFlipVar =
+            new TVariable(mSymbolTable, kFlipSpecConstVarName, type, SymbolType::AngleInternal);
+        mUsageBits.set(vk::SpecConstUsage::Flip);
+    }
+    return new TIntermSymbol(mFlipVar);
+}
+
+TIntermTyped *SpecConst::getFlipXY(DriverUniformFlip stage)
+{
+    if (!mCompileOptions.useSpecializationConstant ||
+        !mCompileOptions.useSpecializationConstantForFlip)
+    {
+        return nullptr;
+    }
+    return UnpackFlipXY(getFlip(), mSymbolTable, stage);
+}
+
+TIntermTyped *SpecConst::getNegFlipXY(DriverUniformFlip stage)
+{
+    TIntermTyped *flipXY = getFlipXY(stage);
+    return flipXY != nullptr ? MakeNegFlipXY(flipXY) : nullptr;
+}
 }  // namespace sh
@@ -12,6 +12,7 @@
 #include "common/angleutils.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/SymbolTable.h"
+#include "compiler/translator/tree_util/DriverUniform.h"
 
 class TIntermBlock;
 class TIntermTyped;
@@ -30,6 +31,10 @@ class SpecConst
     // Flip/rotation
     // Returns a boolean: should X and Y be swapped?
     TIntermTyped *getSwapXY();
+    // Returns the flip values of the given stage, or null if they are taken from the driver
+    // uniforms.  See DriverUniform::getFlipXY and DriverUniform::getNegFlipXY.
+    TIntermTyped *getFlipXY(DriverUniformFlip stage);
+    TIntermTyped *getNegFlipXY(DriverUniformFlip stage);
 
     // Dither emulation
     TIntermTyped *getDither();
@@ -39,6 +44,7 @@ class SpecConst
 
   private:
     TIntermSymbol *getRotation();
+    TIntermSymbol *getFlip();
 
     // If unsupported, this should be set to null.
     TSymbolTable *mSymbolTable;
@@ -46,6 +52,7 @@ class SpecConst
 
     TVariable *mSurfaceRotationVar;
     TVariable *mDitherVar;
+    TVariable *mFlipVar;
 
     // Bit is set if YFlip or Rotation has been used
     SpecConstUsageBits mUsageBits;
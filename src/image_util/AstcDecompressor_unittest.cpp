@@ -11,6 +11,7 @@
 #include "common/WorkerThread.h"
 #include "image_util/AstcDecompressor.h"
 #include "image_util/AstcDecompressorTestUtils.h"
+#include "image_util/loadimage.h"
 
 using namespace angle;
 using namespace testing;
@@ -43,6 +44,49 @@ TEST(AstcDecompressor, Decompress)
     ASSERT_THAT(output, ElementsAreArray(expected));
 }
 
+// Test that LoadASTCToRGBA8 decodes every layer of an array, and supports output rows that are not
+// tightly packed.
+TEST(AstcDecompressor, LoadLayersWithRowPadding)
+{
+    const int width     = 256;
+    const int height    = 4096;
+    const int layers    = 2;
+    const int rowLength = width + 3;
+
+    if (!AstcDecompressor::get().available())
+        GTEST_SKIP() << "ASTC decompressor not available";
+
+    ImageLoadContext context;
+    context.singleThreadPool = WorkerThreadPool::Create(1, ANGLEPlatformCurrent());
+    context.multiThreadPool  = WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+
+    std::vector<uint8_t> layerData = makeAstcCheckerboard(width, height);
+    std::vector<uint8_t> astcData;
+    for (int layer = 0; layer < layers; ++layer)
+    {
+        astcData.insert(astcData.end(), layerData.begin(), layerData.end());
+    }
+
+    const Rgba padding = {0x12, 0x34, 0x56, 0x78};
+    std::vector<Rgba> output(rowLength * height * layers, padding);
+    LoadASTCToRGBA8<8, 8>(context, width, height, layers, astcData.data(), (width / 8) * 16,
+                          layerData.size(), reinterpret_cast<uint8_t *>(output.data()),
+                          rowLength * sizeof(Rgba), rowLength * height * sizeof(Rgba));
+
+    std::vector<Rgba> expected = makeCheckerboard(width, height);
+    for (int layer = 0; layer < layers; ++layer)
+    {
+        for (int y = 0; y < height; ++y)
+        {
+            const Rgba *row = &output[(layer * height + y) * rowLength];
+            ASSERT_THAT(std::vector<Rgba>(row, row + width),
+                        ElementsAreArray(&expected[y * width], width))
+                << "layer " << layer << " row " << y;
+            ASSERT_THAT(std::vector<Rgba>(row + width, row + rowLength), Each(padding));
+        }
+    }
+}
+
 // Test that getStatusString returns non-null even for unknown statuses
 TEST(AstcDecompressor, getStatusStringAlwaysNonNull)
 {
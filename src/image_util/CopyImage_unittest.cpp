@@ -0,0 +1,142 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CopyImage_unittest.cpp: Unit tests for the fast pixel copy functions.
+
+#include <gmock/gmock.h>
+#include <cstring>
+#include <vector>
+#include "common/mathutil.h"
+#include "image_util/copyimage.h"
+
+using namespace angle;
+using namespace testing;
+
+namespace
+{
+
+using FastCopyFunction   = void (*)(const uint8_t *, int, int, uint8_t *, int, int, int, int);
+using PixelReadFunction  = void (*)(const uint8_t *, uint8_t *);
+using PixelWriteFunction = void (*)(const uint8_t *, uint8_t *);
+
+// Copies |source| with |fastCopy| and with the per-pixel functions, and expects the same bytes.
+// A |srcXAxisPitch| larger than |srcPixelBytes| leaves gaps between the source pixels, which
+// takes the strided path.
+void verifyFastCopy(FastCopyFunction fastCopy,
+                    PixelReadFunction pixelRead,
+                    PixelWriteFunction pixelWrite,
+                    const std::vector<uint8_t> &source,
+                    int srcPixelBytes,
+                    int srcXAxisPitch,
+                    int destPixelBytes,
+                    int width,
+                    int height)
+{
+    const int srcYAxisPitch  = srcXAxisPitch * width;
+    const int destYAxisPitch = destPixelBytes * width + 4;
+    ASSERT_GE(source.size(), static_cast<size_t>(srcYAxisPitch * height));
+
+    std::vector<uint8_t> fastResult(destYAxisPitch * height, 0);
+    std::vector<uint8_t> expected(destYAxisPitch * height, 0);
+
+    fastCopy(source.data(), srcXAxisPitch, srcYAxisPitch, fastResult.data(), destPixelBytes,
+             destYAxisPitch, width, height);
+
+    uint8_t temp[16];
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            pixelRead(source.data() + y * srcYAxisPitch + x * srcXAxisPitch, temp);
+            pixelWrite(temp, expected.data() + y * destYAxisPitch + x * destPixelBytes);
+        }
+    }
+
+    EXPECT_EQ(fastResult, expected) << "srcPixelBytes " << srcPixelBytes << " srcXAxisPitch "
+                                    << srcXAxisPitch << " width " << width;
+}
+
+std::vector<uint8_t> makeBytes(size_t size)
+{
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+    return bytes;
+}
+
+// Widths that leave a tail after the SIMD kernels.
+constexpr int kWidths[] = {1, 3, 4, 15, 16, 17, 37};
+
+// Test swapping red and blue in both directions, against the per-pixel functions.
+TEST(CopyImage, SwapRB8MatchesPerPixelCopy)
+{
+    for (int width : kWidths)
+    {
+        for (int srcXAxisPitch : {4, 8})
+        {
+            const std::vector<uint8_t> source = makeBytes(srcXAxisPitch * width * 3);
+            verifyFastCopy(CopyBGRA8ToRGBA8, ReadColor<B8G8R8A8, float>,
+                           WriteColor<R8G8B8A8, float>, source, 4, srcXAxisPitch, 4, width, 3);
+            verifyFastCopy(CopyRGBA8ToBGRA8, ReadColor<R8G8B8A8, float>,
+                           WriteColor<B8G8R8A8, float>, source, 4, srcXAxisPitch, 4, width, 3);
+        }
+    }
+}
+
+// Test converting every half float value other than NaNs to float.
+TEST(CopyImage, RGBA16FToRGBA32FMatchesPerPixelCopy)
+{
+    std::vector<uint16_t> halfs;
+    for (uint32_t value = 0; value <= 0xFFFF; ++value)
+    {
+        const bool isNaN = (value & 0x7C00) == 0x7C00 && (value & 0x03FF) != 0;
+        if (!isNaN)
+        {
+            halfs.push_back(static_cast<uint16_t>(value));
+        }
+    }
+    // Make whole RGBA16F pixels.
+    halfs.resize(rx::roundUpPow2<size_t>(halfs.size(), 4), 0);
+
+    std::vector<uint8_t> source(halfs.size() * sizeof(uint16_t));
+    memcpy(source.data(), halfs.data(), source.size());
+    const int pixelCount = static_cast<int>(halfs.size() / 4);
+
+    verifyFastCopy(CopyRGBA16FToRGBA32F, ReadColor<R16G16B16A16F, float>,
+                   WriteColor<R32G32B32A32F, float>, source, 8, 8, 16, pixelCount, 1);
+
+    for (int width : kWidths)
+    {
+        verifyFastCopy(CopyRGBA16FToRGBA32F, ReadColor<R16G16B16A16F, float>,
+                       WriteColor<R32G32B32A32F, float>, source, 8, 8, 16, width, 2);
+        verifyFastCopy(CopyRGBA16FToRGBA32F, ReadColor<R16G16B16A16F, float>,
+                       WriteColor<R32G32B32A32F, float>, source, 8, 16, 16, width, 2);
+    }
+}
+
+// Test converting float to half float, including values that round, overflow and underflow.
+TEST(CopyImage, RGBA32FToRGBA16FMatchesPerPixelCopy)
+{
+    std::vector<float> floats = {0.0f,     -0.0f,   1.0f,     -1.0f,    0.1f,     65504.0f,
+                                 65520.0f, 1.0e10f, -1.0e10f, 6.0e-5f,  6.0e-8f,  1.0e-10f,
+                                 0.33333f, 2.5f,    -1000.1f, 3.14159f, 1.0e-20f, 4096.5f};
+    while (floats.size() < 4 * 37 * 2)
+    {
+        floats.push_back(static_cast<float>(floats.size()) * 0.123f - 5.0f);
+    }
+
+    std::vector<uint8_t> source(floats.size() * sizeof(float));
+    memcpy(source.data(), floats.data(), source.size());
+
+    for (int width : kWidths)
+    {
+        verifyFastCopy(CopyRGBA32FToRGBA16F, ReadColor<R32G32B32A32F, float>,
+                       WriteColor<R16G16B16A16F, float>, source, 16, 16, 8, width, 1);
+    }
+}
+
+}  // anonymous namespace
@@ -500,4 +500,52 @@ TEST(LoadToNative3To4, LoadByteRGBToRGBAWithUnalignedWidthAndAlignment4)
         TestLoadByteRGBToRGBAForAllCases(context, alignment, 5, 5, 1, 0, 0, alignment);
     }
 }
+
+// Tests the byte RGB to RGBA loading function with rows wide enough to be partly converted with
+// SIMD, starting at an unaligned input address.
+TEST(LoadToNative3To4, LoadByteRGBToRGBAWithWideRowsAndInputAddressOffset)
+{
+    ImageLoadContext context;
+    size_t inputOffsetList[] = {1, 2, 3};
+    for (auto &inputOffset : inputOffsetList)
+    {
+        TestLoadByteRGBToRGBAForAllCases(context, inputOffset, 37, 5, 1, inputOffset, 0, 4);
+    }
+}
+
+// Tests the RGB8 to BGRX8 loading function with row widths that are and are not multiples of the
+// SIMD width.
+TEST(LoadRGB8ToBGRX8, WidthsAroundSIMDWidth)
+{
+    ImageLoadContext context;
+    size_t testWidths[] = {1, 15, 16, 17, 48, 101};
+    for (auto &width : testWidths)
+    {
+        constexpr size_t kHeight = 3;
+        size_t inputRowPitch     = width * 3;
+        size_t outputRowPitch    = width * 4;
+
+        std::vector<uint8_t> rgbInput(inputRowPitch * kHeight);
+        initializeRGBInput<uint8_t>(rgbInput, width, kHeight, 1, 3, 0, inputRowPitch,
+                                    inputRowPitch * kHeight);
+        std::vector<uint8_t> bgrxOutput(outputRowPitch * kHeight, 0xAA);
+
+        LoadRGB8ToBGRX8(context, width, kHeight, 1, rgbInput.data(), inputRowPitch,
+                        inputRowPitch * kHeight, bgrxOutput.data(), outputRowPitch,
+                        outputRowPitch * kHeight);
+
+        for (size_t y = 0; y < kHeight; y++)
+        {
+            for (size_t x = 0; x < width; x++)
+            {
+                const uint8_t *rgb  = &rgbInput[y * inputRowPitch + x * 3];
+                const uint8_t *bgrx = &bgrxOutput[y * outputRowPitch + x * 4];
+                EXPECT_EQ(bgrx[0], rgb[2]) << "width " << width << " at (" << x << ", " << y << ")";
+                EXPECT_EQ(bgrx[1], rgb[1]) << "width " << width << " at (" << x << ", " << y << ")";
+                EXPECT_EQ(bgrx[2], rgb[0]) << "width " << width << " at (" << x << ", " << y << ")";
+                EXPECT_EQ(bgrx[3], 0xFF) << "width " << width << " at (" << x << ", " << y << ")";
+            }
+        }
+    }
+}
 }  // namespace
\ No newline at end of file
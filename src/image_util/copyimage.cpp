@@ -8,6 +8,34 @@
 
 #include "image_util/copyimage.h"
 
+#include "common/mathutil.h"
+
+#include <utility>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    endif
+#    include <immintrin.h>
+#    define ANGLE_COPYIMAGE_USE_SSSE3
+// The SIMD kernels are selected at runtime, so they are compiled for their instruction set
+// regardless of the target's baseline.
+#    if defined(__GNUC__) || defined(__clang__)
+#        define ANGLE_COPYIMAGE_SSSE3_TARGET __attribute__((target("ssse3")))
+#        define ANGLE_COPYIMAGE_F16C_TARGET __attribute__((target("f16c")))
+#    else
+#        define ANGLE_COPYIMAGE_SSSE3_TARGET
+#        define ANGLE_COPYIMAGE_F16C_TARGET
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    if defined(_M_ARM64)
+#        include <arm64_neon.h>
+#    else
+#        include <arm_neon.h>
+#    endif
+#    define ANGLE_COPYIMAGE_USE_NEON
+#endif
+
 namespace angle
 {
 
@@ -20,38 +48,157 @@ inline uint32_t SwizzleBGRAToRGBA(uint32_t argb)
            ((argb & 0xFF00FF00));         // Keep alpha and green
 }
 
-void CopyBGRA8ToRGBA8Fast(const uint8_t *source,
-                          int srcYAxisPitch,
-                          uint8_t *dest,
-                          int destYAxisPitch,
-                          int destWidth,
-                          int destHeight)
+// The row kernels below convert as many pixels (or channels) of a tightly packed row as they
+// can with SIMD, and return the number converted, leaving the rest of the row to the caller.
+#if defined(ANGLE_COPYIMAGE_USE_SSSE3)
+bool SupportsSSSE3()
+{
+#    if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 1)
+    {
+        return false;
+    }
+    __cpuid(info, 1);
+    return (info[2] >> 9) & 1;
+#    else
+    return __builtin_cpu_supports("ssse3");
+#    endif
+}
+
+bool SupportsF16C()
+{
+#    if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 1)
+    {
+        return false;
+    }
+    // F16C instructions are VEX encoded, so the OS must also save the AVX state.
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] >> 27) & 1;
+    const bool avx     = (info[2] >> 28) & 1;
+    const bool f16c    = (info[2] >> 29) & 1;
+    return osxsave && avx && f16c && (_xgetbv(0) & 6) == 6;
+#    else
+    return __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+#    endif
+}
+
+ANGLE_COPYIMAGE_SSSE3_TARGET size_t SwapRB8RowSSSE3(const uint8_t *source,
+                                                    uint8_t *dest,
+                                                    size_t width)
+{
+    const __m128i swizzle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    size_t x = 0;
+    for (; x + 4 <= width; x += 4)
+    {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + x * 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + x * 4),
+                         _mm_shuffle_epi8(pixels, swizzle));
+    }
+    return x;
+}
+
+ANGLE_COPYIMAGE_F16C_TARGET size_t Float16ToFloat32RowF16C(const uint16_t *source,
+                                                           float *dest,
+                                                           size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const __m128i halfs = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(source + i));
+        _mm_storeu_ps(dest + i, _mm_cvtph_ps(halfs));
+    }
+    return i;
+}
+#elif defined(ANGLE_COPYIMAGE_USE_NEON)
+size_t SwapRB8RowNEON(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(source + x * 4);
+        std::swap(pixels.val[0], pixels.val[2]);
+        vst4q_u8(dest + x * 4, pixels);
+    }
+    return x;
+}
+
+size_t Float16ToFloat32RowNEON(const uint16_t *source, float *dest, size_t count)
+{
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        vst1q_f32(dest + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(source + i))));
+    }
+    return i;
+}
+#endif
+
+size_t SwapRB8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+#if defined(ANGLE_COPYIMAGE_USE_SSSE3)
+    static const bool kSupportsSSSE3 = SupportsSSSE3();
+    return kSupportsSSSE3 ? SwapRB8RowSSSE3(source, dest, width) : 0;
+#elif defined(ANGLE_COPYIMAGE_USE_NEON)
+    return SwapRB8RowNEON(source, dest, width);
+#else
+    return 0;
+#endif
+}
+
+size_t Float16ToFloat32Row(const uint16_t *source, float *dest, size_t count)
+{
+#if defined(ANGLE_COPYIMAGE_USE_SSSE3)
+    static const bool kSupportsF16C = SupportsF16C();
+    return kSupportsF16C ? Float16ToFloat32RowF16C(source, dest, count) : 0;
+#elif defined(ANGLE_COPYIMAGE_USE_NEON)
+    return Float16ToFloat32RowNEON(source, dest, count);
+#else
+    return 0;
+#endif
+}
+
+void SwapRB8Fast(const uint8_t *source,
+                 int srcYAxisPitch,
+                 uint8_t *dest,
+                 int destYAxisPitch,
+                 int destWidth,
+                 int destHeight)
 {
     for (int y = 0; y < destHeight; ++y)
     {
-        const uint32_t *src32 = reinterpret_cast<const uint32_t *>(source + y * srcYAxisPitch);
-        uint32_t *dest32      = reinterpret_cast<uint32_t *>(dest + y * destYAxisPitch);
-        const uint32_t *end32 = src32 + destWidth;
+        const uint8_t *srcRow = source + y * srcYAxisPitch;
+        uint8_t *destRow      = dest + y * destYAxisPitch;
+        const size_t done     = SwapRB8Row(srcRow, destRow, destWidth);
+
+        const uint32_t *src32 = reinterpret_cast<const uint32_t *>(srcRow) + done;
+        uint32_t *dest32      = reinterpret_cast<uint32_t *>(destRow) + done;
+        const uint32_t *end32 = reinterpret_cast<const uint32_t *>(srcRow) + destWidth;
         while (src32 != end32)
         {
             *dest32++ = SwizzleBGRAToRGBA(*src32++);
         }
     }
 }
-}  // namespace
 
-void CopyBGRA8ToRGBA8(const uint8_t *source,
-                      int srcXAxisPitch,
-                      int srcYAxisPitch,
-                      uint8_t *dest,
-                      int destXAxisPitch,
-                      int destYAxisPitch,
-                      int destWidth,
-                      int destHeight)
+// Swapping the red and blue channels converts BGRA to RGBA as well as RGBA to BGRA.
+void SwapRB8(const uint8_t *source,
+             int srcXAxisPitch,
+             int srcYAxisPitch,
+             uint8_t *dest,
+             int destXAxisPitch,
+             int destYAxisPitch,
+             int destWidth,
+             int destHeight)
 {
     if (srcXAxisPitch == 4 && destXAxisPitch == 4)
     {
-        CopyBGRA8ToRGBA8Fast(source, srcYAxisPitch, dest, destYAxisPitch, destWidth, destHeight);
+        SwapRB8Fast(source, srcYAxisPitch, dest, destYAxisPitch, destWidth, destHeight);
         return;
     }
 
@@ -70,5 +217,99 @@ void CopyBGRA8ToRGBA8(const uint8_t *source,
         }
     }
 }
+}  // namespace
+
+void CopyBGRA8ToRGBA8(const uint8_t *source,
+                      int srcXAxisPitch,
+                      int srcYAxisPitch,
+                      uint8_t *dest,
+                      int destXAxisPitch,
+                      int destYAxisPitch,
+                      int destWidth,
+                      int destHeight)
+{
+    SwapRB8(source, srcXAxisPitch, srcYAxisPitch, dest, destXAxisPitch, destYAxisPitch, destWidth,
+            destHeight);
+}
+
+void CopyRGBA8ToBGRA8(const uint8_t *source,
+                      int srcXAxisPitch,
+                      int srcYAxisPitch,
+                      uint8_t *dest,
+                      int destXAxisPitch,
+                      int destYAxisPitch,
+                      int destWidth,
+                      int destHeight)
+{
+    SwapRB8(source, srcXAxisPitch, srcYAxisPitch, dest, destXAxisPitch, destYAxisPitch, destWidth,
+            destHeight);
+}
+
+void CopyRGBA16FToRGBA32F(const uint8_t *source,
+                          int srcXAxisPitch,
+                          int srcYAxisPitch,
+                          uint8_t *dest,
+                          int destXAxisPitch,
+                          int destYAxisPitch,
+                          int destWidth,
+                          int destHeight)
+{
+    for (int y = 0; y < destHeight; ++y)
+    {
+        const uint8_t *src = source + y * srcYAxisPitch;
+        uint8_t *dst       = dest + y * destYAxisPitch;
+
+        if (srcXAxisPitch == 8 && destXAxisPitch == 16)
+        {
+            // The row is tightly packed, so it can be converted as one array of channels.
+            const uint16_t *src16 = reinterpret_cast<const uint16_t *>(src);
+            float *dst32          = reinterpret_cast<float *>(dst);
+            const size_t count    = static_cast<size_t>(destWidth) * 4;
+            for (size_t i = Float16ToFloat32Row(src16, dst32, count); i < count; ++i)
+            {
+                dst32[i] = gl::float16ToFloat32(src16[i]);
+            }
+            continue;
+        }
+
+        for (int x = 0; x < destWidth; ++x)
+        {
+            const uint16_t *src16 = reinterpret_cast<const uint16_t *>(src + x * srcXAxisPitch);
+            float *dst32          = reinterpret_cast<float *>(dst + x * destXAxisPitch);
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                dst32[channel] = gl::float16ToFloat32(src16[channel]);
+            }
+        }
+    }
+}
+
+void CopyRGBA32FToRGBA16F(const uint8_t *source,
+                          int srcXAxisPitch,
+                          int srcYAxisPitch,
+                          uint8_t *dest,
+                          int destXAxisPitch,
+                          int destYAxisPitch,
+                          int destWidth,
+                          int destHeight)
+{
+    // Hardware conversions round and produce NaNs differently from float32ToFloat16(), so this
+    // stays scalar to give the same results as WriteColor<R16G16B16A16F>.
+    for (int y = 0; y < destHeight; ++y)
+    {
+        const uint8_t *src = source + y * srcYAxisPitch;
+        uint8_t *dst       = dest + y * destYAxisPitch;
+
+        for (int x = 0; x < destWidth; ++x)
+        {
+            const float *src32 = reinterpret_cast<const float *>(src + x * srcXAxisPitch);
+            uint16_t *dst16    = reinterpret_cast<uint16_t *>(dst + x * destXAxisPitch);
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                dst16[channel] = gl::float32ToFloat16(src32[channel]);
+            }
+        }
+    }
+}
 
 }  // namespace angle
@@ -24,6 +24,28 @@
 #    endif
 #endif
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    endif
+#    include <immintrin.h>
+#    define ANGLE_LOADIMAGE_USE_SSSE3
+// The SSSE3 kernels are selected at runtime, so they are compiled for their instruction set
+// regardless of the target's baseline.
+#    if defined(__GNUC__) || defined(__clang__)
+#        define ANGLE_LOADIMAGE_SSSE3_TARGET __attribute__((target("ssse3")))
+#    else
+#        define ANGLE_LOADIMAGE_SSSE3_TARGET
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    if defined(_M_ARM64)
+#        include <arm64_neon.h>
+#    else
+#        include <arm_neon.h>
+#    endif
+#    define ANGLE_LOADIMAGE_USE_NEON
+#endif
+
 #if defined(ANGLE_LOADIMAGE_USE_SSE)
 inline bool supportsSSE2()
 {
@@ -56,6 +78,103 @@ ImageLoadContext::ImageLoadContext()                              = default;
 ImageLoadContext::~ImageLoadContext()                             = default;
 ImageLoadContext::ImageLoadContext(const ImageLoadContext &other) = default;
 
+namespace
+{
+// Expanding 3-byte pixels to 4 bytes is done 16 pixels at a time with SIMD.  SwapRB produces BGRX
+// from RGB.  The kernels return the number of pixels written, leaving the rest of the row to the
+// caller.
+#if defined(ANGLE_LOADIMAGE_USE_SSSE3)
+bool SupportsSSSE3()
+{
+#    if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 1)
+    {
+        return false;
+    }
+    __cpuid(info, 1);
+    return (info[2] >> 9) & 1;
+#    else
+    return __builtin_cpu_supports("ssse3");
+#    endif
+}
+
+template <bool SwapRB>
+ANGLE_LOADIMAGE_SSSE3_TARGET size_t LoadByte3To4RowSSSE3(const uint8_t *source,
+                                                         uint8_t *dest,
+                                                         size_t width,
+                                                         uint8_t fourthValue)
+{
+    const __m128i spread =
+        SwapRB ? _mm_setr_epi8(2, 1, 0, -128, 5, 4, 3, -128, 8, 7, 6, -128, 11, 10, 9, -128)
+               : _mm_setr_epi8(0, 1, 2, -128, 3, 4, 5, -128, 6, 7, 8, -128, 9, 10, 11, -128);
+    const __m128i fourth =
+        _mm_set1_epi32(static_cast<int>(static_cast<uint32_t>(fourthValue) << 24));
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const __m128i *src = reinterpret_cast<const __m128i *>(source + x * 3);
+        __m128i *dst       = reinterpret_cast<__m128i *>(dest + x * 4);
+
+        // Every 4 pixels take 12 of the 48 bytes loaded; bring each group to the start of a
+        // register and spread it out.
+        const __m128i in0       = _mm_loadu_si128(src);
+        const __m128i in1       = _mm_loadu_si128(src + 1);
+        const __m128i in2       = _mm_loadu_si128(src + 2);
+        const __m128i pixels[4] = {in0, _mm_alignr_epi8(in1, in0, 12), _mm_alignr_epi8(in2, in1, 8),
+                                   _mm_srli_si128(in2, 4)};
+        for (int i = 0; i < 4; ++i)
+        {
+            _mm_storeu_si128(dst + i, _mm_or_si128(_mm_shuffle_epi8(pixels[i], spread), fourth));
+        }
+    }
+    return x;
+}
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+template <bool SwapRB>
+size_t LoadByte3To4RowNEON(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+    const uint8x16_t fourth = vdupq_n_u8(fourthValue);
+
+    size_t x = 0;
+    for (; x + 16 <= width; x += 16)
+    {
+        const uint8x16x3_t rgb = vld3q_u8(source + x * 3);
+        uint8x16x4_t result;
+        result.val[0] = rgb.val[SwapRB ? 2 : 0];
+        result.val[1] = rgb.val[1];
+        result.val[2] = rgb.val[SwapRB ? 0 : 2];
+        result.val[3] = fourth;
+        vst4q_u8(dest + x * 4, result);
+    }
+    return x;
+}
+#endif
+
+template <bool SwapRB>
+size_t LoadByte3To4Row(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+#if defined(ANGLE_LOADIMAGE_USE_SSSE3)
+    static const bool kSupportsSSSE3 = SupportsSSSE3();
+    return kSupportsSSSE3 ? LoadByte3To4RowSSSE3<SwapRB>(source, dest, width, fourthValue) : 0;
+#elif defined(ANGLE_LOADIMAGE_USE_NEON)
+    return LoadByte3To4RowNEON<SwapRB>(source, dest, width, fourthValue);
+#else
+    return 0;
+#endif
+}
+}  // anonymous namespace
+
+namespace priv
+{
+size_t LoadByte3To4RowSIMD(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue)
+{
+    return LoadByte3To4Row<false>(source, dest, width, fourthValue);
+}
+}  // namespace priv
+
 void LoadA8ToRGBA8(const ImageLoadContext &context,
                    size_t width,
                    size_t height,
@@ -535,7 +654,7 @@ void LoadRGB8ToBGRX8(const ImageLoadContext &context,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadByte3To4Row<true>(source, dest, width, 0xFF); x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
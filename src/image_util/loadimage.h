@@ -1185,6 +1185,13 @@ inline void LoadPalettedToRGBA8(const ImageLoadContext &context,
                                 size_t outputRowPitch,
                                 size_t outputDepthPitch);
 
+namespace priv
+{
+// Expands the start of a row of 3-byte pixels to 4-byte pixels ending in |fourthValue|, using SIMD
+// where available.  Returns the number of pixels written; the rest of the row is left untouched.
+size_t LoadByte3To4RowSIMD(const uint8_t *source, uint8_t *dest, size_t width, uint8_t fourthValue);
+}  // namespace priv
+
 }  // namespace angle
 
 #include "loadimage.inc"
@@ -9,8 +9,18 @@
 #include "image_util/AstcDecompressor.h"
 #include "image_util/loadimage.h"
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 namespace angle
 {
+namespace
+{
+// Upper bound of the temporary memory used to decode ASTC images whose output rows are not tightly
+// packed.
+constexpr size_t kMaxAstcSliceSize = 1024 * 1024;
+}  // anonymous namespace
 
 void LoadASTCToRGBA8Inner(const ImageLoadContext &context,
                           size_t width,
@@ -39,15 +49,60 @@ void LoadASTCToRGBA8Inner(const ImageLoadContext &context,
     uint32_t blockCountX = (imgWidth + blockWidth - 1) / blockWidth;
     uint32_t blockCountY = (imgHeight + blockHeight - 1) / blockHeight;
 
-    // Space needed for 16 bytes of output per compressed block
-    size_t blockSize = blockCountX * blockCountY * 16;
+    // 16 bytes of input per compressed block
+    const size_t inputBlockRowSize = blockCountX * 16;
+
+    // The decompressor writes tightly packed rows.  If the output rows are not tightly packed,
+    // decode slices of block rows in a bounded temporary buffer and copy every slice to the output
+    // as soon as it's decoded.
+    const size_t decodedRowPitch = imgWidth * 4;
+    const bool decodeInPlace     = outputRowPitch == decodedRowPitch;
+    uint32_t blockRowsPerSlice   = blockCountY;
 
-    int32_t result =
-        decompressor.decompress(context.singleThreadPool, context.multiThreadPool, imgWidth,
-                                imgHeight, blockWidth, blockHeight, input, blockSize, output);
-    if (result != 0)
+    std::vector<uint8_t> decodedSlice;
+    if (!decodeInPlace)
     {
-        WARN() << "ASTC decompression failed: " << decompressor.getStatusString(result);
+        const size_t decodedBlockRowSize = decodedRowPitch * blockHeight;
+        blockRowsPerSlice                = static_cast<uint32_t>(std::clamp<size_t>(
+            kMaxAstcSliceSize / decodedBlockRowSize, 1, blockCountY));
+        decodedSlice.resize(decodedBlockRowSize * blockRowsPerSlice);
+    }
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        const uint8_t *inputLayer = input + z * inputDepthPitch;
+        uint8_t *outputLayer      = output + z * outputDepthPitch;
+
+        for (uint32_t firstBlockRow = 0; firstBlockRow < blockCountY;
+             firstBlockRow += blockRowsPerSlice)
+        {
+            const uint32_t sliceBlockRows =
+                std::min(blockRowsPerSlice, blockCountY - firstBlockRow);
+            const uint32_t firstRow = firstBlockRow * blockHeight;
+            const uint32_t sliceHeight =
+                std::min(sliceBlockRows * blockHeight, imgHeight - firstRow);
+
+            uint8_t *sliceOutput  = outputLayer + firstRow * outputRowPitch;
+            uint8_t *decodeOutput = decodeInPlace ? sliceOutput : decodedSlice.data();
+            int32_t result        = decompressor.decompress(
+                context.singleThreadPool, context.multiThreadPool, imgWidth, sliceHeight,
+                blockWidth, blockHeight, inputLayer + firstBlockRow * inputBlockRowSize,
+                sliceBlockRows * inputBlockRowSize, decodeOutput);
+            if (result != 0)
+            {
+                WARN() << "ASTC decompression failed: " << decompressor.getStatusString(result);
+                return;
+            }
+
+            if (!decodeInPlace)
+            {
+                for (uint32_t row = 0; row < sliceHeight; row++)
+                {
+                    memcpy(sliceOutput + row * outputRowPitch,
+                           decodedSlice.data() + row * decodedRowPitch, decodedRowPitch);
+                }
+            }
+        }
     }
 }
 }  // namespace angle
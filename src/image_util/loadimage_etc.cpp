@@ -8,11 +8,38 @@
 
 #include "image_util/loadimage.h"
 
+#include <cstring>
+#include <functional>
+#include <thread>
 #include <type_traits>
+#include "common/WorkerThread.h"
 #include "common/mathutil.h"
+#include "common/platform.h"
 
 #include "image_util/imageformats.h"
 
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#    endif
+#    include <immintrin.h>
+#    define ANGLE_ETC_USE_SSE
+// The kernels are selected at runtime, so they are compiled for their instruction set regardless
+// of the target's baseline.
+#    if defined(__GNUC__) || defined(__clang__)
+#        define ANGLE_ETC_SSSE3_TARGET __attribute__((target("ssse3")))
+#    else
+#        define ANGLE_ETC_SSSE3_TARGET
+#    endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    if defined(_M_ARM64)
+#        include <arm64_neon.h>
+#    else
+#        include <arm_neon.h>
+#    endif
+#    define ANGLE_ETC_USE_NEON
+#endif
+
 namespace angle
 {
 namespace
@@ -50,8 +77,414 @@ static IntensityModifier intensityModifierNonOpaque[] =
 };
 // clang-format on
 
+// Modifier tables of single channel (EAC) blocks, indexed by table index and pixel index
+// clang-format off
+static const int16_t kSingleChannelModifiers[16][8] =
+{
+    { -3, -6,  -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5,  -8, -13, 1, 4, 7, 12 },
+    { -2, -4,  -6, -13, 1, 3, 5, 12 },
+    { -3, -6,  -8, -12, 2, 5, 7, 11 },
+    { -3, -7,  -9, -11, 2, 6, 8, 10 },
+    { -4, -7,  -8, -11, 3, 6, 7, 10 },
+    { -3, -5,  -8, -11, 2, 4, 7, 10 },
+    { -2, -6,  -8, -10, 1, 5, 7,  9 },
+    { -2, -5,  -8, -10, 1, 4, 7,  9 },
+    { -2, -4,  -8, -10, 1, 3, 7,  9 },
+    { -2, -5,  -7, -10, 1, 4, 6,  9 },
+    { -3, -4,  -7, -10, 2, 3, 6,  9 },
+    { -1, -2,  -3, -10, 0, 1, 2,  9 },
+    { -4, -6,  -8,  -9, 3, 5, 7,  8 },
+    { -3, -5,  -7,  -9, 2, 4, 6,  8 }
+};
+// clang-format on
+
 static const int kNumPixelsInBlock = 16;
 
+// Levels with at least this many pixels are decoded on the multi-threaded pool, if available.  For
+// smaller levels the overhead of multithreading exceeds the benefits.
+constexpr size_t kMinPixelsForMultiThreadedDecode = 256 * 256;
+
+// Returns the max number of threads to use when using multithreaded decoding
+size_t MaxDecodeThreads()
+{
+    static const size_t numThreads = std::min(16u, std::thread::hardware_concurrency());
+    return numThreads;
+}
+
+// Decodes a contiguous range of block rows.  Block rows of all slices are numbered consecutively.
+struct DecodeBlockRowsTask : public Closure
+{
+    DecodeBlockRowsTask(const std::function<void(size_t, size_t)> &decodeBlockRow,
+                        size_t heightInBlocks,
+                        size_t firstBlockRow,
+                        size_t endBlockRow)
+        : decodeBlockRow(decodeBlockRow),
+          heightInBlocks(heightInBlocks),
+          firstBlockRow(firstBlockRow),
+          endBlockRow(endBlockRow)
+    {}
+
+    void operator()() override
+    {
+        for (size_t blockRow = firstBlockRow; blockRow < endBlockRow; ++blockRow)
+        {
+            decodeBlockRow((blockRow % heightInBlocks) * 4, blockRow / heightInBlocks);
+        }
+    }
+
+    const std::function<void(size_t, size_t)> &decodeBlockRow;
+    size_t heightInBlocks;
+    size_t firstBlockRow;
+    size_t endBlockRow;
+};
+
+// Calls decodeBlockRow(y, z) for every row of blocks of the image, where y is the first pixel row
+// of the block row.  Block rows write to disjoint parts of the output, so large images are split in
+// slices of block rows that are decoded in parallel.
+void DecodeBlockRows(const ImageLoadContext &context,
+                     size_t width,
+                     size_t height,
+                     size_t depth,
+                     const std::function<void(size_t, size_t)> &decodeBlockRow)
+{
+    const size_t heightInBlocks = (height + 3) / 4;
+    const size_t blockRowCount  = heightInBlocks * depth;
+
+    const bool singleThreaded = !context.multiThreadPool || MaxDecodeThreads() <= 1 ||
+                                width * height * depth < kMinPixelsForMultiThreadedDecode;
+    if (singleThreaded)
+    {
+        DecodeBlockRowsTask(decodeBlockRow, heightInBlocks, 0, blockRowCount)();
+        return;
+    }
+
+    const size_t taskCount        = std::min(MaxDecodeThreads(), blockRowCount);
+    const size_t blockRowsPerTask = (blockRowCount + taskCount - 1) / taskCount;
+
+    std::vector<std::shared_ptr<WaitableEvent>> waitEvents;
+    waitEvents.reserve(taskCount);
+
+    for (size_t firstBlockRow = 0; firstBlockRow < blockRowCount; firstBlockRow += blockRowsPerTask)
+    {
+        const size_t endBlockRow = std::min(firstBlockRow + blockRowsPerTask, blockRowCount);
+        auto task                = std::make_shared<DecodeBlockRowsTask>(
+            decodeBlockRow, heightInBlocks, firstBlockRow, endBlockRow);
+
+        std::shared_ptr<WaitableEvent> waitEvent = context.multiThreadPool->postWorkerTask(task);
+        if (waitEvent)
+        {
+            waitEvents.push_back(std::move(waitEvent));
+        }
+        else
+        {
+            (*task)();
+        }
+    }
+
+    WaitableEvent::WaitMany(&waitEvents);
+}
+
+// Most blocks are decoded by building a small palette of colors and looking up every pixel of the
+// block in it.  When the whole block is inside the image, both steps are done with SIMD and the
+// lookup itself is a byte shuffle.
+#if defined(ANGLE_ETC_USE_SSE)
+bool SupportsSSSE3()
+{
+#    if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 1)
+    {
+        return false;
+    }
+    __cpuid(info, 1);
+    return (info[2] >> 9) & 1;
+#    else
+    return __builtin_cpu_supports("ssse3");
+#    endif
+}
+#endif
+
+bool SupportsSIMDBlockDecode()
+{
+#if defined(ANGLE_ETC_USE_SSE)
+    static const bool supported = SupportsSSSE3();
+    return supported;
+#elif defined(ANGLE_ETC_USE_NEON)
+    return true;
+#else
+    return false;
+#endif
+}
+
+// The pixel indices of ETC blocks are stored in column-major order.  These shuffles gather the
+// indices of each row of pixels, repeated once per channel of the RGBA8 output.
+// clang-format off
+alignas(16) constexpr uint8_t kSpreadRowIndices[4][16] =
+{
+    { 0, 0, 0, 0, 4, 4, 4, 4,  8,  8,  8,  8, 12, 12, 12, 12 },
+    { 1, 1, 1, 1, 5, 5, 5, 5,  9,  9,  9,  9, 13, 13, 13, 13 },
+    { 2, 2, 2, 2, 6, 6, 6, 6, 10, 10, 10, 10, 14, 14, 14, 14 },
+    { 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15 },
+};
+alignas(16) constexpr uint8_t kChannelOffsets[16] =
+{
+    0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3,
+};
+
+// Moves the alpha of each pixel of a row in the A channel.  Out of range indices produce zero.
+alignas(16) constexpr uint8_t kSpreadRowAlpha[16] =
+{
+    0x80, 0x80, 0x80, 0, 0x80, 0x80, 0x80, 1, 0x80, 0x80, 0x80, 2, 0x80, 0x80, 0x80, 3,
+};
+
+// Transposes the pixels of a block from column-major to row-major order.
+alignas(16) constexpr uint8_t kTransposeBlock[16] =
+{
+    0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+};
+
+// Selects the bit of each pixel in the bytes of the 16-bit MSB and LSB words of an ETC block.
+alignas(16) constexpr uint8_t kSpreadIndexBytes[16] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+alignas(16) constexpr uint8_t kIndexBitMasks[16] =
+{
+    1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128,
+};
+// clang-format on
+
+// Decodes a 4x4 individual or differential block into RGBA8.  The colors of subblock s are
+// baseColors[s] plus each of modifiers[s], clamped.  msbs and lsbs are the high and low bits of the
+// pixel indices, where bit (i * 4 + j) is for pixel (i, j).  The second subblock is the bottom half
+// of the block if flipped, and the right half otherwise.  The alpha channel is taken from
+// alphaValues.
+#if defined(ANGLE_ETC_USE_SSE)
+ANGLE_ETC_SSSE3_TARGET __m128i LoadAligned(const uint8_t data[16])
+{
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(data));
+}
+
+ANGLE_ETC_SSSE3_TARGET void DecodeIndividualOrDifferentialBlockSIMD(
+    uint8_t *dest,
+    size_t destRowPitch,
+    const int baseColors[2][3],
+    const int *const modifiers[2],
+    uint32_t msbs,
+    uint32_t lsbs,
+    bool flipped,
+    const uint8_t alphaValues[4][4])
+{
+    __m128i palettes[2];
+    for (size_t subblock = 0; subblock < 2; subblock++)
+    {
+        const int *base = baseColors[subblock];
+        const int *mod  = modifiers[subblock];
+
+        const __m128i base16 =
+            _mm_setr_epi16(base[0], base[1], base[2], 0, base[0], base[1], base[2], 0);
+        const __m128i mods01 =
+            _mm_setr_epi16(mod[0], mod[0], mod[0], 0, mod[1], mod[1], mod[1], 0);
+        const __m128i mods23 =
+            _mm_setr_epi16(mod[2], mod[2], mod[2], 0, mod[3], mod[3], mod[3], 0);
+
+        // Unsigned saturation clamps the colors to [0, 255].
+        palettes[subblock] =
+            _mm_packus_epi16(_mm_add_epi16(base16, mods01), _mm_add_epi16(base16, mods23));
+    }
+
+    // Expand the index bits to one byte per pixel, in column-major order.
+    const __m128i spreadIndexBytes = LoadAligned(kSpreadIndexBytes);
+    const __m128i indexBitMasks    = LoadAligned(kIndexBitMasks);
+    const __m128i msbBytes = _mm_shuffle_epi8(_mm_cvtsi32_si128(msbs), spreadIndexBytes);
+    const __m128i lsbBytes = _mm_shuffle_epi8(_mm_cvtsi32_si128(lsbs), spreadIndexBytes);
+    const __m128i msbSet = _mm_cmpeq_epi8(_mm_and_si128(msbBytes, indexBitMasks), indexBitMasks);
+    const __m128i lsbSet = _mm_cmpeq_epi8(_mm_and_si128(lsbBytes, indexBitMasks), indexBitMasks);
+    // The palette index is scaled to the byte offset of the color, i.e. (msb * 2 + lsb) * 4.
+    const __m128i colorOffsets = _mm_or_si128(_mm_and_si128(msbSet, _mm_set1_epi8(8)),
+                                              _mm_and_si128(lsbSet, _mm_set1_epi8(4)));
+
+    const __m128i channelOffsets = LoadAligned(kChannelOffsets);
+    const __m128i spreadRowAlpha = LoadAligned(kSpreadRowAlpha);
+    const __m128i alphaMask      = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+    const __m128i rightHalf      = _mm_setr_epi32(0, 0, -1, -1);
+
+    for (size_t j = 0; j < 4; j++)
+    {
+        const __m128i spreadRow = LoadAligned(kSpreadRowIndices[j]);
+        const __m128i lookup =
+            _mm_add_epi8(_mm_shuffle_epi8(colorOffsets, spreadRow), channelOffsets);
+
+        const __m128i subblock1 = flipped ? _mm_set1_epi32(j < 2 ? 0 : -1) : rightHalf;
+        __m128i color =
+            _mm_or_si128(_mm_andnot_si128(subblock1, _mm_shuffle_epi8(palettes[0], lookup)),
+                         _mm_and_si128(subblock1, _mm_shuffle_epi8(palettes[1], lookup)));
+
+        int32_t rowAlpha;
+        memcpy(&rowAlpha, alphaValues[j], sizeof(rowAlpha));
+        const __m128i alpha = _mm_shuffle_epi8(_mm_cvtsi32_si128(rowAlpha), spreadRowAlpha);
+        color               = _mm_or_si128(_mm_andnot_si128(alphaMask, color), alpha);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + j * destRowPitch), color);
+    }
+}
+
+// Decodes a 4x4 single channel EAC block to 8-bit values, in row-major order.  The palette is
+// codeword plus each of modifiers times multiplier, clamped.  The pixel indices are 3-bit values in
+// column-major order, with the first one in the highest bits of packedIndices.
+ANGLE_ETC_SSSE3_TARGET void DecodeSingleChannelBlockSIMD(uint8_t values[kNumPixelsInBlock],
+                                                         int codeword,
+                                                         int multiplier,
+                                                         const int16_t modifiers[8],
+                                                         uint64_t packedIndices,
+                                                         bool isSigned)
+{
+    const __m128i modifiers16 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(modifiers));
+    const __m128i palette16   = _mm_add_epi16(
+        _mm_set1_epi16(static_cast<int16_t>(codeword)),
+        _mm_mullo_epi16(modifiers16, _mm_set1_epi16(static_cast<int16_t>(multiplier))));
+    // Saturation clamps the values to [0, 255] or [-128, 127].
+    const __m128i palette = isSigned ? _mm_packs_epi16(palette16, palette16)
+                                     : _mm_packus_epi16(palette16, palette16);
+
+    alignas(16) uint8_t indices[kNumPixelsInBlock];
+    for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
+    {
+        indices[pixel] = static_cast<uint8_t>((packedIndices >> (45 - 3 * pixel)) & 7);
+    }
+
+    const __m128i columnMajor = _mm_shuffle_epi8(palette, LoadAligned(indices));
+    const __m128i rowMajor    = _mm_shuffle_epi8(columnMajor, LoadAligned(kTransposeBlock));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(values), rowMajor);
+}
+#elif defined(ANGLE_ETC_USE_NEON)
+void DecodeIndividualOrDifferentialBlockSIMD(uint8_t *dest,
+                                             size_t destRowPitch,
+                                             const int baseColors[2][3],
+                                             const int *const modifiers[2],
+                                             uint32_t msbs,
+                                             uint32_t lsbs,
+                                             bool flipped,
+                                             const uint8_t alphaValues[4][4])
+{
+    uint8x16_t palettes[2];
+    for (size_t subblock = 0; subblock < 2; subblock++)
+    {
+        const int *base = baseColors[subblock];
+        const int *mod  = modifiers[subblock];
+
+        const int16_t baseValues[8] = {
+            static_cast<int16_t>(base[0]), static_cast<int16_t>(base[1]),
+            static_cast<int16_t>(base[2]), 0,
+            static_cast<int16_t>(base[0]), static_cast<int16_t>(base[1]),
+            static_cast<int16_t>(base[2]), 0};
+        const int16_t mods01[8] = {
+            static_cast<int16_t>(mod[0]), static_cast<int16_t>(mod[0]),
+            static_cast<int16_t>(mod[0]), 0,
+            static_cast<int16_t>(mod[1]), static_cast<int16_t>(mod[1]),
+            static_cast<int16_t>(mod[1]), 0};
+        const int16_t mods23[8] = {
+            static_cast<int16_t>(mod[2]), static_cast<int16_t>(mod[2]),
+            static_cast<int16_t>(mod[2]), 0,
+            static_cast<int16_t>(mod[3]), static_cast<int16_t>(mod[3]),
+            static_cast<int16_t>(mod[3]), 0};
+
+        const int16x8_t base16 = vld1q_s16(baseValues);
+        // Unsigned saturation clamps the colors to [0, 255].
+        palettes[subblock] = vcombine_u8(vqmovun_s16(vaddq_s16(base16, vld1q_s16(mods01))),
+                                         vqmovun_s16(vaddq_s16(base16, vld1q_s16(mods23))));
+    }
+
+    // Expand the index bits to one byte per pixel, in column-major order.
+    const uint8x16_t spreadIndexBytes = vld1q_u8(kSpreadIndexBytes);
+    const uint8x16_t indexBitMasks    = vld1q_u8(kIndexBitMasks);
+    const uint8x16_t msbSet =
+        vtstq_u8(vqtbl1q_u8(vreinterpretq_u8_u32(vdupq_n_u32(msbs)), spreadIndexBytes),
+                 indexBitMasks);
+    const uint8x16_t lsbSet =
+        vtstq_u8(vqtbl1q_u8(vreinterpretq_u8_u32(vdupq_n_u32(lsbs)), spreadIndexBytes),
+                 indexBitMasks);
+    // The palette index is scaled to the byte offset of the color, i.e. (msb * 2 + lsb) * 4.
+    const uint8x16_t colorOffsets =
+        vorrq_u8(vandq_u8(msbSet, vdupq_n_u8(8)), vandq_u8(lsbSet, vdupq_n_u8(4)));
+
+    const uint8x16_t channelOffsets = vld1q_u8(kChannelOffsets);
+    const uint8x16_t spreadRowAlpha = vld1q_u8(kSpreadRowAlpha);
+    const uint8x16_t alphaMask      = vreinterpretq_u8_u32(vdupq_n_u32(0xFF000000u));
+    const uint8x16_t rightHalf =
+        vreinterpretq_u8_u64(vcombine_u64(vdup_n_u64(0), vdup_n_u64(~uint64_t(0))));
+
+    for (size_t j = 0; j < 4; j++)
+    {
+        const uint8x16_t lookup =
+            vaddq_u8(vqtbl1q_u8(colorOffsets, vld1q_u8(kSpreadRowIndices[j])), channelOffsets);
+
+        const uint8x16_t subblock1 =
+            flipped ? vdupq_n_u8(j < 2 ? 0 : 0xFF) : rightHalf;
+        uint8x16_t color =
+            vbslq_u8(subblock1, vqtbl1q_u8(palettes[1], lookup), vqtbl1q_u8(palettes[0], lookup));
+
+        uint32_t rowAlpha;
+        memcpy(&rowAlpha, alphaValues[j], sizeof(rowAlpha));
+        const uint8x16_t alpha =
+            vqtbl1q_u8(vreinterpretq_u8_u32(vdupq_n_u32(rowAlpha)), spreadRowAlpha);
+        color = vbslq_u8(alphaMask, alpha, color);
+
+        vst1q_u8(dest + j * destRowPitch, color);
+    }
+}
+
+void DecodeSingleChannelBlockSIMD(uint8_t values[kNumPixelsInBlock],
+                                  int codeword,
+                                  int multiplier,
+                                  const int16_t modifiers[8],
+                                  uint64_t packedIndices,
+                                  bool isSigned)
+{
+    const int16x8_t palette16 = vmlaq_s16(vdupq_n_s16(static_cast<int16_t>(codeword)),
+                                          vld1q_s16(modifiers),
+                                          vdupq_n_s16(static_cast<int16_t>(multiplier)));
+    // Saturation clamps the values to [0, 255] or [-128, 127].
+    const uint8x8_t palette =
+        isSigned ? vreinterpret_u8_s8(vqmovn_s16(palette16)) : vqmovun_s16(palette16);
+
+    uint8_t indices[kNumPixelsInBlock];
+    for (size_t pixel = 0; pixel < kNumPixelsInBlock; pixel++)
+    {
+        indices[pixel] = static_cast<uint8_t>((packedIndices >> (45 - 3 * pixel)) & 7);
+    }
+
+    const uint8x16_t columnMajor =
+        vqtbl1q_u8(vcombine_u8(palette, vdup_n_u8(0)), vld1q_u8(indices));
+    vst1q_u8(values, vqtbl1q_u8(columnMajor, vld1q_u8(kTransposeBlock)));
+}
+#else
+void DecodeIndividualOrDifferentialBlockSIMD(uint8_t *dest,
+                                             size_t destRowPitch,
+                                             const int baseColors[2][3],
+                                             const int *const modifiers[2],
+                                             uint32_t msbs,
+                                             uint32_t lsbs,
+                                             bool flipped,
+                                             const uint8_t alphaValues[4][4])
+{
+    UNREACHABLE();
+}
+
+void DecodeSingleChannelBlockSIMD(uint8_t values[kNumPixelsInBlock],
+                                  int codeword,
+                                  int multiplier,
+                                  const int16_t modifiers[8],
+                                  uint64_t packedIndices,
+                                  bool isSigned)
+{
+    UNREACHABLE();
+}
+#endif
+
 struct ETC2Block
 {
     // Decodes unsigned single or dual channel ETC2 block to 8-bit color
@@ -64,6 +497,12 @@ struct ETC2Block
                                    size_t destRowPitch,
                                    bool isSigned) const
     {
+        if (x + 4 <= w && y + 4 <= h && SupportsSIMDBlockDecode())
+        {
+            decodeAsSingleETC2ChannelSIMD(dest, destPixelStride, destRowPitch, isSigned);
+            return;
+        }
+
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint8_t *row = dest + (j * destRowPitch);
@@ -533,6 +972,23 @@ struct ETC2Block
         const IntensityModifier *intensityModifier =
             nonOpaquePunchThroughAlpha ? intensityModifierNonOpaque : intensityModifierDefault;
 
+        if (x + 4 <= w && y + 4 <= h && SupportsSIMDBlockDecode())
+        {
+            const int baseColors[2][3]   = {{r1, g1, b1}, {r2, g2, b2}};
+            const int *const modifiers[] = {intensityModifier[u.idht.mode.idm.cw1],
+                                            intensityModifier[u.idht.mode.idm.cw2]};
+            const uint32_t msbs = u.idht.pixelIndexMSB[0] << 8 | u.idht.pixelIndexMSB[1];
+            const uint32_t lsbs = u.idht.pixelIndexLSB[0] << 8 | u.idht.pixelIndexLSB[1];
+            DecodeIndividualOrDifferentialBlockSIMD(dest, destRowPitch, baseColors, modifiers,
+                                                    msbs, lsbs, u.idht.mode.idm.flipbit,
+                                                    alphaValues);
+            if (nonOpaquePunchThroughAlpha)
+            {
+                decodePunchThroughAlphaBlock(dest, x, y, w, h, destRowPitch);
+            }
+            return;
+        }
+
         R8G8B8A8 subblockColors0[4];
         R8G8B8A8 subblockColors1[4];
         for (size_t modifierIdx = 0; modifierIdx < 4; modifierIdx++)
@@ -1432,31 +1888,44 @@ struct ETC2Block
         // clang-format on
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    // Same as decodeAsSingleETC2Channel, for blocks that are entirely inside the image.
+    void decodeAsSingleETC2ChannelSIMD(uint8_t *dest,
+                                       size_t destPixelStride,
+                                       size_t destRowPitch,
+                                       bool isSigned) const
     {
-        // clang-format off
-        static const int modifierTable[16][8] =
-        {
-            { -3, -6,  -9, -15, 2, 5, 8, 14 },
-            { -3, -7, -10, -13, 2, 6, 9, 12 },
-            { -2, -5,  -8, -13, 1, 4, 7, 12 },
-            { -2, -4,  -6, -13, 1, 3, 5, 12 },
-            { -3, -6,  -8, -12, 2, 5, 7, 11 },
-            { -3, -7,  -9, -11, 2, 6, 8, 10 },
-            { -4, -7,  -8, -11, 3, 6, 7, 10 },
-            { -3, -5,  -8, -11, 2, 4, 7, 10 },
-            { -2, -6,  -8, -10, 1, 5, 7,  9 },
-            { -2, -5,  -8, -10, 1, 4, 7,  9 },
-            { -2, -4,  -8, -10, 1, 3, 7,  9 },
-            { -2, -5,  -7, -10, 1, 4, 6,  9 },
-            { -3, -4,  -7, -10, 2, 3, 6,  9 },
-            { -1, -2,  -3, -10, 0, 1, 2,  9 },
-            { -4, -6,  -8,  -9, 3, 5, 7,  8 },
-            { -3, -5,  -7,  -9, 2, 4, 6,  8 }
-        };
-        // clang-format on
+        // The indices are packed in big-endian order in the last 6 bytes of the block.
+        const uint8_t *bytes   = reinterpret_cast<const uint8_t *>(&u);
+        uint64_t packedIndices = 0;
+        for (size_t byteIndex = 2; byteIndex < 8; byteIndex++)
+        {
+            packedIndices = packedIndices << 8 | bytes[byteIndex];
+        }
+
+        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        uint8_t values[kNumPixelsInBlock];
+        DecodeSingleChannelBlockSIMD(values, codeword, u.scblk.multiplier,
+                                     kSingleChannelModifiers[u.scblk.table_index], packedIndices,
+                                     isSigned);
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        for (size_t j = 0; j < 4; j++)
+        {
+            uint8_t *row = dest + (j * destRowPitch);
+            if (destPixelStride == 1)
+            {
+                memcpy(row, values + j * 4, 4);
+                continue;
+            }
+            for (size_t i = 0; i < 4; i++)
+            {
+                row[i * destPixelStride] = values[j * 4 + i];
+            }
+        }
+    }
+
+    int getSingleChannelModifier(size_t x, size_t y) const
+    {
+        return kSingleChannelModifiers[u.scblk.table_index][getSingleChannelIndex(x, y)];
     }
 };
 
@@ -1482,25 +1951,21 @@ void LoadR11EACToR8(const ImageLoadContext &context,
                     size_t outputDepthPitch,
                     bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + x;
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + x;
 
-                sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
-                                                       outputRowPitch, isSigned);
-            }
+            sourceBlock->decodeAsSingleETC2Channel(destPixels, x, y, width, height, 1,
+                                                   outputRowPitch, isSigned);
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG8(const ImageLoadContext &context,
@@ -1515,29 +1980,25 @@ void LoadRG11EACToRG8(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                uint8_t *destPixelsRed          = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
-                                                          outputRowPitch, isSigned);
-
-                uint8_t *destPixelsGreen          = destPixelsRed + 1;
-                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
-                sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
-                                                            outputRowPitch, isSigned);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            uint8_t *destPixelsRed          = destRow + (x * 2);
+            const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+            sourceBlockRed->decodeAsSingleETC2Channel(destPixelsRed, x, y, width, height, 2,
+                                                      outputRowPitch, isSigned);
+
+            uint8_t *destPixelsGreen          = destPixelsRed + 1;
+            const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+            sourceBlockGreen->decodeAsSingleETC2Channel(destPixelsGreen, x, y, width, height, 2,
+                                                        outputRowPitch, isSigned);
         }
-    }
+    });
 }
 
 void LoadR11EACToR16(const ImageLoadContext &context,
@@ -1553,25 +2014,21 @@ void LoadR11EACToR16(const ImageLoadContext &context,
                      bool isSigned,
                      bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint16_t *destRow =
-                priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint16_t *destRow =
+            priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint16_t *destPixels         = destRow + x;
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint16_t *destPixels         = destRow + x;
 
-                sourceBlock->decodeAsSingleEACChannel(destPixels, x, y, width, height, 1,
-                                                      outputRowPitch, isSigned, isFloat);
-            }
+            sourceBlock->decodeAsSingleEACChannel(destPixels, x, y, width, height, 1,
+                                                  outputRowPitch, isSigned, isFloat);
         }
-    }
+    });
 }
 
 void LoadRG11EACToRG16(const ImageLoadContext &context,
@@ -1587,29 +2044,25 @@ void LoadRG11EACToRG16(const ImageLoadContext &context,
                        bool isSigned,
                        bool isFloat)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint16_t *destRow =
-                priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint16_t *destRow =
+            priv::OffsetDataPointer<uint16_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                uint16_t *destPixelsRed         = destRow + (x * 2);
-                const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
-                sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
-                                                         outputRowPitch, isSigned, isFloat);
-
-                uint16_t *destPixelsGreen         = destPixelsRed + 1;
-                const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
-                sourceBlockGreen->decodeAsSingleEACChannel(destPixelsGreen, x, y, width, height, 2,
-                                                           outputRowPitch, isSigned, isFloat);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            uint16_t *destPixelsRed         = destRow + (x * 2);
+            const ETC2Block *sourceBlockRed = sourceRow + (x / 2);
+            sourceBlockRed->decodeAsSingleEACChannel(destPixelsRed, x, y, width, height, 2,
+                                                     outputRowPitch, isSigned, isFloat);
+
+            uint16_t *destPixelsGreen         = destPixelsRed + 1;
+            const ETC2Block *sourceBlockGreen = sourceBlockRed + 1;
+            sourceBlockGreen->decodeAsSingleEACChannel(destPixelsGreen, x, y, width, height, 2,
+                                                       outputRowPitch, isSigned, isFloat);
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
@@ -1624,25 +2077,21 @@ void LoadETC2RGB8ToRGBA8(const ImageLoadContext &context,
                          size_t outputDepthPitch,
                          bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + (x * 4);
 
-                sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                         DefaultETCAlphaValues, punchthroughAlpha);
-            }
+            sourceBlock->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
+                                     DefaultETCAlphaValues, punchthroughAlpha);
         }
-    }
+    });
 }
 
 void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
@@ -1657,25 +2106,21 @@ void LoadETC2RGB8ToBC1(const ImageLoadContext &context,
                        size_t outputDepthPitch,
                        bool punchthroughAlpha)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlock = sourceRow + (x / 4);
-                uint8_t *destPixels          = destRow + (x * 2);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlock = sourceRow + (x / 4);
+            uint8_t *destPixels          = destRow + (x * 2);
 
-                sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
-                                            punchthroughAlpha);
-            }
+            sourceBlock->transcodeAsBC1(destPixels, x, y, width, height, DefaultETCAlphaValues,
+                                        punchthroughAlpha);
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
@@ -1691,30 +2136,26 @@ void LoadETC2RGBA8ToBC3(const ImageLoadContext &context,
                         bool punchthroughAlpha,
                         bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceAlphaBlock = sourceRow + (x / 4) * 2;
-                uint8_t *destAlphaPixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceAlphaBlock = sourceRow + (x / 4) * 2;
+            uint8_t *destAlphaPixels          = destRow + (x * 4);
 
-                const ETC2Block *sourceRgbBlock = sourceAlphaBlock + 1;
-                uint8_t *destRgbPixels          = destAlphaPixels + 8;
+            const ETC2Block *sourceRgbBlock = sourceAlphaBlock + 1;
+            uint8_t *destRgbPixels          = destAlphaPixels + 8;
 
-                sourceRgbBlock->transcodeAsBC1(destRgbPixels, x, y, width, height,
-                                               DefaultETCAlphaValues, punchthroughAlpha);
+            sourceRgbBlock->transcodeAsBC1(destRgbPixels, x, y, width, height,
+                                           DefaultETCAlphaValues, punchthroughAlpha);
 
-                sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned);
-            }
+            sourceAlphaBlock->transcodeAsBC4(destAlphaPixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
@@ -1729,31 +2170,27 @@ void LoadETC2RGBA8ToRGBA8(const ImageLoadContext &context,
                           size_t outputDepthPitch,
                           bool srgb)
 {
-    uint8_t decodedAlphaValues[4][4];
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        uint8_t decodedAlphaValues[4][4];
 
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow =
-                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow =
+            priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
-                sourceBlockAlpha->decodeAsSingleETC2Channel(
-                    reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
-                    false);
-
-                uint8_t *destPixels             = destRow + (x * 4);
-                const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
-                sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
-                                            decodedAlphaValues, false);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceBlockAlpha = sourceRow + (x / 2);
+            sourceBlockAlpha->decodeAsSingleETC2Channel(
+                reinterpret_cast<uint8_t *>(decodedAlphaValues), x, y, width, height, 1, 4,
+                false);
+
+            uint8_t *destPixels             = destRow + (x * 4);
+            const ETC2Block *sourceBlockRGB = sourceBlockAlpha + 1;
+            sourceBlockRGB->decodeAsRGB(destPixels, x, y, width, height, outputRowPitch,
+                                        decodedAlphaValues, false);
         }
-    }
+    });
 }
 
 }  // anonymous namespace
@@ -2160,23 +2597,19 @@ void LoadEACR11ToBC4(const ImageLoadContext &context,
                      size_t outputDepthPitch,
                      bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 4);
-                uint8_t *destR11Pixels          = destRow + (x * 2);
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-            }
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceR11Block = sourceRow + (x / 4);
+            uint8_t *destR11Pixels          = destRow + (x * 2);
+            sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadEACRG11ToBC5(const ImageLoadContext &context,
@@ -2191,27 +2624,23 @@ void LoadEACRG11ToBC5(const ImageLoadContext &context,
                       size_t outputDepthPitch,
                       bool isSigned)
 {
-    for (size_t z = 0; z < depth; z++)
-    {
-        for (size_t y = 0; y < height; y += 4)
-        {
-            const ETC2Block *sourceRow =
-                priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
-            uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
-                                                                outputDepthPitch);
+    DecodeBlockRows(context, width, height, depth, [&](size_t y, size_t z) {
+        const ETC2Block *sourceRow =
+            priv::OffsetDataPointer<ETC2Block>(input, y / 4, z, inputRowPitch, inputDepthPitch);
+        uint8_t *destRow = priv::OffsetDataPointer<uint8_t>(output, y / 4, z, outputRowPitch,
+                                                            outputDepthPitch);
 
-            for (size_t x = 0; x < width; x += 4)
-            {
-                const ETC2Block *sourceR11Block = sourceRow + (x / 2);
-                uint8_t *destR11Pixels          = destRow + (x * 4);
+        for (size_t x = 0; x < width; x += 4)
+        {
+            const ETC2Block *sourceR11Block = sourceRow + (x / 2);
+            uint8_t *destR11Pixels          = destRow + (x * 4);
 
-                const ETC2Block *sourceG11Block = sourceR11Block + 1;
-                uint8_t *destG11Pixels          = destR11Pixels + 8;
-                sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
-                sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned);
-            }
+            const ETC2Block *sourceG11Block = sourceR11Block + 1;
+            uint8_t *destG11Pixels          = destR11Pixels + 8;
+            sourceR11Block->transcodeAsBC4(destR11Pixels, x, y, width, height, isSigned);
+            sourceG11Block->transcodeAsBC4(destG11Pixels, x, y, width, height, isSigned);
         }
-    }
+    });
 }
 
 void LoadEACR11ToBC4(const ImageLoadContext &context,
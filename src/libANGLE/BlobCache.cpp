@@ -39,10 +39,12 @@ void BlobCache::put(const gl::Context *context,
 bool BlobCache::compressAndPut(const gl::Context *context,
                                const BlobCache::Key &key,
                                angle::MemoryBuffer &&uncompressedValue,
-                               size_t *compressedSize)
+                               size_t *compressedSize,
+                               angle::BlobCodec codec)
 {
     angle::MemoryBuffer compressedValue;
-    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue))
+    if (!angle::CompressBlob(uncompressedValue.size(), uncompressedValue.data(), &compressedValue,
+                             codec))
     {
         return false;
     }
@@ -59,12 +59,13 @@ class BlobCache final : angle::NonCopyable
     // will be used.  Otherwise the value is cached in this object.
     void put(const gl::Context *context, const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
-    // Store a key-blob pair in the cache, but compress the blob before insertion. Returns false if
-    // compression fails, returns true otherwise.
+    // Store a key-blob pair in the cache, but compress the blob with |codec| before insertion.
+    // Returns false if compression fails, returns true otherwise.
     bool compressAndPut(const gl::Context *context,
                         const BlobCache::Key &key,
                         angle::MemoryBuffer &&uncompressedValue,
-                        size_t *compressedSize);
+                        size_t *compressedSize,
+                        angle::BlobCodec codec = angle::BlobCodec::Gzip);
 
     // Store a key-blob pair in the application cache, only if application callbacks are set.
     void putApplication(const gl::Context *context,
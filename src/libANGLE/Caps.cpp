@@ -1399,6 +1399,8 @@ std::vector<std::string> DisplayExtensions::getStrings() const
     InsertExtensionString("EGL_ANGLE_global_fence_sync",                         globalFenceSyncANGLE,               &extensionStrings);
     InsertExtensionString("EGL_ANGLE_memory_usage_report",                       memoryUsageReportANGLE,             &extensionStrings);
     InsertExtensionString("EGL_EXT_surface_compression",                         surfaceCompressionEXT,              &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_max_frame_latency",                         maxFrameLatencyANGLE,               &extensionStrings);
+    InsertExtensionString("EGL_ANGLE_memory_pressure",                           memoryPressureANGLE,                &extensionStrings);
     // clang-format on
 
     return extensionStrings;
@@ -714,8 +714,14 @@ struct DisplayExtensions
     // EGL_ANGLE_memory_usage_report
     bool memoryUsageReportANGLE = false;
 
+    // EGL_ANGLE_memory_pressure
+    bool memoryPressureANGLE = false;
+
     // EGL_EXT_surface_compression
     bool surfaceCompressionEXT = false;
+
+    // EGL_ANGLE_max_frame_latency
+    bool maxFrameLatencyANGLE = false;
 };
 
 struct DeviceExtensions
@@ -336,6 +336,19 @@ void Compiler::putInstance(ShCompilerInstance &&instance)
     }
 }
 
+size_t Compiler::getPoolMemorySize() const
+{
+    size_t memorySize = 0;
+    for (const std::vector<ShCompilerInstance> &pool : mPools)
+    {
+        for (const ShCompilerInstance &instance : pool)
+        {
+            memorySize += instance.getPoolMemorySize();
+        }
+    }
+    return memorySize;
+}
+
 ShShaderSpec Compiler::SelectShaderSpec(const State &state)
 {
     const GLint majorVersion = state.getClientMajorVersion();
@@ -414,6 +427,11 @@ ShaderType ShCompilerInstance::getShaderType() const
     return mShaderType;
 }
 
+size_t ShCompilerInstance::getPoolMemorySize() const
+{
+    return mHandle ? sh::GetPoolMemorySize(mHandle) : 0;
+}
+
 ShBuiltInResources ShCompilerInstance::getBuiltInResources() const
 {
     return sh::GetBuiltInResources(mHandle);
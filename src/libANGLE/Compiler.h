@@ -40,6 +40,9 @@ class Compiler final : public RefCountObjectNoID
     ShShaderOutput getShaderOutputType() const { return mOutputType; }
     const ShBuiltInResources &getBuiltInResources() const { return mResources; }
 
+    // The memory held by the pooled compiler instances.
+    size_t getPoolMemorySize() const;
+
     static ShShaderSpec SelectShaderSpec(const State &state);
 
   private:
@@ -66,6 +69,7 @@ class ShCompilerInstance final : public angle::NonCopyable
     ShaderType getShaderType() const;
     ShBuiltInResources getBuiltInResources() const;
     ShShaderOutput getShaderOutputType() const;
+    size_t getPoolMemorySize() const;
 
   private:
     ShHandle mHandle;
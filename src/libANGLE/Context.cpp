@@ -673,6 +673,9 @@ Context::Context(egl::Display *display,
 
     // Implementations now require the display to be set at context creation.
     ASSERT(mDisplay);
+
+    mState.getDebug().setAsyncCallbackDelivery(
+        mDisplay->getFrontendFeatures().deliverDebugCallbacksAsynchronously.enabled);
 }
 
 egl::Error Context::initialize()
@@ -973,7 +976,8 @@ egl::Error Context::makeCurrent(egl::Display *display,
 {
     mDisplay = display;
 
-    if (!mHasBeenCurrent)
+    const bool isFirstMakeCurrent = !mHasBeenCurrent;
+    if (isFirstMakeCurrent)
     {
         initializeDefaultResources();
         initRendererString();
@@ -1001,9 +1005,21 @@ egl::Error Context::makeCurrent(egl::Display *display,
 
     getShareGroup()->getFrameCaptureShared()->onMakeCurrent(this, drawSurface);
 
-    // TODO(jmadill): Rework this when we support ContextImpl
-    mState.setAllDirtyBits();
-    mState.setAllDirtyObjects();
+    // Backends whose contexts keep their own state are notified of the changes other contexts
+    // make to shared objects, just like when those contexts are current on other threads.  For
+    // them, only the state that depends on the surfaces is synced again, through the framebuffer
+    // bindings.
+    if (isFirstMakeCurrent || !getFrontendFeatures().skipStateInvalidationOnMakeCurrent.enabled)
+    {
+        // TODO(jmadill): Rework this when we support ContextImpl
+        mState.setAllDirtyBits();
+        mState.setAllDirtyObjects();
+    }
+    else
+    {
+        mState.setDrawFramebufferBindingDirty();
+        mState.setReadFramebufferBindingDirty();
+    }
 
     ANGLE_TRY(setDefaultFramebuffer(drawSurface, readSurface));
 
@@ -1022,6 +1038,8 @@ egl::Error Context::makeCurrent(egl::Display *display,
 
 egl::Error Context::unMakeCurrent(const egl::Display *display)
 {
+    mState.getDebug().deliverPendingCallbackMessages();
+
     ANGLE_TRY(angle::ResultToEGL(mImplementation->onUnMakeCurrent(this)));
 
     ANGLE_TRY(unsetDefaultFramebuffer());
@@ -1554,6 +1572,13 @@ void Context::useProgram(ShaderProgramID program)
     ANGLE_CONTEXT_TRY(mState.setProgram(this, programObject));
     mStateCache.onProgramExecutableChange(this);
     mProgramObserverBinding.bind(programObject);
+
+    // Programs that are bound are likely to be drawn with soon; start their post-link tasks if
+    // they have been deferred.
+    if (programObject)
+    {
+        programObject->getExecutable().schedulePostLinkTasks();
+    }
 }
 
 void Context::useProgramStages(ProgramPipelineID pipeline,
@@ -2941,11 +2966,13 @@ void Context::drawElementsIndirect(PrimitiveMode mode, DrawElementsType type, co
 
 void Context::flush()
 {
+    mState.getDebug().deliverPendingCallbackMessages();
     ANGLE_CONTEXT_TRY(mImplementation->flush(this));
 }
 
 void Context::finish()
 {
+    mState.getDebug().deliverPendingCallbackMessages();
     ANGLE_CONTEXT_TRY(mImplementation->finish(this));
 }
 
@@ -6930,14 +6957,17 @@ void Context::deleteFramebuffers(GLsizei n, const FramebufferID *framebuffers)
 
 void Context::deleteRenderbuffers(GLsizei n, const RenderbufferID *renderbuffers)
 {
+    mImplementation->beginObjectDeletionBatch();
     for (int i = 0; i < n; i++)
     {
         deleteRenderbuffer(renderbuffers[i]);
     }
+    mImplementation->endObjectDeletionBatch();
 }
 
 void Context::deleteTextures(GLsizei n, const TextureID *textures)
 {
+    mImplementation->beginObjectDeletionBatch();
     for (int i = 0; i < n; i++)
     {
         if (textures[i].value != 0)
@@ -6945,6 +6975,7 @@ void Context::deleteTextures(GLsizei n, const TextureID *textures)
             deleteTexture(textures[i]);
         }
     }
+    mImplementation->endObjectDeletionBatch();
 }
 
 void Context::detachShader(ShaderProgramID program, ShaderProgramID shader)
@@ -9509,7 +9540,8 @@ void Context::onSubjectStateChange(angle::SubjectIndex index, angle::SubjectMess
                     mStateCache.onProgramExecutableChange(this);
                     break;
                 case angle::SubjectMessage::ProgramRelinked:
-                    ANGLE_CONTEXT_TRY(mState.installProgramPipelineExecutable(this));
+                    // The pipeline may have reinstalled its current executable from its cache.
+                    ANGLE_CONTEXT_TRY(mState.installProgramPipelineExecutableIfNotAlready(this));
                     mStateCache.onProgramExecutableChange(this);
                     break;
                 default:
@@ -9650,6 +9682,8 @@ egl::Error Context::unsetDefaultFramebuffer()
 
 void Context::onPreSwap()
 {
+    mState.getDebug().deliverPendingCallbackMessages();
+
     // Dump frame capture if enabled.
     getShareGroup()->getFrameCaptureShared()->onEndFrame(this);
 }
@@ -10108,6 +10142,41 @@ size_t Context::getMemoryUsage() const
     return memoryUsage;
 }
 
+void Context::getMemoryUsageBreakdown(MemoryUsageBreakdown *breakdown) const
+{
+    breakdown->fill(0);
+
+    (*breakdown)[MemoryUsageCategory::Textures] = mState.mTextureManager->getTotalMemorySize();
+    (*breakdown)[MemoryUsageCategory::Buffers]  = mState.mBufferManager->getTotalMemorySize();
+    (*breakdown)[MemoryUsageCategory::Renderbuffers] =
+        mState.mRenderbufferManager->getTotalMemorySize();
+    (*breakdown)[MemoryUsageCategory::ShaderCode] =
+        mState.mShaderProgramManager->getTotalShaderCodeSize();
+
+    if (mCompiler.get())
+    {
+        (*breakdown)[MemoryUsageCategory::CompilerPools] = mCompiler->getPoolMemorySize();
+    }
+    {
+        egl::BlobCache &blobCache = mDisplay->getBlobCache();
+        std::scoped_lock<angle::SimpleMutex> lock(blobCache.getMutex());
+        (*breakdown)[MemoryUsageCategory::BlobCache] = blobCache.size();
+    }
+
+    mImplementation->getMemoryUsageBreakdown(this, breakdown);
+}
+
+egl::Error Context::handleMemoryPressure(MemoryPressureLevel level)
+{
+    if (level == MemoryPressureLevel::Critical)
+    {
+        // The compiler and its pool allocators are recreated when the next shader is compiled.
+        releaseShaderCompiler();
+    }
+
+    return angle::ResultToEGL(mImplementation->handleMemoryPressure(this, level));
+}
+
 // ErrorSet implementation.
 ErrorSet::ErrorSet(Debug *debug,
                    const angle::FrontendFeatures &frontendFeatures,
@@ -832,6 +832,12 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool areBlobCacheFuncsSet() const;
 
     size_t getMemoryUsage() const;
+    // The memory usage of the context, its share group and display, per category.  The categories
+    // that aren't tracked by the backend are zero.
+    void getMemoryUsageBreakdown(MemoryUsageBreakdown *breakdown) const;
+
+    // EGL_ANGLE_memory_pressure implementation.
+    egl::Error handleMemoryPressure(MemoryPressureLevel level);
 
   private:
     void initializeDefaultResources();
@@ -15,6 +15,28 @@
 
 namespace
 {
+constexpr GLenum kDebugSources[] = {
+    GL_DEBUG_SOURCE_API,         GL_DEBUG_SOURCE_WINDOW_SYSTEM, GL_DEBUG_SOURCE_SHADER_COMPILER,
+    GL_DEBUG_SOURCE_THIRD_PARTY, GL_DEBUG_SOURCE_APPLICATION,   GL_DEBUG_SOURCE_OTHER,
+};
+
+constexpr GLenum kDebugTypes[] = {
+    GL_DEBUG_TYPE_ERROR,       GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR, GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR,
+    GL_DEBUG_TYPE_PORTABILITY, GL_DEBUG_TYPE_PERFORMANCE,         GL_DEBUG_TYPE_OTHER,
+    GL_DEBUG_TYPE_MARKER,      GL_DEBUG_TYPE_PUSH_GROUP,          GL_DEBUG_TYPE_POP_GROUP,
+};
+
+constexpr GLenum kDebugSeverities[] = {
+    GL_DEBUG_SEVERITY_HIGH,
+    GL_DEBUG_SEVERITY_MEDIUM,
+    GL_DEBUG_SEVERITY_LOW,
+    GL_DEBUG_SEVERITY_NOTIFICATION,
+};
+
+// The number of messages queued for asynchronous delivery to the callback before they are
+// delivered in the call that queues the next one.
+constexpr size_t kMaxPendingCallbackMessages = 256;
+
 const char *GLSeverityToString(GLenum severity)
 {
     switch (severity)
@@ -96,9 +118,17 @@ Debug::Debug(bool initialDebugState)
       mMessages(),
       mMaxLoggedMessages(0),
       mOutputSynchronous(false),
-      mGroups()
+      mGroups(),
+      mHasIdControls(false),
+      mAsyncCallbackDelivery(false),
+      mPendingCallbackMessages(kMaxPendingCallbackMessages)
 {
+    static_assert(ArraySize(kDebugSources) == kSourceCount);
+    static_assert(ArraySize(kDebugTypes) == kTypeCount);
+    static_assert(ArraySize(kDebugSeverities) == kSeverityCount);
+
     pushDefaultGroup();
+    updateEnabledMessageKinds();
 }
 
 Debug::~Debug() {}
@@ -111,6 +141,7 @@ void Debug::setMaxLoggedMessages(GLuint maxLoggedMessages)
 void Debug::setOutputEnabled(bool enabled)
 {
     mOutputEnabled = enabled;
+    updateEnabledMessageKinds();
 }
 
 bool Debug::isOutputEnabled() const
@@ -120,6 +151,10 @@ bool Debug::isOutputEnabled() const
 
 void Debug::setOutputSynchronous(bool synchronous)
 {
+    if (synchronous)
+    {
+        deliverPendingCallbackMessages();
+    }
     mOutputSynchronous = synchronous;
 }
 
@@ -130,6 +165,9 @@ bool Debug::isOutputSynchronous() const
 
 void Debug::setCallback(GLDEBUGPROCKHR callback, const void *userParam)
 {
+    // The queued messages belong to the previous callback.
+    deliverPendingCallbackMessages();
+
     mCallbackFunction  = callback;
     mCallbackUserParam = userParam;
 }
@@ -144,6 +182,43 @@ const void *Debug::getUserParam() const
     return mCallbackUserParam;
 }
 
+void Debug::setAsyncCallbackDelivery(bool enabled)
+{
+    if (!enabled)
+    {
+        deliverPendingCallbackMessages();
+    }
+    mAsyncCallbackDelivery = enabled;
+}
+
+void Debug::deliverPendingCallbackMessages() const
+{
+    // The queue size is atomic, so the common case of no pending messages doesn't take the lock.
+    if (mPendingCallbackMessages.empty())
+    {
+        return;
+    }
+
+    while (true)
+    {
+        Message m;
+        {
+            std::lock_guard<angle::SimpleMutex> lock(mMutex);
+            if (mPendingCallbackMessages.empty())
+            {
+                return;
+            }
+            m = std::move(mPendingCallbackMessages.front());
+            mPendingCallbackMessages.pop();
+        }
+
+        // The lock is not held during the callback, which may call back into GL.
+        mCallbackFunction(m.source, m.type, m.id, m.severity,
+                          static_cast<GLsizei>(m.message.length()), m.message.c_str(),
+                          mCallbackUserParam);
+    }
+}
+
 void Debug::insertMessage(GLenum source,
                           GLenum type,
                           GLuint id,
@@ -164,8 +239,10 @@ void Debug::insertMessage(GLenum source,
                           gl::LogSeverity logSeverity,
                           angle::EntryPoint entryPoint) const
 {
+    // Output all messages to the debug log.  INFO and EVENT messages are not even formatted if
+    // this build doesn't log them.
+    if (logSeverity > gl::LOG_INFO || ShouldCreateLogMessage(logSeverity))
     {
-        // output all messages to the debug log
         const char *messageTypeString = GLMessageTypeToString(type);
         const char *severityString    = GLSeverityToString(severity);
         std::ostringstream messageStream;
@@ -194,7 +271,9 @@ void Debug::insertMessage(GLenum source,
         }
     }
 
-    if (!isMessageEnabled(source, type, id, severity))
+    // Only the controls that list ids need the full check.
+    if (!isMessageKindEnabled(source, type, severity) ||
+        (mHasIdControls && !isMessageEnabled(source, type, id, severity)))
     {
         return;
     }
@@ -206,6 +285,22 @@ void Debug::insertMessage(GLenum source,
     // the callback is expected to be thread-safe per spec, so there is no need for locking.
     if (mCallbackFunction != nullptr)
     {
+        if (mAsyncCallbackDelivery && !mOutputSynchronous)
+        {
+            {
+                std::lock_guard<angle::SimpleMutex> lock(mMutex);
+                if (!mPendingCallbackMessages.full())
+                {
+                    mPendingCallbackMessages.push(
+                        Message{source, type, id, severity, std::move(message)});
+                    return;
+                }
+            }
+
+            // The ring buffer is full.  Deliver the queued messages first to keep them in order.
+            deliverPendingCallbackMessages();
+        }
+
         mCallbackFunction(source, type, id, severity, static_cast<GLsizei>(message.length()),
                           message.c_str(), mCallbackUserParam);
     }
@@ -322,6 +417,8 @@ void Debug::setMessageControl(GLenum source,
 
     auto &controls = mGroups.back().controls;
     controls.push_back(std::move(c));
+
+    updateEnabledMessageKinds();
 }
 
 void Debug::pushGroup(GLenum source, GLuint id, std::string &&message)
@@ -343,6 +440,7 @@ void Debug::popGroup()
 
     Group g = mGroups.back();
     mGroups.pop_back();
+    updateEnabledMessageKinds();
 
     insertMessage(g.source, GL_DEBUG_TYPE_POP_GROUP, g.id, GL_DEBUG_SEVERITY_NOTIFICATION,
                   g.message, gl::LOG_INFO, angle::EntryPoint::GLPopDebugGroup);
@@ -366,6 +464,12 @@ void Debug::insertPerfWarning(GLenum severity, bool isLastRepeat, const char *me
                   gl::LOG_INFO, angle::EntryPoint::Invalid);
 }
 
+bool Debug::isPerfWarningEnabled(GLenum severity) const
+{
+    return isMessageKindEnabled(GL_DEBUG_SOURCE_API, GL_DEBUG_TYPE_PERFORMANCE, severity) ||
+           ShouldCreateLogMessage(gl::LOG_INFO);
+}
+
 bool Debug::isMessageEnabled(GLenum source, GLenum type, GLuint id, GLenum severity) const
 {
     if (!mOutputEnabled)
@@ -408,6 +512,64 @@ bool Debug::isMessageEnabled(GLenum source, GLenum type, GLuint id, GLenum sever
     return true;
 }
 
+bool Debug::isMessageKindEnabledForAnyId(GLenum source, GLenum type, GLenum severity) const
+{
+    if (!mOutputEnabled)
+    {
+        return false;
+    }
+
+    for (auto groupIter = mGroups.rbegin(); groupIter != mGroups.rend(); groupIter++)
+    {
+        const auto &controls = groupIter->controls;
+        for (auto controlIter = controls.rbegin(); controlIter != controls.rend(); controlIter++)
+        {
+            const auto &control = *controlIter;
+
+            if ((control.source != GL_DONT_CARE && control.source != source) ||
+                (control.type != GL_DONT_CARE && control.type != type) ||
+                (control.severity != GL_DONT_CARE && control.severity != severity))
+            {
+                continue;
+            }
+
+            // A control that lists ids enables some messages of this kind, or disables some which
+            // leaves the others to the controls below it.
+            if (control.ids.empty() || control.enabled)
+            {
+                return control.enabled;
+            }
+        }
+    }
+
+    return true;
+}
+
+void Debug::updateEnabledMessageKinds()
+{
+    mHasIdControls = false;
+    for (const Group &group : mGroups)
+    {
+        for (const Control &control : group.controls)
+        {
+            mHasIdControls = mHasIdControls || !control.ids.empty();
+        }
+    }
+
+    mEnabledMessageKinds.reset();
+    for (GLenum source : kDebugSources)
+    {
+        for (GLenum type : kDebugTypes)
+        {
+            for (GLenum severity : kDebugSeverities)
+            {
+                mEnabledMessageKinds.set(GetMessageKindIndex(source, type, severity),
+                                         isMessageKindEnabledForAnyId(source, type, severity));
+            }
+        }
+    }
+}
+
 void Debug::pushDefaultGroup()
 {
     Group g;
@@ -10,9 +10,11 @@
 #define LIBANGLE_DEBUG_H_
 
 #include "angle_gl.h"
+#include "common/FixedQueue.h"
 #include "common/PackedEnums.h"
 #include "common/SimpleMutex.h"
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "libANGLE/AttributeMap.h"
 #include "libANGLE/Error.h"
 
@@ -51,6 +53,18 @@ class Debug : angle::NonCopyable
     GLDEBUGPROCKHR getCallback() const;
     const void *getUserParam() const;
 
+    // When enabled and the output is not synchronous, messages for the callback are queued and
+    // delivered by deliverPendingCallbackMessages() instead of in the call that generated them.
+    void setAsyncCallbackDelivery(bool enabled);
+    void deliverPendingCallbackMessages() const;
+
+    // Whether messages of this source, type and severity may be enabled.  When false, inserting
+    // such a message does nothing, so callers can skip generating it.
+    ANGLE_INLINE bool isMessageKindEnabled(GLenum source, GLenum type, GLenum severity) const
+    {
+        return mEnabledMessageKinds[GetMessageKindIndex(source, type, severity)];
+    }
+
     void insertMessage(GLenum source,
                        GLenum type,
                        GLuint id,
@@ -89,11 +103,43 @@ class Debug : angle::NonCopyable
     // Helper for ANGLE_PERF_WARNING
     void insertPerfWarning(GLenum severity, bool isLastRepeat, const char *message) const;
 
+    // Whether a perf warning of |severity| is output anywhere, either to the app or to the log.
+    bool isPerfWarningEnabled(GLenum severity) const;
+
   private:
     bool isMessageEnabled(GLenum source, GLenum type, GLuint id, GLenum severity) const;
+    bool isMessageKindEnabledForAnyId(GLenum source, GLenum type, GLenum severity) const;
+    void updateEnabledMessageKinds();
 
     void pushDefaultGroup();
 
+    static constexpr size_t kSourceCount   = 6;
+    static constexpr size_t kTypeCount     = 9;
+    static constexpr size_t kSeverityCount = 4;
+    // Messages of an unknown source, type or severity use the last index, which is never enabled.
+    static constexpr size_t kMessageKindCount = kSourceCount * kTypeCount * kSeverityCount + 1;
+
+    static ANGLE_INLINE size_t GetMessageKindIndex(GLenum source, GLenum type, GLenum severity)
+    {
+        // The sources and the first six types are consecutive enums, as are
+        // GL_DEBUG_TYPE_MARKER to GL_DEBUG_TYPE_POP_GROUP, and GL_DEBUG_SEVERITY_HIGH to
+        // GL_DEBUG_SEVERITY_LOW.
+        size_t sourceIndex = source - GL_DEBUG_SOURCE_API;
+        size_t typeIndex   = type - GL_DEBUG_TYPE_ERROR;
+        if (typeIndex >= 6)
+        {
+            typeIndex = type - GL_DEBUG_TYPE_MARKER + 6;
+        }
+        size_t severityIndex =
+            severity == GL_DEBUG_SEVERITY_NOTIFICATION ? 3 : severity - GL_DEBUG_SEVERITY_HIGH;
+        if (sourceIndex >= kSourceCount || typeIndex >= kTypeCount ||
+            severityIndex >= kSeverityCount)
+        {
+            return kMessageKindCount - 1;
+        }
+        return (sourceIndex * kTypeCount + typeIndex) * kSeverityCount + severityIndex;
+    }
+
     struct Message
     {
         GLenum source;
@@ -137,6 +183,16 @@ class Debug : angle::NonCopyable
     GLuint mMaxLoggedMessages;
     bool mOutputSynchronous;
     std::vector<Group> mGroups;
+
+    // The message kinds that are enabled for at least one id, updated whenever the controls or
+    // the output state change.  If any control lists ids, the enabled kinds still need the full
+    // isMessageEnabled() check.
+    angle::BitSetArray<kMessageKindCount> mEnabledMessageKinds;
+    bool mHasIdControls;
+
+    // Ring buffer of the messages waiting for asynchronous delivery to the callback.
+    bool mAsyncCallbackDelivery;
+    mutable angle::FixedQueue<Message> mPendingCallbackMessages;
 };
 }  // namespace gl
 
@@ -201,7 +257,8 @@ ANGLE_INLINE bool PerfCounterBelowMaxRepeat(std::atomic<uint32_t> *counter, bool
     {                                                                         \
         static std::atomic<uint32_t> sRepeatCount = 0;                        \
         bool isLastRepeat                         = false;                    \
-        if (PerfCounterBelowMaxRepeat(&sRepeatCount, &isLastRepeat))          \
+        if ((debug).isPerfWarningEnabled(severity) &&                         \
+            PerfCounterBelowMaxRepeat(&sRepeatCount, &isLastRepeat))          \
         {                                                                     \
             char ANGLE_MESSAGE[200];                                          \
             snprintf(ANGLE_MESSAGE, sizeof(ANGLE_MESSAGE), __VA_ARGS__);      \
@@ -113,5 +113,33 @@ TEST_F(DecompressTest, CorruptedLastDWord)
     EXPECT_TRUE(checkUncompressedData());
 }
 
+// Tests that blobs stored with the uncompressed codec round trip and respect the size limit.
+TEST_F(DecompressTest, UncompressedCodec)
+{
+    MemoryBuffer storedData;
+    ASSERT_TRUE(
+        CompressBlob(mTestData.size(), mTestData.data(), &storedData, BlobCodec::Uncompressed));
+
+    EXPECT_TRUE(DecompressBlob(storedData.data(), storedData.size(), mTestData.size(),
+                               &mUncompressedData));
+    EXPECT_TRUE(checkUncompressedData());
+
+    EXPECT_FALSE(DecompressBlob(storedData.data(), storedData.size(), mTestData.size() - 1,
+                                &mUncompressedData));
+}
+
+// Tests expected failure if an uncompressed blob is truncated.
+TEST_F(DecompressTest, UncompressedCodecPartialData)
+{
+    constexpr size_t kMaxUncompressedDataSize = std::numeric_limits<size_t>::max();
+
+    MemoryBuffer storedData;
+    ASSERT_TRUE(
+        CompressBlob(mTestData.size(), mTestData.data(), &storedData, BlobCodec::Uncompressed));
+
+    EXPECT_FALSE(DecompressBlob(storedData.data(), storedData.size() - 1, kMaxUncompressedDataSize,
+                                &mUncompressedData));
+}
+
 }  // anonymous namespace
 }  // namespace angle
@@ -2267,6 +2267,9 @@ void Display::initDisplayExtensions()
     // EGL_ANGLE_memory_usage_report is implemented on front end.
     mDisplayExtensions.memoryUsageReportANGLE = true;
 
+    // EGL_ANGLE_memory_pressure is implemented on front end, with backend hooks.
+    mDisplayExtensions.memoryPressureANGLE = true;
+
     mDisplayExtensionString = GenerateExtensionsString(mDisplayExtensions);
 }
 
@@ -2381,6 +2384,16 @@ void Display::initializeFrontendFeatures()
     // Reject shaders with undefined behavior.  In the compiler, this only applies to WebGL.
     ANGLE_FEATURE_CONDITION(&mFrontendFeatures, rejectWebglShadersWithUndefinedBehavior, true);
 
+    // Inflating many program binaries shows up at application startup; opt-in for now as the
+    // binaries take several times more cache space.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, uncompressedProgramCache, false);
+
+    // Applications may expect the blob cache callbacks to be called during the link.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, cacheProgramsAsynchronously, false);
+
+    // Avoids warming up pipelines of programs that are linked but never used.
+    ANGLE_FEATURE_CONDITION(&mFrontendFeatures, deferPostLinkTasksUntilUse, false);
+
     mImplementation->initializeFrontendFeatures(&mFrontendFeatures);
 }
 
@@ -2539,6 +2552,28 @@ EGLint Display::programCacheResize(EGLint limit, EGLenum mode)
     }
 }
 
+Error Display::handleMemoryPressure(gl::Context *context, EGLint level)
+{
+    const gl::MemoryPressureLevel pressureLevel = level == EGL_MEMORY_PRESSURE_CRITICAL_ANGLE
+                                                      ? gl::MemoryPressureLevel::Critical
+                                                      : gl::MemoryPressureLevel::Moderate;
+
+    // The program and shader caches share the blob cache, which is halved under moderate pressure
+    // and emptied under critical pressure.  size() waits for the pending puts.
+    const size_t blobCacheLimit =
+        pressureLevel == gl::MemoryPressureLevel::Critical ? 0 : mMemoryProgramCache.size() / 2;
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCache.getMutex());
+        mBlobCache.trim(blobCacheLimit);
+    }
+
+    if (context != nullptr)
+    {
+        ANGLE_TRY(context->handleMemoryPressure(pressureLevel));
+    }
+    return NoError();
+}
+
 void Display::overrideFrontendFeatures(const std::vector<std::string> &featureNames, bool enabled)
 {
     mFrontendFeatures.overrideFeatures(featureNames, enabled);
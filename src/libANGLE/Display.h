@@ -264,6 +264,10 @@ class Display final : public LabeledObject,
                                EGLint binarysize);
     EGLint programCacheResize(EGLint limit, EGLenum mode);
 
+    // EGL_ANGLE_memory_pressure.  Trims the display's caches, and releases the cached memory of
+    // |context| if not null.
+    Error handleMemoryPressure(gl::Context *context, EGLint level);
+
     const AttributeMap &getAttributeMap() const { return mAttributeMap; }
     EGLNativeDisplayType getNativeDisplayId() const { return mState.displayId; }
 
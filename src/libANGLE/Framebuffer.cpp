@@ -2191,11 +2191,16 @@ void Framebuffer::onSubjectStateChange(angle::SubjectIndex index, angle::Subject
 {
     if (message != angle::SubjectMessage::SubjectChanged)
     {
-        // This can be triggered by SubImage calls for Textures.
+        // This can be triggered by SubImage calls for Textures.  Once the dirty bit is set, the
+        // context has already been notified until the next syncState, so repeated calls are
+        // coalesced.
         if (message == angle::SubjectMessage::ContentsChanged)
         {
-            mDirtyBits.set(DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index);
-            onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
+            if (!mDirtyBits.test(DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index))
+            {
+                mDirtyBits.set(DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index);
+                onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
+            }
             return;
         }
 
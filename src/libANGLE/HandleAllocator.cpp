@@ -11,12 +11,18 @@
 
 #include <algorithm>
 #include <functional>
+#include <iterator>
 #include <limits>
 
 #include "common/debug.h"
+#include "common/mathutil.h"
 
 namespace gl
 {
+namespace
+{
+constexpr size_t kBitsPerWord = 64;
+}  // anonymous namespace
 
 struct HandleAllocator::HandleRangeComparator
 {
@@ -27,13 +33,20 @@ HandleAllocator::HandleAllocator()
     : mBaseValue(1),
       mNextValue(1),
       mMaxValue(std::numeric_limits<GLuint>::max()),
+      mReleasedBitmapCount(0),
+      mReleasedBitmapFirstSummaryWord(0),
       mLoggingEnabled(false)
 {
     mUnallocatedList.push_back(HandleRange(1, mMaxValue));
 }
 
 HandleAllocator::HandleAllocator(GLuint maximumHandleValue)
-    : mBaseValue(1), mNextValue(1), mMaxValue(maximumHandleValue), mLoggingEnabled(false)
+    : mBaseValue(1),
+      mNextValue(1),
+      mMaxValue(maximumHandleValue),
+      mReleasedBitmapCount(0),
+      mReleasedBitmapFirstSummaryWord(0),
+      mLoggingEnabled(false)
 {
     mUnallocatedList.push_back(HandleRange(1, mMaxValue));
 }
@@ -47,16 +60,103 @@ void HandleAllocator::setBaseHandle(GLuint value)
     mNextValue = value;
 }
 
-GLuint HandleAllocator::allocate()
+void HandleAllocator::addReleasedHandle(GLuint handle)
+{
+    if (handle >= kReleasedBitmapHandleCount)
+    {
+        // Logarithmic time for push_heap.
+        mReleasedList.push_back(handle);
+        std::push_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+        return;
+    }
+
+    const size_t word        = handle / kBitsPerWord;
+    const size_t summaryWord = word / kBitsPerWord;
+    if (word >= mReleasedBitmap.size())
+    {
+        mReleasedBitmap.resize(word + 1, 0);
+        mReleasedBitmapSummary.resize(summaryWord + 1, 0);
+    }
+
+    const uint64_t bit = uint64_t(1) << (handle % kBitsPerWord);
+    ASSERT((mReleasedBitmap[word] & bit) == 0);
+    mReleasedBitmap[word] |= bit;
+    mReleasedBitmapSummary[summaryWord] |= uint64_t(1) << (word % kBitsPerWord);
+    mReleasedBitmapFirstSummaryWord = std::min(mReleasedBitmapFirstSummaryWord, summaryWord);
+    ++mReleasedBitmapCount;
+}
+
+bool HandleAllocator::removeReleasedHandle(GLuint handle)
 {
-    ASSERT(!mUnallocatedList.empty() || !mReleasedList.empty());
+    if (handle >= kReleasedBitmapHandleCount)
+    {
+        // Might be a slow operation.
+        auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
+        if (releasedIt == mReleasedList.end())
+        {
+            return false;
+        }
+        mReleasedList.erase(releasedIt);
+        std::make_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+        return true;
+    }
+
+    const size_t word  = handle / kBitsPerWord;
+    const uint64_t bit = uint64_t(1) << (handle % kBitsPerWord);
+    if (word >= mReleasedBitmap.size() || (mReleasedBitmap[word] & bit) == 0)
+    {
+        return false;
+    }
+
+    mReleasedBitmap[word] &= ~bit;
+    if (mReleasedBitmap[word] == 0)
+    {
+        mReleasedBitmapSummary[word / kBitsPerWord] &= ~(uint64_t(1) << (word % kBitsPerWord));
+    }
+    --mReleasedBitmapCount;
+    return true;
+}
 
-    // Allocate from released list, logarithmic time for pop_heap.
-    if (!mReleasedList.empty())
+GLuint HandleAllocator::allocateReleasedHandle()
+{
+    if (mReleasedBitmapCount == 0)
     {
+        // Logarithmic time for pop_heap.
+        ASSERT(!mReleasedList.empty());
         std::pop_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
-        GLuint reusedHandle = mReleasedList.back();
+        GLuint handle = mReleasedList.back();
         mReleasedList.pop_back();
+        return handle;
+    }
+
+    // The bitmap handles are all lower than the ones in the heap, so the lowest one is reused
+    // first.  Constant amortized time, as the summary words skipped here are only revisited once
+    // a lower handle is released again.
+    while (mReleasedBitmapSummary[mReleasedBitmapFirstSummaryWord] == 0)
+    {
+        ++mReleasedBitmapFirstSummaryWord;
+        ASSERT(mReleasedBitmapFirstSummaryWord < mReleasedBitmapSummary.size());
+    }
+
+    const size_t summaryWord = mReleasedBitmapFirstSummaryWord;
+    const size_t word =
+        summaryWord * kBitsPerWord + gl::ScanForward(mReleasedBitmapSummary[summaryWord]);
+    const GLuint handle =
+        static_cast<GLuint>(word * kBitsPerWord + gl::ScanForward(mReleasedBitmap[word]));
+
+    const bool removed = removeReleasedHandle(handle);
+    ASSERT(removed);
+    return handle;
+}
+
+GLuint HandleAllocator::allocate()
+{
+    ASSERT(anyHandleAvailableForAllocation());
+
+    // Allocate from the released handles.
+    if (mReleasedBitmapCount > 0 || !mReleasedList.empty())
+    {
+        GLuint reusedHandle = allocateReleasedHandle();
 
         if (mLoggingEnabled)
         {
@@ -96,25 +196,35 @@ void HandleAllocator::release(GLuint handle)
         WARN() << "HandleAllocator::release releasing " << handle << std::endl;
     }
 
-    // Try consolidating the ranges first.
-    for (HandleRange &handleRange : mUnallocatedList)
+    // Try consolidating the ranges first.  The ranges are sorted, so only the ranges right after
+    // and right before the handle can be adjacent to it.
+    auto nextIt = std::lower_bound(mUnallocatedList.begin(), mUnallocatedList.end(), handle,
+                                   HandleRangeComparator());
+    ASSERT(nextIt == mUnallocatedList.end() || nextIt->begin > handle);
+
+    if (nextIt != mUnallocatedList.begin() && std::prev(nextIt)->end == handle - 1)
     {
-        if (handleRange.begin - 1 == handle)
+        auto prevIt = std::prev(nextIt);
+        if (nextIt != mUnallocatedList.end() && nextIt->begin - 1 == handle)
         {
-            handleRange.begin--;
-            return;
+            // The handle fills the gap between the two ranges.
+            prevIt->end = nextIt->end;
+            mUnallocatedList.erase(nextIt);
         }
-
-        if (handleRange.end == handle - 1)
+        else
         {
-            handleRange.end++;
-            return;
+            prevIt->end++;
         }
+        return;
     }
 
-    // Add to released list, logarithmic time for push_heap.
-    mReleasedList.push_back(handle);
-    std::push_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
+    if (nextIt != mUnallocatedList.end() && nextIt->begin - 1 == handle)
+    {
+        nextIt->begin--;
+        return;
+    }
+
+    addReleasedHandle(handle);
 }
 
 void HandleAllocator::reserve(GLuint handle)
@@ -124,16 +234,10 @@ void HandleAllocator::reserve(GLuint handle)
         WARN() << "HandleAllocator::reserve reserving " << handle << std::endl;
     }
 
-    // Clear from released list -- might be a slow operation.
-    if (!mReleasedList.empty())
+    // Clear from the released handles.
+    if (removeReleasedHandle(handle))
     {
-        auto releasedIt = std::find(mReleasedList.begin(), mReleasedList.end(), handle);
-        if (releasedIt != mReleasedList.end())
-        {
-            mReleasedList.erase(releasedIt);
-            std::make_heap(mReleasedList.begin(), mReleasedList.end(), std::greater<GLuint>());
-            return;
-        }
+        return;
     }
 
     // Not in released list, reserve in the unallocated list.
@@ -175,6 +279,10 @@ void HandleAllocator::reset()
 {
     mUnallocatedList.clear();
     mUnallocatedList.push_back(HandleRange(1, mMaxValue));
+    mReleasedBitmap.clear();
+    mReleasedBitmapSummary.clear();
+    mReleasedBitmapCount            = 0;
+    mReleasedBitmapFirstSummaryWord = 0;
     mReleasedList.clear();
     mBaseValue = 1;
     mNextValue = 1;
@@ -182,7 +290,7 @@ void HandleAllocator::reset()
 
 bool HandleAllocator::anyHandleAvailableForAllocation() const
 {
-    return !mUnallocatedList.empty() || !mReleasedList.empty();
+    return !mUnallocatedList.empty() || mReleasedBitmapCount > 0 || !mReleasedList.empty();
 }
 
 void HandleAllocator::enableLogging(bool enabled)
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_HANDLEALLOCATOR_H_
 #define LIBANGLE_HANDLEALLOCATOR_H_
 
+#include <vector>
+
 #include "common/angleutils.h"
 
 #include "angle_gl.h"
@@ -38,6 +40,10 @@ class HandleAllocator final : angle::NonCopyable
     void enableLogging(bool enabled);
 
   private:
+    void addReleasedHandle(GLuint handle);
+    bool removeReleasedHandle(GLuint handle);
+    GLuint allocateReleasedHandle();
+
     GLuint mBaseValue;
     GLuint mNextValue;
     const GLuint mMaxValue;
@@ -55,8 +61,19 @@ class HandleAllocator final : angle::NonCopyable
 
     // The freelist consists of never-allocated handles, stored
     // as ranges, and handles that were previously allocated and
-    // released, stored in a heap.
+    // released.
     std::vector<HandleRange> mUnallocatedList;
+
+    // Released handles below kReleasedBitmapHandleCount are stored in a bitmap, with a summary bit
+    // per non-zero bitmap word, so the lowest one is found without a heap.  Released handles above
+    // that, which can only come from reserved handles, are stored in a heap.
+    static constexpr GLuint kReleasedBitmapHandleCount = 1u << 20;
+    std::vector<uint64_t> mReleasedBitmap;
+    std::vector<uint64_t> mReleasedBitmapSummary;
+    // The number of handles in the bitmap.
+    size_t mReleasedBitmapCount;
+    // All summary words before this one are zero.
+    size_t mReleasedBitmapFirstSummaryWord;
     std::vector<GLuint> mReleasedList;
 
     bool mLoggingEnabled;
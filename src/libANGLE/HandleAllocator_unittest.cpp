@@ -6,6 +6,7 @@
 // Unit tests for HandleAllocator.
 //
 
+#include <set>
 #include <unordered_set>
 
 #include "gmock/gmock.h"
@@ -243,4 +244,83 @@ TEST(HandleAllocatorTest, ConsolidateRangeDuringRelease)
     EXPECT_NE(handle, static_cast<GLuint>(-1));
 }
 
+// Tests that released handles are reused lowest first.
+TEST(HandleAllocatorTest, ReleasedHandlesReusedInOrder)
+{
+    gl::HandleAllocator allocator;
+
+    constexpr GLuint kHandleCount = 1000;
+    for (GLuint handle = 1; handle <= kHandleCount; ++handle)
+    {
+        EXPECT_EQ(handle, allocator.allocate());
+    }
+
+    // A reserved handle far from the others returns to the unallocated range when released.
+    constexpr GLuint kLargeHandle = 0x7FFFFFFF;
+    allocator.reserve(kLargeHandle);
+
+    allocator.release(kLargeHandle);
+    allocator.release(700);
+    allocator.release(3);
+    allocator.release(130);
+    allocator.release(64);
+
+    EXPECT_EQ(3u, allocator.allocate());
+    EXPECT_EQ(64u, allocator.allocate());
+    EXPECT_EQ(130u, allocator.allocate());
+    EXPECT_EQ(700u, allocator.allocate());
+    EXPECT_EQ(kHandleCount + 1, allocator.allocate());
+}
+
+// Tests that a released handle can be reserved again and is then not handed out.
+TEST(HandleAllocatorTest, ReserveReleasedHandle)
+{
+    gl::HandleAllocator allocator;
+
+    for (GLuint handle = 1; handle <= 200; ++handle)
+    {
+        allocator.allocate();
+    }
+
+    allocator.release(10);
+    allocator.release(100);
+    allocator.reserve(10);
+
+    EXPECT_EQ(100u, allocator.allocate());
+    EXPECT_EQ(201u, allocator.allocate());
+}
+
+// Tests many interleaved releases and allocations against a reference set.
+TEST(HandleAllocatorTest, ManyReleasesAndAllocations)
+{
+    gl::HandleAllocator allocator;
+
+    constexpr GLuint kHandleCount = 5000;
+    for (GLuint handle = 1; handle <= kHandleCount; ++handle)
+    {
+        allocator.allocate();
+    }
+
+    std::set<GLuint> released;
+    for (GLuint handle = 7; handle <= kHandleCount; handle += 7)
+    {
+        allocator.release(handle);
+        released.insert(handle);
+    }
+    for (GLuint handle = kHandleCount; handle > 11; handle -= 11)
+    {
+        if (handle % 7 != 0)
+        {
+            allocator.release(handle);
+            released.insert(handle);
+        }
+    }
+
+    for (GLuint expected : released)
+    {
+        EXPECT_EQ(expected, allocator.allocate());
+    }
+    EXPECT_EQ(kHandleCount + 1, allocator.allocate());
+}
+
 }  // anonymous namespace
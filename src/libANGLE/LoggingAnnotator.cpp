@@ -23,17 +23,17 @@ void LoggingAnnotator::beginEvent(gl::Context *context,
                                   const char *eventName,
                                   const char *eventMessage)
 {
-    ANGLE_TRACE_EVENT_BEGIN0("gpu.angle", eventName);
+    ANGLE_TRACE_EVENT_COPY_BEGIN("gpu.angle", eventName);
 }
 
 void LoggingAnnotator::endEvent(gl::Context *context, const char *eventName, EntryPoint entryPoint)
 {
-    ANGLE_TRACE_EVENT_END0("gpu.angle", eventName);
+    ANGLE_TRACE_EVENT_COPY_END("gpu.angle", eventName);
 }
 
 void LoggingAnnotator::setMarker(gl::Context *context, const char *markerName)
 {
-    ANGLE_TRACE_EVENT_INSTANT0("gpu.angle", markerName);
+    ANGLE_TRACE_EVENT_COPY_INSTANT("gpu.angle", markerName);
 }
 
 void LoggingAnnotator::logMessage(const gl::LogMessage &msg) const
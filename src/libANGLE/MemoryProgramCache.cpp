@@ -16,11 +16,14 @@
 #include <GLSLANG/ShaderVars.h>
 #include <anglebase/sha1.h>
 
+#include <algorithm>
+
 #include "common/BinaryStream.h"
 #include "common/angle_version_info.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Debug.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/capture/FrameCapture.h"
 #include "libANGLE/histogram_macros.h"
@@ -58,9 +61,40 @@ void WriteProgramAliasedBindings(BinaryOutputStream *stream, const ProgramAliase
 
 }  // anonymous namespace
 
+// Compresses a serialized program and inserts it in the cache.  Only used when the context has no
+// blob cache callbacks of its own, as those can't be called without the context.
+class MemoryProgramCache::PutProgramTask final : public angle::Closure
+{
+  public:
+    PutProgramTask(MemoryProgramCache *cache,
+                   const egl::BlobCache::Key &programHash,
+                   angle::MemoryBuffer &&serializedProgram,
+                   angle::BlobCodec codec)
+        : mCache(cache),
+          mProgramHash(programHash),
+          mSerializedProgram(std::move(serializedProgram)),
+          mCodec(codec)
+    {}
+    ~PutProgramTask() override = default;
+
+    void operator()() override
+    {
+        mCache->compressAndPutProgram(nullptr, mProgramHash, mSerializedProgram, mCodec);
+    }
+
+  private:
+    MemoryProgramCache *mCache;
+    egl::BlobCache::Key mProgramHash;
+    angle::MemoryBuffer mSerializedProgram;
+    angle::BlobCodec mCodec;
+};
+
 MemoryProgramCache::MemoryProgramCache(egl::BlobCache &blobCache) : mBlobCache(blobCache) {}
 
-MemoryProgramCache::~MemoryProgramCache() {}
+MemoryProgramCache::~MemoryProgramCache()
+{
+    waitForPendingPuts();
+}
 
 void MemoryProgramCache::ComputeHash(const Context *context,
                                      const Program *program,
@@ -87,6 +121,9 @@ void MemoryProgramCache::ComputeHash(const Context *context,
     hashStream.writeInt(context->getClientMajorVersion());
     hashStream.writeInt(context->getClientMinorVersion());
     hashStream.writeString(reinterpret_cast<const char *>(context->getString(GL_RENDERER)));
+    // GL_RENDERER may not include the full driver version (e.g. for WebGL), but backends such as
+    // GL cache the driver's own binary, which a different driver is not guaranteed to reject.
+    hashStream.writeString(context->getDisplay()->getBackendVersionString(true));
 
     // Hash pre-link program properties.
     WriteProgramBindings(&hashStream, program->getAttributeBindings());
@@ -108,6 +145,17 @@ void MemoryProgramCache::ComputeHash(const Context *context,
     angle::base::SHA1HashBytes(programKey.data(), programKey.size(), hashOut->data());
 }
 
+// static
+void MemoryProgramCache::ComputeHashForBinary(const void *binary,
+                                              size_t length,
+                                              egl::BlobCache::Key *hashOut)
+{
+    // The binary embeds the ANGLE version and is validated on load, so it identifies the program
+    // by itself.
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(binary), length,
+                               hashOut->data());
+}
+
 angle::Result MemoryProgramCache::getProgram(const Context *context,
                                              Program *program,
                                              egl::BlobCache::Key *hashOut,
@@ -122,9 +170,36 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
     }
 
     ComputeHash(context, program, hashOut);
+    return loadProgram(context, program, *hashOut, resultOut);
+}
+
+angle::Result MemoryProgramCache::getProgramForBinary(const Context *context,
+                                                      Program *program,
+                                                      const void *binary,
+                                                      size_t length,
+                                                      egl::BlobCache::Key *hashOut,
+                                                      egl::CacheGetResult *resultOut)
+{
+    *resultOut = egl::CacheGetResult::NotFound;
+
+    if (!mBlobCache.isCachingEnabled(context))
+    {
+        return angle::Result::Continue;
+    }
+
+    ComputeHashForBinary(binary, length, hashOut);
+    return loadProgram(context, program, *hashOut, resultOut);
+}
+
+angle::Result MemoryProgramCache::loadProgram(const Context *context,
+                                              Program *program,
+                                              const egl::BlobCache::Key &programHash,
+                                              egl::CacheGetResult *resultOut)
+{
+    waitForPendingPuts();
 
     angle::MemoryBuffer uncompressedData;
-    switch (mBlobCache.getAndDecompress(context, context->getScratchBuffer(), *hashOut,
+    switch (mBlobCache.getAndDecompress(context, context->getScratchBuffer(), programHash,
                                         kMaxUncompressedProgramSize, &uncompressedData))
     {
         case egl::BlobCache::GetAndDecompressResult::NotFound:
@@ -133,7 +208,7 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
         case egl::BlobCache::GetAndDecompressResult::DecompressFailure:
             ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                                "Error decompressing program binary data fetched from cache.");
-            remove(*hashOut);
+            remove(programHash);
             // Consider this blob "not found".  As far as the rest of the code is considered,
             // corrupted cache might as well not have existed.
             return angle::Result::Continue;
@@ -150,7 +225,7 @@ angle::Result MemoryProgramCache::getProgram(const Context *context,
             {
                 ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                                    "Failed to load program binary from cache.");
-                remove(*hashOut);
+                remove(programHash);
             }
 
             return angle::Result::Continue;
@@ -164,11 +239,13 @@ bool MemoryProgramCache::getAt(size_t index,
                                const egl::BlobCache::Key **hashOut,
                                egl::BlobCache::Value *programOut)
 {
+    waitForPendingPuts();
     return mBlobCache.getAt(index, hashOut, programOut);
 }
 
 void MemoryProgramCache::remove(const egl::BlobCache::Key &programHash)
 {
+    waitForPendingPuts();
     mBlobCache.remove(programHash);
 }
 
@@ -185,12 +262,59 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     ANGLE_TRY(program->serialize(context));
     const angle::MemoryBuffer &serializedProgram = program->getSerializedBinary();
 
-    angle::MemoryBuffer compressedData;
-    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData))
+    const angle::BlobCodec codec = context->getFrontendFeatures().uncompressedProgramCache.enabled
+                                       ? angle::BlobCodec::Uncompressed
+                                       : angle::BlobCodec::Gzip;
+
+    if (context->getFrontendFeatures().cacheProgramsAsynchronously.enabled &&
+        !context->areBlobCacheFuncsSet())
+    {
+        // The program's binary is dropped after this call, so the task works from a copy.
+        angle::MemoryBuffer programCopy;
+        if (!programCopy.resize(serializedProgram.size()))
+        {
+            ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
+                               "Failed to allocate memory to cache a program.");
+            return angle::Result::Continue;
+        }
+        memcpy(programCopy.data(), serializedProgram.data(), serializedProgram.size());
+
+        std::shared_ptr<angle::WaitableEvent> event =
+            context->getWorkerThreadPool()->postWorkerTask(
+                std::make_shared<PutProgramTask>(this, programHash, std::move(programCopy), codec),
+                angle::WorkerTaskPriority::Idle);
+        if (event)
+        {
+            std::lock_guard<angle::SimpleMutex> lock(mPendingPutsMutex);
+            // Forget about the puts that are already done.
+            mPendingPuts.erase(std::remove_if(mPendingPuts.begin(), mPendingPuts.end(),
+                                              [](const std::shared_ptr<angle::WaitableEvent> &e) {
+                                                  return e->isReady();
+                                              }),
+                               mPendingPuts.end());
+            mPendingPuts.push_back(std::move(event));
+            return angle::Result::Continue;
+        }
+    }
+
+    if (!compressAndPutProgram(context, programHash, serializedProgram, codec))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing binary data.");
-        return angle::Result::Continue;
+    }
+    return angle::Result::Continue;
+}
+
+bool MemoryProgramCache::compressAndPutProgram(const Context *context,
+                                               const egl::BlobCache::Key &programHash,
+                                               const angle::MemoryBuffer &serializedProgram,
+                                               angle::BlobCodec codec)
+{
+    angle::MemoryBuffer compressedData;
+    if (!angle::CompressBlob(serializedProgram.size(), serializedProgram.data(), &compressedData,
+                             codec))
+    {
+        return false;
     }
 
     {
@@ -204,13 +328,27 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     }
 
     mBlobCache.put(context, programHash, std::move(compressedData));
-    return angle::Result::Continue;
+    return true;
+}
+
+void MemoryProgramCache::waitForPendingPuts() const
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> pendingPuts;
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mPendingPutsMutex);
+        pendingPuts.swap(mPendingPuts);
+    }
+    angle::WaitableEvent::WaitMany(&pendingPuts);
 }
 
 angle::Result MemoryProgramCache::updateProgram(const Context *context, Program *program)
 {
-    egl::BlobCache::Key programHash;
-    ComputeHash(context, program, &programHash);
+    // A zero hash means the program was not cached when it was linked or loaded.
+    const egl::BlobCache::Key &programHash = program->getProgramHash();
+    if (programHash == egl::BlobCache::Key{})
+    {
+        return angle::Result::Continue;
+    }
     return putProgram(programHash, context, program);
 }
 
@@ -234,26 +372,31 @@ bool MemoryProgramCache::putBinary(const egl::BlobCache::Key &programHash,
 
 void MemoryProgramCache::clear()
 {
+    waitForPendingPuts();
     mBlobCache.clear();
 }
 
 void MemoryProgramCache::resize(size_t maxCacheSizeBytes)
 {
+    waitForPendingPuts();
     mBlobCache.resize(maxCacheSizeBytes);
 }
 
 size_t MemoryProgramCache::entryCount() const
 {
+    waitForPendingPuts();
     return mBlobCache.entryCount();
 }
 
 size_t MemoryProgramCache::trim(size_t limit)
 {
+    waitForPendingPuts();
     return mBlobCache.trim(limit);
 }
 
 size_t MemoryProgramCache::size() const
 {
+    waitForPendingPuts();
     return mBlobCache.size();
 }
 
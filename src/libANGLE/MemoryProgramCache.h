@@ -11,8 +11,12 @@
 #define LIBANGLE_MEMORY_PROGRAM_CACHE_H_
 
 #include <array>
+#include <memory>
+#include <vector>
 
 #include "common/MemoryBuffer.h"
+#include "common/SimpleMutex.h"
+#include "common/WorkerThread.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/Error.h"
 
@@ -32,6 +36,12 @@ class MemoryProgramCache final : angle::NonCopyable
                             const Program *program,
                             egl::BlobCache::Key *hashOut);
 
+    // Programs loaded through glProgramBinary have no shader sources to hash, so they are cached
+    // under a hash of the binary provided by the application.
+    static void ComputeHashForBinary(const void *binary,
+                                     size_t length,
+                                     egl::BlobCache::Key *hashOut);
+
     // For querying the contents of the cache.
     bool getAt(size_t index,
                const egl::BlobCache::Key **hashOut,
@@ -40,12 +50,14 @@ class MemoryProgramCache final : angle::NonCopyable
     // Evict a program from the binary cache.
     void remove(const egl::BlobCache::Key &programHash);
 
-    // Helper method that serializes a program.
+    // Helper method that serializes a program.  With the cacheProgramsAsynchronously feature, the
+    // serialized program is compressed and inserted in the cache by a worker thread.
     angle::Result putProgram(const egl::BlobCache::Key &programHash,
                              const Context *context,
                              Program *program);
 
-    // Same as putProgram but computes the hash.
+    // Same as putProgram but uses the hash the program was linked or loaded with.  Used to write
+    // back a program whose binary has changed after link, e.g. with new shader variants.
     angle::Result updateProgram(const Context *context, Program *program);
 
     // Store a binary directly.  TODO(syoussefi): deprecated.  Will be removed once Chrome supports
@@ -61,6 +73,15 @@ class MemoryProgramCache final : angle::NonCopyable
                              egl::BlobCache::Key *hashOut,
                              egl::CacheGetResult *resultOut);
 
+    // Same as getProgram, but for a program being loaded through glProgramBinary.  If the
+    // program was previously updated in the cache, the updated binary is loaded instead.
+    angle::Result getProgramForBinary(const Context *context,
+                                      Program *program,
+                                      const void *binary,
+                                      size_t length,
+                                      egl::BlobCache::Key *hashOut,
+                                      egl::CacheGetResult *resultOut);
+
     // Empty the cache.
     void clear();
 
@@ -80,7 +101,26 @@ class MemoryProgramCache final : angle::NonCopyable
     size_t maxSize() const;
 
   private:
+    class PutProgramTask;
+
+    angle::Result loadProgram(const Context *context,
+                              Program *program,
+                              const egl::BlobCache::Key &programHash,
+                              egl::CacheGetResult *resultOut);
+
+    // |context| may be null when called from a worker thread.
+    bool compressAndPutProgram(const Context *context,
+                               const egl::BlobCache::Key &programHash,
+                               const angle::MemoryBuffer &serializedProgram,
+                               angle::BlobCodec codec);
+
+    // Makes programs that are being put asynchronously visible in the cache.
+    void waitForPendingPuts() const;
+
     egl::BlobCache &mBlobCache;
+
+    mutable angle::SimpleMutex mPendingPutsMutex;
+    mutable std::vector<std::shared_ptr<angle::WaitableEvent>> mPendingPuts;
 };
 
 }  // namespace gl
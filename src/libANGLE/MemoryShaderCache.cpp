@@ -94,9 +94,13 @@ angle::Result MemoryShaderCache::putShader(const Context *context,
     angle::MemoryBuffer serializedShader;
     ANGLE_TRY(shader->serialize(nullptr, &serializedShader));
 
+    const angle::BlobCodec codec = context->getFrontendFeatures().uncompressedProgramCache.enabled
+                                       ? angle::BlobCodec::Uncompressed
+                                       : angle::BlobCodec::Gzip;
+
     size_t compressedSize;
     if (!mBlobCache.compressAndPut(context, shaderHash, std::move(serializedShader),
-                                   &compressedSize))
+                                   &compressedSize, codec))
     {
         ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                            "Error compressing shader binary data for insertion into cache.");
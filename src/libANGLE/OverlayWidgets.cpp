@@ -349,6 +349,34 @@ void AppendWidgetDataHelper::AppendFPS(const overlay::Widget *widget,
     AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
 }
 
+void AppendWidgetDataHelper::AppendEntryPointTimings(const overlay::Widget *widget,
+                                                     const gl::Extents &imageExtent,
+                                                     TextWidgetData *textWidget,
+                                                     GraphWidgetData *graphWidget,
+                                                     OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Text *entryPointTimings = static_cast<const overlay::Text *>(widget);
+    std::ostringstream text;
+    text << "Slowest calls (p99): ";
+    OutputText(text, entryPointTimings);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
+void AppendWidgetDataHelper::AppendVulkanGpuPassTimeline(const overlay::Widget *widget,
+                                                         const gl::Extents &imageExtent,
+                                                         TextWidgetData *textWidget,
+                                                         GraphWidgetData *graphWidget,
+                                                         OverlayWidgetCounts *widgetCounts)
+{
+    const overlay::Text *gpuPassTimeline = static_cast<const overlay::Text *>(widget);
+    std::ostringstream text;
+    text << "GPU passes: ";
+    OutputText(text, gpuPassTimeline);
+
+    AppendTextCommon(widget, imageExtent, text.str(), textWidget, widgetCounts);
+}
+
 void AppendWidgetDataHelper::AppendVulkanLastValidationMessage(const overlay::Widget *widget,
                                                                const gl::Extents &imageExtent,
                                                                TextWidgetData *textWidget,
@@ -517,6 +545,22 @@ void AppendWidgetDataHelper::AppendVulkanDescriptorCacheSize(const overlay::Widg
     AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
 }
 
+void AppendWidgetDataHelper::AppendVulkanDescriptorCacheEvictions(
+    const overlay::Widget *widget,
+    const gl::Extents &imageExtent,
+    TextWidgetData *textWidget,
+    GraphWidgetData *graphWidget,
+    OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](uint64_t curValue, uint64_t maxValue) {
+        std::ostringstream text;
+        text << "Descriptor Cache Evictions (Max: " << maxValue << ")";
+        return text.str();
+    };
+
+    AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
+}
+
 void AppendWidgetDataHelper::AppendVulkanDescriptorCacheKeySize(const overlay::Widget *widget,
                                                                 const gl::Extents &imageExtent,
                                                                 TextWidgetData *textWidget,
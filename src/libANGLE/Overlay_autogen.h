@@ -14,6 +14,10 @@ enum class WidgetId
 {
     // Frames per second (Count/Second).
     FPS,
+    // Slowest entry points by 99th percentile CPU time (Text).
+    EntryPointTimings,
+    // GPU time per render pass and internal dispatch (Text).
+    VulkanGpuPassTimeline,
     // Last validation error (Text).
     VulkanLastValidationMessage,
     // Number of validation errors and warnings (Count).
@@ -36,6 +40,8 @@ enum class WidgetId
     VulkanTextureDescriptorCacheSize,
     // Number of cached default uniform descriptor sets
     VulkanUniformDescriptorCacheSize,
+    // Number of descriptor sets evicted from the descriptor set caches
+    VulkanDescriptorCacheEvictions,
     // Total size of all keys in the descriptor set caches
     VulkanDescriptorCacheKeySize,
     // Number of times the Vulkan backend attempted to submit commands
@@ -58,6 +64,8 @@ enum class WidgetId
 // We can use this "X" macro to generate multiple code patterns.
 #define ANGLE_WIDGET_ID_X(PROC)                 \
     PROC(FPS)                                   \
+    PROC(EntryPointTimings)                     \
+    PROC(VulkanGpuPassTimeline)                 \
     PROC(VulkanLastValidationMessage)           \
     PROC(VulkanValidationMessageCount)          \
     PROC(VulkanRenderPassCount)                 \
@@ -69,6 +77,7 @@ enum class WidgetId
     PROC(VulkanDescriptorCacheSize)             \
     PROC(VulkanTextureDescriptorCacheSize)      \
     PROC(VulkanUniformDescriptorCacheSize)      \
+    PROC(VulkanDescriptorCacheEvictions)        \
     PROC(VulkanDescriptorCacheKeySize)          \
     PROC(VulkanAttemptedSubmissions)            \
     PROC(VulkanActualSubmissions)               \
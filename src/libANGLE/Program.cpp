@@ -10,6 +10,7 @@
 #include "libANGLE/Program.h"
 
 #include <algorithm>
+#include <atomic>
 #include <utility>
 
 #include "common/angle_version_info.h"
@@ -98,14 +99,68 @@ class LinkEventDone final : public LinkEvent
 
 void ScheduleSubTasks(const std::shared_ptr<angle::WorkerThreadPool> &workerThreadPool,
                       std::vector<std::shared_ptr<rx::LinkSubTask>> &tasks,
+                      angle::WorkerTaskPriority priority,
                       std::vector<std::shared_ptr<angle::WaitableEvent>> *eventsOut)
 {
     eventsOut->reserve(tasks.size());
     for (const std::shared_ptr<rx::LinkSubTask> &subTask : tasks)
     {
-        eventsOut->push_back(workerThreadPool->postWorkerTask(subTask));
+        eventsOut->push_back(workerThreadPool->postWorkerTask(subTask, priority));
     }
 }
+
+// When both link and post-link subtasks are present, the post-link subtasks depend on the results
+// of the link subtasks.  Each link subtask is run through this wrapper, and whichever finishes last
+// schedules the post-link subtasks.  This is done without blocking a worker thread, and before the
+// last link subtask's event is signaled, so the post-link events are populated by the time the link
+// is resolved.
+class LinkSubTaskThenSchedulePostLinkSubTasks final : public angle::Closure
+{
+  public:
+    struct PostLinkSubTasks
+    {
+        std::weak_ptr<angle::WorkerThreadPool> workerThreadPool;
+        std::vector<std::shared_ptr<rx::LinkSubTask>> *tasks;
+        std::vector<std::shared_ptr<angle::WaitableEvent>> *eventsOut;
+        std::atomic<size_t> pendingLinkSubTaskCount;
+    };
+
+    LinkSubTaskThenSchedulePostLinkSubTasks(const std::shared_ptr<rx::LinkSubTask> &subTask,
+                                            const std::shared_ptr<PostLinkSubTasks> &postLinkTasks)
+        : mSubTask(subTask), mPostLinkTasks(postLinkTasks)
+    {}
+    ~LinkSubTaskThenSchedulePostLinkSubTasks() override = default;
+
+    void operator()() override
+    {
+        (*mSubTask)();
+
+        if (mPostLinkTasks->pendingLinkSubTaskCount.fetch_sub(1) != 1)
+        {
+            return;
+        }
+
+        std::shared_ptr<angle::WorkerThreadPool> workerThreadPool =
+            mPostLinkTasks->workerThreadPool.lock();
+        if (workerThreadPool)
+        {
+            ScheduleSubTasks(workerThreadPool, *mPostLinkTasks->tasks,
+                             angle::WorkerTaskPriority::Background, mPostLinkTasks->eventsOut);
+            return;
+        }
+
+        // If the pool is already gone, run the post-link tasks in this thread instead.
+        for (const std::shared_ptr<rx::LinkSubTask> &task : *mPostLinkTasks->tasks)
+        {
+            (*task)();
+            mPostLinkTasks->eventsOut->push_back(std::make_shared<angle::WaitableEventDone>());
+        }
+    }
+
+  private:
+    std::shared_ptr<rx::LinkSubTask> mSubTask;
+    std::shared_ptr<PostLinkSubTasks> mPostLinkTasks;
+};
 }  // anonymous namespace
 
 const char *GetLinkMismatchErrorString(LinkMismatchError linkError)
@@ -532,9 +587,13 @@ class Program::MainLinkLoadTask : public angle::Closure
 {
   public:
     MainLinkLoadTask(const std::shared_ptr<angle::WorkerThreadPool> &subTaskWorkerPool,
+                     bool deferPostLinkSubTasks,
                      ProgramState *state,
                      std::shared_ptr<rx::LinkTask> &&linkTask)
-        : mSubTaskWorkerPool(subTaskWorkerPool), mState(*state), mLinkTask(std::move(linkTask))
+        : mSubTaskWorkerPool(subTaskWorkerPool),
+          mDeferPostLinkSubTasks(deferPostLinkSubTasks),
+          mState(*state),
+          mLinkTask(std::move(linkTask))
     {
         ASSERT(subTaskWorkerPool.get());
     }
@@ -570,18 +629,49 @@ class Program::MainLinkLoadTask : public angle::Closure
     void scheduleSubTasks(std::vector<std::shared_ptr<rx::LinkSubTask>> &&linkSubTasks,
                           std::vector<std::shared_ptr<rx::LinkSubTask>> &&postLinkSubTasks)
     {
-        // Only one of linkSubTasks or postLinkSubTasks should have tasks.  This is because
-        // currently, there is no support for ordering them.
-        ASSERT(linkSubTasks.empty() || postLinkSubTasks.empty());
-
-        // Schedule link subtasks
-        mSubTasks = std::move(linkSubTasks);
-        ScheduleSubTasks(mSubTaskWorkerPool, mSubTasks, &mSubTaskWaitableEvents);
-
-        // Schedule post-link subtasks
+        mSubTasks                             = std::move(linkSubTasks);
         mState.mExecutable->mPostLinkSubTasks = std::move(postLinkSubTasks);
-        ScheduleSubTasks(mSubTaskWorkerPool, mState.mExecutable->mPostLinkSubTasks,
-                         &mState.mExecutable->mPostLinkSubTaskWaitableEvents);
+
+        if (mDeferPostLinkSubTasks && !mState.mExecutable->mPostLinkSubTasks.empty())
+        {
+            // The post-link subtasks are scheduled once the program is first bound or their
+            // results are needed, by which time the link subtasks are done.
+            ScheduleSubTasks(mSubTaskWorkerPool, mSubTasks, angle::WorkerTaskPriority::BlockingSoon,
+                             &mSubTaskWaitableEvents);
+            mState.mExecutable->mPostLinkSubTasksDeferred    = true;
+            mState.mExecutable->mDeferredPostLinkSubTaskPool = mSubTaskWorkerPool;
+        }
+        else if (!mSubTasks.empty() && !mState.mExecutable->mPostLinkSubTasks.empty())
+        {
+            // The post-link subtasks are scheduled once all link subtasks are done.
+            using ScheduleTask = LinkSubTaskThenSchedulePostLinkSubTasks;
+            std::shared_ptr<ScheduleTask::PostLinkSubTasks> postLinkTasks =
+                std::make_shared<ScheduleTask::PostLinkSubTasks>();
+            postLinkTasks->workerThreadPool = mSubTaskWorkerPool;
+            postLinkTasks->tasks            = &mState.mExecutable->mPostLinkSubTasks;
+            postLinkTasks->eventsOut        = &mState.mExecutable->mPostLinkSubTaskWaitableEvents;
+            postLinkTasks->pendingLinkSubTaskCount = mSubTasks.size();
+            postLinkTasks->eventsOut->reserve(postLinkTasks->tasks->size());
+
+            mSubTaskWaitableEvents.reserve(mSubTasks.size());
+            for (const std::shared_ptr<rx::LinkSubTask> &subTask : mSubTasks)
+            {
+                mSubTaskWaitableEvents.push_back(mSubTaskWorkerPool->postWorkerTask(
+                    std::make_shared<ScheduleTask>(subTask, postLinkTasks)));
+            }
+        }
+        else
+        {
+            // Schedule link subtasks
+            ScheduleSubTasks(mSubTaskWorkerPool, mSubTasks, angle::WorkerTaskPriority::BlockingSoon,
+                             &mSubTaskWaitableEvents);
+
+            // Schedule post-link subtasks.  They only warm up caches, so they don't delay the
+            // tasks that are going to be waited on.
+            ScheduleSubTasks(mSubTaskWorkerPool, mState.mExecutable->mPostLinkSubTasks,
+                             angle::WorkerTaskPriority::Background,
+                             &mState.mExecutable->mPostLinkSubTaskWaitableEvents);
+        }
 
         // No further use for worker pool.  Release it earlier than the destructor (to avoid
         // situations such as http://anglebug.com/42267099)
@@ -589,6 +679,7 @@ class Program::MainLinkLoadTask : public angle::Closure
     }
 
     std::shared_ptr<angle::WorkerThreadPool> mSubTaskWorkerPool;
+    const bool mDeferPostLinkSubTasks;
     ProgramState &mState;
     std::shared_ptr<rx::LinkTask> mLinkTask;
 
@@ -605,6 +696,7 @@ class Program::MainLinkTask final : public Program::MainLinkLoadTask
 {
   public:
     MainLinkTask(const std::shared_ptr<angle::WorkerThreadPool> &subTaskWorkerPool,
+                 bool deferPostLinkSubTasks,
                  const Caps &caps,
                  const Limitations &limitations,
                  const Version &clientVersion,
@@ -614,7 +706,7 @@ class Program::MainLinkTask final : public Program::MainLinkLoadTask
                  LinkingVariables *linkingVariables,
                  ProgramLinkedResources *resources,
                  std::shared_ptr<rx::LinkTask> &&linkTask)
-        : MainLinkLoadTask(subTaskWorkerPool, state, std::move(linkTask)),
+        : MainLinkLoadTask(subTaskWorkerPool, deferPostLinkSubTasks, state, std::move(linkTask)),
           mCaps(caps),
           mLimitations(limitations),
           mClientVersion(clientVersion),
@@ -644,10 +736,11 @@ class Program::MainLoadTask final : public Program::MainLinkLoadTask
 {
   public:
     MainLoadTask(const std::shared_ptr<angle::WorkerThreadPool> &subTaskWorkerPool,
+                 bool deferPostLinkSubTasks,
                  Program *program,
                  ProgramState *state,
                  std::shared_ptr<rx::LinkTask> &&loadTask)
-        : MainLinkLoadTask(subTaskWorkerPool, state, std::move(loadTask))
+        : MainLinkLoadTask(subTaskWorkerPool, deferPostLinkSubTasks, state, std::move(loadTask))
     {}
     ~MainLoadTask() override = default;
 
@@ -1010,8 +1103,10 @@ angle::Result Program::link(const Context *context, angle::JobResultExpectancy r
 
     // Prepare the main link job
     std::shared_ptr<MainLinkLoadTask> mainLinkTask(new MainLinkTask(
-        context->getLinkSubTaskThreadPool(), caps, limitations, clientVersion, isWebGL, this,
-        &mState, &linkingState->linkingVariables, &linkingState->resources, std::move(linkTask)));
+        context->getLinkSubTaskThreadPool(),
+        context->getFrontendFeatures().deferPostLinkTasksUntilUse.enabled, caps, limitations,
+        clientVersion, isWebGL, this, &mState, &linkingState->linkingVariables,
+        &linkingState->resources, std::move(linkTask)));
 
     // While the subtasks are currently always thread-safe, the main task is not safe on all
     // backends.  A front-end feature selects whether the single-threaded pool must be used.
@@ -1196,6 +1291,8 @@ bool Program::isLinking() const
 
 bool Program::isBinaryReady(const Context *context)
 {
+    mState.mExecutable->schedulePostLinkTasks();
+
     if (mState.mExecutable->mPostLinkSubTasks.empty())
     {
         // Ensure the program binary is cached, even if the backend waits for post-link tasks
@@ -1393,6 +1490,36 @@ angle::Result Program::setBinary(const Context *context,
 
     makeNewExecutable(context);
 
+    mProgramHash              = {0};
+    MemoryProgramCache *cache = (context->getFrontendFeatures().disableProgramCaching.enabled)
+                                    ? nullptr
+                                    : context->getMemoryProgramCache();
+
+    // If the backend has written back an updated version of this binary to the program cache
+    // (for example with shader variants compiled on draw), load that instead.
+    // TODO: http://anglebug.com/42263141: Enable program caching for separable programs
+    if (cache && !isSeparable())
+    {
+        std::lock_guard<angle::SimpleMutex> cacheLock(context->getProgramCacheMutex());
+        egl::CacheGetResult result = egl::CacheGetResult::NotFound;
+        ANGLE_TRY(cache->getProgramForBinary(context, this, binary, static_cast<size_t>(length),
+                                             &mProgramHash, &result));
+
+        switch (result)
+        {
+            case egl::CacheGetResult::Success:
+                return angle::Result::Continue;
+            case egl::CacheGetResult::Rejected:
+                // The executable may be in an inconsistent half-loaded state.  Start over.
+                mLinkingState.reset();
+                makeNewExecutable(context);
+                break;
+            case egl::CacheGetResult::NotFound:
+            default:
+                break;
+        }
+    }
+
     egl::CacheGetResult result = egl::CacheGetResult::NotFound;
     return loadBinary(context, binary, length, &result);
 }
@@ -1412,9 +1539,6 @@ angle::Result Program::loadBinary(const Context *context,
     {
         return angle::Result::Continue;
     }
-    // Currently we require the full shader text to compute the program hash.
-    // We could also store the binary in the internal program cache.
-
     // Initialize the uniform block -> buffer index map based on serialized data.
     mState.mExecutable->initInterfaceBlockBindings();
 
@@ -1434,7 +1558,9 @@ angle::Result Program::loadBinary(const Context *context,
     if (loadTask)
     {
         std::shared_ptr<MainLinkLoadTask> mainLoadTask(new MainLoadTask(
-            context->getLinkSubTaskThreadPool(), this, &mState, std::move(loadTask)));
+            context->getLinkSubTaskThreadPool(),
+            context->getFrontendFeatures().deferPostLinkTasksUntilUse.enabled, this, &mState,
+            std::move(loadTask)));
 
         std::shared_ptr<angle::WaitableEvent> mainLoadEvent =
             context->getShaderCompileThreadPool()->postWorkerTask(mainLoadTask);
@@ -393,6 +393,9 @@ class Program final : public LabeledObject, public angle::Subject
                             GLenum binaryFormat,
                             const void *binary,
                             GLsizei length);
+
+    // The key under which the program is stored in the program cache, or zero if not cached.
+    const egl::BlobCache::Key &getProgramHash() const { return mProgramHash; }
     angle::Result getBinary(Context *context,
                             GLenum *binaryFormat,
                             void *binary,
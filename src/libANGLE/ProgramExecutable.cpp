@@ -271,26 +271,56 @@ void SaveUniforms(BinaryOutputStream *stream,
     }
     stream->writeVector(uniformLocations);
 }
+void LoadUniformNames(BinaryInputStream *stream,
+                      size_t uniformCount,
+                      std::vector<std::string> *uniformNames,
+                      std::vector<std::string> *uniformMappedNames)
+{
+    if (uniformCount > 0)
+    {
+        uniformNames->resize(uniformCount);
+        for (size_t uniformIndex = 0; uniformIndex < uniformCount; ++uniformIndex)
+        {
+            stream->readString(&(*uniformNames)[uniformIndex]);
+        }
+        uniformMappedNames->resize(uniformCount);
+        for (size_t uniformIndex = 0; uniformIndex < uniformCount; ++uniformIndex)
+        {
+            stream->readString(&(*uniformMappedNames)[uniformIndex]);
+        }
+    }
+}
+// The names are copied out of the stream as is to |serializedUniformNames|, to be decoded by
+// LoadUniformNames when first needed.  If that copy can't be made, they are loaded right away.
 void LoadUniforms(BinaryInputStream *stream,
                   std::vector<LinkedUniform> *uniforms,
+                  angle::MemoryBuffer *serializedUniformNames,
                   std::vector<std::string> *uniformNames,
                   std::vector<std::string> *uniformMappedNames,
                   std::vector<VariableLocation> *uniformLocations)
 {
     stream->readVector(uniforms);
-    if (!uniforms->empty())
+
+    const size_t namesOffset = stream->offset();
+    for (size_t nameIndex = 0; nameIndex < uniforms->size() * 2; ++nameIndex)
+    {
+        stream->skip(stream->readInt<size_t>());
+    }
+    const size_t namesSize = stream->offset() - namesOffset;
+
+    if (!stream->error() && namesSize > 0)
     {
-        uniformNames->resize(uniforms->size());
-        for (size_t uniformIndex = 0; uniformIndex < uniforms->size(); ++uniformIndex)
+        if (serializedUniformNames->resize(namesSize))
         {
-            stream->readString(&(*uniformNames)[uniformIndex]);
+            memcpy(serializedUniformNames->data(), stream->data() + namesOffset, namesSize);
         }
-        uniformMappedNames->resize(uniforms->size());
-        for (size_t uniformIndex = 0; uniformIndex < uniforms->size(); ++uniformIndex)
+        else
         {
-            stream->readString(&(*uniformMappedNames)[uniformIndex]);
+            BinaryInputStream namesStream(stream->data() + namesOffset, namesSize);
+            LoadUniformNames(&namesStream, uniforms->size(), uniformNames, uniformMappedNames);
         }
     }
+
     stream->readVector(uniformLocations);
 }
 
@@ -466,81 +496,6 @@ GLuint GetResourceIndexFromName(const std::vector<VarT> &list, const std::string
     return GL_INVALID_INDEX;
 }
 
-GLuint GetUniformIndexFromName(const std::vector<LinkedUniform> &uniformList,
-                               const std::vector<std::string> &nameList,
-                               const std::string &name)
-{
-    std::string nameAsArrayName = name + "[0]";
-    for (size_t index = 0; index < nameList.size(); index++)
-    {
-        const std::string &uniformName = nameList[index];
-        if (uniformName == name || (uniformList[index].isArray() && uniformName == nameAsArrayName))
-        {
-            return static_cast<GLuint>(index);
-        }
-    }
-
-    return GL_INVALID_INDEX;
-}
-
-GLint GetUniformLocation(const std::vector<LinkedUniform> &uniformList,
-                         const std::vector<std::string> &nameList,
-                         const std::vector<VariableLocation> &locationList,
-                         const std::string &name)
-{
-    size_t nameLengthWithoutArrayIndex;
-    unsigned int arrayIndex = ParseArrayIndex(name, &nameLengthWithoutArrayIndex);
-
-    for (size_t location = 0u; location < locationList.size(); ++location)
-    {
-        const VariableLocation &variableLocation = locationList[location];
-        if (!variableLocation.used())
-        {
-            continue;
-        }
-
-        const LinkedUniform &variable  = uniformList[variableLocation.index];
-        const std::string &uniformName = nameList[variableLocation.index];
-
-        // Array output variables may be bound out of order, so we need to ensure we only pick the
-        // first element if given the base name. Uniforms don't allow this behavior and some code
-        // seemingly depends on the opposite behavior, so only enable it for output variables.
-        if (angle::BeginsWith(uniformName, name) && (variableLocation.arrayIndex == 0))
-        {
-            if (name.length() == uniformName.length())
-            {
-                ASSERT(name == uniformName);
-                // GLES 3.1 November 2016 page 87.
-                // The string exactly matches the name of the active variable.
-                return static_cast<GLint>(location);
-            }
-            if (name.length() + 3u == uniformName.length() && variable.isArray())
-            {
-                ASSERT(name + "[0]" == uniformName);
-                // The string identifies the base name of an active array, where the string would
-                // exactly match the name of the variable if the suffix "[0]" were appended to the
-                // string.
-                return static_cast<GLint>(location);
-            }
-        }
-        if (variable.isArray() && variableLocation.arrayIndex == arrayIndex &&
-            nameLengthWithoutArrayIndex + 3u == uniformName.length() &&
-            angle::BeginsWith(uniformName, name, nameLengthWithoutArrayIndex))
-        {
-            ASSERT(name.substr(0u, nameLengthWithoutArrayIndex) + "[0]" == uniformName);
-            // The string identifies an active element of the array, where the string ends with the
-            // concatenation of the "[" character, an integer (with no "+" sign, extra leading
-            // zeroes, or whitespace) identifying an array element, and the "]" character, the
-            // integer is less than the number of active elements of the array variable, and where
-            // the string would exactly match the enumerated name of the array if the decimal
-            // integer were replaced with zero.
-            return static_cast<GLint>(location);
-        }
-    }
-
-    return -1;
-}
-
 GLuint GetInterfaceBlockIndex(const std::vector<InterfaceBlock> &list, const std::string &name)
 {
     std::vector<unsigned int> subscripts;
@@ -742,9 +697,12 @@ ProgramOutput::ProgramOutput(const sh::ShaderVariable &var)
 ProgramExecutable::ProgramExecutable(rx::GLImplFactory *factory, InfoLog *infoLog)
     : mImplementation(factory->createProgramExecutable(this)),
       mInfoLog(infoLog),
+      mUniformNamesLoaded(true),
+      mUniformNameIndexBuilt(false),
       mCachedBaseVertex(0),
       mCachedBaseInstance(0),
-      mIsPPO(false)
+      mIsPPO(false),
+      mPostLinkSubTasksDeferred(false)
 {
     memset(&mPod, 0, sizeof(mPod));
     reset();
@@ -838,6 +796,10 @@ void ProgramExecutable::reset()
     mUniforms.clear();
     mUniformNames.clear();
     mUniformMappedNames.clear();
+    mSerializedUniformNames.clear();
+    mUniformNamesLoaded.store(true, std::memory_order_release);
+    mUniformNameIndex.clear();
+    mUniformNameIndexBuilt.store(false, std::memory_order_release);
     mUniformBlocks.clear();
     mUniformLocations.clear();
     mShaderStorageBlocks.clear();
@@ -853,6 +815,8 @@ void ProgramExecutable::reset()
 
     mPostLinkSubTasks.clear();
     mPostLinkSubTaskWaitableEvents.clear();
+    mPostLinkSubTasksDeferred = false;
+    mDeferredPostLinkSubTaskPool.reset();
 }
 
 void ProgramExecutable::load(gl::BinaryInputStream *stream)
@@ -867,7 +831,9 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
     stream->readStruct(&mPod);
 
     LoadProgramInputs(stream, &mProgramInputs);
-    LoadUniforms(stream, &mUniforms, &mUniformNames, &mUniformMappedNames, &mUniformLocations);
+    LoadUniforms(stream, &mUniforms, &mSerializedUniformNames, &mUniformNames,
+                 &mUniformMappedNames, &mUniformLocations);
+    mUniformNamesLoaded.store(mSerializedUniformNames.empty(), std::memory_order_release);
 
     size_t uniformBlockCount = stream->readInt<size_t>();
     ASSERT(getUniformBlocks().empty());
@@ -986,6 +952,71 @@ void ProgramExecutable::load(gl::BinaryInputStream *stream)
     }
 }
 
+void ProgramExecutable::loadUniformNames() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mUniformNamesMutex);
+    if (mUniformNamesLoaded.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    BinaryInputStream stream(mSerializedUniformNames.data(), mSerializedUniformNames.size());
+    LoadUniformNames(&stream, mUniforms.size(), &mUniformNames, &mUniformMappedNames);
+    ASSERT(!stream.error() && stream.endOfStream());
+
+    mSerializedUniformNames.clear();
+    mUniformNamesLoaded.store(true, std::memory_order_release);
+}
+
+void ProgramExecutable::buildUniformNameIndex() const
+{
+    const std::vector<std::string> &uniformNames = getUniformNames();
+
+    std::lock_guard<angle::SimpleMutex> lock(mUniformNameIndexMutex);
+    if (mUniformNameIndexBuilt.load(std::memory_order_relaxed))
+    {
+        return;
+    }
+
+    // Go through the locations in order, so each array element keeps its first location.
+    std::vector<std::vector<GLint>> elementLocations(mUniforms.size());
+    for (size_t location = 0; location < mUniformLocations.size(); ++location)
+    {
+        const VariableLocation &variableLocation = mUniformLocations[location];
+        if (!variableLocation.used())
+        {
+            continue;
+        }
+
+        std::vector<GLint> &locations = elementLocations[variableLocation.index];
+        if (variableLocation.arrayIndex >= locations.size())
+        {
+            locations.resize(variableLocation.arrayIndex + 1, -1);
+        }
+        if (locations[variableLocation.arrayIndex] == -1)
+        {
+            locations[variableLocation.arrayIndex] = static_cast<GLint>(location);
+        }
+    }
+
+    mUniformNameIndex.clear();
+    mUniformNameIndex.reserve(mUniforms.size());
+    for (size_t index = 0; index < mUniforms.size(); ++index)
+    {
+        const std::string &name = uniformNames[index];
+        const bool isArray      = mUniforms[index].isArray();
+        ASSERT(!isArray || angle::EndsWith(name, "[0]"));
+
+        // If two uniforms had the same key, the first one would be found by a linear search.
+        UniformNameIndexEntry entry = {static_cast<GLuint>(index), isArray,
+                                       std::move(elementLocations[index])};
+        mUniformNameIndex.emplace(isArray ? name.substr(0, name.length() - 3) : name,
+                                  std::move(entry));
+    }
+
+    mUniformNameIndexBuilt.store(true, std::memory_order_release);
+}
+
 void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
 {
     static_assert(MAX_VERTEX_ATTRIBS * 2 <= sizeof(uint32_t) * 8,
@@ -998,7 +1029,7 @@ void ProgramExecutable::save(gl::BinaryOutputStream *stream) const
     stream->writeStruct(mPod);
 
     SaveProgramInputs(stream, mProgramInputs);
-    SaveUniforms(stream, mUniforms, mUniformNames, mUniformMappedNames, mUniformLocations);
+    SaveUniforms(stream, mUniforms, getUniformNames(), getUniformMappedNames(), mUniformLocations);
 
     stream->writeInt(getUniformBlocks().size());
     for (const InterfaceBlock &uniformBlock : getUniformBlocks())
@@ -2455,7 +2486,7 @@ GLint ProgramExecutable::getActiveUniformMaxLength() const
 {
     size_t maxLength = 0;
 
-    for (GLuint index = 0; index < static_cast<size_t>(mUniformNames.size()); index++)
+    for (GLuint index = 0; index < static_cast<size_t>(getUniformNames().size()); index++)
     {
         const std::string &uniformName = getUniformNameByIndex(index);
         if (!uniformName.empty())
@@ -2493,7 +2524,40 @@ const VariableLocation &ProgramExecutable::getUniformLocation(UniformLocation lo
 
 UniformLocation ProgramExecutable::getUniformLocation(const std::string &name) const
 {
-    return {GetUniformLocation(mUniforms, mUniformNames, mUniformLocations, name)};
+    ensureUniformNameIndexBuilt();
+
+    // GLES 3.1 November 2016 page 87.  The string can exactly match the name of the active
+    // variable, or the base name of an array, which selects its first element.
+    GLint location = -1;
+    auto iter      = mUniformNameIndex.find(name);
+    if (iter != mUniformNameIndex.end() && !iter->second.elementLocations.empty())
+    {
+        location = iter->second.elementLocations[0];
+    }
+
+    // The string can also end with "[N]", an integer with no "+" sign, extra leading zeroes, or
+    // whitespace, identifying an active element of the array.
+    size_t nameLengthWithoutArrayIndex;
+    unsigned int arrayIndex = ParseArrayIndex(name, &nameLengthWithoutArrayIndex);
+    if (arrayIndex == GL_INVALID_INDEX)
+    {
+        return {location};
+    }
+
+    iter = mUniformNameIndex.find(name.substr(0, nameLengthWithoutArrayIndex));
+    if (iter != mUniformNameIndex.end() && iter->second.isArray &&
+        arrayIndex < iter->second.elementLocations.size())
+    {
+        // Return the lower location if both match, as the first match of a search in location
+        // order would.
+        const GLint elementLocation = iter->second.elementLocations[arrayIndex];
+        if (elementLocation != -1 && (location == -1 || elementLocation < location))
+        {
+            location = elementLocation;
+        }
+    }
+
+    return {location};
 }
 
 GLuint ProgramExecutable::getUniformIndex(const std::string &name) const
@@ -2511,7 +2575,27 @@ bool ProgramExecutable::shouldIgnoreUniform(UniformLocation location) const
 
 GLuint ProgramExecutable::getUniformIndexFromName(const std::string &name) const
 {
-    return GetUniformIndexFromName(mUniforms, mUniformNames, name);
+    ensureUniformNameIndexBuilt();
+
+    // The name of a uniform, or the name of an array without its final [0].
+    GLuint index = GL_INVALID_INDEX;
+    auto iter    = mUniformNameIndex.find(name);
+    if (iter != mUniformNameIndex.end())
+    {
+        index = iter->second.uniformIndex;
+    }
+
+    // The name of an array, including its final [0].
+    if (angle::EndsWith(name, "[0]"))
+    {
+        iter = mUniformNameIndex.find(name.substr(0, name.length() - 3));
+        if (iter != mUniformNameIndex.end() && iter->second.isArray)
+        {
+            index = std::min(index, iter->second.uniformIndex);
+        }
+    }
+
+    return index;
 }
 
 GLuint ProgramExecutable::getBufferVariableIndexFromName(const std::string &name) const
@@ -3184,6 +3268,33 @@ void ProgramExecutable::setBaseInstanceUniform(GLuint baseInstance)
     mImplementation->setUniform1iv(mPod.baseInstanceLocation, 1, &baseInstanceInt);
 }
 
+void ProgramExecutable::scheduleDeferredPostLinkTasks() const
+{
+    ASSERT(mPostLinkSubTasksDeferred);
+    ASSERT(mPostLinkSubTaskWaitableEvents.empty());
+
+    std::shared_ptr<angle::WorkerThreadPool> workerThreadPool =
+        mDeferredPostLinkSubTaskPool.lock();
+    mPostLinkSubTasksDeferred = false;
+    mDeferredPostLinkSubTaskPool.reset();
+
+    mPostLinkSubTaskWaitableEvents.reserve(mPostLinkSubTasks.size());
+    for (const std::shared_ptr<rx::LinkSubTask> &task : mPostLinkSubTasks)
+    {
+        if (workerThreadPool)
+        {
+            mPostLinkSubTaskWaitableEvents.push_back(
+                workerThreadPool->postWorkerTask(task, angle::WorkerTaskPriority::Background));
+        }
+        else
+        {
+            // If the pool is already gone, run the post-link tasks in this thread instead.
+            (*task)();
+            mPostLinkSubTaskWaitableEvents.push_back(std::make_shared<angle::WaitableEventDone>());
+        }
+    }
+}
+
 void ProgramExecutable::waitForPostLinkTasks(const Context *context)
 {
     if (mPostLinkSubTasks.empty())
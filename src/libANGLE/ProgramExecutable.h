@@ -9,7 +9,12 @@
 #ifndef LIBANGLE_PROGRAMEXECUTABLE_H_
 #define LIBANGLE_PROGRAMEXECUTABLE_H_
 
+#include <atomic>
+
 #include "common/BinaryStream.h"
+#include "common/MemoryBuffer.h"
+#include "common/SimpleMutex.h"
+#include "common/hash_containers.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/InfoLog.h"
 #include "libANGLE/ProgramLinkedResources.h"
@@ -359,8 +364,16 @@ class ProgramExecutable final : public angle::Subject
         return mSecondaryOutputLocations;
     }
     const std::vector<LinkedUniform> &getUniforms() const { return mUniforms; }
-    const std::vector<std::string> &getUniformNames() const { return mUniformNames; }
-    const std::vector<std::string> &getUniformMappedNames() const { return mUniformMappedNames; }
+    const std::vector<std::string> &getUniformNames() const
+    {
+        ensureUniformNamesLoaded();
+        return mUniformNames;
+    }
+    const std::vector<std::string> &getUniformMappedNames() const
+    {
+        ensureUniformNamesLoaded();
+        return mUniformMappedNames;
+    }
     const std::vector<InterfaceBlock> &getUniformBlocks() const { return mUniformBlocks; }
     const std::vector<VariableLocation> &getUniformLocations() const { return mUniformLocations; }
     const std::vector<SamplerBinding> &getSamplerBindings() const { return mSamplerBindings; }
@@ -454,6 +467,7 @@ class ProgramExecutable final : public angle::Subject
     const std::string &getUniformNameByIndex(size_t index) const
     {
         ASSERT(index < static_cast<size_t>(mUniforms.size()));
+        ensureUniformNamesLoaded();
         return mUniformNames[index];
     }
 
@@ -747,6 +761,16 @@ class ProgramExecutable final : public angle::Subject
         mPostLinkSubTaskWaitableEvents.clear();
     }
 
+    // Schedules the post-link subtasks if their scheduling was deferred by the
+    // deferPostLinkTasksUntilUse feature.  Must be called before waiting on them.
+    void schedulePostLinkTasks() const
+    {
+        if (ANGLE_UNLIKELY(mPostLinkSubTasksDeferred))
+        {
+            scheduleDeferredPostLinkTasks();
+        }
+    }
+
     void waitForPostLinkTasks(const Context *context);
 
   private:
@@ -757,6 +781,26 @@ class ProgramExecutable final : public angle::Subject
 
     void reset();
 
+    void ensureUniformNamesLoaded() const
+    {
+        if (ANGLE_UNLIKELY(!mUniformNamesLoaded.load(std::memory_order_acquire)))
+        {
+            loadUniformNames();
+        }
+    }
+    void loadUniformNames() const;
+
+    void ensureUniformNameIndexBuilt() const
+    {
+        if (ANGLE_UNLIKELY(!mUniformNameIndexBuilt.load(std::memory_order_acquire)))
+        {
+            buildUniformNameIndex();
+        }
+    }
+    void buildUniformNameIndex() const;
+
+    void scheduleDeferredPostLinkTasks() const;
+
     void updateActiveImages(const ProgramExecutable &executable);
 
     bool linkMergedVaryings(const Caps &caps,
@@ -968,9 +1012,27 @@ class ProgramExecutable final : public angle::Subject
     // inner array of an array of arrays. Names and mapped names of uniforms that are arrays include
     // [0] in the end. This makes implementation of queries simpler.
     std::vector<LinkedUniform> mUniforms;
-    std::vector<std::string> mUniformNames;
+    mutable std::vector<std::string> mUniformNames;
     // Only used by GL and D3D backend
-    std::vector<std::string> mUniformMappedNames;
+    mutable std::vector<std::string> mUniformMappedNames;
+    // When loaded from a binary, the uniform names are kept serialized until first accessed.
+    // Applications that don't query their programs by name never need most of them, and decoding
+    // hundreds of strings is a large part of the load.
+    mutable angle::MemoryBuffer mSerializedUniformNames;
+    mutable std::atomic<bool> mUniformNamesLoaded;
+    mutable angle::SimpleMutex mUniformNamesMutex;
+    // Uniforms by name, keyed without the final [0] of arrays, for glGetUniformLocation and
+    // glGetUniformIndices.  Built on the first query by name.
+    struct UniformNameIndexEntry
+    {
+        GLuint uniformIndex;
+        bool isArray;
+        // The first location of each array element, or -1 if it has none.
+        std::vector<GLint> elementLocations;
+    };
+    mutable angle::HashMap<std::string, UniformNameIndexEntry> mUniformNameIndex;
+    mutable std::atomic<bool> mUniformNameIndexBuilt;
+    mutable angle::SimpleMutex mUniformNameIndexMutex;
     std::vector<InterfaceBlock> mUniformBlocks;
     std::vector<VariableLocation> mUniformLocations;
 
@@ -1031,6 +1093,9 @@ class ProgramExecutable final : public angle::Subject
     // only Vulkan) to run post-link optimization tasks which don't affect the link results.
     mutable std::vector<std::shared_ptr<rx::LinkSubTask>> mPostLinkSubTasks;
     mutable std::vector<std::shared_ptr<angle::WaitableEvent>> mPostLinkSubTaskWaitableEvents;
+    // Set while the scheduling of the post-link subtasks is deferred to first use.
+    mutable bool mPostLinkSubTasksDeferred;
+    mutable std::weak_ptr<angle::WorkerThreadPool> mDeferredPostLinkSubTaskPool;
 };
 
 void InstallExecutable(const Context *context,
@@ -186,6 +186,7 @@ void ProgramPipeline::onDestroy(const Context *context)
     getImplementation()->destroy(context);
     UninstallExecutable(context, &mState.mExecutable);
 
+    mState.discardCachedExecutables();
     mState.destroyDiscardedExecutables(context);
 }
 
@@ -198,6 +199,133 @@ void ProgramPipelineState::destroyDiscardedExecutables(const Context *context)
     mProgramExecutablesToDiscard.clear();
 }
 
+bool ProgramPipelineState::installCachedExecutable(const Context *context)
+{
+    auto iter = std::find_if(mCachedExecutables.begin(), mCachedExecutables.end(),
+                             [this](const CachedExecutable &cached) {
+                                 return cached.ppoProgramExecutables ==
+                                        mExecutable->mPPOProgramExecutables;
+                             });
+    if (iter == mCachedExecutables.end())
+    {
+        return false;
+    }
+
+    // Mark the executable as the most recently used.
+    std::rotate(iter, iter + 1, mCachedExecutables.end());
+    CachedExecutable &cached = mCachedExecutables.back();
+
+    // If the stages were changed and changed back without the pipeline being used in between, the
+    // current executable is still the right one.
+    if (cached.executable != mExecutable)
+    {
+        // Hand the program executables over to the cached executable, like link() does with a new
+        // executable.
+        for (SharedProgramExecutable &executable : cached.executable->mPPOProgramExecutables)
+        {
+            if (executable)
+            {
+                UninstallExecutable(context, &executable);
+            }
+        }
+        cached.executable->mPPOProgramExecutables =
+            std::move(mExecutable->mPPOProgramExecutables);
+        InstallExecutable(context, cached.executable, &mExecutable);
+    }
+
+    mUniformBlockMap = cached.uniformBlockMap;
+    updateExecutableBindingsFromPrograms();
+
+    return true;
+}
+
+void ProgramPipelineState::cacheLinkedExecutable()
+{
+    if (mCachedExecutables.size() >= kMaxCachedExecutables)
+    {
+        discardCachedExecutable(&mCachedExecutables.front());
+        mCachedExecutables.erase(mCachedExecutables.begin());
+    }
+
+    mCachedExecutables.push_back(
+        {mExecutable->mPPOProgramExecutables, mUniformBlockMap, mExecutable});
+}
+
+void ProgramPipelineState::discardCachedExecutable(CachedExecutable *cached)
+{
+    // The executables can only be destroyed with a context, which is not necessarily available.
+    for (SharedProgramExecutable &executable : cached->ppoProgramExecutables)
+    {
+        if (executable)
+        {
+            mProgramExecutablesToDiscard.emplace_back(std::move(executable));
+        }
+    }
+    mProgramExecutablesToDiscard.emplace_back(std::move(cached->executable));
+}
+
+void ProgramPipelineState::discardCachedExecutablesUsing(
+    const ProgramExecutable *programExecutable)
+{
+    auto usesProgramExecutable = [programExecutable](const CachedExecutable &cached) {
+        for (const SharedProgramExecutable &executable : cached.ppoProgramExecutables)
+        {
+            if (executable.get() == programExecutable)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (CachedExecutable &cached : mCachedExecutables)
+    {
+        if (usesProgramExecutable(cached))
+        {
+            discardCachedExecutable(&cached);
+        }
+    }
+    mCachedExecutables.erase(
+        std::remove_if(mCachedExecutables.begin(), mCachedExecutables.end(),
+                       [](const CachedExecutable &cached) { return !cached.executable; }),
+        mCachedExecutables.end());
+}
+
+void ProgramPipelineState::discardCachedExecutables()
+{
+    for (CachedExecutable &cached : mCachedExecutables)
+    {
+        discardCachedExecutable(&cached);
+    }
+    mCachedExecutables.clear();
+}
+
+void ProgramPipelineState::updateExecutableBindingsFromPrograms()
+{
+    // The sampler and uniform block bindings of the programs may have changed while a cached
+    // executable was not in use.
+    mExecutable->clearSamplerBindings();
+    for (const ShaderType shaderType : mExecutable->getLinkedShaderStages())
+    {
+        const SharedProgramExecutable &programExecutable = getShaderProgramExecutable(shaderType);
+        ASSERT(programExecutable);
+        mExecutable->copySamplerBindingsFromProgram(*programExecutable);
+
+        const std::vector<InterfaceBlock> &blocks = programExecutable->getUniformBlocks();
+        for (size_t blockIndex = 0; blockIndex < blocks.size(); ++blockIndex)
+        {
+            if (blocks[blockIndex].isActive(shaderType))
+            {
+                const uint32_t blockIndexInPPO = mUniformBlockMap[shaderType][blockIndex];
+                mExecutable->remapUniformBlockBinding(
+                    {blockIndexInPPO}, programExecutable->getUniformBlockBinding(blockIndex));
+            }
+        }
+    }
+    mExecutable->mActiveSamplerRefCounts.fill(0);
+    updateExecutableTextures();
+}
+
 angle::Result ProgramPipeline::setLabel(const Context *context, const std::string &label)
 {
     mState.mLabel = label;
@@ -511,6 +639,15 @@ angle::Result ProgramPipeline::link(const Context *context)
 {
     mState.destroyDiscardedExecutables(context);
 
+    // If the pipeline was already linked with the same programs, reuse that result.  This makes
+    // switching between a few stage combinations as cheap as binding a different program.
+    if (mState.installCachedExecutable(context))
+    {
+        mState.mIsLinked = true;
+        onStateChange(angle::SubjectMessage::ProgramRelinked);
+        return angle::Result::Continue;
+    }
+
     // Make a new executable to hold the result of the link.
     SharedProgramExecutable newExecutable = mState.makeNewExecutable(
         context->getImplementation(), std::move(mState.mExecutable->mPPOProgramExecutables));
@@ -641,6 +778,7 @@ angle::Result ProgramPipeline::link(const Context *context)
     }
 
     mState.mIsLinked = true;
+    mState.cacheLinkedExecutable();
     onStateChange(angle::SubjectMessage::ProgramRelinked);
 
     return angle::Result::Continue;
@@ -795,6 +933,8 @@ void ProgramPipeline::onSubjectStateChange(angle::SubjectIndex index, angle::Sub
             ASSERT(mState.mExecutable->mPPOProgramExecutables[shaderType]);
 
             mState.mIsLinked = false;
+            mState.discardCachedExecutablesUsing(
+                mState.mExecutable->mPPOProgramExecutables[shaderType].get());
             mState.mProgramExecutablesToDiscard.emplace_back(
                 std::move(mState.mExecutable->mPPOProgramExecutables[shaderType]));
             mState.mExecutable->mPPOProgramExecutables[shaderType] =
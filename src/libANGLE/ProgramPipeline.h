@@ -84,6 +84,14 @@ class ProgramPipelineState final : angle::NonCopyable
                          angle::ObserverBinding *programExecutableObserverBinding);
     void destroyDiscardedExecutables(const Context *context);
 
+    // Linked executables are cached per combination of program executables, so that switching the
+    // pipeline's stages back and forth doesn't relink it every time.
+    bool installCachedExecutable(const Context *context);
+    void cacheLinkedExecutable();
+    void discardCachedExecutablesUsing(const ProgramExecutable *programExecutable);
+    void discardCachedExecutables();
+    void updateExecutableBindingsFromPrograms();
+
     friend class ProgramPipeline;
 
     std::string mLabel;
@@ -101,6 +109,20 @@ class ProgramPipelineState final : angle::NonCopyable
     // lack of access to context.
     std::vector<SharedProgramExecutable> mProgramExecutablesToDiscard;
 
+    struct CachedExecutable
+    {
+        // The program executables the executable was linked with.  Note that the current
+        // executable's own list is modified in place by glUseProgramStages.
+        ShaderMap<SharedProgramExecutable> ppoProgramExecutables;
+        ShaderMap<ProgramUniformBlockArray<GLuint>> uniformBlockMap;
+        SharedProgramExecutable executable;
+    };
+    void discardCachedExecutable(CachedExecutable *cached);
+
+    static constexpr size_t kMaxCachedExecutables = 8;
+    // Most recently used last.
+    std::vector<CachedExecutable> mCachedExecutables;
+
     GLboolean mValid;
 
     InfoLog mInfoLog;
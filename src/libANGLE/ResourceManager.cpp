@@ -188,6 +188,24 @@ Shader *ShaderProgramManager::getShader(ShaderProgramID handle) const
     return mShaders.query(handle);
 }
 
+size_t ShaderProgramManager::getTotalShaderCodeSize() const
+{
+    size_t totalBytes = 0;
+
+    for (const auto &shader : UnsafeResourceMapIter(mShaders))
+    {
+        const ShaderState &shaderState = shader.second->getState();
+        if (shaderState.compilePending() || !shaderState.getCompiledState())
+        {
+            continue;
+        }
+        const CompiledShaderState &compiledState = *shaderState.getCompiledState();
+        totalBytes += compiledState.translatedSource.size();
+        totalBytes += compiledState.compiledBinary.size() * sizeof(uint32_t);
+    }
+    return totalBytes;
+}
+
 ShaderProgramID ShaderProgramManager::createProgram(rx::GLImplFactory *factory)
 {
     ShaderProgramID handle = ShaderProgramID{mHandleAllocator.allocate()};
@@ -185,6 +185,9 @@ class ShaderProgramManager : public ResourceManagerBase
         return mPrograms;
     }
 
+    // The size of the translated source and binary of the compiled shaders.
+    size_t getTotalShaderCodeSize() const;
+
   protected:
     ~ShaderProgramManager() override;
 
@@ -11,8 +11,11 @@
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <type_traits>
+#include <vector>
 
 #include "common/SimpleMutex.h"
 #include "common/hash_containers.h"
@@ -106,6 +109,189 @@ struct ResourceMapParams<unsigned int>
     static constexpr bool kNeedsLock                  = true;
 };
 
+// A copy of the resource map's hashed resources for maps that are accessed without the share group
+// lock, which can be looked up without taking any lock.  It is an open-addressed table with linear
+// probing where slots are never freed (erased resources are marked with an invalid pointer) until
+// the table runs out of space.  At that point, a new table is built from the resource map's
+// hashed resources and replaces the old one.  The old table is retired and freed once no reader
+// can be accessing it (an RCU-like scheme based on the count of active readers).
+//
+// find() is wait-free.  All other methods must be called with the resource map's mutex held.
+template <typename ResourceType>
+class ConcurrentHashedResources final : angle::NonCopyable
+{
+  public:
+    using HashMap = angle::HashMap<GLuint, ResourceType *>;
+
+    ConcurrentHashedResources() : mTable(nullptr), mReaderCount(0) {}
+    ~ConcurrentHashedResources() { clear(); }
+
+    // Returns |invalidPointer| if the handle is not in the table.
+    ANGLE_INLINE ResourceType *find(GLuint handle, ResourceType *invalidPointer) const
+    {
+        // The reader count is incremented before loading the table, so that a writer that
+        // observes no readers after replacing the table knows the older tables are not in use.
+        mReaderCount.fetch_add(1);
+
+        ResourceType *value = invalidPointer;
+        const Table *table  = mTable.load();
+        if (table != nullptr)
+        {
+            // Tables are never more than half full, so the loop is guaranteed to terminate.
+            for (size_t slot = handle & table->mask;; slot = (slot + 1) & table->mask)
+            {
+                const GLuint key = table->keys[slot].load(std::memory_order_acquire);
+                if (key == handle)
+                {
+                    value = table->values[slot].load(std::memory_order_acquire);
+                    break;
+                }
+                if (key == kEmptyKey)
+                {
+                    break;
+                }
+            }
+        }
+
+        mReaderCount.fetch_sub(1, std::memory_order_release);
+        return value;
+    }
+
+    // |allResources| is the resource map's hashed resources, already including |handle|.
+    void assign(GLuint handle, ResourceType *resource, const HashMap &allResources)
+    {
+        Table *table = mTable.load(std::memory_order_relaxed);
+        if (table != nullptr)
+        {
+            const size_t slot = FindSlot(*table, handle);
+            if (table->keys[slot].load(std::memory_order_relaxed) == handle)
+            {
+                table->values[slot].store(resource, std::memory_order_release);
+                return;
+            }
+
+            if ((table->usedSlots + 1) * 2 <= table->mask + 1)
+            {
+                // Store the value before the key, so that a reader that finds the key sees the
+                // value.
+                table->values[slot].store(resource, std::memory_order_relaxed);
+                table->keys[slot].store(handle, std::memory_order_release);
+                ++table->usedSlots;
+                return;
+            }
+        }
+
+        rebuild(allResources);
+    }
+
+    void erase(GLuint handle, ResourceType *invalidPointer)
+    {
+        Table *table = mTable.load(std::memory_order_relaxed);
+        ASSERT(table != nullptr);
+
+        const size_t slot = FindSlot(*table, handle);
+        ASSERT(table->keys[slot].load(std::memory_order_relaxed) == handle);
+        table->values[slot].store(invalidPointer, std::memory_order_release);
+    }
+
+    // Only called when no reader can be active, such as on destruction.
+    void clear()
+    {
+        ASSERT(mReaderCount.load() == 0);
+        delete mTable.exchange(nullptr);
+        freeRetiredTables();
+    }
+
+  private:
+    static constexpr GLuint kEmptyKey       = 0;
+    static constexpr size_t kMinTableSize   = 64;
+    static constexpr size_t kTableSizeRatio = 4;
+
+    struct Table final : angle::NonCopyable
+    {
+        explicit Table(size_t size)
+            : mask(size - 1),
+              usedSlots(0),
+              keys(new std::atomic<GLuint>[size]),
+              values(new std::atomic<ResourceType *>[size])
+        {
+            ASSERT((size & mask) == 0);
+            for (size_t slot = 0; slot < size; ++slot)
+            {
+                keys[slot].store(kEmptyKey, std::memory_order_relaxed);
+                values[slot].store(nullptr, std::memory_order_relaxed);
+            }
+        }
+
+        const size_t mask;
+        size_t usedSlots;
+        std::unique_ptr<std::atomic<GLuint>[]> keys;
+        std::unique_ptr<std::atomic<ResourceType *>[]> values;
+    };
+
+    // Returns the slot containing |handle|, or the empty slot where it should be placed.  Handles
+    // are mostly allocated sequentially, so they are used as their own hash.
+    static size_t FindSlot(const Table &table, GLuint handle)
+    {
+        ASSERT(handle != kEmptyKey);
+        size_t slot = handle & table.mask;
+        while (true)
+        {
+            const GLuint key = table.keys[slot].load(std::memory_order_relaxed);
+            if (key == handle || key == kEmptyKey)
+            {
+                return slot;
+            }
+            slot = (slot + 1) & table.mask;
+        }
+    }
+
+    void rebuild(const HashMap &allResources)
+    {
+        size_t size = kMinTableSize;
+        while (size < allResources.size() * kTableSizeRatio)
+        {
+            size *= 2;
+        }
+
+        Table *newTable = new Table(size);
+        for (const auto &handleAndResource : allResources)
+        {
+            const size_t slot = FindSlot(*newTable, handleAndResource.first);
+            newTable->keys[slot].store(handleAndResource.first, std::memory_order_relaxed);
+            newTable->values[slot].store(handleAndResource.second, std::memory_order_relaxed);
+            ++newTable->usedSlots;
+        }
+
+        // Publish the new table.  Readers that start after this see the new table.
+        Table *oldTable = mTable.exchange(newTable);
+        if (oldTable != nullptr)
+        {
+            mRetiredTables.push_back(oldTable);
+        }
+
+        // If readers are active, they may be accessing the retired tables; they'll be freed on a
+        // later rebuild (or destruction) instead.
+        if (mReaderCount.load() == 0)
+        {
+            freeRetiredTables();
+        }
+    }
+
+    void freeRetiredTables()
+    {
+        for (Table *table : mRetiredTables)
+        {
+            delete table;
+        }
+        mRetiredTables.clear();
+    }
+
+    std::atomic<Table *> mTable;
+    mutable std::atomic<uint32_t> mReaderCount;
+    std::vector<Table *> mRetiredTables;
+};
+
 template <typename ResourceType, typename IDType>
 class ResourceMap final : angle::NonCopyable
 {
@@ -126,10 +312,20 @@ class ResourceMap final : angle::NonCopyable
             return (value == InvalidPointer() ? nullptr : value);
         }
 
-        std::lock_guard<Mutex> lock(mMutex);
+        // No need for a lock when accessing the hashed resources of maps that need a lock either,
+        // as they are mirrored in a lockless table.
+        if constexpr (kNeedsLock)
+        {
+            ResourceType *value = mConcurrentHashedResources.find(handle, InvalidPointer());
+            return (value == InvalidPointer() ? nullptr : value);
+        }
+        else
+        {
+            std::lock_guard<Mutex> lock(mMutex);
 
-        auto it = mHashedResources.find(handle);
-        return (it == mHashedResources.end() ? nullptr : it->second);
+            auto it = mHashedResources.find(handle);
+            return (it == mHashedResources.end() ? nullptr : it->second);
+        }
     }
 
     // Returns true if the handle was reserved. Not necessarily if the resource is created.
@@ -208,6 +404,8 @@ class ResourceMap final : angle::NonCopyable
 
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
+    // For maps that need a lock, a copy of |mHashedResources| that is queried without the lock.
+    ConcurrentHashedResources<ResourceType> mConcurrentHashedResources;
 
     // mFlatResources is allocated at object creation time, with a default size of
     // |kInitialFlatResourcesSize|.  This is thread safe, because the allocation is done by the
@@ -215,9 +413,10 @@ class ResourceMap final : angle::NonCopyable
     // |kFlatResourcesLimit|, but only for maps that don't need a lock (kNeedsLock == false).
     //
     // For maps that don't need a lock, this mutex is a no-op.  For those that do, the mutex is
-    // taken when allocating / deleting objects, as well as when accessing |mHashedResources|.
-    // Otherwise, access to the flat map (which never gets reallocated due to
-    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) is lockless.  This latter is possible
+    // taken when allocating / deleting objects in |mHashedResources|.  Queries are lockless;
+    // access to the flat map (which never gets reallocated due to
+    // |kInitialFlatResourcesSize == kFlatResourcesLimit|) needs no synchronization and
+    // |mHashedResources| is queried through |mConcurrentHashedResources|.  This is possible
     // because the application is not allowed to gen/delete and bind the same ID in different
     // threads at the same time.
     //
@@ -275,8 +474,15 @@ ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
     {
         return mFlatResources[handle] != InvalidPointer();
     }
-    std::lock_guard<Mutex> lock(mMutex);
-    return mHashedResources.find(handle) != mHashedResources.end();
+    if constexpr (kNeedsLock)
+    {
+        return mConcurrentHashedResources.find(handle, InvalidPointer()) != InvalidPointer();
+    }
+    else
+    {
+        std::lock_guard<Mutex> lock(mMutex);
+        return mHashedResources.find(handle) != mHashedResources.end();
+    }
 }
 
 template <typename ResourceType, typename IDType>
@@ -304,6 +510,10 @@ bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resource
         }
         *resourceOut = it->second;
         mHashedResources.erase(it);
+        if constexpr (kNeedsLock)
+        {
+            mConcurrentHashedResources.erase(handle, InvalidPointer());
+        }
     }
     return true;
 }
@@ -342,6 +552,10 @@ void ResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource
     {
         std::lock_guard<Mutex> lock(mMutex);
         mHashedResources[handle] = resource;
+        if constexpr (kNeedsLock)
+        {
+            mConcurrentHashedResources.assign(handle, resource, mHashedResources);
+        }
     }
 }
 
@@ -385,6 +599,7 @@ void ResourceMap<ResourceType, IDType>::clear()
     memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * sizeof(mFlatResources[0]));
     mFlatResourcesSize = kInitialFlatResourcesSize;
     mHashedResources.clear();
+    mConcurrentHashedResources.clear();
 }
 
 template <typename ResourceType, typename IDType>
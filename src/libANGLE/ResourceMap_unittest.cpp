@@ -310,4 +310,65 @@ TEST(ResourceMapTest, ConcurrentAccessLargeIds)
 {
     ConcurrentAccess(10'000, 20'000);
 }
+
+// Tests that lockless queries of hashed ids are correct while another thread keeps growing the map,
+// which replaces the table used for lockless queries.
+TEST(ResourceMapTest, ConcurrentQueryDuringGrowth)
+{
+    if (std::is_same_v<ResourceMapMutex, angle::NoOpMutex>)
+    {
+        GTEST_SKIP() << "Test skipped: Locking is disabled in build.";
+    }
+
+    constexpr size_t kReaderThreadCount = 4;
+    constexpr LockedType kFirstId       = 1000;
+    constexpr LockedType kIdCount       = 20'000;
+
+    ResourceMap<size_t, LockedType> resourceMap;
+    std::vector<size_t> objects(kIdCount);
+    std::atomic<LockedType> assignedCount(0);
+
+    std::thread writer([&]() {
+        for (LockedType index = 0; index < kIdCount; ++index)
+        {
+            resourceMap.assign(kFirstId + index, &objects[index]);
+            assignedCount.store(index + 1, std::memory_order_release);
+        }
+    });
+
+    std::array<std::thread, kReaderThreadCount> readers;
+    for (size_t i = 0; i < kReaderThreadCount; ++i)
+    {
+        readers[i] = std::thread([&, i]() {
+            LockedType seen = 0;
+            while (seen < kIdCount)
+            {
+                seen = assignedCount.load(std::memory_order_acquire);
+                for (LockedType index = static_cast<LockedType>(i); index < seen;
+                     index += static_cast<LockedType>(kReaderThreadCount * 7))
+                {
+                    EXPECT_EQ(resourceMap.query(kFirstId + index), &objects[index]);
+                }
+                const LockedType unassignedId = kFirstId + kIdCount + static_cast<LockedType>(i);
+                EXPECT_FALSE(resourceMap.contains(unassignedId));
+            }
+        });
+    }
+
+    writer.join();
+    for (std::thread &reader : readers)
+    {
+        reader.join();
+    }
+
+    for (LockedType index = 0; index < kIdCount; ++index)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(kFirstId + index, &found));
+        ASSERT_EQ(&objects[index], found);
+        ASSERT_FALSE(resourceMap.contains(kFirstId + index));
+    }
+
+    ASSERT_TRUE(UnsafeResourceMapIter(resourceMap).empty());
+}
 }  // anonymous namespace
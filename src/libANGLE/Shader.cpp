@@ -327,6 +327,45 @@ angle::JobThreadSafety GetTranslateTaskThreadSafety(const Context *context)
                : angle::JobThreadSafety::Unsafe;
 }
 
+void ComputeShaderKey(const Context *context,
+                      ShaderType shaderType,
+                      const std::string &source,
+                      bool isPreprocessedSource,
+                      const ShCompileOptions &compileOptions,
+                      const ShShaderOutput &outputType,
+                      const ShBuiltInResources &resources,
+                      egl::BlobCache::Key *keyOut)
+{
+    // Compute shader key.
+    angle::base::SecureHashAlgorithm hasher;
+    hasher.Init();
+
+    // Start with the shader type and source.  Keys of the normalized preprocessed source are
+    // tagged so they cannot collide with the key of a shader whose source happens to match it.
+    AppendHashValue(hasher, shaderType);
+    hasher.Update(source.c_str(), source.length());
+    if (isPreprocessedSource)
+    {
+        constexpr char kPreprocessedTag[] = "preprocessed";
+        hasher.Update(kPreprocessedTag, sizeof(kPreprocessedTag));
+    }
+
+    // Include the shader program version hash.
+    hasher.Update(angle::GetANGLEShaderProgramVersion(),
+                  angle::GetANGLEShaderProgramVersionHashSize());
+
+    AppendHashValue(hasher, Compiler::SelectShaderSpec(context->getState()));
+    AppendHashValue(hasher, outputType);
+    hasher.Update(reinterpret_cast<const uint8_t *>(&compileOptions), sizeof(compileOptions));
+
+    // Include the ShBuiltInResources, which represent the extensions and constants used by the
+    // shader.
+    hasher.Update(reinterpret_cast<const uint8_t *>(&resources), sizeof(resources));
+
+    // Call the secure SHA hashing function.
+    hasher.Final();
+    memcpy(keyOut->data(), hasher.Digest(), angle::base::kSHA1Length);
+}
 }  // anonymous namespace
 
 const char *GetShaderTypeString(ShaderType type)
@@ -413,11 +452,13 @@ Shader::Shader(ShaderProgramManager *manager,
       mHandle(handle),
       mRefCount(0),
       mDeleteStatus(false),
+      mHasPreprocessedShaderHash(false),
       mResourceManager(manager)
 {
     ASSERT(mImplementation);
 
-    mShaderHash = {0};
+    mShaderHash             = {0};
+    mPreprocessedShaderHash = {0};
 }
 
 void Shader::onDestroy(const gl::Context *context)
@@ -729,13 +770,41 @@ void Shader::compile(const Context *context, angle::JobResultExpectancy resultEx
     ShHandle compilerHandle             = compilerInstance.getHandle();
     ASSERT(compilerHandle);
 
-    // Cache load failed, fall through normal compiling.
-    mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
-
     // Ask the backend to prepare the translate task
     std::shared_ptr<rx::ShaderTranslateTask> translateTask =
         mImplementation->compile(context, &options);
 
+    // Look the shader up by its preprocessed source too, which catches shaders that differ only in
+    // comments, whitespace or unused macros.  This is done after the backend has adjusted the
+    // compile options, as they may affect preprocessing (for example, line directives).
+    mHasPreprocessedShaderHash = false;
+    if (shaderCache != nullptr &&
+        context->getFrontendFeatures().cacheCompiledShaderByPreprocessedSource.enabled &&
+        setPreprocessedShaderKey(context, compilerHandle, options,
+                                 compilerInstance.getShaderOutputType(),
+                                 compiler->getBuiltInResources()))
+    {
+        egl::CacheGetResult result =
+            shaderCache->getShader(context, this, mPreprocessedShaderHash, resultExpectancy);
+        switch (result)
+        {
+            case egl::CacheGetResult::Success:
+                mBoundCompiler->putInstance(std::move(compilerInstance));
+                return;
+            case egl::CacheGetResult::Rejected:
+                // Reset the state
+                mState.mCompiledState =
+                    std::make_shared<CompiledShaderState>(mState.getShaderType());
+                break;
+            case egl::CacheGetResult::NotFound:
+            default:
+                break;
+        }
+    }
+
+    // Cache load failed, fall through normal compiling.
+    mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
+
     // Prepare the complete compile task
     const size_t maxComputeWorkGroupInvocations =
         static_cast<size_t>(context->getCaps().maxComputeWorkGroupInvocations);
@@ -785,7 +854,10 @@ void Shader::resolveCompile(const Context *context)
             if (shaderCache != nullptr)
             {
                 // Save to the shader cache.
-                if (shaderCache->putShader(context, mShaderHash, this) != angle::Result::Continue)
+                if (shaderCache->putShader(context, mShaderHash, this) != angle::Result::Continue ||
+                    (mHasPreprocessedShaderHash &&
+                     shaderCache->putShader(context, mPreprocessedShaderHash, this) !=
+                         angle::Result::Continue))
                 {
                     ANGLE_PERF_WARNING(context->getState().getDebug(), GL_DEBUG_SEVERITY_LOW,
                                        "Failed to save compiled shader to memory shader cache.");
@@ -993,29 +1065,28 @@ void Shader::setShaderKey(const Context *context,
                           const ShShaderOutput &outputType,
                           const ShBuiltInResources &resources)
 {
-    // Compute shader key.
-    angle::base::SecureHashAlgorithm hasher;
-    hasher.Init();
-
-    // Start with the shader type and source.
-    AppendHashValue(hasher, mState.getShaderType());
-    hasher.Update(mState.getSource().c_str(), mState.getSource().length());
-
-    // Include the shader program version hash.
-    hasher.Update(angle::GetANGLEShaderProgramVersion(),
-                  angle::GetANGLEShaderProgramVersionHashSize());
-
-    AppendHashValue(hasher, Compiler::SelectShaderSpec(context->getState()));
-    AppendHashValue(hasher, outputType);
-    hasher.Update(reinterpret_cast<const uint8_t *>(&compileOptions), sizeof(compileOptions));
+    ComputeShaderKey(context, mState.getShaderType(), mState.getSource(), false, compileOptions,
+                     outputType, resources, &mShaderHash);
+}
 
-    // Include the ShBuiltInResources, which represent the extensions and constants used by the
-    // shader.
-    hasher.Update(reinterpret_cast<const uint8_t *>(&resources), sizeof(resources));
+bool Shader::setPreprocessedShaderKey(const Context *context,
+                                      ShHandle compilerHandle,
+                                      const ShCompileOptions &compileOptions,
+                                      const ShShaderOutput &outputType,
+                                      const ShBuiltInResources &resources)
+{
+    const char *source = mState.getSource().c_str();
+    std::string normalizedSource;
+    if (!sh::GetNormalizedPreprocessedSource(compilerHandle, &source, 1, compileOptions,
+                                             &normalizedSource))
+    {
+        return false;
+    }
 
-    // Call the secure SHA hashing function.
-    hasher.Final();
-    memcpy(mShaderHash.data(), hasher.Digest(), angle::base::kSHA1Length);
+    ComputeShaderKey(context, mState.getShaderType(), normalizedSource, true, compileOptions,
+                     outputType, resources, &mPreprocessedShaderHash);
+    mHasPreprocessedShaderHash = true;
+    return true;
 }
 
 bool WaitCompileJobUnlocked(const SharedCompileJob &compileJob)
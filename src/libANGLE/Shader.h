@@ -217,6 +217,14 @@ class Shader final : angle::NonCopyable, public LabeledObject
                       const ShCompileOptions &compileOptions,
                       const ShShaderOutput &outputType,
                       const ShBuiltInResources &resources);
+    // Compute a second key from the normalized preprocessed source, which is shared by shaders
+    // that differ only in comments, whitespace or unused macros.  Returns false if the shader
+    // could not be preprocessed.
+    bool setPreprocessedShaderKey(const Context *context,
+                                  ShHandle compilerHandle,
+                                  const ShCompileOptions &compileOptions,
+                                  const ShShaderOutput &outputType,
+                                  const ShBuiltInResources &resources);
 
     ShaderState mState;
     std::unique_ptr<rx::ShaderImpl> mImplementation;
@@ -230,6 +238,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
     BindingPointer<Compiler> mBoundCompiler;
     SharedCompileJob mCompileJob;
     egl::BlobCache::Key mShaderHash;
+    // Only valid if mHasPreprocessedShaderHash is set.
+    egl::BlobCache::Key mPreprocessedShaderHash;
+    bool mHasPreprocessedShaderHash;
 
     ShaderProgramManager *mResourceManager;
 };
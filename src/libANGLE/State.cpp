@@ -2185,6 +2185,152 @@ void PrivateState::getIntegerv(GLenum pname, GLint *params) const
     }
 }
 
+bool PrivateState::IsPrivateStateQuery(GLenum pname)
+{
+    // This must match the queries answered by getBooleanv, getFloatv and getIntegerv above.  None
+    // of these are answered by State or Context before falling back to PrivateState.
+    switch (pname)
+    {
+        case GL_ACTIVE_TEXTURE:
+        case GL_ALPHA_TEST_FUNC:
+        case GL_ALPHA_TEST_REF:
+        case GL_BIND_GENERATES_RESOURCE_CHROMIUM:
+        case GL_BLEND:
+        case GL_BLEND_ADVANCED_COHERENT_KHR:
+        case GL_BLEND_COLOR:
+        case GL_BLEND_DST:
+        case GL_BLEND_DST_ALPHA:
+        case GL_BLEND_DST_RGB:
+        case GL_BLEND_EQUATION_ALPHA:
+        case GL_BLEND_EQUATION_RGB:
+        case GL_BLEND_SRC:
+        case GL_BLEND_SRC_ALPHA:
+        case GL_BLEND_SRC_RGB:
+        case GL_CLIENT_ACTIVE_TEXTURE:
+        case GL_CLIENT_ARRAYS_ANGLE:
+        case GL_CLIP_DEPTH_MODE_EXT:
+        case GL_CLIP_DISTANCE0_EXT:
+        case GL_CLIP_DISTANCE1_EXT:
+        case GL_CLIP_DISTANCE2_EXT:
+        case GL_CLIP_DISTANCE3_EXT:
+        case GL_CLIP_DISTANCE4_EXT:
+        case GL_CLIP_DISTANCE5_EXT:
+        case GL_CLIP_DISTANCE6_EXT:
+        case GL_CLIP_DISTANCE7_EXT:
+        case GL_CLIP_ORIGIN_EXT:
+        case GL_COLOR_CLEAR_VALUE:
+        case GL_COLOR_LOGIC_OP:
+        case GL_COLOR_WRITEMASK:
+        case GL_COVERAGE_MODULATION_CHROMIUM:
+        case GL_CULL_FACE:
+        case GL_CULL_FACE_MODE:
+        case GL_CURRENT_COLOR:
+        case GL_CURRENT_NORMAL:
+        case GL_CURRENT_TEXTURE_COORDS:
+        case GL_DEBUG_OUTPUT:
+        case GL_DEBUG_OUTPUT_SYNCHRONOUS:
+        case GL_DEPTH_CLAMP_EXT:
+        case GL_DEPTH_CLEAR_VALUE:
+        case GL_DEPTH_FUNC:
+        case GL_DEPTH_RANGE:
+        case GL_DEPTH_TEST:
+        case GL_DEPTH_WRITEMASK:
+        case GL_DITHER:
+        case GL_FETCH_PER_SAMPLE_ARM:
+        case GL_FOG_COLOR:
+        case GL_FOG_DENSITY:
+        case GL_FOG_END:
+        case GL_FOG_HINT:
+        case GL_FOG_MODE:
+        case GL_FOG_START:
+        case GL_FRAGMENT_SHADER_DERIVATIVE_HINT_OES:
+        case GL_FRAGMENT_SHADER_FRAMEBUFFER_FETCH_MRT_ARM:
+        case GL_FRAMEBUFFER_SRGB_EXT:
+        case GL_FRONT_FACE:
+        case GL_GENERATE_MIPMAP_HINT:
+        case GL_LIGHT_MODEL_AMBIENT:
+        case GL_LIGHT_MODEL_TWO_SIDE:
+        case GL_LINE_SMOOTH_HINT:
+        case GL_LINE_WIDTH:
+        case GL_LOGIC_OP_MODE:
+        case GL_MATRIX_MODE:
+        case GL_MIN_SAMPLE_SHADING_VALUE:
+        case GL_MODELVIEW_MATRIX:
+        case GL_MODELVIEW_STACK_DEPTH:
+        case GL_MULTISAMPLE_EXT:
+        case GL_PACK_ALIGNMENT:
+        case GL_PACK_REVERSE_ROW_ORDER_ANGLE:
+        case GL_PACK_ROW_LENGTH:
+        case GL_PACK_SKIP_PIXELS:
+        case GL_PACK_SKIP_ROWS:
+        case GL_PATCH_VERTICES:
+        case GL_PERSPECTIVE_CORRECTION_HINT:
+        case GL_PIXEL_LOCAL_STORAGE_ACTIVE_PLANES_ANGLE:
+        case GL_POINT_DISTANCE_ATTENUATION:
+        case GL_POINT_FADE_THRESHOLD_SIZE:
+        case GL_POINT_SIZE:
+        case GL_POINT_SIZE_MAX:
+        case GL_POINT_SIZE_MIN:
+        case GL_POINT_SMOOTH_HINT:
+        case GL_POLYGON_MODE_NV:
+        case GL_POLYGON_OFFSET_CLAMP_EXT:
+        case GL_POLYGON_OFFSET_FACTOR:
+        case GL_POLYGON_OFFSET_FILL:
+        case GL_POLYGON_OFFSET_LINE_NV:
+        case GL_POLYGON_OFFSET_POINT_NV:
+        case GL_POLYGON_OFFSET_UNITS:
+        case GL_PRIMITIVE_RESTART_FIXED_INDEX:
+        case GL_PRIMITIVE_RESTART_FOR_PATCHES_SUPPORTED:
+        case GL_PROGRAM_CACHE_ENABLED_ANGLE:
+        case GL_PROJECTION_MATRIX:
+        case GL_PROJECTION_STACK_DEPTH:
+        case GL_PROVOKING_VERTEX_ANGLE:
+        case GL_RASTERIZER_DISCARD:
+        case GL_ROBUST_FRAGMENT_SHADER_OUTPUT_ANGLE:
+        case GL_ROBUST_RESOURCE_INITIALIZATION_ANGLE:
+        case GL_SAMPLE_ALPHA_TO_COVERAGE:
+        case GL_SAMPLE_ALPHA_TO_ONE_EXT:
+        case GL_SAMPLE_COVERAGE:
+        case GL_SAMPLE_COVERAGE_INVERT:
+        case GL_SAMPLE_COVERAGE_VALUE:
+        case GL_SAMPLE_MASK:
+        case GL_SAMPLE_SHADING:
+        case GL_SCISSOR_BOX:
+        case GL_SCISSOR_TEST:
+        case GL_SHADE_MODEL:
+        case GL_SHADING_RATE_QCOM:
+        case GL_STENCIL_BACK_FAIL:
+        case GL_STENCIL_BACK_FUNC:
+        case GL_STENCIL_BACK_PASS_DEPTH_FAIL:
+        case GL_STENCIL_BACK_PASS_DEPTH_PASS:
+        case GL_STENCIL_BACK_REF:
+        case GL_STENCIL_BACK_VALUE_MASK:
+        case GL_STENCIL_BACK_WRITEMASK:
+        case GL_STENCIL_CLEAR_VALUE:
+        case GL_STENCIL_FAIL:
+        case GL_STENCIL_FUNC:
+        case GL_STENCIL_PASS_DEPTH_FAIL:
+        case GL_STENCIL_PASS_DEPTH_PASS:
+        case GL_STENCIL_REF:
+        case GL_STENCIL_TEST:
+        case GL_STENCIL_VALUE_MASK:
+        case GL_STENCIL_WRITEMASK:
+        case GL_TEXTURE_MATRIX:
+        case GL_TEXTURE_RECTANGLE_ANGLE:
+        case GL_TEXTURE_STACK_DEPTH:
+        case GL_UNPACK_ALIGNMENT:
+        case GL_UNPACK_IMAGE_HEIGHT:
+        case GL_UNPACK_ROW_LENGTH:
+        case GL_UNPACK_SKIP_IMAGES:
+        case GL_UNPACK_SKIP_PIXELS:
+        case GL_UNPACK_SKIP_ROWS:
+        case GL_VIEWPORT:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void PrivateState::getIntegeri_v(GLenum target, GLuint index, GLint *data) const
 {
     switch (target)
@@ -584,6 +584,11 @@ class PrivateState : angle::NonCopyable
     void getBooleanv(GLenum pname, GLboolean *params) const;
     void getFloatv(GLenum pname, GLfloat *params) const;
     void getIntegerv(GLenum pname, GLint *params) const;
+
+    // Whether the query is answered by the above functions alone, in which case it can be made
+    // without holding the share group lock.
+    static bool IsPrivateStateQuery(GLenum pname);
+
     void getIntegeri_v(GLenum target, GLuint index, GLint *data) const;
     void getBooleani_v(GLenum target, GLuint index, GLboolean *data) const;
 
@@ -626,6 +631,13 @@ class PrivateState : angle::NonCopyable
     Limitations mLimitations;
     const bool mIsExternal;
 
+    // Checked on every draw call, so kept ahead of the draw state rather than after the large
+    // debug and GLES1 state at the end.
+    state::DirtyBits mDirtyBits;
+    state::ExtendedDirtyBits mExtendedDirtyBits;
+    state::DirtyObjects mDirtyObjects;
+    mutable AttributesMask mDirtyCurrentValues;
+
     ColorF mColorClearValue;
     GLfloat mDepthClearValue;
     int mStencilClearValue;
@@ -755,11 +767,6 @@ class PrivateState : angle::NonCopyable
 
     // ANGLE_blob_cache
     BlobCacheCallbacks mBlobCacheCallbacks;
-
-    state::DirtyBits mDirtyBits;
-    state::ExtendedDirtyBits mExtendedDirtyBits;
-    state::DirtyObjects mDirtyObjects;
-    mutable AttributesMask mDirtyCurrentValues;
 };
 
 // This class represents all of the GL context's state.
@@ -1583,6 +1590,20 @@ class State : angle::NonCopyable
 
     VertexArray *mVertexArray;
 
+    // The dirty bits are checked on every draw call, so they are kept next to the bindings above
+    // rather than after the large binding arrays below.
+    state::DirtyBits mDirtyBits;
+    state::ExtendedDirtyBits mExtendedDirtyBits;
+    state::DirtyObjects mDirtyObjects;
+    ActiveTextureMask mDirtyActiveTextures;
+    ActiveTextureMask mDirtyTextures;
+    ActiveTextureMask mDirtySamplers;
+    ImageUnitMask mDirtyImages;
+    // Tracks uniform blocks that need reprocessing, for example because their mapped bindings have
+    // changed, or buffers in their mapped bindings have changed.  This is in State because every
+    // context needs to react to such changes.
+    mutable ProgramUniformBlockMask mDirtyUniformBlocks;
+
     TextureBindingMap mSamplerTextures;
 
     // Active Textures Cache
@@ -1631,18 +1652,6 @@ class State : angle::NonCopyable
     // The Overlay object, used by the backend to render the overlay.
     const OverlayType *mOverlay;
 
-    state::DirtyBits mDirtyBits;
-    state::ExtendedDirtyBits mExtendedDirtyBits;
-    state::DirtyObjects mDirtyObjects;
-    ActiveTextureMask mDirtyActiveTextures;
-    ActiveTextureMask mDirtyTextures;
-    ActiveTextureMask mDirtySamplers;
-    ImageUnitMask mDirtyImages;
-    // Tracks uniform blocks that need reprocessing, for example because their mapped bindings have
-    // changed, or buffers in their mapped bindings have changed.  This is in State because every
-    // context needs to react to such changes.
-    mutable ProgramUniformBlockMask mDirtyUniformBlocks;
-
     PrivateState mPrivateState;
 };
 
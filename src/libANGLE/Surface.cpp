@@ -12,12 +12,15 @@
 
 #include <EGL/eglext.h>
 
+#include "common/entry_point_timing.h"
+#include "common/system_utils.h"
 #include "libANGLE/Config.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/formatutils.h"
+#include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/EGLImplFactory.h"
 #include "libANGLE/trace.h"
 
@@ -26,6 +29,47 @@ namespace egl
 namespace
 {
 angle::SubjectIndex kSurfaceImplSubjectIndex = 0;
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
+// Reports the entry point timings of the last second, if a second has passed since the last
+// report.  Swaps are serialized by the global EGL lock.
+void ReportEntryPointTimings(const gl::Context *context)
+{
+    constexpr size_t kOverlayEntryPointCount = 4;
+    static double sLastReportTime            = 0;
+
+    const double currentTime = angle::GetCurrentSystemTime();
+    if (currentTime - sLastReportTime < 1.0)
+    {
+        return;
+    }
+    sLastReportTime = currentTime;
+
+    std::vector<angle::EntryPointTiming> timings = angle::CollectEntryPointTimings();
+
+    std::ostringstream overlayText;
+    for (size_t index = 0; index < timings.size(); ++index)
+    {
+        const angle::EntryPointTiming &timing = timings[index];
+        const char *entryPointName            = angle::GetEntryPointName(timing.entryPoint);
+        const int p99Microseconds             = static_cast<int>(timing.p99Nanoseconds / 1000);
+
+        std::string histogramName = std::string("GPU.ANGLE.EntryPointP99TimeUs.") + entryPointName;
+        ANGLE_HISTOGRAM_COUNTS(histogramName.c_str(), p99Microseconds);
+
+        if (index < kOverlayEntryPointCount)
+        {
+            overlayText << (index > 0 ? ", " : "") << entryPointName << " "
+                        << p99Microseconds << "us";
+        }
+    }
+
+    context->getState()
+        .getOverlay()
+        ->getTextWidget(gl::WidgetId::EntryPointTimings)
+        ->set(overlayText.str());
+}
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
 }  // namespace
 
 SurfaceState::SurfaceState(SurfaceID idIn,
@@ -197,6 +241,10 @@ void Surface::postSwap(const gl::Context *context)
     mBufferAgeQueriedSinceLastSwap = false;
 
     mIsDamageRegionSet = false;
+
+#if defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
+    ReportEntryPointTimings(context);
+#endif  // defined(ANGLE_ENABLE_ENTRY_POINT_TIMING)
 }
 
 Error Surface::initialize(const Display *display)
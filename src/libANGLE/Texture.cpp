@@ -2405,16 +2405,40 @@ bool Texture::isSamplerComplete(const Context *context, const Sampler *optionalS
         optionalSampler ? optionalSampler->getSamplerState() : mState.mSamplerState;
     const auto &contextState = context->getState();
 
-    if (contextState.getContextID() != mCompletenessCache.context ||
-        !mCompletenessCache.samplerState.sameCompleteness(samplerState))
+    if (contextState.getContextID() != mCompletenessCache.context)
     {
-        mCompletenessCache.context      = context->getState().getContextID();
-        mCompletenessCache.samplerState = samplerState;
-        mCompletenessCache.samplerComplete =
-            mState.computeSamplerCompleteness(samplerState, contextState);
+        mCompletenessCache.context    = contextState.getContextID();
+        mCompletenessCache.entryCount = 0;
     }
 
-    return mCompletenessCache.samplerComplete;
+    const uint32_t completenessKey = samplerState.getCompletenessKey();
+    for (size_t entry = 0; entry < mCompletenessCache.entryCount; ++entry)
+    {
+        if (mCompletenessCache.samplerCompletenessKeys[entry] == completenessKey)
+        {
+            return mCompletenessCache.samplerComplete[entry];
+        }
+    }
+
+    // Evict the oldest entry if the cache is full.
+    if (mCompletenessCache.entryCount == SamplerCompletenessCache::kMaxEntries)
+    {
+        for (size_t entry = 1; entry < SamplerCompletenessCache::kMaxEntries; ++entry)
+        {
+            mCompletenessCache.samplerCompletenessKeys[entry - 1] =
+                mCompletenessCache.samplerCompletenessKeys[entry];
+            mCompletenessCache.samplerComplete[entry - 1] =
+                mCompletenessCache.samplerComplete[entry];
+        }
+        --mCompletenessCache.entryCount;
+    }
+
+    const bool samplerComplete = mState.computeSamplerCompleteness(samplerState, contextState);
+    mCompletenessCache.samplerCompletenessKeys[mCompletenessCache.entryCount] = completenessKey;
+    mCompletenessCache.samplerComplete[mCompletenessCache.entryCount]         = samplerComplete;
+    ++mCompletenessCache.entryCount;
+
+    return samplerComplete;
 }
 
 // CopyImageSubData requires that we ignore format-based completeness rules
@@ -2428,12 +2452,13 @@ bool Texture::isSamplerCompleteForCopyImage(const Context *context,
 }
 
 Texture::SamplerCompletenessCache::SamplerCompletenessCache()
-    : context({0}), samplerState(), samplerComplete(false)
+    : context({0}), entryCount(0), samplerCompletenessKeys{}, samplerComplete{}
 {}
 
 void Texture::invalidateCompletenessCache() const
 {
-    mCompletenessCache.context = {0};
+    mCompletenessCache.context    = {0};
+    mCompletenessCache.entryCount = 0;
 }
 
 angle::Result Texture::ensureInitialized(const Context *context)
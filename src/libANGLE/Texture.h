@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_TEXTURE_H_
 #define LIBANGLE_TEXTURE_H_
 
+#include <array>
 #include <map>
 #include <vector>
 
@@ -808,15 +809,22 @@ class Texture final : public RefCountObject<TextureID>,
     {
         SamplerCompletenessCache();
 
-        // Context used to generate this cache entry
+        // A texture is often sampled with two sampler states, for example its own and a sampler
+        // object's, so more than one entry is kept to avoid recomputing on every switch.
+        static constexpr size_t kMaxEntries = 2;
+
+        // Context used to generate these cache entries
         ContextID context;
 
+        // Number of valid entries, the most recently added last
+        size_t entryCount;
+
         // All values that affect sampler completeness that are not stored within
-        // the texture itself
-        SamplerState samplerState;
+        // the texture itself, see SamplerState::getCompletenessKey()
+        std::array<uint32_t, kMaxEntries> samplerCompletenessKeys;
 
         // Result of the sampler completeness with the above parameters
-        bool samplerComplete;
+        std::array<bool, kMaxEntries> samplerComplete;
     };
 
     mutable SamplerCompletenessCache mCompletenessCache;
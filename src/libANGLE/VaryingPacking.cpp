@@ -341,7 +341,7 @@ void VaryingPacking::reset()
 
 void VaryingPacking::clearRegisterMap()
 {
-    std::fill(mRegisterMap.begin(), mRegisterMap.end(), Register());
+    std::fill(mRegisterMap.begin(), mRegisterMap.end(), static_cast<uint8_t>(0));
 }
 
 // Packs varyings into generic varying registers, using the algorithm from
@@ -433,7 +433,7 @@ bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
     {
         for (unsigned int column = 0; column < 4; ++column)
         {
-            if (mRegisterMap[row][column])
+            if ((mRegisterMap[row] & (1 << column)) != 0)
             {
                 contiguousSpace[column] = 0;
             }
@@ -484,7 +484,7 @@ bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
                     {
                         mRegisterList.push_back(registerInfo);
                     }
-                    mRegisterMap[row + arrayIndex][bestColumn] = true;
+                    mRegisterMap[row + arrayIndex] |= static_cast<uint8_t>(1 << bestColumn);
                 }
                 break;
             }
@@ -500,16 +500,15 @@ bool VaryingPacking::isRegisterRangeFree(unsigned int registerRow,
                                          unsigned int varyingRows,
                                          unsigned int varyingColumns) const
 {
+    ASSERT(registerColumn + varyingColumns <= 4);
+    const uint8_t columnMask = static_cast<uint8_t>(((1 << varyingColumns) - 1) << registerColumn);
+
     for (unsigned int row = 0; row < varyingRows; ++row)
     {
         ASSERT(registerRow + row < mRegisterMap.size());
-        for (unsigned int column = 0; column < varyingColumns; ++column)
+        if ((mRegisterMap[registerRow + row] & columnMask) != 0)
         {
-            ASSERT(registerColumn + column < 4);
-            if (mRegisterMap[registerRow + row][registerColumn + column])
-            {
-                return false;
-            }
+            return false;
         }
     }
 
@@ -528,6 +527,8 @@ void VaryingPacking::insertVaryingIntoRegisterMap(unsigned int registerRow,
     GLenum transposedType = gl::TransposeMatrixType(varying.type);
     varyingRows           = gl::VariableRowCount(transposedType);
 
+    const uint8_t columnMask = static_cast<uint8_t>(((1 << varyingColumns) - 1) << registerColumn);
+
     PackedVaryingRegister registerInfo;
     registerInfo.packedVarying  = &packedVarying;
     registerInfo.registerColumn = registerColumn;
@@ -554,10 +555,7 @@ void VaryingPacking::insertVaryingIntoRegisterMap(unsigned int registerRow,
                 mRegisterList.push_back(registerInfo);
             }
 
-            for (unsigned int columnIndex = 0; columnIndex < varyingColumns; ++columnIndex)
-            {
-                mRegisterMap[registerInfo.registerRow][registerColumn + columnIndex] = true;
-            }
+            mRegisterMap[registerInfo.registerRow] |= columnMask;
         }
     }
 }
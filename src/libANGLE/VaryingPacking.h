@@ -240,19 +240,6 @@ class VaryingPacking final : angle::NonCopyable
                                                   const std::vector<std::string> &tfVaryings,
                                                   const bool isSeparableProgram);
 
-    struct Register
-    {
-        Register() { data[0] = data[1] = data[2] = data[3] = false; }
-
-        bool &operator[](unsigned int index) { return data[index]; }
-        bool operator[](unsigned int index) const { return data[index]; }
-
-        bool data[4];
-    };
-
-    Register &operator[](unsigned int index) { return mRegisterMap[index]; }
-    const Register &operator[](unsigned int index) const { return mRegisterMap[index]; }
-
     const std::vector<PackedVaryingRegister> &getRegisterList() const { return mRegisterList; }
     unsigned int getMaxSemanticIndex() const
     {
@@ -310,7 +297,8 @@ class VaryingPacking final : angle::NonCopyable
                           const ProgramVaryingRef &ref,
                           VaryingUniqueFullNames *uniqueFullNames);
 
-    std::vector<Register> mRegisterMap;
+    // One mask of the occupied columns per register.
+    std::vector<uint8_t> mRegisterMap;
     std::vector<PackedVaryingRegister> mRegisterList;
     std::vector<PackedVarying> mPackedVaryings;
     ShaderMap<std::vector<uint32_t>> mInactiveVaryingIds;
@@ -883,6 +883,13 @@ void VertexArray::IndexRangeCache::put(DrawElementsType type,
 
 void VertexArray::onBufferContentsChange(uint32_t bufferIndex)
 {
+    // The contents don't affect the cached buffer sizes, so once the dirty bit is set the context
+    // has already been notified until the next syncState.  This coalesces repeated updates, for
+    // example from streaming glBufferSubData calls.
+    if (mDirtyBits.test(getDirtyBitFromIndex(true, bufferIndex)))
+    {
+        return;
+    }
     setDependentDirtyBit(true, bufferIndex);
 }
 
@@ -1055,7 +1055,22 @@ GLsizeiptr GetBoundBufferAvailableSize(const OffsetBindingPointer<Buffer> &bindi
    //
 namespace angle
 {
-bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData)
+namespace
+{
+// Gzip data starts with 0x1f 0x8b, so it can never be mistaken for this.
+constexpr uint8_t kBlobCodecMagic[3] = {'A', 'B', 'C'};
+
+struct BlobCodecHeader
+{
+    uint8_t magic[3];
+    BlobCodec codec;
+    uint32_t uncompressedSize;
+};
+static_assert(sizeof(BlobCodecHeader) == 8, "Header size is part of the blob format");
+
+bool CompressBlobGzip(const size_t cacheSize,
+                      const uint8_t *cacheData,
+                      MemoryBuffer *compressedData)
 {
     uLong uncompressedSize       = static_cast<uLong>(cacheSize);
     uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
@@ -1084,10 +1099,37 @@ bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer
     return true;
 }
 
-bool DecompressBlob(const uint8_t *compressedData,
-                    const size_t compressedSize,
-                    size_t maxUncompressedDataSize,
-                    MemoryBuffer *uncompressedData)
+bool CompressBlobUncompressed(const size_t cacheSize,
+                              const uint8_t *cacheData,
+                              MemoryBuffer *compressedData)
+{
+    if (cacheSize > std::numeric_limits<uint32_t>::max())
+    {
+        ERR() << "Blob is too large to store: " << cacheSize;
+        return false;
+    }
+
+    if (!compressedData->resize(sizeof(BlobCodecHeader) + cacheSize))
+    {
+        ERR() << "Failed to allocate memory for blob";
+        return false;
+    }
+
+    BlobCodecHeader header;
+    memcpy(header.magic, kBlobCodecMagic, sizeof(kBlobCodecMagic));
+    header.codec            = BlobCodec::Uncompressed;
+    header.uncompressedSize = static_cast<uint32_t>(cacheSize);
+
+    memcpy(compressedData->data(), &header, sizeof(header));
+    memcpy(compressedData->data() + sizeof(header), cacheData, cacheSize);
+
+    return true;
+}
+
+bool DecompressBlobGzip(const uint8_t *compressedData,
+                        const size_t compressedSize,
+                        size_t maxUncompressedDataSize,
+                        MemoryBuffer *uncompressedData)
 {
     // Call zlib function to decompress.
     uint32_t uncompressedSize =
@@ -1130,6 +1172,71 @@ bool DecompressBlob(const uint8_t *compressedData,
 
     return true;
 }
+}  // anonymous namespace
+
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  MemoryBuffer *compressedData,
+                  BlobCodec codec)
+{
+    switch (codec)
+    {
+        case BlobCodec::Gzip:
+            return CompressBlobGzip(cacheSize, cacheData, compressedData);
+        case BlobCodec::Uncompressed:
+            return CompressBlobUncompressed(cacheSize, cacheData, compressedData);
+    }
+
+    UNREACHABLE();
+    return false;
+}
+
+bool DecompressBlob(const uint8_t *compressedData,
+                    const size_t compressedSize,
+                    size_t maxUncompressedDataSize,
+                    MemoryBuffer *uncompressedData)
+{
+    BlobCodecHeader header;
+    if (compressedSize < sizeof(header) ||
+        memcmp(compressedData, kBlobCodecMagic, sizeof(kBlobCodecMagic)) != 0)
+    {
+        return DecompressBlobGzip(compressedData, compressedSize, maxUncompressedDataSize,
+                                  uncompressedData);
+    }
+
+    memcpy(&header, compressedData, sizeof(header));
+    const uint8_t *payload   = compressedData + sizeof(header);
+    const size_t payloadSize = compressedSize - sizeof(header);
+
+    if (header.uncompressedSize > maxUncompressedDataSize)
+    {
+        ERR() << "Decompressed data size is larger than the maximum supported ("
+              << header.uncompressedSize << " vs " << maxUncompressedDataSize << ")";
+        return false;
+    }
+
+    switch (header.codec)
+    {
+        case BlobCodec::Uncompressed:
+            if (payloadSize != header.uncompressedSize)
+            {
+                WARN() << "Uncompressed blob is truncated or corrupted (" << payloadSize << " vs "
+                       << header.uncompressedSize << ")";
+                return false;
+            }
+            if (!uncompressedData->resize(payloadSize))
+            {
+                ERR() << "Failed to allocate memory for decompression";
+                return false;
+            }
+            memcpy(uncompressedData->data(), payload, payloadSize);
+            return true;
+
+        default:
+            WARN() << "Unknown blob codec: " << static_cast<int>(header.codec);
+            return false;
+    }
+}
 
 uint32_t GenerateCRC32(const uint8_t *data, size_t size)
 {
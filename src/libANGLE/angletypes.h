@@ -447,6 +447,8 @@ class SamplerState final
     {
         return mCompleteness.packed == samplerState.mCompleteness.packed;
     }
+    // The values that affect texture completeness, packed in a single integer.
+    uint32_t getCompletenessKey() const { return mCompleteness.packed; }
 
   private:
     void updateWrapTCompareMode();
@@ -1123,6 +1125,37 @@ using ClipDistanceEnableBits = angle::BitSet32<IMPLEMENTATION_MAX_CLIP_DISTANCES
 template <typename T>
 using QueryTypeMap = angle::PackedEnumMap<QueryType, T>;
 
+// The categories of the memory usage breakdown of EGL_ANGLE_memory_usage_report, in the order of
+// the extension.  The share group's objects, the context's own memory and the display's caches
+// are reported together.
+enum class MemoryUsageCategory : uint8_t
+{
+    // Owned by the share group.
+    Textures,
+    Buffers,
+    Renderbuffers,
+    ShaderCode,
+    // Owned by the context.
+    CommandBuffers,
+    CompilerPools,
+    // Owned by the display.
+    StagingBuffers,
+    PipelineCache,
+    BlobCache,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+using MemoryUsageBreakdown = angle::PackedEnumMap<MemoryUsageCategory, uint64_t>;
+
+// The levels of EGL_ANGLE_memory_pressure.  Moderate pressure releases the memory that is cheap to
+// recreate, critical pressure releases everything that isn't needed to keep rendering.
+enum class MemoryPressureLevel : uint8_t
+{
+    Moderate,
+    Critical,
+};
+
 constexpr size_t kBarrierVectorDefaultSize = 16;
 
 template <typename T>
@@ -1310,7 +1343,20 @@ class BlobCacheValue  // To be replaced with std::span when C++20 is required
     size_t mSize;
 };
 
-bool CompressBlob(const size_t cacheSize, const uint8_t *cacheData, MemoryBuffer *compressedData);
+// The codec a blob is compressed with.  Gzip blobs are stored as produced by zlib and identified
+// by the gzip header, so blobs written before codecs were added remain readable.  Blobs using any
+// other codec are prefixed with a small header naming the codec.  DecompressBlob handles both.
+enum class BlobCodec : uint8_t
+{
+    Gzip,
+    // Stored as is, for blobs whose load latency matters more than their size.
+    Uncompressed,
+};
+
+bool CompressBlob(const size_t cacheSize,
+                  const uint8_t *cacheData,
+                  MemoryBuffer *compressedData,
+                  BlobCodec codec = BlobCodec::Gzip);
 bool DecompressBlob(const uint8_t *compressedData,
                     const size_t compressedSize,
                     size_t maxUncompressedDataSize,
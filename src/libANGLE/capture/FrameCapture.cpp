@@ -74,6 +74,7 @@ constexpr char kOutDirectoryVarName[]   = "ANGLE_CAPTURE_OUT_DIR";
 constexpr char kFrameStartVarName[]     = "ANGLE_CAPTURE_FRAME_START";
 constexpr char kFrameEndVarName[]       = "ANGLE_CAPTURE_FRAME_END";
 constexpr char kTriggerVarName[]        = "ANGLE_CAPTURE_TRIGGER";
+constexpr char kHitchThresholdVarName[] = "ANGLE_CAPTURE_HITCH_THRESHOLD";
 constexpr char kCaptureLabelVarName[]   = "ANGLE_CAPTURE_LABEL";
 constexpr char kCompressionVarName[]    = "ANGLE_CAPTURE_COMPRESSION";
 constexpr char kSerializeStateVarName[] = "ANGLE_CAPTURE_SERIALIZE_STATE";
@@ -82,6 +83,7 @@ constexpr char kValidationExprVarName[] = "ANGLE_CAPTURE_VALIDATION_EXPR";
 constexpr char kSourceExtVarName[]      = "ANGLE_CAPTURE_SOURCE_EXT";
 constexpr char kSourceSizeVarName[]     = "ANGLE_CAPTURE_SOURCE_SIZE";
 constexpr char kForceShadowVarName[]    = "ANGLE_CAPTURE_FORCE_SHADOW";
+constexpr char kThreadedReplayVarName[] = "ANGLE_CAPTURE_THREADED_REPLAY";
 
 constexpr size_t kBinaryAlignment   = 16;
 constexpr size_t kFunctionSizeLimit = 5000;
@@ -99,6 +101,7 @@ constexpr char kAndroidOutDir[]         = "debug.angle.capture.out_dir";
 constexpr char kAndroidFrameStart[]     = "debug.angle.capture.frame_start";
 constexpr char kAndroidFrameEnd[]       = "debug.angle.capture.frame_end";
 constexpr char kAndroidTrigger[]        = "debug.angle.capture.trigger";
+constexpr char kAndroidHitchThreshold[] = "debug.angle.capture.hitch_threshold";
 constexpr char kAndroidCaptureLabel[]   = "debug.angle.capture.label";
 constexpr char kAndroidCompression[]    = "debug.angle.capture.compression";
 constexpr char kAndroidValidation[]     = "debug.angle.capture.validation";
@@ -106,6 +109,7 @@ constexpr char kAndroidValidationExpr[] = "debug.angle.capture.validation_expr";
 constexpr char kAndroidSourceExt[]      = "debug.angle.capture.source_ext";
 constexpr char kAndroidSourceSize[]     = "debug.angle.capture.source_size";
 constexpr char kAndroidForceShadow[]    = "debug.angle.capture.force_shadow";
+constexpr char kAndroidThreadedReplay[] = "debug.angle.capture.threaded_replay";
 
 struct FramebufferCaptureFuncs
 {
@@ -1043,41 +1047,59 @@ struct SaveFileHelper
     std::string mFilePath;
 };
 
-void SaveBinaryData(bool compression,
-                    const std::string &outDir,
-                    gl::ContextID contextId,
-                    const std::string &captureLabel,
-                    const std::vector<uint8_t> &binaryData)
+// Compresses the data in chunks as it's written, instead of into a second copy of it first.  The
+// output is a single gzip stream, as GzipUncompressHelper expects.
+void SaveGzipCompressedData(SaveFileHelper *saveData, const std::vector<uint8_t> &data)
 {
-    std::string binaryDataFileName = GetBinaryDataFilePath(compression, captureLabel);
-    std::string dataFilepath       = outDir + binaryDataFileName;
+    constexpr size_t kChunkSize = 1024 * 1024;
 
-    SaveFileHelper saveData(dataFilepath);
+    z_stream stream = {};
+    int zResult     = deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS + 16, 8,
+                                   Z_DEFAULT_STRATEGY);
+    if (zResult != Z_OK)
+    {
+        FATAL() << "Error compressing binary data: " << zResult;
+    }
 
-    if (compression)
+    std::vector<uint8_t> chunk(kChunkSize);
+    size_t offset = 0;
+    do
     {
-        // Save compressed data.
-        uLong uncompressedSize       = static_cast<uLong>(binaryData.size());
-        uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
+        const size_t inputSize = std::min(kChunkSize, data.size() - offset);
+        stream.next_in         = const_cast<Bytef *>(data.data() + offset);
+        stream.avail_in        = static_cast<uInt>(inputSize);
+        offset += inputSize;
 
-        std::vector<uint8_t> compressedData(expectedCompressedSize, 0);
+        const int flush = offset == data.size() ? Z_FINISH : Z_NO_FLUSH;
+        do
+        {
+            stream.next_out  = chunk.data();
+            stream.avail_out = static_cast<uInt>(chunk.size());
+            zResult          = deflate(&stream, flush);
+            if (zResult == Z_STREAM_ERROR)
+            {
+                FATAL() << "Error compressing binary data: " << zResult;
+            }
+            saveData->write(chunk.data(), chunk.size() - stream.avail_out);
+        } while (stream.avail_out == 0);
+    } while (offset < data.size());
 
-        uLong compressedSize = expectedCompressedSize;
-        int zResult = zlib_internal::GzipCompressHelper(compressedData.data(), &compressedSize,
-                                                        binaryData.data(), uncompressedSize,
-                                                        nullptr, nullptr);
+    ASSERT(zResult == Z_STREAM_END);
+    deflateEnd(&stream);
+}
 
-        if (zResult != Z_OK)
-        {
-            FATAL() << "Error compressing binary data: " << zResult;
-        }
+void SaveBinaryData(bool compression,
+                    const std::string &outDir,
+                    gl::ContextID contextId,
+                    const std::string &captureLabel,
+                    std::vector<uint8_t> *binaryData,
+                    CaptureFileWriter *fileWriter)
+{
+    std::string binaryDataFileName = GetBinaryDataFilePath(compression, captureLabel);
+    std::string dataFilepath       = outDir + binaryDataFileName;
 
-        saveData.write(compressedData.data(), compressedSize);
-    }
-    else
-    {
-        saveData.write(binaryData.data(), binaryData.size());
-    }
+    fileWriter->writeBinaryFile(dataFilepath, std::move(*binaryData), compression);
+    binaryData->clear();
 }
 
 void WriteInitReplayCall(bool compression,
@@ -2111,6 +2133,207 @@ void WriteCppReplayFunctionWithPartsMultiContext(const gl::ContextID contextID,
     }
 }
 
+// Calls across which the contexts of a threaded replay must stay ordered: fences other contexts
+// can wait on, and the calls that wait for other contexts.
+bool IsThreadedReplaySyncPoint(const CallCapture &call)
+{
+    switch (call.entryPoint)
+    {
+        case EntryPoint::EGLClientWaitSync:
+        case EntryPoint::EGLClientWaitSyncKHR:
+        case EntryPoint::EGLWaitSync:
+        case EntryPoint::EGLWaitSyncKHR:
+        case EntryPoint::GLClientWaitSync:
+        case EntryPoint::GLFinish:
+        case EntryPoint::GLWaitSync:
+            return true;
+        default:
+            return call.isSyncPoint;
+    }
+}
+
+// Like WriteCppReplayFunctionWithPartsMultiContext, but side context calls are replayed on a thread
+// per side context instead of switching the current context of the replay thread.  The side
+// context calls between two sync points are written to segment functions that are queued on the
+// context's thread.  At a sync point, the replay waits for the side context to reach it, and only
+// then continues with the calls that follow it on any context.
+void WriteCppReplayFunctionWithPartsThreaded(const gl::ContextID contextID,
+                                             ReplayFunc replayFunc,
+                                             ReplayWriter &replayWriter,
+                                             uint32_t frameIndex,
+                                             std::vector<uint8_t> *binaryData,
+                                             std::vector<CallCapture> &calls,
+                                             std::stringstream &header,
+                                             std::stringstream &out,
+                                             size_t *maxResourceIDBufferSize)
+{
+    // The calls of a side context are split in segments.  Each sync point has a segment of its
+    // own, which is followed by a segment with the calls up to the next sync point.
+    using Segment = std::vector<size_t>;
+    std::map<gl::ContextID, std::vector<Segment>> sideContextSegments;
+    std::map<size_t, size_t> syncPointSegmentIndices;
+
+    for (size_t callIndex = 0; callIndex < calls.size(); ++callIndex)
+    {
+        const CallCapture &call = calls[callIndex];
+        if (call.contextID == contextID)
+        {
+            continue;
+        }
+
+        std::vector<Segment> &segments = sideContextSegments[call.contextID];
+        if (segments.empty())
+        {
+            segments.emplace_back();
+        }
+
+        if (IsThreadedReplaySyncPoint(call))
+        {
+            syncPointSegmentIndices[callIndex] = segments.size();
+            segments.push_back({callIndex});
+            segments.emplace_back();
+        }
+        else
+        {
+            segments.back().push_back(callIndex);
+        }
+    }
+
+    // Write the segments as functions of their own, splitting them like the replay functions.
+    // Each segment maps to the list of functions that replay it.
+    std::stringstream segmentsOut;
+    std::map<gl::ContextID, std::vector<std::vector<std::string>>> segmentFunctions;
+    for (auto &sideContext : sideContextSegments)
+    {
+        gl::ContextID sideContextID                         = sideContext.first;
+        std::vector<std::vector<std::string>> &functionList = segmentFunctions[sideContextID];
+
+        for (const Segment &segment : sideContext.second)
+        {
+            functionList.emplace_back();
+            for (size_t segmentCallIndex = 0; segmentCallIndex < segment.size(); ++segmentCallIndex)
+            {
+                if (segmentCallIndex % kFunctionSizeLimit == 0)
+                {
+                    if (segmentCallIndex > 0)
+                    {
+                        segmentsOut << "}\n";
+                        segmentsOut << "\n";
+                    }
+
+                    std::stringstream nameStream;
+                    nameStream << "ReplayFrame" << frameIndex << "Context" << sideContextID.value
+                               << "Segment" << functionList.size() << "Part"
+                               << (functionList.back().size() + 1);
+                    functionList.back().push_back(nameStream.str());
+                    segmentsOut << "static void " << functionList.back().back() << "(void)\n";
+                    segmentsOut << "{\n";
+                }
+
+                segmentsOut << "    ";
+                WriteCppReplayForCall(calls[segment[segmentCallIndex]], replayWriter, segmentsOut,
+                                      header, binaryData, maxResourceIDBufferSize);
+                segmentsOut << ";\n";
+            }
+
+            if (!segment.empty())
+            {
+                segmentsOut << "}\n";
+                segmentsOut << "\n";
+            }
+        }
+    }
+
+    int callCount = 0;
+    int partCount = 0;
+
+    if (calls.size() > kFunctionSizeLimit)
+    {
+        out << "void "
+            << FmtFunction(replayFunc, contextID, FuncUsage::Definition, frameIndex, ++partCount)
+            << "\n";
+    }
+    else
+    {
+        out << "void "
+            << FmtFunction(replayFunc, contextID, FuncUsage::Definition, frameIndex, kNoPartId)
+            << "\n";
+    }
+
+    out << "{\n";
+
+    auto writeRunSegment = [&](gl::ContextID sideContextID, size_t segmentIndex) {
+        for (const std::string &function : segmentFunctions[sideContextID][segmentIndex])
+        {
+            out << "    RunOnContextThread(" << sideContextID.value << ", " << function << ");\n";
+        }
+    };
+
+    // Start the side contexts on the calls that precede their first sync point.
+    for (const auto &sideContext : sideContextSegments)
+    {
+        writeRunSegment(sideContext.first, 0);
+    }
+
+    for (size_t callIndex = 0; callIndex < calls.size(); ++callIndex)
+    {
+        CallCapture &call = calls[callIndex];
+        if (call.contextID == contextID)
+        {
+            out << "    ";
+            WriteCppReplayForCall(call, replayWriter, out, header, binaryData,
+                                  maxResourceIDBufferSize);
+            out << ";\n";
+        }
+        else if (syncPointSegmentIndices.count(callIndex) > 0)
+        {
+            size_t segmentIndex = syncPointSegmentIndices[callIndex];
+            writeRunSegment(call.contextID, segmentIndex);
+            out << "    WaitForContextThread(" << call.contextID.value << ");\n";
+            writeRunSegment(call.contextID, segmentIndex + 1);
+        }
+        else
+        {
+            continue;
+        }
+
+        if (partCount > 0 && ++callCount % kFunctionSizeLimit == 0)
+        {
+            out << "}\n";
+            out << "\n";
+            out << "void "
+                << FmtFunction(replayFunc, contextID, FuncUsage::Definition, frameIndex,
+                               ++partCount)
+                << "\n";
+            out << "{\n";
+        }
+    }
+
+    // Side contexts finish their calls before the frame ends.
+    out << "    WaitForContextThreads();\n";
+    out << "}\n";
+
+    if (partCount > 0)
+    {
+        out << "\n";
+        out << "void "
+            << FmtFunction(replayFunc, contextID, FuncUsage::Definition, frameIndex, kNoPartId)
+            << "\n";
+        out << "{\n";
+
+        // Write out the main call which calls all the parts.
+        for (int i = 1; i <= partCount; i++)
+        {
+            out << "    " << FmtFunction(replayFunc, contextID, FuncUsage::Call, frameIndex, i)
+                << ";\n";
+        }
+
+        out << "}\n";
+    }
+
+    header << segmentsOut.str();
+}
+
 // Auxiliary contexts are other contexts in the share group that aren't the context calling
 // eglSwapBuffers().
 void WriteAuxiliaryContextCppSetupReplay(ReplayWriter &replayWriter,
@@ -6237,6 +6460,8 @@ FrameCaptureShared::FrameCaptureShared()
       mResourceIDToSetupCalls{},
       mMaxAccessedResourceIDs{},
       mCaptureTrigger(0),
+      mCaptureHitchThresholdMs(0),
+      mLastFrameEndTime(0),
       mCaptureActive(false),
       mWindowSurfaceContextID({0})
 {
@@ -6280,6 +6505,22 @@ FrameCaptureShared::FrameCaptureShared()
         INFO() << "Capture trigger detected, disabling capture start/end frame.";
     }
 
+    std::string hitchThresholdFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kHitchThresholdVarName, kAndroidHitchThreshold);
+    if (!hitchThresholdFromEnv.empty())
+    {
+        if (mCaptureTrigger == 0)
+        {
+            WARN() << "Capture hitch threshold requires a capture trigger frame count.";
+        }
+        else
+        {
+            mCaptureHitchThresholdMs = atof(hitchThresholdFromEnv.c_str());
+            INFO() << "Capture will be triggered by a frame longer than "
+                   << mCaptureHitchThresholdMs << "ms.";
+        }
+    }
+
     std::string labelFromEnv =
         GetEnvironmentVarOrUnCachedAndroidProperty(kCaptureLabelVarName, kAndroidCaptureLabel);
     // --angle-per-test-capture-label sets the env var, not properties
@@ -6358,6 +6599,14 @@ FrameCaptureShared::FrameCaptureShared()
         mCoherentBufferTracker.enableShadowMemory();
     }
 
+    std::string threadedReplayFromEnv =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kThreadedReplayVarName, kAndroidThreadedReplay);
+    if (threadedReplayFromEnv == "1")
+    {
+        INFO() << "Writing the replay of side contexts to run on threads of their own.";
+        mThreadedReplay = true;
+    }
+
     if (mFrameIndex == mCaptureStartFrame)
     {
         // Capture is starting from the first frame, so set the capture active to ensure all GLES
@@ -8904,19 +9153,39 @@ void FrameCaptureShared::checkForCaptureTrigger()
         return;
     }
 
-    // Otherwise, poll the value for a change
-    std::string captureTriggerStr = GetCaptureTrigger();
-    if (captureTriggerStr.empty())
+    bool triggered = false;
+    if (mCaptureHitchThresholdMs > 0)
     {
-        return;
+        // Trigger on the first frame that takes longer than the threshold, so the frames that
+        // follow a hitch can be captured without interrupting the workload.
+        double now = GetCurrentSystemTime();
+        if (mLastFrameEndTime > 0 && (now - mLastFrameEndTime) * 1000.0 > mCaptureHitchThresholdMs)
+        {
+            INFO() << "Frame " << mFrameIndex << " took " << (now - mLastFrameEndTime) * 1000.0
+                   << "ms";
+            triggered = true;
+        }
+        mLastFrameEndTime = now;
     }
 
-    // If the value has changed, use the original value as the frame count
-    // TODO (anglebug.com/42263521): Improve capture at unknown frame time. It is good to
-    // avoid polling if the feature is not enabled, but not entirely intuitive to set
-    // a value to zero when you want to trigger it.
-    uint32_t captureTrigger = atoi(captureTriggerStr.c_str());
-    if (captureTrigger != mCaptureTrigger)
+    if (!triggered)
+    {
+        // Otherwise, poll the value for a change
+        std::string captureTriggerStr = GetCaptureTrigger();
+        if (captureTriggerStr.empty())
+        {
+            return;
+        }
+
+        // If the value has changed, use the original value as the frame count
+        // TODO (anglebug.com/42263521): Improve capture at unknown frame time. It is good to
+        // avoid polling if the feature is not enabled, but not entirely intuitive to set
+        // a value to zero when you want to trigger it.
+        uint32_t captureTrigger = atoi(captureTriggerStr.c_str());
+        triggered               = captureTrigger != mCaptureTrigger;
+    }
+
+    if (triggered)
     {
         // Start mid-execution capture for the current frame
         mCaptureStartFrame = mFrameIndex + 1;
@@ -9109,8 +9378,9 @@ void FrameCaptureShared::onEndFrame(gl::Context *context)
 
         // Save the index files after the last frame.
         writeCppReplayIndexFiles(context, false);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, &mBinaryData,
+                       mReplayWriter.getFileWriter());
+        mReplayWriter.getFileWriter()->waitIdle();
         mWroteIndexFile = true;
         INFO() << "Finished recording graphics API capture";
     }
@@ -9133,8 +9403,9 @@ void FrameCaptureShared::onDestroyContext(const gl::Context *context)
         mFrameIndex -= 1;
         mCaptureEndFrame = mFrameIndex;
         writeCppReplayIndexFiles(context, true);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, &mBinaryData,
+                       mReplayWriter.getFileWriter());
+        mReplayWriter.getFileWriter()->waitIdle();
         mWroteIndexFile = true;
     }
 }
@@ -9900,7 +10171,13 @@ void FrameCaptureShared::writeMainContextCppReplay(const gl::Context *context,
         std::stringstream headerStream;
         std::stringstream bodyStream;
 
-        if (context->getShareGroup()->getContexts().size() > 1)
+        if (context->getShareGroup()->getContexts().size() > 1 && mThreadedReplay)
+        {
+            WriteCppReplayFunctionWithPartsThreaded(
+                context->id(), ReplayFunc::Replay, mReplayWriter, frameIndex, &mBinaryData,
+                mFrameCalls, headerStream, bodyStream, &mResourceIDBufferSize);
+        }
+        else if (context->getShareGroup()->getContexts().size() > 1)
         {
             // Only ReplayFunc::Replay trace file output functions are affected by multi-context
             // call grouping so they can safely be special-cased here.
@@ -10138,6 +10415,104 @@ void CaptureShaderStrings(GLsizei count,
 }
 
 // ReplayWriter implementation.
+CaptureFileWriter::CaptureFileWriter() : mPendingBytes(0), mIsWriting(false), mExit(false) {}
+
+CaptureFileWriter::~CaptureFileWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mWorkAvailableCondition.notify_one();
+
+    // The thread writes the remaining files before exiting.
+    if (mThread.joinable())
+    {
+        mThread.join();
+    }
+}
+
+void CaptureFileWriter::writeFile(const std::string &filePath, std::string &&contents)
+{
+    enqueue({filePath, std::move(contents), {}, false});
+}
+
+void CaptureFileWriter::writeBinaryFile(const std::string &filePath,
+                                        std::vector<uint8_t> &&data,
+                                        bool compression)
+{
+    enqueue({filePath, {}, std::move(data), compression});
+}
+
+void CaptureFileWriter::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mWorkDoneCondition.wait(lock, [this] { return mPendingFiles.empty() && !mIsWriting; });
+}
+
+void CaptureFileWriter::enqueue(PendingFile &&file)
+{
+    // Enough for a number of frames of a heavy capture to be in flight.
+    constexpr size_t kMaxPendingBytes = 256 * 1024 * 1024;
+
+    const size_t size = file.contents.size() + file.binaryData.size();
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    if (!mThread.joinable())
+    {
+        mThread = std::thread(&CaptureFileWriter::processFiles, this);
+    }
+
+    // A file larger than the limit waits for all files before it to be written.
+    mWorkDoneCondition.wait(
+        lock, [&] { return mPendingBytes == 0 || mPendingBytes + size <= kMaxPendingBytes; });
+
+    mPendingBytes += size;
+    mPendingFiles.push_back(std::move(file));
+    lock.unlock();
+
+    mWorkAvailableCondition.notify_one();
+}
+
+void CaptureFileWriter::processFiles()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mWorkAvailableCondition.wait(lock, [this] { return mExit || !mPendingFiles.empty(); });
+        if (mPendingFiles.empty())
+        {
+            return;
+        }
+
+        PendingFile file = std::move(mPendingFiles.front());
+        mPendingFiles.pop_front();
+        mIsWriting = true;
+        lock.unlock();
+
+        {
+            SaveFileHelper saveFile(file.filePath);
+            if (!file.contents.empty())
+            {
+                saveFile << file.contents;
+            }
+            else if (file.compression)
+            {
+                SaveGzipCompressedData(&saveFile, file.binaryData);
+            }
+            else
+            {
+                saveFile.write(file.binaryData.data(), file.binaryData.size());
+            }
+        }
+
+        lock.lock();
+        mPendingBytes -= file.contents.size() + file.binaryData.size();
+        mIsWriting = false;
+        mWorkDoneCondition.notify_all();
+    }
+}
+
 ReplayWriter::ReplayWriter()
     : mSourceFileExtension(kDefaultSourceFileExt),
       mSourceFileSizeThreshold(kDefaultSourceFileSizeThreshold),
@@ -10326,7 +10701,7 @@ void ReplayWriter::saveHeader()
     headerPathStream << mFilenamePattern << ".h";
     std::string headerPath = headerPathStream.str();
 
-    SaveFileHelper saveH(headerPath);
+    std::stringstream saveH;
 
     saveH << mHeaderPrologue << "\n";
 
@@ -10353,6 +10728,7 @@ void ReplayWriter::saveHeader()
     mPrivateFunctionPrototypes.clear();
     mGlobalVariableDeclarations.clear();
 
+    mFileWriter.writeFile(headerPath, saveH.str());
     addWrittenFile(headerPath);
 }
 
@@ -10382,7 +10758,8 @@ void ReplayWriter::saveSetupFile()
 
 void ReplayWriter::writeReplaySource(const std::string &filename)
 {
-    SaveFileHelper saveCpp(filename);
+    // The source is only assembled here; the file writer writes it out.
+    std::stringstream saveCpp;
 
     saveCpp << mSourcePrologue << "\n";
     for (const std::string &header : mReplayHeaders)
@@ -10421,6 +10798,7 @@ void ReplayWriter::writeReplaySource(const std::string &filename)
     mPrivateFunctions.clear();
     mPublicFunctions.clear();
 
+    mFileWriter.writeFile(filename, saveCpp.str());
     addWrittenFile(filename);
 }
 
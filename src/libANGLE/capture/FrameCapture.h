@@ -10,6 +10,11 @@
 #ifndef LIBANGLE_FRAME_CAPTURE_H_
 #define LIBANGLE_FRAME_CAPTURE_H_
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "common/PackedEnums.h"
 #include "common/SimpleMutex.h"
 #include "common/frame_capture_utils.h"
@@ -71,12 +76,53 @@ class DataTracker final : angle::NonCopyable
     StringCounters mStringCounters;
 };
 
+// Writes the files of the capture on a thread of its own, so that file I/O and compression don't
+// hold up the application being captured.  The memory held by the files waiting to be written is
+// bounded, beyond which writing a file waits for the thread to catch up.
+class CaptureFileWriter final : angle::NonCopyable
+{
+  public:
+    CaptureFileWriter();
+    ~CaptureFileWriter();
+
+    void writeFile(const std::string &filePath, std::string &&contents);
+    void writeBinaryFile(const std::string &filePath,
+                         std::vector<uint8_t> &&data,
+                         bool compression);
+
+    // Waits until all files are written.
+    void waitIdle();
+
+  private:
+    struct PendingFile
+    {
+        std::string filePath;
+        std::string contents;
+        std::vector<uint8_t> binaryData;
+        bool compression;
+    };
+
+    void enqueue(PendingFile &&file);
+    void processFiles();
+
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailableCondition;
+    std::condition_variable mWorkDoneCondition;
+    std::deque<PendingFile> mPendingFiles;
+    size_t mPendingBytes;
+    bool mIsWriting;
+    bool mExit;
+    std::thread mThread;
+};
+
 class ReplayWriter final : angle::NonCopyable
 {
   public:
     ReplayWriter();
     ~ReplayWriter();
 
+    CaptureFileWriter *getFileWriter() { return &mFileWriter; }
+
     void setSourceFileExtension(const char *ext);
     void setSourceFileSizeThreshold(size_t sourceFileSizeThreshold);
     void setFilenamePattern(const std::string &pattern);
@@ -132,6 +178,8 @@ class ReplayWriter final : angle::NonCopyable
     std::vector<std::string> mPrivateFunctions;
 
     std::vector<std::string> mWrittenFiles;
+
+    CaptureFileWriter mFileWriter;
 };
 
 using BufferCalls = std::map<GLuint, std::vector<CallCapture>>;
@@ -816,6 +864,7 @@ class FrameCaptureShared final : angle::NonCopyable
     BufferDataMap mBufferDataMap;
     bool mValidateSerializedState = false;
     std::string mValidationExpression;
+    bool mThreadedReplay = false;
     PackedEnumMap<ResourceIDType, uint32_t> mMaxAccessedResourceIDs;
     CoherentBufferTracker mCoherentBufferTracker;
     angle::SimpleMutex mFrameCaptureMutex;
@@ -827,6 +876,10 @@ class FrameCaptureShared final : angle::NonCopyable
     // Initialize it to the number of frames you want to capture, and then clear the value to 0 when
     // you reach the content you want to capture. Currently only available on Android.
     uint32_t mCaptureTrigger;
+    // When set along with the capture trigger, the capture is also triggered by a frame that takes
+    // longer than this to complete.
+    double mCaptureHitchThresholdMs;
+    double mLastFrameEndTime;
 
     bool mCaptureActive;
     std::vector<uint32_t> mActiveFrameIndices;
@@ -1128,6 +1128,21 @@ CallCapture CaptureQueryDisplayAttribANGLE(egl::Thread *thread,
     return CallCapture(angle::EntryPoint::EGLQueryDisplayAttribANGLE, std::move(paramBuffer));
 }
 
+CallCapture CaptureHandleMemoryPressureANGLE(egl::Thread *thread,
+                                             bool isCallValid,
+                                             egl::Display *dpyPacked,
+                                             gl::ContextID ctxPacked,
+                                             EGLint level)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("dpyPacked", ParamType::Tegl_DisplayPointer, dpyPacked);
+    paramBuffer.addValueParam("ctxPacked", ParamType::TContextID, ctxPacked);
+    paramBuffer.addValueParam("level", ParamType::TEGLint, level);
+
+    return CallCapture(angle::EntryPoint::EGLHandleMemoryPressureANGLE, std::move(paramBuffer));
+}
+
 CallCapture CaptureCopyMetalSharedEventANGLE(egl::Thread *thread,
                                              bool isCallValid,
                                              egl::Display *dpyPacked,
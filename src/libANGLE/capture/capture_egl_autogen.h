@@ -342,6 +342,11 @@ angle::CallCapture CaptureQueryDisplayAttribANGLE(egl::Thread *thread,
                                                   EGLint attribute,
                                                   EGLAttrib *value,
                                                   EGLBoolean returnValue);
+angle::CallCapture CaptureHandleMemoryPressureANGLE(egl::Thread *thread,
+                                                    bool isCallValid,
+                                                    egl::Display *dpyPacked,
+                                                    gl::ContextID ctxPacked,
+                                                    EGLint level);
 angle::CallCapture CaptureCopyMetalSharedEventANGLE(egl::Thread *thread,
                                                     bool isCallValid,
                                                     egl::Display *dpyPacked,
@@ -4649,6 +4649,20 @@ void QueryContextAttrib(const gl::Context *context, EGLint attribute, EGLint *va
             value[1]        = static_cast<GLint>(memory >> 32);
         }
         break;
+        case EGL_CONTEXT_MEMORY_USAGE_CATEGORY_COUNT_ANGLE:
+            *value = static_cast<EGLint>(angle::EnumSize<gl::MemoryUsageCategory>());
+            break;
+        case EGL_CONTEXT_MEMORY_USAGE_BREAKDOWN_ANGLE:
+        {
+            gl::MemoryUsageBreakdown breakdown;
+            context->getMemoryUsageBreakdown(&breakdown);
+            for (uint64_t memory : breakdown)
+            {
+                *value++ = static_cast<GLint>(memory & 0xffffffff);
+                *value++ = static_cast<GLint>(memory >> 32);
+            }
+        }
+        break;
         default:
             UNREACHABLE();
             break;
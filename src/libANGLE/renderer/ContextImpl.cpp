@@ -103,4 +103,14 @@ const angle::PerfMonitorCounterGroups &ContextImpl::getPerfMonitorCounters()
     static angle::base::NoDestructor<angle::PerfMonitorCounterGroups> sCounters;
     return *sCounters;
 }
+
+void ContextImpl::getMemoryUsageBreakdown(const gl::Context *context,
+                                          gl::MemoryUsageBreakdown *breakdown) const
+{}
+
+angle::Result ContextImpl::handleMemoryPressure(const gl::Context *context,
+                                                gl::MemoryPressureLevel level)
+{
+    return angle::Result::Continue;
+}
 }  // namespace rx
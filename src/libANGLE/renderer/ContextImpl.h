@@ -194,6 +194,11 @@ class ContextImpl : public GLImplFactory
     // KHR_parallel_shader_compile
     virtual void setMaxShaderCompilerThreads(GLuint count) {}
 
+    // Brackets the deletion of several objects by one call, such as glDeleteTextures, so the
+    // backend can release their resources together.
+    virtual void beginObjectDeletionBatch() {}
+    virtual void endObjectDeletionBatch() {}
+
     // GL_ANGLE_texture_storage_external
     virtual void invalidateTexture(gl::TextureType target);
 
@@ -281,6 +286,15 @@ class ContextImpl : public GLImplFactory
     // AMD_performance_monitor
     virtual const angle::PerfMonitorCounterGroups &getPerfMonitorCounters();
 
+    // EGL_ANGLE_memory_usage_report.  Adds the memory the backend tracks to the breakdown; the
+    // categories it doesn't track are left as they are.
+    virtual void getMemoryUsageBreakdown(const gl::Context *context,
+                                         gl::MemoryUsageBreakdown *breakdown) const;
+
+    // EGL_ANGLE_memory_pressure.  Releases the backend's cached memory; does nothing by default.
+    virtual angle::Result handleMemoryPressure(const gl::Context *context,
+                                               gl::MemoryPressureLevel level);
+
   protected:
     const gl::State &mState;
     gl::MemoryProgramCache *mMemoryProgramCache;
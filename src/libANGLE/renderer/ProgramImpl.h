@@ -62,13 +62,14 @@ class LinkTask
   public:
     virtual ~LinkTask() = default;
     // Used for link()
-    // Backends should populate only one of linkSubTasksOut or postLinkSubTasksOut.
+    // If both linkSubTasksOut and postLinkSubTasksOut are populated, the post-link subtasks are
+    // scheduled only after all link subtasks are finished.
     virtual void link(const gl::ProgramLinkedResources &resources,
                       const gl::ProgramMergedVaryings &mergedVaryings,
                       std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
                       std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
     // Used for load()
-    // Backends should populate only one of linkSubTasksOut or postLinkSubTasksOut.
+    // The same ordering as link() applies to the subtasks.
     virtual void load(std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
                       std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
     virtual angle::Result getResult(const gl::Context *context, gl::InfoLog &infoLog) = 0;
@@ -9,49 +9,6 @@
 namespace rx
 {
 
-// Returns an aligned buffer to read the input from
-template <typename T, size_t inputComponentCount>
-inline const T *GetAlignedOffsetInput(const T *offsetInput, T *alignedElement)
-{
-    if (reinterpret_cast<uintptr_t>(offsetInput) % sizeof(T) != 0)
-    {
-        // Applications may pass in arbitrarily aligned buffers as input.
-        // Certain architectures have restrictions regarding unaligned reads. Specifically, we crash
-        // on armeabi-v7a devices with a SIGBUS error when performing such operations. arm64 and
-        // x86-64 devices do not appear to have such issues.
-        //
-        // The workaround is to detect if the input buffer is unaligned and if so, perform a
-        // byte-wise copy of the unaligned portion and a memcpy of the rest of the buffer.
-        uint8_t *alignedBuffer               = reinterpret_cast<uint8_t *>(&alignedElement[0]);
-        uintptr_t unalignedInputStartAddress = reinterpret_cast<uintptr_t>(offsetInput);
-        constexpr size_t kAlignmentMinusOne  = sizeof(T) - 1;
-        uintptr_t alignedInputStartAddress =
-            (reinterpret_cast<uintptr_t>(offsetInput) + kAlignmentMinusOne) & ~(kAlignmentMinusOne);
-        ASSERT(alignedInputStartAddress >= unalignedInputStartAddress);
-
-        const size_t totalBytesToCopy     = sizeof(T) * inputComponentCount;
-        const size_t unalignedBytesToCopy = alignedInputStartAddress - unalignedInputStartAddress;
-        ASSERT(totalBytesToCopy >= unalignedBytesToCopy);
-
-        // byte-wise copy of unaligned portion
-        for (size_t i = 0; i < unalignedBytesToCopy; i++)
-        {
-            alignedBuffer[i] = reinterpret_cast<const uint8_t *>(&offsetInput[0])[i];
-        }
-
-        // memcpy remaining buffer
-        memcpy(&alignedBuffer[unalignedBytesToCopy],
-               &reinterpret_cast<const uint8_t *>(&offsetInput[0])[unalignedBytesToCopy],
-               totalBytesToCopy - unalignedBytesToCopy);
-
-        return alignedElement;
-    }
-    else
-    {
-        return offsetInput;
-    }
-}
-
 template <typename T,
           size_t inputComponentCount,
           size_t outputComponentCount,
@@ -70,45 +27,30 @@ inline void CopyNativeVertexData(const uint8_t *input, size_t stride, size_t cou
     {
         for (size_t i = 0; i < count; i++)
         {
-            const T *offsetInput = reinterpret_cast<const T *>(input + (i * stride));
-            T offsetInputAligned[inputComponentCount];
-            offsetInput =
-                GetAlignedOffsetInput<T, inputComponentCount>(offsetInput, &offsetInputAligned[0]);
-
-            T *offsetOutput = reinterpret_cast<T *>(output) + i * outputComponentCount;
-
-            memcpy(offsetOutput, offsetInput, attribSize);
+            // A byte-wise copy is safe for the arbitrarily aligned input applications may pass in.
+            memcpy(output + i * attribSize, input + (i * stride), attribSize);
         }
         return;
     }
 
-    const T defaultAlphaValue                = gl::bitCast<T>(alphaDefaultValueBits);
-    const size_t lastNonAlphaOutputComponent = std::min<size_t>(outputComponentCount, 3);
+    const T defaultAlphaValue = gl::bitCast<T>(alphaDefaultValueBits);
 
     for (size_t i = 0; i < count; i++)
     {
-        const T *offsetInput = reinterpret_cast<const T *>(input + (i * stride));
-        T offsetInputAligned[inputComponentCount];
-        ASSERT(sizeof(offsetInputAligned) == attribSize);
-        offsetInput =
-            GetAlignedOffsetInput<T, inputComponentCount>(offsetInput, &offsetInputAligned[0]);
-
-        T *offsetOutput = reinterpret_cast<T *>(output) + i * outputComponentCount;
-
-        memcpy(offsetOutput, offsetInput, attribSize);
-
-        if (inputComponentCount < lastNonAlphaOutputComponent)
-        {
-            // Set the remaining G/B channels to 0.
-            size_t numComponents = (lastNonAlphaOutputComponent - inputComponentCount);
-            memset(&offsetOutput[inputComponentCount], 0, numComponents * sizeof(T));
-        }
-
+        // The vertex is assembled in a local array, which handles unaligned input and lets the
+        // compiler turn the fixed-size copies into a single load and store.
+        T vertex[outputComponentCount] = {};
+        ASSERT(inputComponentCount < outputComponentCount);
+        memcpy(vertex, input + (i * stride), attribSize);
+
+        // The remaining G/B channels are left to 0.  Set the remaining alpha channel to the
+        // defaultAlphaValue.
         if (inputComponentCount < outputComponentCount && outputComponentCount == 4)
         {
-            // Set the remaining alpha channel to the defaultAlphaValue.
-            offsetOutput[3] = defaultAlphaValue;
+            vertex[3] = defaultAlphaValue;
         }
+
+        memcpy(output + i * sizeof(vertex), vertex, sizeof(vertex));
     }
 }
 
@@ -244,61 +186,52 @@ inline void CopyToFloatVertexData(const uint8_t *input,
 
     for (size_t i = 0; i < count; i++)
     {
-        const T *offsetInput = reinterpret_cast<const T *>(input + (stride * i));
-        outputType *offsetOutput =
-            reinterpret_cast<outputType *>(output) + i * outputComponentCount;
-
-        T offsetInputAligned[inputComponentCount];
-        offsetInput =
-            GetAlignedOffsetInput<T, inputComponentCount>(offsetInput, &offsetInputAligned[0]);
+        // The vertex is converted between local arrays, which handles unaligned input and lets the
+        // compiler turn the fixed-size loops below into vector operations.
+        T inputValues[inputComponentCount];
+        memcpy(inputValues, input + (stride * i), sizeof(inputValues));
 
+        float results[inputComponentCount];
         for (size_t j = 0; j < inputComponentCount; j++)
         {
-            float result = 0;
+            results[j] = static_cast<float>(inputValues[j]);
 
             if (normalized)
             {
+                results[j] /= static_cast<float>(NL::max());
                 if (NL::is_signed)
                 {
-                    result = static_cast<float>(offsetInput[j]) / static_cast<float>(NL::max());
-                    result = result >= -1.0f ? result : -1.0f;
+                    results[j] = results[j] >= -1.0f ? results[j] : -1.0f;
                 }
-                else
-                {
-                    result = static_cast<float>(offsetInput[j]) / static_cast<float>(NL::max());
-                }
-            }
-            else
-            {
-                result = static_cast<float>(offsetInput[j]);
             }
+        }
 
+        outputType outputValues[outputComponentCount] = {};
+        for (size_t j = 0; j < inputComponentCount; j++)
+        {
             if (toHalf)
             {
-                offsetOutput[j] = gl::float32ToFloat16(result);
+                outputValues[j] = gl::float32ToFloat16(results[j]);
             }
             else
             {
-                offsetOutput[j] = static_cast<outputType>(result);
+                outputValues[j] = static_cast<outputType>(results[j]);
             }
         }
 
-        for (size_t j = inputComponentCount; j < outputComponentCount; j++)
-        {
-            offsetOutput[j] = 0;
-        }
-
         if (inputComponentCount < 4 && outputComponentCount == 4)
         {
             if (toHalf)
             {
-                offsetOutput[3] = gl::Float16One;
+                outputValues[3] = gl::Float16One;
             }
             else
             {
-                offsetOutput[3] = static_cast<outputType>(gl::Float32One);
+                outputValues[3] = static_cast<outputType>(gl::Float32One);
             }
         }
+
+        memcpy(output + i * sizeof(outputValues), outputValues, sizeof(outputValues));
     }
 }
 
@@ -554,7 +487,8 @@ inline void CopyXYZ10W2ToXYZWFloatVertexData(const uint8_t *input,
 
     for (size_t i = 0; i < count; i++)
     {
-        GLuint packedValue    = *reinterpret_cast<const GLuint *>(input + (i * stride));
+        GLuint packedValue;
+        memcpy(&packedValue, input + (i * stride), sizeof(packedValue));
         uint8_t *offsetOutput = output + (i * outputComponentSize * componentCount);
 
         priv::CopyPackedRGB<isSigned, normalized, toFloat, toHalf>(
@@ -586,7 +520,8 @@ inline void CopyXYZ10ToXYZWFloatVertexData(const uint8_t *input,
 
     for (size_t i = 0; i < count; i++)
     {
-        GLuint packedValue    = *reinterpret_cast<const GLuint *>(input + (i * stride));
+        GLuint packedValue;
+        memcpy(&packedValue, input + (i * stride), sizeof(packedValue));
         uint8_t *offsetOutput = output + (i * outputComponentSize * componentCount);
 
         priv::CopyPackedRGB<isSigned, normalized, true, toHalf>(
@@ -619,7 +554,8 @@ inline void CopyW2XYZ10ToXYZWFloatVertexData(const uint8_t *input,
 
     for (size_t i = 0; i < count; i++)
     {
-        GLuint packedValue    = *reinterpret_cast<const GLuint *>(input + (i * stride));
+        GLuint packedValue;
+        memcpy(&packedValue, input + (i * stride), sizeof(packedValue));
         uint8_t *offsetOutput = output + (i * outputComponentSize * componentCount);
 
         priv::CopyPackedRGB<isSigned, normalized, true, toHalf>(
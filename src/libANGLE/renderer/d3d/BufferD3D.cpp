@@ -17,6 +17,88 @@
 namespace rx
 {
 
+TranslatedIndexCache::TranslatedIndexCache()
+    : mSrcType(gl::DrawElementsType::InvalidEnum),
+      mDstType(gl::DrawElementsType::InvalidEnum),
+      mPrimitiveRestartFixedIndex(false),
+      mIndexCount(0),
+      mEntireBufferDirty(true)
+{}
+
+TranslatedIndexCache::~TranslatedIndexCache() {}
+
+bool TranslatedIndexCache::matches(gl::DrawElementsType srcType,
+                                   gl::DrawElementsType dstType,
+                                   bool primitiveRestartFixedIndex,
+                                   size_t indexCount) const
+{
+    return mSrcType == srcType && mDstType == dstType &&
+           mPrimitiveRestartFixedIndex == primitiveRestartFixedIndex && mIndexCount == indexCount;
+}
+
+bool TranslatedIndexCache::reset(gl::DrawElementsType srcType,
+                                 gl::DrawElementsType dstType,
+                                 bool primitiveRestartFixedIndex,
+                                 size_t indexCount)
+{
+    mSrcType                    = gl::DrawElementsType::InvalidEnum;
+    mDstType                    = gl::DrawElementsType::InvalidEnum;
+    mPrimitiveRestartFixedIndex = false;
+    mIndexCount                 = 0;
+    setEntireBufferDirty();
+
+    if (!mData.resize(indexCount * gl::GetDrawElementsTypeSize(dstType)))
+    {
+        return false;
+    }
+
+    mSrcType                    = srcType;
+    mDstType                    = dstType;
+    mPrimitiveRestartFixedIndex = primitiveRestartFixedIndex;
+    mIndexCount                 = indexCount;
+    return true;
+}
+
+void TranslatedIndexCache::addDirtyRange(const gl::Range<size_t> &range)
+{
+    if (!mEntireBufferDirty && !range.empty())
+    {
+        mDirtyRanges.emplace_back(range);
+    }
+}
+
+// Like ConversionBuffer::consolidateDirtyRanges() in the Vulkan backend, sorts the ranges and
+// merges the ones that overlap or touch, leaving the merged ones empty.
+void TranslatedIndexCache::consolidateDirtyRanges()
+{
+    ASSERT(!mEntireBufferDirty);
+
+    auto comp = [](const gl::Range<size_t> &a, const gl::Range<size_t> &b) -> bool {
+        return a.low() < b.low();
+    };
+    std::sort(mDirtyRanges.begin(), mDirtyRanges.end(), comp);
+
+    size_t prev = 0;
+    for (size_t i = 1; i < mDirtyRanges.size(); i++)
+    {
+        if (mDirtyRanges[prev].intersectsOrContinuous(mDirtyRanges[i]))
+        {
+            mDirtyRanges[prev].merge(mDirtyRanges[i]);
+            mDirtyRanges[i].invalidate();
+        }
+        else
+        {
+            prev = i;
+        }
+    }
+}
+
+void TranslatedIndexCache::clearDirty()
+{
+    mEntireBufferDirty = false;
+    mDirtyRanges.clear();
+}
+
 unsigned int BufferD3D::mNextSerial = 1;
 
 BufferD3D::BufferD3D(const gl::BufferState &state, BufferFactoryD3D *factory)
@@ -141,6 +223,18 @@ StaticVertexBufferInterface *BufferD3D::getStaticVertexBuffer(const gl::VertexAt
 }
 
 void BufferD3D::invalidateStaticData(const gl::Context *context)
+{
+    mTranslatedIndexCache.setEntireBufferDirty();
+    invalidateStaticBuffers(context);
+}
+
+void BufferD3D::invalidateStaticDataRange(const gl::Context *context, size_t offset, size_t size)
+{
+    mTranslatedIndexCache.addDirtyRange(gl::Range<size_t>(offset, offset + size));
+    invalidateStaticBuffers(context);
+}
+
+void BufferD3D::invalidateStaticBuffers(const gl::Context *context)
 {
     emptyStaticBufferCache();
 
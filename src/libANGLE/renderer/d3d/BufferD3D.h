@@ -9,6 +9,8 @@
 #ifndef LIBANGLE_RENDERER_D3D_BUFFERD3D_H_
 #define LIBANGLE_RENDERER_D3D_BUFFERD3D_H_
 
+#include "common/MemoryBuffer.h"
+#include "common/mathutil.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/BufferImpl.h"
 
@@ -33,6 +35,48 @@ enum class D3DBufferUsage
     DYNAMIC,
 };
 
+// The indices of a buffer translated to another index type, kept across partial updates of the
+// buffer so that only the modified ranges are translated again.  Draws that stream their indices
+// copy them from here instead of translating them every time.
+class TranslatedIndexCache final : angle::NonCopyable
+{
+  public:
+    TranslatedIndexCache();
+    ~TranslatedIndexCache();
+
+    bool matches(gl::DrawElementsType srcType,
+                 gl::DrawElementsType dstType,
+                 bool primitiveRestartFixedIndex,
+                 size_t indexCount) const;
+    // Allocates the cache for a new translation, with all of it dirty.
+    [[nodiscard]] bool reset(gl::DrawElementsType srcType,
+                             gl::DrawElementsType dstType,
+                             bool primitiveRestartFixedIndex,
+                             size_t indexCount);
+
+    bool dirty() const { return mEntireBufferDirty || !mDirtyRanges.empty(); }
+    bool isEntireBufferDirty() const { return mEntireBufferDirty; }
+    void setEntireBufferDirty() { mEntireBufferDirty = true; }
+    // The range is in bytes of the source buffer.
+    void addDirtyRange(const gl::Range<size_t> &range);
+    void consolidateDirtyRanges();
+    const std::vector<gl::Range<size_t>> &getDirtyRanges() const { return mDirtyRanges; }
+    void clearDirty();
+
+    uint8_t *getData() { return mData.data(); }
+
+  private:
+    angle::MemoryBuffer mData;
+    gl::DrawElementsType mSrcType;
+    gl::DrawElementsType mDstType;
+    bool mPrimitiveRestartFixedIndex;
+    size_t mIndexCount;
+
+    // mDirtyRanges is ignored when mEntireBufferDirty is true.  The ranges may overlap.
+    bool mEntireBufferDirty;
+    std::vector<gl::Range<size_t>> mDirtyRanges;
+};
+
 class BufferD3D : public BufferImpl
 {
   public:
@@ -52,8 +96,13 @@ class BufferD3D : public BufferImpl
                                                        const gl::VertexBinding &binding);
     StaticIndexBufferInterface *getStaticIndexBuffer();
 
+    TranslatedIndexCache *getTranslatedIndexCache() { return &mTranslatedIndexCache; }
+
     virtual void initializeStaticData(const gl::Context *context);
     virtual void invalidateStaticData(const gl::Context *context);
+    // Like invalidateStaticData(), when only [offset, offset + size) has been modified.  The
+    // translated index cache keeps the rest of its data.
+    virtual void invalidateStaticDataRange(const gl::Context *context, size_t offset, size_t size);
 
     void promoteStaticUsage(const gl::Context *context, size_t dataSize);
 
@@ -71,6 +120,7 @@ class BufferD3D : public BufferImpl
     void updateSerial();
     void updateD3DBufferUsage(const gl::Context *context, gl::BufferUsage usage);
     void emptyStaticBufferCache();
+    void invalidateStaticBuffers(const gl::Context *context);
 
     BufferFactoryD3D *mFactory;
     unsigned int mSerial;
@@ -82,6 +132,7 @@ class BufferD3D : public BufferImpl
     unsigned int mStaticVertexBufferOutOfDate;
     size_t mUnmodifiedDataUse;
     D3DBufferUsage mUsage;
+    TranslatedIndexCache mTranslatedIndexCache;
 };
 
 }  // namespace rx
@@ -19,6 +19,30 @@
 
 namespace
 {
+// The cache keeps both the HLSL (as part of the key) and the compiled blob.
+constexpr size_t kCompiledBinaryCacheSize = 8 * 1024 * 1024;
+
+std::string GetCompiledBinaryCacheKey(const std::string &hlsl,
+                                      const std::string &profile,
+                                      const std::vector<rx::CompileConfig> &configs,
+                                      const D3D_SHADER_MACRO *macros)
+{
+    std::ostringstream stream;
+    stream << profile << "\n";
+    for (const rx::CompileConfig &config : configs)
+    {
+        stream << config.flags << ",";
+    }
+    stream << "\n";
+    for (const D3D_SHADER_MACRO *macro = macros; macro != nullptr && macro->Name != nullptr;
+         ++macro)
+    {
+        stream << macro->Name << "=" << macro->Definition << ";";
+    }
+    stream << "\n" << hlsl;
+    return stream.str();
+}
+
 #if ANGLE_APPEND_ASSEMBLY_TO_SHADER_DEBUG_INFO
 #    ifdef CREATE_COMPILER_FLAG_INFO
 #        undef CREATE_COMPILER_FLAG_INFO
@@ -103,7 +127,8 @@ HLSLCompiler::HLSLCompiler()
     : mInitialized(false),
       mD3DCompilerModule(nullptr),
       mD3DCompileFunc(nullptr),
-      mD3DDisassembleFunc(nullptr)
+      mD3DDisassembleFunc(nullptr),
+      mCompiledBinaryCache(kCompiledBinaryCacheSize)
 {}
 
 HLSLCompiler::~HLSLCompiler()
@@ -181,6 +206,11 @@ angle::Result HLSLCompiler::ensureInitialized(d3d::Context *context)
 
 void HLSLCompiler::release()
 {
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mCompiledBinaryCacheMutex);
+        mCompiledBinaryCache.clear();
+    }
+
     if (mInitialized)
     {
         FreeLibrary(mD3DCompilerModule);
@@ -207,6 +237,21 @@ angle::Result HLSLCompiler::compileToBinary(d3d::Context *context,
 #endif
     ASSERT(mD3DCompileFunc);
 
+    const std::string cacheKey =
+        GetCompiledBinaryCacheKey(hlsl, profile, configs, overrideMacros);
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mCompiledBinaryCacheMutex);
+        const CompiledBinary *cached = nullptr;
+        if (mCompiledBinaryCache.get(cacheKey, &cached))
+        {
+            ANGLE_TRACE_EVENT0("gpu.angle", "HLSLCompiler::compileToBinary cache hit");
+            cached->binary->AddRef();
+            *outCompiledBlob = cached->binary.Get();
+            (*outDebugInfo) += cached->debugInfo;
+            return angle::Result::Continue;
+        }
+    }
+
 #if !defined(ANGLE_ENABLE_WINDOWS_UWP) && defined(ANGLE_ENABLE_DEBUG_TRACE)
     std::string sourcePath = angle::CreateTemporaryFile().value();
     std::ostringstream stream;
@@ -299,6 +344,7 @@ angle::Result HLSLCompiler::compileToBinary(d3d::Context *context,
 
             *outCompiledBlob = binary;
 
+            const size_t debugInfoStart = outDebugInfo->size();
             (*outDebugInfo) +=
                 "// COMPILER INPUT HLSL BEGIN\n\n" + hlsl + "\n// COMPILER INPUT HLSL END\n";
 
@@ -331,6 +377,16 @@ angle::Result HLSLCompiler::compileToBinary(d3d::Context *context,
             ANGLE_TRY(disassembleBinary(context, binary, &disassembly));
             (*outDebugInfo) += "\n" + disassembly + "\n// ASSEMBLY END\n";
 #endif  // ANGLE_APPEND_ASSEMBLY_TO_SHADER_DEBUG_INFO
+
+            CompiledBinary compiledBinary;
+            compiledBinary.binary    = binary;
+            compiledBinary.debugInfo = outDebugInfo->substr(debugInfoStart);
+            const size_t cacheSize   = cacheKey.size() + binary->GetBufferSize() +
+                                     compiledBinary.debugInfo.size();
+            {
+                std::lock_guard<angle::SimpleMutex> lock(mCompiledBinaryCacheMutex);
+                mCompiledBinaryCache.put(cacheKey, std::move(compiledBinary), cacheSize);
+            }
             return angle::Result::Continue;
         }
 
@@ -10,7 +10,9 @@
 #define LIBANGLE_RENDERER_D3D_HLSLCOMPILER_H_
 
 #include "libANGLE/Error.h"
+#include "libANGLE/SizedMRUCache.h"
 
+#include "common/SimpleMutex.h"
 #include "common/angleutils.h"
 #include "common/platform.h"
 
@@ -47,7 +49,9 @@ class HLSLCompiler : angle::NonCopyable
     void release();
 
     // Attempt to compile a HLSL shader using the supplied configurations, may output a NULL
-    // compiled blob even if no GL errors are returned.
+    // compiled blob even if no GL errors are returned.  Successfully compiled blobs are cached
+    // by their full input, so that identical shaders (e.g. the same variant needed by multiple
+    // programs, or by a program that is relinked) are not compiled again.  Thread-safe.
     angle::Result compileToBinary(d3d::Context *context,
                                   gl::InfoLog &infoLog,
                                   const std::string &hlsl,
@@ -63,10 +67,19 @@ class HLSLCompiler : angle::NonCopyable
     angle::Result ensureInitialized(d3d::Context *context);
 
   private:
+    struct CompiledBinary
+    {
+        angle::ComPtr<ID3DBlob> binary;
+        std::string debugInfo;
+    };
+
     bool mInitialized;
     HMODULE mD3DCompilerModule;
     pD3DCompile mD3DCompileFunc;
     pD3DDisassemble mD3DDisassembleFunc;
+
+    angle::SimpleMutex mCompiledBinaryCacheMutex;
+    angle::SizedMRUCache<std::string, CompiledBinary> mCompiledBinaryCache;
 };
 
 }  // namespace rx
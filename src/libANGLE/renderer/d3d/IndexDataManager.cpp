@@ -109,6 +109,72 @@ angle::Result StreamInIndexBuffer(const gl::Context *context,
     ANGLE_TRY(buffer->unmapBuffer(context));
     return angle::Result::Continue;
 }
+
+// Brings the translated index cache of |buffer| up to date, translating only the ranges that were
+// modified since it was last used.
+angle::Result GetTranslatedIndices(const gl::Context *context,
+                                   BufferD3D *buffer,
+                                   gl::DrawElementsType srcType,
+                                   gl::DrawElementsType dstType,
+                                   bool usePrimitiveRestartFixedIndex,
+                                   const uint8_t **translatedOut)
+{
+    const GLuint srcTypeBytes = gl::GetDrawElementsTypeSize(srcType);
+    const GLuint srcTypeShift = gl::GetDrawElementsTypeShift(srcType);
+    const GLuint dstTypeShift = gl::GetDrawElementsTypeShift(dstType);
+    const size_t indexCount   = buffer->getSize() >> srcTypeShift;
+
+    TranslatedIndexCache *cache = buffer->getTranslatedIndexCache();
+    if (!cache->matches(srcType, dstType, usePrimitiveRestartFixedIndex, indexCount))
+    {
+        ANGLE_CHECK_GL_ALLOC(GetImplAs<ContextD3D>(context),
+                             cache->reset(srcType, dstType, usePrimitiveRestartFixedIndex,
+                                          indexCount));
+    }
+
+    if (cache->dirty() && indexCount > 0)
+    {
+        const uint8_t *bufferData = nullptr;
+        ANGLE_TRY(buffer->getData(context, &bufferData));
+        ASSERT(bufferData != nullptr);
+
+        if (cache->isEntireBufferDirty())
+        {
+            ConvertIndices(srcType, dstType, bufferData, static_cast<GLsizei>(indexCount),
+                           cache->getData(), usePrimitiveRestartFixedIndex);
+        }
+        else
+        {
+            cache->consolidateDirtyRanges();
+            for (const gl::Range<size_t> &range : cache->getDirtyRanges())
+            {
+                if (range.empty())
+                {
+                    continue;
+                }
+
+                // Translate every index the modified bytes are part of.
+                const size_t first = range.low() >> srcTypeShift;
+                const size_t last =
+                    std::min(indexCount, roundUp<size_t>(range.high(), srcTypeBytes) >>
+                                             srcTypeShift);
+                if (first >= last)
+                {
+                    continue;
+                }
+
+                ConvertIndices(srcType, dstType, bufferData + (first << srcTypeShift),
+                               static_cast<GLsizei>(last - first),
+                               cache->getData() + (first << dstTypeShift),
+                               usePrimitiveRestartFixedIndex);
+            }
+        }
+    }
+    cache->clearDirty();
+
+    *translatedOut = cache->getData();
+    return angle::Result::Continue;
+}
 }  // anonymous namespace
 
 // IndexDataManager implementation.
@@ -196,28 +262,59 @@ angle::Result IndexDataManager::prepareIndexData(const gl::Context *context,
         staticBuffer = nullptr;
     }
 
+    // The indices that need translation are taken from the buffer's translated index cache, which
+    // only translates again what was modified since, and then copied.
+    const bool useTranslatedIndexCache = offsetAligned && srcType != dstType;
+
     if (staticBuffer == nullptr || !offsetAligned)
     {
-        const uint8_t *bufferData = nullptr;
-        ANGLE_TRY(buffer->getData(context, &bufferData));
-        ASSERT(bufferData != nullptr);
+        if (useTranslatedIndexCache)
+        {
+            const uint8_t *translatedData = nullptr;
+            ANGLE_TRY(GetTranslatedIndices(context, buffer, srcType, dstType,
+                                           primitiveRestartFixedIndexEnabled, &translatedData));
+
+            const unsigned int translatedOffset = (offset >> srcTypeShift) << dstTypeShift;
+            ANGLE_TRY(streamIndexData(context, translatedData + translatedOffset, count, dstType,
+                                      dstType, false, translated));
+        }
+        else
+        {
+            const uint8_t *bufferData = nullptr;
+            ANGLE_TRY(buffer->getData(context, &bufferData));
+            ASSERT(bufferData != nullptr);
 
-        ANGLE_TRY(streamIndexData(context, bufferData + offset, count, srcType, dstType,
-                                  primitiveRestartFixedIndexEnabled, translated));
+            ANGLE_TRY(streamIndexData(context, bufferData + offset, count, srcType, dstType,
+                                      primitiveRestartFixedIndexEnabled, translated));
+        }
         buffer->promoteStaticUsage(context, count << srcTypeShift);
     }
     else
     {
         if (!staticBufferInitialized)
         {
-            const uint8_t *bufferData = nullptr;
-            ANGLE_TRY(buffer->getData(context, &bufferData));
-            ASSERT(bufferData != nullptr);
-
             unsigned int convertCount =
                 static_cast<unsigned int>(buffer->getSize()) >> srcTypeShift;
-            ANGLE_TRY(StreamInIndexBuffer(context, staticBuffer, bufferData, convertCount, srcType,
-                                          dstType, primitiveRestartFixedIndexEnabled, nullptr));
+
+            if (useTranslatedIndexCache)
+            {
+                const uint8_t *translatedData = nullptr;
+                ANGLE_TRY(GetTranslatedIndices(context, buffer, srcType, dstType,
+                                               primitiveRestartFixedIndexEnabled,
+                                               &translatedData));
+                ANGLE_TRY(StreamInIndexBuffer(context, staticBuffer, translatedData, convertCount,
+                                              dstType, dstType, false, nullptr));
+            }
+            else
+            {
+                const uint8_t *bufferData = nullptr;
+                ANGLE_TRY(buffer->getData(context, &bufferData));
+                ASSERT(bufferData != nullptr);
+
+                ANGLE_TRY(StreamInIndexBuffer(context, staticBuffer, bufferData, convertCount,
+                                              srcType, dstType, primitiveRestartFixedIndexEnabled,
+                                              nullptr));
+            }
         }
         ASSERT(offsetAligned && staticBuffer->getIndexType() == dstType);
 
@@ -7,11 +7,15 @@
 
 #include "libANGLE/renderer/d3d/ProgramExecutableD3D.h"
 
+#include "common/WorkerThread.h"
 #include "common/bitset_utils.h"
 #include "common/string_utils.h"
+#include "libANGLE/Context.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
+#include "libANGLE/VertexArray.h"
 #include "libANGLE/renderer/d3d/FramebufferD3D.h"
+#include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/renderer/d3d/ShaderExecutableD3D.h"
 #include "libANGLE/trace.h"
 
@@ -407,6 +411,67 @@ D3DSampler::D3DSampler() : active(false), logicalTextureUnit(0), textureType(gl:
 
 D3DImage::D3DImage() : active(false), logicalImageUnit(0) {}
 
+// Compiles a vertex executable on a worker thread.  The HLSL is generated beforehand, so the task
+// doesn't access the program executable.
+class ProgramExecutableD3D::CompileVertexExecutableTask final : public angle::Closure,
+                                                                public d3d::Context
+{
+  public:
+    CompileVertexExecutableTask(RendererD3D *renderer,
+                                std::string &&hlsl,
+                                const std::vector<D3DVarying> &streamOutVaryings,
+                                bool separatedOutputBuffers,
+                                const CompilerWorkaroundsD3D &workarounds)
+        : mRenderer(renderer),
+          mHLSL(std::move(hlsl)),
+          mStreamOutVaryings(streamOutVaryings),
+          mSeparatedOutputBuffers(separatedOutputBuffers),
+          mWorkarounds(workarounds),
+          mExecutable(nullptr)
+    {}
+    ~CompileVertexExecutableTask() override { SafeDelete(mExecutable); }
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "CompileVertexExecutableTask::run");
+        if (mRenderer->compileToExecutable(this, mInfoLog, mHLSL, gl::ShaderType::Vertex,
+                                           mStreamOutVaryings, mSeparatedOutputBuffers,
+                                           mWorkarounds, &mExecutable) != angle::Result::Continue)
+        {
+            SafeDelete(mExecutable);
+        }
+    }
+
+    void handleResult(HRESULT hr,
+                      const char *message,
+                      const char *file,
+                      const char *function,
+                      unsigned int line) override
+    {
+        mInfoLog << message;
+    }
+
+    // Returns null if compilation failed.  The caller takes ownership of the executable.
+    ShaderExecutableD3D *releaseExecutable()
+    {
+        ShaderExecutableD3D *executable = mExecutable;
+        mExecutable                     = nullptr;
+        return executable;
+    }
+
+    const gl::InfoLog &getInfoLog() const { return mInfoLog; }
+
+  private:
+    RendererD3D *mRenderer;
+    std::string mHLSL;
+    std::vector<D3DVarying> mStreamOutVaryings;
+    bool mSeparatedOutputBuffers;
+    CompilerWorkaroundsD3D mWorkarounds;
+
+    gl::InfoLog mInfoLog;
+    ShaderExecutableD3D *mExecutable;
+};
+
 unsigned int ProgramExecutableD3D::mCurrentSerial = 1;
 
 ProgramExecutableD3D::ProgramExecutableD3D(const gl::ProgramExecutable *executable)
@@ -423,12 +488,18 @@ ProgramExecutableD3D::ProgramExecutableD3D(const gl::ProgramExecutable *executab
     reset();
 }
 
-ProgramExecutableD3D::~ProgramExecutableD3D() {}
+ProgramExecutableD3D::~ProgramExecutableD3D()
+{
+    waitForPendingVertexExecutables();
+}
 
 void ProgramExecutableD3D::destroy(const gl::Context *context) {}
 
 void ProgramExecutableD3D::reset()
 {
+    waitForPendingVertexExecutables();
+    mCachedFloatConversionAttribs.reset();
+
     mVertexExecutables.clear();
     mPixelExecutables.clear();
     mComputeExecutables.clear();
@@ -1340,15 +1411,7 @@ angle::Result ProgramExecutableD3D::getVertexExecutableForCachedInputLayout(
         return angle::Result::Continue;
     }
 
-    // Generate new dynamic layout with attribute conversions
-    std::string vertexHLSL = DynamicHLSL::GenerateVertexShaderForInputLayout(
-        renderer, mShaderHLSL[gl::ShaderType::Vertex], mCachedInputLayout,
-        mExecutable->getProgramInputs(), mShaderStorageBlocks[gl::ShaderType::Vertex],
-        mPixelShaderKey.size());
-    std::string finalVertexHLSL = DynamicHLSL::GenerateShaderForImage2DBindSignature(
-        *this, gl::ShaderType::Vertex, mAttachedShaders[gl::ShaderType::Vertex], vertexHLSL,
-        mImage2DUniforms[gl::ShaderType::Vertex], mImage2DBindLayoutCache[gl::ShaderType::Vertex],
-        static_cast<unsigned int>(mPixelShaderKey.size()));
+    std::string finalVertexHLSL = generateVertexHLSLForCachedInputLayout(renderer);
 
     // Generate new vertex executable
     ShaderExecutableD3D *vertexExecutable = nullptr;
@@ -1377,6 +1440,224 @@ angle::Result ProgramExecutableD3D::getVertexExecutableForCachedInputLayout(
     return angle::Result::Continue;
 }
 
+ShaderExecutableD3D *ProgramExecutableD3D::getVertexExecutableForInputLayout(
+    RendererD3D *renderer,
+    const gl::InputLayout &inputLayout) const
+{
+    D3DVertexExecutable::Signature signature;
+    D3DVertexExecutable::getSignature(renderer, inputLayout, &signature);
+
+    for (const std::unique_ptr<D3DVertexExecutable> &vertexExecutable : mVertexExecutables)
+    {
+        if (vertexExecutable->matchesSignature(signature))
+        {
+            return vertexExecutable->shaderExecutable();
+        }
+    }
+
+    return nullptr;
+}
+
+std::string ProgramExecutableD3D::generateVertexHLSLForCachedInputLayout(
+    RendererD3D *renderer) const
+{
+    // Generate new dynamic layout with attribute conversions
+    std::string vertexHLSL = DynamicHLSL::GenerateVertexShaderForInputLayout(
+        renderer, mShaderHLSL[gl::ShaderType::Vertex], mCachedInputLayout,
+        mExecutable->getProgramInputs(), mShaderStorageBlocks[gl::ShaderType::Vertex],
+        mPixelShaderKey.size());
+    return DynamicHLSL::GenerateShaderForImage2DBindSignature(
+        *this, gl::ShaderType::Vertex, mAttachedShaders[gl::ShaderType::Vertex], vertexHLSL,
+        mImage2DUniforms[gl::ShaderType::Vertex], mImage2DBindLayoutCache[gl::ShaderType::Vertex],
+        static_cast<unsigned int>(mPixelShaderKey.size()));
+}
+
+angle::Result ProgramExecutableD3D::updateCachedInputLayoutWithAsyncCompile(
+    const gl::Context *context,
+    d3d::Context *contextD3D,
+    RendererD3D *renderer,
+    UniqueSerial associatedSerial,
+    gl::AttributesMask *floatConversionAttribsOut)
+{
+    if (mCurrentVertexArrayStateSerial == associatedSerial)
+    {
+        *floatConversionAttribsOut = mCachedFloatConversionAttribs;
+        return angle::Result::Continue;
+    }
+
+    const gl::State &state = context->getState();
+    updateCachedInputLayout(renderer, associatedSerial, state);
+    floatConversionAttribsOut->reset();
+
+    if (mCachedVertexExecutableIndex.valid())
+    {
+        return angle::Result::Continue;
+    }
+
+    auto matchesCachedSignature = [this](const PendingVertexExecutable &pending) {
+        return pending.signature == mCachedVertexSignature;
+    };
+    auto pendingIter = std::find_if(mPendingVertexExecutables.begin(),
+                                    mPendingVertexExecutables.end(), matchesCachedSignature);
+    if (pendingIter == mPendingVertexExecutables.end())
+    {
+        ANGLE_TRY(postVertexExecutableCompile(context, contextD3D, renderer));
+        pendingIter = std::find_if(mPendingVertexExecutables.begin(),
+                                   mPendingVertexExecutables.end(), matchesCachedSignature);
+    }
+
+    // If the task could not be posted, or if it failed, compile on draw so errors are reported.
+    if (pendingIter == mPendingVertexExecutables.end() || pendingIter->compileFailed)
+    {
+        return angle::Result::Continue;
+    }
+
+    // Find an alternative layout where the attributes that need conversion in the shader are
+    // instead streamed as float.
+    const auto &vertexAttributes     = state.getVertexArray()->getVertexAttributes();
+    gl::InputLayout floatInputLayout = mCachedInputLayout;
+    gl::AttributesMask floatConversionAttribs;
+
+    for (size_t locationIndex : mExecutable->getActiveAttribLocationsMask())
+    {
+        int d3dSemantic = mAttribLocationToD3DSemantic[locationIndex];
+        if (d3dSemantic == -1 ||
+            mCachedVertexSignature[d3dSemantic] == D3DVertexExecutable::FLOAT)
+        {
+            continue;
+        }
+
+        // Current values are not streamed, so cannot be converted.
+        const gl::VertexAttribute &attrib = vertexAttributes[locationIndex];
+        if (!attrib.enabled)
+        {
+            return angle::Result::Continue;
+        }
+
+        floatInputLayout[d3dSemantic] = gl::GetVertexFormatID(
+            gl::VertexAttribType::Float, GL_FALSE, attrib.format->channelCount, false);
+        floatConversionAttribs.set(locationIndex);
+    }
+
+    if (floatConversionAttribs.none())
+    {
+        return angle::Result::Continue;
+    }
+
+    D3DVertexExecutable::Signature floatSignature;
+    D3DVertexExecutable::getSignature(renderer, floatInputLayout, &floatSignature);
+
+    for (size_t executableIndex = 0; executableIndex < mVertexExecutables.size(); executableIndex++)
+    {
+        if (mVertexExecutables[executableIndex]->matchesSignature(floatSignature))
+        {
+            mCachedInputLayout            = std::move(floatInputLayout);
+            mCachedVertexSignature        = std::move(floatSignature);
+            mCachedVertexExecutableIndex  = executableIndex;
+            mCachedFloatConversionAttribs = floatConversionAttribs;
+            *floatConversionAttribsOut    = floatConversionAttribs;
+            break;
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramExecutableD3D::postVertexExecutableCompile(const gl::Context *context,
+                                                                d3d::Context *contextD3D,
+                                                                RendererD3D *renderer)
+{
+    ANGLE_TRY(renderer->ensureHLSLCompilerInitialized(contextD3D));
+
+    auto task = std::make_shared<CompileVertexExecutableTask>(
+        renderer, generateVertexHLSLForCachedInputLayout(renderer), mStreamOutVaryings,
+        mExecutable->getTransformFeedbackBufferMode() == GL_SEPARATE_ATTRIBS,
+        mShaderWorkarounds[gl::ShaderType::Vertex]);
+
+    std::shared_ptr<angle::WaitableEvent> waitableEvent =
+        context->getWorkerThreadPool()->postWorkerTask(task);
+    if (!waitableEvent)
+    {
+        return angle::Result::Continue;
+    }
+
+    mPendingVertexExecutables.push_back(
+        {mCachedInputLayout, mCachedVertexSignature, std::move(task), std::move(waitableEvent),
+         false});
+    return angle::Result::Continue;
+}
+
+bool ProgramExecutableD3D::resolvePendingVertexExecutables()
+{
+    bool anyResolved = false;
+    bool anyAdded    = false;
+
+    for (auto iter = mPendingVertexExecutables.begin(); iter != mPendingVertexExecutables.end();)
+    {
+        PendingVertexExecutable &pending = *iter;
+        if (pending.compileFailed || !pending.waitableEvent->isReady())
+        {
+            ++iter;
+            continue;
+        }
+
+        anyResolved = true;
+
+        ShaderExecutableD3D *vertexExecutable = pending.task->releaseExecutable();
+        if (vertexExecutable == nullptr)
+        {
+            ERR() << "Error compiling dynamic vertex executable:" << std::endl
+                  << pending.task->getInfoLog().str() << std::endl;
+            pending.compileFailed = true;
+            pending.task.reset();
+            pending.waitableEvent.reset();
+            ++iter;
+            continue;
+        }
+
+        // The executable may have been compiled on draw in the meantime.
+        bool isDuplicate = false;
+        for (const std::unique_ptr<D3DVertexExecutable> &executable : mVertexExecutables)
+        {
+            isDuplicate = isDuplicate || executable->matchesSignature(pending.signature);
+        }
+
+        if (isDuplicate)
+        {
+            SafeDelete(vertexExecutable);
+        }
+        else
+        {
+            mVertexExecutables.push_back(std::unique_ptr<D3DVertexExecutable>(
+                new D3DVertexExecutable(pending.inputLayout, pending.signature, vertexExecutable)));
+            anyAdded = true;
+        }
+
+        iter = mPendingVertexExecutables.erase(iter);
+    }
+
+    // Once the exact executable of an input layout that uses the float conversion fallback is
+    // ready (or failed to compile), recompute the input layout to stop using the fallback.
+    if (anyResolved && mCachedFloatConversionAttribs.any())
+    {
+        mCurrentVertexArrayStateSerial = UniqueSerial();
+    }
+
+    return anyAdded;
+}
+
+void ProgramExecutableD3D::waitForPendingVertexExecutables()
+{
+    for (PendingVertexExecutable &pending : mPendingVertexExecutables)
+    {
+        if (pending.waitableEvent)
+        {
+            pending.waitableEvent->wait();
+        }
+    }
+    mPendingVertexExecutables.clear();
+}
+
 angle::Result ProgramExecutableD3D::getGeometryExecutableForPrimitiveType(
     d3d::Context *context,
     RendererD3D *renderer,
@@ -1776,6 +2057,7 @@ void ProgramExecutableD3D::updateCachedInputLayout(RendererD3D *renderer,
 
     mCurrentVertexArrayStateSerial = associatedSerial;
     mCachedInputLayout.clear();
+    mCachedFloatConversionAttribs.reset();
 
     const auto &vertexAttributes             = state.getVertexArray()->getVertexAttributes();
     const gl::AttributesMask &attributesMask = mExecutable->getActiveAttribLocationsMask();
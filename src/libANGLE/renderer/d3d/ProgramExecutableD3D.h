@@ -15,6 +15,11 @@
 #include "libANGLE/renderer/ProgramExecutableImpl.h"
 #include "libANGLE/renderer/d3d/DynamicHLSL.h"
 
+namespace angle
+{
+class WaitableEvent;
+}  // namespace angle
+
 namespace rx
 {
 class RendererD3D;
@@ -373,6 +378,29 @@ class ProgramExecutableD3D : public ProgramExecutableImpl
                                                           RendererD3D *renderer,
                                                           ShaderExecutableD3D **outExectuable,
                                                           gl::InfoLog *infoLog);
+
+    // Returns the already compiled vertex executable matching |inputLayout|, or nullptr.
+    ShaderExecutableD3D *getVertexExecutableForInputLayout(
+        RendererD3D *renderer,
+        const gl::InputLayout &inputLayout) const;
+
+    // Like updateCachedInputLayout, but if there is no vertex executable for the new input layout,
+    // its compilation is posted to the worker thread pool instead of happening at draw time.  In
+    // the meantime, the cached input layout is replaced with one where every attribute that needs
+    // conversion in the shader is converted to float on the CPU instead, if a vertex executable
+    // for that layout already exists.  |floatConversionAttribsOut| is set to the attribute
+    // locations needing that conversion.  It is empty if the exact executable is available, or if
+    // no fallback is possible, in which case the executable is compiled on draw as usual.
+    angle::Result updateCachedInputLayoutWithAsyncCompile(
+        const gl::Context *context,
+        d3d::Context *contextD3D,
+        RendererD3D *renderer,
+        UniqueSerial associatedSerial,
+        gl::AttributesMask *floatConversionAttribsOut);
+    // Collects the vertex executables whose asynchronous compilation has finished.  Returns true
+    // if any new executable was added.
+    bool resolvePendingVertexExecutables();
+
     angle::Result getGeometryExecutableForPrimitiveType(
         d3d::Context *errContext,
         RendererD3D *renderer,
@@ -443,6 +471,14 @@ class ProgramExecutableD3D : public ProgramExecutableImpl
     void updateCachedPixelExecutableIndex();
     void updateCachedComputeExecutableIndex();
 
+    std::string generateVertexHLSLForCachedInputLayout(RendererD3D *renderer) const;
+
+    class CompileVertexExecutableTask;
+    angle::Result postVertexExecutableCompile(const gl::Context *context,
+                                              d3d::Context *contextD3D,
+                                              RendererD3D *renderer);
+    void waitForPendingVertexExecutables();
+
     void defineUniformsAndAssignRegisters(
         RendererD3D *renderer,
         const gl::ShaderMap<gl::SharedCompiledShaderState> &shaders);
@@ -526,6 +562,21 @@ class ProgramExecutableD3D : public ProgramExecutableImpl
     gl::InputLayout mCachedInputLayout;
     Optional<size_t> mCachedVertexExecutableIndex;
 
+    // Vertex executables being compiled on the worker thread pool.  Entries whose compilation
+    // failed are kept, so they are not posted again and the error is reported on draw instead.
+    struct PendingVertexExecutable
+    {
+        gl::InputLayout inputLayout;
+        D3DVertexExecutable::Signature signature;
+        std::shared_ptr<CompileVertexExecutableTask> task;
+        std::shared_ptr<angle::WaitableEvent> waitableEvent;
+        bool compileFailed;
+    };
+    std::vector<PendingVertexExecutable> mPendingVertexExecutables;
+    // The attributes converted to float on the CPU for the cached input layout, while its exact
+    // executable is pending.
+    gl::AttributesMask mCachedFloatConversionAttribs;
+
     std::vector<D3DVarying> mStreamOutVaryings;
     std::vector<D3DUniform *> mD3DUniforms;
     std::map<std::string, int> mImageBindingMap;
@@ -161,6 +161,7 @@ class BufferFactoryD3D : angle::NonCopyable
                                                  size_t count,
                                                  GLsizei instances,
                                                  GLuint baseInstance,
+                                                 bool forceFloatConversion,
                                                  unsigned int *bytesRequiredOut) const = 0;
 };
 
@@ -200,7 +201,8 @@ class RendererD3D : public BufferFactoryD3D
                                           GLenum backBufferFormat,
                                           GLenum depthBufferFormat,
                                           EGLint orientation,
-                                          EGLint samples)                          = 0;
+                                          EGLint samples,
+                                          EGLint maxFrameLatency)                  = 0;
     virtual egl::Error getD3DTextureInfo(const egl::Config *configuration,
                                          IUnknown *d3dTexture,
                                          const egl::AttributeMap &attribs,
@@ -380,7 +382,7 @@ class RendererD3D : public BufferFactoryD3D
                                                                    const std::string &label) = 0;
 
     // Buffer-to-texture and Texture-to-buffer copies
-    virtual bool supportsFastCopyBufferToTexture(GLenum internalFormat) const = 0;
+    virtual bool supportsFastCopyBufferToTexture(GLenum internalFormat, GLenum type) const = 0;
     virtual angle::Result fastCopyBufferToTexture(const gl::Context *context,
                                                   const gl::PixelUnpackState &unpack,
                                                   gl::Buffer *unpackBuffer,
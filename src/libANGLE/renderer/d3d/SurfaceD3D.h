@@ -97,6 +97,8 @@ class SurfaceD3D : public SurfaceImpl
     GLint mFixedWidth;
     GLint mFixedHeight;
     GLint mOrientation;
+    // 0 leaves frame pacing to the swap chain.
+    EGLint mMaxFrameLatency;
 
     GLenum mRenderTargetFormat;
     GLenum mDepthStencilFormat;
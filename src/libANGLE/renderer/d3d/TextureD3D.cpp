@@ -367,11 +367,12 @@ angle::Result TextureD3D::subImageCompressed(const gl::Context *context,
 
 bool TextureD3D::isFastUnpackable(const gl::Buffer *unpackBuffer,
                                   const gl::PixelUnpackState &unpack,
-                                  GLenum sizedInternalFormat)
+                                  GLenum sizedInternalFormat,
+                                  GLenum type)
 {
     return unpackBuffer != nullptr && unpack.skipRows == 0 && unpack.skipPixels == 0 &&
            unpack.imageHeight == 0 && unpack.skipImages == 0 &&
-           mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat);
+           mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat, type);
 }
 
 angle::Result TextureD3D::fastUnpackPixels(const gl::Context *context,
@@ -396,7 +397,7 @@ angle::Result TextureD3D::fastUnpackPixels(const gl::Context *context,
 
     // In order to perform the fast copy through the shader, we must have the right format, and be
     // able to create a render target.
-    ASSERT(mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat));
+    ASSERT(mRenderer->supportsFastCopyBufferToTexture(sizedInternalFormat, type));
 
     uintptr_t offset = reinterpret_cast<uintptr_t>(pixels);
 
@@ -1023,7 +1024,7 @@ angle::Result TextureD3D_2D::setImage(const gl::Context *context,
     {
         ANGLE_TRY(mTexStorage->releaseMultisampledTexStorageForLevel(index.getLevelIndex()));
     }
-    if (isFastUnpackable(unpackBuffer, unpack, internalFormatInfo.sizedInternalFormat) &&
+    if (isFastUnpackable(unpackBuffer, unpack, internalFormatInfo.sizedInternalFormat, type) &&
         isLevelComplete(index.getLevelIndex()))
     {
         // Will try to create RT storage if it does not exist
@@ -1066,7 +1067,8 @@ angle::Result TextureD3D_2D::setSubImage(const gl::Context *context,
     {
         ANGLE_TRY(mTexStorage->releaseMultisampledTexStorageForLevel(index.getLevelIndex()));
     }
-    if (isFastUnpackable(unpackBuffer, unpack, mipFormat) && isLevelComplete(index.getLevelIndex()))
+    if (isFastUnpackable(unpackBuffer, unpack, mipFormat, type) &&
+        isLevelComplete(index.getLevelIndex()))
     {
         RenderTargetD3D *renderTarget = nullptr;
         ANGLE_TRY(getRenderTarget(context, index, getRenderToTextureSamples(), &renderTarget));
@@ -2589,7 +2591,7 @@ angle::Result TextureD3D_3D::setImage(const gl::Context *context,
     bool fastUnpacked = false;
 
     // Attempt a fast gpu copy of the pixel data to the surface if the app bound an unpack buffer
-    if (isFastUnpackable(unpackBuffer, unpack, internalFormatInfo.sizedInternalFormat) &&
+    if (isFastUnpackable(unpackBuffer, unpack, internalFormatInfo.sizedInternalFormat, type) &&
         !size.empty() && isLevelComplete(index.getLevelIndex()))
     {
         // Will try to create RT storage if it does not exist
@@ -2629,7 +2631,8 @@ angle::Result TextureD3D_3D::setSubImage(const gl::Context *context,
 
     // Attempt a fast gpu copy of the pixel data to the surface if the app bound an unpack buffer
     GLenum mipFormat = getInternalFormat(index.getLevelIndex());
-    if (isFastUnpackable(unpackBuffer, unpack, mipFormat) && isLevelComplete(index.getLevelIndex()))
+    if (isFastUnpackable(unpackBuffer, unpack, mipFormat, type) &&
+        isLevelComplete(index.getLevelIndex()))
     {
         RenderTargetD3D *destRenderTarget = nullptr;
         ANGLE_TRY(getRenderTarget(context, index, getRenderToTextureSamples(), &destRenderTarget));
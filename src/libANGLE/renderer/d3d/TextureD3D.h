@@ -159,7 +159,8 @@ class TextureD3D : public TextureImpl, public angle::ObserverInterface
                                      ptrdiff_t layerOffset);
     bool isFastUnpackable(const gl::Buffer *unpackBuffer,
                           const gl::PixelUnpackState &unpack,
-                          GLenum sizedInternalFormat);
+                          GLenum sizedInternalFormat,
+                          GLenum type);
     angle::Result fastUnpackPixels(const gl::Context *context,
                                    const gl::PixelUnpackState &unpack,
                                    gl::Buffer *unpackBuffer,
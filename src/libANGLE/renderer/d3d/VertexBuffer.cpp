@@ -38,6 +38,14 @@ unsigned int VertexBuffer::getSerial() const
     return mSerial;
 }
 
+angle::Result VertexBuffer::reserveStreamingRange(const gl::Context *context,
+                                                  unsigned int offset,
+                                                  unsigned int size,
+                                                  bool wrapped)
+{
+    return wrapped ? discard(context) : angle::Result::Continue;
+}
+
 void VertexBuffer::addRef()
 {
     mRefCount++;
@@ -97,11 +105,13 @@ angle::Result VertexBufferInterface::getSpaceRequired(const gl::Context *context
                                                       size_t count,
                                                       GLsizei instances,
                                                       GLuint baseInstance,
+                                                      bool forceFloatConversion,
                                                       unsigned int *spaceInBytesOut) const
 {
     unsigned int spaceRequired = 0;
     ANGLE_TRY(mFactory->getVertexSpaceRequired(context, attrib, binding, count, instances,
-                                               baseInstance, &spaceRequired));
+                                               baseInstance, forceFloatConversion,
+                                               &spaceRequired));
 
     // Align to 16-byte boundary
     unsigned int alignedSpaceRequired = roundUpPow2(spaceRequired, 16u);
@@ -111,12 +121,6 @@ angle::Result VertexBufferInterface::getSpaceRequired(const gl::Context *context
     return angle::Result::Continue;
 }
 
-angle::Result VertexBufferInterface::discard(const gl::Context *context)
-{
-    ASSERT(mVertexBuffer);
-    return mVertexBuffer->discard(context);
-}
-
 VertexBuffer *VertexBufferInterface::getVertexBuffer() const
 {
     ASSERT(mVertexBuffer);
@@ -149,6 +153,7 @@ angle::Result StreamingVertexBufferInterface::reserveSpace(const gl::Context *co
                                                            unsigned int size)
 {
     unsigned int curBufferSize = getBufferSize();
+    bool wrapped               = false;
     if (size > curBufferSize)
     {
         ANGLE_TRY(setBufferSize(context, std::max(size, 3 * curBufferSize / 2)));
@@ -156,10 +161,12 @@ angle::Result StreamingVertexBufferInterface::reserveSpace(const gl::Context *co
     }
     else if (mWritePosition + size > curBufferSize)
     {
-        ANGLE_TRY(discard(context));
+        wrapped        = true;
         mWritePosition = 0;
     }
 
+    ANGLE_TRY(mVertexBuffer->reserveStreamingRange(context, mWritePosition, size, wrapped));
+
     mReservedSpace = size;
     return angle::Result::Continue;
 }
@@ -169,6 +176,7 @@ angle::Result StreamingVertexBufferInterface::storeDynamicAttribute(
     const gl::VertexAttribute &attrib,
     const gl::VertexBinding &binding,
     gl::VertexAttribType currentValueType,
+    bool forceFloatConversion,
     GLint start,
     size_t count,
     GLsizei instances,
@@ -177,8 +185,8 @@ angle::Result StreamingVertexBufferInterface::storeDynamicAttribute(
     const uint8_t *sourceData)
 {
     unsigned int spaceRequired = 0;
-    ANGLE_TRY(
-        getSpaceRequired(context, attrib, binding, count, instances, baseInstance, &spaceRequired));
+    ANGLE_TRY(getSpaceRequired(context, attrib, binding, count, instances, baseInstance,
+                               forceFloatConversion, &spaceRequired));
 
     // Protect against integer overflow
     angle::CheckedNumeric<unsigned int> checkedPosition(mWritePosition);
@@ -199,8 +207,8 @@ angle::Result StreamingVertexBufferInterface::storeDynamicAttribute(
     }
 
     ANGLE_TRY(mVertexBuffer->storeVertexAttributes(context, attrib, binding, currentValueType,
-                                                   start, adjustedCount, instances, mWritePosition,
-                                                   sourceData));
+                                                   forceFloatConversion, start, adjustedCount,
+                                                   instances, mWritePosition, sourceData));
 
     if (outStreamOffset)
     {
@@ -217,11 +225,13 @@ angle::Result StreamingVertexBufferInterface::reserveVertexSpace(const gl::Conte
                                                                  const gl::VertexBinding &binding,
                                                                  size_t count,
                                                                  GLsizei instances,
-                                                                 GLuint baseInstance)
+                                                                 GLuint baseInstance,
+                                                                 bool forceFloatConversion)
 {
     unsigned int requiredSpace = 0;
     ANGLE_TRY(mFactory->getVertexSpaceRequired(context, attrib, binding, count, instances,
-                                               baseInstance, &requiredSpace));
+                                               baseInstance, forceFloatConversion,
+                                               &requiredSpace));
 
     // Align to 16-byte boundary
     auto alignedRequiredSpace = rx::CheckedRoundUp(requiredSpace, 16u);
@@ -292,13 +302,14 @@ angle::Result StaticVertexBufferInterface::storeStaticAttribute(const gl::Contex
                                                                 const uint8_t *sourceData)
 {
     unsigned int spaceRequired = 0;
-    ANGLE_TRY(getSpaceRequired(context, attrib, binding, count, instances, 0, &spaceRequired));
+    ANGLE_TRY(
+        getSpaceRequired(context, attrib, binding, count, instances, 0, false, &spaceRequired));
     ANGLE_TRY(setBufferSize(context, spaceRequired));
 
     ASSERT(attrib.enabled);
     ANGLE_TRY(mVertexBuffer->storeVertexAttributes(context, attrib, binding,
-                                                   gl::VertexAttribType::InvalidEnum, start, count,
-                                                   instances, 0, sourceData));
+                                                   gl::VertexAttribType::InvalidEnum, false, start,
+                                                   count, instances, 0, sourceData));
 
     mSignature.set(attrib, binding);
     mVertexBuffer->hintUnmapResource();
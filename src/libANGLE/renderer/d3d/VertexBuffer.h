@@ -50,6 +50,7 @@ class VertexBuffer : angle::NonCopyable
                                                 const gl::VertexAttribute &attrib,
                                                 const gl::VertexBinding &binding,
                                                 gl::VertexAttribType currentValueType,
+                                                bool forceFloatConversion,
                                                 GLint start,
                                                 size_t count,
                                                 GLsizei instances,
@@ -60,6 +61,14 @@ class VertexBuffer : angle::NonCopyable
     virtual angle::Result setBufferSize(const gl::Context *context, unsigned int size) = 0;
     virtual angle::Result discard(const gl::Context *context)                          = 0;
 
+    // Called by streaming buffers before |size| bytes are written at |offset|, once all draws
+    // using earlier writes have been issued.  |wrapped| is set when the write position restarted
+    // from the beginning of the buffer, in which case the default implementation discards it.
+    virtual angle::Result reserveStreamingRange(const gl::Context *context,
+                                                unsigned int offset,
+                                                unsigned int size,
+                                                bool wrapped);
+
     unsigned int getSerial() const;
 
     // This may be overridden (e.g. by VertexBuffer11) if necessary.
@@ -93,8 +102,6 @@ class VertexBufferInterface : angle::NonCopyable
     VertexBuffer *getVertexBuffer() const;
 
   protected:
-    angle::Result discard(const gl::Context *context);
-
     angle::Result setBufferSize(const gl::Context *context, unsigned int size);
 
     angle::Result getSpaceRequired(const gl::Context *context,
@@ -103,6 +110,7 @@ class VertexBufferInterface : angle::NonCopyable
                                    size_t count,
                                    GLsizei instances,
                                    GLuint baseInstance,
+                                   bool forceFloatConversion,
                                    unsigned int *spaceInBytesOut) const;
     BufferFactoryD3D *const mFactory;
     VertexBuffer *mVertexBuffer;
@@ -122,6 +130,7 @@ class StreamingVertexBufferInterface : public VertexBufferInterface
                                         const gl::VertexAttribute &attrib,
                                         const gl::VertexBinding &binding,
                                         gl::VertexAttribType currentValueType,
+                                        bool forceFloatConversion,
                                         GLint start,
                                         size_t count,
                                         GLsizei instances,
@@ -134,7 +143,8 @@ class StreamingVertexBufferInterface : public VertexBufferInterface
                                      const gl::VertexBinding &binding,
                                      size_t count,
                                      GLsizei instances,
-                                     GLuint baseInstance);
+                                     GLuint baseInstance,
+                                     bool forceFloatConversion);
 
   private:
     angle::Result reserveSpace(const gl::Context *context, unsigned int size);
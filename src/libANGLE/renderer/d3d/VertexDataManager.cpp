@@ -112,7 +112,7 @@ bool DirectStoragePossible(const gl::Context *context,
     {
         unsigned int elementSize = 0;
         angle::Result error =
-            factory->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0, &elementSize);
+            factory->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0, false, &elementSize);
         ASSERT(error == angle::Result::Continue);
         alignment = std::min<size_t>(elementSize, 4);
     }
@@ -135,7 +135,8 @@ TranslatedAttribute::TranslatedAttribute()
       vertexBuffer(),
       storage(nullptr),
       serial(0),
-      divisor(0)
+      divisor(0),
+      forceFloatConversion(false)
 {}
 
 TranslatedAttribute::TranslatedAttribute(const TranslatedAttribute &other) = default;
@@ -371,7 +372,7 @@ angle::Result VertexDataManager::StoreStaticAttrib(const gl::Context *context,
 
     translated->storage = nullptr;
     ANGLE_TRY(bufferD3D->getFactory()->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0,
-                                                              &translated->stride));
+                                                              false, &translated->stride));
 
     auto *staticBuffer = bufferD3D->getStaticVertexBuffer(attrib, binding);
     ASSERT(staticBuffer);
@@ -492,11 +493,13 @@ angle::Result VertexDataManager::reserveSpaceForAttrib(const gl::Context *contex
     const auto &attrib  = *translatedAttrib.attribute;
     const auto &binding = *translatedAttrib.binding;
 
-    ASSERT(!DirectStoragePossible(context, attrib, binding));
+    ASSERT(translatedAttrib.forceFloatConversion ||
+           !DirectStoragePossible(context, attrib, binding));
 
     gl::Buffer *buffer   = binding.getBuffer().get();
     BufferD3D *bufferD3D = buffer ? GetImplAs<BufferD3D>(buffer) : nullptr;
-    ASSERT(!bufferD3D || bufferD3D->getStaticVertexBuffer(attrib, binding) == nullptr);
+    ASSERT(translatedAttrib.forceFloatConversion || !bufferD3D ||
+           bufferD3D->getStaticVertexBuffer(attrib, binding) == nullptr);
 
     // Make sure we always pass at least one instance count to gl::ComputeVertexBindingElementCount.
     // Even if this is not an instanced draw call, some attributes can still be instanced if they
@@ -523,7 +526,7 @@ angle::Result VertexDataManager::reserveSpaceForAttrib(const gl::Context *contex
                     "Vertex buffer is not big enough for the draw call.", GL_INVALID_OPERATION);
     }
     return mStreamingBuffer.reserveVertexSpace(context, attrib, binding, totalCount, instances,
-                                               baseInstance);
+                                               baseInstance, translatedAttrib.forceFloatConversion);
 }
 
 angle::Result VertexDataManager::storeDynamicAttrib(const gl::Context *context,
@@ -565,15 +568,17 @@ angle::Result VertexDataManager::storeDynamicAttrib(const gl::Context *context,
     unsigned int streamOffset = 0;
 
     translated->storage = nullptr;
-    ANGLE_TRY(
-        mFactory->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0, &translated->stride));
+    ANGLE_TRY(mFactory->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0,
+                                               translated->forceFloatConversion,
+                                               &translated->stride));
 
     size_t totalCount = gl::ComputeVertexBindingElementCount(
         binding.getDivisor(), count, static_cast<size_t>(std::max(instances, 1)));
 
     ANGLE_TRY(mStreamingBuffer.storeDynamicAttribute(
-        context, attrib, binding, translated->currentValueType, firstVertexIndex,
-        static_cast<GLsizei>(totalCount), instances, baseInstance, &streamOffset, sourceData));
+        context, attrib, binding, translated->currentValueType, translated->forceFloatConversion,
+        firstVertexIndex, static_cast<GLsizei>(totalCount), instances, baseInstance, &streamOffset,
+        sourceData));
 
     VertexBuffer *vertexBuffer = mStreamingBuffer.getVertexBuffer();
 
@@ -605,13 +610,13 @@ angle::Result VertexDataManager::storeCurrentValue(
         const auto &attrib  = *translated->attribute;
         const auto &binding = *translated->binding;
 
-        ANGLE_TRY(buffer.reserveVertexSpace(context, attrib, binding, 1, 0, 0));
+        ANGLE_TRY(buffer.reserveVertexSpace(context, attrib, binding, 1, 0, 0, false));
 
         const uint8_t *sourceData =
             reinterpret_cast<const uint8_t *>(currentValue.Values.FloatValues);
         unsigned int streamOffset;
-        ANGLE_TRY(buffer.storeDynamicAttribute(context, attrib, binding, currentValue.Type, 0, 1, 0,
-                                               0, &streamOffset, sourceData));
+        ANGLE_TRY(buffer.storeDynamicAttribute(context, attrib, binding, currentValue.Type, false,
+                                               0, 1, 0, 0, &streamOffset, sourceData));
 
         buffer.getVertexBuffer()->hintUnmapResource();
 
@@ -70,6 +70,10 @@ struct TranslatedAttribute
     BufferD3D *storage;
     unsigned int serial;
     unsigned int divisor;
+
+    // Stream the attribute as float regardless of conversion support on the GPU.  Used while the
+    // vertex shader variant that performs the conversion is compiling.
+    bool forceFloatConversion;
 };
 
 enum class VertexStorageType
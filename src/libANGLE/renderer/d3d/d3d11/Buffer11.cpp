@@ -425,7 +425,7 @@ angle::Result Buffer11::setSubData(const gl::Context *context,
     }
 
     mSize = std::max(mSize, requiredSize);
-    invalidateStaticData(context);
+    invalidateStaticDataRange(context, offset, size);
 
     return angle::Result::Continue;
 }
@@ -489,7 +489,7 @@ angle::Result Buffer11::copySubData(const gl::Context *context,
     onStorageUpdate(copyDest);
 
     mSize = std::max<size_t>(mSize, destOffset + size);
-    invalidateStaticData(context);
+    invalidateStaticDataRange(context, destOffset, size);
 
     return angle::Result::Continue;
 }
@@ -533,7 +533,7 @@ angle::Result Buffer11::mapRange(const gl::Context *context,
     {
         // Update the data revision immediately, since the data might be changed at any time
         onStorageUpdate(mMappedStorage);
-        invalidateStaticData(context);
+        invalidateStaticDataRange(context, offset, length);
     }
 
     uint8_t *mappedBuffer = nullptr;
@@ -1023,6 +1023,12 @@ void Buffer11::invalidateStaticData(const gl::Context *context)
     onStateChange(angle::SubjectMessage::SubjectChanged);
 }
 
+void Buffer11::invalidateStaticDataRange(const gl::Context *context, size_t offset, size_t size)
+{
+    BufferD3D::invalidateStaticDataRange(context, offset, size);
+    onStateChange(angle::SubjectMessage::SubjectChanged);
+}
+
 void Buffer11::onCopyStorage(BufferStorage *dest, BufferStorage *source)
 {
     ASSERT(source && mLatestBufferStorage);
@@ -96,6 +96,9 @@ class Buffer11 : public BufferD3D
     angle::Result getData(const gl::Context *context, const uint8_t **outData) override;
     void initializeStaticData(const gl::Context *context) override;
     void invalidateStaticData(const gl::Context *context) override;
+    void invalidateStaticDataRange(const gl::Context *context,
+                                   size_t offset,
+                                   size_t size) override;
 
     // BufferImpl implementation
     angle::Result setData(const gl::Context *context,
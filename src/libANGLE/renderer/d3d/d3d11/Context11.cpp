@@ -1031,14 +1031,7 @@ angle::Result Context11::triggerDrawCallProgramRecompilation(const gl::Context *
         }
     }
 
-    // Refresh the program cache entry.
-    gl::Program *program = glState.getProgram();
-    if (mMemoryProgramCache && IsSameExecutable(&program->getExecutable(), executable))
-    {
-        ANGLE_TRY(mMemoryProgramCache->updateProgram(context, program));
-    }
-
-    return angle::Result::Continue;
+    return updateProgramCache(context, executable);
 }
 
 angle::Result Context11::triggerDispatchCallProgramRecompilation(const gl::Context *context)
@@ -1071,9 +1064,16 @@ angle::Result Context11::triggerDispatchCallProgramRecompilation(const gl::Conte
         ANGLE_TRY_HR(this, E_FAIL, "Error compiling dynamic compute executable");
     }
 
+    return updateProgramCache(context, executable);
+}
+
+angle::Result Context11::updateProgramCache(const gl::Context *context,
+                                            const gl::ProgramExecutable *executable)
+{
     // Refresh the program cache entry.
-    gl::Program *program = glState.getProgram();
-    if (mMemoryProgramCache && IsSameExecutable(&program->getExecutable(), executable))
+    gl::Program *program = context->getState().getProgram();
+    if (mMemoryProgramCache && program != nullptr &&
+        IsSameExecutable(&program->getExecutable(), executable))
     {
         ANGLE_TRY(mMemoryProgramCache->updateProgram(context, program));
     }
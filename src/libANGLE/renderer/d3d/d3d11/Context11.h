@@ -255,6 +255,9 @@ class Context11 : public ContextD3D, public MultisampleTextureInitializer
     angle::Result triggerDrawCallProgramRecompilation(const gl::Context *context,
                                                       gl::PrimitiveMode drawMode);
     angle::Result triggerDispatchCallProgramRecompilation(const gl::Context *context);
+    // Writes the program back to the program cache after new executables are added to it.
+    angle::Result updateProgramCache(const gl::Context *context,
+                                     const gl::ProgramExecutable *executable);
     angle::Result getIncompleteTexture(const gl::Context *context,
                                        gl::TextureType type,
                                        gl::Texture **textureOut);
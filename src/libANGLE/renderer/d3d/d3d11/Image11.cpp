@@ -18,6 +18,7 @@
 #include "libANGLE/renderer/d3d/d3d11/Context11.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderTarget11.h"
 #include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "libANGLE/renderer/d3d/d3d11/StagingTexturePool11.h"
 #include "libANGLE/renderer/d3d/d3d11/TextureStorage11.h"
 #include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
@@ -66,7 +67,8 @@ angle::Result Image11::GenerateMipmap(const gl::Context *context,
 
     auto mipGenerationFunction =
         d3d11::Format::Get(src->getInternalFormat(), rendererCaps).format().mipGenerationFunction;
-    mipGenerationFunction(src->getWidth(), src->getHeight(), src->getDepth(), sourceData,
+    GenerateMipInParallel(context->getWorkerThreadPool().get(), mipGenerationFunction,
+                          src->getWidth(), src->getHeight(), src->getDepth(), sourceData,
                           srcMapped.RowPitch, srcMapped.DepthPitch, destData, destMapped.RowPitch,
                           destMapped.DepthPitch);
 
@@ -525,6 +527,13 @@ angle::Result Image11::getStagingTexture(const gl::Context *context,
 
 void Image11::releaseStagingTexture()
 {
+    StagingTexturePool11 *pool = mRenderer->getStagingTexturePool();
+    if (mStagingTexture.valid() && pool != nullptr &&
+        mRenderer->getFeatures().poolUploadStagingTextures.enabled)
+    {
+        pool->release(std::move(mStagingTexture));
+    }
+
     mStagingTexture.reset();
     mStagingTextureSubresourceVerifier.reset();
 }
@@ -551,6 +560,15 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
 
     Context11 *context11 = GetImplAs<Context11>(context);
 
+    // Pooled textures hold stale data, which is only acceptable when the contents of the image
+    // are undefined until they're loaded.
+    StagingTexturePool11 *pool = nullptr;
+    if (mRenderer->getFeatures().poolUploadStagingTextures.enabled &&
+        !context->isRobustResourceInitEnabled())
+    {
+        pool = mRenderer->getStagingTexturePool();
+    }
+
     switch (mType)
     {
         case gl::TextureType::_3D:
@@ -578,8 +596,15 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
             }
             else
             {
-                ANGLE_TRY(
-                    mRenderer->allocateTexture(context11, desc, formatInfo, &mStagingTexture));
+                if (pool != nullptr)
+                {
+                    ANGLE_TRY(pool->acquire(context, desc, formatInfo, &mStagingTexture));
+                }
+                if (!mStagingTexture.valid())
+                {
+                    ANGLE_TRY(
+                        mRenderer->allocateTexture(context11, desc, formatInfo, &mStagingTexture));
+                }
             }
 
             mStagingTexture.setInternalName("Image11::StagingTexture3D");
@@ -617,8 +642,15 @@ angle::Result Image11::createStagingTexture(const gl::Context *context)
             }
             else
             {
-                ANGLE_TRY(
-                    mRenderer->allocateTexture(context11, desc, formatInfo, &mStagingTexture));
+                if (pool != nullptr)
+                {
+                    ANGLE_TRY(pool->acquire(context, desc, formatInfo, &mStagingTexture));
+                }
+                if (!mStagingTexture.valid())
+                {
+                    ANGLE_TRY(
+                        mRenderer->allocateTexture(context11, desc, formatInfo, &mStagingTexture));
+                }
             }
 
             mStagingTexture.setInternalName("Image11::StagingTexture2D");
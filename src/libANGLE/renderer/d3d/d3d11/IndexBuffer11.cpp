@@ -21,7 +21,8 @@ IndexBuffer11::IndexBuffer11(Renderer11 *const renderer)
       mBuffer(),
       mBufferSize(0),
       mIndexType(gl::DrawElementsType::InvalidEnum),
-      mDynamicUsage(false)
+      mDynamicUsage(false),
+      mRing(renderer)
 {}
 
 IndexBuffer11::~IndexBuffer11() {}
@@ -60,6 +61,7 @@ angle::Result IndexBuffer11::initialize(const gl::Context *context,
     mBufferSize   = bufferSize;
     mIndexType    = indexType;
     mDynamicUsage = dynamic;
+    mRing.reset(bufferSize);
 
     return angle::Result::Continue;
 }
@@ -78,9 +80,21 @@ angle::Result IndexBuffer11::mapBuffer(const gl::Context *context,
     ANGLE_CHECK_HR(context11, !outOfBounds, "Index buffer map range is not inside the buffer.",
                    E_OUTOFMEMORY);
 
+    D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (useStreamingRing())
+    {
+        bool discardBuffer = false;
+        ANGLE_TRY(mRing.prepareWrite(context, offset, size, &discardBuffer));
+        if (discardBuffer)
+        {
+            mapType = D3D11_MAP_WRITE_DISCARD;
+            mRing.reset(mBufferSize);
+        }
+        mRing.onWrite(offset, size);
+    }
+
     D3D11_MAPPED_SUBRESOURCE mappedResource;
-    ANGLE_TRY(mRenderer->mapResource(context, mBuffer.get(), 0, D3D11_MAP_WRITE_NO_OVERWRITE, 0,
-                                     &mappedResource));
+    ANGLE_TRY(mRenderer->mapResource(context, mBuffer.get(), 0, mapType, 0, &mappedResource));
 
     *outMappedMemory = static_cast<char *>(mappedResource.pData) + offset;
     return angle::Result::Continue;
@@ -125,6 +139,14 @@ angle::Result IndexBuffer11::discard(const gl::Context *context)
     ANGLE_CHECK_HR(context11, mBuffer.valid(), "Internal index buffer is not initialized.",
                    E_OUTOFMEMORY);
 
+    // The streaming buffer wrapped around.  The ring decides in mapBuffer whether the start of
+    // the buffer can be overwritten in place or the buffer needs to be discarded.
+    if (useStreamingRing())
+    {
+        mRing.onWrap();
+        return angle::Result::Continue;
+    }
+
     ID3D11DeviceContext *dxContext = mRenderer->getDeviceContext();
 
     D3D11_MAPPED_SUBRESOURCE mappedResource;
@@ -136,6 +158,11 @@ angle::Result IndexBuffer11::discard(const gl::Context *context)
     return angle::Result::Continue;
 }
 
+bool IndexBuffer11::useStreamingRing() const
+{
+    return mDynamicUsage && mRenderer->getFeatures().wrapStreamingBuffersWithoutDiscard.enabled;
+}
+
 DXGI_FORMAT IndexBuffer11::getIndexFormat() const
 {
     switch (mIndexType)
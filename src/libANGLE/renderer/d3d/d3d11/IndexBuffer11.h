@@ -11,6 +11,7 @@
 
 #include "libANGLE/renderer/d3d/IndexBuffer.h"
 #include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+#include "libANGLE/renderer/d3d/d3d11/StreamingBufferRing11.h"
 
 namespace rx
 {
@@ -45,12 +46,16 @@ class IndexBuffer11 : public IndexBuffer
     const d3d11::Buffer &getBuffer() const;
 
   private:
+    bool useStreamingRing() const;
+
     Renderer11 *const mRenderer;
 
     d3d11::Buffer mBuffer;
     unsigned int mBufferSize;
     gl::DrawElementsType mIndexType;
     bool mDynamicUsage;
+
+    StreamingBufferRing11 mRing;
 };
 
 }  // namespace rx
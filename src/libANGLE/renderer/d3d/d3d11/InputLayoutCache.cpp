@@ -9,9 +9,13 @@
 
 #include "libANGLE/renderer/d3d/d3d11/InputLayoutCache.h"
 
+#include <anglebase/sha1.h>
+
+#include "common/BinaryStream.h"
 #include "common/bitset_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/ProgramExecutable.h"
 #include "libANGLE/VertexArray.h"
@@ -64,6 +68,31 @@ struct PackedAttribute
     uint32_t divisor;
 };
 
+// Warmed up layouts are created a few at a time, so reading a recorded list of layouts from the
+// blob cache doesn't need a large scratch buffer to be kept around.
+constexpr uint32_t kScratchBufferLifetime = 64;
+
+constexpr char kProgramLayoutsKeyTag[] = "InputLayoutCache";
+
+void ComputeProgramLayoutsKey(const egl::BlobCache::Key &programHash, egl::BlobCache::Key *keyOut)
+{
+    angle::base::SecureHashAlgorithm hashStream;
+    hashStream.Update(kProgramLayoutsKeyTag, sizeof(kProgramLayoutsKeyTag));
+    hashStream.Update(programHash.data(), programHash.size());
+    hashStream.Final();
+    memcpy(keyOut->data(), hashStream.Digest(), keyOut->size());
+}
+
+const egl::BlobCache::Key *GetProgramHash(const gl::State &state)
+{
+    const gl::Program *program = state.getProgram();
+    if (program == nullptr || program->getProgramHash() == egl::BlobCache::Key{})
+    {
+        return nullptr;
+    }
+    return &program->getProgramHash();
+}
+
 }  // anonymous namespace
 
 PackedAttributeLayout::PackedAttributeLayout() : numAttributes(0), attributeData({}) {}
@@ -97,16 +126,29 @@ void PackedAttributeLayout::addAttributeData(GLenum glType,
 
 bool PackedAttributeLayout::operator==(const PackedAttributeLayout &other) const
 {
-    return (numAttributes == other.numAttributes) && (attributeData == other.attributeData);
+    return (numAttributes == other.numAttributes) &&
+           memcmp(attributeData.data(), other.attributeData.data(),
+                  sizeof(uint64_t) * numAttributes) == 0;
 }
 
-InputLayoutCache::InputLayoutCache() : mLayoutCache(kDefaultCacheSize * 2) {}
+InputLayoutCache::InputLayoutCache()
+    : mMaxCacheSize(kDefaultCacheSize * 2),
+      mLastWarmedUpExecutable(nullptr),
+      mScratchBuffer(kScratchBufferLifetime)
+{}
 
 InputLayoutCache::~InputLayoutCache() {}
 
 void InputLayoutCache::clear()
 {
-    mLayoutCache.Clear();
+    mLayoutCache.clear();
+
+    // The layouts of every program have to be created again.
+    for (auto &programLayouts : mProgramLayouts)
+    {
+        programLayouts.second.warmedUp = false;
+    }
+    mLastWarmedUpExecutable = nullptr;
 }
 
 angle::Result InputLayoutCache::getInputLayout(
@@ -129,6 +171,9 @@ angle::Result InputLayoutCache::getInputLayout(
     const auto &locationToSemantic = executableD3D->getAttribLocationToD3DSemantics();
     int divisorMultiplier          = executable->usesMultiview() ? executable->getNumViews() : 1;
 
+    const gl::AttributesMask &floatConversionAttribs =
+        GetImplAs<VertexArray11>(state.getVertexArray())->getFloatConversionAttribs();
+
     for (size_t attribIndex : executable->getActiveAttribLocationsMask())
     {
         // Record the type of the associated vertex shader vector in our key
@@ -142,6 +187,12 @@ angle::Result InputLayoutCache::getInputLayout(
         const auto &currentValue =
             state.getVertexAttribCurrentValue(static_cast<unsigned int>(attribIndex));
         angle::FormatID vertexFormatID = gl::GetVertexFormatID(attrib, currentValue.Type);
+        if (floatConversionAttribs[attribIndex])
+        {
+            // Key by the format that is actually bound.
+            vertexFormatID = gl::GetVertexFormatID(gl::VertexAttribType::Float, GL_FALSE,
+                                                   attrib.format->channelCount, false);
+        }
 
         layout.addAttributeData(glslElementType, d3dSemantic, vertexFormatID,
                                 binding.getDivisor() * divisorMultiplier);
@@ -149,27 +200,229 @@ angle::Result InputLayoutCache::getInputLayout(
 
     if (layout.numAttributes > 0)
     {
-        auto it = mLayoutCache.Get(layout);
+        const bool prewarm = context11->getRenderer()->getFeatures().prewarmInputLayouts.enabled;
+        if (prewarm && executableD3D != mLastWarmedUpExecutable)
+        {
+            ANGLE_TRY(warmUpProgramLayouts(context11, state));
+            mLastWarmedUpExecutable = executableD3D;
+        }
+
+        auto it = mLayoutCache.find(layout);
         if (it != mLayoutCache.end())
         {
             *inputLayoutOut = &it->second;
         }
         else
         {
-            angle::TrimCache(mLayoutCache.max_size() / 2, kGCLimit, "input layout", &mLayoutCache);
-
             d3d11::InputLayout newInputLayout;
             ANGLE_TRY(createInputLayout(context11, sortedSemanticIndices, currentAttributes, mode,
                                         vertexCount, instances, &newInputLayout));
 
-            auto insertIt   = mLayoutCache.Put(layout, std::move(newInputLayout));
-            *inputLayoutOut = &insertIt->second;
+            *inputLayoutOut = insertLayout(layout, std::move(newInputLayout));
+
+            if (prewarm)
+            {
+                recordProgramLayout(context11, state, layout);
+            }
         }
     }
 
     return angle::Result::Continue;
 }
 
+d3d11::InputLayout *InputLayoutCache::insertLayout(const PackedAttributeLayout &layout,
+                                                   d3d11::InputLayout &&inputLayout)
+{
+    // Running out of space is rare enough that dropping everything is preferable to keeping
+    // recency information up to date on every lookup.
+    if (mLayoutCache.size() >= mMaxCacheSize)
+    {
+        WARN() << "Clearing the input layout cache after it reached " << mMaxCacheSize
+               << " entries.";
+        mLayoutCache.clear();
+    }
+
+    auto insertIt = mLayoutCache.emplace(layout, std::move(inputLayout)).first;
+    return &insertIt->second;
+}
+
+angle::Result InputLayoutCache::warmUpProgramLayouts(Context11 *context11,
+                                                     const gl::State &state)
+{
+    const egl::BlobCache::Key *programHash = GetProgramHash(state);
+    if (programHash == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    ProgramLayouts &programLayouts = mProgramLayouts[*programHash];
+    if (programLayouts.warmedUp)
+    {
+        return angle::Result::Continue;
+    }
+    programLayouts.warmedUp = true;
+
+    Renderer11 *renderer = context11->getRenderer();
+
+    // Load the layouts recorded in past sessions, unless this session already recorded some.
+    if (programLayouts.layouts.empty())
+    {
+        egl::BlobCache::Key key;
+        ComputeProgramLayoutsKey(*programHash, &key);
+
+        egl::BlobCache::Value value;
+        egl::BlobCache &blobCache = renderer->getDisplay()->getBlobCache();
+        if (blobCache.get(nullptr, &mScratchBuffer, key, &value))
+        {
+            gl::BinaryInputStream stream(value.data(), value.size());
+            const uint32_t layoutCount = stream.readInt<uint32_t>();
+            for (uint32_t layoutIndex = 0; layoutIndex < layoutCount && !stream.error();
+                 ++layoutIndex)
+            {
+                PackedAttributeLayout layout;
+                layout.numAttributes = stream.readInt<uint32_t>();
+                if (layout.numAttributes == 0 || layout.numAttributes > gl::MAX_VERTEX_ATTRIBS)
+                {
+                    break;
+                }
+                stream.readBytes(reinterpret_cast<unsigned char *>(layout.attributeData.data()),
+                                 sizeof(uint64_t) * layout.numAttributes);
+                if (!stream.error())
+                {
+                    programLayouts.layouts.push_back(layout);
+                }
+            }
+        }
+    }
+
+    for (const PackedAttributeLayout &layout : programLayouts.layouts)
+    {
+        if (mLayoutCache.find(layout) != mLayoutCache.end())
+        {
+            continue;
+        }
+
+        d3d11::InputLayout inputLayout;
+        ANGLE_TRY(createInputLayoutFromKey(context11, layout, &inputLayout));
+        if (inputLayout.valid())
+        {
+            insertLayout(layout, std::move(inputLayout));
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result InputLayoutCache::createInputLayoutFromKey(Context11 *context11,
+                                                         const PackedAttributeLayout &layout,
+                                                         d3d11::InputLayout *inputLayoutOut)
+{
+    Renderer11 *renderer                = context11->getRenderer();
+    ProgramExecutableD3D *executableD3D = renderer->getStateManager()->getProgramExecutableD3D();
+    D3D_FEATURE_LEVEL featureLevel      = renderer->getRenderer11DeviceCaps().featureLevel;
+
+    // Feature level 9_3 may reorder the attributes at draw time, which the key doesn't capture.
+    if (featureLevel <= D3D_FEATURE_LEVEL_9_3)
+    {
+        return angle::Result::Continue;
+    }
+
+    // The attributes are bound to the input slot of their semantic, see SortAttributesByLayout.
+    unsigned int inputElementCount = 0;
+    gl::AttribArray<D3D11_INPUT_ELEMENT_DESC> inputElements;
+    gl::InputLayout vertexInputLayout;
+
+    for (uint32_t attribIndex = 0; attribIndex < layout.numAttributes; ++attribIndex)
+    {
+        const PackedAttribute packedAttrib =
+            gl::bitCast<PackedAttribute>(layout.attributeData[attribIndex]);
+        const angle::FormatID vertexFormatID =
+            static_cast<angle::FormatID>(packedAttrib.vertexFormatType);
+        const UINT semanticIndex = packedAttrib.semanticIndex;
+
+        if (vertexInputLayout.size() <= semanticIndex)
+        {
+            vertexInputLayout.resize(semanticIndex + 1, angle::FormatID::NONE);
+        }
+        vertexInputLayout[semanticIndex] = vertexFormatID;
+
+        D3D11_INPUT_CLASSIFICATION inputClass =
+            packedAttrib.divisor > 0 ? D3D11_INPUT_PER_INSTANCE_DATA : D3D11_INPUT_PER_VERTEX_DATA;
+        const auto &vertexFormatInfo = d3d11::GetVertexFormatInfo(vertexFormatID, featureLevel);
+
+        auto *inputElement = &inputElements[inputElementCount];
+
+        inputElement->SemanticName         = "TEXCOORD";
+        inputElement->SemanticIndex        = semanticIndex;
+        inputElement->Format               = vertexFormatInfo.nativeFormat;
+        inputElement->InputSlot            = semanticIndex;
+        inputElement->AlignedByteOffset    = 0;
+        inputElement->InputSlotClass       = inputClass;
+        inputElement->InstanceDataStepRate = packedAttrib.divisor;
+
+        inputElementCount++;
+    }
+
+    // Only vertex executables that are already compiled can be used; a layout whose variant
+    // isn't available is created on first use instead.
+    ShaderExecutableD3D *shader =
+        executableD3D->getVertexExecutableForInputLayout(renderer, vertexInputLayout);
+    if (shader == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    ShaderExecutableD3D *shader11 = GetAs<ShaderExecutable11>(shader);
+
+    InputElementArray inputElementArray(inputElements.data(), inputElementCount);
+    ShaderData vertexShaderData(shader11->getFunction(), shader11->getLength());
+
+    ANGLE_TRY(renderer->allocateResource(context11, inputElementArray, &vertexShaderData,
+                                         inputLayoutOut));
+    return angle::Result::Continue;
+}
+
+void InputLayoutCache::recordProgramLayout(Context11 *context11,
+                                           const gl::State &state,
+                                           const PackedAttributeLayout &layout)
+{
+    const egl::BlobCache::Key *programHash = GetProgramHash(state);
+    if (programHash == nullptr)
+    {
+        return;
+    }
+
+    std::vector<PackedAttributeLayout> &layouts = mProgramLayouts[*programHash].layouts;
+    if (std::find(layouts.begin(), layouts.end(), layout) != layouts.end())
+    {
+        return;
+    }
+    layouts.push_back(layout);
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(static_cast<uint32_t>(layouts.size()));
+    for (const PackedAttributeLayout &recordedLayout : layouts)
+    {
+        stream.writeInt(recordedLayout.numAttributes);
+        stream.writeBytes(
+            reinterpret_cast<const unsigned char *>(recordedLayout.attributeData.data()),
+            sizeof(uint64_t) * recordedLayout.numAttributes);
+    }
+
+    angle::MemoryBuffer value;
+    if (!value.resize(stream.length()))
+    {
+        return;
+    }
+    memcpy(value.data(), stream.data(), stream.length());
+
+    egl::BlobCache::Key key;
+    ComputeProgramLayoutsKey(*programHash, &key);
+
+    egl::BlobCache &blobCache = context11->getRenderer()->getDisplay()->getBlobCache();
+    blobCache.put(nullptr, key, std::move(value));
+}
+
 angle::Result InputLayoutCache::createInputLayout(
     Context11 *context11,
     const AttribIndexArray &sortedSemanticIndices,
@@ -196,7 +449,10 @@ angle::Result InputLayoutCache::createInputLayout(
 
         angle::FormatID vertexFormatID =
             gl::GetVertexFormatID(*attrib.attribute, attrib.currentValueType);
-        const auto &vertexFormatInfo = d3d11::GetVertexFormatInfo(vertexFormatID, featureLevel);
+        const auto &vertexFormatInfo =
+            attrib.forceFloatConversion
+                ? d3d11::GetFloatConversionVertexFormatInfo(vertexFormatID)
+                : d3d11::GetVertexFormatInfo(vertexFormatID, featureLevel);
 
         auto *inputElement = &inputElements[inputElementCount];
 
@@ -228,8 +484,8 @@ angle::Result InputLayoutCache::createInputLayout(
 void InputLayoutCache::setCacheSize(size_t newCacheSize)
 {
     // Forces a reset of the cache.
-    LayoutCache newCache(newCacheSize);
-    mLayoutCache.Swap(newCache);
+    mLayoutCache.clear();
+    mMaxCacheSize = newCacheSize;
 }
 
 }  // namespace rx
@@ -17,10 +17,13 @@
 #include <array>
 #include <map>
 
+#include "common/MemoryBuffer.h"
 #include "common/angleutils.h"
+#include "common/hash_containers.h"
+#include "common/hash_utils.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Error.h"
-#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/d3d/RendererD3D.h"
 #include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
@@ -51,7 +54,9 @@ struct hash<rx::PackedAttributeLayout>
 {
     size_t operator()(const rx::PackedAttributeLayout &value) const
     {
-        return angle::ComputeGenericHash(value);
+        // Only the used attributes are hashed; the rest of the key is always zero.
+        return angle::ComputeGenericHash(value.attributeData.data(),
+                                         sizeof(uint64_t) * value.numAttributes);
     }
 };
 }  // namespace std
@@ -64,6 +69,7 @@ class Program;
 namespace rx
 {
 class Context11;
+class ProgramExecutableD3D;
 struct TranslatedAttribute;
 struct TranslatedIndexData;
 struct SourceIndexData;
@@ -100,14 +106,34 @@ class InputLayoutCache : angle::NonCopyable
         GLsizei instances,
         d3d11::InputLayout *inputLayoutOut);
 
+    // With the prewarmInputLayouts feature, the layouts created for a program are stored in the
+    // blob cache under a key derived from the program hash.  The first time the program is drawn
+    // with, all of its recorded layouts that have a matching vertex executable are created at once.
+    angle::Result warmUpProgramLayouts(Context11 *context11, const gl::State &state);
+    angle::Result createInputLayoutFromKey(Context11 *context11,
+                                           const PackedAttributeLayout &layout,
+                                           d3d11::InputLayout *inputLayoutOut);
+    void recordProgramLayout(Context11 *context11,
+                             const gl::State &state,
+                             const PackedAttributeLayout &layout);
+    d3d11::InputLayout *insertLayout(const PackedAttributeLayout &layout,
+                                     d3d11::InputLayout &&inputLayout);
+
     // Starting cache size.
     static constexpr size_t kDefaultCacheSize = 1024;
 
-    // The cache tries to clean up this many states at once.
-    static constexpr size_t kGCLimit = 128;
-
-    using LayoutCache = angle::base::HashingMRUCache<PackedAttributeLayout, d3d11::InputLayout>;
+    using LayoutCache = angle::HashMap<PackedAttributeLayout, d3d11::InputLayout>;
     LayoutCache mLayoutCache;
+    size_t mMaxCacheSize;
+
+    struct ProgramLayouts
+    {
+        bool warmedUp = false;
+        std::vector<PackedAttributeLayout> layouts;
+    };
+    angle::HashMap<egl::BlobCache::Key, ProgramLayouts> mProgramLayouts;
+    const ProgramExecutableD3D *mLastWarmedUpExecutable;
+    angle::ScratchBuffer mScratchBuffer;
 };
 
 }  // namespace rx
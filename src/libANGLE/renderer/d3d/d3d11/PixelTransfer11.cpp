@@ -11,14 +11,18 @@
 
 #include "libANGLE/renderer/d3d/d3d11/PixelTransfer11.h"
 
+#include <sstream>
+
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/InfoLog.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
 #include "libANGLE/renderer/d3d/d3d11/Context11.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderTarget11.h"
 #include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "libANGLE/renderer/d3d/d3d11/ShaderExecutable11.h"
 #include "libANGLE/renderer/d3d/d3d11/TextureStorage11.h"
 #include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
@@ -35,6 +39,259 @@
 namespace rx
 {
 
+namespace
+{
+// Reads the unpack buffer one byte at a time through an R8_UINT view, so any layout of components
+// can be decoded.  The pixel index comes from the BufferToTexture vertex shader, set up for a
+// tightly packed destination area.
+constexpr char kBufferToTextureConvertHLSL[] = R"(
+Buffer<uint> SourceBytes : register(t0);
+
+cbuffer ConvertParams : register(b0)
+{
+    uint ByteOffset;
+    uint RowPitch;
+    uint DepthPitch;
+    uint Width;
+    uint Height;
+};
+
+uint LoadBits(uint address)
+{
+    uint bits = 0;
+    [unroll] for (uint i = 0; i < COMPONENT_BYTES; ++i)
+    {
+        bits |= SourceBytes.Load(address + i) << (8 * i);
+    }
+    return bits;
+}
+
+int SignExtend(uint bits)
+{
+    uint shift = 32 - 8 * COMPONENT_BYTES;
+    return int(bits << shift) >> shift;
+}
+
+float Unorm(uint bits)
+{
+    return float(bits) / COMPONENT_MAX;
+}
+
+float Snorm(uint bits)
+{
+    return max(float(SignExtend(bits)) / COMPONENT_MAX, -1.0);
+}
+
+uint Uint(uint bits)
+{
+    return bits;
+}
+
+int Sint(uint bits)
+{
+    return SignExtend(bits);
+}
+
+float Float(uint bits)
+{
+    return asfloat(bits);
+}
+
+float Half(uint bits)
+{
+    uint exponent = (bits >> 10) & 0x1F;
+    uint mantissa = bits & 0x3FF;
+    float value;
+    if (exponent == 0)
+    {
+        value = float(mantissa) * exp2(-24.0);
+    }
+    else if (exponent == 31)
+    {
+        value = (mantissa == 0) ? asfloat(0x7F800000u) : asfloat(0x7FC00000u);
+    }
+    else
+    {
+        value = float(mantissa + 1024) * exp2(float(exponent) - 25.0);
+    }
+    return ((bits & 0x8000) != 0) ? -value : value;
+}
+
+OUTPUT_TYPE main(in float4 inPosition : SV_Position, in uint inIndex : TEXCOORD0) : SV_Target
+{
+    uint pixelsPerSlice = Width * Height;
+    uint slice          = inIndex / pixelsPerSlice;
+    uint indexInSlice   = inIndex - slice * pixelsPerSlice;
+    uint row            = indexInSlice / Width;
+    uint col            = indexInSlice - row * Width;
+    uint address        = ByteOffset + slice * DepthPitch + row * RowPitch +
+                          col * (COMPONENT_COUNT * COMPONENT_BYTES);
+
+    OUTPUT_TYPE c = 0;
+    [unroll] for (uint i = 0; i < COMPONENT_COUNT; ++i)
+    {
+        c[i] = CONVERT(LoadBits(address + i * COMPONENT_BYTES));
+    }
+    return OUTPUT_TYPE(SWIZZLE);
+}
+)";
+
+struct ConvertingCopyInfo
+{
+    unsigned int componentCount;
+    unsigned int componentBytes;
+    bool isSigned;
+    const char *convert;
+    const char *outputType;
+    const char *swizzle;
+};
+
+bool GetConvertingCopyInfo(GLenum destinationFormat,
+                           GLenum type,
+                           const Renderer11DeviceCaps &caps,
+                           ConvertingCopyInfo *infoOut)
+{
+    const gl::InternalFormat &destFormatInfo = gl::GetSizedInternalFormatInfo(destinationFormat);
+    if (destFormatInfo.internalFormat == GL_NONE || destFormatInfo.compressed ||
+        destFormatInfo.depthBits > 0 || destFormatInfo.stencilBits > 0)
+    {
+        return false;
+    }
+
+    // The source pixels of RGBX8 have a padding component the layout below doesn't account for.
+    if (destFormatInfo.sizedInternalFormat == GL_RGBX8_ANGLE)
+    {
+        return false;
+    }
+
+    // The data is already encoded, and would be encoded again by an sRGB render target.
+    if (destFormatInfo.colorEncoding == GL_SRGB)
+    {
+        return false;
+    }
+
+    const d3d11::Format &d3d11FormatInfo = d3d11::Format::Get(destinationFormat, caps);
+    if (d3d11FormatInfo.rtvFormat == DXGI_FORMAT_UNKNOWN)
+    {
+        return false;
+    }
+
+    switch (destFormatInfo.format)
+    {
+        case GL_RED:
+        case GL_RED_INTEGER:
+            infoOut->componentCount = 1;
+            infoOut->swizzle        = "c.x, 0, 0, 1";
+            break;
+        case GL_ALPHA:
+            infoOut->componentCount = 1;
+            infoOut->swizzle        = "0, 0, 0, c.x";
+            break;
+        case GL_LUMINANCE:
+            infoOut->componentCount = 1;
+            infoOut->swizzle        = "c.x, c.x, c.x, 1";
+            break;
+        case GL_RG:
+        case GL_RG_INTEGER:
+            infoOut->componentCount = 2;
+            infoOut->swizzle        = "c.x, c.y, 0, 1";
+            break;
+        case GL_LUMINANCE_ALPHA:
+            infoOut->componentCount = 2;
+            infoOut->swizzle        = "c.x, c.x, c.x, c.y";
+            break;
+        case GL_RGB:
+        case GL_RGB_INTEGER:
+            infoOut->componentCount = 3;
+            infoOut->swizzle        = "c.x, c.y, c.z, 1";
+            break;
+        case GL_RGBA:
+        case GL_RGBA_INTEGER:
+            infoOut->componentCount = 4;
+            infoOut->swizzle        = "c";
+            break;
+        default:
+            return false;
+    }
+
+    const bool isInteger = destFormatInfo.isInt();
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+        case GL_UNSIGNED_SHORT:
+        case GL_BYTE:
+        case GL_SHORT:
+            infoOut->componentBytes = (type == GL_UNSIGNED_BYTE || type == GL_BYTE) ? 1 : 2;
+            infoOut->isSigned       = (type == GL_BYTE || type == GL_SHORT);
+            if (isInteger)
+            {
+                infoOut->convert = infoOut->isSigned ? "Sint" : "Uint";
+            }
+            else
+            {
+                infoOut->convert = infoOut->isSigned ? "Snorm" : "Unorm";
+            }
+            break;
+        case GL_UNSIGNED_INT:
+        case GL_INT:
+            // Only integer color formats take 32-bit integer data.
+            if (!isInteger)
+            {
+                return false;
+            }
+            infoOut->componentBytes = 4;
+            infoOut->isSigned       = (type == GL_INT);
+            infoOut->convert        = infoOut->isSigned ? "Sint" : "Uint";
+            break;
+        case GL_HALF_FLOAT:
+        case GL_HALF_FLOAT_OES:
+        case GL_FLOAT:
+            if (isInteger)
+            {
+                return false;
+            }
+            infoOut->componentBytes = (type == GL_FLOAT) ? 4 : 2;
+            infoOut->isSigned       = true;
+            infoOut->convert        = (type == GL_FLOAT) ? "Float" : "Half";
+            break;
+        default:
+            // Packed types are left to the CPU.
+            return false;
+    }
+
+    switch (destFormatInfo.componentType)
+    {
+        case GL_INT:
+            infoOut->outputType = "int4";
+            break;
+        case GL_UNSIGNED_INT:
+            infoOut->outputType = "uint4";
+            break;
+        default:
+            infoOut->outputType = "float4";
+            break;
+    }
+
+    return true;
+}
+
+std::string GetConvertingCopyDefines(const ConvertingCopyInfo &info)
+{
+    const unsigned int componentBits = info.componentBytes * 8;
+    const uint64_t componentMax =
+        (uint64_t(1) << (info.isSigned ? componentBits - 1 : componentBits)) - 1;
+
+    std::ostringstream stream;
+    stream << "#define COMPONENT_COUNT " << info.componentCount << "\n"
+           << "#define COMPONENT_BYTES " << info.componentBytes << "\n"
+           << "#define COMPONENT_MAX " << componentMax << ".0\n"
+           << "#define CONVERT " << info.convert << "\n"
+           << "#define OUTPUT_TYPE " << info.outputType << "\n"
+           << "#define SWIZZLE " << info.swizzle << "\n";
+    return stream.str();
+}
+}  // anonymous namespace
+
 PixelTransfer11::PixelTransfer11(Renderer11 *renderer)
     : mRenderer(renderer),
       mResourcesLoaded(false),
@@ -42,7 +299,8 @@ PixelTransfer11::PixelTransfer11(Renderer11 *renderer)
       mBufferToTextureGS(),
       mParamsConstantBuffer(),
       mCopyRasterizerState(),
-      mCopyDepthStencilState()
+      mCopyDepthStencilState(),
+      mConvertParamsConstantBuffer()
 {}
 
 PixelTransfer11::~PixelTransfer11() {}
@@ -99,6 +357,11 @@ angle::Result PixelTransfer11::loadResources(const gl::Context *context)
     ANGLE_TRY(mRenderer->allocateResource(context11, constantBufferDesc, &mParamsConstantBuffer));
     mParamsConstantBuffer.setInternalName("PixelTransfer11ConstantBuffer");
 
+    constantBufferDesc.ByteWidth = roundUpPow2<UINT>(sizeof(ConvertShaderParams), 32u);
+    ANGLE_TRY(
+        mRenderer->allocateResource(context11, constantBufferDesc, &mConvertParamsConstantBuffer));
+    mConvertParamsConstantBuffer.setInternalName("PixelTransfer11ConvertConstantBuffer");
+
     // init shaders
     ANGLE_TRY(mRenderer->allocateResource(context11, ShaderData(g_VS_BufferToTexture),
                                           &mBufferToTextureVS));
@@ -111,6 +374,7 @@ angle::Result PixelTransfer11::loadResources(const gl::Context *context)
     ANGLE_TRY(buildShaderMap(context));
 
     StructZero(&mParamsData);
+    StructZero(&mConvertParamsData);
 
     mResourcesLoaded = true;
 
@@ -167,34 +431,95 @@ angle::Result PixelTransfer11::copyBufferToTexture(const gl::Context *context,
            destArea.y + destArea.height <= destSize.height && destArea.z >= 0 &&
            destArea.z + destArea.depth <= destSize.depth);
 
-    ASSERT(mRenderer->supportsFastCopyBufferToTexture(destinationFormat));
-
-    const d3d11::PixelShader *pixelShader = findBufferToTexturePS(destinationFormat);
-    ASSERT(pixelShader);
+    ASSERT(mRenderer->supportsFastCopyBufferToTexture(destinationFormat, sourcePixelsType));
 
-    // The SRV must be in the proper read format, which may be different from the destination format
-    // EG: for half float data, we can load full precision floats with implicit conversion
-    GLenum unsizedFormat = gl::GetUnsizedFormat(destinationFormat);
-    const gl::InternalFormat &sourceglFormatInfo =
-        gl::GetInternalFormatInfo(unsizedFormat, sourcePixelsType);
-
-    const d3d11::Format &sourceFormatInfo = d3d11::Format::Get(
-        sourceglFormatInfo.sizedInternalFormat, mRenderer->getRenderer11DeviceCaps());
-    DXGI_FORMAT srvFormat = sourceFormatInfo.srvFormat;
-    ASSERT(srvFormat != DXGI_FORMAT_UNKNOWN);
     Buffer11 *bufferStorage11                  = GetAs<Buffer11>(unpackBuffer->getImplementation());
     const d3d11::ShaderResourceView *bufferSRV = nullptr;
-    ANGLE_TRY(bufferStorage11->getSRV(context, srvFormat, &bufferSRV));
+    const d3d11::PixelShader *pixelShader      = nullptr;
+    CopyShaderParams shaderParams;
+
+    if (mRenderer->supportsDirectCopyBufferToTexture(destinationFormat))
+    {
+        pixelShader = findBufferToTexturePS(destinationFormat);
+        ASSERT(pixelShader);
+
+        // The SRV must be in the proper read format, which may be different from the destination
+        // format EG: for half float data, we can load full precision floats with implicit
+        // conversion
+        GLenum unsizedFormat = gl::GetUnsizedFormat(destinationFormat);
+        const gl::InternalFormat &sourceglFormatInfo =
+            gl::GetInternalFormatInfo(unsizedFormat, sourcePixelsType);
+
+        const d3d11::Format &sourceFormatInfo = d3d11::Format::Get(
+            sourceglFormatInfo.sizedInternalFormat, mRenderer->getRenderer11DeviceCaps());
+        DXGI_FORMAT srvFormat = sourceFormatInfo.srvFormat;
+        ASSERT(srvFormat != DXGI_FORMAT_UNKNOWN);
+        ANGLE_TRY(bufferStorage11->getSRV(context, srvFormat, &bufferSRV));
+
+        setBufferToTextureCopyParams(destArea, destSize, sourceglFormatInfo.sizedInternalFormat,
+                                     unpack, offset, &shaderParams);
+    }
+    else
+    {
+        ANGLE_TRY(getConvertingPS(context, destinationFormat, sourcePixelsType, &pixelShader));
+        ANGLE_TRY(bufferStorage11->getSRV(context, DXGI_FORMAT_R8_UINT, &bufferSRV));
+
+        // The conversion shader applies the unpack state itself, so the vertex shader only has to
+        // enumerate the pixels of the destination area.
+        gl::PixelUnpackState packedUnpack;
+        packedUnpack.alignment = 1;
+        setBufferToTextureCopyParams(destArea, destSize, destinationFormat, packedUnpack, 0,
+                                     &shaderParams);
+
+        Context11 *context11 = GetImplAs<Context11>(context);
+        const gl::InternalFormat &destFormatInfo =
+            gl::GetSizedInternalFormatInfo(destinationFormat);
+
+        GLuint rowPitch = 0;
+        ANGLE_CHECK_GL_MATH(context11, destFormatInfo.computeRowPitch(
+                                           sourcePixelsType, destArea.width, unpack.alignment,
+                                           unpack.rowLength, &rowPitch));
+        GLuint depthPitch = 0;
+        ANGLE_CHECK_GL_MATH(context11, destFormatInfo.computeDepthPitch(
+                                           destArea.height, unpack.imageHeight, rowPitch,
+                                           &depthPitch));
+
+        ConvertShaderParams convertParams;
+        StructZero(&convertParams);
+        convertParams.ByteOffset = offset;
+        convertParams.RowPitch   = rowPitch;
+        convertParams.DepthPitch = depthPitch;
+        convertParams.Width      = static_cast<unsigned int>(destArea.width);
+        convertParams.Height     = static_cast<unsigned int>(destArea.height);
+
+        if (!StructEquals(mConvertParamsData, convertParams))
+        {
+            d3d11::SetBufferData(mRenderer->getDeviceContext(), mConvertParamsConstantBuffer.get(),
+                                 convertParams);
+            mConvertParamsData = convertParams;
+        }
+
+        mRenderer->getStateManager()->setPixelConstantBuffer(0, &mConvertParamsConstantBuffer);
+    }
     ASSERT(bufferSRV != nullptr);
 
+    return drawBufferToTexture(context, pixelShader, bufferSRV, destRenderTarget, destArea,
+                               shaderParams);
+}
+
+angle::Result PixelTransfer11::drawBufferToTexture(const gl::Context *context,
+                                                   const d3d11::PixelShader *pixelShader,
+                                                   const d3d11::ShaderResourceView *bufferSRV,
+                                                   RenderTargetD3D *destRenderTarget,
+                                                   const gl::Box &destArea,
+                                                   const CopyShaderParams &shaderParams)
+{
+    gl::Extents destSize = destRenderTarget->getExtents();
+
     const d3d11::RenderTargetView &textureRTV =
         GetAs<RenderTarget11>(destRenderTarget)->getRenderTargetView();
     ASSERT(textureRTV.valid());
 
-    CopyShaderParams shaderParams;
-    setBufferToTextureCopyParams(destArea, destSize, sourceglFormatInfo.sizedInternalFormat, unpack,
-                                 offset, &shaderParams);
-
     ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
 
     // Are we doing a 2D or 3D copy?
@@ -268,4 +593,48 @@ const d3d11::PixelShader *PixelTransfer11::findBufferToTexturePS(GLenum internal
     return (shaderMapIt == mBufferToTexturePSMap.end() ? nullptr : &shaderMapIt->second);
 }
 
+angle::Result PixelTransfer11::getConvertingPS(const gl::Context *context,
+                                               GLenum destinationFormat,
+                                               GLenum sourcePixelsType,
+                                               const d3d11::PixelShader **pixelShaderOut)
+{
+    ConvertingCopyInfo info;
+    bool supported = GetConvertingCopyInfo(destinationFormat, sourcePixelsType,
+                                           mRenderer->getRenderer11DeviceCaps(), &info);
+    ASSERT(supported);
+
+    const std::string defines = GetConvertingCopyDefines(info);
+
+    auto shaderMapIt = mConvertingPSMap.find(defines);
+    if (shaderMapIt == mConvertingPSMap.end())
+    {
+        Context11 *context11 = GetImplAs<Context11>(context);
+
+        gl::InfoLog infoLog;
+        ShaderExecutableD3D *executable = nullptr;
+        ANGLE_TRY(mRenderer->compileToExecutable(context11, infoLog,
+                                                 defines + kBufferToTextureConvertHLSL,
+                                                 gl::ShaderType::Fragment, {}, false,
+                                                 CompilerWorkaroundsD3D(), &executable));
+        ANGLE_CHECK_HR(context11, executable != nullptr,
+                       "Failed to compile the unpack buffer conversion shader.", E_FAIL);
+
+        shaderMapIt =
+            mConvertingPSMap.emplace(defines, std::unique_ptr<ShaderExecutableD3D>(executable))
+                .first;
+    }
+
+    *pixelShaderOut = &GetAs<ShaderExecutable11>(shaderMapIt->second.get())->getPixelShader();
+    return angle::Result::Continue;
+}
+
+// static
+bool PixelTransfer11::SupportsConvertingCopy(GLenum destinationFormat,
+                                             GLenum type,
+                                             const Renderer11DeviceCaps &caps)
+{
+    ConvertingCopyInfo info;
+    return GetConvertingCopyInfo(destinationFormat, type, caps, &info);
+}
+
 }  // namespace rx
@@ -14,6 +14,8 @@
 #include <GLES2/gl2.h>
 
 #include <map>
+#include <memory>
+#include <string>
 
 #include <libANGLE/angletypes.h>
 #include "common/platform.h"
@@ -29,7 +31,9 @@ class Context;
 namespace rx
 {
 class Renderer11;
+struct Renderer11DeviceCaps;
 class RenderTargetD3D;
+class ShaderExecutableD3D;
 
 class PixelTransfer11
 {
@@ -51,6 +55,13 @@ class PixelTransfer11
                                       GLenum sourcePixelsType,
                                       const gl::Box &destArea);
 
+    // Whether unpacking data of |type| to |destinationFormat| can be done by a pixel shader that
+    // converts the data as it is read, when the data can't be read in the destination format
+    // directly.
+    static bool SupportsConvertingCopy(GLenum destinationFormat,
+                                       GLenum type,
+                                       const Renderer11DeviceCaps &caps);
+
   private:
     struct CopyShaderParams
     {
@@ -65,6 +76,16 @@ class PixelTransfer11
         unsigned int FirstSlice;
     };
 
+    struct ConvertShaderParams
+    {
+        unsigned int ByteOffset;
+        unsigned int RowPitch;
+        unsigned int DepthPitch;
+        unsigned int Width;
+        unsigned int Height;
+        unsigned int Padding[3];
+    };
+
     static void setBufferToTextureCopyParams(const gl::Box &destArea,
                                              const gl::Extents &destSize,
                                              GLenum internalFormat,
@@ -75,6 +96,17 @@ class PixelTransfer11
     angle::Result loadResources(const gl::Context *context);
     angle::Result buildShaderMap(const gl::Context *context);
     const d3d11::PixelShader *findBufferToTexturePS(GLenum internalFormat) const;
+    angle::Result getConvertingPS(const gl::Context *context,
+                                  GLenum destinationFormat,
+                                  GLenum sourcePixelsType,
+                                  const d3d11::PixelShader **pixelShaderOut);
+
+    angle::Result drawBufferToTexture(const gl::Context *context,
+                                      const d3d11::PixelShader *pixelShader,
+                                      const d3d11::ShaderResourceView *bufferSRV,
+                                      RenderTargetD3D *destRenderTarget,
+                                      const gl::Box &destArea,
+                                      const CopyShaderParams &shaderParams);
 
     Renderer11 *mRenderer;
 
@@ -85,6 +117,11 @@ class PixelTransfer11
     d3d11::Buffer mParamsConstantBuffer;
     CopyShaderParams mParamsData;
 
+    // Conversion shaders are compiled on first use, keyed by their defines.
+    std::map<std::string, std::unique_ptr<ShaderExecutableD3D>> mConvertingPSMap;
+    d3d11::Buffer mConvertParamsConstantBuffer;
+    ConvertShaderParams mConvertParamsData;
+
     d3d11::RasterizerState mCopyRasterizerState;
     d3d11::DepthStencilState mCopyDepthStencilState;
 };
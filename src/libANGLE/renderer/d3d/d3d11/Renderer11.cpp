@@ -50,6 +50,7 @@
 #include "libANGLE/renderer/d3d/d3d11/Query11.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderTarget11.h"
 #include "libANGLE/renderer/d3d/d3d11/ShaderExecutable11.h"
+#include "libANGLE/renderer/d3d/d3d11/StagingTexturePool11.h"
 #include "libANGLE/renderer/d3d/d3d11/StreamProducerD3DTexture.h"
 #include "libANGLE/renderer/d3d/d3d11/SwapChain11.h"
 #include "libANGLE/renderer/d3d/d3d11/TextureStorage11.h"
@@ -420,8 +421,9 @@ Renderer11::Renderer11(egl::Display *display)
     mLineLoopIB    = nullptr;
     mTriangleFanIB = nullptr;
 
-    mBlit          = nullptr;
-    mPixelTransfer = nullptr;
+    mBlit               = nullptr;
+    mPixelTransfer      = nullptr;
+    mStagingTexturePool = nullptr;
 
     mClear = nullptr;
 
@@ -1054,6 +1056,9 @@ egl::Error Renderer11::initializeDevice()
     ASSERT(!mPixelTransfer);
     mPixelTransfer = new PixelTransfer11(this);
 
+    ASSERT(!mStagingTexturePool);
+    mStagingTexturePool = new StagingTexturePool11(this);
+
     // Gather stats on DXGI and D3D feature level
     ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.SupportsDXGI1_2", mRenderer11DeviceCaps.supportsDXGI1_2);
 
@@ -1381,6 +1386,9 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
     // If present path fast is active then the surface orientation extension isn't supported
     outExtensions->surfaceOrientation = !mPresentPathFastEnabled;
 
+    // Swaps are paced with event queries in SwapChain11.
+    outExtensions->maxFrameLatencyANGLE = true;
+
     // D3D11 does not support present with dirty rectangles until DXGI 1.2.
     outExtensions->postSubBuffer = mRenderer11DeviceCaps.supportsDXGI1_2;
 
@@ -1764,10 +1772,12 @@ SwapChainD3D *Renderer11::createSwapChain(NativeWindowD3D *nativeWindow,
                                           GLenum backBufferFormat,
                                           GLenum depthBufferFormat,
                                           EGLint orientation,
-                                          EGLint samples)
+                                          EGLint samples,
+                                          EGLint maxFrameLatency)
 {
     return new SwapChain11(this, GetAs<NativeWindow11>(nativeWindow), shareHandle, d3dTexture,
-                           backBufferFormat, depthBufferFormat, orientation, samples);
+                           backBufferFormat, depthBufferFormat, orientation, samples,
+                           maxFrameLatency);
 }
 
 void *Renderer11::getD3DDevice()
@@ -2159,6 +2169,7 @@ void Renderer11::releaseDeviceResources()
     SafeDelete(mClear);
     SafeDelete(mTrim);
     SafeDelete(mPixelTransfer);
+    SafeDelete(mStagingTexturePool);
 
     mSyncQuery.reset();
 
@@ -3198,10 +3209,21 @@ StreamProducerImpl *Renderer11::createStreamProducerD3DTexture(
     return new StreamProducerD3DTexture(this);
 }
 
-bool Renderer11::supportsFastCopyBufferToTexture(GLenum internalFormat) const
+bool Renderer11::supportsFastCopyBufferToTexture(GLenum internalFormat, GLenum type) const
 {
     ASSERT(getNativeExtensions().pixelBufferObjectNV);
 
+    if (supportsDirectCopyBufferToTexture(internalFormat))
+    {
+        return true;
+    }
+
+    return getFeatures().convertUnpackBufferOnGPU.enabled &&
+           PixelTransfer11::SupportsConvertingCopy(internalFormat, type, mRenderer11DeviceCaps);
+}
+
+bool Renderer11::supportsDirectCopyBufferToTexture(GLenum internalFormat) const
+{
     const gl::InternalFormat &internalFormatInfo = gl::GetSizedInternalFormatInfo(internalFormat);
     const d3d11::Format &d3d11FormatInfo =
         d3d11::Format::Get(internalFormat, mRenderer11DeviceCaps);
@@ -3254,7 +3276,7 @@ angle::Result Renderer11::fastCopyBufferToTexture(const gl::Context *context,
                                                   GLenum sourcePixelsType,
                                                   const gl::Box &destArea)
 {
-    ASSERT(supportsFastCopyBufferToTexture(destinationFormat));
+    ASSERT(supportsFastCopyBufferToTexture(destinationFormat, sourcePixelsType));
     return mPixelTransfer->copyBufferToTexture(context, unpack, unpackBuffer, offset,
                                                destRenderTarget, destinationFormat,
                                                sourcePixelsType, destArea);
@@ -4056,6 +4078,7 @@ angle::Result Renderer11::getVertexSpaceRequired(const gl::Context *context,
                                                  size_t count,
                                                  GLsizei instances,
                                                  GLuint baseInstance,
+                                                 bool forceFloatConversion,
                                                  unsigned int *bytesRequiredOut) const
 {
     if (!attrib.enabled)
@@ -4082,7 +4105,8 @@ angle::Result Renderer11::getVertexSpaceRequired(const gl::Context *context,
 
     const D3D_FEATURE_LEVEL featureLevel = mRenderer11DeviceCaps.featureLevel;
     const d3d11::VertexFormat &vertexFormatInfo =
-        d3d11::GetVertexFormatInfo(attrib.format->id, featureLevel);
+        forceFloatConversion ? d3d11::GetFloatConversionVertexFormatInfo(attrib.format->id)
+                             : d3d11::GetVertexFormatInfo(attrib.format->id, featureLevel);
     const d3d11::DXGIFormatSize &dxgiFormatInfo =
         d3d11::GetDXGIFormatSizeInfo(vertexFormatInfo.nativeFormat);
     unsigned int elementSize = dxgiFormatInfo.pixelBytes;
@@ -40,6 +40,7 @@ class IndexDataManager;
 struct PackPixelsParams;
 class PixelTransfer11;
 class RenderTarget11;
+class StagingTexturePool11;
 class StreamingIndexBufferInterface;
 class Trim11;
 class VertexDataManager;
@@ -106,7 +107,8 @@ class Renderer11 : public RendererD3D
                                   GLenum backBufferFormat,
                                   GLenum depthBufferFormat,
                                   EGLint orientation,
-                                  EGLint samples) override;
+                                  EGLint samples,
+                                  EGLint maxFrameLatency) override;
     egl::Error getD3DTextureInfo(const egl::Config *configuration,
                                  IUnknown *d3dTexture,
                                  const egl::AttributeMap &attribs,
@@ -305,6 +307,11 @@ class Renderer11 : public RendererD3D
     ID3D11Device *getDevice() { return mDevice.Get(); }
     ID3D11Device1 *getDevice1() { return mDevice1.Get(); }
     void *getD3DDevice() override;
+    // All contexts of the display record on the immediate context.  Recording into deferred
+    // contexts is not supported: StateManager11 and the resource caches are shared by every
+    // Context11 and assume a single, in-order device context, and deferred contexts cannot Map
+    // for reading, resolve queries, or Map for writing without DISCARD (which the buffer and
+    // texture upload paths rely on).
     ID3D11DeviceContext *getDeviceContext() { return mDeviceContext.Get(); }
     ID3D11DeviceContext1 *getDeviceContext1IfSupported() { return mDeviceContext1.Get(); }
     IDXGIFactory *getDxgiFactory() { return mDxgiFactory.Get(); }
@@ -326,10 +333,14 @@ class Renderer11 : public RendererD3D
 
     Blit11 *getBlitter() { return mBlit; }
     Clear11 *getClearer() { return mClear; }
+    StagingTexturePool11 *getStagingTexturePool() { return mStagingTexturePool; }
     DebugAnnotatorContext11 *getDebugAnnotatorContext();
 
     // Buffer-to-texture and Texture-to-buffer copies
-    bool supportsFastCopyBufferToTexture(GLenum internalFormat) const override;
+    bool supportsFastCopyBufferToTexture(GLenum internalFormat, GLenum type) const override;
+    // Whether the data can be read from the unpack buffer in the destination format, without a
+    // conversion shader.
+    bool supportsDirectCopyBufferToTexture(GLenum internalFormat) const;
     angle::Result fastCopyBufferToTexture(const gl::Context *context,
                                           const gl::PixelUnpackState &unpack,
                                           gl::Buffer *unpackBuffer,
@@ -356,6 +367,7 @@ class Renderer11 : public RendererD3D
                                          size_t count,
                                          GLsizei instances,
                                          GLuint baseInstance,
+                                         bool forceFloatConversion,
                                          unsigned int *bytesRequiredOut) const override;
 
     angle::Result readFromAttachment(const gl::Context *context,
@@ -591,6 +603,7 @@ class Renderer11 : public RendererD3D
     // Texture copy resources
     Blit11 *mBlit;
     PixelTransfer11 *mPixelTransfer;
+    StagingTexturePool11 *mStagingTexturePool;
 
     // Masked clear resources
     Clear11 *mClear;
@@ -0,0 +1,173 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StagingTexturePool11.cpp: Defines the StagingTexturePool11 class.
+
+#include "libANGLE/renderer/d3d/d3d11/StagingTexturePool11.h"
+
+#include <cstring>
+
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/d3d/d3d11/Context11.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
+
+namespace rx
+{
+
+namespace
+{
+// The size of the top level of the texture, which is all Image11 uses.
+size_t EstimateTextureSize(const TextureHelper11 &texture)
+{
+    const d3d11::DXGIFormatSize &sizeInfo = d3d11::GetDXGIFormatSizeInfo(texture.getFormat());
+    if (sizeInfo.blockWidth == 0 || sizeInfo.blockHeight == 0)
+    {
+        return 0;
+    }
+
+    const gl::Extents extents = texture.getExtents();
+    const size_t blocksWide   = (extents.width + sizeInfo.blockWidth - 1) / sizeInfo.blockWidth;
+    const size_t blocksHigh   = (extents.height + sizeInfo.blockHeight - 1) / sizeInfo.blockHeight;
+    return blocksWide * blocksHigh * extents.depth * sizeInfo.pixelBytes;
+}
+
+bool IsSameDesc(const TextureHelper11 &texture, const D3D11_TEXTURE2D_DESC &desc)
+{
+    if (!texture.is2D())
+    {
+        return false;
+    }
+    D3D11_TEXTURE2D_DESC textureDesc;
+    texture.getDesc(&textureDesc);
+    return memcmp(&textureDesc, &desc, sizeof(desc)) == 0;
+}
+
+bool IsSameDesc(const TextureHelper11 &texture, const D3D11_TEXTURE3D_DESC &desc)
+{
+    if (!texture.is3D())
+    {
+        return false;
+    }
+    D3D11_TEXTURE3D_DESC textureDesc;
+    texture.getDesc(&textureDesc);
+    return memcmp(&textureDesc, &desc, sizeof(desc)) == 0;
+}
+}  // anonymous namespace
+
+StagingTexturePool11::StagingTexturePool11(Renderer11 *renderer)
+    : mRenderer(renderer), mTotalSize(0)
+{}
+
+StagingTexturePool11::~StagingTexturePool11() {}
+
+angle::Result StagingTexturePool11::acquire(const gl::Context *context,
+                                            const D3D11_TEXTURE2D_DESC &desc,
+                                            const d3d11::Format &format,
+                                            TextureHelper11 *textureOut)
+{
+    return acquireImpl(context, desc, format, textureOut);
+}
+
+angle::Result StagingTexturePool11::acquire(const gl::Context *context,
+                                            const D3D11_TEXTURE3D_DESC &desc,
+                                            const d3d11::Format &format,
+                                            TextureHelper11 *textureOut)
+{
+    return acquireImpl(context, desc, format, textureOut);
+}
+
+template <typename DescT>
+angle::Result StagingTexturePool11::acquireImpl(const gl::Context *context,
+                                                const DescT &desc,
+                                                const d3d11::Format &format,
+                                                TextureHelper11 *textureOut)
+{
+    ASSERT(!textureOut->valid());
+
+    // Make sure the texture that is eventually given back can be pooled.
+    ANGLE_TRY(ensureFreeFence(context));
+
+    Context11 *context11               = GetImplAs<Context11>(context);
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+
+    for (auto iter = mEntries.begin(); iter != mEntries.end(); ++iter)
+    {
+        if (&iter->texture.getFormatSet() != &format || !IsSameDesc(iter->texture, desc))
+        {
+            continue;
+        }
+
+        HRESULT result =
+            deviceContext->GetData(iter->fence.get(), nullptr, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        ANGLE_TRY_HR(context11, result, "Failed to get staging texture query data");
+
+        // Still in use; the newer entries are even less likely to be done.
+        if (result != S_OK)
+        {
+            break;
+        }
+
+        *textureOut = std::move(iter->texture);
+        mFreeFences.push_back(std::move(iter->fence));
+        mTotalSize -= iter->size;
+        mEntries.erase(iter);
+        break;
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result StagingTexturePool11::ensureFreeFence(const gl::Context *context)
+{
+    if (!mFreeFences.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    Context11 *context11 = GetImplAs<Context11>(context);
+
+    D3D11_QUERY_DESC queryDesc;
+    queryDesc.Query     = D3D11_QUERY_EVENT;
+    queryDesc.MiscFlags = 0;
+
+    d3d11::Query fence;
+    ANGLE_TRY(mRenderer->allocateResource(context11, queryDesc, &fence));
+    mFreeFences.push_back(std::move(fence));
+
+    return angle::Result::Continue;
+}
+
+void StagingTexturePool11::release(TextureHelper11 &&texture)
+{
+    const size_t size = EstimateTextureSize(texture);
+    if (mFreeFences.empty() || size == 0 || size > kMaxTotalSize)
+    {
+        texture.reset();
+        return;
+    }
+
+    Entry entry;
+    entry.texture = std::move(texture);
+    entry.fence   = std::move(mFreeFences.back());
+    entry.size    = size;
+    mFreeFences.pop_back();
+
+    mRenderer->getDeviceContext()->End(entry.fence.get());
+
+    mTotalSize += entry.size;
+    mEntries.push_back(std::move(entry));
+
+    while (mEntries.size() > kMaxEntries || mTotalSize > kMaxTotalSize)
+    {
+        Entry &oldest = mEntries.front();
+        mTotalSize -= oldest.size;
+        mFreeFences.push_back(std::move(oldest.fence));
+        mEntries.pop_front();
+    }
+}
+
+}  // namespace rx
@@ -0,0 +1,85 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StagingTexturePool11.h: Recycles the staging textures that Image11 uploads texture data
+// through, so redefining a texture doesn't allocate a new staging texture every time.
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_STAGINGTEXTUREPOOL11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_STAGINGTEXTUREPOOL11_H_
+
+#include <deque>
+#include <vector>
+
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+#include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+class Renderer11;
+
+// A released staging texture is kept along with an event query that is ended right after its
+// last use has been issued.  It is only handed out again once that query completes, so that
+// mapping it for writing never waits on the GPU.  Textures are matched by their desc and format,
+// and their contents are undefined when acquired.
+class StagingTexturePool11 final : angle::NonCopyable
+{
+  public:
+    explicit StagingTexturePool11(Renderer11 *renderer);
+    ~StagingTexturePool11();
+
+    // Sets |textureOut| to an idle pooled texture matching |desc| and |format|, or leaves it
+    // invalid if there is none.
+    angle::Result acquire(const gl::Context *context,
+                          const D3D11_TEXTURE2D_DESC &desc,
+                          const d3d11::Format &format,
+                          TextureHelper11 *textureOut);
+    angle::Result acquire(const gl::Context *context,
+                          const D3D11_TEXTURE3D_DESC &desc,
+                          const d3d11::Format &format,
+                          TextureHelper11 *textureOut);
+
+    // Must be called after the last GPU operation using |texture| has been issued.  The texture
+    // is simply released if there is no fence available for it.
+    void release(TextureHelper11 &&texture);
+
+  private:
+    struct Entry
+    {
+        TextureHelper11 texture;
+        d3d11::Query fence;
+        size_t size;
+    };
+
+    template <typename DescT>
+    angle::Result acquireImpl(const gl::Context *context,
+                              const DescT &desc,
+                              const d3d11::Format &format,
+                              TextureHelper11 *textureOut);
+    angle::Result ensureFreeFence(const gl::Context *context);
+
+    static constexpr size_t kMaxEntries = 16;
+    // Staging textures can be large; don't hold on to more than this many bytes of them.
+    static constexpr size_t kMaxTotalSize = 64 * 1024 * 1024;
+
+    Renderer11 *const mRenderer;
+
+    // Oldest first.
+    std::deque<Entry> mEntries;
+    size_t mTotalSize;
+
+    // Queries are allocated ahead of time, since release() may be called without a context.
+    std::vector<d3d11::Query> mFreeFences;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_STAGINGTEXTUREPOOL11_H_
@@ -226,6 +226,32 @@ bool CullsEverything(const gl::State &glState)
     return (glState.getRasterizerState().cullFace &&
             glState.getRasterizerState().cullMode == gl::CullFaceMode::FrontAndBack);
 }
+
+// Calls |applyRange(start, count)| once for each run of consecutive set bits in |slots|.
+template <typename MaskT, typename ApplyRangeT>
+void ForEachSlotRange(const MaskT &slots, ApplyRangeT &&applyRange)
+{
+    UINT start = 0;
+    UINT count = 0;
+    for (size_t slot : slots)
+    {
+        if (count > 0 && slot != start + count)
+        {
+            applyRange(start, count);
+            count = 0;
+        }
+        if (count == 0)
+        {
+            start = static_cast<UINT>(slot);
+        }
+        ++count;
+    }
+
+    if (count > 0)
+    {
+        applyRange(start, count);
+    }
+}
 }  // anonymous namespace
 
 // StateManager11::ViewCache Implementation.
@@ -768,45 +794,145 @@ template <typename SRVType>
 void StateManager11::setShaderResourceInternal(gl::ShaderType shaderType,
                                                UINT resourceSlot,
                                                const SRVType *srv)
+{
+    // Keep this call ordered after any SRV or sampler still pending for this stage.
+    flushDeferredTextureBindings(shaderType);
+
+    ID3D11ShaderResourceView *srvPtr = srv ? srv->get() : nullptr;
+    if (!updateShaderResourceCache(shaderType, resourceSlot, srvPtr))
+    {
+        return;
+    }
+
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+    switch (shaderType)
+    {
+        case gl::ShaderType::Vertex:
+            deviceContext->VSSetShaderResources(resourceSlot, 1, &srvPtr);
+            break;
+        case gl::ShaderType::Fragment:
+            deviceContext->PSSetShaderResources(resourceSlot, 1, &srvPtr);
+            break;
+        case gl::ShaderType::Compute:
+            deviceContext->CSSetShaderResources(resourceSlot, 1, &srvPtr);
+            break;
+        default:
+            UNREACHABLE();
+    }
+}
+
+bool StateManager11::updateShaderResourceCache(gl::ShaderType shaderType,
+                                               UINT resourceSlot,
+                                               ID3D11ShaderResourceView *srv)
 {
     auto *currentSRVs = getSRVCache(shaderType);
     ASSERT(static_cast<size_t>(resourceSlot) < currentSRVs->size());
     const ViewRecord<D3D11_SHADER_RESOURCE_VIEW_DESC> &record = (*currentSRVs)[resourceSlot];
 
-    if (record.view != reinterpret_cast<uintptr_t>(srv))
+    // The cache records the D3D view, not the ANGLE wrapper around it.
+    if (record.view == reinterpret_cast<uintptr_t>(srv))
     {
-        ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
-        ID3D11ShaderResourceView *srvPtr   = srv ? srv->get() : nullptr;
-        if (srvPtr)
+        return false;
+    }
+
+    if (srv)
+    {
+        uintptr_t resource = reinterpret_cast<uintptr_t>(GetViewResource(srv));
+        unsetConflictingUAVs(gl::PipelineType::GraphicsPipeline, gl::ShaderType::Compute,
+                             resource, nullptr);
+        if (shaderType == gl::ShaderType::Compute)
         {
-            uintptr_t resource = reinterpret_cast<uintptr_t>(GetViewResource(srvPtr));
-            unsetConflictingUAVs(gl::PipelineType::GraphicsPipeline, gl::ShaderType::Compute,
-                                 resource, nullptr);
+            unsetConflictingRTVs(resource);
         }
+    }
 
-        switch (shaderType)
+    currentSRVs->update(resourceSlot, srv);
+    return true;
+}
+
+void StateManager11::setShaderResourceDeferred(gl::ShaderType shaderType,
+                                               UINT resourceSlot,
+                                               ID3D11ShaderResourceView *srv)
+{
+    ASSERT(resourceSlot < kMaxDeferredTextureSlots);
+    if (updateShaderResourceCache(shaderType, resourceSlot, srv))
+    {
+        mDeferredTextureBindings[shaderType].dirtySRVs.set(resourceSlot);
+    }
+}
+
+void StateManager11::setSamplerDeferred(gl::ShaderType shaderType,
+                                        UINT samplerSlot,
+                                        ID3D11SamplerState *samplerState)
+{
+    ASSERT(samplerSlot < kMaxDeferredTextureSlots);
+    DeferredTextureBindings &deferred = mDeferredTextureBindings[shaderType];
+    deferred.samplers[samplerSlot]    = samplerState;
+    deferred.dirtySamplers.set(samplerSlot);
+}
+
+void StateManager11::flushDeferredTextureBindings(gl::ShaderType shaderType)
+{
+    DeferredTextureBindings &deferred = mDeferredTextureBindings[shaderType];
+    if (deferred.dirtySRVs.none() && deferred.dirtySamplers.none())
+    {
+        return;
+    }
+
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+
+    if (deferred.dirtySRVs.any())
+    {
+        const SRVCache &currentSRVs = mCurShaderSRVs[shaderType];
+        std::array<ID3D11ShaderResourceView *, kMaxDeferredTextureSlots> srvs;
+        for (size_t slot : deferred.dirtySRVs)
         {
-            case gl::ShaderType::Vertex:
-                deviceContext->VSSetShaderResources(resourceSlot, 1, &srvPtr);
-                break;
-            case gl::ShaderType::Fragment:
-                deviceContext->PSSetShaderResources(resourceSlot, 1, &srvPtr);
-                break;
-            case gl::ShaderType::Compute:
+            srvs[slot] = reinterpret_cast<ID3D11ShaderResourceView *>(currentSRVs[slot].view);
+        }
+
+        ForEachSlotRange(deferred.dirtySRVs, [&](UINT start, UINT count) {
+            switch (shaderType)
             {
-                if (srvPtr)
-                {
-                    uintptr_t resource = reinterpret_cast<uintptr_t>(GetViewResource(srvPtr));
-                    unsetConflictingRTVs(resource);
-                }
-                deviceContext->CSSetShaderResources(resourceSlot, 1, &srvPtr);
-                break;
+                case gl::ShaderType::Vertex:
+                    deviceContext->VSSetShaderResources(start, count, &srvs[start]);
+                    break;
+                case gl::ShaderType::Fragment:
+                    deviceContext->PSSetShaderResources(start, count, &srvs[start]);
+                    break;
+                case gl::ShaderType::Compute:
+                    deviceContext->CSSetShaderResources(start, count, &srvs[start]);
+                    break;
+                default:
+                    UNREACHABLE();
             }
-            default:
-                UNREACHABLE();
-        }
+        });
+        deferred.dirtySRVs.reset();
+    }
 
-        currentSRVs->update(resourceSlot, srvPtr);
+    if (deferred.dirtySamplers.any())
+    {
+        ForEachSlotRange(deferred.dirtySamplers, [&](UINT start, UINT count) {
+            ID3D11SamplerState *const *samplers = &deferred.samplers[start];
+            switch (shaderType)
+            {
+                case gl::ShaderType::Vertex:
+                    deviceContext->VSSetSamplers(start, count, samplers);
+                    break;
+                case gl::ShaderType::Fragment:
+                    deviceContext->PSSetSamplers(start, count, samplers);
+                    break;
+                case gl::ShaderType::Compute:
+                    deviceContext->CSSetSamplers(start, count, samplers);
+                    break;
+                case gl::ShaderType::Geometry:
+                    deviceContext->GSSetSamplers(start, count, samplers);
+                    break;
+                default:
+                    UNREACHABLE();
+                    break;
+            }
+        });
+        deferred.dirtySamplers.reset();
     }
 }
 
@@ -2284,6 +2410,23 @@ angle::Result StateManager11::updateState(const gl::Context *context,
         mInternalDirtyBits.set(DIRTY_BIT_BLEND_STATE);
     }
 
+    if (mRenderer->getFeatures().asyncCompileVertexExecutables.enabled)
+    {
+        // Instead of compiling a vertex shader variant for a new input layout on draw, compile it
+        // in the background and convert the attributes to float on the CPU in the meantime.
+        Context11 *context11 = GetImplAs<Context11>(context);
+        if (mExecutableD3D->resolvePendingVertexExecutables())
+        {
+            ANGLE_TRY(context11->updateProgramCache(context, glState.getProgramExecutable()));
+        }
+
+        gl::AttributesMask floatConversionAttribs;
+        ANGLE_TRY(mExecutableD3D->updateCachedInputLayoutWithAsyncCompile(
+            context, context11, mRenderer, mVertexArray11->getCurrentStateSerial(),
+            &floatConversionAttribs));
+        mVertexArray11->setFloatConversionAttribs(context, floatConversionAttribs);
+    }
+
     ANGLE_TRY(mVertexArray11->syncStateForDraw(context, firstVertex, vertexOrIndexCount,
                                                indexTypeOrInvalid, indices, instanceCount,
                                                baseVertex, baseInstance, promoteDynamic));
@@ -2697,8 +2840,6 @@ angle::Result StateManager11::setSamplerState(const gl::Context *context,
     ASSERT(storage);
 #endif  // !defined(NDEBUG)
 
-    auto *deviceContext = mRenderer->getDeviceContext();
-
     ASSERT(index < mRenderer->getNativeCaps().maxShaderTextureImageUnits[type]);
 
     // When border color is used, its value may need to be readjusted based on the texture format.
@@ -2732,25 +2873,7 @@ angle::Result StateManager11::setSamplerState(const gl::Context *context,
         ANGLE_TRY(mRenderer->getSamplerState(context, adjustedSamplerState, &dxSamplerState));
 
         ASSERT(dxSamplerState != nullptr);
-
-        switch (type)
-        {
-            case gl::ShaderType::Vertex:
-                deviceContext->VSSetSamplers(index, 1, &dxSamplerState);
-                break;
-            case gl::ShaderType::Fragment:
-                deviceContext->PSSetSamplers(index, 1, &dxSamplerState);
-                break;
-            case gl::ShaderType::Compute:
-                deviceContext->CSSetSamplers(index, 1, &dxSamplerState);
-                break;
-            case gl::ShaderType::Geometry:
-                deviceContext->GSSetSamplers(index, 1, &dxSamplerState);
-                break;
-            default:
-                UNREACHABLE();
-                break;
-        }
+        setSamplerDeferred(type, static_cast<UINT>(index), dxSamplerState);
 
         mCurShaderSamplerStates[type][index] = samplerState;
     }
@@ -2804,7 +2927,7 @@ angle::Result StateManager11::setTextureForSampler(const gl::Context *context,
         (type == gl::ShaderType::Compute &&
          index < mRenderer->getNativeCaps().maxShaderTextureImageUnits[gl::ShaderType::Compute]));
 
-    setShaderResourceInternal(type, index, textureSRV);
+    setShaderResourceDeferred(type, index, textureSRV ? textureSRV->get() : nullptr);
     return angle::Result::Continue;
 }
 
@@ -2829,6 +2952,16 @@ angle::Result StateManager11::setImageState(const gl::Context *context,
 // Sampler mapping needs to be up-to-date on the program object before this is called.
 angle::Result StateManager11::applyTexturesForSRVs(const gl::Context *context,
                                                    gl::ShaderType shaderType)
+{
+    // The SRVs and samplers are deferred by the calls below and applied together at the end,
+    // including when an error interrupts the loop, so the caches never run ahead of the device.
+    angle::Result result = setTexturesForSRVs(context, shaderType);
+    flushDeferredTextureBindings(shaderType);
+    return result;
+}
+
+angle::Result StateManager11::setTexturesForSRVs(const gl::Context *context,
+                                                 gl::ShaderType shaderType)
 {
     const auto &glState = context->getState();
     const auto &caps    = context->getCaps();
@@ -2930,8 +3063,7 @@ angle::Result StateManager11::setTextureForImage(const gl::Context *context,
     TextureD3D *textureImpl = nullptr;
     if (!imageUnit.texture.get())
     {
-        setShaderResourceInternal<d3d11::ShaderResourceView>(type, static_cast<UINT>(index),
-                                                             nullptr);
+        setShaderResourceDeferred(type, static_cast<UINT>(index), nullptr);
         return angle::Result::Continue;
     }
 
@@ -2952,7 +3084,7 @@ angle::Result StateManager11::setTextureForImage(const gl::Context *context,
     // unexpectedly missing the shader resource view.
     ASSERT(textureSRV->valid());
     ASSERT((index < mRenderer->getNativeCaps().maxImageUnits));
-    setShaderResourceInternal(type, index, textureSRV);
+    setShaderResourceDeferred(type, index, textureSRV->get());
 
     textureImpl->resetDirty();
     return angle::Result::Continue;
@@ -312,6 +312,19 @@ class StateManager11 final : angle::NonCopyable
                                    UINT resourceSlot,
                                    const SRVType *srv);
 
+    // Updates the SRV cache and returns true if the slot changed.  Conflicting UAVs and RTVs are
+    // unbound immediately, the SRV itself is left to the caller to apply.
+    bool updateShaderResourceCache(gl::ShaderType shaderType,
+                                   UINT resourceSlot,
+                                   ID3D11ShaderResourceView *srv);
+    void setShaderResourceDeferred(gl::ShaderType shaderType,
+                                   UINT resourceSlot,
+                                   ID3D11ShaderResourceView *srv);
+    void setSamplerDeferred(gl::ShaderType shaderType,
+                            UINT samplerSlot,
+                            ID3D11SamplerState *samplerState);
+    void flushDeferredTextureBindings(gl::ShaderType shaderType);
+
     struct UAVList
     {
         UAVList(size_t size) : data(size) {}
@@ -364,6 +377,7 @@ class StateManager11 final : angle::NonCopyable
 
     angle::Result syncTextures(const gl::Context *context);
     angle::Result applyTexturesForSRVs(const gl::Context *context, gl::ShaderType shaderType);
+    angle::Result setTexturesForSRVs(const gl::Context *context, gl::ShaderType shaderType);
     angle::Result applyTexturesForUAVs(const gl::Context *context, gl::ShaderType shaderType);
     angle::Result syncTexturesForCompute(const gl::Context *context);
 
@@ -623,6 +637,20 @@ class StateManager11 final : angle::NonCopyable
     gl::ShaderMap<std::vector<bool>> mForceSetShaderSamplerStates;
     gl::ShaderMap<std::vector<gl::SamplerState>> mCurShaderSamplerStates;
 
+    // SRVs and samplers changed while applying a program's textures are not set right away.
+    // They are flushed at the end of applyTexturesForSRVs (or before any other SRV of the same
+    // stage is set) with one call per run of consecutive slots, e.g. a single PSSetShaderResources
+    // for slots 0-7 instead of eight.
+    static constexpr size_t kMaxDeferredTextureSlots = D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT;
+    using DeferredTextureSlotMask                    = angle::BitSet<kMaxDeferredTextureSlots>;
+    struct DeferredTextureBindings
+    {
+        DeferredTextureSlotMask dirtySRVs;
+        DeferredTextureSlotMask dirtySamplers;
+        std::array<ID3D11SamplerState *, kMaxDeferredTextureSlots> samplers = {};
+    };
+    gl::ShaderMap<DeferredTextureBindings> mDeferredTextureBindings;
+
     // Special dirty bit for swizzles. Since they use internal shaders, must be done in a pre-pass.
     bool mDirtySwizzles;
 
@@ -0,0 +1,117 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferRing11.cpp: Defines the StreamingBufferRing11 class.
+
+#include "libANGLE/renderer/d3d/d3d11/StreamingBufferRing11.h"
+
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/d3d/d3d11/Context11.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+
+namespace rx
+{
+
+StreamingBufferRing11::StreamingBufferRing11(Renderer11 *renderer)
+    : mRenderer(renderer), mBufferSize(0)
+{}
+
+StreamingBufferRing11::~StreamingBufferRing11() {}
+
+void StreamingBufferRing11::reset(unsigned int bufferSize)
+{
+    mBufferSize = bufferSize;
+    mBusySegments.reset();
+    mPendingSegments.reset();
+    mCurrentPassSegments.reset();
+}
+
+void StreamingBufferRing11::onWrap()
+{
+    mCurrentPassSegments.reset();
+}
+
+angle::Result StreamingBufferRing11::prepareWrite(const gl::Context *context,
+                                                  unsigned int offset,
+                                                  unsigned int size,
+                                                  bool *discardOut)
+{
+    *discardOut = false;
+    if (size == 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    Context11 *context11               = GetImplAs<Context11>(context);
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+
+    // All draws reading the segments written so far have been issued; fence them.
+    for (size_t segment : mPendingSegments)
+    {
+        if (!mQueries[segment].valid())
+        {
+            D3D11_QUERY_DESC queryDesc;
+            queryDesc.Query     = D3D11_QUERY_EVENT;
+            queryDesc.MiscFlags = 0;
+            ANGLE_TRY(mRenderer->allocateResource(context11, queryDesc, &mQueries[segment]));
+        }
+        deviceContext->End(mQueries[segment].get());
+    }
+    mBusySegments |= mPendingSegments;
+    mPendingSegments.reset();
+
+    // Segments already entered in this pass only hold data written in this pass, which is never
+    // overwritten before the next wrap.
+    const SegmentMask enteredSegments = getSegments(offset, size) & ~mCurrentPassSegments;
+    for (size_t segment : enteredSegments & mBusySegments)
+    {
+        HRESULT result = deviceContext->GetData(mQueries[segment].get(), nullptr, 0,
+                                                D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        ANGLE_TRY_HR(context11, result, "Failed to get streaming buffer query data");
+
+        if (result != S_OK)
+        {
+            *discardOut = true;
+            return angle::Result::Continue;
+        }
+        mBusySegments.reset(segment);
+    }
+
+    return angle::Result::Continue;
+}
+
+void StreamingBufferRing11::onWrite(unsigned int offset, unsigned int size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    const SegmentMask segments = getSegments(offset, size);
+    mPendingSegments |= segments;
+    mCurrentPassSegments |= segments;
+}
+
+StreamingBufferRing11::SegmentMask StreamingBufferRing11::getSegments(unsigned int offset,
+                                                                      unsigned int size) const
+{
+    ASSERT(size > 0 && static_cast<uint64_t>(offset) + size <= mBufferSize);
+
+    auto segmentOf = [this](uint64_t byte) {
+        return static_cast<size_t>(byte * kSegmentCount / mBufferSize);
+    };
+    const size_t first = segmentOf(offset);
+    const size_t last  = segmentOf(static_cast<uint64_t>(offset) + size - 1);
+
+    SegmentMask segments;
+    for (size_t segment = first; segment <= last; ++segment)
+    {
+        segments.set(segment);
+    }
+    return segments;
+}
+
+}  // namespace rx
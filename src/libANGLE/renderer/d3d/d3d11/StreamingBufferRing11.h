@@ -0,0 +1,76 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferRing11.h: Tracks which segments of a streaming D3D11 buffer may still be read by
+// the GPU, so the buffer can wrap around with D3D11_MAP_WRITE_NO_OVERWRITE.
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_STREAMINGBUFFERRING11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_STREAMINGBUFFERRING11_H_
+
+#include <array>
+
+#include "common/bitset_utils.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+class Renderer11;
+
+// The buffer is split in a few segments.  Each segment has an event query that is ended after the
+// last draw that may read it has been issued.  When the write position enters a segment, the
+// data of the previous pass over the buffer may only be overwritten once that query completes;
+// otherwise the buffer has to be renamed with D3D11_MAP_WRITE_DISCARD like before.
+class StreamingBufferRing11 final : angle::NonCopyable
+{
+  public:
+    static constexpr unsigned int kSegmentCount = 4;
+
+    explicit StreamingBufferRing11(Renderer11 *renderer);
+    ~StreamingBufferRing11();
+
+    // The buffer was created or discarded: nothing in it is in use by the GPU.
+    void reset(unsigned int bufferSize);
+
+    // The write position restarted from the beginning of the buffer.
+    void onWrap();
+
+    // Must be called before writing [offset, offset + size), after every draw that reads the data
+    // of earlier writes has been issued.  Sets |*discardOut| if part of the range may still be in
+    // use, in which case the caller must discard the buffer and call reset().
+    angle::Result prepareWrite(const gl::Context *context,
+                               unsigned int offset,
+                               unsigned int size,
+                               bool *discardOut);
+
+    // Records that [offset, offset + size) was written.
+    void onWrite(unsigned int offset, unsigned int size);
+
+  private:
+    using SegmentMask = angle::BitSet8<kSegmentCount>;
+
+    SegmentMask getSegments(unsigned int offset, unsigned int size) const;
+
+    Renderer11 *const mRenderer;
+    unsigned int mBufferSize;
+
+    std::array<d3d11::Query, kSegmentCount> mQueries;
+    // Segments whose query was ended and not yet seen as complete.
+    SegmentMask mBusySegments;
+    // Segments written since their query was last ended.
+    SegmentMask mPendingSegments;
+    // Segments entered since the write position last wrapped.
+    SegmentMask mCurrentPassSegments;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_STREAMINGBUFFERRING11_H_
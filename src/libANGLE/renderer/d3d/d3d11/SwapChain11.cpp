@@ -10,6 +10,9 @@
 
 #include <EGL/eglext.h>
 
+#include <algorithm>
+#include <thread>
+
 #include "libANGLE/features.h"
 #include "libANGLE/renderer/d3d/DisplayD3D.h"
 #include "libANGLE/renderer/d3d/d3d11/NativeWindow11.h"
@@ -42,6 +45,9 @@ namespace
 static constexpr int64_t kQPCOverflowThreshold  = 0x8637BD05AF7;
 static constexpr int64_t kMicrosecondsPerSecond = 1000000;
 
+// Matches the largest value IDXGIDevice1::SetMaximumFrameLatency accepts.
+static constexpr EGLint kMaxFrameLatency = 16;
+
 bool NeedsOffscreenTexture(Renderer11 *renderer, NativeWindow11 *nativeWindow, EGLint orientation)
 {
     // We don't need an offscreen texture if either orientation = INVERT_Y,
@@ -58,7 +64,8 @@ SwapChain11::SwapChain11(Renderer11 *renderer,
                          GLenum backBufferFormat,
                          GLenum depthBufferFormat,
                          EGLint orientation,
-                         EGLint samples)
+                         EGLint samples,
+                         EGLint maxFrameLatency)
     : SwapChainD3D(shareHandle, d3dTexture, backBufferFormat, depthBufferFormat),
       mRenderer(renderer),
       mWidth(-1),
@@ -92,7 +99,9 @@ SwapChain11::SwapChain11(Renderer11 *renderer,
       mPassThroughRS(),
       mColorRenderTarget(this, renderer, false),
       mDepthStencilRenderTarget(this, renderer, true),
-      mEGLSamples(samples)
+      mEGLSamples(samples),
+      mFrameLatencyQueries(std::min<EGLint>(maxFrameLatency, kMaxFrameLatency)),
+      mFrameLatencyQueryIndex(0)
 {
     // Check that if present path fast is active then we're using the default orientation
     ASSERT(!mRenderer->presentPathFastEnabled() || orientation == 0);
@@ -133,6 +142,12 @@ void SwapChain11::release()
     mPassThroughOrResolvePS.reset();
     mPassThroughRS.reset();
 
+    for (d3d11::Query &query : mFrameLatencyQueries)
+    {
+        query.reset();
+    }
+    mFrameLatencyQueryIndex = 0;
+
     if (!mAppCreatedShareHandle)
     {
         mShareHandle = nullptr;
@@ -806,6 +821,11 @@ EGLint SwapChain11::swapRect(DisplayD3D *displayD3D,
         return result;
     }
 
+    if (!mFrameLatencyQueries.empty() && waitForFrameLatency(displayD3D) == angle::Result::Stop)
+    {
+        return EGL_BAD_ALLOC;
+    }
+
     mRenderer->onSwap();
 
     return EGL_SUCCESS;
@@ -963,6 +983,51 @@ EGLint SwapChain11::present(DisplayD3D *displayD3D, EGLint x, EGLint y, EGLint w
     return EGL_SUCCESS;
 }
 
+angle::Result SwapChain11::waitForFrameLatency(DisplayD3D *displayD3D)
+{
+    ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
+
+    d3d11::Query &presentQuery = mFrameLatencyQueries[mFrameLatencyQueryIndex];
+    if (!presentQuery.valid())
+    {
+        D3D11_QUERY_DESC queryDesc;
+        queryDesc.Query     = D3D11_QUERY_EVENT;
+        queryDesc.MiscFlags = 0;
+        ANGLE_TRY(mRenderer->allocateResource(displayD3D, queryDesc, &presentQuery));
+    }
+    deviceContext->End(presentQuery.get());
+
+    // The next query in the ring was ended mFrameLatencyQueries.size() presents ago, or is this
+    // frame's query if the latency is 1.
+    mFrameLatencyQueryIndex = (mFrameLatencyQueryIndex + 1) % mFrameLatencyQueries.size();
+    const d3d11::Query &oldestQuery = mFrameLatencyQueries[mFrameLatencyQueryIndex];
+    if (!oldestQuery.valid())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "SwapChain11::waitForFrameLatency");
+
+    // Not passing D3D11_ASYNC_GETDATA_DONOTFLUSH makes sure the query is actually submitted.
+    HRESULT result = S_FALSE;
+    int loopCount  = 0;
+    while ((result = deviceContext->GetData(oldestQuery.get(), nullptr, 0, 0)) == S_FALSE)
+    {
+        loopCount++;
+        bool checkDeviceLost = (loopCount % kPollingD3DDeviceLostCheckFrequency) == 0;
+        if (checkDeviceLost && mRenderer->testDeviceLost())
+        {
+            result = DXGI_ERROR_DEVICE_REMOVED;
+            break;
+        }
+
+        std::this_thread::yield();
+    }
+    ANGLE_TRY_HR(displayD3D, result, "Failed to wait for a previous present to complete");
+
+    return angle::Result::Continue;
+}
+
 const TextureHelper11 &SwapChain11::getOffscreenTexture()
 {
     return mNeedsOffscreenTexture ? mOffscreenTexture : mBackBufferTexture;
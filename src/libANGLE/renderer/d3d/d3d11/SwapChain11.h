@@ -9,6 +9,8 @@
 #ifndef LIBANGLE_RENDERER_D3D_D3D11_SWAPCHAIN11_H_
 #define LIBANGLE_RENDERER_D3D_D3D11_SWAPCHAIN11_H_
 
+#include <vector>
+
 #include "common/angleutils.h"
 #include "libANGLE/renderer/d3d/SwapChainD3D.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderTarget11.h"
@@ -28,7 +30,8 @@ class SwapChain11 final : public SwapChainD3D
                 GLenum backBufferFormat,
                 GLenum depthBufferFormat,
                 EGLint orientation,
-                EGLint samples);
+                EGLint samples,
+                EGLint maxFrameLatency);
     ~SwapChain11() override;
 
     EGLint resize(DisplayD3D *displayD3D, EGLint backbufferWidth, EGLint backbufferHeight) override;
@@ -84,6 +87,7 @@ class SwapChain11 final : public SwapChainD3D
                                      EGLint width,
                                      EGLint height);
     EGLint present(DisplayD3D *displayD3D, EGLint x, EGLint y, EGLint width, EGLint height);
+    angle::Result waitForFrameLatency(DisplayD3D *displayD3D);
     UINT getD3DSamples() const;
 
     Renderer11 *mRenderer;
@@ -127,6 +131,13 @@ class SwapChain11 final : public SwapChainD3D
     SurfaceRenderTarget11 mDepthStencilRenderTarget;
 
     EGLint mEGLSamples;
+
+    // With EGL_MAX_FRAME_LATENCY_ANGLE, an event query is ended after each present and swap waits
+    // for the one ended that many presents ago, so the app never gets further ahead of the GPU.
+    // DXGI's own frame latency is a device-wide setting, which doesn't work with surfaces sharing
+    // the device.  Empty if the attribute wasn't given.
+    std::vector<d3d11::Query> mFrameLatencyQueries;
+    size_t mFrameLatencyQueryIndex;
     LONGLONG mQPCFrequency;
 };
 
@@ -232,6 +232,10 @@ void VertexArray11::updateVertexAttribStorage(const gl::Context *context,
     const gl::VertexBinding &binding  = mState.getBindingFromAttribIndex(attribIndex);
 
     VertexStorageType newStorageType = ClassifyAttributeStorage(context, attrib, binding);
+    if (mFloatConversionAttribs[attribIndex] && newStorageType != VertexStorageType::CURRENT_VALUE)
+    {
+        newStorageType = VertexStorageType::DYNAMIC;
+    }
 
     // Note: having an unchanged storage type doesn't mean the attribute is clean.
     mAttribsToTranslate.set(attribIndex, newStorageType != VertexStorageType::DYNAMIC);
@@ -274,6 +278,7 @@ angle::Result VertexArray11::updateDirtyAttribs(const gl::Context *context,
         translatedAttrib->currentValueType = currentValue.Type;
         translatedAttrib->divisor =
             translatedAttrib->binding->getDivisor() * mAppliedNumViewsToDivisor;
+        translatedAttrib->forceFloatConversion = false;
 
         switch (mAttributeStorageTypes[dirtyAttribIndex])
         {
@@ -331,6 +336,7 @@ angle::Result VertexArray11::updateDynamicAttribs(const gl::Context *context,
         dynamicAttrib->binding          = &bindings[dynamicAttrib->attribute->bindingIndex];
         dynamicAttrib->currentValueType = currentValue.Type;
         dynamicAttrib->divisor = dynamicAttrib->binding->getDivisor() * mAppliedNumViewsToDivisor;
+        dynamicAttrib->forceFloatConversion = mFloatConversionAttribs[dynamicAttribIndex];
     }
 
     ANGLE_TRY(vertexDataManager->storeDynamicAttribs(context, &mTranslatedAttribs,
@@ -384,4 +390,26 @@ gl::DrawElementsType VertexArray11::getCachedDestinationIndexType() const
     return mCachedDestinationIndexType;
 }
 
+void VertexArray11::setFloatConversionAttribs(const gl::Context *context,
+                                              const gl::AttributesMask &floatConversionAttribs)
+{
+    gl::AttributesMask changedAttribs = mFloatConversionAttribs ^ floatConversionAttribs;
+    if (changedAttribs.none())
+    {
+        return;
+    }
+
+    mFloatConversionAttribs = floatConversionAttribs;
+
+    StateManager11 *stateManager = GetImplAs<Context11>(context)->getRenderer()->getStateManager();
+    for (size_t attribIndex : changedAttribs)
+    {
+        updateVertexAttribStorage(context, stateManager, attribIndex);
+    }
+
+    stateManager->invalidateShaders();
+    stateManager->invalidateVertexBuffer();
+    stateManager->invalidateInputLayout();
+}
+
 }  // namespace rx
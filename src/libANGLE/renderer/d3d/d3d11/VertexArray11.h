@@ -60,6 +60,12 @@ class VertexArray11 : public VertexArrayImpl
 
     gl::DrawElementsType getCachedDestinationIndexType() const;
 
+    // Attributes in this mask are streamed and converted to float on the CPU, for use with a
+    // vertex shader variant that expects float inputs.
+    void setFloatConversionAttribs(const gl::Context *context,
+                                   const gl::AttributesMask &floatConversionAttribs);
+    const gl::AttributesMask &getFloatConversionAttribs() const { return mFloatConversionAttribs; }
+
   private:
     void updateVertexAttribStorage(const gl::Context *context,
                                    StateManager11 *stateManager,
@@ -93,6 +99,9 @@ class VertexArray11 : public VertexArrayImpl
     // A set of attributes we know are dirty, and need to be re-translated.
     gl::AttributesMask mAttribsToTranslate;
 
+    // The mask of attributes forced to dynamic storage for CPU float conversion.
+    gl::AttributesMask mFloatConversionAttribs;
+
     UniqueSerial mCurrentStateSerial;
 
     // The numViews value used to adjust the divisor.
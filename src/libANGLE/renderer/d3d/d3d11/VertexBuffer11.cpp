@@ -26,7 +26,8 @@ VertexBuffer11::VertexBuffer11(Renderer11 *const renderer)
       mBuffer(),
       mBufferSize(0),
       mDynamicUsage(false),
-      mMappedResourceData(nullptr)
+      mMappedResourceData(nullptr),
+      mRing(renderer)
 {}
 
 VertexBuffer11::~VertexBuffer11()
@@ -65,6 +66,7 @@ angle::Result VertexBuffer11::initialize(const gl::Context *context,
 
     mBufferSize   = size;
     mDynamicUsage = dynamicUsage;
+    mRing.reset(size);
 
     return angle::Result::Continue;
 }
@@ -99,6 +101,7 @@ angle::Result VertexBuffer11::storeVertexAttributes(const gl::Context *context,
                                                     const gl::VertexAttribute &attrib,
                                                     const gl::VertexBinding &binding,
                                                     gl::VertexAttribType currentValueType,
+                                                    bool forceFloatConversion,
                                                     GLint start,
                                                     size_t count,
                                                     GLsizei instances,
@@ -124,10 +127,15 @@ angle::Result VertexBuffer11::storeVertexAttributes(const gl::Context *context,
     angle::FormatID vertexFormatID       = gl::GetVertexFormatID(attrib, currentValueType);
     const D3D_FEATURE_LEVEL featureLevel = mRenderer->getRenderer11DeviceCaps().featureLevel;
     const d3d11::VertexFormat &vertexFormatInfo =
-        d3d11::GetVertexFormatInfo(vertexFormatID, featureLevel);
+        forceFloatConversion ? d3d11::GetFloatConversionVertexFormatInfo(vertexFormatID)
+                             : d3d11::GetVertexFormatInfo(vertexFormatID, featureLevel);
     ASSERT(vertexFormatInfo.copyFunction != nullptr);
     vertexFormatInfo.copyFunction(input, inputStride, count, output);
 
+    const d3d11::DXGIFormatSize &dxgiFormatInfo =
+        d3d11::GetDXGIFormatSizeInfo(vertexFormatInfo.nativeFormat);
+    mRing.onWrite(offset, static_cast<unsigned int>(dxgiFormatInfo.pixelBytes * count));
+
     return angle::Result::Continue;
 }
 
@@ -155,10 +163,41 @@ angle::Result VertexBuffer11::discard(const gl::Context *context)
                                      &mappedResource));
 
     mRenderer->getDeviceContext()->Unmap(mBuffer.get(), 0);
+    mRing.reset(mBufferSize);
+
+    return angle::Result::Continue;
+}
+
+angle::Result VertexBuffer11::reserveStreamingRange(const gl::Context *context,
+                                                    unsigned int offset,
+                                                    unsigned int size,
+                                                    bool wrapped)
+{
+    if (!useStreamingRing())
+    {
+        return VertexBuffer::reserveStreamingRange(context, offset, size, wrapped);
+    }
+
+    if (wrapped)
+    {
+        mRing.onWrap();
+    }
+
+    bool discardBuffer = false;
+    ANGLE_TRY(mRing.prepareWrite(context, offset, size, &discardBuffer));
+    if (discardBuffer)
+    {
+        ANGLE_TRY(discard(context));
+    }
 
     return angle::Result::Continue;
 }
 
+bool VertexBuffer11::useStreamingRing() const
+{
+    return mDynamicUsage && mRenderer->getFeatures().wrapStreamingBuffersWithoutDiscard.enabled;
+}
+
 const d3d11::Buffer &VertexBuffer11::getBuffer() const
 {
     return mBuffer;
@@ -13,6 +13,7 @@
 
 #include "libANGLE/renderer/d3d/VertexBuffer.h"
 #include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+#include "libANGLE/renderer/d3d/d3d11/StreamingBufferRing11.h"
 
 namespace rx
 {
@@ -33,6 +34,7 @@ class VertexBuffer11 : public VertexBuffer
                                         const gl::VertexAttribute &attrib,
                                         const gl::VertexBinding &binding,
                                         gl::VertexAttribType currentValueType,
+                                        bool forceFloatConversion,
                                         GLint start,
                                         size_t count,
                                         GLsizei instances,
@@ -42,6 +44,10 @@ class VertexBuffer11 : public VertexBuffer
     unsigned int getBufferSize() const override;
     angle::Result setBufferSize(const gl::Context *context, unsigned int size) override;
     angle::Result discard(const gl::Context *context) override;
+    angle::Result reserveStreamingRange(const gl::Context *context,
+                                        unsigned int offset,
+                                        unsigned int size,
+                                        bool wrapped) override;
 
     void hintUnmapResource() override;
 
@@ -50,6 +56,7 @@ class VertexBuffer11 : public VertexBuffer
   private:
     ~VertexBuffer11() override;
     angle::Result mapResource(const gl::Context *context);
+    bool useStreamingRing() const;
 
     Renderer11 *const mRenderer;
 
@@ -58,6 +65,8 @@ class VertexBuffer11 : public VertexBuffer
     bool mDynamicUsage;
 
     uint8_t *mMappedResourceData;
+
+    StreamingBufferRing11 mRing;
 };
 
 }  // namespace rx
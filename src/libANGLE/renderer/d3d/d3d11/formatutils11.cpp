@@ -1088,6 +1088,168 @@ const VertexFormat &GetVertexFormatInfo(angle::FormatID vertexFormatID,
     }
 }
 
+const VertexFormat &GetFloatConversionVertexFormatInfo(angle::FormatID vertexFormatID)
+{
+    switch (vertexFormatID)
+    {
+        case angle::FormatID::R8_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32_FLOAT,
+                                               &CopyToFloatVertexData<GLbyte, 1, 1, false, false>);
+            return info;
+        }
+        case angle::FormatID::R8G8_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32_FLOAT,
+                                               &CopyToFloatVertexData<GLbyte, 2, 2, false, false>);
+            return info;
+        }
+        case angle::FormatID::R8G8B8_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32_FLOAT,
+                                               &CopyToFloatVertexData<GLbyte, 3, 3, false, false>);
+            return info;
+        }
+        case angle::FormatID::R8G8B8A8_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32A32_FLOAT,
+                                               &CopyToFloatVertexData<GLbyte, 4, 4, false, false>);
+            return info;
+        }
+        case angle::FormatID::R8_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32_FLOAT,
+                                               &CopyToFloatVertexData<GLubyte, 1, 1, false, false>);
+            return info;
+        }
+        case angle::FormatID::R8G8_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32_FLOAT,
+                                               &CopyToFloatVertexData<GLubyte, 2, 2, false, false>);
+            return info;
+        }
+        case angle::FormatID::R8G8B8_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32_FLOAT,
+                                               &CopyToFloatVertexData<GLubyte, 3, 3, false, false>);
+            return info;
+        }
+        case angle::FormatID::R8G8B8A8_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32A32_FLOAT,
+                                               &CopyToFloatVertexData<GLubyte, 4, 4, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32_FLOAT,
+                                               &CopyToFloatVertexData<GLshort, 1, 1, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16G16_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32_FLOAT,
+                                               &CopyToFloatVertexData<GLshort, 2, 2, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16G16B16_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32_FLOAT,
+                                               &CopyToFloatVertexData<GLshort, 3, 3, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16G16B16A16_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32A32_FLOAT,
+                                               &CopyToFloatVertexData<GLshort, 4, 4, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16_USCALED:
+        {
+            static constexpr VertexFormat info(
+                VERTEX_CONVERT_CPU, DXGI_FORMAT_R32_FLOAT,
+                &CopyToFloatVertexData<GLushort, 1, 1, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16G16_USCALED:
+        {
+            static constexpr VertexFormat info(
+                VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32_FLOAT,
+                &CopyToFloatVertexData<GLushort, 2, 2, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16G16B16_USCALED:
+        {
+            static constexpr VertexFormat info(
+                VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32_FLOAT,
+                &CopyToFloatVertexData<GLushort, 3, 3, false, false>);
+            return info;
+        }
+        case angle::FormatID::R16G16B16A16_USCALED:
+        {
+            static constexpr VertexFormat info(
+                VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32A32_FLOAT,
+                &CopyToFloatVertexData<GLushort, 4, 4, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32_FLOAT,
+                                               &CopyToFloatVertexData<GLint, 1, 1, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32G32_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32_FLOAT,
+                                               &CopyToFloatVertexData<GLint, 2, 2, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32G32B32_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32_FLOAT,
+                                               &CopyToFloatVertexData<GLint, 3, 3, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32G32B32A32_SSCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32A32_FLOAT,
+                                               &CopyToFloatVertexData<GLint, 4, 4, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32_FLOAT,
+                                               &CopyToFloatVertexData<GLuint, 1, 1, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32G32_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32_FLOAT,
+                                               &CopyToFloatVertexData<GLuint, 2, 2, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32G32B32_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32_FLOAT,
+                                               &CopyToFloatVertexData<GLuint, 3, 3, false, false>);
+            return info;
+        }
+        case angle::FormatID::R32G32B32A32_USCALED:
+        {
+            static constexpr VertexFormat info(VERTEX_CONVERT_CPU, DXGI_FORMAT_R32G32B32A32_FLOAT,
+                                               &CopyToFloatVertexData<GLuint, 4, 4, false, false>);
+            return info;
+        }
+
+        default:
+        {
+            UNREACHABLE();
+            static constexpr VertexFormat info;
+            return info;
+        }
+    }
+}
+
 }  // namespace d3d11
 
 }  // namespace rx
@@ -63,6 +63,10 @@ struct VertexFormat : private angle::NonCopyable
 
 const VertexFormat &GetVertexFormatInfo(angle::FormatID vertexFormatID,
                                         D3D_FEATURE_LEVEL featureLevel);
+
+// Returns a format that converts the GPU-converted integer vertex formats to float on the CPU
+// instead, for use with a vertex shader that expects float inputs.
+const VertexFormat &GetFloatConversionVertexFormatInfo(angle::FormatID vertexFormatID);
 }  // namespace d3d11
 
 }  // namespace rx
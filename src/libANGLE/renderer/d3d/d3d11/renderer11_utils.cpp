@@ -2597,6 +2597,26 @@ void InitializeFeatures(const Renderer11DeviceCaps &deviceCaps,
     // additional
     // pre-validation of the shader at compile time to produce a better error message.
     ANGLE_FEATURE_CONDITION(features, supportsNonConstantLoopIndexing, !isFeatureLevel9_3);
+
+    // Trades draw-time shader compilation hitches for CPU vertex conversion; disabled until the
+    // tradeoff is evaluated on real content.
+    ANGLE_FEATURE_CONDITION(features, asyncCompileVertexExecutables, false);
+
+    // Whether avoiding buffer renames outweighs the cost of the event queries depends on the
+    // driver; disabled until measured.
+    ANGLE_FEATURE_CONDITION(features, wrapStreamingBuffersWithoutDiscard, false);
+
+    // Creating every recorded layout up front moves the cost to the first draw of the program,
+    // which only pays off for applications that reuse many vertex formats per program.
+    ANGLE_FEATURE_CONDITION(features, prewarmInputLayouts, false);
+
+    // Recycled staging textures save an allocation per texture redefinition at the cost of up to
+    // 64MB of idle staging memory.
+    ANGLE_FEATURE_CONDITION(features, poolUploadStagingTextures, false);
+
+    // The conversion shaders are compiled on first use, which is only worth it for applications
+    // that stream many such uploads through pixel unpack buffers.
+    ANGLE_FEATURE_CONDITION(features, convertUnpackBufferOnGPU, false);
 }
 
 void InitializeFrontendFeatures(const DXGI_ADAPTER_DESC &adapterDesc,
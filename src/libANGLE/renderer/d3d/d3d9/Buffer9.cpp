@@ -87,7 +87,7 @@ angle::Result Buffer9::setSubData(const gl::Context *context,
         memcpy(mMemory.data() + offset, data, size);
     }
 
-    invalidateStaticData(context);
+    invalidateStaticDataRange(context, offset, size);
 
     return angle::Result::Continue;
 }
@@ -104,7 +104,7 @@ angle::Result Buffer9::copySubData(const gl::Context *context,
 
     memcpy(mMemory.data() + destOffset, sourceBuffer->mMemory.data() + sourceOffset, size);
 
-    invalidateStaticData(context);
+    invalidateStaticDataRange(context, destOffset, size);
 
     return angle::Result::Continue;
 }
@@ -722,7 +722,8 @@ SwapChainD3D *Renderer9::createSwapChain(NativeWindowD3D *nativeWindow,
                                          GLenum backBufferFormat,
                                          GLenum depthBufferFormat,
                                          EGLint orientation,
-                                         EGLint samples)
+                                         EGLint samples,
+                                         EGLint maxFrameLatency)
 {
     return new SwapChain9(this, GetAs<NativeWindow9>(nativeWindow), shareHandle, d3dTexture,
                           backBufferFormat, depthBufferFormat, orientation);
@@ -956,7 +957,7 @@ StreamProducerImpl *Renderer9::createStreamProducerD3DTexture(
     return nullptr;
 }
 
-bool Renderer9::supportsFastCopyBufferToTexture(GLenum internalFormat) const
+bool Renderer9::supportsFastCopyBufferToTexture(GLenum internalFormat, GLenum type) const
 {
     // Pixel buffer objects are not supported in D3D9, since D3D9 is ES2-only and PBOs are ES3.
     return false;
@@ -3058,8 +3059,12 @@ angle::Result Renderer9::getVertexSpaceRequired(const gl::Context *context,
                                                 size_t count,
                                                 GLsizei instances,
                                                 GLuint baseInstance,
+                                                bool forceFloatConversion,
                                                 unsigned int *bytesRequiredOut) const
 {
+    // D3D9 always converts on the CPU when needed.
+    ASSERT(!forceFloatConversion);
+
     if (!attrib.enabled)
     {
         *bytesRequiredOut = 16u;
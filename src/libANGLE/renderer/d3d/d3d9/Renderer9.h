@@ -74,7 +74,8 @@ class Renderer9 : public RendererD3D
                                   GLenum backBufferFormat,
                                   GLenum depthBufferFormat,
                                   EGLint orientation,
-                                  EGLint samples) override;
+                                  EGLint samples,
+                                  EGLint maxFrameLatency) override;
     egl::Error getD3DTextureInfo(const egl::Config *configuration,
                                  IUnknown *d3dTexture,
                                  const egl::AttributeMap &attribs,
@@ -343,7 +344,7 @@ class Renderer9 : public RendererD3D
                                                        const egl::AttributeMap &attribs) override;
 
     // Buffer-to-texture and Texture-to-buffer copies
-    bool supportsFastCopyBufferToTexture(GLenum internalFormat) const override;
+    bool supportsFastCopyBufferToTexture(GLenum internalFormat, GLenum type) const override;
     angle::Result fastCopyBufferToTexture(const gl::Context *context,
                                           const gl::PixelUnpackState &unpack,
                                           gl::Buffer *unpackBuffer,
@@ -370,6 +371,7 @@ class Renderer9 : public RendererD3D
                                          size_t count,
                                          GLsizei instances,
                                          GLuint baseInstance,
+                                         bool forceFloatConversion,
                                          unsigned int *bytesRequiredOut) const override;
 
     angle::Result copyToRenderTarget(const gl::Context *context,
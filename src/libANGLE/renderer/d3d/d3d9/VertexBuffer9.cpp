@@ -61,6 +61,7 @@ angle::Result VertexBuffer9::storeVertexAttributes(const gl::Context *context,
                                                    const gl::VertexAttribute &attrib,
                                                    const gl::VertexBinding &binding,
                                                    gl::VertexAttribType currentValueType,
+                                                   bool forceFloatConversion,
                                                    GLint start,
                                                    size_t count,
                                                    GLsizei instances,
@@ -68,6 +69,7 @@ angle::Result VertexBuffer9::storeVertexAttributes(const gl::Context *context,
                                                    const uint8_t *sourceData)
 {
     ASSERT(mVertexBuffer);
+    ASSERT(!forceFloatConversion);
 
     size_t inputStride = gl::ComputeVertexAttributeStride(attrib, binding);
     size_t elementSize = gl::ComputeVertexAttributeTypeSize(attrib);
@@ -77,8 +79,8 @@ angle::Result VertexBuffer9::storeVertexAttributes(const gl::Context *context,
     uint8_t *mapPtr = nullptr;
 
     unsigned int mapSize = 0;
-    ANGLE_TRY(
-        mRenderer->getVertexSpaceRequired(context, attrib, binding, count, instances, 0, &mapSize));
+    ANGLE_TRY(mRenderer->getVertexSpaceRequired(context, attrib, binding, count, instances, 0,
+                                                false, &mapSize));
 
     HRESULT result =
         mVertexBuffer->Lock(offset, mapSize, reinterpret_cast<void **>(&mapPtr), lockFlags);
@@ -30,6 +30,7 @@ class VertexBuffer9 : public VertexBuffer
                                         const gl::VertexAttribute &attrib,
                                         const gl::VertexBinding &binding,
                                         gl::VertexAttribType currentValueType,
+                                        bool forceFloatConversion,
                                         GLint start,
                                         size_t count,
                                         GLsizei instances,
@@ -68,6 +68,19 @@ namespace angle
 static constexpr rx::FastCopyFunctionMap::Entry BGRAEntry = {{angle::FormatID::R8G8B8A8_UNORM,
                                                              CopyBGRA8ToRGBA8}};
 static constexpr rx::FastCopyFunctionMap BGRACopyFunctions = {{&BGRAEntry, 1}};
+
+static constexpr rx::FastCopyFunctionMap::Entry RGBAEntry = {{angle::FormatID::B8G8R8A8_UNORM,
+                                                             CopyRGBA8ToBGRA8}};
+static constexpr rx::FastCopyFunctionMap RGBACopyFunctions = {{&RGBAEntry, 1}};
+
+static constexpr rx::FastCopyFunctionMap::Entry RGBA16FEntry = {{
+    angle::FormatID::R32G32B32A32_FLOAT, CopyRGBA16FToRGBA32F}};
+static constexpr rx::FastCopyFunctionMap RGBA16FCopyFunctions = {{&RGBA16FEntry, 1}};
+
+static constexpr rx::FastCopyFunctionMap::Entry RGBA32FEntry = {{
+    angle::FormatID::R16G16B16A16_FLOAT, CopyRGBA32FToRGBA16F}};
+static constexpr rx::FastCopyFunctionMap RGBA32FCopyFunctions = {{&RGBA32FEntry, 1}};
+
 static constexpr rx::FastCopyFunctionMap NoCopyFunctions;
 
 const Format gFormatInfoTable[] = {{
@@ -396,8 +409,14 @@ def json_to_table_data(format_id, json, angle_to_gl):
 
     parsed["namedComponentType"] = get_named_component_type(parsed["componentType"])
 
-    if format_id == "B8G8R8A8_UNORM":
-        parsed["fastCopyFunctions"] = "BGRACopyFunctions"
+    fast_copy_functions = {
+        "B8G8R8A8_UNORM": "BGRACopyFunctions",
+        "R8G8B8A8_UNORM": "RGBACopyFunctions",
+        "R16G16B16A16_FLOAT": "RGBA16FCopyFunctions",
+        "R32G32B32A32_FLOAT": "RGBA32FCopyFunctions",
+    }
+    if format_id in fast_copy_functions:
+        parsed["fastCopyFunctions"] = fast_copy_functions[format_id]
 
     is_block = format_id.endswith("_BLOCK")
 
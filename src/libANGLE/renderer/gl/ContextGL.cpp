@@ -297,6 +297,7 @@ ANGLE_INLINE angle::Result ContextGL::setDrawElementsState(const gl::Context *co
                                                            gl::DrawElementsType type,
                                                            const void *indices,
                                                            GLsizei instanceCount,
+                                                           const gl::IndexRange *indexRangeHint,
                                                            const void **outIndices)
 {
     const gl::State &glState                = context->getState();
@@ -318,7 +319,8 @@ ANGLE_INLINE angle::Result ContextGL::setDrawElementsState(const gl::Context *co
         const VertexArrayGL *vaoGL = GetImplAs<VertexArrayGL>(vao);
         ANGLE_TRY(vaoGL->syncDrawElementsState(context, executable->getActiveAttribLocationsMask(),
                                                count, type, indices, instanceCount,
-                                               glState.isPrimitiveRestartEnabled(), outIndices));
+                                               glState.isPrimitiveRestartEnabled(), indexRangeHint,
+                                               outIndices));
     }
     else
     {
@@ -519,7 +521,8 @@ angle::Result ContextGL::drawElements(const gl::Context *context,
     validateState();
 #endif  // ANGLE_STATE_VALIDATION_ENABLED
 
-    ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, &drawIndexPtr));
+    ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, nullptr,
+                                   &drawIndexPtr));
     if (!executable->usesMultiview())
     {
         ANGLE_GL_TRY(context, getFunctions()->drawElements(ToGLenum(mode), count, ToGLenum(type),
@@ -552,7 +555,8 @@ angle::Result ContextGL::drawElementsBaseVertex(const gl::Context *context,
     validateState();
 #endif  // ANGLE_STATE_VALIDATION_ENABLED
 
-    ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, &drawIndexPtr));
+    ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, nullptr,
+                                   &drawIndexPtr));
     if (!executable->usesMultiview())
     {
         ANGLE_GL_TRY(context, getFunctions()->drawElementsBaseVertex(
@@ -582,7 +586,7 @@ angle::Result ContextGL::drawElementsInstanced(const gl::Context *context,
     const void *drawIndexPointer = nullptr;
 
     ANGLE_TRY(setDrawElementsState(context, count, type, indices, adjustedInstanceCount,
-                                   &drawIndexPointer));
+                                   nullptr, &drawIndexPointer));
     ANGLE_GL_TRY(context,
                  getFunctions()->drawElementsInstanced(ToGLenum(mode), count, ToGLenum(type),
                                                        drawIndexPointer, adjustedInstanceCount));
@@ -603,7 +607,7 @@ angle::Result ContextGL::drawElementsInstancedBaseVertex(const gl::Context *cont
     const void *drawIndexPointer = nullptr;
 
     ANGLE_TRY(setDrawElementsState(context, count, type, indices, adjustedInstanceCount,
-                                   &drawIndexPointer));
+                                   nullptr, &drawIndexPointer));
     ANGLE_GL_TRY(context, getFunctions()->drawElementsInstancedBaseVertex(
                               ToGLenum(mode), count, ToGLenum(type), drawIndexPointer,
                               adjustedInstanceCount, baseVertex));
@@ -627,7 +631,7 @@ angle::Result ContextGL::drawElementsInstancedBaseVertexBaseInstance(const gl::C
     const void *drawIndexPointer = nullptr;
 
     ANGLE_TRY(setDrawElementsState(context, count, type, indices, adjustedInstanceCount,
-                                   &drawIndexPointer));
+                                   nullptr, &drawIndexPointer));
 
     const FunctionsGL *functions = getFunctions();
 
@@ -668,8 +672,10 @@ angle::Result ContextGL::drawRangeElements(const gl::Context *context,
     const GLsizei instanceCount             = GetDrawAdjustedInstanceCount(executable);
     const void *drawIndexPointer            = nullptr;
 
-    ANGLE_TRY(
-        setDrawElementsState(context, count, type, indices, instanceCount, &drawIndexPointer));
+    // The application guarantees the indices are in [start, end].
+    const gl::IndexRange indexRange(start, end, count);
+    ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, &indexRange,
+                                   &drawIndexPointer));
     if (!executable->usesMultiview())
     {
         ANGLE_GL_TRY(context, getFunctions()->drawRangeElements(ToGLenum(mode), start, end, count,
@@ -699,8 +705,10 @@ angle::Result ContextGL::drawRangeElementsBaseVertex(const gl::Context *context,
     const GLsizei instanceCount             = GetDrawAdjustedInstanceCount(executable);
     const void *drawIndexPointer            = nullptr;
 
-    ANGLE_TRY(
-        setDrawElementsState(context, count, type, indices, instanceCount, &drawIndexPointer));
+    // The application guarantees the indices are in [start, end].
+    const gl::IndexRange indexRange(start, end, count);
+    ANGLE_TRY(setDrawElementsState(context, count, type, indices, instanceCount, &indexRange,
+                                   &drawIndexPointer));
     if (!executable->usesMultiview())
     {
         ANGLE_GL_TRY(context, getFunctions()->drawRangeElementsBaseVertex(
@@ -738,6 +746,32 @@ angle::Result ContextGL::drawElementsIndirect(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+bool ContextGL::canUseNativeMultiDraw(const gl::Context *context, bool isIndexed) const
+{
+    const FunctionsGL *functions = getFunctions();
+    if (isIndexed ? functions->multiDrawElements == nullptr : functions->multiDrawArrays == nullptr)
+    {
+        return false;
+    }
+
+    // gl_DrawID is emulated with a uniform that has to be updated between the draws.  Multiview
+    // draws are turned into instanced draws.
+    const gl::ProgramExecutable *executable = getState().getProgramExecutable();
+    if (executable->hasDrawIDUniform() || executable->usesMultiview())
+    {
+        return false;
+    }
+
+    // Client-side data is streamed per draw, based on the range of vertices or indices it uses.
+    if (context->getStateCache().hasAnyActiveClientAttrib() ||
+        getFeaturesGL().shiftInstancedArrayDataWithOffset.enabled)
+    {
+        return false;
+    }
+
+    return !isIndexed || getState().getVertexArray()->getElementArrayBuffer() != nullptr;
+}
+
 angle::Result ContextGL::multiDrawArrays(const gl::Context *context,
                                          gl::PrimitiveMode mode,
                                          const GLint *firsts,
@@ -746,6 +780,19 @@ angle::Result ContextGL::multiDrawArrays(const gl::Context *context,
 {
     mRenderer->markWorkSubmitted();
 
+    if (canUseNativeMultiDraw(context, false))
+    {
+#if defined(ANGLE_STATE_VALIDATION_ENABLED)
+        validateState();
+#endif
+
+        // Without client-side data, the draw range doesn't affect the state.
+        ANGLE_TRY(setDrawArraysState(context, 0, 0, 0));
+        ANGLE_GL_TRY(context,
+                     getFunctions()->multiDrawArrays(ToGLenum(mode), firsts, counts, drawcount));
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
 }
 
@@ -782,6 +829,20 @@ angle::Result ContextGL::multiDrawElements(const gl::Context *context,
 {
     mRenderer->markWorkSubmitted();
 
+    if (canUseNativeMultiDraw(context, true))
+    {
+#if defined(ANGLE_STATE_VALIDATION_ENABLED)
+        validateState();
+#endif
+
+        // With an element array buffer and no client-side data, the indices are used as is.
+        const void *drawIndexPtr = nullptr;
+        ANGLE_TRY(setDrawElementsState(context, 0, type, nullptr, 0, nullptr, &drawIndexPtr));
+        ANGLE_GL_TRY(context, getFunctions()->multiDrawElements(
+                                  ToGLenum(mode), counts, ToGLenum(type), indices, drawcount));
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
 }
 
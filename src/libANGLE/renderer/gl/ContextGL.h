@@ -311,8 +311,12 @@ class ContextGL : public ContextImpl
                                        gl::DrawElementsType type,
                                        const void *indices,
                                        GLsizei instanceCount,
+                                       const gl::IndexRange *indexRangeHint,
                                        const void **outIndices);
 
+    // Whether a multi-draw can be issued as a single native call instead of one draw per element.
+    bool canUseNativeMultiDraw(const gl::Context *context, bool isIndexed) const;
+
     gl::AttributesMask updateAttributesForBaseInstance(GLuint baseInstance);
     void resetUpdatedAttributes(gl::AttributesMask attribMask);
 
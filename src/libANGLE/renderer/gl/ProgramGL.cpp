@@ -15,6 +15,7 @@
 #include "common/string_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/ProgramLinkedResources.h"
 #include "libANGLE/Uniform.h"
 #include "libANGLE/queryconversions.h"
@@ -142,12 +143,16 @@ class ProgramGL::LinkTaskGL final : public LinkTask
 
     bool isLinkingInternally() override
     {
-        GLint completionStatus = GL_TRUE;
-        if (mHasNativeParallelCompile)
+        // See ShaderTranslateTaskGL::isCompilingInternally.
+        if (!mHasNativeParallelCompile || mNativeLinkCompleted)
         {
-            mFunctions->getProgramiv(mProgramID, GL_COMPLETION_STATUS, &completionStatus);
+            return false;
         }
-        return completionStatus == GL_FALSE;
+
+        GLint completionStatus = GL_TRUE;
+        mFunctions->getProgramiv(mProgramID, GL_COMPLETION_STATUS, &completionStatus);
+        mNativeLinkCompleted = completionStatus != GL_FALSE;
+        return !mNativeLinkCompleted;
     }
 
   private:
@@ -157,7 +162,8 @@ class ProgramGL::LinkTaskGL final : public LinkTask
     const gl::Extensions &mExtensions;
     const GLuint mProgramID;
 
-    angle::Result mResult = angle::Result::Continue;
+    angle::Result mResult     = angle::Result::Continue;
+    bool mNativeLinkCompleted = false;
 
     // Note: resources are kept alive by the front-end for the entire duration of the link,
     // including during resolve when getResult() and postLink() are called.
@@ -287,6 +293,16 @@ angle::Result ProgramGL::link(const gl::Context *context, std::shared_ptr<LinkTa
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "ProgramGL::link");
 
+    // The program cache stores the driver's program binary, see save().  Let the driver know it
+    // will be retrieved; without the hint, some drivers don't keep a binary around and return an
+    // empty one, so the program would be relinked on every launch anyway.
+    if (mFunctions->programParameteri &&
+        !context->getFrontendFeatures().disableProgramCaching.enabled &&
+        context->getDisplay()->getBlobCache().isCachingEnabled(context))
+    {
+        mFunctions->programParameteri(mProgramID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+
     *linkTaskOut = std::make_shared<LinkTaskGL>(this, mRenderer->hasNativeParallelCompile(),
                                                 mFunctions, context->getExtensions(), mProgramID);
 
@@ -47,14 +47,17 @@ class ShaderTranslateTaskGL final : public ShaderTranslateTask
 
     bool isCompilingInternally() override
     {
-        if (!mHasNativeParallelCompile)
+        // Once the driver reports completion, don't ask again; apps tend to poll
+        // GL_COMPLETION_STATUS every frame, and every glGet can stall a threaded driver.
+        if (!mHasNativeParallelCompile || mNativeCompileCompleted)
         {
             return false;
         }
 
         GLint status = GL_FALSE;
         mFunctions->getShaderiv(mShaderID, GL_COMPLETION_STATUS, &status);
-        return status != GL_TRUE;
+        mNativeCompileCompleted = status == GL_TRUE;
+        return !mNativeCompileCompleted;
     }
 
     angle::Result getResult(std::string &infoLog) override
@@ -99,6 +102,7 @@ class ShaderTranslateTaskGL final : public ShaderTranslateTask
     const FunctionsGL *mFunctions;
     GLuint mShaderID;
     bool mHasNativeParallelCompile;
+    bool mNativeCompileCompleted = false;
 };
 }  // anonymous namespace
 
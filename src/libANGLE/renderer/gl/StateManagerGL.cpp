@@ -56,6 +56,32 @@ static void ValidateStateHelper(const FunctionsGL *functions,
     }
 }
 
+// Calls |bindRange(first, count)| for each run of consecutive units set in |units|.
+template <typename BindRangeFunc>
+void ForEachConsecutiveUnitRange(const gl::ActiveTextureMask &units, BindRangeFunc &&bindRange)
+{
+    size_t first = 0;
+    size_t count = 0;
+    for (size_t unit : units)
+    {
+        if (count > 0 && unit == first + count)
+        {
+            ++count;
+            continue;
+        }
+        if (count > 0)
+        {
+            bindRange(first, count);
+        }
+        first = unit;
+        count = 1;
+    }
+    if (count > 0)
+    {
+        bindRange(first, count);
+    }
+}
+
 }  // anonymous namespace
 
 VertexArrayStateGL::VertexArrayStateGL(size_t maxAttribs, size_t maxBindings)
@@ -982,6 +1008,13 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
     const gl::ActiveTextureMask &activeTextures    = executable->getActiveSamplersMask();
     const gl::ActiveTextureTypeArray &textureTypes = executable->getActiveSamplerTypes();
 
+    // With multi-bind, the textures that changed are bound with one glBindTextures call per run
+    // of consecutive units.  Binding zero that way would unbind every target of the unit, so
+    // incomplete textures are still unbound one at a time.
+    const bool useMultiBind = mFeatures.useMultiBind.enabled && mFunctions->bindTextures;
+    gl::ActiveTextureMask pendingUnits;
+    gl::ActiveTextureArray<GLuint> pendingTextures;
+
     for (size_t textureUnitIndex : activeTextures)
     {
         gl::TextureType textureType = textureTypes[textureUnitIndex];
@@ -999,6 +1032,19 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
             ASSERT(!texture->hasAnyDirtyBitExcludingBoundAsAttachmentBit());
             ASSERT(!textureGL->hasAnyDirtyBit());
 
+            if (useMultiBind)
+            {
+                GLuint &boundTexture =
+                    mTextures[nativegl::GetNativeTextureType(textureType)][textureUnitIndex];
+                if (boundTexture != textureGL->getTextureID())
+                {
+                    boundTexture = textureGL->getTextureID();
+                    pendingUnits.set(textureUnitIndex);
+                    pendingTextures[textureUnitIndex] = boundTexture;
+                }
+                continue;
+            }
+
             activeTexture(textureUnitIndex);
             bindTexture(textureType, textureGL->getTextureID());
         }
@@ -1008,6 +1054,15 @@ void StateManagerGL::updateProgramTextureBindings(const gl::Context *context)
             bindTexture(textureType, 0);
         }
     }
+
+    if (pendingUnits.any())
+    {
+        ForEachConsecutiveUnitRange(pendingUnits, [&](size_t first, size_t count) {
+            mFunctions->bindTextures(static_cast<GLuint>(first), static_cast<GLsizei>(count),
+                                     &pendingTextures[first]);
+        });
+        mLocalDirtyBits.set(gl::state::DIRTY_BIT_TEXTURE_BINDINGS);
+    }
 }
 
 void StateManagerGL::updateProgramStorageBufferBindings(const gl::Context *context)
@@ -2865,19 +2920,37 @@ void StateManagerGL::syncSamplersState(const gl::Context *context)
 {
     const gl::SamplerBindingVector &samplers = context->getState().getSamplers();
 
+    const bool useMultiBind = mFeatures.useMultiBind.enabled && mFunctions->bindSamplers;
+    gl::ActiveTextureMask pendingUnits;
+    gl::ActiveTextureArray<GLuint> pendingSamplers;
+
     // This could be optimized by using a separate binding dirty bit per sampler.
     for (size_t samplerIndex = 0; samplerIndex < samplers.size(); ++samplerIndex)
     {
         const gl::Sampler *sampler = samplers[samplerIndex].get();
-        if (sampler != nullptr)
-        {
-            SamplerGL *samplerGL = GetImplAs<SamplerGL>(sampler);
-            bindSampler(samplerIndex, samplerGL->getSamplerID());
-        }
-        else
+        GLuint samplerID = sampler != nullptr ? GetImplAs<SamplerGL>(sampler)->getSamplerID() : 0;
+
+        if (useMultiBind)
         {
-            bindSampler(samplerIndex, 0);
+            if (mSamplers[samplerIndex] != samplerID)
+            {
+                mSamplers[samplerIndex] = samplerID;
+                pendingUnits.set(samplerIndex);
+                pendingSamplers[samplerIndex] = samplerID;
+            }
+            continue;
         }
+
+        bindSampler(samplerIndex, samplerID);
+    }
+
+    if (pendingUnits.any())
+    {
+        ForEachConsecutiveUnitRange(pendingUnits, [&](size_t first, size_t count) {
+            mFunctions->bindSamplers(static_cast<GLuint>(first), static_cast<GLsizei>(count),
+                                     &pendingSamplers[first]);
+        });
+        mLocalDirtyBits.set(gl::state::DIRTY_BIT_SAMPLER_BINDINGS);
     }
 }
 
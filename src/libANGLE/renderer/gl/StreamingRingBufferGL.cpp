@@ -0,0 +1,162 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingRingBufferGL.cpp: Implements the class methods for StreamingRingBufferGL.
+
+#include "libANGLE/renderer/gl/StreamingRingBufferGL.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
+
+namespace rx
+{
+namespace
+{
+constexpr size_t kInitialCapacity = 1024 * 1024;
+constexpr size_t kAlignment       = 16;
+constexpr GLuint64 kWaitTimeoutNs = 1000000000;
+
+constexpr GLbitfield kStorageFlags =
+    GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+}  // anonymous namespace
+
+StreamingRingBufferGL::StreamingRingBufferGL()
+{
+    mSegmentFences.fill(nullptr);
+}
+
+StreamingRingBufferGL::~StreamingRingBufferGL()
+{
+    ASSERT(mBuffer == 0);
+}
+
+void StreamingRingBufferGL::destroy(const gl::Context *context)
+{
+    releaseFences(GetFunctionsGL(context));
+
+    // Deleting the buffer also unmaps it.
+    GetStateManagerGL(context)->deleteBuffer(mBuffer);
+    mBuffer     = 0;
+    mMapPointer = nullptr;
+    mCapacity   = 0;
+    mHead       = 0;
+}
+
+angle::Result StreamingRingBufferGL::allocate(const gl::Context *context,
+                                              size_t size,
+                                              size_t minOffset,
+                                              uint8_t **ptrOut,
+                                              size_t *offsetOut)
+{
+    ASSERT(size > 0 && size + minOffset <= kMaxAllocationSize);
+
+    // Keep room for a few allocations of this size, so a draw doesn't wait for the previous one.
+    const size_t requiredSize = minOffset + size + kAlignment;
+    if (requiredSize * 2 > mCapacity)
+    {
+        ANGLE_TRY(createBuffer(context, roundUpPow2(requiredSize * 2, kInitialCapacity)));
+    }
+
+    size_t offset = roundUpPow2(std::max(mHead, minOffset), kAlignment);
+    if (offset + size > mCapacity)
+    {
+        // Move past the remaining segments to the start of the buffer.
+        do
+        {
+            ANGLE_TRY(advanceSegment(context));
+        } while (mCurrentSegment != 0);
+        offset = roundUpPow2(minOffset, kAlignment);
+    }
+
+    const size_t lastSegment = (offset + size - 1) / (mCapacity / kSegmentCount);
+    while (mCurrentSegment < lastSegment)
+    {
+        ANGLE_TRY(advanceSegment(context));
+    }
+
+    GetStateManagerGL(context)->bindBuffer(gl::BufferBinding::Array, mBuffer);
+
+    mHead      = offset + size;
+    *ptrOut    = mMapPointer + offset;
+    *offsetOut = offset;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingRingBufferGL::createBuffer(const gl::Context *context, size_t capacity)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    // The old buffer stays alive in the driver until the draws using it are done.
+    destroy(context);
+
+    ANGLE_GL_TRY(context, functions->genBuffers(1, &mBuffer));
+    stateManager->bindBuffer(gl::BufferBinding::Array, mBuffer);
+    ANGLE_GL_TRY(context,
+                 functions->bufferStorage(GL_ARRAY_BUFFER, capacity, nullptr, kStorageFlags));
+
+    mMapPointer = static_cast<uint8_t *>(
+        functions->mapBufferRange(GL_ARRAY_BUFFER, 0, capacity, kStorageFlags));
+    ANGLE_CHECK(GetImplAs<ContextGL>(context), mMapPointer != nullptr,
+                "Failed to map the client data streaming buffer.", GL_OUT_OF_MEMORY);
+
+    mCapacity       = capacity;
+    mHead           = 0;
+    mCurrentSegment = 0;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingRingBufferGL::advanceSegment(const gl::Context *context)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    ContextGL *contextGL         = GetImplAs<ContextGL>(context);
+
+    // The fence covers the draws that read the segment being left.
+    ASSERT(mSegmentFences[mCurrentSegment] == nullptr);
+    mSegmentFences[mCurrentSegment] = functions->fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ANGLE_CHECK(contextGL, mSegmentFences[mCurrentSegment] != nullptr,
+                "glFenceSync failed to create a GLsync object.", GL_OUT_OF_MEMORY);
+
+    mCurrentSegment = (mCurrentSegment + 1) % kSegmentCount;
+
+    GLsync fence = mSegmentFences[mCurrentSegment];
+    if (fence == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    GLenum result = GL_TIMEOUT_EXPIRED;
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+        result = functions->clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, kWaitTimeoutNs);
+    }
+    functions->deleteSync(fence);
+    mSegmentFences[mCurrentSegment] = nullptr;
+
+    ANGLE_CHECK(contextGL, result != GL_WAIT_FAILED,
+                "Failed to wait for the client data streaming buffer.", GL_OUT_OF_MEMORY);
+    return angle::Result::Continue;
+}
+
+void StreamingRingBufferGL::releaseFences(const FunctionsGL *functions)
+{
+    for (GLsync &fence : mSegmentFences)
+    {
+        if (fence != nullptr)
+        {
+            functions->deleteSync(fence);
+            fence = nullptr;
+        }
+    }
+    mCurrentSegment = 0;
+}
+
+}  // namespace rx
@@ -0,0 +1,73 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingRingBufferGL.h: Defines the class interface for StreamingRingBufferGL, a persistently
+// mapped buffer that client data is streamed into for draw calls.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGRINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGRINGBUFFERGL_H_
+
+#include <array>
+
+#include "angle_gl.h"
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+
+class FunctionsGL;
+
+// The buffer is created with glBufferStorage and stays mapped, so streaming data costs a memcpy
+// instead of a map and unmap per draw. It is split into segments that are fenced when the ring
+// moves past them, and a segment is only written again once the GPU is done with its old data.
+class StreamingRingBufferGL final : angle::NonCopyable
+{
+  public:
+    StreamingRingBufferGL();
+    ~StreamingRingBufferGL();
+
+    void destroy(const gl::Context *context);
+
+    // Reserves |size| bytes at an offset of at least |minOffset|, creating or growing the buffer
+    // as needed. Leaves the buffer bound to GL_ARRAY_BUFFER. The memory must be written before
+    // the draw call that uses it is issued.
+    angle::Result allocate(const gl::Context *context,
+                           size_t size,
+                           size_t minOffset,
+                           uint8_t **ptrOut,
+                           size_t *offsetOut);
+
+    GLuint getBufferID() const { return mBuffer; }
+
+    // Allocations whose size and minimal offset exceed this are not worth keeping memory around
+    // for, and are streamed the non-persistent way instead.
+    static constexpr size_t kMaxAllocationSize = 16 * 1024 * 1024;
+
+  private:
+    static constexpr size_t kSegmentCount = 4;
+
+    angle::Result createBuffer(const gl::Context *context, size_t capacity);
+    angle::Result advanceSegment(const gl::Context *context);
+    void releaseFences(const FunctionsGL *functions);
+
+    GLuint mBuffer       = 0;
+    uint8_t *mMapPointer = nullptr;
+    size_t mCapacity     = 0;
+    size_t mHead         = 0;
+
+    size_t mCurrentSegment = 0;
+    std::array<GLsync, kSegmentCount> mSegmentFences;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGRINGBUFFERGL_H_
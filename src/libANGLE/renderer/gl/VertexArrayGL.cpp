@@ -8,6 +8,7 @@
 
 #include "libANGLE/renderer/gl/VertexArrayGL.h"
 
+#include "common/FixedVector.h"
 #include "common/bitset_utils.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
@@ -65,6 +66,23 @@ GLuint GetAdjustedDivisor(GLuint numViews, GLuint divisor)
     return numViews * divisor;
 }
 
+// The range given to glDrawRangeElements bounds the indices, so the vertices to stream don't have
+// to be found by reading them.  A range with more vertices than there are indices is looser than
+// the indices could need, and reading them is then cheaper than streaming the extra vertices.
+bool UseIndexRangeHint(const IndexRange *indexRangeHint,
+                       GLsizei count,
+                       DrawElementsType type,
+                       bool primitiveRestartEnabled)
+{
+    if (indexRangeHint == nullptr || indexRangeHint->vertexCount() > static_cast<size_t>(count))
+    {
+        return false;
+    }
+
+    // The restart index is not a vertex, don't stream it if the range includes it.
+    return !primitiveRestartEnabled || indexRangeHint->end < GetPrimitiveRestartIndex(type);
+}
+
 static angle::Result ValidateStateHelperGetIntegerv(const gl::Context *context,
                                                     const GLuint localValue,
                                                     const GLenum pname,
@@ -154,6 +172,8 @@ void VertexArrayGL::destroy(const gl::Context *context)
     mStreamingArrayBufferSize = 0;
     mStreamingArrayBuffer     = 0;
 
+    mStreamingRingBuffer.destroy(context);
+
     if (mOwnsNativeState)
     {
         delete mNativeState;
@@ -168,7 +188,8 @@ angle::Result VertexArrayGL::syncClientSideData(const gl::Context *context,
                                                 GLsizei instanceCount) const
 {
     return syncDrawState(context, activeAttributesMask, first, count,
-                         gl::DrawElementsType::InvalidEnum, nullptr, instanceCount, false, nullptr);
+                         gl::DrawElementsType::InvalidEnum, nullptr, instanceCount, false, nullptr,
+                         nullptr);
 }
 
 angle::Result VertexArrayGL::updateElementArrayBufferBinding(const gl::Context *context) const
@@ -196,6 +217,7 @@ angle::Result VertexArrayGL::syncDrawState(const gl::Context *context,
                                            const void *indices,
                                            GLsizei instanceCount,
                                            bool primitiveRestartEnabled,
+                                           const gl::IndexRange *indexRangeHint,
                                            const void **outIndices) const
 {
     const FunctionsGL *functions = GetFunctionsGL(context);
@@ -216,7 +238,8 @@ angle::Result VertexArrayGL::syncDrawState(const gl::Context *context,
     if (type != gl::DrawElementsType::InvalidEnum)
     {
         ANGLE_TRY(syncIndexData(context, count, type, indices, primitiveRestartEnabled,
-                                needsStreamingAttribs.any(), &indexRange, outIndices));
+                                needsStreamingAttribs.any(), indexRangeHint, &indexRange,
+                                outIndices));
     }
     else
     {
@@ -275,6 +298,7 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
                                            const void *indices,
                                            bool primitiveRestartEnabled,
                                            bool attributesNeedStreaming,
+                                           const IndexRange *indexRangeHint,
                                            IndexRange *outIndexRange,
                                            const void **outIndices) const
 {
@@ -282,6 +306,9 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
 
     const FunctionsGL *functions = GetFunctionsGL(context);
 
+    const bool useIndexRangeHint =
+        UseIndexRangeHint(indexRangeHint, count, type, primitiveRestartEnabled);
+
     gl::Buffer *elementArrayBuffer = mState.getElementArrayBuffer();
 
     // Need to check the range of indices if attributes need to be streamed
@@ -289,7 +316,11 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
     {
         ASSERT(SameIndexBuffer(mNativeState, elementArrayBuffer));
         // Only compute the index range if the attributes also need to be streamed
-        if (attributesNeedStreaming)
+        if (attributesNeedStreaming && useIndexRangeHint)
+        {
+            *outIndexRange = *indexRangeHint;
+        }
+        else if (attributesNeedStreaming)
         {
             ptrdiff_t elementArrayBufferOffset = reinterpret_cast<ptrdiff_t>(indices);
             ANGLE_TRY(mState.getElementArrayBuffer()->getIndexRange(
@@ -315,7 +346,11 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
         // Need to stream the index buffer
 
         // Only compute the index range if the attributes also need to be streamed
-        if (attributesNeedStreaming)
+        if (attributesNeedStreaming && useIndexRangeHint)
+        {
+            *outIndexRange = *indexRangeHint;
+        }
+        else if (attributesNeedStreaming)
         {
             *outIndexRange = ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
         }
@@ -412,6 +447,18 @@ angle::Result VertexArrayGL::streamAttributes(
         return angle::Result::Continue;
     }
 
+    if (GetFeaturesGL(context).usePersistentMappedStreamingBuffer.enabled &&
+        !applyExtraOffsetWorkaroundForInstancedAttributes)
+    {
+        bool streamed = false;
+        ANGLE_TRY(streamAttributesToRingBuffer(context, attribsToStream, instanceCount, indexRange,
+                                               &streamed));
+        if (streamed)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
     if (mStreamingArrayBuffer == 0)
     {
         ANGLE_GL_TRY(context, functions->genBuffers(1, &mStreamingArrayBuffer));
@@ -584,6 +631,179 @@ angle::Result VertexArrayGL::streamAttributes(
     return angle::Result::Continue;
 }
 
+angle::Result VertexArrayGL::streamAttributesToRingBuffer(
+    const gl::Context *context,
+    const gl::AttributesMask &attribsToStream,
+    GLsizei instanceCount,
+    const gl::IndexRange &indexRange,
+    bool *streamedOut) const
+{
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    const auto &attribs  = mState.getVertexAttributes();
+    const auto &bindings = mState.getVertexBindings();
+
+    // A span of client memory copied in one go, holding one attribute packed or several
+    // attributes that are interleaved with the same stride.
+    struct StreamingCopy
+    {
+        gl::AttributesMask attribs;
+        const uint8_t *source;
+        size_t sourceStride;
+        size_t destStride;
+        size_t firstIndex;
+        size_t vertexCount;
+        size_t size;
+        size_t offset;
+    };
+    angle::FixedVector<StreamingCopy, gl::MAX_VERTEX_ATTRIBS> copies;
+
+    size_t streamingDataSize = 0;
+    size_t minOffset         = 0;
+
+    gl::AttributesMask remainingAttribs = attribsToStream;
+    for (size_t idx : attribsToStream)
+    {
+        if (!remainingAttribs.test(idx))
+        {
+            continue;
+        }
+
+        const VertexAttribute &attrib = attribs[idx];
+        ASSERT(IsVertexAttribPointerSupported(idx, attrib));
+        const VertexBinding &binding = bindings[attrib.bindingIndex];
+
+        // Attributes using client memory ignore the VERTEX_ATTRIB_BINDING state.
+        const uint8_t *pointer     = static_cast<const uint8_t *>(attrib.pointer);
+        const size_t sourceStride  = ComputeVertexAttributeStride(attrib, binding);
+        const GLuint divisor       = GetAdjustedDivisor(mAppliedNumViews, binding.getDivisor());
+        const size_t attribSize    = ComputeVertexAttributeTypeSize(attrib);
+        uintptr_t spanStart        = reinterpret_cast<uintptr_t>(pointer);
+        uintptr_t spanEnd          = spanStart + attribSize;
+        size_t interleavedDataSize = attribSize;
+
+        StreamingCopy copy = {};
+        copy.attribs.set(idx);
+
+        // Look for the other attributes that sit in the same vertices of client memory.
+        gl::AttributesMask candidateAttribs = remainingAttribs;
+        candidateAttribs.reset(idx);
+        if (pointer == nullptr)
+        {
+            candidateAttribs.reset();
+        }
+        for (size_t otherIdx : candidateAttribs)
+        {
+            const VertexAttribute &other      = attribs[otherIdx];
+            const VertexBinding &otherBinding = bindings[other.bindingIndex];
+            const uintptr_t otherStart        = reinterpret_cast<uintptr_t>(other.pointer);
+            const uintptr_t otherEnd          = otherStart + ComputeVertexAttributeTypeSize(other);
+            if (ComputeVertexAttributeStride(other, otherBinding) != sourceStride ||
+                GetAdjustedDivisor(mAppliedNumViews, otherBinding.getDivisor()) != divisor ||
+                std::max(spanEnd, otherEnd) - std::min(spanStart, otherStart) > sourceStride)
+            {
+                continue;
+            }
+
+            copy.attribs.set(otherIdx);
+            spanStart = std::min(spanStart, otherStart);
+            spanEnd   = std::max(spanEnd, otherEnd);
+            interleavedDataSize += otherEnd - otherStart;
+        }
+
+        // Copying the vertices whole only pays off if the attributes fill most of them.
+        if (copy.attribs.count() > 1 && interleavedDataSize * 2 < sourceStride)
+        {
+            copy.attribs.reset();
+            copy.attribs.set(idx);
+            spanStart = reinterpret_cast<uintptr_t>(pointer);
+            spanEnd   = spanStart + attribSize;
+        }
+        remainingAttribs &= ~copy.attribs;
+
+        // Vertices do not apply the 'start' offset when the divisor is non-zero even when doing
+        // a non-instanced draw call
+        copy.source       = reinterpret_cast<const uint8_t *>(spanStart);
+        copy.sourceStride = sourceStride;
+        copy.destStride   = copy.attribs.count() > 1 ? sourceStride : attribSize;
+        copy.firstIndex   = divisor == 0 ? indexRange.start : 0;
+        copy.vertexCount =
+            ComputeVertexBindingElementCount(divisor, indexRange.vertexCount(), instanceCount);
+        copy.size   = copy.vertexCount == 0
+                          ? 0
+                          : copy.destStride * (copy.vertexCount - 1) + (spanEnd - spanStart);
+        copy.offset = streamingDataSize;
+
+        streamingDataSize += copy.size;
+        minOffset = std::max(minOffset, copy.destStride * copy.firstIndex);
+        copies.push_back(copy);
+    }
+
+    if (streamingDataSize + minOffset > StreamingRingBufferGL::kMaxAllocationSize)
+    {
+        *streamedOut = false;
+        return angle::Result::Continue;
+    }
+
+    uint8_t *bufferPointer = nullptr;
+    size_t bufferOffset    = 0;
+    ANGLE_TRY(mStreamingRingBuffer.allocate(context, streamingDataSize, minOffset, &bufferPointer,
+                                            &bufferOffset));
+
+    stateManager->bindVertexArray(mVertexArrayID, mNativeState);
+
+    const GLuint ringBufferID = mStreamingRingBuffer.getBufferID();
+    for (const StreamingCopy &copy : copies)
+    {
+        uint8_t *out      = bufferPointer + copy.offset;
+        const uint8_t *in = copy.source + copy.sourceStride * copy.firstIndex;
+
+        // Pack the data when copying a single attribute, user could have supplied a very large
+        // stride that would cause the buffer to be much larger than needed.
+        if (copy.destStride == copy.sourceStride)
+        {
+            memcpy(out, in, copy.size);
+        }
+        else
+        {
+            for (size_t vertexIdx = 0; vertexIdx < copy.vertexCount; vertexIdx++)
+            {
+                memcpy(out + copy.destStride * vertexIdx, in + copy.sourceStride * vertexIdx,
+                       copy.destStride);
+            }
+        }
+
+        // Compute where the 0-index vertex of the span would be.
+        const size_t vertexStartOffset =
+            bufferOffset + copy.offset - copy.firstIndex * copy.destStride;
+
+        for (size_t idx : copy.attribs)
+        {
+            const VertexAttribute &attrib = attribs[idx];
+            const size_t attribOffset =
+                vertexStartOffset + (static_cast<const uint8_t *>(attrib.pointer) - copy.source);
+
+            ANGLE_TRY(callVertexAttribPointer(context, static_cast<GLuint>(idx), attrib,
+                                              static_cast<GLsizei>(copy.destStride),
+                                              static_cast<GLintptr>(attribOffset)));
+
+            // Update the state to track the streamed attribute
+            mNativeState->attributes[idx].format = attrib.format;
+
+            mNativeState->attributes[idx].relativeOffset = 0;
+            mNativeState->attributes[idx].bindingIndex   = static_cast<GLuint>(idx);
+
+            mNativeState->bindings[idx].stride = static_cast<GLsizei>(copy.destStride);
+            mNativeState->bindings[idx].offset = static_cast<GLintptr>(attribOffset);
+            mArrayBuffers[idx].set(context, nullptr);
+            mNativeState->bindings[idx].buffer = ringBufferID;
+        }
+    }
+
+    *streamedOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result VertexArrayGL::recoverForcedStreamingAttributesForDrawArraysInstanced(
     const gl::Context *context) const
 {
@@ -14,6 +14,7 @@
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/StreamingRingBufferGL.h"
 
 namespace rx
 {
@@ -43,6 +44,7 @@ class VertexArrayGL : public VertexArrayImpl
                                         const void *indices,
                                         GLsizei instanceCount,
                                         bool primitiveRestartEnabled,
+                                        const gl::IndexRange *indexRangeHint,
                                         const void **outIndices) const;
 
     GLuint getVertexArrayID() const;
@@ -72,15 +74,18 @@ class VertexArrayGL : public VertexArrayImpl
                                 const void *indices,
                                 GLsizei instanceCount,
                                 bool primitiveRestartEnabled,
+                                const gl::IndexRange *indexRangeHint,
                                 const void **outIndices) const;
 
-    // Apply index data, only sets outIndexRange if attributesNeedStreaming is true
+    // Apply index data, only sets outIndexRange if attributesNeedStreaming is true.  The range
+    // the application gave the draw call, if any, is used instead of computing it when possible.
     angle::Result syncIndexData(const gl::Context *context,
                                 GLsizei count,
                                 gl::DrawElementsType type,
                                 const void *indices,
                                 bool primitiveRestartEnabled,
                                 bool attributesNeedStreaming,
+                                const gl::IndexRange *indexRangeHint,
                                 gl::IndexRange *outIndexRange,
                                 const void **outIndices) const;
 
@@ -98,6 +103,14 @@ class VertexArrayGL : public VertexArrayImpl
                                    GLsizei instanceCount,
                                    const gl::IndexRange &indexRange,
                                    bool applyExtraOffsetWorkaroundForInstancedAttributes) const;
+    // Stream attributes that have client data into the persistently mapped ring buffer, copying
+    // attributes interleaved in client memory together.  Sets |streamedOut| to false without
+    // streaming anything if the data is too large for the ring buffer.
+    angle::Result streamAttributesToRingBuffer(const gl::Context *context,
+                                               const gl::AttributesMask &attribsToStream,
+                                               GLsizei instanceCount,
+                                               const gl::IndexRange &indexRange,
+                                               bool *streamedOut) const;
     angle::Result syncDirtyAttrib(const gl::Context *context,
                                   size_t attribIndex,
                                   const gl::VertexArray::DirtyAttribBits &dirtyAttribBits);
@@ -146,6 +159,9 @@ class VertexArrayGL : public VertexArrayImpl
     mutable size_t mStreamingArrayBufferSize = 0;
     mutable GLuint mStreamingArrayBuffer     = 0;
 
+    // Used instead of mStreamingArrayBuffer with usePersistentMappedStreamingBuffer
+    mutable StreamingRingBufferGL mStreamingRingBuffer;
+
     // Used for Mac Intel instanced draw workaround
     mutable gl::AttributesMask mForcedStreamingAttributesForDrawArraysInstancedMask;
     mutable gl::AttributesMask mInstancedAttributesMask;
@@ -160,10 +176,11 @@ ANGLE_INLINE angle::Result VertexArrayGL::syncDrawElementsState(
     const void *indices,
     GLsizei instanceCount,
     bool primitiveRestartEnabled,
+    const gl::IndexRange *indexRangeHint,
     const void **outIndices) const
 {
     return syncDrawState(context, activeAttributesMask, 0, count, type, indices, instanceCount,
-                         primitiveRestartEnabled, outIndices);
+                         primitiveRestartEnabled, indexRangeHint, outIndices);
 }
 
 }  // namespace rx
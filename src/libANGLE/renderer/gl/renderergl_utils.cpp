@@ -2707,6 +2707,16 @@ void InitializeFeatures(const FunctionsGL *functions, angle::FeaturesGL *feature
     ANGLE_FEATURE_CONDITION(
         features, disableBlendEquationAdvanced,
         (isIntel && IsWindows()) || IsAdreno4xx(functions) || IsAdreno5xx(functions) || isMali);
+
+    // Binding a run of texture units or samplers in one call saves native calls on draw-heavy
+    // content, but is left opt-in until it has seen more drivers.
+    ANGLE_FEATURE_CONDITION(features, useMultiBind, false);
+
+    // Streaming client arrays into a buffer that stays mapped saves a map and unmap per draw.
+    ANGLE_FEATURE_CONDITION(features, usePersistentMappedStreamingBuffer,
+                            functions->bufferStorage != nullptr &&
+                                functions->mapBufferRange != nullptr &&
+                                functions->fenceSync != nullptr);
 }
 
 void InitializeFrontendFeatures(const FunctionsGL *functions, angle::FrontendFeatures *features)
@@ -12,6 +12,7 @@
 
 #import <Metal/Metal.h>
 
+#include <deque>
 #include <optional>
 #include <utility>
 
@@ -80,6 +81,26 @@ struct IndexConversionBufferMtl : public ConversionBufferMtl
     IndexRange getRangeForConvertedBuffer(size_t count);
 };
 
+// The triangle fan or line loop indices generated from an element array buffer by a draw.
+struct PrimitiveIndexConversionBufferMtl : public ConversionBufferMtl
+{
+    PrimitiveIndexConversionBufferMtl(ContextMtl *context,
+                                      gl::PrimitiveMode modeIn,
+                                      gl::DrawElementsType elemTypeIn,
+                                      bool primitiveRestartEnabledIn,
+                                      size_t offsetIn,
+                                      GLsizei countIn);
+
+    // The conversion is identified by the draw's {mode, type, primitive restart, offset, count}.
+    gl::PrimitiveMode mode;
+    gl::DrawElementsType elemType;
+    bool primitiveRestartEnabled;
+    size_t offset;
+    GLsizei count;
+    // The number of generated indices in convertedBuffer.
+    uint32_t convertedIndexCount;
+};
+
 struct UniformConversionBufferMtl : public ConversionBufferMtl
 {
     UniformConversionBufferMtl(ContextMtl *context,
@@ -173,6 +194,16 @@ class BufferMtl : public BufferImpl, public BufferHolderMtl
                                                     std::pair<size_t, size_t> offset,
                                                     size_t blockSize);
 
+    // The generated indices are kept until the buffer is written to, so drawing the same range as
+    // a triangle fan or line loop every frame doesn't regenerate them.
+    PrimitiveIndexConversionBufferMtl *getPrimitiveIndexConversionBuffer(
+        ContextMtl *context,
+        gl::PrimitiveMode mode,
+        gl::DrawElementsType elemType,
+        bool primitiveRestartEnabled,
+        size_t offset,
+        GLsizei count);
+
     size_t size() const { return static_cast<size_t>(mState.getSize()); }
 
     const std::vector<IndexRange> &getRestartIndices(ContextMtl *ctx,
@@ -236,6 +267,9 @@ class BufferMtl : public BufferImpl, public BufferHolderMtl
 
     std::vector<UniformConversionBufferMtl> mUniformConversionBuffers;
 
+    // A deque, so the least recently created conversions can be dropped without moving the rest.
+    std::deque<PrimitiveIndexConversionBufferMtl> mPrimitiveIndexConversionBuffers;
+
     struct RestartRangeCache
     {
         RestartRangeCache(std::vector<IndexRange> &&ranges_, gl::DrawElementsType indexType_)
@@ -77,6 +77,23 @@ IndexRange IndexConversionBufferMtl::getRangeForConvertedBuffer(size_t count)
     return IndexRange{0, count};
 }
 
+// PrimitiveIndexConversionBufferMtl implementation.
+PrimitiveIndexConversionBufferMtl::PrimitiveIndexConversionBufferMtl(
+    ContextMtl *context,
+    gl::PrimitiveMode modeIn,
+    gl::DrawElementsType elemTypeIn,
+    bool primitiveRestartEnabledIn,
+    size_t offsetIn,
+    GLsizei countIn)
+    : ConversionBufferMtl(context, 0, mtl::kIndexBufferOffsetAlignment),
+      mode(modeIn),
+      elemType(elemTypeIn),
+      primitiveRestartEnabled(primitiveRestartEnabledIn),
+      offset(offsetIn),
+      count(countIn),
+      convertedIndexCount(0)
+{}
+
 // UniformConversionBufferMtl implementation
 UniformConversionBufferMtl::UniformConversionBufferMtl(ContextMtl *context,
                                                        std::pair<size_t, size_t> offsetIn,
@@ -398,6 +415,36 @@ ConversionBufferMtl *BufferMtl::getUniformConversionBuffer(ContextMtl *context,
     return &mUniformConversionBuffers.back();
 }
 
+PrimitiveIndexConversionBufferMtl *BufferMtl::getPrimitiveIndexConversionBuffer(
+    ContextMtl *context,
+    gl::PrimitiveMode mode,
+    gl::DrawElementsType elemType,
+    bool primitiveRestartEnabled,
+    size_t offset,
+    GLsizei count)
+{
+    for (PrimitiveIndexConversionBufferMtl &buffer : mPrimitiveIndexConversionBuffers)
+    {
+        if (buffer.mode == mode && buffer.elemType == elemType &&
+            buffer.primitiveRestartEnabled == primitiveRestartEnabled && buffer.offset == offset &&
+            buffer.count == count)
+        {
+            return &buffer;
+        }
+    }
+
+    // Every draw range gets its own conversion, so limit how many are kept.
+    constexpr size_t kMaxPrimitiveIndexConversionBuffers = 16;
+    if (mPrimitiveIndexConversionBuffers.size() >= kMaxPrimitiveIndexConversionBuffers)
+    {
+        mPrimitiveIndexConversionBuffers.pop_front();
+    }
+
+    mPrimitiveIndexConversionBuffers.emplace_back(context, mode, elemType, primitiveRestartEnabled,
+                                                  offset, count);
+    return &mPrimitiveIndexConversionBuffers.back();
+}
+
 void BufferMtl::markConversionBuffersDirty()
 {
     for (VertexConversionBufferMtl &buffer : mVertexConversionBuffers)
@@ -420,6 +467,14 @@ void BufferMtl::markConversionBuffersDirty()
         buffer.convertedBuffer = nullptr;
         buffer.convertedOffset = 0;
     }
+
+    for (PrimitiveIndexConversionBufferMtl &buffer : mPrimitiveIndexConversionBuffers)
+    {
+        buffer.dirty               = true;
+        buffer.convertedBuffer     = nullptr;
+        buffer.convertedOffset     = 0;
+        buffer.convertedIndexCount = 0;
+    }
     mRestartRangeCache.reset();
 }
 
@@ -428,6 +483,7 @@ void BufferMtl::clearConversionBuffers()
     mVertexConversionBuffers.clear();
     mIndexConversionBuffers.clear();
     mUniformConversionBuffers.clear();
+    mPrimitiveIndexConversionBuffers.clear();
     mRestartRangeCache.reset();
 }
 
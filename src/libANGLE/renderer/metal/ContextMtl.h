@@ -446,6 +446,15 @@ class ContextMtl : public ContextImpl, public mtl::Context
                                          GLint first,
                                          GLsizei count,
                                          GLsizei instances);
+    // Generates the triangle list or line strip indices of a triangle fan or line loop elements
+    // draw.  Those generated from an element array buffer are cached in the buffer.
+    angle::Result generateTriFanOrLineLoopElementsIndices(gl::PrimitiveMode mode,
+                                                          GLsizei count,
+                                                          gl::DrawElementsType type,
+                                                          const void *indices,
+                                                          mtl::BufferRef *genIdxBufferOut,
+                                                          uint32_t *genIdxBufferOffsetOut,
+                                                          uint32_t *genIndicesCountOut);
     angle::Result drawTriFanElements(const gl::Context *context,
                                      GLsizei count,
                                      gl::DrawElementsType type,
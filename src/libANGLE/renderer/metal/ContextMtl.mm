@@ -214,7 +214,8 @@ ContextMtl::ContextMtl(const gl::State &state,
       mCmdBuffer(&display->cmdQueue()),
       mRenderEncoder(&mCmdBuffer,
                      mOcclusionQueryPool,
-                     display->getFeatures().emulateDontCareLoadWithRandomClear.enabled),
+                     display->getFeatures().emulateDontCareLoadWithRandomClear.enabled,
+                     display->getFeatures().encodeRenderPassesInParallel.enabled),
       mBlitEncoder(&mCmdBuffer),
       mComputeEncoder(&mCmdBuffer),
       mDriverUniforms{},
@@ -551,6 +552,71 @@ angle::Result ContextMtl::drawArraysInstancedBaseInstance(const gl::Context *con
     return drawArraysImpl(context, mode, first, count, instanceCount, baseInstance);
 }
 
+angle::Result ContextMtl::generateTriFanOrLineLoopElementsIndices(
+    gl::PrimitiveMode mode,
+    GLsizei count,
+    gl::DrawElementsType type,
+    const void *indices,
+    mtl::BufferRef *genIdxBufferOut,
+    uint32_t *genIdxBufferOffsetOut,
+    uint32_t *genIndicesCountOut)
+{
+    ASSERT(mode == gl::PrimitiveMode::TriangleFan || mode == gl::PrimitiveMode::LineLoop);
+    const bool isTriFan         = mode == gl::PrimitiveMode::TriangleFan;
+    const bool primitiveRestart = getState().isPrimitiveRestartEnabled();
+
+    // Indices from client memory may change with every draw, so they are always generated in the
+    // context's pools.
+    const gl::Buffer *elementBuffer = getState().getVertexArray()->getElementArrayBuffer();
+    mtl::BufferPool *pool           = isTriFan ? &mTriFanIndexBuffer : &mLineLoopIndexBuffer;
+    PrimitiveIndexConversionBufferMtl *conversion = nullptr;
+    if (elementBuffer != nullptr)
+    {
+        conversion = mtl::GetImpl(elementBuffer)
+                         ->getPrimitiveIndexConversionBuffer(this, mode, type, primitiveRestart,
+                                                             reinterpret_cast<size_t>(indices),
+                                                             count);
+        if (!conversion->dirty)
+        {
+            *genIdxBufferOut       = conversion->convertedBuffer;
+            *genIdxBufferOffsetOut = static_cast<uint32_t>(conversion->convertedOffset);
+            *genIndicesCountOut    = conversion->convertedIndexCount;
+            return angle::Result::Continue;
+        }
+        pool = &conversion->data;
+    }
+
+    if (isTriFan)
+    {
+        ANGLE_TRY(AllocateTriangleFanBufferFromPool(this, count, pool, genIdxBufferOut,
+                                                    genIdxBufferOffsetOut, genIndicesCountOut));
+        ANGLE_TRY(getDisplay()->getUtils().generateTriFanBufferFromElementsArray(
+            this,
+            {type, count, indices, *genIdxBufferOut, *genIdxBufferOffsetOut, primitiveRestart},
+            genIndicesCountOut));
+    }
+    else
+    {
+        ANGLE_TRY(AllocateBufferFromPool(this, count * 2, pool, genIdxBufferOut,
+                                         genIdxBufferOffsetOut));
+        ANGLE_TRY(getDisplay()->getUtils().generateLineLoopBufferFromElementsArray(
+            this,
+            {type, count, indices, *genIdxBufferOut, *genIdxBufferOffsetOut, primitiveRestart},
+            genIndicesCountOut));
+    }
+    ANGLE_TRY(pool->commit(this));
+
+    if (conversion != nullptr)
+    {
+        conversion->dirty               = false;
+        conversion->convertedBuffer     = *genIdxBufferOut;
+        conversion->convertedOffset     = *genIdxBufferOffsetOut;
+        conversion->convertedIndexCount = *genIndicesCountOut;
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextMtl::drawTriFanElements(const gl::Context *context,
                                              GLsizei count,
                                              gl::DrawElementsType type,
@@ -564,15 +630,10 @@ angle::Result ContextMtl::drawTriFanElements(const gl::Context *context,
         mtl::BufferRef genIdxBuffer;
         uint32_t genIdxBufferOffset;
         uint32_t genIndicesCount;
-        bool primitiveRestart = getState().isPrimitiveRestartEnabled();
-        ANGLE_TRY(AllocateTriangleFanBufferFromPool(this, count, &mTriFanIndexBuffer, &genIdxBuffer,
-                                                    &genIdxBufferOffset, &genIndicesCount));
-
-        ANGLE_TRY(getDisplay()->getUtils().generateTriFanBufferFromElementsArray(
-            this, {type, count, indices, genIdxBuffer, genIdxBufferOffset, primitiveRestart},
-            &genIndicesCount));
+        ANGLE_TRY(generateTriFanOrLineLoopElementsIndices(gl::PrimitiveMode::TriangleFan, count,
+                                                          type, indices, &genIdxBuffer,
+                                                          &genIdxBufferOffset, &genIndicesCount));
 
-        ANGLE_TRY(mTriFanIndexBuffer.commit(this));
         bool isNoOp = false;
         ANGLE_TRY(setupDraw(context, gl::PrimitiveMode::TriangleFan, 0, count, instances, type,
                             indices, false, &isNoOp));
@@ -633,16 +694,11 @@ angle::Result ContextMtl::drawLineLoopElements(const gl::Context *context,
 
         mtl::BufferRef genIdxBuffer;
         uint32_t genIdxBufferOffset;
-        uint32_t reservedIndices = count * 2;
         uint32_t genIndicesCount;
-        ANGLE_TRY(AllocateBufferFromPool(this, reservedIndices, &mLineLoopIndexBuffer,
-                                         &genIdxBuffer, &genIdxBufferOffset));
-
-        ANGLE_TRY(getDisplay()->getUtils().generateLineLoopBufferFromElementsArray(
-            this, {type, count, indices, genIdxBuffer, genIdxBufferOffset, primitiveRestart},
-            &genIndicesCount));
+        ANGLE_TRY(generateTriFanOrLineLoopElementsIndices(gl::PrimitiveMode::LineLoop, count, type,
+                                                          indices, &genIdxBuffer,
+                                                          &genIdxBufferOffset, &genIndicesCount));
 
-        ANGLE_TRY(mLineLoopIndexBuffer.commit(this));
         bool isNoOp = false;
         ANGLE_TRY(setupDraw(context, gl::PrimitiveMode::LineLoop, 0, count, instances, type,
                             indices, false, &isNoOp));
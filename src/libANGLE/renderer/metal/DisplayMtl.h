@@ -17,7 +17,9 @@
 #include "libANGLE/renderer/metal/mtl_command_buffer.h"
 #include "libANGLE/renderer/metal/mtl_context_device.h"
 #include "libANGLE/renderer/metal/mtl_format_utils.h"
+#include "libANGLE/renderer/metal/mtl_heap_pool.h"
 #include "libANGLE/renderer/metal/mtl_library_cache.h"
+#include "libANGLE/renderer/metal/mtl_pipeline_cache.h"
 #include "libANGLE/renderer/metal/mtl_render_utils.h"
 #include "libANGLE/renderer/metal/mtl_state_cache.h"
 #include "libANGLE/renderer/metal/mtl_utils.h"
@@ -154,6 +156,8 @@ class DisplayMtl : public DisplayImpl
     mtl::RenderUtils &getUtils() { return *mUtils; }
     mtl::StateCache &getStateCache() { return mStateCache; }
     mtl::LibraryCache &getLibraryCache() { return mLibraryCache; }
+    mtl::PipelineArchive &getPipelineArchive() { return mPipelineArchive; }
+    mtl::HeapPool &getRenderTargetHeapPool() { return mRenderTargetHeapPool; }
     uint32_t getMaxColorTargetBits() { return mMaxColorTargetBits; }
     bool hasFragmentMemoryBarriers() const { return mHasFragmentMemoryBarriers; }
 
@@ -208,6 +212,8 @@ class DisplayMtl : public DisplayImpl
     mutable mtl::FormatTable mFormatTable;
     mtl::StateCache mStateCache;
     mtl::LibraryCache mLibraryCache;
+    mtl::PipelineArchive mPipelineArchive;
+    mtl::HeapPool mRenderTargetHeapPool;
     std::unique_ptr<mtl::RenderUtils> mUtils;
 
     // Built-in Shaders
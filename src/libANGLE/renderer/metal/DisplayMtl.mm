@@ -41,6 +41,9 @@
 namespace rx
 {
 
+// Where the render pipeline archive is stored when usePipelineBinaryArchive is enabled.
+constexpr char kPipelineArchivePathEnv[] = "ANGLE_METAL_PIPELINE_ARCHIVE_PATH";
+
 static EGLint GetDepthSize(GLint internalformat)
 {
     switch (internalformat)
@@ -154,6 +157,15 @@ angle::Result DisplayMtl::initializeImpl(egl::Display *display)
         ANGLE_TRY(mFormatTable.initialize(this));
         ANGLE_TRY(initializeShaderLibrary());
 
+        if (mFeatures.usePipelineBinaryArchive.enabled)
+        {
+            const std::string archivePath = angle::GetEnvironmentVar(kPipelineArchivePathEnv);
+            if (!archivePath.empty())
+            {
+                mPipelineArchive.initialize(mMetalDevice, archivePath);
+            }
+        }
+
         mUtils = std::make_unique<mtl::RenderUtils>(this);
 
         return angle::Result::Continue;
@@ -163,6 +175,9 @@ angle::Result DisplayMtl::initializeImpl(egl::Display *display)
 void DisplayMtl::terminate()
 {
     mUtils = nullptr;
+    mPipelineArchive.serialize();
+    mPipelineArchive.destroy();
+    mRenderTargetHeapPool.destroy();
     mCmdQueue.reset();
     mDefaultShaders = nil;
     mMetalDevice    = nil;
@@ -1326,6 +1341,17 @@ void DisplayMtl::initializeFeatures()
     // Disabled on Mac11 due to test failures. http://crbug.com/1522730
     ANGLE_FEATURE_CONDITION((&mFeatures), injectAsmStatementIntoLoopBodies,
                             !isOSX || GetMacOSVersion() >= OSVersion(12, 0, 0));
+
+    // Opt-in, since it needs a writable path for the archive.
+    ANGLE_FEATURE_CONDITION((&mFeatures), usePipelineBinaryArchive, false);
+
+    // Heaps commit their whole size up front, which isn't always a win for apps that only have a
+    // few render targets.
+    ANGLE_FEATURE_CONDITION((&mFeatures), useHeapsForRenderTargetTextures, false);
+
+    // Opt-in until it has been measured on more devices; small render passes are always encoded
+    // serially.
+    ANGLE_FEATURE_CONDITION((&mFeatures), encodeRenderPassesInParallel, false);
 }
 
 angle::Result DisplayMtl::initializeShaderLibrary()
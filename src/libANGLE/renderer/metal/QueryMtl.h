@@ -117,6 +117,9 @@ class QueryMtl : public QueryImpl
     size_t mTransformFeedbackPrimitivesDrawn = 0;
 
     uint64_t mTimeElapsedEntry = 0;
+
+    // Number of times the result availability was polled while the query had pending work.
+    uint32_t mPendingResultAvailablePollCount = 0;
 };
 
 }  // namespace rx
@@ -13,6 +13,13 @@
 
 namespace rx
 {
+namespace
+{
+// Polls of a pending occlusion query before its command buffer is committed, so that it is usually
+// left to the application's next flush.
+constexpr uint32_t kResultAvailablePollsBeforeFlush = 32;
+}  // anonymous namespace
+
 QueryMtl::QueryMtl(gl::QueryType type) : QueryImpl(type) {}
 
 QueryMtl::~QueryMtl() {}
@@ -30,6 +37,9 @@ void QueryMtl::onDestroy(const gl::Context *context)
 angle::Result QueryMtl::begin(const gl::Context *context)
 {
     ContextMtl *contextMtl = mtl::GetImpl(context);
+
+    mPendingResultAvailablePollCount = 0;
+
     switch (getType())
     {
         case gl::QueryType::AnySamples:
@@ -158,7 +168,8 @@ angle::Result QueryMtl::isResultAvailable(const gl::Context *context, bool *avai
 {
     ASSERT(available);
     ContextMtl *contextMtl = mtl::GetImpl(context);
-    // glGetQueryObjectuiv implicitly flush any pending works related to the query
+    // glGetQueryObjectuiv implicitly flushes any pending works related to the query, once it has
+    // been polled kResultAvailablePollsBeforeFlush times
     switch (getType())
     {
         case gl::QueryType::AnySamples:
@@ -166,6 +177,11 @@ angle::Result QueryMtl::isResultAvailable(const gl::Context *context, bool *avai
             ASSERT(mVisibilityResultBuffer);
             if (mVisibilityResultBuffer->hasPendingWorks(contextMtl))
             {
+                if (++mPendingResultAvailablePollCount < kResultAvailablePollsBeforeFlush)
+                {
+                    *available = false;
+                    break;
+                }
                 contextMtl->flushCommandBuffer(mtl::NoWait);
             }
 
@@ -23,6 +23,7 @@
 
 #include "common/FixedVector.h"
 #include "common/angleutils.h"
+#include "common/bitset_utils.h"
 #include "libANGLE/renderer/metal/mtl_common.h"
 #include "libANGLE/renderer/metal/mtl_resources.h"
 #include "libANGLE/renderer/metal/mtl_state_cache.h"
@@ -341,6 +342,9 @@ class IntermediateCommandStream
 
     inline bool good() const { return mReadPtr < mBuffer.size(); }
 
+    inline const uint8_t *data() const { return mBuffer.data(); }
+    inline size_t size() const { return mBuffer.size(); }
+
   private:
     std::vector<uint8_t> mBuffer;
     size_t mReadPtr = 0;
@@ -397,7 +401,8 @@ class RenderCommandEncoder final : public CommandEncoder
   public:
     RenderCommandEncoder(CommandBuffer *cmdBuffer,
                          const OcclusionQueryPool &queryPool,
-                         bool emulateDontCareLoadOpWithRandomClear);
+                         bool emulateDontCareLoadOpWithRandomClear,
+                         bool encodeInParallel);
     ~RenderCommandEncoder() override;
 
     // override CommandEncoder
@@ -596,6 +601,7 @@ class RenderCommandEncoder final : public CommandEncoder
                                  ObjCAttachmentDescriptor *objCRenderPassAttachment);
 
     void encodeMetalEncoder();
+    void encodeMetalEncoderInParallel();
     void simulateDiscardFramebuffer();
     void endEncodingImpl(bool considerDiscardSimulation);
 
@@ -604,6 +610,15 @@ class RenderCommandEncoder final : public CommandEncoder
                                           uint32_t offset,
                                           uint32_t index);
 
+    // Records the texture and sampler bindings changed since the last draw.
+    void flushPendingTexturesAndSamplers();
+
+    // Starts a new parallel encoding chunk once the current one has enough draws.  A chunk
+    // starts by recording the whole mStateCache, since it is replayed onto its own
+    // sub-encoder which starts with the default state.
+    void beginParallelChunkIfNeeded();
+    void resetParallelChunks();
+
     RenderPassDesc mRenderPassDesc;
     // Cached Objective-C render pass desc to avoid re-allocate every frame.
     mtl::AutoObjCObj<MTLRenderPassDescriptor> mCachedRenderPassDescObjC;
@@ -625,10 +640,31 @@ class RenderCommandEncoder final : public CommandEncoder
 
     RenderCommandEncoderStates mStateCache = {};
 
+    // Texture and sampler slots whose mStateCache value hasn't been recorded yet.  They are
+    // recorded right before the next draw, one command per run of consecutive slots, which
+    // becomes a single set*Textures:withRange: or set*SamplerStates:...withRange: call.
+    using ShaderSlotMask = angle::BitSet<kMaxShaderSamplers>;
+    gl::ShaderMap<ShaderSlotMask> mPendingTextures;
+    gl::ShaderMap<ShaderSlotMask> mPendingSamplers;
+
     bool mPipelineStateSet = false;
     uint64_t mSerial       = 0;
 
     const bool mEmulateDontCareLoadOpWithRandomClear;
+
+    // Render passes with more than kDrawsPerParallelChunk draws are split into chunks that are
+    // encoded onto the sub-encoders of an MTLParallelRenderCommandEncoder on worker threads.
+    static constexpr uint32_t kDrawsPerParallelChunk = 256;
+    const bool mEncodeInParallel;
+    // Cleared by commands that don't carry over to the next chunk's sub-encoder.
+    bool mCanEncodeInParallel = true;
+    uint32_t mDrawsInParallelChunk = 0;
+    // Stream offsets at which the second and later chunks start.
+    std::vector<size_t> mParallelChunkOffsets;
+    // setBytes() data isn't in mStateCache, so remember the commands that bound it to copy them
+    // into the next chunk.
+    gl::ShaderMap<angle::BitSet<kMaxShaderBuffers>> mBoundBytes;
+    gl::ShaderMap<std::array<size_t, kMaxShaderBuffers>> mBoundBytesCmdOffsets;
 };
 
 class BlitCommandEncoder final : public CommandEncoder
@@ -59,13 +59,13 @@ namespace
     PROC(SetVertexBuffer)                            \
     PROC(SetVertexBufferOffset)                      \
     PROC(SetVertexBytes)                             \
-    PROC(SetVertexSamplerState)                      \
-    PROC(SetVertexTexture)                           \
+    PROC(SetVertexSamplerStates)                     \
+    PROC(SetVertexTextures)                          \
     PROC(SetFragmentBuffer)                          \
     PROC(SetFragmentBufferOffset)                    \
     PROC(SetFragmentBytes)                           \
-    PROC(SetFragmentSamplerState)                    \
-    PROC(SetFragmentTexture)                         \
+    PROC(SetFragmentSamplerStates)                   \
+    PROC(SetFragmentTextures)                        \
     PROC(Draw)                                       \
     PROC(DrawInstanced)                              \
     PROC(DrawInstancedBaseInstance)                  \
@@ -88,6 +88,91 @@ enum class CmdType : uint8_t
     ANGLE_MTL_CMD_X(ANGLE_MTL_TYPE_DECL)
 };
 
+// Calls |recordRange(first, count)| for each run of consecutive slots in |slots|.
+template <typename SlotMask, typename RecordRangeFunc>
+void ForEachSlotRange(const SlotMask &slots, RecordRangeFunc &&recordRange)
+{
+    uint32_t first = 0;
+    uint32_t count = 0;
+    for (size_t slot : slots)
+    {
+        if (count > 0 && slot == first + count)
+        {
+            ++count;
+            continue;
+        }
+        if (count > 0)
+        {
+            recordRange(first, count);
+        }
+        first = static_cast<uint32_t>(slot);
+        count = 1;
+    }
+    if (count > 0)
+    {
+        recordRange(first, count);
+    }
+}
+
+// Fetches a range of retained textures recorded by flushPendingTexturesAndSamplers(), and
+// releases them once the command has been encoded.
+struct TextureRange
+{
+    explicit TextureRange(IntermediateCommandStream *stream)
+    {
+        uint32_t first = stream->fetch<uint32_t>();
+        count          = stream->fetch<uint32_t>();
+        ASSERT(first + count <= kMaxShaderSamplers);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            textures[i] = stream->fetch<id<MTLTexture>>();
+        }
+        range = NSMakeRange(first, count);
+    }
+    ~TextureRange()
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            [textures[i] ANGLE_MTL_RELEASE];
+        }
+    }
+
+    std::array<id<MTLTexture>, kMaxShaderSamplers> textures;
+    uint32_t count;
+    NSRange range;
+};
+
+// Same as TextureRange, for sampler states and their LOD clamps.
+struct SamplerStateRange
+{
+    explicit SamplerStateRange(IntermediateCommandStream *stream)
+    {
+        uint32_t first = stream->fetch<uint32_t>();
+        count          = stream->fetch<uint32_t>();
+        ASSERT(first + count <= kMaxShaderSamplers);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            states[i]       = stream->fetch<id<MTLSamplerState>>();
+            lodMinClamps[i] = stream->fetch<float>();
+            lodMaxClamps[i] = stream->fetch<float>();
+        }
+        range = NSMakeRange(first, count);
+    }
+    ~SamplerStateRange()
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            [states[i] ANGLE_MTL_RELEASE];
+        }
+    }
+
+    std::array<id<MTLSamplerState>, kMaxShaderSamplers> states;
+    std::array<float, kMaxShaderSamplers> lodMinClamps;
+    std::array<float, kMaxShaderSamplers> lodMaxClamps;
+    uint32_t count;
+    NSRange range;
+};
+
 // Commands decoder
 inline void InvalidCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
 {
@@ -203,28 +288,21 @@ inline void SetVertexBytesCmd(id<MTLRenderCommandEncoder> encoder,
     [encoder setVertexBytes:bytes length:size atIndex:index];
 }
 
-inline void SetVertexSamplerStateCmd(id<MTLRenderCommandEncoder> encoder,
-                                     IntermediateCommandStream *stream)
+inline void SetVertexSamplerStatesCmd(id<MTLRenderCommandEncoder> encoder,
+                                      IntermediateCommandStream *stream)
 {
-    id<MTLSamplerState> state = stream->fetch<id<MTLSamplerState>>();
-    float lodMinClamp         = stream->fetch<float>();
-    float lodMaxClamp         = stream->fetch<float>();
-    uint32_t index            = stream->fetch<uint32_t>();
-    [encoder setVertexSamplerState:state
-                       lodMinClamp:lodMinClamp
-                       lodMaxClamp:lodMaxClamp
-                           atIndex:index];
-
-    [state ANGLE_MTL_RELEASE];
+    SamplerStateRange range(stream);
+    [encoder setVertexSamplerStates:range.states.data()
+                       lodMinClamps:range.lodMinClamps.data()
+                       lodMaxClamps:range.lodMaxClamps.data()
+                          withRange:range.range];
 }
 
-inline void SetVertexTextureCmd(id<MTLRenderCommandEncoder> encoder,
-                                IntermediateCommandStream *stream)
+inline void SetVertexTexturesCmd(id<MTLRenderCommandEncoder> encoder,
+                                 IntermediateCommandStream *stream)
 {
-    id<MTLTexture> texture = stream->fetch<id<MTLTexture>>();
-    uint32_t index         = stream->fetch<uint32_t>();
-    [encoder setVertexTexture:texture atIndex:index];
-    [texture ANGLE_MTL_RELEASE];
+    TextureRange range(stream);
+    [encoder setVertexTextures:range.textures.data() withRange:range.range];
 }
 
 inline void SetFragmentBufferCmd(id<MTLRenderCommandEncoder> encoder,
@@ -254,27 +332,21 @@ inline void SetFragmentBytesCmd(id<MTLRenderCommandEncoder> encoder,
     [encoder setFragmentBytes:bytes length:size atIndex:index];
 }
 
-inline void SetFragmentSamplerStateCmd(id<MTLRenderCommandEncoder> encoder,
-                                       IntermediateCommandStream *stream)
+inline void SetFragmentSamplerStatesCmd(id<MTLRenderCommandEncoder> encoder,
+                                        IntermediateCommandStream *stream)
 {
-    id<MTLSamplerState> state = stream->fetch<id<MTLSamplerState>>();
-    float lodMinClamp         = stream->fetch<float>();
-    float lodMaxClamp         = stream->fetch<float>();
-    uint32_t index            = stream->fetch<uint32_t>();
-    [encoder setFragmentSamplerState:state
-                         lodMinClamp:lodMinClamp
-                         lodMaxClamp:lodMaxClamp
-                             atIndex:index];
-    [state ANGLE_MTL_RELEASE];
+    SamplerStateRange range(stream);
+    [encoder setFragmentSamplerStates:range.states.data()
+                         lodMinClamps:range.lodMinClamps.data()
+                         lodMaxClamps:range.lodMaxClamps.data()
+                            withRange:range.range];
 }
 
-inline void SetFragmentTextureCmd(id<MTLRenderCommandEncoder> encoder,
-                                  IntermediateCommandStream *stream)
+inline void SetFragmentTexturesCmd(id<MTLRenderCommandEncoder> encoder,
+                                   IntermediateCommandStream *stream)
 {
-    id<MTLTexture> texture = stream->fetch<id<MTLTexture>>();
-    uint32_t index         = stream->fetch<uint32_t>();
-    [encoder setFragmentTexture:texture atIndex:index];
-    [texture ANGLE_MTL_RELEASE];
+    TextureRange range(stream);
+    [encoder setFragmentTextures:range.textures.data() withRange:range.range];
 }
 
 inline void DrawCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
@@ -467,6 +539,23 @@ void RandomizeClearValue(ObjCAttachmentDescriptor *objCRenderPassAttachment)
     }
 }
 
+void EncodeCommands(id<MTLRenderCommandEncoder> metalCmdEncoder, IntermediateCommandStream *stream)
+{
+    while (stream->good())
+    {
+        CmdType cmdType = stream->fetch<CmdType>();
+        switch (cmdType)
+        {
+#define ANGLE_MTL_CMD_MAP(CMD)             \
+    case CmdType::CMD:                     \
+        CMD##Cmd(metalCmdEncoder, stream); \
+        break;
+            ANGLE_MTL_CMD_X(ANGLE_MTL_CMD_MAP)
+#undef ANGLE_MTL_CMD_MAP
+        }
+    }
+}
+
 }  // namespace
 
 // AtomicSerial implementation
@@ -1309,10 +1398,12 @@ void RenderCommandEncoderStates::reset()
 // RenderCommandEncoder implemtation
 RenderCommandEncoder::RenderCommandEncoder(CommandBuffer *cmdBuffer,
                                            const OcclusionQueryPool &queryPool,
-                                           bool emulateDontCareLoadOpWithRandomClear)
+                                           bool emulateDontCareLoadOpWithRandomClear,
+                                           bool encodeInParallel)
     : CommandEncoder(cmdBuffer, RENDER),
       mOcclusionQueryPool(queryPool),
-      mEmulateDontCareLoadOpWithRandomClear(emulateDontCareLoadOpWithRandomClear)
+      mEmulateDontCareLoadOpWithRandomClear(emulateDontCareLoadOpWithRandomClear),
+      mEncodeInParallel(encodeInParallel)
 {
     ANGLE_MTL_OBJC_SCOPE
     {
@@ -1339,12 +1430,12 @@ RenderCommandEncoder::RenderCommandEncoder(CommandBuffer *cmdBuffer,
     mSetBytesCmds[gl::ShaderType::Vertex]   = static_cast<uint8_t>(CmdType::SetVertexBytes);
     mSetBytesCmds[gl::ShaderType::Fragment] = static_cast<uint8_t>(CmdType::SetFragmentBytes);
 
-    mSetTextureCmds[gl::ShaderType::Vertex]   = static_cast<uint8_t>(CmdType::SetVertexTexture);
-    mSetTextureCmds[gl::ShaderType::Fragment] = static_cast<uint8_t>(CmdType::SetFragmentTexture);
+    mSetTextureCmds[gl::ShaderType::Vertex]   = static_cast<uint8_t>(CmdType::SetVertexTextures);
+    mSetTextureCmds[gl::ShaderType::Fragment] = static_cast<uint8_t>(CmdType::SetFragmentTextures);
 
-    mSetSamplerCmds[gl::ShaderType::Vertex] = static_cast<uint8_t>(CmdType::SetVertexSamplerState);
+    mSetSamplerCmds[gl::ShaderType::Vertex] = static_cast<uint8_t>(CmdType::SetVertexSamplerStates);
     mSetSamplerCmds[gl::ShaderType::Fragment] =
-        static_cast<uint8_t>(CmdType::SetFragmentSamplerState);
+        static_cast<uint8_t>(CmdType::SetFragmentSamplerStates);
 }
 RenderCommandEncoder::~RenderCommandEncoder() {}
 
@@ -1354,6 +1445,9 @@ void RenderCommandEncoder::reset()
     mRecording        = false;
     mPipelineStateSet = false;
     mCommands.clear();
+    mPendingTextures.fill(ShaderSlotMask());
+    mPendingSamplers.fill(ShaderSlotMask());
+    resetParallelChunks();
 }
 
 template <typename ObjCAttachmentDescriptor>
@@ -1499,7 +1593,14 @@ void RenderCommandEncoder::endEncodingImpl(bool considerDiscardSimulation)
         // Metal validation messages say: Either set rendertargets in RenderPassDescriptor or set
         // defaultRasterSampleCount.
         ASSERT(hasAttachment || objCRenderPassDesc.defaultRasterSampleCount != 0);
-        encodeMetalEncoder();
+        if (mCanEncodeInParallel && !mParallelChunkOffsets.empty())
+        {
+            encodeMetalEncoderInParallel();
+        }
+        else
+        {
+            encodeMetalEncoder();
+        }
     }
     else if (!hasSideEffects && hasDrawCalls())
     {
@@ -1527,6 +1628,9 @@ void RenderCommandEncoder::endEncodingImpl(bool considerDiscardSimulation)
     // reset state
     mRenderPassDesc = RenderPassDesc();
     mStateCache.reset();
+    mPendingTextures.fill(ShaderSlotMask());
+    mPendingSamplers.fill(ShaderSlotMask());
+    resetParallelChunks();
 }
 
 inline void RenderCommandEncoder::initAttachmentWriteDependencyAndScissorRect(
@@ -1632,20 +1736,56 @@ void RenderCommandEncoder::encodeMetalEncoder()
             metalCmdEncoder.label = mLabel;
         }
 
-        while (mCommands.good())
+        EncodeCommands(metalCmdEncoder, &mCommands);
+
+        mCommands.clear();
+    }
+}
+
+void RenderCommandEncoder::encodeMetalEncoderInParallel()
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        id<MTLParallelRenderCommandEncoder> parallelEncoder = [cmdBuffer().get()
+            parallelRenderCommandEncoderWithDescriptor:mCachedRenderPassDescObjC];
+
+        CommandEncoder::set(parallelEncoder);
+        ASSERT(parallelEncoder);
+
+        if (mLabel)
+        {
+            parallelEncoder.label = mLabel;
+        }
+
+        // Each chunk gets its own copy of the commands, since streams are read sequentially.
+        const size_t chunkCount = mParallelChunkOffsets.size() + 1;
+        std::vector<IntermediateCommandStream> chunks(chunkCount);
+        std::vector<id<MTLRenderCommandEncoder>> subEncoders(chunkCount);
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
         {
-            CmdType cmdType = mCommands.fetch<CmdType>();
-            switch (cmdType)
-            {
-#define ANGLE_MTL_CMD_MAP(CMD)                 \
-    case CmdType::CMD:                         \
-        CMD##Cmd(metalCmdEncoder, &mCommands); \
-        break;
-                ANGLE_MTL_CMD_X(ANGLE_MTL_CMD_MAP)
-#undef ANGLE_MTL_CMD_MAP
-            }
+            const size_t begin = chunk == 0 ? 0 : mParallelChunkOffsets[chunk - 1];
+            const size_t end =
+                chunk + 1 < chunkCount ? mParallelChunkOffsets[chunk] : mCommands.size();
+            chunks[chunk].push(mCommands.data() + begin, end - begin);
+
+            // Sub-encoders execute in the order they are created, regardless of which thread
+            // encodes them.
+            subEncoders[chunk] = [parallelEncoder renderCommandEncoder];
+            // Same iOS stencil reference workaround as encodeMetalEncoder().
+            [subEncoders[chunk] setStencilReferenceValue:0];
         }
 
+        std::vector<IntermediateCommandStream> *chunksPtr        = &chunks;
+        std::vector<id<MTLRenderCommandEncoder>> *subEncodersPtr = &subEncoders;
+        dispatch_apply(chunkCount, dispatch_get_global_queue(QOS_CLASS_USER_INTERACTIVE, 0),
+                       ^(size_t chunk) {
+                         ANGLE_MTL_OBJC_SCOPE
+                         {
+                             EncodeCommands((*subEncodersPtr)[chunk], &(*chunksPtr)[chunk]);
+                             [(*subEncodersPtr)[chunk] endEncoding];
+                         }
+                       });
+
         mCommands.clear();
     }
 }
@@ -1927,6 +2067,7 @@ RenderCommandEncoder &RenderCommandEncoder::commonSetBuffer(gl::ShaderType shade
 
     shaderStates.buffers[index]       = mtlBuffer;
     shaderStates.bufferOffsets[index] = offset;
+    mBoundBytes[shaderType].reset(index);
 
     mCommands.push(static_cast<CmdType>(mSetBufferCmds[shaderType]))
         .push([mtlBuffer ANGLE_MTL_RETAIN])
@@ -1950,6 +2091,12 @@ RenderCommandEncoder &RenderCommandEncoder::setBytes(gl::ShaderType shaderType,
     shaderStates.buffers[index]                    = nil;
     shaderStates.bufferOffsets[index]              = 0;
 
+    if (mEncodeInParallel)
+    {
+        mBoundBytes[shaderType].set(index);
+        mBoundBytesCmdOffsets[shaderType][index] = mCommands.size();
+    }
+
     mCommands.push(static_cast<CmdType>(mSetBytesCmds[shaderType]))
         .push(size)
         .push(bytes, size)
@@ -1982,12 +2129,7 @@ RenderCommandEncoder &RenderCommandEncoder::setSamplerState(gl::ShaderType shade
 
     shaderStates.samplers[index]         = state;
     shaderStates.samplerLodClamps[index] = {lodMinClamp, lodMaxClamp};
-
-    mCommands.push(static_cast<CmdType>(mSetSamplerCmds[shaderType]))
-        .push([state ANGLE_MTL_RETAIN])
-        .push(lodMinClamp)
-        .push(lodMaxClamp)
-        .push(index);
+    mPendingSamplers[shaderType].set(index);
 
     return *this;
 }
@@ -2011,10 +2153,7 @@ RenderCommandEncoder &RenderCommandEncoder::setTexture(gl::ShaderType shaderType
         return *this;
     }
     shaderStates.textures[index] = mtlTexture;
-
-    mCommands.push(static_cast<CmdType>(mSetTextureCmds[shaderType]))
-        .push([mtlTexture ANGLE_MTL_RETAIN])
-        .push(index);
+    mPendingTextures[shaderType].set(index);
 
     return *this;
 }
@@ -2032,6 +2171,147 @@ RenderCommandEncoder &RenderCommandEncoder::setRWTexture(gl::ShaderType shaderTy
     return setTexture(shaderType, texture, index);
 }
 
+void RenderCommandEncoder::flushPendingTexturesAndSamplers()
+{
+    for (gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        const RenderCommandEncoderShaderStates &shaderStates =
+            mStateCache.perShaderStates[shaderType];
+
+        ForEachSlotRange(mPendingTextures[shaderType], [&](uint32_t first, uint32_t count) {
+            mCommands.push(static_cast<CmdType>(mSetTextureCmds[shaderType]))
+                .push(first)
+                .push(count);
+            for (uint32_t index = first; index < first + count; ++index)
+            {
+                mCommands.push([shaderStates.textures[index] ANGLE_MTL_RETAIN]);
+            }
+        });
+
+        ForEachSlotRange(mPendingSamplers[shaderType], [&](uint32_t first, uint32_t count) {
+            mCommands.push(static_cast<CmdType>(mSetSamplerCmds[shaderType]))
+                .push(first)
+                .push(count);
+            for (uint32_t index = first; index < first + count; ++index)
+            {
+                const std::pair<float, float> &lodClamps =
+                    shaderStates.samplerLodClamps[index].value();
+                mCommands.push([shaderStates.samplers[index] ANGLE_MTL_RETAIN])
+                    .push(lodClamps.first)
+                    .push(lodClamps.second);
+            }
+        });
+
+        mPendingTextures[shaderType].reset();
+        mPendingSamplers[shaderType].reset();
+    }
+}
+
+void RenderCommandEncoder::beginParallelChunkIfNeeded()
+{
+    if (!mEncodeInParallel || !mCanEncodeInParallel ||
+        ++mDrawsInParallelChunk <= kDrawsPerParallelChunk)
+    {
+        return;
+    }
+    mDrawsInParallelChunk = 1;
+    mParallelChunkOffsets.push_back(mCommands.size());
+
+    if (mStateCache.renderPipeline)
+    {
+        mCommands.push(CmdType::SetRenderPipelineState)
+            .push([mStateCache.renderPipeline ANGLE_MTL_RETAIN]);
+    }
+    mCommands.push(CmdType::SetTriangleFillMode).push(mStateCache.triangleFillMode);
+    mCommands.push(CmdType::SetFrontFacingWinding).push(mStateCache.winding);
+    mCommands.push(CmdType::SetCullMode).push(mStateCache.cullMode);
+    if (mStateCache.depthStencilState)
+    {
+        mCommands.push(CmdType::SetDepthStencilState)
+            .push([mStateCache.depthStencilState ANGLE_MTL_RETAIN]);
+    }
+    mCommands.push(CmdType::SetDepthBias)
+        .push(mStateCache.depthBias)
+        .push(mStateCache.depthSlopeScale)
+        .push(mStateCache.depthClamp);
+    mCommands.push(CmdType::SetDepthClipMode).push(mStateCache.depthClipMode);
+    mCommands.push(CmdType::SetStencilRefVals)
+        .push(mStateCache.stencilFrontRef)
+        .push(mStateCache.stencilBackRef);
+    if (mStateCache.viewport.valid())
+    {
+        mCommands.push(CmdType::SetViewport).push(mStateCache.viewport.value());
+    }
+    if (mStateCache.scissorRect.valid())
+    {
+        mCommands.push(CmdType::SetScissorRect).push(mStateCache.scissorRect.value());
+    }
+    mCommands.push(CmdType::SetBlendColor)
+        .push(mStateCache.blendColor[0])
+        .push(mStateCache.blendColor[1])
+        .push(mStateCache.blendColor[2])
+        .push(mStateCache.blendColor[3]);
+    if (mStateCache.visibilityResultMode != MTLVisibilityResultModeDisabled)
+    {
+        mCommands.push(CmdType::SetVisibilityResultMode)
+            .push(mStateCache.visibilityResultMode)
+            .push(mStateCache.visibilityResultBufferOffset);
+    }
+
+    for (gl::ShaderType shaderType : {gl::ShaderType::Vertex, gl::ShaderType::Fragment})
+    {
+        const RenderCommandEncoderShaderStates &shaderStates =
+            mStateCache.perShaderStates[shaderType];
+
+        for (uint32_t index = 0; index < kMaxShaderBuffers; ++index)
+        {
+            if (shaderStates.buffers[index])
+            {
+                mCommands.push(static_cast<CmdType>(mSetBufferCmds[shaderType]))
+                    .push([shaderStates.buffers[index] ANGLE_MTL_RETAIN])
+                    .push(shaderStates.bufferOffsets[index])
+                    .push(index);
+            }
+        }
+
+        for (size_t index : mBoundBytes[shaderType])
+        {
+            // Copy the whole SetBytes command: type, size, data and index.
+            const size_t cmdOffset = mBoundBytesCmdOffsets[shaderType][index];
+            size_t size;
+            memcpy(&size, mCommands.data() + cmdOffset + sizeof(CmdType), sizeof(size));
+            const size_t cmdSize = sizeof(CmdType) + sizeof(size) + size + sizeof(uint32_t);
+
+            // The stream may be reallocated by the push.
+            std::vector<uint8_t> cmd(mCommands.data() + cmdOffset,
+                                     mCommands.data() + cmdOffset + cmdSize);
+            mBoundBytesCmdOffsets[shaderType][index] = mCommands.size();
+            mCommands.push(cmd.data(), cmd.size());
+        }
+
+        // Textures and samplers are recorded by the following flushPendingTexturesAndSamplers().
+        for (uint32_t index = 0; index < kMaxShaderSamplers; ++index)
+        {
+            if (shaderStates.textures[index])
+            {
+                mPendingTextures[shaderType].set(index);
+            }
+            if (shaderStates.samplers[index])
+            {
+                mPendingSamplers[shaderType].set(index);
+            }
+        }
+    }
+}
+
+void RenderCommandEncoder::resetParallelChunks()
+{
+    mCanEncodeInParallel  = true;
+    mDrawsInParallelChunk = 0;
+    mParallelChunkOffsets.clear();
+    mBoundBytes.fill(angle::BitSet<kMaxShaderBuffers>());
+}
+
 RenderCommandEncoder &RenderCommandEncoder::draw(MTLPrimitiveType primitiveType,
                                                  uint32_t vertexStart,
                                                  uint32_t vertexCount)
@@ -2039,6 +2319,8 @@ RenderCommandEncoder &RenderCommandEncoder::draw(MTLPrimitiveType primitiveType,
     ASSERT(mPipelineStateSet &&
            "Render Pipeline State was never set and we've issued a draw command.");
     CheckPrimitiveType(primitiveType);
+    beginParallelChunkIfNeeded();
+    flushPendingTexturesAndSamplers();
     mHasDrawCalls = true;
     mCommands.push(CmdType::Draw).push(primitiveType).push(vertexStart).push(vertexCount);
 
@@ -2053,6 +2335,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawInstanced(MTLPrimitiveType primi
     ASSERT(mPipelineStateSet &&
            "Render Pipeline State was never set and we've issued a draw command.");
     CheckPrimitiveType(primitiveType);
+    beginParallelChunkIfNeeded();
+    flushPendingTexturesAndSamplers();
     mHasDrawCalls = true;
     mCommands.push(CmdType::DrawInstanced)
         .push(primitiveType)
@@ -2073,6 +2357,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawInstancedBaseInstance(
     ASSERT(mPipelineStateSet &&
            "Render Pipeline State was never set and we've issued a draw command.");
     CheckPrimitiveType(primitiveType);
+    beginParallelChunkIfNeeded();
+    flushPendingTexturesAndSamplers();
     mHasDrawCalls = true;
     mCommands.push(CmdType::DrawInstancedBaseInstance)
         .push(primitiveType)
@@ -2098,6 +2384,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexed(MTLPrimitiveType primiti
         return *this;
     }
 
+    beginParallelChunkIfNeeded();
+    flushPendingTexturesAndSamplers();
     mHasDrawCalls = true;
     cmdBuffer().setReadDependency(indexBuffer, /*isRenderCommand=*/true);
 
@@ -2126,6 +2414,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexedInstanced(MTLPrimitiveTyp
         return *this;
     }
 
+    beginParallelChunkIfNeeded();
+    flushPendingTexturesAndSamplers();
     mHasDrawCalls = true;
     cmdBuffer().setReadDependency(indexBuffer, /*isRenderCommand=*/true);
 
@@ -2158,6 +2448,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexedInstancedBaseVertexBaseIn
         return *this;
     }
 
+    beginParallelChunkIfNeeded();
+    flushPendingTexturesAndSamplers();
     mHasDrawCalls = true;
     cmdBuffer().setReadDependency(indexBuffer, /*isRenderCommand=*/true);
 
@@ -2200,6 +2492,9 @@ RenderCommandEncoder &RenderCommandEncoder::useResource(const BufferRef &resourc
 
     cmdBuffer().setReadDependency(resource, /*isRenderCommand=*/true);
 
+    // Residency only applies to the sub-encoder the command is encoded in.
+    mCanEncodeInParallel = false;
+
     mCommands.push(CmdType::UseResource)
         .push([resource->get() ANGLE_MTL_RETAIN])
         .push(usage)
@@ -2212,6 +2507,7 @@ RenderCommandEncoder &RenderCommandEncoder::memoryBarrier(MTLBarrierScope scope,
                                                           MTLRenderStages after,
                                                           MTLRenderStages before)
 {
+    mCanEncodeInParallel = false;
     mCommands.push(CmdType::MemoryBarrier).push(scope).push(after).push(before);
     return *this;
 }
@@ -2227,6 +2523,7 @@ RenderCommandEncoder &RenderCommandEncoder::memoryBarrierWithResource(const Buff
 
     cmdBuffer().setWriteDependency(resource, /*isRenderCommand=*/true);
 
+    mCanEncodeInParallel = false;
     mCommands.push(CmdType::MemoryBarrierWithResource)
         .push([resource->get() ANGLE_MTL_RETAIN])
         .push(after)
@@ -2245,10 +2542,13 @@ void RenderCommandEncoder::pushDebugGroup(NSString *label)
 {
     // Defer the insertion until endEncoding()
     mCommands.push(CmdType::PushDebugGroup).push([label ANGLE_MTL_RETAIN]);
+    // Debug groups can't span sub-encoders.
+    mCanEncodeInParallel = false;
 }
 void RenderCommandEncoder::popDebugGroup()
 {
     mCommands.push(CmdType::PopDebugGroup);
+    mCanEncodeInParallel = false;
 }
 
 RenderCommandEncoder &RenderCommandEncoder::setColorStoreAction(MTLStoreAction action,
@@ -0,0 +1,56 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// mtl_heap_pool.h:
+//    Defines HeapPool, which suballocates private render target textures from MTLHeaps.
+//
+
+#ifndef LIBANGLE_RENDERER_METAL_MTL_HEAP_POOL_H_
+#define LIBANGLE_RENDERER_METAL_MTL_HEAP_POOL_H_
+
+#include <mutex>
+#include <vector>
+
+#include "libANGLE/renderer/metal/mtl_common.h"
+
+namespace rx
+{
+namespace mtl
+{
+
+class ContextDevice;
+
+// Render target textures are created and destroyed often (implicit multisample textures,
+// renderbuffers being reallocated on resize), and creating each one from the device has a
+// noticeable cost.  This pool places them in a few fixed size heaps instead.  The heaps track
+// hazards themselves, so heap textures are used exactly like device textures.  Shared by all
+// contexts of a display.
+class HeapPool : angle::NonCopyable
+{
+  public:
+    HeapPool();
+    ~HeapPool();
+
+    // Returns nil if |descriptor| isn't suitable for a heap or the heaps are full, in which case
+    // the texture should be created from the device.
+    AutoObjCPtr<id<MTLTexture>> newTextureWithDescriptor(const ContextDevice &device,
+                                                         MTLTextureDescriptor *descriptor);
+
+    void destroy();
+
+  private:
+    static constexpr NSUInteger kHeapSize = 32 * 1024 * 1024;
+    static constexpr size_t kMaxHeaps     = 4;
+    // Larger textures would fragment the heaps too quickly.
+    static constexpr NSUInteger kMaxTextureSize = kHeapSize / 4;
+
+    std::mutex mLock;
+    std::vector<AutoObjCPtr<id<MTLHeap>>> mHeaps;
+};
+
+}  // namespace mtl
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_METAL_MTL_HEAP_POOL_H_
@@ -0,0 +1,94 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// mtl_heap_pool.mm:
+//    Implements HeapPool.
+//
+
+#include "libANGLE/renderer/metal/mtl_heap_pool.h"
+
+#include "libANGLE/renderer/metal/mtl_context_device.h"
+
+namespace rx
+{
+namespace mtl
+{
+
+HeapPool::HeapPool() = default;
+
+HeapPool::~HeapPool()
+{
+    destroy();
+}
+
+AutoObjCPtr<id<MTLTexture>> HeapPool::newTextureWithDescriptor(const ContextDevice &device,
+                                                               MTLTextureDescriptor *descriptor)
+{
+    if (descriptor.storageMode != MTLStorageModePrivate)
+    {
+        return nil;
+    }
+
+    const MTLSizeAndAlign sizeAndAlign =
+        [device.get() heapTextureSizeAndAlignWithDescriptor:descriptor];
+    if (sizeAndAlign.size > kMaxTextureSize)
+    {
+        return nil;
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+
+    for (AutoObjCPtr<id<MTLHeap>> &heap : mHeaps)
+    {
+        if ([heap.get() maxAvailableSizeWithAlignment:sizeAndAlign.align] < sizeAndAlign.size)
+        {
+            continue;
+        }
+
+        auto texture = adoptObjCObj([heap.get() newTextureWithDescriptor:descriptor]);
+        if (texture)
+        {
+            device.setOwnerWithIdentity(texture);
+            return texture;
+        }
+    }
+
+    if (mHeaps.size() >= kMaxHeaps)
+    {
+        return nil;
+    }
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        auto heapDesc                     = adoptObjCObj([[MTLHeapDescriptor alloc] init]);
+        heapDesc.get().size               = kHeapSize;
+        heapDesc.get().storageMode        = MTLStorageModePrivate;
+        heapDesc.get().type               = MTLHeapTypeAutomatic;
+        heapDesc.get().hazardTrackingMode = MTLHazardTrackingModeTracked;
+
+        auto heap = adoptObjCObj([device.get() newHeapWithDescriptor:heapDesc]);
+        if (!heap)
+        {
+            return nil;
+        }
+        mHeaps.push_back(heap);
+
+        auto texture = adoptObjCObj([heap.get() newTextureWithDescriptor:descriptor]);
+        if (texture)
+        {
+            device.setOwnerWithIdentity(texture);
+        }
+        return texture;
+    }
+}
+
+void HeapPool::destroy()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    mHeaps.clear();
+}
+
+}  // namespace mtl
+}  // namespace rx
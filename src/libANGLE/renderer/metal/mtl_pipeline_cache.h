@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_METAL_MTL_PIPELINE_CACHE_H_
 #define LIBANGLE_RENDERER_METAL_MTL_PIPELINE_CACHE_H_
 
+#include <mutex>
+
 #include "common/hash_utils.h"
 #include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/renderer/metal/mtl_utils.h"
@@ -52,6 +54,40 @@ namespace rx
 namespace mtl
 {
 
+// An MTLBinaryArchive shared by all contexts of a display.  Render pipelines are looked up in it
+// before being compiled, and newly compiled pipelines are added to it.  The archive is loaded when
+// the display is initialized and written back when it is terminated.  Does nothing if the OS
+// doesn't support binary archives.
+class PipelineArchive : angle::NonCopyable
+{
+  public:
+    PipelineArchive();
+    ~PipelineArchive();
+
+    // Loads the archive at |path|, or starts an empty one if it can't be loaded.
+    void initialize(id<MTLDevice> device, const std::string &path);
+    // Writes the archive back to the path it was loaded from, if anything was added to it.
+    void serialize();
+    void destroy();
+
+    bool valid() const { return mArchive != nil; }
+
+    // Makes pipeline creation with |descriptor| look for the pipeline in the archive first.
+    void attachToDescriptor(MTLRenderPipelineDescriptor *descriptor) const;
+    // Adds the pipeline created from |descriptor| to the archive.
+    void addRenderPipeline(MTLRenderPipelineDescriptor *descriptor);
+
+  private:
+    // id<MTLBinaryArchive>, stored untyped since binary archives are not available on every OS
+    // version ANGLE supports.
+    AutoObjCPtr<id> mArchive;
+    AutoObjCPtr<NSURL *> mURL;
+    bool mHasNewPipelines;
+
+    // Guards additions to the archive, which can come from any context.
+    std::mutex mLock;
+};
+
 class PipelineCache : angle::NonCopyable
 {
   public:
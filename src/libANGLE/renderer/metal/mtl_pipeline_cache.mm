@@ -112,6 +112,8 @@ angle::Result CreateRenderPipelineState(ContextMtl *context,
 
         ANGLE_TRY(ValidateRenderPipelineState(context, objCDesc));
 
+        PipelineArchive &archive = context->getDisplay()->getPipelineArchive();
+
         // Special attribute slot for default attribute
         if (HasDefaultAttribs(key.pipelineDesc))
         {
@@ -124,6 +126,12 @@ angle::Result CreateRenderPipelineState(ContextMtl *context,
             [objCDesc.get().vertexDescriptor.layouts setObject:defaultAttribLayoutObjCDesc
                                             atIndexedSubscript:kDefaultAttribsBindingIndex];
         }
+
+        if (archive.valid())
+        {
+            archive.attachToDescriptor(objCDesc);
+        }
+
         // Create pipeline state
         NSError *err  = nil;
         auto newState = metalDevice.newRenderPipelineStateWithDescriptor(objCDesc, &err);
@@ -134,6 +142,11 @@ angle::Result CreateRenderPipelineState(ContextMtl *context,
             return angle::Result::Stop;
         }
 
+        if (archive.valid())
+        {
+            archive.addRenderPipeline(objCDesc);
+        }
+
         *outRenderPipeline = newState;
         return angle::Result::Continue;
     }
@@ -217,6 +230,110 @@ size_t PipelineKey::hash() const
     }
 }
 
+PipelineArchive::PipelineArchive() : mHasNewPipelines(false) {}
+
+PipelineArchive::~PipelineArchive()
+{
+    destroy();
+}
+
+void PipelineArchive::initialize(id<MTLDevice> device, const std::string &path)
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        if (@available(macOS 11.0, macCatalyst 14.0, iOS 14.0, tvOS 14.0, *))
+        {
+            mURL.retainAssign([NSURL fileURLWithPath:[NSString stringWithUTF8String:path.c_str()]]);
+
+            auto desc = adoptObjCObj([[MTLBinaryArchiveDescriptor alloc] init]);
+            if ([[NSFileManager defaultManager] fileExistsAtPath:mURL.get().path])
+            {
+                desc.get().url = mURL;
+            }
+
+            NSError *err = nil;
+            auto archive = adoptObjCObj([device newBinaryArchiveWithDescriptor:desc error:&err]);
+            if (err && desc.get().url)
+            {
+                // The archive is likely from an older OS or driver; start over with an empty one.
+                WARN() << "Ignoring pipeline archive " << path << ": "
+                       << FormatMetalErrorMessage(err);
+                desc.get().url = nil;
+                err            = nil;
+                archive = adoptObjCObj([device newBinaryArchiveWithDescriptor:desc error:&err]);
+            }
+            if (err)
+            {
+                WARN() << "Failed to create a pipeline archive: " << FormatMetalErrorMessage(err);
+                return;
+            }
+            mArchive.retainAssign(archive.get());
+        }
+    }
+}
+
+void PipelineArchive::serialize()
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (!mArchive || !mHasNewPipelines)
+        {
+            return;
+        }
+
+        if (@available(macOS 11.0, macCatalyst 14.0, iOS 14.0, tvOS 14.0, *))
+        {
+            id<MTLBinaryArchive> archive = mArchive.get();
+            NSError *err                 = nil;
+            if (![archive serializeToURL:mURL error:&err])
+            {
+                WARN() << "Failed to write the pipeline archive: " << FormatMetalErrorMessage(err);
+                return;
+            }
+            mHasNewPipelines = false;
+        }
+    }
+}
+
+void PipelineArchive::destroy()
+{
+    mArchive         = nil;
+    mURL             = nil;
+    mHasNewPipelines = false;
+}
+
+void PipelineArchive::attachToDescriptor(MTLRenderPipelineDescriptor *descriptor) const
+{
+    ASSERT(valid());
+    if (@available(macOS 11.0, macCatalyst 14.0, iOS 14.0, tvOS 14.0, *))
+    {
+        id<MTLBinaryArchive> archive = mArchive.get();
+        descriptor.binaryArchives    = @[ archive ];
+    }
+}
+
+void PipelineArchive::addRenderPipeline(MTLRenderPipelineDescriptor *descriptor)
+{
+    ASSERT(valid());
+    if (@available(macOS 11.0, macCatalyst 14.0, iOS 14.0, tvOS 14.0, *))
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+
+        id<MTLBinaryArchive> archive = mArchive.get();
+        NSError *err                 = nil;
+        if ([archive addRenderPipelineFunctionsWithDescriptor:descriptor error:&err])
+        {
+            mHasNewPipelines = true;
+        }
+        else
+        {
+            WARN() << "Failed to add a render pipeline to the archive: "
+                   << FormatMetalErrorMessage(err);
+        }
+    }
+}
+
 PipelineCache::PipelineCache() : mPipelineCache(kMaxPipelines) {}
 
 angle::Result PipelineCache::getRenderPipeline(
@@ -476,7 +476,16 @@ Texture::Texture(ContextMtl *context,
             desc.usage = desc.usage | MTLTextureUsagePixelFormatView;
         }
 
-        set(metalDevice.newTextureWithDescriptor(desc));
+        DisplayMtl *displayMtl = context->getDisplay();
+        if (renderTargetOnly && !memoryLess &&
+            displayMtl->getFeatures().useHeapsForRenderTargetTextures.enabled)
+        {
+            set(displayMtl->getRenderTargetHeapPool().newTextureWithDescriptor(metalDevice, desc));
+        }
+        if (!get())
+        {
+            set(metalDevice.newTextureWithDescriptor(desc));
+        }
 
         mCreationDesc.retainAssign(desc);
     }
@@ -9,6 +9,7 @@
 
 #include "libANGLE/renderer/renderer_utils.h"
 
+#include "common/WorkerThread.h"
 #include "common/base/anglebase/numerics/checked_math.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
@@ -321,6 +322,61 @@ void SetFloatUniformMatrixFast(unsigned int arrayElementOffset,
 
     memcpy(targetData, valueData, matrixSize * count);
 }
+
+// Levels with fewer destination pixels than this per band are not worth splitting.
+constexpr size_t kMinParallelMipGenerationPixelsPerBand = 64 * 1024;
+constexpr size_t kMaxParallelMipGenerationBandCount     = 8;
+
+class GenerateMipBandTask : public angle::Closure
+{
+  public:
+    GenerateMipBandTask(MipGenerationFunction mipGenerationFunction,
+                        size_t sourceWidth,
+                        size_t sourceDepth,
+                        const uint8_t *sourceData,
+                        size_t sourceRowPitch,
+                        size_t sourceDepthPitch,
+                        uint8_t *destData,
+                        size_t destRowPitch,
+                        size_t destDepthPitch,
+                        size_t destRowBegin,
+                        size_t destRowEnd)
+        : mMipGenerationFunction(mipGenerationFunction),
+          mSourceWidth(sourceWidth),
+          mSourceDepth(sourceDepth),
+          mSourceData(sourceData),
+          mSourceRowPitch(sourceRowPitch),
+          mSourceDepthPitch(sourceDepthPitch),
+          mDestData(destData),
+          mDestRowPitch(destRowPitch),
+          mDestDepthPitch(destDepthPitch),
+          mDestRowBegin(destRowBegin),
+          mDestRowEnd(destRowEnd)
+    {}
+
+    void operator()() override
+    {
+        // Each destination row is the average of two source rows, and a trailing odd source row is
+        // ignored, so a band of rows is generated by the same function as the whole level.
+        mMipGenerationFunction(mSourceWidth, (mDestRowEnd - mDestRowBegin) * 2, mSourceDepth,
+                               mSourceData + mDestRowBegin * 2 * mSourceRowPitch, mSourceRowPitch,
+                               mSourceDepthPitch, mDestData + mDestRowBegin * mDestRowPitch,
+                               mDestRowPitch, mDestDepthPitch);
+    }
+
+  private:
+    MipGenerationFunction mMipGenerationFunction;
+    size_t mSourceWidth;
+    size_t mSourceDepth;
+    const uint8_t *mSourceData;
+    size_t mSourceRowPitch;
+    size_t mSourceDepthPitch;
+    uint8_t *mDestData;
+    size_t mDestRowPitch;
+    size_t mDestDepthPitch;
+    size_t mDestRowBegin;
+    size_t mDestRowEnd;
+};
 }  // anonymous namespace
 
 bool IsRotatedAspectRatio(SurfaceRotation rotation)
@@ -381,6 +437,63 @@ void RotateRectangle(const SurfaceRotation rotation,
     }
 }
 
+void GenerateMipInParallel(angle::WorkerThreadPool *workerThreadPool,
+                           MipGenerationFunction mipGenerationFunction,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch)
+{
+    const size_t destWidth  = std::max<size_t>(1, sourceWidth >> 1);
+    const size_t destHeight = sourceHeight >> 1;
+    const size_t destDepth  = std::max<size_t>(1, sourceDepth >> 1);
+
+    const size_t bandCount =
+        std::min({destHeight, kMaxParallelMipGenerationBandCount,
+                  destWidth * destHeight * destDepth / kMinParallelMipGenerationPixelsPerBand});
+
+    if (workerThreadPool == nullptr || !workerThreadPool->isAsync() || bandCount < 2)
+    {
+        mipGenerationFunction(sourceWidth, sourceHeight, sourceDepth, sourceData, sourceRowPitch,
+                              sourceDepthPitch, destData, destRowPitch, destDepthPitch);
+        return;
+    }
+
+    std::vector<std::shared_ptr<GenerateMipBandTask>> tasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitableEvents;
+    tasks.reserve(bandCount);
+    waitableEvents.reserve(bandCount);
+
+    for (size_t band = 0; band < bandCount; ++band)
+    {
+        tasks.push_back(std::make_shared<GenerateMipBandTask>(
+            mipGenerationFunction, sourceWidth, sourceDepth, sourceData, sourceRowPitch,
+            sourceDepthPitch, destData, destRowPitch, destDepthPitch,
+            destHeight * band / bandCount, destHeight * (band + 1) / bandCount));
+    }
+
+    // Post all but the first band to the worker threads; the first one is generated on this
+    // thread.
+    for (size_t band = 1; band < bandCount; ++band)
+    {
+        std::shared_ptr<angle::WaitableEvent> waitableEvent =
+            workerThreadPool->postWorkerTask(tasks[band]);
+        if (waitableEvent == nullptr)
+        {
+            (*tasks[band])();
+            continue;
+        }
+        waitableEvents.push_back(std::move(waitableEvent));
+    }
+    (*tasks[0])();
+    angle::WaitableEvent::WaitMany(&waitableEvents);
+}
+
 PackPixelsParams::PackPixelsParams()
     : destFormat(nullptr),
       outputPitch(0),
@@ -1028,7 +1141,7 @@ BufferAndLayout::BufferAndLayout() = default;
 BufferAndLayout::~BufferAndLayout() = default;
 
 template <typename T>
-void UpdateBufferWithLayout(GLsizei count,
+bool UpdateBufferWithLayout(GLsizei count,
                             uint32_t arrayIndex,
                             int componentCount,
                             const T *v,
@@ -1043,11 +1156,20 @@ void UpdateBufferWithLayout(GLsizei count,
         uint32_t arrayOffset = arrayIndex * layoutInfo.arrayStride;
         uint8_t *writePtr    = dst + arrayOffset;
         ASSERT(writePtr + (elementSize * count) <= uniformData->data() + uniformData->size());
+
+        // Applications frequently set uniforms to the values they already have; avoid dirtying
+        // the block in that case.
+        if (memcmp(writePtr, v, elementSize * count) == 0)
+        {
+            return false;
+        }
         memcpy(writePtr, v, elementSize * count);
+        return true;
     }
     else
     {
         // Have to respect the arrayStride between each element of the array.
+        bool changed = false;
         int maxIndex = arrayIndex + count;
         for (int writeIndex = arrayIndex, readIndex = 0; writeIndex < maxIndex;
              writeIndex++, readIndex++)
@@ -1056,8 +1178,13 @@ void UpdateBufferWithLayout(GLsizei count,
             uint8_t *writePtr     = dst + arrayOffset;
             const T *readPtr      = v + (readIndex * componentCount);
             ASSERT(writePtr + elementSize <= uniformData->data() + uniformData->size());
-            memcpy(writePtr, readPtr, elementSize);
+            if (memcmp(writePtr, readPtr, elementSize) != 0)
+            {
+                memcpy(writePtr, readPtr, elementSize);
+                changed = true;
+            }
         }
+        return changed;
     }
 }
 
@@ -1115,9 +1242,11 @@ void SetUniform(const gl::ProgramExecutable *executable,
             }
 
             const GLint componentCount = linkedUniform.getElementComponents();
-            UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v, layoutInfo,
-                                   &uniformBlock.uniformData);
-            defaultUniformBlocksDirty->set(shaderType);
+            if (UpdateBufferWithLayout(count, locationInfo.arrayIndex, componentCount, v,
+                                       layoutInfo, &uniformBlock.uniformData))
+            {
+                defaultUniformBlocksDirty->set(shaderType);
+            }
         }
     }
     else
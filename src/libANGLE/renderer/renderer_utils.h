@@ -26,6 +26,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 struct ImageLoadContext;
+class WorkerThreadPool;
 enum class FormatID;
 }  // namespace angle
 
@@ -90,6 +91,20 @@ using MipGenerationFunction = void (*)(size_t sourceWidth,
                                        size_t destRowPitch,
                                        size_t destDepthPitch);
 
+// Generates a mip level with mipGenerationFunction.  Large levels are split in bands of rows that
+// are generated in parallel by the workerThreadPool, if it is asynchronous.
+void GenerateMipInParallel(angle::WorkerThreadPool *workerThreadPool,
+                           MipGenerationFunction mipGenerationFunction,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch);
+
 typedef void (*PixelReadFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*PixelWriteFunction)(const uint8_t *source, uint8_t *dest);
 typedef void (*FastCopyFunction)(const uint8_t *source,
@@ -288,8 +303,9 @@ struct BufferAndLayout final : private angle::NonCopyable
     std::vector<sh::BlockMemberInfo> uniformLayout;
 };
 
+// Returns whether the contents of |uniformData| were changed by the update.
 template <typename T>
-void UpdateBufferWithLayout(GLsizei count,
+bool UpdateBufferWithLayout(GLsizei count,
                             uint32_t arrayIndex,
                             int componentCount,
                             const T *v,
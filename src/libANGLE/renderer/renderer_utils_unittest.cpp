@@ -0,0 +1,71 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// renderer_utils_unittest:
+//   Unit tests for the renderer utils.
+//
+
+#include <gtest/gtest.h>
+
+#include "common/WorkerThread.h"
+#include "image_util/generatemip.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+namespace rx
+{
+namespace
+{
+void TestGenerateMipInParallel(angle::WorkerThreadPool *pool,
+                               size_t sourceWidth,
+                               size_t sourceHeight,
+                               size_t sourceDepth)
+{
+    const size_t pixelBytes       = sizeof(angle::R8G8B8A8);
+    const size_t sourceRowPitch   = sourceWidth * pixelBytes;
+    const size_t sourceDepthPitch = sourceRowPitch * sourceHeight;
+    const size_t destWidth        = std::max<size_t>(1, sourceWidth >> 1);
+    const size_t destHeight       = std::max<size_t>(1, sourceHeight >> 1);
+    const size_t destDepth        = std::max<size_t>(1, sourceDepth >> 1);
+    const size_t destRowPitch     = destWidth * pixelBytes;
+    const size_t destDepthPitch   = destRowPitch * destHeight;
+
+    std::vector<uint8_t> source(sourceDepthPitch * sourceDepth);
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+        source[i] = static_cast<uint8_t>(i * 7 + i / 13);
+    }
+
+    std::vector<uint8_t> expected(destDepthPitch * destDepth);
+    angle::GenerateMip<angle::R8G8B8A8>(sourceWidth, sourceHeight, sourceDepth, source.data(),
+                                        sourceRowPitch, sourceDepthPitch, expected.data(),
+                                        destRowPitch, destDepthPitch);
+
+    std::vector<uint8_t> actual(destDepthPitch * destDepth);
+    GenerateMipInParallel(pool, angle::GenerateMip<angle::R8G8B8A8>, sourceWidth, sourceHeight,
+                          sourceDepth, source.data(), sourceRowPitch, sourceDepthPitch,
+                          actual.data(), destRowPitch, destDepthPitch);
+
+    EXPECT_EQ(expected, actual);
+}
+
+// Tests that generating a mip level in parallel bands matches generating it in one go.
+TEST(RendererUtilsTest, GenerateMipInParallel)
+{
+    std::shared_ptr<angle::WorkerThreadPool> pools[] = {
+        angle::WorkerThreadPool::Create(1, ANGLEPlatformCurrent()),
+        angle::WorkerThreadPool::Create(4, ANGLEPlatformCurrent())};
+
+    for (std::shared_ptr<angle::WorkerThreadPool> &pool : pools)
+    {
+        TestGenerateMipInParallel(pool.get(), 1024, 1024, 1);
+        TestGenerateMipInParallel(pool.get(), 1025, 1023, 1);
+        TestGenerateMipInParallel(pool.get(), 1, 4096, 1);
+        TestGenerateMipInParallel(pool.get(), 4096, 1, 1);
+        TestGenerateMipInParallel(pool.get(), 256, 257, 9);
+        TestGenerateMipInParallel(pool.get(), 3, 3, 1);
+    }
+}
+}  // anonymous namespace
+}  // namespace rx
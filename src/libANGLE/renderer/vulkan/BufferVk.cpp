@@ -58,6 +58,10 @@ constexpr VkMemoryPropertyFlags kHostCachedNonCoherentFlags =
 constexpr size_t kBufferSizeGranularity = 4;
 static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be power of two");
 
+// Number of glBufferSubData calls to a buffer that is not host visible after which it is given
+// host visible memory by glBufferData.
+constexpr uint32_t kSubDataUpdatesBeforeHostVisibleMemory = 16;
+
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
 
@@ -289,6 +293,12 @@ angle::Result CopyBuffers(ContextVk *contextVk,
     {
         access.onBufferSelfCopy(srcBuffer);
     }
+    else if (regionCount == 1)
+    {
+        // Streaming updates to different ranges of the buffer can then share the command buffer.
+        access.onBufferTransferRead(srcBuffer);
+        access.onBufferTransferWrite(dstBuffer, copyRegions[0].dstOffset, copyRegions[0].size);
+    }
     else
     {
         access.onBufferTransferRead(srcBuffer);
@@ -376,7 +386,8 @@ BufferVk::BufferVk(const gl::BufferState &state)
       mIsStagingBufferMapped(false),
       mHasValidData(false),
       mIsMappedForWrite(false),
-      mUsageType(BufferUsageType::Static)
+      mUsageType(BufferUsageType::Static),
+      mNonHostVisibleSubDataUpdateCount(0)
 {
     mMappedRange.invalidate();
 }
@@ -404,6 +415,7 @@ angle::Result BufferVk::release(ContextVk *contextVk)
     vk::Renderer *renderer = contextVk->getRenderer();
     if (mBuffer.valid())
     {
+        contextVk->getShareGroup()->onBufferRelease(this);
         ANGLE_TRY(contextVk->releaseBufferAllocation(&mBuffer));
     }
     if (mStagingBuffer.valid())
@@ -497,6 +509,16 @@ angle::Result BufferVk::setData(const gl::Context *context,
     // Assume host visible/coherent memory available.
     VkMemoryPropertyFlags memoryPropertyFlags =
         GetPreferredMemoryType(contextVk->getRenderer(), target, usage);
+
+    // Applications often use static usage for buffers they keep updating.  Each of these updates
+    // goes through a GPU copy if the memory is not host visible, so once that has been observed
+    // enough, make the memory host visible, preferably still device local.
+    if ((memoryPropertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) == 0 &&
+        mNonHostVisibleSubDataUpdateCount >= kSubDataUpdatesBeforeHostVisibleMemory)
+    {
+        memoryPropertyFlags = kDeviceLocalHostCoherentFlags;
+    }
+
     return setDataWithMemoryType(context, target, data, size, memoryPropertyFlags, usage);
 }
 
@@ -577,6 +599,12 @@ angle::Result BufferVk::setSubData(const gl::Context *context,
     BufferDataSource dataSource = {};
     dataSource.data             = data;
 
+    if (!mBuffer.isHostVisible() &&
+        mNonHostVisibleSubDataUpdateCount < kSubDataUpdatesBeforeHostVisibleMemory)
+    {
+        ++mNonHostVisibleSubDataUpdateCount;
+    }
+
     ContextVk *contextVk = vk::GetImpl(context);
     return setDataImpl(contextVk, static_cast<size_t>(mState.getSize()), dataSource, size, offset,
                        BufferUpdateType::ContentsUpdate);
@@ -1070,8 +1098,9 @@ angle::Result BufferVk::stagedUpdate(ContextVk *contextVk,
         }
         else
         {
+            const VkDeviceSize dstOffset = static_cast<VkDeviceSize>(offset) + mBuffer.getOffset();
             access.onBufferTransferRead(dataSource.buffer);
-            access.onBufferTransferWrite(&mBuffer);
+            access.onBufferTransferWrite(&mBuffer, dstOffset, static_cast<VkDeviceSize>(size));
         }
 
         vk::OutsideRenderPassCommandBuffer *commandBuffer;
@@ -1322,6 +1351,7 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk,
     // Allocate the buffer directly
     ANGLE_TRY(
         contextVk->initBufferAllocation(&mBuffer, mMemoryTypeIndex, size, alignment, usageType));
+    contextVk->getShareGroup()->onBufferAllocate(this);
 
     // Tell the observers (front end) that a new buffer was created, so the necessary
     // dirty bits can be set. This allows the buffer views pointing to the old buffer to
@@ -1337,6 +1367,31 @@ bool BufferVk::isCurrentlyInUse(vk::Renderer *renderer) const
     return !renderer->hasResourceUseFinished(mBuffer.getResourceUse());
 }
 
+bool BufferVk::canRelocate(vk::Renderer *renderer) const
+{
+    return isInEvacuatingBufferBlock() && !isExternalBuffer() && !mState.isMapped() &&
+           !isCurrentlyInUse(renderer);
+}
+
+angle::Result BufferVk::relocate(ContextVk *contextVk)
+{
+    ASSERT(canRelocate(contextVk->getRenderer()));
+
+    // acquireBufferHelper() allocates from a block that is not being evacuated, and notifies the
+    // observers so that descriptor sets and vertex bindings are updated to the new buffer.
+    vk::BufferHelper prevBuffer = std::move(mBuffer);
+    ANGLE_TRY(acquireBufferHelper(contextVk, static_cast<size_t>(mState.getSize()), mUsageType));
+
+    if (mHasValidData)
+    {
+        VkBufferCopy copyRegion = {prevBuffer.getOffset(), mBuffer.getOffset(),
+                                   std::min(prevBuffer.getSize(), mBuffer.getSize())};
+        ANGLE_TRY(CopyBuffers(contextVk, &prevBuffer, &mBuffer, 1, &copyRegion));
+    }
+
+    return contextVk->releaseBufferAllocation(&prevBuffer);
+}
+
 // When a buffer is being completely changed, calculate whether it's better to allocate a new buffer
 // or overwrite the existing one.
 BufferUpdateType BufferVk::calculateBufferUpdateTypeOnFullUpdate(
@@ -211,6 +211,16 @@ class BufferVk : public BufferImpl
     bool isBufferValid() const { return mBuffer.valid(); }
     bool isCurrentlyInUse(vk::Renderer *renderer) const;
 
+    // Used to move the buffer out of a BufferBlock that is being evacuated.  Only GPU-idle buffers
+    // that are not mapped are relocated, as no other context can then have pending commands
+    // referencing the old allocation.
+    bool isInEvacuatingBufferBlock() const
+    {
+        return mBuffer.valid() && mBuffer.getBufferBlock()->isEvacuating();
+    }
+    bool canRelocate(vk::Renderer *renderer) const;
+    angle::Result relocate(ContextVk *contextVk);
+
     angle::Result mapImpl(ContextVk *contextVk, GLbitfield access, void **mapPtr);
     angle::Result mapRangeImpl(ContextVk *contextVk,
                                VkDeviceSize offset,
@@ -324,6 +334,9 @@ class BufferVk : public BufferImpl
     bool mIsMappedForWrite;
     // True if usage is dynamic. May affect how we allocate memory.
     BufferUsageType mUsageType;
+    // Number of glBufferSubData calls made while the buffer was not host visible. Used to give
+    // frequently updated buffers host visible memory regardless of their usage hint.
+    uint32_t mNonHostVisibleSubDataUpdateCount;
     // Similar as mIsMappedForWrite, this maybe different from mState's getMapOffset/getMapLength if
     // mapped from angle internal.
     RangeDeviceSize mMappedRange;
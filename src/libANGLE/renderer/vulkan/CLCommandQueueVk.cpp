@@ -40,7 +40,10 @@
 #include "spirv/unified1/NonSemanticClspvReflection.h"
 #include "vulkan/vulkan_core.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cstdlib>
+#include <limits>
 
 namespace rx
 {
@@ -51,6 +54,37 @@ static constexpr size_t kTimeoutInMS            = 10000;
 static constexpr size_t kSleepInMS              = 500;
 static constexpr size_t kTimeoutCheckIterations = kTimeoutInMS / kSleepInMS;
 
+// Non-blocking commands are accumulated and submitted together, at the latest once this many are
+// pending or once the first of them has been pending for this long, so that the device doesn't
+// idle until the next flush.  Overridable with ANGLE_CL_MAX_PENDING_COMMANDS and
+// ANGLE_CL_MAX_PENDING_TIME_US, where 0 disables the threshold.
+static constexpr uint32_t kDefaultMaxPendingCommands = 64;
+static constexpr uint32_t kDefaultMaxPendingTimeUs   = 1000;
+
+struct SubmitThresholds
+{
+    uint32_t maxPendingCommands;
+    std::chrono::microseconds maxPendingTime;
+};
+
+uint32_t GetSubmitThreshold(const char *varName, const char *propertyName, uint32_t defaultValue)
+{
+    std::string value = angle::GetEnvironmentVarOrAndroidProperty(varName, propertyName);
+    return value.empty() ? defaultValue
+                         : static_cast<uint32_t>(std::strtoul(value.c_str(), nullptr, 10));
+}
+
+const SubmitThresholds &GetSubmitThresholds()
+{
+    static const SubmitThresholds kThresholds = {
+        GetSubmitThreshold("ANGLE_CL_MAX_PENDING_COMMANDS", "angle.cl_max_pending_commands",
+                           kDefaultMaxPendingCommands),
+        std::chrono::microseconds(GetSubmitThreshold("ANGLE_CL_MAX_PENDING_TIME_US",
+                                                     "angle.cl_max_pending_time_us",
+                                                     kDefaultMaxPendingTimeUs))};
+    return kThresholds;
+}
+
 angle::Result SetEventsWithQueueSerialToState(const cl::EventPtrs &eventList,
                                               const QueueSerial &queueSerial,
                                               cl::ExecutionStatus state)
@@ -69,6 +103,70 @@ angle::Result SetEventsWithQueueSerialToState(const cl::EventPtrs &eventList,
     return angle::Result::Continue;
 }
 
+// The kernel arguments descriptor set is reused whenever a kernel is enqueued again with the same
+// memory objects and samplers.  They are identified by their serials, which are never reused.
+// Returns false if an argument can't be identified that way.
+bool GetKernelArgumentsDescriptorSetDesc(const CLKernelArguments &args,
+                                         vk::DescriptorSetDesc *descOut)
+{
+    descOut->resize(args.size());
+    for (size_t index = 0; index < args.size(); index++)
+    {
+        const CLKernelArgument &arg      = args.at(index);
+        vk::DescriptorInfoDesc &infoDesc = descOut->getInfoDesc(static_cast<uint32_t>(index));
+        infoDesc                         = {};
+        switch (arg.type)
+        {
+            case NonSemanticClspvReflectionArgumentUniform:
+            case NonSemanticClspvReflectionArgumentStorageBuffer:
+            {
+                cl::Memory *clMem     = cl::Buffer::Cast(*static_cast<const cl_mem *>(arg.handle));
+                const uint64_t offset = clMem->getOffset();
+                const uint64_t size   = clMem->getSize();
+                ASSERT((offset >> 48) == 0 && (size >> 48) == 0);
+                infoDesc.samplerOrBufferSerial =
+                    clMem->getImpl<CLBufferVk>().getBuffer().getBufferSerial().getValue();
+                infoDesc.imageViewSerialOrOffset = static_cast<uint32_t>(offset);
+                infoDesc.imageLayoutOrRange      = static_cast<uint32_t>(size);
+                infoDesc.imageSubresourceRange =
+                    static_cast<uint32_t>((offset >> 32) << 16 | (size >> 32));
+                break;
+            }
+            case NonSemanticClspvReflectionArgumentSampler:
+            {
+                cl::Sampler *clSampler =
+                    cl::Sampler::Cast(*static_cast<const cl_sampler *>(arg.handle));
+                infoDesc.samplerOrBufferSerial = clSampler->getImpl<CLSamplerVk>()
+                                                     .getSamplerHelper()
+                                                     .getSamplerSerial()
+                                                     .getValue();
+                break;
+            }
+            case NonSemanticClspvReflectionArgumentStorageImage:
+            case NonSemanticClspvReflectionArgumentSampledImage:
+            {
+                cl::Memory *clMem = cl::Image::Cast(*static_cast<const cl_mem *>(arg.handle));
+                CLImageVk &vkMem  = clMem->getImpl<CLImageVk>();
+                if (!vkMem.getImage().valid())
+                {
+                    return false;
+                }
+                // The layout is left out, as images are always transitioned to the same layout
+                // before their descriptors are written.
+                infoDesc.imageViewSerialOrOffset = vkMem.getImage().getImageSerial().getValue();
+                break;
+            }
+            case NonSemanticClspvReflectionArgumentPodPushConstant:
+                // Not part of the descriptor set
+                break;
+            default:
+                // Texel buffer views don't have serials
+                return false;
+        }
+    }
+    return true;
+}
+
 DispatchWorkThread::DispatchWorkThread(CLCommandQueueVk *commandQueue)
     : mCommandQueue(commandQueue),
       mIsTerminating(false),
@@ -178,6 +276,8 @@ CLCommandQueueVk::CLCommandQueueVk(const cl::CommandQueue &commandQueue)
       mPrintfBuffer(nullptr),
       mComputePassCommands(nullptr),
       mQueueSerialIndex(kInvalidQueueSerialIndex),
+      mBarrierCount(0),
+      mPendingCommandCount(0),
       mNeedPrintfHandling(false),
       mPrintfInfos(nullptr),
       mFinishHandler(this)
@@ -261,7 +361,7 @@ angle::Result CLCommandQueueVk::enqueueReadBuffer(const cl::Buffer &buffer,
 
     if (blocking)
     {
-        ANGLE_TRY(finishInternal());
+        ANGLE_TRY(finishBufferWrites(*bufferVk, waitEvents));
         ANGLE_TRY(bufferVk->copyTo(ptr, offset, size));
 
         ANGLE_TRY(createEvent(eventCreateFunc, cl::ExecutionStatus::Complete));
@@ -347,7 +447,7 @@ angle::Result CLCommandQueueVk::enqueueReadBufferRect(const cl::Buffer &buffer,
 
     if (blocking)
     {
-        ANGLE_TRY(finishInternal());
+        ANGLE_TRY(finishBufferWrites(*bufferVk, waitEvents));
         ANGLE_TRY(bufferVk->getRect(bufferRect, ptrRect, ptr));
     }
     else
@@ -512,7 +612,8 @@ angle::Result CLCommandQueueVk::enqueueFillBuffer(const cl::Buffer &buffer,
     ANGLE_TRY(processWaitlist(waitEvents));
 
     CLBufferVk *bufferVk = &buffer.getImpl<CLBufferVk>();
-    if (mComputePassCommands->usesBuffer(bufferVk->getBuffer()))
+    // The batches flushed on a hazard but not submitted yet may use the buffer too
+    if (mComputePassCommands->usesBuffer(bufferVk->getBuffer()) || hasCommandsPendingSubmission())
     {
         ANGLE_TRY(finishInternal());
     }
@@ -550,7 +651,10 @@ angle::Result CLCommandQueueVk::enqueueMapBuffer(const cl::Buffer &buffer,
     {
         ANGLE_TRY(finishInternal());
         mapPointer = static_cast<uint8_t *>(buffer.getHostPtr()) + offset;
-        ANGLE_TRY(bufferVk->copyTo(mapPointer, offset, size));
+        if (!bufferVk->isHostPtrImported())
+        {
+            ANGLE_TRY(bufferVk->copyTo(mapPointer, offset, size));
+        }
         eventComplete = cl::ExecutionStatus::Complete;
     }
     else
@@ -659,12 +763,7 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
     {
         // TODO(aannestrand): Look into combining these kernel execution barriers
         // http://anglebug.com/377545840
-        VkMemoryBarrier memoryBarrier = {VK_STRUCTURE_TYPE_MEMORY_BARRIER, nullptr,
-                                         VK_ACCESS_SHADER_WRITE_BIT,
-                                         VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT};
-        mComputePassCommands->getCommandBuffer().pipelineBarrier(
-            VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
-            &memoryBarrier, 0, nullptr, 0, nullptr);
+        ANGLE_TRY(insertBarrier());
     }
 
     // Enqueue blit/transfer cmd
@@ -686,6 +785,7 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
             mComputePassCommands->getCommandBuffer().copyBuffer(
                 transferBufferHandleVk.getBuffer().getBuffer(), srcBuffer->getBuffer().getBuffer(),
                 1, &copyRegion);
+            onBufferWrite(srcBuffer->getBuffer());
 
             srcStageMask             = VK_PIPELINE_STAGE_TRANSFER_BIT;
             dstStageMask             = VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
@@ -706,6 +806,7 @@ angle::Result CLCommandQueueVk::addToHostTransferList(CLBufferVk *srcBuffer,
                     transferBufferHandleVk.getBuffer().getBuffer(),
                     srcBuffer->getBuffer().getBuffer(), 1, &copyRegion);
             }
+            onBufferWrite(srcBuffer->getBuffer());
 
             // Config transfer barrier
             srcStageMask             = VK_PIPELINE_STAGE_TRANSFER_BIT;
@@ -1131,7 +1232,10 @@ angle::Result CLCommandQueueVk::enqueueUnmapMemObject(const cl::Memory &memory,
         if (memory.getFlags().intersects(CL_MEM_USE_HOST_PTR))
         {
             ANGLE_TRY(finishInternal());
-            ANGLE_TRY(bufferVk.copyFrom(memory.getHostPtr(), 0, bufferVk.getSize()));
+            if (!bufferVk.isHostPtrImported())
+            {
+                ANGLE_TRY(bufferVk.copyFrom(memory.getHostPtr(), 0, bufferVk.getSize()));
+            }
             eventComplete = cl::ExecutionStatus::Complete;
         }
     }
@@ -1315,6 +1419,11 @@ angle::Result CLCommandQueueVk::insertBarrier()
         VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, 0, 1,
         &memoryBarrier, 0, nullptr, 0, nullptr);
 
+    // The barrier resolves the hazards with the kernels enqueued so far.
+    mReadDependencyTracker.clear();
+    mWriteDependencyTracker.clear();
+    ++mBarrierCount;
+
     return angle::Result::Continue;
 }
 
@@ -1393,28 +1502,51 @@ angle::Result CLCommandQueueVk::syncHostBuffers(HostTransferEntries &hostTransfe
     return angle::Result::Continue;
 }
 
-angle::Result CLCommandQueueVk::addMemoryDependencies(cl::Memory *clMem)
+angle::Result CLCommandQueueVk::addMemoryDependencies(cl::Memory *clMem, MemoryAccess access)
 {
     cl::Memory *parentMem = clMem->getParent() ? clMem->getParent().get() : nullptr;
 
     // Take an usage count
     mCommandsStateMap[mComputePassCommands->getQueueSerial()].memories.emplace_back(clMem);
 
-    // Handle possible resource RAW hazard
-    bool insertBarrier = false;
-    if (clMem->getFlags().intersects(CL_MEM_READ_WRITE))
+    // Handle possible resource RAW, WAR and WAW hazards with the kernels enqueued since the last
+    // barrier.  Kernels can't write to read-only memory, and the transfers to it are synchronized
+    // on their own.  The commands of out-of-order queues only depend on the events they wait on,
+    // which are handled by processWaitlist().
+    bool hasHazard = false;
+    if (!isOutOfOrder() && !clMem->getFlags().intersects(CL_MEM_READ_ONLY))
     {
         // Texel buffers have backing buffer obects
-        if (mDependencyTracker.contains(clMem) || mDependencyTracker.contains(parentMem) ||
-            mDependencyTracker.size() == kMaxDependencyTrackerSize)
+        auto isTracked = [clMem, parentMem](const angle::HashSet<cl::Object *> &tracker) {
+            return tracker.contains(clMem) || (parentMem != nullptr && tracker.contains(parentMem));
+        };
+        hasHazard = isTracked(mWriteDependencyTracker) ||
+                    (access == MemoryAccess::Write && isTracked(mReadDependencyTracker)) ||
+                    mReadDependencyTracker.size() + mWriteDependencyTracker.size() >=
+                        kMaxDependencyTrackerSize;
+        if (hasHazard)
         {
-            insertBarrier = true;
-            mDependencyTracker.clear();
+            ANGLE_TRY(insertBarrier());
         }
-        mDependencyTracker.insert(clMem);
+
+        angle::HashSet<cl::Object *> &tracker =
+            access == MemoryAccess::Write ? mWriteDependencyTracker : mReadDependencyTracker;
+        tracker.insert(clMem);
         if (parentMem)
         {
-            mDependencyTracker.insert(parentMem);
+            tracker.insert(parentMem);
+        }
+    }
+
+    if (access == MemoryAccess::Write)
+    {
+        if (cl::IsBufferType(clMem->getType()))
+        {
+            onBufferWrite(clMem->getImpl<CLBufferVk>().getBuffer());
+        }
+        else if (parentMem != nullptr && cl::IsBufferType(parentMem->getType()))
+        {
+            onBufferWrite(parentMem->getImpl<CLBufferVk>().getBuffer());
         }
     }
 
@@ -1426,11 +1558,11 @@ angle::Result CLCommandQueueVk::addMemoryDependencies(cl::Memory *clMem)
                                          vkMem.getImage().getAspectFlags(),
                                          vk::ImageLayout::ComputeShaderWrite, &vkMem.getImage());
     }
-    else if (insertBarrier && cl::IsBufferType(clMem->getType()))
+    else if (hasHazard && cl::IsBufferType(clMem->getType()))
     {
         CLBufferVk &vkMem = clMem->getImpl<CLBufferVk>();
 
-        mComputePassCommands->bufferWrite(VK_ACCESS_SHADER_WRITE_BIT,
+        mComputePassCommands->bufferWrite(mContext, VK_ACCESS_SHADER_WRITE_BIT,
                                           vk::PipelineStage::ComputeShader, &vkMem.getBuffer());
     }
 
@@ -1446,6 +1578,12 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
         kernelVk.getProgram()->getDeviceProgramData(mCommandQueue.getDevice().getNative());
     ASSERT(devProgramData != nullptr);
 
+    // Reuse the kernel arguments descriptor set if it was written for the same resources before
+    vk::DescriptorSetDesc kernelArgumentsDesc;
+    const bool cacheKernelArguments =
+        GetKernelArgumentsDescriptorSetDesc(kernelVk.getArgs(), &kernelArgumentsDesc);
+    bool updateKernelArguments = true;
+
     // Set the descriptor set layouts and allocate descriptor sets
     // The descriptor set layouts are setup in the order of their appearance, as Vulkan requires
     // them to point to valid handles.
@@ -1468,7 +1606,16 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
                 CL_INVALID_OPERATION);
 
             // Allocate descriptor set
-            ANGLE_TRY(kernelVk.allocateDescriptorSet(index, layoutIndex, mComputePassCommands));
+            if (index == DescriptorSetIndex::KernelArguments)
+            {
+                ANGLE_TRY(kernelVk.getOrAllocateKernelArgumentsDescriptorSet(
+                    cacheKernelArguments ? &kernelArgumentsDesc : nullptr, layoutIndex,
+                    mComputePassCommands, &updateKernelArguments));
+            }
+            else
+            {
+                ANGLE_TRY(kernelVk.allocateDescriptorSet(index, layoutIndex, mComputePassCommands));
+            }
             ++layoutIndex;
         }
     }
@@ -1547,6 +1694,8 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
 
     // Process each kernel argument/resource
     vk::DescriptorSetArray<UpdateDescriptorSetsBuilder> updateDescriptorSetsBuilders;
+    uint32_t podPushConstantBegin = std::numeric_limits<uint32_t>::max();
+    uint32_t podPushConstantEnd   = 0;
     CLKernelArguments args = kernelVk.getArgs();
     for (size_t index = 0; index < args.size(); index++)
     {
@@ -1561,7 +1710,10 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
                 cl::Memory *clMem = cl::Buffer::Cast(*static_cast<const cl_mem *>(arg.handle));
                 CLBufferVk &vkMem = clMem->getImpl<CLBufferVk>();
 
-                ANGLE_TRY(addMemoryDependencies(clMem));
+                ANGLE_TRY(addMemoryDependencies(
+                    clMem, arg.type == NonSemanticClspvReflectionArgumentUniform
+                               ? MemoryAccess::Read
+                               : MemoryAccess::Write));
 
                 // Update buffer/descriptor info
                 VkDescriptorBufferInfo &bufferInfo =
@@ -1585,15 +1737,10 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
             }
             case NonSemanticClspvReflectionArgumentPodPushConstant:
             {
-                // Spec requires the size and offset to be multiple of 4, round up for size and
-                // round down for offset to ensure this
-                uint32_t offset = roundDownPow2(arg.pushConstOffset, 4u);
-                uint32_t size =
-                    roundUpPow2(arg.pushConstOffset + arg.pushConstantSize, 4u) - offset;
-                ASSERT(offset + size <= kernelVk.getPodArgumentsData().size());
-                mComputePassCommands->getCommandBuffer().pushConstants(
-                    kernelVk.getPipelineLayout(), VK_SHADER_STAGE_COMPUTE_BIT, offset, size,
-                    &kernelVk.getPodArgumentsData()[offset]);
+                // The POD arguments are pushed together after the loop
+                podPushConstantBegin = std::min(podPushConstantBegin, arg.pushConstOffset);
+                podPushConstantEnd =
+                    std::max(podPushConstantEnd, arg.pushConstOffset + arg.pushConstantSize);
                 break;
             }
             case NonSemanticClspvReflectionArgumentSampler:
@@ -1637,7 +1784,10 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
                 cl::Memory *clMem = cl::Image::Cast(*static_cast<const cl_mem *>(arg.handle));
                 CLImageVk &vkMem  = clMem->getImpl<CLImageVk>();
 
-                ANGLE_TRY(addMemoryDependencies(clMem));
+                ANGLE_TRY(addMemoryDependencies(
+                    clMem, arg.type == NonSemanticClspvReflectionArgumentSampledImage
+                               ? MemoryAccess::Read
+                               : MemoryAccess::Write));
 
                 cl_image_format imageFormat = vkMem.getFormat();
                 const VkPushConstantRange *imageDataChannelOrderRange =
@@ -1689,7 +1839,10 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
                 cl::Memory *clMem = cl::Image::Cast(*static_cast<const cl_mem *>(arg.handle));
                 CLImageVk &vkMem  = clMem->getImpl<CLImageVk>();
 
-                ANGLE_TRY(addMemoryDependencies(clMem));
+                ANGLE_TRY(addMemoryDependencies(
+                    clMem, arg.type == NonSemanticClspvReflectionArgumentUniformTexelBuffer
+                               ? MemoryAccess::Read
+                               : MemoryAccess::Write));
 
                 VkBufferView &bufferView           = kernelArgDescSetBuilder.allocBufferView();
                 const vk::BufferView *vkBufferView = nullptr;
@@ -1724,6 +1877,18 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
         }
     }
 
+    if (podPushConstantBegin < podPushConstantEnd)
+    {
+        // Spec requires the size and offset to be multiple of 4, round up for size and round down
+        // for offset to ensure this
+        uint32_t offset = roundDownPow2(podPushConstantBegin, 4u);
+        uint32_t size   = roundUpPow2(podPushConstantEnd, 4u) - offset;
+        ASSERT(offset + size <= kernelVk.getPodArgumentsData().size());
+        mComputePassCommands->getCommandBuffer().pushConstants(
+            kernelVk.getPipelineLayout(), VK_SHADER_STAGE_COMPUTE_BIT, offset, size,
+            &kernelVk.getPodArgumentsData()[offset]);
+    }
+
     // process the printf storage buffer
     if (kernelVk.usesPrintf())
     {
@@ -1753,6 +1918,7 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
                                             ->reflectionData.printfBufferStorage.binding;
 
         mNeedPrintfHandling = true;
+        mPrintfQueueSerial  = mComputePassCommands->getQueueSerial();
         mPrintfInfos        = kernelVk.getProgram()->getPrintfDescriptors(kernelVk.getKernelName());
     }
 
@@ -1761,9 +1927,13 @@ angle::Result CLCommandQueueVk::processKernelResources(CLKernelVk &kernelVk,
     {
         if (!kernelVk.getDescriptorSetLayoutDesc(index).empty())
         {
-            mContext->getPerfCounters().writeDescriptorSets =
-                updateDescriptorSetsBuilders[index].flushDescriptorSetUpdates(
-                    mContext->getRenderer()->getDevice());
+            // A reused kernel arguments descriptor set already has these writes
+            if (index != DescriptorSetIndex::KernelArguments || updateKernelArguments)
+            {
+                mContext->getPerfCounters().writeDescriptorSets =
+                    updateDescriptorSetsBuilders[index].flushDescriptorSetUpdates(
+                        mContext->getRenderer()->getDevice());
+            }
 
             VkDescriptorSet descriptorSet = kernelVk.getDescriptorSet(index);
             mComputePassCommands->getCommandBuffer().bindDescriptorSets(
@@ -1820,9 +1990,10 @@ angle::Result CLCommandQueueVk::flushComputePassCommands()
 
 angle::Result CLCommandQueueVk::processWaitlist(const cl::EventPtrs &waitEvents)
 {
+    ANGLE_TRY(onCommandEnqueued());
+
     if (!waitEvents.empty())
     {
-        bool insertedBarrier = false;
         for (const cl::EventPtr &event : waitEvents)
         {
             if (event->getImpl<CLEventVk>().isUserEvent() ||
@@ -1834,13 +2005,12 @@ angle::Result CLCommandQueueVk::processWaitlist(const cl::EventPtrs &waitEvents)
                 // https://anglebug.com/42267109
                 mExternalEvents.push_back(event);
             }
-            else if (event->getCommandQueue() == &mCommandQueue && !insertedBarrier)
+            else if (event->getImpl<CLEventVk>().getQueueBarrierCount() == mBarrierCount)
             {
-                // As long as there is at least one dependant command in same queue,
-                // we just need to insert one execution barrier
+                // As long as there is at least one dependant command in same queue that no barrier
+                // was recorded after, we just need to insert one execution barrier.  It also
+                // covers the rest of the events, since they were all recorded before it.
                 ANGLE_TRY(insertBarrier());
-
-                insertedBarrier = true;
             }
         }
     }
@@ -1859,6 +2029,7 @@ angle::Result CLCommandQueueVk::submitCommands()
                                                       nullptr, mLastFlushedQueueSerial));
 
     mLastSubmittedQueueSerial = mLastFlushedQueueSerial;
+    mPendingCommandCount      = 0;
 
     // Now that we have submitted commands, some of pending garbage may no longer pending
     // and should be moved to garbage list.
@@ -1872,7 +2043,7 @@ angle::Result CLCommandQueueVk::createEvent(CLEventImpl::CreateFunc *createFunc,
 {
     if (createFunc != nullptr)
     {
-        *createFunc = [this, initialStatus](const cl::Event &event) {
+        *createFunc = [this, initialStatus, barrierCount = mBarrierCount](const cl::Event &event) {
             auto eventVk = new (std::nothrow) CLEventVk(event);
             if (eventVk == nullptr)
             {
@@ -1880,6 +2051,7 @@ angle::Result CLCommandQueueVk::createEvent(CLEventImpl::CreateFunc *createFunc,
                 ANGLE_CL_SET_ERROR(CL_OUT_OF_HOST_MEMORY);
                 return CLEventImpl::Ptr(nullptr);
             }
+            eventVk->setQueueBarrierCount(barrierCount);
 
             if (initialStatus == cl::ExecutionStatus::Complete)
             {
@@ -1949,21 +2121,50 @@ angle::Result CLCommandQueueVk::finishQueueSerialInternal(const QueueSerial queu
 
     ANGLE_TRY(mContext->getRenderer()->finishQueueSerial(mContext, queueSerial));
 
+    // Several batches may have been flushed before being submitted together, and batches may be
+    // finished out of order by blocking reads, so process all the batches up to |queueSerial|.
+    std::vector<QueueSerial> finishedQueueSerials;
+    for (const auto &commandsState : mCommandsStateMap)
+    {
+        if (commandsState.first <= queueSerial)
+        {
+            finishedQueueSerials.push_back(commandsState.first);
+        }
+    }
+    std::sort(finishedQueueSerials.begin(), finishedQueueSerials.end());
+
     // Ensure memory  objects are synced back to host CPU
-    ANGLE_TRY(syncHostBuffers(mCommandsStateMap[queueSerial].hostTransferList));
+    for (const QueueSerial &finishedQueueSerial : finishedQueueSerials)
+    {
+        ANGLE_TRY(syncHostBuffers(mCommandsStateMap[finishedQueueSerial].hostTransferList));
+    }
 
-    if (mNeedPrintfHandling)
+    if (mNeedPrintfHandling && mPrintfQueueSerial <= queueSerial)
     {
         ANGLE_TRY(processPrintfBuffer());
         mNeedPrintfHandling = false;
     }
 
-    // Events associated with this queue serial and ready to be marked complete
-    ANGLE_TRY(SetEventsWithQueueSerialToState(mCommandsStateMap[queueSerial].events, queueSerial,
-                                              cl::ExecutionStatus::Complete));
+    // Events associated with these queue serials and ready to be marked complete
+    for (const QueueSerial &finishedQueueSerial : finishedQueueSerials)
+    {
+        ANGLE_TRY(SetEventsWithQueueSerialToState(mCommandsStateMap[finishedQueueSerial].events,
+                                                  finishedQueueSerial,
+                                                  cl::ExecutionStatus::Complete));
+        mCommandsStateMap.erase(finishedQueueSerial);
+    }
 
-    mExternalEvents.clear();
-    mCommandsStateMap.erase(queueSerial);
+    for (auto iter = mBufferWriteSerials.begin(); iter != mBufferWriteSerials.end();)
+    {
+        if (iter->second <= queueSerial.getSerial())
+        {
+            mBufferWriteSerials.erase(iter++);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
 
     return angle::Result::Continue;
 }
@@ -1982,7 +2183,7 @@ angle::Result CLCommandQueueVk::finishQueueSerial(const QueueSerial queueSerial)
 
 angle::Result CLCommandQueueVk::flushInternal()
 {
-    if (!mComputePassCommands->empty())
+    if (!mComputePassCommands->empty() || hasCommandsPendingSubmission())
     {
         // If we still have dependant events, handle them now
         if (!mExternalEvents.empty())
@@ -2014,19 +2215,101 @@ angle::Result CLCommandQueueVk::flushInternal()
         }
 
         ANGLE_TRY(flushComputePassCommands());
-        CommandsState commandsState = mCommandsStateMap[mLastFlushedQueueSerial];
-        ANGLE_TRY(SetEventsWithQueueSerialToState(commandsState.events, mLastFlushedQueueSerial,
-                                                  cl::ExecutionStatus::Submitted));
+
+        // All the batches flushed since the last submission are submitted together
+        std::vector<std::pair<QueueSerial, cl::EventPtrs>> submittedEvents;
+        for (const auto &commandsState : mCommandsStateMap)
+        {
+            if (commandsState.first > mLastSubmittedQueueSerial &&
+                commandsState.first <= mLastFlushedQueueSerial)
+            {
+                submittedEvents.emplace_back(commandsState.first, commandsState.second.events);
+            }
+        }
+        for (const auto &events : submittedEvents)
+        {
+            ANGLE_TRY(SetEventsWithQueueSerialToState(events.second, events.first,
+                                                      cl::ExecutionStatus::Submitted));
+        }
 
         ANGLE_TRY(submitCommands());
         ASSERT(!hasCommandsPendingSubmission());
-        ANGLE_TRY(SetEventsWithQueueSerialToState(commandsState.events, mLastSubmittedQueueSerial,
-                                                  cl::ExecutionStatus::Running));
+        for (const auto &events : submittedEvents)
+        {
+            ANGLE_TRY(SetEventsWithQueueSerialToState(events.second, events.first,
+                                                      cl::ExecutionStatus::Running));
+        }
     }
 
     return angle::Result::Continue;
 }
 
+angle::Result CLCommandQueueVk::onCommandEnqueued()
+{
+    const SubmitThresholds &thresholds = GetSubmitThresholds();
+
+    // Commands waiting on user events or on other queues can't be submitted without blocking, so
+    // they are left for the next flush.
+    if (mPendingCommandCount > 0 && mExternalEvents.empty())
+    {
+        bool submit = thresholds.maxPendingCommands != 0 &&
+                      mPendingCommandCount >= thresholds.maxPendingCommands;
+        if (!submit && thresholds.maxPendingTime.count() != 0)
+        {
+            submit = std::chrono::steady_clock::now() - mFirstPendingCommandTime >=
+                     thresholds.maxPendingTime;
+        }
+        if (submit)
+        {
+            // The batch is finished asynchronously, like after clFlush
+            ANGLE_TRY(flushInternal());
+            ANGLE_TRY(mFinishHandler.notify(mLastSubmittedQueueSerial));
+        }
+    }
+
+    if (mPendingCommandCount++ == 0)
+    {
+        mFirstPendingCommandTime = std::chrono::steady_clock::now();
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result CLCommandQueueVk::finishBufferWrites(CLBufferVk &bufferVk,
+                                                   const cl::EventPtrs &waitEvents)
+{
+    // User events and the commands of other queues are only waited on by a flush
+    if (!mExternalEvents.empty())
+    {
+        return finishInternal();
+    }
+
+    Serial serial;
+    auto iter = mBufferWriteSerials.find(&bufferVk.getBuffer());
+    if (iter != mBufferWriteSerials.end())
+    {
+        serial = iter->second;
+    }
+    for (const cl::EventPtr &event : waitEvents)
+    {
+        const vk::ResourceUse &eventUse = event->getImpl<CLEventVk>().getResourceUse();
+        serial = std::max(serial, eventUse.getSerial(mQueueSerialIndex));
+    }
+
+    if (serial == Serial())
+    {
+        // Nothing pending writes to the buffer
+        return angle::Result::Continue;
+    }
+
+    const QueueSerial queueSerial(mQueueSerialIndex, serial);
+    if (queueSerial > mLastSubmittedQueueSerial)
+    {
+        ANGLE_TRY(flushInternal());
+    }
+    return finishQueueSerialInternal(queueSerial);
+}
+
 angle::Result CLCommandQueueVk::finishInternal()
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CLCommandQueueVk::finish");
@@ -2045,10 +2328,10 @@ angle::Result CLCommandQueueVk::onResourceAccess(const vk::CommandBufferAccess &
         if (mComputePassCommands->usesBufferForWrite(*bufferAccess.buffer))
         {
             // read buffers only need a new command buffer if previously used for write
-            ANGLE_TRY(flushInternal());
+            ANGLE_TRY(flushComputePassCommands());
         }
 
-        mComputePassCommands->bufferRead(bufferAccess.accessType, bufferAccess.stage,
+        mComputePassCommands->bufferRead(mContext, bufferAccess.accessType, bufferAccess.stage,
                                          bufferAccess.buffer);
     }
 
@@ -2057,11 +2340,12 @@ angle::Result CLCommandQueueVk::onResourceAccess(const vk::CommandBufferAccess &
         if (mComputePassCommands->usesBuffer(*bufferAccess.buffer))
         {
             // write buffers always need a new command buffer
-            ANGLE_TRY(flushInternal());
+            ANGLE_TRY(flushComputePassCommands());
         }
 
-        mComputePassCommands->bufferWrite(bufferAccess.accessType, bufferAccess.stage,
+        mComputePassCommands->bufferWrite(mContext, bufferAccess.accessType, bufferAccess.stage,
                                           bufferAccess.buffer);
+        onBufferWrite(*bufferAccess.buffer);
         if (bufferAccess.buffer->isHostVisible())
         {
             // currently all are host visible so nothing to do
@@ -9,6 +9,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_CLCOMMANDQUEUEVK_H_
 #define LIBANGLE_RENDERER_VULKAN_CLCOMMANDQUEUEVK_H_
 
+#include <chrono>
 #include <condition_variable>
 #include <vector>
 
@@ -348,8 +349,18 @@ class CLCommandQueueVk : public CLCommandQueueImpl
     angle::Result finishInternal();
     angle::Result flushInternal();
     // Wait for the submitted work to the renderer to finish and perform post-processing such as
-    // event status updates etc. This is a blocking call.
+    // event status updates etc, for all the batches up to |queueSerial|. This is a blocking call.
     angle::Result finishQueueSerialInternal(const QueueSerial queueSerial);
+    // Submit the commands accumulated since the last submission if there are too many of them, or
+    // if they have been pending for too long.  Called when a command is enqueued.
+    angle::Result onCommandEnqueued();
+    // Blocking reads of a buffer only wait for the batch that last wrote to it and for the events
+    // they wait on, instead of for all the commands of the queue.
+    angle::Result finishBufferWrites(CLBufferVk &bufferVk, const cl::EventPtrs &waitEvents);
+    void onBufferWrite(const vk::BufferHelper &buffer)
+    {
+        mBufferWriteSerials[&buffer] = mComputePassCommands->getQueueSerial().getSerial();
+    }
 
     angle::Result syncHostBuffers(HostTransferEntries &hostTransferList);
     angle::Result flushComputePassCommands();
@@ -376,8 +387,21 @@ class CLCommandQueueVk : public CLCommandQueueImpl
 
     bool hasUserEventDependency() const;
 
+    // Commands of out-of-order queues are only ordered by event wait lists, markers and barriers.
+    bool isOutOfOrder() const
+    {
+        return mCommandQueue.getProperties().intersects(CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE);
+    }
+
+    // How a kernel accesses a memory object argument.
+    enum class MemoryAccess
+    {
+        Read,
+        Write,
+    };
+
     angle::Result insertBarrier();
-    angle::Result addMemoryDependencies(cl::Memory *clMem);
+    angle::Result addMemoryDependencies(cl::Memory *clMem, MemoryAccess access);
 
     CLContextVk *mContext;
     const CLDeviceVk *mDevice;
@@ -397,13 +421,25 @@ class CLCommandQueueVk : public CLCommandQueueImpl
     // External dependent events that this queue has to wait on
     cl::EventPtrs mExternalEvents;
 
-    // Keep track of kernel resources on prior kernel enqueues
-    angle::HashSet<cl::Object *> mDependencyTracker;
+    // Keep track of the memory objects read and written by the kernels enqueued since the last
+    // execution barrier
+    angle::HashSet<cl::Object *> mReadDependencyTracker;
+    angle::HashSet<cl::Object *> mWriteDependencyTracker;
+    // The number of execution barriers recorded in this queue
+    uint64_t mBarrierCount;
 
     CommandsStateMap mCommandsStateMap;
 
+    // The serial of the batch that last wrote to each buffer, until that batch finishes
+    angle::HashMap<const vk::BufferHelper *, Serial> mBufferWriteSerials;
+
+    // The commands enqueued since the last submission, and when the first of them was enqueued
+    uint32_t mPendingCommandCount;
+    std::chrono::steady_clock::time_point mFirstPendingCommandTime;
+
     // printf handling
     bool mNeedPrintfHandling;
+    QueueSerial mPrintfQueueSerial;
     const angle::HashMap<uint32_t, ClspvPrintfInfo> *mPrintfInfos;
 
     // Host buffer transferring routines
@@ -49,7 +49,15 @@ class CLEventVk : public CLEventImpl, public vk::Resource
     angle::Result setStatusAndExecuteCallback(cl_int status);
     angle::Result setTimestamp(cl_int status);
 
+    // The number of execution barriers the command queue had recorded when the event's command was
+    // recorded.  Waiting on the event doesn't need another barrier if the queue has recorded one
+    // since.
+    void setQueueBarrierCount(uint64_t barrierCount) { mQueueBarrierCount = barrierCount; }
+    uint64_t getQueueBarrierCount() const { return mQueueBarrierCount; }
+
   private:
+    uint64_t mQueueBarrierCount = 0;
+
     std::mutex mUserEventMutex;
     angle::SynchronizedValue<cl_int> mStatus;
     std::condition_variable mUserEventCondition;
@@ -333,4 +333,39 @@ angle::Result CLKernelVk::allocateDescriptorSet(
     return mProgram->allocateDescriptorSet(index, *mDescriptorSetLayouts[*layoutIndex],
                                            computePassCommands, &mDescriptorSets[index]);
 }
+
+angle::Result CLKernelVk::getOrAllocateKernelArgumentsDescriptorSet(
+    const vk::DescriptorSetDesc *argumentsDesc,
+    angle::EnumIterator<DescriptorSetIndex> layoutIndex,
+    vk::OutsideRenderPassCommandBufferHelper *computePassCommands,
+    bool *needsUpdateOut)
+{
+    constexpr DescriptorSetIndex kIndex = DescriptorSetIndex::KernelArguments;
+
+    if (argumentsDesc != nullptr)
+    {
+        auto iter = mKernelArgumentsDescriptorSetCache.find(*argumentsDesc);
+        if (iter != mKernelArgumentsDescriptorSetCache.end())
+        {
+            mDescriptorSets[kIndex] = iter->second;
+            computePassCommands->retainResource(mDescriptorSets[kIndex].get());
+            *needsUpdateOut = false;
+            return angle::Result::Continue;
+        }
+    }
+
+    ANGLE_TRY(allocateDescriptorSet(kIndex, layoutIndex, computePassCommands));
+    *needsUpdateOut = true;
+
+    if (argumentsDesc != nullptr)
+    {
+        // The sets are released to the pool once the GPU is done with them.
+        if (mKernelArgumentsDescriptorSetCache.size() >= kMaxCachedKernelArgumentsDescriptorSets)
+        {
+            mKernelArgumentsDescriptorSetCache.clear();
+        }
+        mKernelArgumentsDescriptorSetCache.emplace(*argumentsDesc, mDescriptorSets[kIndex]);
+    }
+    return angle::Result::Continue;
+}
 }  // namespace rx
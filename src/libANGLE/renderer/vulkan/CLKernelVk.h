@@ -8,6 +8,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_CLKERNELVK_H_
 #define LIBANGLE_RENDERER_VULKAN_CLKERNELVK_H_
 
+#include "common/hash_containers.h"
+
 #include "libANGLE/renderer/vulkan/cl_types.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -142,8 +144,18 @@ class CLKernelVk : public CLKernelImpl
         angle::EnumIterator<DescriptorSetIndex> layoutIndex,
         vk::OutsideRenderPassCommandBufferHelper *computePassCommands);
 
+    // Reuses the kernel arguments descriptor set written before for |argumentsDesc|, or allocates
+    // a new one, in which case |*needsUpdateOut| is set.  Sets are never updated once written, so
+    // a set in use by the GPU can be bound again.  Nothing is cached if |argumentsDesc| is null.
+    angle::Result getOrAllocateKernelArgumentsDescriptorSet(
+        const vk::DescriptorSetDesc *argumentsDesc,
+        angle::EnumIterator<DescriptorSetIndex> layoutIndex,
+        vk::OutsideRenderPassCommandBufferHelper *computePassCommands,
+        bool *needsUpdateOut);
+
   private:
     static constexpr std::array<size_t, 3> kEmptyWorkgroupSize = {0, 0, 0};
+    static constexpr size_t kMaxCachedKernelArgumentsDescriptorSets = 64;
 
     CLProgramVk *mProgram;
     CLContextVk *mContext;
@@ -161,6 +173,8 @@ class CLKernelVk : public CLKernelImpl
     vk::DescriptorSetLayoutPointerArray mDescriptorSetLayouts{};
 
     vk::DescriptorSetArray<vk::DescriptorSetPointer> mDescriptorSets;
+    angle::HashMap<vk::DescriptorSetDesc, vk::DescriptorSetPointer>
+        mKernelArgumentsDescriptorSetCache;
 
     vk::DescriptorSetArray<vk::DescriptorSetLayoutDesc> mDescriptorSetLayoutDescs;
     vk::PipelineLayoutDesc mPipelineLayoutDesc;
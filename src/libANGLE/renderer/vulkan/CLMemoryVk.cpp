@@ -79,6 +79,24 @@ angle::FormatID CLImageFormatToAngleFormat(cl_image_format format)
     }
 }
 
+// On integrated GPUs, the host memory of CL_MEM_USE_HOST_PTR buffers is imported with
+// VK_EXT_external_memory_host instead of copied, if it is suitably aligned.  Discrete GPUs would
+// access the imported memory over the bus for the whole life of the buffer, so they get a copy.
+bool CanImportHostPtr(vk::Renderer *renderer, const void *hostPtr, size_t size)
+{
+    if (!renderer->getFeatures().supportsExternalMemoryHost.enabled ||
+        renderer->getPhysicalDeviceProperties().deviceType !=
+            VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU)
+    {
+        return false;
+    }
+
+    const VkDeviceSize alignment =
+        renderer->getPhysicalDeviceExternalMemoryHostProperties().minImportedHostPointerAlignment;
+    return alignment != 0 && reinterpret_cast<uintptr_t>(hostPtr) % alignment == 0 &&
+           size % alignment == 0;
+}
+
 }  // namespace
 
 CLMemoryVk::CLMemoryVk(const cl::Memory &memory)
@@ -161,7 +179,7 @@ angle::Result CLMemoryVk::createSubBuffer(const cl::Buffer &buffer,
     return angle::Result::Continue;
 }
 
-CLBufferVk::CLBufferVk(const cl::Buffer &buffer) : CLMemoryVk(buffer)
+CLBufferVk::CLBufferVk(const cl::Buffer &buffer) : CLMemoryVk(buffer), mIsHostPtrImported(false)
 {
     if (buffer.isSubBuffer())
     {
@@ -199,6 +217,17 @@ angle::Result CLBufferVk::create(void *hostPtr)
         VkBufferCreateInfo createInfo  = mDefaultBufferCreateInfo;
         createInfo.size                = getSize();
         VkMemoryPropertyFlags memFlags = getVkMemPropertyFlags();
+        if (mMemory.getFlags().intersects(CL_MEM_USE_HOST_PTR) &&
+            CanImportHostPtr(mRenderer, hostPtr, getSize()))
+        {
+            if (mBuffer.initHostExternal(mContext, memFlags, createInfo, hostPtr) == VK_SUCCESS)
+            {
+                mIsHostPtrImported = true;
+                return angle::Result::Continue;
+            }
+            // Fall back to a copy of the host memory.
+            mBuffer.destroy(mRenderer);
+        }
         if (IsError(mBuffer.init(mContext, createInfo, memFlags)))
         {
             ANGLE_CL_RETURN_ERROR(CL_OUT_OF_RESOURCES);
@@ -119,6 +119,14 @@ class CLBufferVk : public CLMemoryVk
 
     bool isSubBuffer() const { return mParent != nullptr; }
 
+    // Whether the host pointer of a CL_MEM_USE_HOST_PTR buffer is the memory of the buffer, in
+    // which case there is nothing to copy between the two on map and unmap.
+    bool isHostPtrImported() const
+    {
+        return isSubBuffer() ? static_cast<const CLBufferVk *>(mParent)->isHostPtrImported()
+                             : mIsHostPtrImported;
+    }
+
     angle::Result setRect(const void *data,
                           const cl::BufferRect &srcRect,
                           const cl::BufferRect &bufferRect);
@@ -138,6 +146,7 @@ class CLBufferVk : public CLMemoryVk
 
     vk::BufferHelper mBuffer;
     VkBufferCreateInfo mDefaultBufferCreateInfo;
+    bool mIsHostPtrImported;
 };
 
 class CLImageVk : public CLMemoryVk
@@ -17,9 +17,15 @@
 
 #include "anglebase/no_destructor.h"
 #include "common/angle_version_info.h"
+#include "common/system_utils.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 #include "vulkan/vulkan_core.h"
 
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
 namespace rx
 {
 
@@ -30,6 +36,31 @@ constexpr vk::UseDebugLayers kUseDebugLayers = vk::UseDebugLayers::YesIfAvailabl
 #else
 constexpr vk::UseDebugLayers kUseDebugLayers = vk::UseDebugLayers::No;
 #endif
+
+bool CopyToMemoryBuffer(const uint8_t *data, size_t size, angle::MemoryBuffer *bufferOut)
+{
+    if (!bufferOut->resize(size))
+    {
+        return false;
+    }
+    if (size > 0)
+    {
+        memcpy(bufferOut->data(), data, size);
+    }
+    return true;
+}
+
+std::string GetProgramCachePath(const std::string &directory, const angle::BlobCacheKey &key)
+{
+    std::ostringstream fileName;
+    fileName << std::hex << std::setfill('0');
+    for (const uint8_t byte : key)
+    {
+        fileName << std::setw(2) << static_cast<uint32_t>(byte);
+    }
+    fileName << ".clbin";
+    return angle::ConcatenatePath(directory, fileName.str());
+}
 }  // namespace
 
 angle::Result CLPlatformVk::initBackendRenderer()
@@ -194,7 +225,12 @@ const std::string &CLPlatformVk::GetVersionString()
 }
 
 CLPlatformVk::CLPlatformVk(const cl::Platform &platform)
-    : CLPlatformImpl(platform), vk::Context(new vk::Renderer()), mBlobCache(1024 * 1024)
+    : CLPlatformImpl(platform),
+      vk::Context(new vk::Renderer()),
+      mBlobCache(1024 * 1024),
+      mProgramCacheDirectory(
+          angle::GetEnvironmentVarOrAndroidProperty("ANGLE_CL_PROGRAM_CACHE_DIR",
+                                                    "angle.cl_program_cache_dir"))
 {}
 
 void CLPlatformVk::handleError(VkResult result,
@@ -297,4 +333,86 @@ void CLPlatformVk::notifyDeviceLost()
     return;
 }
 
+void CLPlatformVk::putProgramBinary(const angle::BlobCacheKey &key,
+                                    const angle::MemoryBuffer &binary)
+{
+    angle::MemoryBuffer cachedBinary;
+    if (!CopyToMemoryBuffer(binary.data(), binary.size(), &cachedBinary))
+    {
+        return;
+    }
+    putBlob(key, cachedBinary);
+
+    if (mProgramCacheDirectory.empty())
+    {
+        return;
+    }
+
+    // Write to a temporary file first, so that a concurrent run never reads a partial binary.
+    Optional<std::string> tempPath = angle::CreateTemporaryFileInDirectory(mProgramCacheDirectory);
+    if (!tempPath.valid())
+    {
+        WARN() << "Unable to write to the CL program cache directory: " << mProgramCacheDirectory;
+        return;
+    }
+
+    bool written = false;
+    {
+        std::ofstream out(tempPath.value(), std::ofstream::binary);
+        out.write(reinterpret_cast<const char *>(binary.data()), binary.size());
+        written = static_cast<bool>(out);
+    }
+
+    const std::string path = GetProgramCachePath(mProgramCacheDirectory, key);
+    if (!written || std::rename(tempPath.value().c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.value().c_str());
+    }
+}
+
+bool CLPlatformVk::getProgramBinary(const angle::BlobCacheKey &key,
+                                    angle::MemoryBuffer *binaryOut)
+{
+    {
+        std::scoped_lock<angle::SimpleMutex> lock(mBlobCacheMutex);
+        const angle::MemoryBuffer *entry;
+        if (mBlobCache.get(key, &entry))
+        {
+            return CopyToMemoryBuffer(entry->data(), entry->size(), binaryOut);
+        }
+    }
+
+    if (mProgramCacheDirectory.empty())
+    {
+        return false;
+    }
+
+    const std::string path = GetProgramCachePath(mProgramCacheDirectory, key);
+    std::ifstream in(path, std::ifstream::binary | std::ifstream::ate);
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    const std::streamoff size = in.tellg();
+    if (size <= 0 || !binaryOut->resize(static_cast<size_t>(size)))
+    {
+        return false;
+    }
+    in.seekg(0, std::ifstream::beg);
+    in.read(reinterpret_cast<char *>(binaryOut->data()), size);
+    if (!in)
+    {
+        return false;
+    }
+
+    // Keep it in memory for the other programs of this run.
+    angle::MemoryBuffer cachedBinary;
+    if (CopyToMemoryBuffer(binaryOut->data(), binaryOut->size(), &cachedBinary))
+    {
+        putBlob(key, cachedBinary);
+    }
+    return true;
+}
+
 }  // namespace rx
@@ -63,6 +63,12 @@ class CLPlatformVk : public CLPlatformImpl, public vk::Context, public vk::Globa
         const std::shared_ptr<angle::Closure> &task) override;
     void notifyDeviceLost() override;
 
+    // Programs built by clspv, keyed by their source, options and device.  They are kept in memory
+    // and, if ANGLE_CL_PROGRAM_CACHE_DIR is set, in a file per program in that directory so they
+    // are reused by later runs.
+    void putProgramBinary(const angle::BlobCacheKey &key, const angle::MemoryBuffer &binary);
+    bool getProgramBinary(const angle::BlobCacheKey &key, angle::MemoryBuffer *binaryOut);
+
   private:
     explicit CLPlatformVk(const cl::Platform &platform);
 
@@ -72,6 +78,8 @@ class CLPlatformVk : public CLPlatformImpl, public vk::Context, public vk::Globa
 
     mutable angle::SimpleMutex mBlobCacheMutex;
     angle::SizedMRUCache<angle::BlobCacheKey, angle::MemoryBuffer> mBlobCache;
+
+    std::string mProgramCacheDirectory;
 };
 
 constexpr cl_version CLPlatformVk::GetVersion()
@@ -17,10 +17,14 @@
 #include "libANGLE/CLProgram.h"
 #include "libANGLE/cl_utils.h"
 
+#include "common/MemoryBuffer.h"
+#include "common/angle_version_info.h"
 #include "common/log_utils.h"
 #include "common/string_utils.h"
 #include "common/system_utils.h"
 
+#include "anglebase/sha1.h"
+
 #include "clspv/Compiler.h"
 
 #include "spirv/unified1/NonSemanticClspvReflection.h"
@@ -29,6 +33,8 @@
 #include "spirv-tools/libspirv.hpp"
 #include "spirv-tools/optimizer.hpp"
 
+#include <sstream>
+
 namespace rx
 {
 
@@ -344,6 +350,161 @@ std::string ProcessBuildOptions(const std::vector<std::string> &optionTokens,
     return processedOptions;
 }
 
+// The binaries returned for CL_PROGRAM_BINARIES, which are also what the program cache stores: a
+// ProgramBinaryOutputHeader followed by the SPIR-V of an executable, or the IR otherwise.
+size_t GetProgramBinarySize(const CLProgramVk::DeviceProgramData &deviceProgramData)
+{
+    return sizeof(CLProgramVk::ProgramBinaryOutputHeader) +
+           (deviceProgramData.binaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE
+                ? deviceProgramData.binary.size() * sizeof(uint32_t)
+                : deviceProgramData.IR.size());
+}
+
+void WriteProgramBinary(const CLProgramVk::DeviceProgramData &deviceProgramData,
+                        unsigned char *binaryOut)
+{
+    const CLProgramVk::ProgramBinaryOutputHeader header{
+        .headerVersion = CLProgramVk::kBinaryVersion,
+        .binaryType    = deviceProgramData.binaryType,
+        .buildStatus   = deviceProgramData.buildStatus};
+    std::memcpy(binaryOut, &header, sizeof(header));
+
+    if (deviceProgramData.binaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE)
+    {
+        std::memcpy(binaryOut + sizeof(header), deviceProgramData.binary.data(),
+                    deviceProgramData.binary.size() * sizeof(uint32_t));
+    }
+    else
+    {
+        std::memcpy(binaryOut + sizeof(header), deviceProgramData.IR.data(),
+                    deviceProgramData.IR.size());
+    }
+}
+
+bool ReadProgramBinary(const unsigned char *binaryHandle,
+                       size_t binarySize,
+                       CLProgramVk::DeviceProgramData *deviceProgramDataOut)
+{
+    // Check for header
+    if (binaryHandle == nullptr ||
+        binarySize < sizeof(CLProgramVk::ProgramBinaryOutputHeader) + sizeof(uint32_t))
+    {
+        ERR() << "Binary is too small!";
+        return false;
+    }
+    binarySize -= sizeof(CLProgramVk::ProgramBinaryOutputHeader);
+
+    // Check for valid binary version from header
+    CLProgramVk::ProgramBinaryOutputHeader binaryHeader;
+    std::memcpy(&binaryHeader, binaryHandle, sizeof(binaryHeader));
+    if (binaryHeader.headerVersion < CLProgramVk::kBinaryVersion)
+    {
+        ERR() << "Binary version not compatible with runtime!";
+        return false;
+    }
+    binaryHandle += sizeof(CLProgramVk::ProgramBinaryOutputHeader);
+
+    // See what kind of binary we have (i.e. SPIR-V or LLVM Bitcode)
+    // https://llvm.org/docs/BitCodeFormat.html#llvm-ir-magic-number
+    // https://registry.khronos.org/SPIR-V/specs/unified1/SPIRV.html#_magic_number
+    constexpr uint32_t LLVM_BC_MAGIC = 0xDEC04342;
+    constexpr uint32_t SPIRV_MAGIC   = 0x07230203;
+    uint32_t firstWord               = 0;
+    std::memcpy(&firstWord, binaryHandle, sizeof(firstWord));
+    bool isBC  = firstWord == LLVM_BC_MAGIC;
+    bool isSPV = firstWord == SPIRV_MAGIC;
+    if (!isBC && !isSPV)
+    {
+        ERR() << "Binary is neither SPIR-V nor LLVM Bitcode!";
+        return false;
+    }
+
+    // Add device binary to program
+    deviceProgramDataOut->binaryType  = binaryHeader.binaryType;
+    deviceProgramDataOut->buildStatus = binaryHeader.buildStatus;
+    switch (deviceProgramDataOut->binaryType)
+    {
+        case CL_PROGRAM_BINARY_TYPE_EXECUTABLE:
+            deviceProgramDataOut->binary.assign(binarySize / sizeof(uint32_t), 0);
+            std::memcpy(deviceProgramDataOut->binary.data(), binaryHandle, binarySize);
+            break;
+        case CL_PROGRAM_BINARY_TYPE_LIBRARY:
+        case CL_PROGRAM_BINARY_TYPE_COMPILED_OBJECT:
+            deviceProgramDataOut->IR.assign(binarySize, 0);
+            std::memcpy(deviceProgramDataOut->IR.data(), binaryHandle, binarySize);
+            break;
+        default:
+            ERR() << "Invalid binary type!";
+            return false;
+    }
+    return true;
+}
+
+// Identifies the output of clspv for a program built from source.  The ANGLE commit hash covers
+// the version of clspv, and the device properties the features the options are derived from.
+void ComputeProgramCacheKey(const std::string &source,
+                            const std::string &processedOptions,
+                            CLProgramVk::BuildType buildType,
+                            const CLDeviceVk &device,
+                            angle::BlobCacheKey *hashOut)
+{
+    const VkPhysicalDeviceProperties &properties =
+        device.getRenderer()->getPhysicalDeviceProperties();
+
+    std::ostringstream hashStream("ANGLE CL Program: ", std::ios_base::ate);
+    hashStream << angle::GetANGLECommitHash() << "," << CLProgramVk::kBinaryVersion << ","
+               << static_cast<uint32_t>(buildType) << "," << std::hex << properties.vendorID
+               << "," << properties.deviceID << "," << properties.driverVersion << ",";
+    for (const uint8_t c : properties.pipelineCacheUUID)
+    {
+        hashStream << static_cast<uint32_t>(c);
+    }
+    hashStream << "," << processedOptions << "," << source;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), hashOut->data());
+}
+
+class CLDeviceCompileTask final : public angle::Closure
+{
+  public:
+    CLDeviceCompileTask(CLProgramVk *programVk,
+                        const cl::DevicePtr &device,
+                        const std::string &processedOptions,
+                        CLProgramVk::BuildType buildType,
+                        const CLProgramVk::LinkPrograms *linkPrograms,
+                        bool createLibrary,
+                        CLProgramVk::DeviceProgramData *deviceProgramData)
+        : mProgramVk(programVk),
+          mDevice(device),
+          mProcessedOptions(processedOptions),
+          mBuildType(buildType),
+          mLinkPrograms(linkPrograms),
+          mCreateLibrary(createLibrary),
+          mDeviceProgramData(deviceProgramData)
+    {}
+
+    void operator()() override
+    {
+        mSucceeded = mProgramVk->compileDeviceProgram(mDevice, mProcessedOptions, mBuildType,
+                                                      mLinkPrograms, mCreateLibrary,
+                                                      mDeviceProgramData);
+    }
+
+    bool succeeded() const { return mSucceeded; }
+
+  private:
+    CLProgramVk *mProgramVk;
+    const cl::DevicePtr mDevice;
+    const std::string mProcessedOptions;
+    CLProgramVk::BuildType mBuildType;
+    const CLProgramVk::LinkPrograms *mLinkPrograms;
+    bool mCreateLibrary;
+    CLProgramVk::DeviceProgramData *mDeviceProgramData;
+    bool mSucceeded = false;
+};
+
 }  // namespace
 
 void CLAsyncBuildTask::operator()()
@@ -386,85 +547,15 @@ angle::Result CLProgramVk::init(const size_t *lengths,
     // clCreateProgramWithBinary
     for (const cl::DevicePtr &device : mProgram.getDevices())
     {
-        const unsigned char *binaryHandle = *binaries++;
-        size_t binarySize                 = *lengths++;
-
-        // Check for header
-        if (binarySize < sizeof(ProgramBinaryOutputHeader))
-        {
-            if (binaryStatus)
-            {
-                *binaryStatus++ = CL_INVALID_BINARY;
-            }
-            ANGLE_CL_RETURN_ERROR(CL_INVALID_BINARY);
-        }
-        binarySize -= sizeof(ProgramBinaryOutputHeader);
-
-        // Check for valid binary version from header
-        const ProgramBinaryOutputHeader *binaryHeader =
-            reinterpret_cast<const ProgramBinaryOutputHeader *>(binaryHandle);
-        if (binaryHeader == nullptr)
-        {
-            ERR() << "NULL binary header!";
-            if (binaryStatus)
-            {
-                *binaryStatus++ = CL_INVALID_BINARY;
-            }
-            ANGLE_CL_RETURN_ERROR(CL_INVALID_BINARY);
-        }
-        else if (binaryHeader->headerVersion < kBinaryVersion)
-        {
-            ERR() << "Binary version not compatible with runtime!";
-            if (binaryStatus)
-            {
-                *binaryStatus++ = CL_INVALID_BINARY;
-            }
-            ANGLE_CL_RETURN_ERROR(CL_INVALID_BINARY);
-        }
-        binaryHandle += sizeof(ProgramBinaryOutputHeader);
-
-        // See what kind of binary we have (i.e. SPIR-V or LLVM Bitcode)
-        // https://llvm.org/docs/BitCodeFormat.html#llvm-ir-magic-number
-        // https://registry.khronos.org/SPIR-V/specs/unified1/SPIRV.html#_magic_number
-        constexpr uint32_t LLVM_BC_MAGIC = 0xDEC04342;
-        constexpr uint32_t SPIRV_MAGIC   = 0x07230203;
-        const uint32_t &firstWord        = reinterpret_cast<const uint32_t *>(binaryHandle)[0];
-        bool isBC                        = firstWord == LLVM_BC_MAGIC;
-        bool isSPV                       = firstWord == SPIRV_MAGIC;
-        if (!isBC && !isSPV)
+        DeviceProgramData deviceBinary;
+        if (!ReadProgramBinary(*binaries++, *lengths++, &deviceBinary))
         {
-            ERR() << "Binary is neither SPIR-V nor LLVM Bitcode!";
             if (binaryStatus)
             {
                 *binaryStatus++ = CL_INVALID_BINARY;
             }
             ANGLE_CL_RETURN_ERROR(CL_INVALID_BINARY);
         }
-
-        // Add device binary to program
-        DeviceProgramData deviceBinary;
-        deviceBinary.binaryType  = binaryHeader->binaryType;
-        deviceBinary.buildStatus = binaryHeader->buildStatus;
-        switch (deviceBinary.binaryType)
-        {
-            case CL_PROGRAM_BINARY_TYPE_EXECUTABLE:
-                deviceBinary.binary.assign(binarySize / sizeof(uint32_t), 0);
-                std::memcpy(deviceBinary.binary.data(), binaryHandle, binarySize);
-                break;
-            case CL_PROGRAM_BINARY_TYPE_LIBRARY:
-            case CL_PROGRAM_BINARY_TYPE_COMPILED_OBJECT:
-                deviceBinary.IR.assign(binarySize, 0);
-                std::memcpy(deviceBinary.IR.data(), binaryHandle, binarySize);
-                break;
-            default:
-                UNREACHABLE();
-                ERR() << "Invalid binary type!";
-                if (binaryStatus)
-                {
-                    *binaryStatus++ = CL_INVALID_BINARY;
-                }
-                ANGLE_CL_RETURN_ERROR(CL_INVALID_BINARY);
-        }
         mAssociatedDevicePrograms[device->getNative()] = std::move(deviceBinary);
         if (binaryStatus)
         {
@@ -605,11 +696,7 @@ angle::Result CLProgramVk::getInfo(cl::ProgramInfo name,
         {
             for (const auto &deviceProgram : mAssociatedDevicePrograms)
             {
-                vBinarySizes.push_back(
-                    sizeof(ProgramBinaryOutputHeader) +
-                    (deviceProgram.second.binaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE
-                         ? deviceProgram.second.binary.size() * sizeof(uint32_t)
-                         : deviceProgram.second.IR.size()));
+                vBinarySizes.push_back(GetProgramBinarySize(deviceProgram.second));
             }
             valPointer = vBinarySizes.data();
             copyValue  = valPointer;
@@ -619,25 +706,11 @@ angle::Result CLProgramVk::getInfo(cl::ProgramInfo name,
         case cl::ProgramInfo::Binaries:
             for (const auto &deviceProgram : mAssociatedDevicePrograms)
             {
-                const void *bin =
-                    deviceProgram.second.binaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE
-                        ? reinterpret_cast<const void *>(deviceProgram.second.binary.data())
-                        : reinterpret_cast<const void *>(deviceProgram.second.IR.data());
-                size_t binSize =
-                    deviceProgram.second.binaryType == CL_PROGRAM_BINARY_TYPE_EXECUTABLE
-                        ? deviceProgram.second.binary.size() * sizeof(uint32_t)
-                        : deviceProgram.second.IR.size();
-                ProgramBinaryOutputHeader header{.headerVersion = kBinaryVersion,
-                                                 .binaryType    = deviceProgram.second.binaryType,
-                                                 .buildStatus   = deviceProgram.second.buildStatus};
-
                 if (outputBins != nullptr)
                 {
                     if (*outputBins != nullptr)
                     {
-                        std::memcpy(*outputBins, &header, sizeof(ProgramBinaryOutputHeader));
-                        std::memcpy((*outputBins) + sizeof(ProgramBinaryOutputHeader), bin,
-                                    binSize);
+                        WriteProgramBinary(deviceProgram.second, *outputBins);
                     }
                     outputBins++;
                 }
@@ -821,6 +894,120 @@ const CLProgramVk::DeviceProgramData *CLProgramVk::getDeviceProgramData(
     return nullptr;
 }
 
+bool CLProgramVk::compileDeviceProgram(const cl::DevicePtr &device,
+                                       const std::string &processedOptions,
+                                       BuildType buildType,
+                                       const LinkPrograms *linkPrograms,
+                                       bool createLibrary,
+                                       DeviceProgramData *deviceProgramData)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CLProgramVk::compileDeviceProgram");
+
+    // add clspv compiler options based on device features
+    const std::string deviceOptions =
+        processedOptions + ClspvGetCompilerOptions(&device->getImpl<CLDeviceVk>());
+
+    // Invoke clspv
+    switch (buildType)
+    {
+        case BuildType::BUILD:
+        case BuildType::COMPILE:
+        {
+            // Skip clspv if the program was built before, by this run or a previous one.
+            angle::BlobCacheKey cacheKey;
+            ComputeProgramCacheKey(mProgram.getSource(), deviceOptions, buildType,
+                                   device->getImpl<CLDeviceVk>(), &cacheKey);
+            angle::MemoryBuffer cachedBinary;
+            if (getPlatform()->getProgramBinary(cacheKey, &cachedBinary) &&
+                ReadProgramBinary(cachedBinary.data(), cachedBinary.size(), deviceProgramData))
+            {
+                deviceProgramData->buildLog.clear();
+                break;
+            }
+
+            ScopedClspvContext clspvCtx;
+            const char *clSrc   = mProgram.getSource().c_str();
+            ClspvError clspvRet = clspvCompileFromSourcesString(
+                1, NULL, static_cast<const char **>(&clSrc), deviceOptions.c_str(),
+                &clspvCtx.mOutputBin, &clspvCtx.mOutputBinSize, &clspvCtx.mOutputBuildLog);
+            deviceProgramData->buildLog =
+                clspvCtx.mOutputBuildLog != nullptr ? clspvCtx.mOutputBuildLog : "";
+            if (clspvRet != CLSPV_SUCCESS)
+            {
+                ERR() << "OpenCL build failed with: ClspvError(" << clspvRet << ")!";
+                deviceProgramData->buildStatus = CL_BUILD_ERROR;
+                return false;
+            }
+
+            if (buildType == BuildType::COMPILE)
+            {
+                deviceProgramData->IR.assign(clspvCtx.mOutputBinSize, 0);
+                std::memcpy(deviceProgramData->IR.data(), clspvCtx.mOutputBin,
+                            clspvCtx.mOutputBinSize);
+                deviceProgramData->binaryType = CL_PROGRAM_BINARY_TYPE_COMPILED_OBJECT;
+            }
+            else
+            {
+                deviceProgramData->binary.assign(clspvCtx.mOutputBinSize / sizeof(uint32_t), 0);
+                std::memcpy(deviceProgramData->binary.data(), clspvCtx.mOutputBin,
+                            clspvCtx.mOutputBinSize);
+                deviceProgramData->binaryType = CL_PROGRAM_BINARY_TYPE_EXECUTABLE;
+            }
+
+            if (cachedBinary.resize(GetProgramBinarySize(*deviceProgramData)))
+            {
+                WriteProgramBinary(*deviceProgramData, cachedBinary.data());
+                getPlatform()->putProgramBinary(cacheKey, cachedBinary);
+            }
+            break;
+        }
+        case BuildType::LINK:
+        {
+            ASSERT(linkPrograms != nullptr);
+            ScopedClspvContext clspvCtx;
+            std::vector<size_t> vSizes;
+            std::vector<const char *> vBins;
+            for (const CLProgramVk::DeviceProgramData *linkProgramData : *linkPrograms)
+            {
+                vSizes.push_back(linkProgramData->IR.size());
+                vBins.push_back(linkProgramData->IR.data());
+            }
+            ClspvError clspvRet = clspvCompileFromSourcesString(
+                linkPrograms->size(), vSizes.data(), vBins.data(), deviceOptions.c_str(),
+                &clspvCtx.mOutputBin, &clspvCtx.mOutputBinSize, &clspvCtx.mOutputBuildLog);
+            deviceProgramData->buildLog =
+                clspvCtx.mOutputBuildLog != nullptr ? clspvCtx.mOutputBuildLog : "";
+            if (clspvRet != CLSPV_SUCCESS)
+            {
+                ERR() << "OpenCL build failed with: ClspvError(" << clspvRet << ")!";
+                deviceProgramData->buildStatus = CL_BUILD_ERROR;
+                return false;
+            }
+
+            if (createLibrary)
+            {
+                deviceProgramData->IR.assign(clspvCtx.mOutputBinSize, 0);
+                std::memcpy(deviceProgramData->IR.data(), clspvCtx.mOutputBin,
+                            clspvCtx.mOutputBinSize);
+                deviceProgramData->binaryType = CL_PROGRAM_BINARY_TYPE_LIBRARY;
+            }
+            else
+            {
+                deviceProgramData->binary.assign(clspvCtx.mOutputBinSize / sizeof(uint32_t), 0);
+                std::memcpy(deviceProgramData->binary.data(),
+                            reinterpret_cast<char *>(clspvCtx.mOutputBin),
+                            clspvCtx.mOutputBinSize);
+                deviceProgramData->binaryType = CL_PROGRAM_BINARY_TYPE_EXECUTABLE;
+            }
+            break;
+        }
+        default:
+            UNREACHABLE();
+            return false;
+    }
+    return true;
+}
+
 bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
                                 std::string options,
                                 std::string internalOptions,
@@ -839,100 +1026,54 @@ bool CLProgramVk::buildInternal(const cl::DevicePtrs &devices,
                                              "-create-library") != optionTokens.end();
     std::string processedOptions = ProcessBuildOptions(optionTokens, buildType);
 
-    // Build for each associated device
-    for (size_t i = 0; i < devices.size(); ++i)
+    // Look up the data of every device first, so the map isn't modified while clspv runs
+    std::vector<DeviceProgramData *> deviceProgramDatas;
+    for (const cl::DevicePtr &device : devices)
     {
-        const cl::RefPointer<cl::Device> &device = devices.at(i);
-        DeviceProgramData &deviceProgramData     = mAssociatedDevicePrograms[device->getNative()];
-
-        // add clspv compiler options based on device features
-        processedOptions += ClspvGetCompilerOptions(&device->getImpl<CLDeviceVk>());
+        deviceProgramDatas.push_back(&mAssociatedDevicePrograms[device->getNative()]);
+    }
 
-        if (buildType != BuildType::BINARY)
+    if (buildType != BuildType::BINARY)
+    {
+        // The devices are compiled for independently, so all but the first are compiled on worker
+        // threads.  This may itself run on a worker thread, so rather than waiting for tasks that
+        // haven't started yet, they are canceled and run here.
+        std::vector<std::shared_ptr<CLDeviceCompileTask>> compileTasks;
+        std::vector<std::shared_ptr<angle::WaitableEvent>> compileEvents;
+        for (size_t i = 0; i < devices.size(); ++i)
         {
-            // Invoke clspv
-            switch (buildType)
+            compileTasks.push_back(std::make_shared<CLDeviceCompileTask>(
+                this, devices.at(i), processedOptions, buildType,
+                buildType == BuildType::LINK ? &LinkProgramsList.at(i) : nullptr, createLibrary,
+                deviceProgramDatas[i]));
+            if (i > 0)
             {
-                case BuildType::BUILD:
-                case BuildType::COMPILE:
-                {
-                    ScopedClspvContext clspvCtx;
-                    const char *clSrc   = mProgram.getSource().c_str();
-                    ClspvError clspvRet = clspvCompileFromSourcesString(
-                        1, NULL, static_cast<const char **>(&clSrc), processedOptions.c_str(),
-                        &clspvCtx.mOutputBin, &clspvCtx.mOutputBinSize, &clspvCtx.mOutputBuildLog);
-                    deviceProgramData.buildLog =
-                        clspvCtx.mOutputBuildLog != nullptr ? clspvCtx.mOutputBuildLog : "";
-                    if (clspvRet != CLSPV_SUCCESS)
-                    {
-                        ERR() << "OpenCL build failed with: ClspvError(" << clspvRet << ")!";
-                        deviceProgramData.buildStatus = CL_BUILD_ERROR;
-                        return false;
-                    }
-
-                    if (buildType == BuildType::COMPILE)
-                    {
-                        deviceProgramData.IR.assign(clspvCtx.mOutputBinSize, 0);
-                        std::memcpy(deviceProgramData.IR.data(), clspvCtx.mOutputBin,
-                                    clspvCtx.mOutputBinSize);
-                        deviceProgramData.binaryType = CL_PROGRAM_BINARY_TYPE_COMPILED_OBJECT;
-                    }
-                    else
-                    {
-                        deviceProgramData.binary.assign(clspvCtx.mOutputBinSize / sizeof(uint32_t),
-                                                        0);
-                        std::memcpy(deviceProgramData.binary.data(), clspvCtx.mOutputBin,
-                                    clspvCtx.mOutputBinSize);
-                        deviceProgramData.binaryType = CL_PROGRAM_BINARY_TYPE_EXECUTABLE;
-                    }
-                    break;
-                }
-                case BuildType::LINK:
-                {
-                    ScopedClspvContext clspvCtx;
-                    std::vector<size_t> vSizes;
-                    std::vector<const char *> vBins;
-                    const LinkPrograms &linkPrograms = LinkProgramsList.at(i);
-                    for (const CLProgramVk::DeviceProgramData *linkProgramData : linkPrograms)
-                    {
-                        vSizes.push_back(linkProgramData->IR.size());
-                        vBins.push_back(linkProgramData->IR.data());
-                    }
-                    ClspvError clspvRet = clspvCompileFromSourcesString(
-                        linkPrograms.size(), vSizes.data(), vBins.data(), processedOptions.c_str(),
-                        &clspvCtx.mOutputBin, &clspvCtx.mOutputBinSize, &clspvCtx.mOutputBuildLog);
-                    deviceProgramData.buildLog =
-                        clspvCtx.mOutputBuildLog != nullptr ? clspvCtx.mOutputBuildLog : "";
-                    if (clspvRet != CLSPV_SUCCESS)
-                    {
-                        ERR() << "OpenCL build failed with: ClspvError(" << clspvRet << ")!";
-                        deviceProgramData.buildStatus = CL_BUILD_ERROR;
-                        return false;
-                    }
+                compileEvents.push_back(getPlatform()->postMultiThreadWorkerTask(compileTasks[i]));
+            }
+        }
 
-                    if (createLibrary)
-                    {
-                        deviceProgramData.IR.assign(clspvCtx.mOutputBinSize, 0);
-                        std::memcpy(deviceProgramData.IR.data(), clspvCtx.mOutputBin,
-                                    clspvCtx.mOutputBinSize);
-                        deviceProgramData.binaryType = CL_PROGRAM_BINARY_TYPE_LIBRARY;
-                    }
-                    else
-                    {
-                        deviceProgramData.binary.assign(clspvCtx.mOutputBinSize / sizeof(uint32_t),
-                                                        0);
-                        std::memcpy(deviceProgramData.binary.data(),
-                                    reinterpret_cast<char *>(clspvCtx.mOutputBin),
-                                    clspvCtx.mOutputBinSize);
-                        deviceProgramData.binaryType = CL_PROGRAM_BINARY_TYPE_EXECUTABLE;
-                    }
-                    break;
-                }
-                default:
-                    UNREACHABLE();
-                    return false;
+        bool compiled = true;
+        for (size_t i = 0; i < compileTasks.size(); ++i)
+        {
+            if (i == 0 || compileEvents[i - 1]->cancel())
+            {
+                (*compileTasks[i])();
             }
+            else
+            {
+                compileEvents[i - 1]->wait();
+            }
+            compiled = compileTasks[i]->succeeded() && compiled;
         }
+        if (!compiled)
+        {
+            return false;
+        }
+    }
+
+    for (DeviceProgramData *deviceProgramDataPtr : deviceProgramDatas)
+    {
+        DeviceProgramData &deviceProgramData = *deviceProgramDataPtr;
 
         // Extract reflection info from spv binary and populate reflection data, as well as create
         // the shader module
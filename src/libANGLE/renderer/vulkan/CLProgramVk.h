@@ -333,6 +333,14 @@ class CLProgramVk : public CLProgramImpl
     CLPlatformVk *getPlatform() { return mContext->getPlatform(); }
     const vk::ShaderModulePtr &getShaderModule() const { return mShader; }
 
+    // Runs clspv for one device, or takes its output from the program cache.  buildInternal
+    // compiles for the devices of a build in parallel, with mProgramMutex held.
+    bool compileDeviceProgram(const cl::DevicePtr &device,
+                              const std::string &processedOptions,
+                              BuildType buildType,
+                              const LinkPrograms *linkPrograms,
+                              bool createLibrary,
+                              DeviceProgramData *deviceProgramData);
     bool buildInternal(const cl::DevicePtrs &devices,
                        std::string options,
                        std::string internalOptions,
@@ -8,6 +8,7 @@
 //
 
 #include "libANGLE/renderer/vulkan/CommandQueue.h"
+#include "common/FixedVector.h"
 #include "common/system_utils.h"
 #include "libANGLE/renderer/vulkan/SyncVk.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
@@ -23,6 +24,10 @@ constexpr bool kOutputVmaStatsString = false;
 // memory for allocation.
 constexpr VkDeviceSize kMaxBufferSuballocationGarbageSize = 64 * 1024 * 1024;
 
+// The maximum number of submissions that are combined into a single vkQueueSubmit call.
+constexpr size_t kMaxBatchedSubmissions = 8;
+static_assert(kMaxBatchedSubmissions <= kInFlightCommandsLimit);
+
 void InitializeSubmitInfo(VkSubmitInfo *submitInfo,
                           const PrimaryCommandBuffer &commandBuffer,
                           const std::vector<VkSemaphore> &waitSemaphores,
@@ -46,6 +51,19 @@ void InitializeSubmitInfo(VkSubmitInfo *submitInfo,
     }
 }
 
+void ExportExternalFenceFd(VkDevice device, ExternalFence *externalFence)
+{
+    // exportFd is exporting VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT_KHR type handle which
+    // obeys copy semantics. This means that the fence must already be signaled or the work
+    // to signal it is in the graphics pipeline at the time we export the fd.
+    // In other words, must call exportFd() after successful vkQueueSubmit() call.
+    VkFenceGetFdInfoKHR fenceGetFdInfo = {};
+    fenceGetFdInfo.sType               = VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR;
+    fenceGetFdInfo.fence               = externalFence->getHandle();
+    fenceGetFdInfo.handleType          = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT_KHR;
+    externalFence->exportFd(device, fenceGetFdInfo);
+}
+
 void GetDeviceQueue(VkDevice device,
                     bool makeProtected,
                     uint32_t queueFamilyIndex,
@@ -245,6 +263,14 @@ VkResult CommandBatch::initFence(VkDevice device, FenceRecycler *recycler)
     return result;
 }
 
+void CommandBatch::shareFence(const CommandBatch &other)
+{
+    ASSERT(!hasFence());
+    ASSERT(other.hasFence());
+    mFence         = other.mFence;
+    mExternalFence = other.mExternalFence;
+}
+
 void CommandBatch::setExternalFence(SharedExternalFence &&externalFence)
 {
     ASSERT(!hasFence());
@@ -831,12 +857,7 @@ angle::Result CommandQueue::submitCommands(Context *context,
                                            const QueueSerial &submitQueueSerial)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::submitCommands");
-    std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
-    Renderer *renderer = context->getRenderer();
-    VkDevice device    = renderer->getDevice();
-
-    ++mPerfCounters.commandQueueSubmitCallsTotal;
-    ++mPerfCounters.commandQueueSubmitCallsPerFrame;
+    VkDevice device = context->getDevice();
 
     DeviceScoped<CommandBatch> scopedBatch(device);
     CommandBatch &batch = scopedBatch.get();
@@ -846,47 +867,67 @@ angle::Result CommandQueue::submitCommands(Context *context,
 
     std::vector<VkSemaphore> waitSemaphores;
     std::vector<VkPipelineStageFlags> waitSemaphoreStageMasks;
-
-    ANGLE_TRY(mCommandPoolAccess.getCommandsAndWaitSemaphores(
-        context, protectionType, priority, &batch, &waitSemaphores, &waitSemaphoreStageMasks));
-
-    mPerfCounters.commandQueueWaitSemaphoresTotal += waitSemaphores.size();
-
-    // Don't make a submission if there is nothing to submit.
-    const bool needsQueueSubmit = batch.getPrimaryCommands().valid() ||
-                                  signalSemaphore != VK_NULL_HANDLE || externalFence ||
-                                  !waitSemaphores.empty();
     VkSubmitInfo submitInfo                   = {};
     VkProtectedSubmitInfo protectedSubmitInfo = {};
 
-    if (needsQueueSubmit)
+    PendingSubmission pendingSubmission = {};
+    pendingSubmission.priority          = priority;
+    pendingSubmission.protectionType    = protectionType;
+    pendingSubmission.submitInfo        = &submitInfo;
+    pendingSubmission.commandBatch      = &scopedBatch;
+    pendingSubmission.queueSerial       = submitQueueSerial;
+    pendingSubmission.submitted         = false;
+    pendingSubmission.result            = angle::Result::Continue;
     {
-        InitializeSubmitInfo(&submitInfo, batch.getPrimaryCommands(), waitSemaphores,
-                             waitSemaphoreStageMasks, signalSemaphore);
+        std::lock_guard<angle::SimpleMutex> lock(mPendingSubmissionsMutex);
 
-        // No need protected submission if no commands to submit.
-        if (protectionType == ProtectionType::Protected && batch.getPrimaryCommands().valid())
-        {
-            protectedSubmitInfo.sType           = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
-            protectedSubmitInfo.pNext           = nullptr;
-            protectedSubmitInfo.protectedSubmit = true;
-            submitInfo.pNext                    = &protectedSubmitInfo;
-        }
+        ANGLE_TRY(mCommandPoolAccess.getCommandsAndWaitSemaphores(
+            context, protectionType, priority, &batch, &waitSemaphores, &waitSemaphoreStageMasks));
 
-        if (!externalFence)
-        {
-            ANGLE_VK_TRY(context, batch.initFence(context->getDevice(), &mFenceRecycler));
-        }
-        else
+        // Don't make a submission if there is nothing to submit.
+        const bool needsQueueSubmit = batch.getPrimaryCommands().valid() ||
+                                      signalSemaphore != VK_NULL_HANDLE || externalFence ||
+                                      !waitSemaphores.empty();
+
+        if (needsQueueSubmit)
         {
-            batch.setExternalFence(std::move(externalFence));
+            InitializeSubmitInfo(&submitInfo, batch.getPrimaryCommands(), waitSemaphores,
+                                 waitSemaphoreStageMasks, signalSemaphore);
+
+            // No need protected submission if no commands to submit.
+            if (protectionType == ProtectionType::Protected && batch.getPrimaryCommands().valid())
+            {
+                protectedSubmitInfo.sType           = VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO;
+                protectedSubmitInfo.pNext           = nullptr;
+                protectedSubmitInfo.protectedSubmit = true;
+                submitInfo.pNext                    = &protectedSubmitInfo;
+            }
+
+            // The fence is otherwise created when the submission is made, as it may be shared
+            // with other batches.
+            if (externalFence)
+            {
+                batch.setExternalFence(std::move(externalFence));
+            }
         }
 
-        ++mPerfCounters.vkQueueSubmitCallsTotal;
-        ++mPerfCounters.vkQueueSubmitCallsPerFrame;
+        mPendingSubmissions.push_back(&pendingSubmission);
     }
 
-    return queueSubmitLocked(context, priority, submitInfo, scopedBatch, submitQueueSerial);
+    std::lock_guard<angle::SimpleMutex> lock(mQueueSubmitMutex);
+
+    ++mPerfCounters.commandQueueSubmitCallsTotal;
+    ++mPerfCounters.commandQueueSubmitCallsPerFrame;
+    mPerfCounters.commandQueueWaitSemaphoresTotal += waitSemaphores.size();
+
+    // Another thread may have already made this submission along with its own.
+    if (!pendingSubmission.submitted)
+    {
+        submitPendingLocked(context);
+    }
+    ASSERT(pendingSubmission.submitted);
+
+    return pendingSubmission.result;
 }
 
 angle::Result CommandQueue::queueSubmitOneOff(Context *context,
@@ -898,6 +939,10 @@ angle::Result CommandQueue::queueSubmitOneOff(Context *context,
                                               const QueueSerial &submitQueueSerial)
 {
     std::unique_lock<angle::SimpleMutex> lock(mQueueSubmitMutex);
+
+    // Keep the submission order of the batches already queued by other threads.
+    submitPendingLocked(context);
+
     DeviceScoped<CommandBatch> scopedBatch(context->getDevice());
     CommandBatch &batch = scopedBatch.get();
     batch.setQueueSerial(submitQueueSerial);
@@ -938,39 +983,50 @@ angle::Result CommandQueue::queueSubmitOneOff(Context *context,
     return queueSubmitLocked(context, contextPriority, submitInfo, scopedBatch, submitQueueSerial);
 }
 
-angle::Result CommandQueue::queueSubmitLocked(Context *context,
-                                              egl::ContextPriority contextPriority,
-                                              const VkSubmitInfo &submitInfo,
-                                              DeviceScoped<CommandBatch> &commandBatch,
-                                              const QueueSerial &submitQueueSerial)
+angle::Result CommandQueue::ensureInFlightCapacityLocked(Context *context, size_t count)
 {
-    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::queueSubmitLocked");
     Renderer *renderer = context->getRenderer();
+    ASSERT(count <= mInFlightCommands.capacity());
 
     // CPU should be throttled to avoid mInFlightCommands from growing too fast. Important for
     // off-screen scenarios.
-    if (mInFlightCommands.full())
+    if (mInFlightCommands.size() + count > mInFlightCommands.capacity())
     {
         std::lock_guard<angle::SimpleMutex> lock(mCmdCompleteMutex);
         // Check once more inside the lock in case other thread already finished some/all commands.
-        if (mInFlightCommands.full())
+        while (mInFlightCommands.size() + count > mInFlightCommands.capacity())
         {
             ANGLE_TRY(finishOneCommandBatchLocked(context, renderer->getMaxFenceWaitTimeNs()));
         }
     }
-    // Assert will succeed since new batch is pushed only in this method below.
-    ASSERT(!mInFlightCommands.full());
+    // Assert will succeed since new batches are pushed only when holding mQueueSubmitMutex.
+    ASSERT(mInFlightCommands.size() + count <= mInFlightCommands.capacity());
 
     // Also ensure that all mInFlightCommands may be moved into the mFinishedCommandBatches without
     // need of the releaseFinishedCommandsLocked() call.
     ASSERT(mNumAllCommands <= mFinishedCommandBatches.capacity());
-    if (mNumAllCommands == mFinishedCommandBatches.capacity())
+    if (mNumAllCommands + count > mFinishedCommandBatches.capacity())
     {
         std::lock_guard<angle::SimpleMutex> lock(mCmdReleaseMutex);
         ANGLE_TRY(releaseFinishedCommandsLocked(context));
     }
-    // Assert will succeed since mNumAllCommands is incremented only in this method below.
-    ASSERT(mNumAllCommands < mFinishedCommandBatches.capacity());
+    // Assert will succeed since mNumAllCommands is incremented only when holding
+    // mQueueSubmitMutex, and kInFlightCommandsLimit <= kMaxFinishedCommandsLimit.
+    ASSERT(mNumAllCommands + count <= mFinishedCommandBatches.capacity());
+
+    return angle::Result::Continue;
+}
+
+angle::Result CommandQueue::queueSubmitLocked(Context *context,
+                                              egl::ContextPriority contextPriority,
+                                              const VkSubmitInfo &submitInfo,
+                                              DeviceScoped<CommandBatch> &commandBatch,
+                                              const QueueSerial &submitQueueSerial)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::queueSubmitLocked");
+    Renderer *renderer = context->getRenderer();
+
+    ANGLE_TRY(ensureInFlightCapacityLocked(context, 1));
 
     if (submitInfo.sType == VK_STRUCTURE_TYPE_SUBMIT_INFO)
     {
@@ -983,16 +1039,7 @@ angle::Result CommandQueue::queueSubmitLocked(Context *context,
 
         if (batch.getExternalFence())
         {
-            // exportFd is exporting VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT_KHR type handle which
-            // obeys copy semantics. This means that the fence must already be signaled or the work
-            // to signal it is in the graphics pipeline at the time we export the fd.
-            // In other words, must call exportFd() after successful vkQueueSubmit() call.
-            ExternalFence &externalFence       = *batch.getExternalFence();
-            VkFenceGetFdInfoKHR fenceGetFdInfo = {};
-            fenceGetFdInfo.sType               = VK_STRUCTURE_TYPE_FENCE_GET_FD_INFO_KHR;
-            fenceGetFdInfo.fence               = externalFence.getHandle();
-            fenceGetFdInfo.handleType          = VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT_KHR;
-            externalFence.exportFd(renderer->getDevice(), fenceGetFdInfo);
+            ExportExternalFenceFd(renderer->getDevice(), batch.getExternalFence().get());
         }
     }
 
@@ -1004,6 +1051,142 @@ angle::Result CommandQueue::queueSubmitLocked(Context *context,
     return angle::Result::Continue;
 }
 
+void CommandQueue::submitPendingLocked(Context *context)
+{
+    std::vector<PendingSubmission *> pendingSubmissions;
+    {
+        std::lock_guard<angle::SimpleMutex> lock(mPendingSubmissionsMutex);
+        pendingSubmissions.swap(mPendingSubmissions);
+    }
+
+    const size_t maxGroupSize =
+        context->getFeatures().batchQueueSubmitsAcrossContexts.enabled ? kMaxBatchedSubmissions : 1;
+
+    size_t groupBegin = 0;
+    while (groupBegin < pendingSubmissions.size())
+    {
+        // Submissions can be combined as long as they go to the same queue.  The fence of the
+        // vkQueueSubmit call is shared by all batches, so at most one of them may bring its own
+        // external fence, which then signals the completion of the whole group.
+        const PendingSubmission &first = *pendingSubmissions[groupBegin];
+        size_t groupEnd                = groupBegin + 1;
+        bool hasExternalFence          = first.commandBatch->get().getExternalFence() != nullptr;
+        while (groupEnd < pendingSubmissions.size() && groupEnd - groupBegin < maxGroupSize)
+        {
+            const PendingSubmission &next = *pendingSubmissions[groupEnd];
+            const bool nextHasExternalFence =
+                next.commandBatch->get().getExternalFence() != nullptr;
+            if (next.priority != first.priority || next.protectionType != first.protectionType ||
+                (hasExternalFence && nextHasExternalFence))
+            {
+                break;
+            }
+            hasExternalFence = hasExternalFence || nextHasExternalFence;
+            ++groupEnd;
+        }
+
+        // Every submission must be marked as submitted, even after an error, as the threads that
+        // made them are waiting for it.
+        const angle::Result result = submitPendingGroupLocked(
+            context, pendingSubmissions.data() + groupBegin, groupEnd - groupBegin);
+        for (size_t index = groupBegin; index < groupEnd; ++index)
+        {
+            pendingSubmissions[index]->result    = result;
+            pendingSubmissions[index]->submitted = true;
+        }
+
+        groupBegin = groupEnd;
+    }
+}
+
+angle::Result CommandQueue::submitPendingGroupLocked(Context *context,
+                                                     PendingSubmission *const *submissions,
+                                                     size_t count)
+{
+    VkDevice device = context->getDevice();
+
+    // All batches that make it to Vulkan share the fence of the vkQueueSubmit call.  That is the
+    // external fence of the group if any, so a native fence sync exported with this submission
+    // does not require a vkQueueSubmit call of its own.
+    CommandBatch *fencedBatch = nullptr;
+    for (size_t index = 0; index < count; ++index)
+    {
+        CommandBatch &batch = submissions[index]->commandBatch->get();
+        if (batch.getExternalFence())
+        {
+            ASSERT(submissions[index]->submitInfo->sType == VK_STRUCTURE_TYPE_SUBMIT_INFO);
+            fencedBatch = &batch;
+            break;
+        }
+    }
+    for (size_t index = 0; index < count; ++index)
+    {
+        CommandBatch &batch = submissions[index]->commandBatch->get();
+        if (submissions[index]->submitInfo->sType != VK_STRUCTURE_TYPE_SUBMIT_INFO ||
+            &batch == fencedBatch)
+        {
+            continue;
+        }
+
+        if (fencedBatch == nullptr)
+        {
+            ANGLE_VK_TRY(context, batch.initFence(device, &mFenceRecycler));
+            fencedBatch = &batch;
+        }
+        else
+        {
+            batch.shareFence(*fencedBatch);
+        }
+    }
+
+    if (count == 1)
+    {
+        PendingSubmission &submission = *submissions[0];
+        if (submission.submitInfo->sType == VK_STRUCTURE_TYPE_SUBMIT_INFO)
+        {
+            ++mPerfCounters.vkQueueSubmitCallsTotal;
+            ++mPerfCounters.vkQueueSubmitCallsPerFrame;
+        }
+        return queueSubmitLocked(context, submission.priority, *submission.submitInfo,
+                                 *submission.commandBatch, submission.queueSerial);
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::submitPendingGroupLocked");
+    ANGLE_TRY(ensureInFlightCapacityLocked(context, count));
+
+    if (fencedBatch != nullptr)
+    {
+        angle::FixedVector<VkSubmitInfo, kMaxBatchedSubmissions> submitInfos;
+        for (size_t index = 0; index < count; ++index)
+        {
+            if (submissions[index]->submitInfo->sType == VK_STRUCTURE_TYPE_SUBMIT_INFO)
+            {
+                submitInfos.push_back(*submissions[index]->submitInfo);
+            }
+        }
+
+        VkQueue queue = getQueue(submissions[0]->priority);
+        ANGLE_VK_TRY(context, vkQueueSubmit(queue, static_cast<uint32_t>(submitInfos.size()),
+                                            submitInfos.data(), fencedBatch->getFenceHandle()));
+
+        if (fencedBatch->getExternalFence())
+        {
+            ExportExternalFenceFd(device, fencedBatch->getExternalFence().get());
+        }
+
+        ++mPerfCounters.vkQueueSubmitCallsTotal;
+        ++mPerfCounters.vkQueueSubmitCallsPerFrame;
+    }
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        pushInFlightBatchLocked(submissions[index]->commandBatch->release());
+        mLastSubmittedSerials.setQueueSerial(submissions[index]->queueSerial);
+    }
+
+    return angle::Result::Continue;
+}
+
 VkResult CommandQueue::queuePresent(egl::ContextPriority contextPriority,
                                     const VkPresentInfoKHR &presentInfo)
 {
@@ -1292,5 +1475,23 @@ uint32_t QueueFamily::FindIndex(const std::vector<VkQueueFamilyProperties> &queu
     return index;
 }
 
+uint32_t QueueFamily::FindDedicatedIndex(
+    const std::vector<VkQueueFamilyProperties> &queueFamilyProperties,
+    VkQueueFlags flags,
+    VkQueueFlags excludedFlags)
+{
+    for (uint32_t familyIndex = 0; familyIndex < queueFamilyProperties.size(); ++familyIndex)
+    {
+        const auto &queueInfo = queueFamilyProperties[familyIndex];
+        if ((queueInfo.queueFlags & flags) == flags && (queueInfo.queueFlags & excludedFlags) == 0)
+        {
+            ASSERT(queueInfo.queueCount > 0);
+            return familyIndex;
+        }
+    }
+
+    return QueueFamily::kInvalidIndex;
+}
+
 }  // namespace vk
 }  // namespace rx
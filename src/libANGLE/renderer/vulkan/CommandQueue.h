@@ -95,6 +95,8 @@ class CommandBatch final : angle::NonCopyable
                             CommandPoolAccess *commandPoolAccess);
     void setSecondaryCommands(SecondaryCommandBufferCollector &&secondaryCommands);
     VkResult initFence(VkDevice device, FenceRecycler *recycler);
+    // Used when several batches are submitted with a single vkQueueSubmit call.
+    void shareFence(const CommandBatch &other);
     void setExternalFence(SharedExternalFence &&externalFence);
 
     const QueueSerial &getQueueSerial() const;
@@ -132,6 +134,11 @@ class QueueFamily final : angle::NonCopyable
                               VkQueueFlags flags,
                               int32_t matchNumber,  // 0 = first match, 1 = second match ...
                               uint32_t *matchCount);
+    // Returns the first queue family that supports all of |flags| and none of |excludedFlags|.
+    static uint32_t FindDedicatedIndex(
+        const std::vector<VkQueueFamilyProperties> &queueFamilyProperties,
+        VkQueueFlags flags,
+        VkQueueFlags excludedFlags);
     static const uint32_t kQueueCount = static_cast<uint32_t>(egl::ContextPriority::EnumCount);
     static const float kQueuePriorities[static_cast<uint32_t>(egl::ContextPriority::EnumCount)];
 
@@ -145,6 +152,7 @@ class QueueFamily final : angle::NonCopyable
     const VkQueueFamilyProperties *getProperties() const { return &mProperties; }
     bool isGraphics() const { return ((mProperties.queueFlags & VK_QUEUE_GRAPHICS_BIT) > 0); }
     bool isCompute() const { return ((mProperties.queueFlags & VK_QUEUE_COMPUTE_BIT) > 0); }
+    bool isTransfer() const { return ((mProperties.queueFlags & VK_QUEUE_TRANSFER_BIT) > 0); }
     bool supportsProtected() const
     {
         return ((mProperties.queueFlags & VK_QUEUE_PROTECTED_BIT) > 0);
@@ -410,6 +418,10 @@ class CommandQueue : angle::NonCopyable
     const angle::VulkanPerfCounters getPerfCounters() const;
     void resetPerFramePerfCounters();
 
+    // The number of submitted batches the GPU has not finished yet.  FixedQueue::size() is safe to
+    // call without the locks.
+    size_t getInFlightCommandBatchCount() const { return mInFlightCommands.size(); }
+
     // Release finished commands and clean up garbage immediately, or request async clean up if
     // enabled.
     angle::Result releaseFinishedCommandsAndCleanupGarbage(Context *context);
@@ -440,11 +452,33 @@ class CommandQueue : angle::NonCopyable
     // finished
     angle::Result checkCompletedCommandsLocked(Context *context);
 
+    // A submission prepared by submitCommands() that waits for the thread holding
+    // mQueueSubmitMutex to hand it to Vulkan.  Everything it points to lives on the stack of the
+    // thread that made the submission, which blocks on mQueueSubmitMutex until |submitted| is set.
+    struct PendingSubmission
+    {
+        egl::ContextPriority priority;
+        ProtectionType protectionType;
+        const VkSubmitInfo *submitInfo;
+        DeviceScoped<CommandBatch> *commandBatch;
+        QueueSerial queueSerial;
+        bool submitted;
+        angle::Result result;
+    };
+
+    // Makes room in mInFlightCommands and mFinishedCommandBatches for |count| more batches.
+    angle::Result ensureInFlightCapacityLocked(Context *context, size_t count);
     angle::Result queueSubmitLocked(Context *context,
                                     egl::ContextPriority contextPriority,
                                     const VkSubmitInfo &submitInfo,
                                     DeviceScoped<CommandBatch> &commandBatch,
                                     const QueueSerial &submitQueueSerial);
+    // Submits everything in mPendingSubmissions in order, combining consecutive submissions to the
+    // same queue into one vkQueueSubmit call if batchQueueSubmitsAcrossContexts is enabled.
+    void submitPendingLocked(Context *context);
+    angle::Result submitPendingGroupLocked(Context *context,
+                                           PendingSubmission *const *submissions,
+                                           size_t count);
 
     void pushInFlightBatchLocked(CommandBatch &&batch);
     void moveInFlightBatchToFinishedQueueLocked(CommandBatch &&batch);
@@ -462,6 +496,11 @@ class CommandQueue : angle::NonCopyable
     angle::SimpleMutex mCmdCompleteMutex;
     // Protect multi-thread access to mFinishedCommandBatches.pop/front.
     angle::SimpleMutex mCmdReleaseMutex;
+    // Protect multi-thread access to mPendingSubmissions.  Also held while the commands of a
+    // submission are gathered, so that submissions are queued in the order they took the commands.
+    angle::SimpleMutex mPendingSubmissionsMutex;
+
+    std::vector<PendingSubmission *> mPendingSubmissions;
 
     CommandBatchQueue mInFlightCommands;
     // Temporary storage for finished command batches that should be reset.
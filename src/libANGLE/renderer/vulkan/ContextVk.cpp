@@ -61,6 +61,13 @@ static constexpr size_t kMaxReservedOutsideRenderPassQueueSerials = 15;
 // Dumping the command stream is disabled by default.
 static constexpr bool kEnableCommandStreamDiagnostics = false;
 
+// Environment variable (and Android property) to record GPU trace events in only one of every N
+// frames.
+constexpr char kGpuEventFrameIntervalVarName[] = "ANGLE_VULKAN_GPU_EVENT_FRAME_INTERVAL";
+constexpr char kAndroidGpuEventFrameInterval[] = "debug.angle.vulkan.gpu_event_frame_interval";
+// Limit the GPU pass timeline shown in the overlay to what fits in its text widget.
+constexpr size_t kMaxGpuPassTimelineLength = 150;
+
 // All glMemoryBarrier bits that related to texture usage
 static constexpr GLbitfield kWriteAfterAccessImageMemoryBarriers =
     GL_SHADER_IMAGE_ACCESS_BARRIER_BIT;
@@ -118,24 +125,6 @@ struct ComputeDriverUniforms
     std::array<uint32_t, 4> acbBufferOffsets;
 };
 
-uint32_t MakeFlipUniform(bool flipX, bool flipY, bool invertViewport)
-{
-    // Create snorm values of either -1 or 1, based on whether flipping is enabled or not
-    // respectively.
-    constexpr uint8_t kSnormOne      = 0x7F;
-    constexpr uint8_t kSnormMinusOne = 0x81;
-
-    // .xy are flips for the fragment stage.
-    uint32_t x = flipX ? kSnormMinusOne : kSnormOne;
-    uint32_t y = flipY ? kSnormMinusOne : kSnormOne;
-
-    // .zw are flips for the vertex stage.
-    uint32_t z = x;
-    uint32_t w = flipY != invertViewport ? kSnormMinusOne : kSnormOne;
-
-    return x | y << 8 | z << 16 | w << 24;
-}
-
 GLenum DefaultGLErrorCode(VkResult result)
 {
     switch (result)
@@ -545,7 +534,8 @@ vk::ImageLayout GetImageWriteLayoutAndSubresource(const gl::ImageUnit &imageUnit
 }
 
 template <typename CommandBufferT>
-void OnTextureBufferRead(vk::BufferHelper *buffer,
+void OnTextureBufferRead(vk::Context *context,
+                         vk::BufferHelper *buffer,
                          gl::ShaderBitSet stages,
                          CommandBufferT *commandBufferHelper)
 {
@@ -557,12 +547,13 @@ void OnTextureBufferRead(vk::BufferHelper *buffer,
         // Note: if another range of the same buffer is simultaneously used for storage,
         // such as for transform feedback output, or SSBO, unnecessary barriers can be
         // generated.
-        commandBufferHelper->bufferRead(VK_ACCESS_SHADER_READ_BIT, vk::GetPipelineStage(stage),
-                                        buffer);
+        commandBufferHelper->bufferRead(context, VK_ACCESS_SHADER_READ_BIT,
+                                        vk::GetPipelineStage(stage), buffer);
     }
 }
 
-void OnImageBufferWrite(BufferVk *bufferVk,
+void OnImageBufferWrite(vk::Context *context,
+                        BufferVk *bufferVk,
                         gl::ShaderBitSet stages,
                         vk::CommandBufferHelperCommon *commandBufferHelper)
 {
@@ -571,7 +562,8 @@ void OnImageBufferWrite(BufferVk *bufferVk,
     // TODO: accept multiple stages in bufferWrite.  http://anglebug.com/42262235
     for (gl::ShaderType stage : stages)
     {
-        commandBufferHelper->bufferWrite(VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+        commandBufferHelper->bufferWrite(context,
+                                         VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
                                          vk::GetPipelineStage(stage), &buffer);
     }
 }
@@ -837,6 +829,21 @@ void GenerateTextureUnitSamplerIndexMap(
             {samplerBoundTextureUnits[samplerIndex], static_cast<uint32_t>(samplerIndex)});
     }
 }
+
+// Collects descriptor cache stats without going through ContextVk's own accumulator.
+class CacheStatsAccumulator final : angle::NonCopyable
+{
+  public:
+    CacheStatsAccumulator(VulkanCacheStats *cacheStats) : mCacheStats(cacheStats) {}
+
+    void accumulateCacheStats(VulkanCacheType cache, const CacheStats &stats)
+    {
+        (*mCacheStats)[cache].accumulate(stats);
+    }
+
+  private:
+    VulkanCacheStats *mCacheStats;
+};
 }  // anonymous namespace
 
 void ContextVk::flushDescriptorSetUpdates()
@@ -880,7 +887,12 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mCurrentGraphicsPipelineVertexInput(nullptr),
       mCurrentGraphicsPipelineFragmentOutput(nullptr),
       mCurrentComputePipeline(nullptr),
+      mPendingGraphicsPipeline(nullptr),
+      mPendingGraphicsPipelineFallback(nullptr),
+      mSkipDrawForPendingGraphicsPipeline(false),
       mCurrentDrawMode(gl::PrimitiveMode::InvalidEnum),
+      mIsFramebufferFetchWriteTracked(false),
+      mFramebufferFetchTrackedWriteCommandCount(0),
       mCurrentWindowSurface(nullptr),
       mCurrentRotationDrawFramebuffer(SurfaceRotation::Identity),
       mCurrentRotationReadFramebuffer(SurfaceRotation::Identity),
@@ -900,10 +912,14 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
       mFlipViewportForReadFramebuffer(false),
       mIsAnyHostVisibleBufferWritten(false),
       mCurrentQueueSerialIndex(kInvalidQueueSerialIndex),
+      mIsBatchingObjectDeletion(false),
       mOutsideRenderPassCommands(nullptr),
       mRenderPassCommands(nullptr),
       mQueryEventType(GraphicsEventCmdBuf::NotInQueryCmd),
       mGpuEventsEnabled(false),
+      mGpuEventsSampled(false),
+      mGpuEventFrameInterval(1),
+      mGpuEventFrameCounter(0),
       mPrimaryBufferEventCounter(0),
       mHasDeferredFlush(false),
       mHasAnyCommandsPendingSubmission(false),
@@ -955,6 +971,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
     mNewComputeCommandBufferDirtyBits =
         DirtyBits{DIRTY_BIT_PIPELINE_BINDING, DIRTY_BIT_TEXTURES, DIRTY_BIT_SHADER_RESOURCES,
                   DIRTY_BIT_DESCRIPTOR_SETS, DIRTY_BIT_DRIVER_UNIFORMS};
+    mComputeBarrierDirtyBits = DirtyBits{DIRTY_BIT_MEMORY_BARRIER, DIRTY_BIT_TEXTURES,
+                                         DIRTY_BIT_SHADER_RESOURCES, DIRTY_BIT_UNIFORM_BUFFERS};
 
     mDynamicStateDirtyBits = DirtyBits{
         DIRTY_BIT_DYNAMIC_VIEWPORT,           DIRTY_BIT_DYNAMIC_SCISSOR,
@@ -1011,6 +1029,10 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
     {
         mDynamicStateDirtyBits.set(DIRTY_BIT_DYNAMIC_LOGIC_OP);
     }
+    if (mRenderer->getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        mDynamicStateDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+    }
     if (getFeatures().supportsFragmentShadingRate.enabled)
     {
         mDynamicStateDirtyBits.set(DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE);
@@ -1019,110 +1041,124 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, vk::Rendere
     mNewGraphicsCommandBufferDirtyBits |= mDynamicStateDirtyBits;
 
     mGraphicsDirtyBitHandlers[DIRTY_BIT_MEMORY_BARRIER] =
-        &ContextVk::handleDirtyGraphicsMemoryBarrier;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsMemoryBarrier>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DEFAULT_ATTRIBS] =
-        &ContextVk::handleDirtyGraphicsDefaultAttribs;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDefaultAttribs>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_PIPELINE_DESC] =
-        &ContextVk::handleDirtyGraphicsPipelineDesc;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsPipelineDesc>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_READ_ONLY_DEPTH_FEEDBACK_LOOP_MODE] =
-        &ContextVk::handleDirtyGraphicsReadOnlyDepthFeedbackLoopMode;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsReadOnlyDepthFeedbackLoopMode>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_ANY_SAMPLE_PASSED_QUERY_END] =
-        &ContextVk::handleDirtyAnySamplePassedQueryEnd;
-    mGraphicsDirtyBitHandlers[DIRTY_BIT_RENDER_PASS]  = &ContextVk::handleDirtyGraphicsRenderPass;
-    mGraphicsDirtyBitHandlers[DIRTY_BIT_EVENT_LOG]    = &ContextVk::handleDirtyGraphicsEventLog;
-    mGraphicsDirtyBitHandlers[DIRTY_BIT_COLOR_ACCESS] = &ContextVk::handleDirtyGraphicsColorAccess;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyAnySamplePassedQueryEnd>;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_RENDER_PASS] =
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsRenderPass>;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_EVENT_LOG] =
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsEventLog>;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_COLOR_ACCESS] =
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsColorAccess>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DEPTH_STENCIL_ACCESS] =
-        &ContextVk::handleDirtyGraphicsDepthStencilAccess;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDepthStencilAccess>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_PIPELINE_BINDING] =
-        &ContextVk::handleDirtyGraphicsPipelineBinding;
-    mGraphicsDirtyBitHandlers[DIRTY_BIT_TEXTURES] = &ContextVk::handleDirtyGraphicsTextures;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsPipelineBinding>;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_TEXTURES] =
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsTextures>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_VERTEX_BUFFERS] =
-        &ContextVk::handleDirtyGraphicsVertexBuffers;
-    mGraphicsDirtyBitHandlers[DIRTY_BIT_INDEX_BUFFER] = &ContextVk::handleDirtyGraphicsIndexBuffer;
-    mGraphicsDirtyBitHandlers[DIRTY_BIT_UNIFORMS]     = &ContextVk::handleDirtyGraphicsUniforms;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsVertexBuffers>;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_INDEX_BUFFER] =
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsIndexBuffer>;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_UNIFORMS] =
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsUniforms>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DRIVER_UNIFORMS] =
-        &ContextVk::handleDirtyGraphicsDriverUniforms;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDriverUniforms>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_SHADER_RESOURCES] =
-        &ContextVk::handleDirtyGraphicsShaderResources;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsShaderResources>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_UNIFORM_BUFFERS] =
-        &ContextVk::handleDirtyGraphicsUniformBuffers;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsUniformBuffers>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_FRAMEBUFFER_FETCH_BARRIER] =
-        &ContextVk::handleDirtyGraphicsFramebufferFetchBarrier;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsFramebufferFetchBarrier>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_BLEND_BARRIER] =
-        &ContextVk::handleDirtyGraphicsBlendBarrier;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsBlendBarrier>;
     if (getFeatures().supportsTransformFeedbackExtension.enabled)
     {
         mGraphicsDirtyBitHandlers[DIRTY_BIT_TRANSFORM_FEEDBACK_BUFFERS] =
-            &ContextVk::handleDirtyGraphicsTransformFeedbackBuffersExtension;
+            &DispatchGraphicsDirtyBit<
+                &ContextVk::handleDirtyGraphicsTransformFeedbackBuffersExtension>;
         mGraphicsDirtyBitHandlers[DIRTY_BIT_TRANSFORM_FEEDBACK_RESUME] =
-            &ContextVk::handleDirtyGraphicsTransformFeedbackResume;
+            &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsTransformFeedbackResume>;
     }
     else if (getFeatures().emulateTransformFeedback.enabled)
     {
         mGraphicsDirtyBitHandlers[DIRTY_BIT_TRANSFORM_FEEDBACK_BUFFERS] =
-            &ContextVk::handleDirtyGraphicsTransformFeedbackBuffersEmulation;
+            &DispatchGraphicsDirtyBit<
+                &ContextVk::handleDirtyGraphicsTransformFeedbackBuffersEmulation>;
     }
 
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DESCRIPTOR_SETS] =
-        &ContextVk::handleDirtyGraphicsDescriptorSets;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDescriptorSets>;
 
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_VIEWPORT] =
-        &ContextVk::handleDirtyGraphicsDynamicViewport;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicViewport>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_SCISSOR] =
-        &ContextVk::handleDirtyGraphicsDynamicScissor;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicScissor>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_LINE_WIDTH] =
-        &ContextVk::handleDirtyGraphicsDynamicLineWidth;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicLineWidth>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_DEPTH_BIAS] =
-        &ContextVk::handleDirtyGraphicsDynamicDepthBias;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicDepthBias>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_BLEND_CONSTANTS] =
-        &ContextVk::handleDirtyGraphicsDynamicBlendConstants;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicBlendConstants>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_STENCIL_COMPARE_MASK] =
-        &ContextVk::handleDirtyGraphicsDynamicStencilCompareMask;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicStencilCompareMask>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_STENCIL_WRITE_MASK] =
-        &ContextVk::handleDirtyGraphicsDynamicStencilWriteMask;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicStencilWriteMask>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_STENCIL_REFERENCE] =
-        &ContextVk::handleDirtyGraphicsDynamicStencilReference;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicStencilReference>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_CULL_MODE] =
-        &ContextVk::handleDirtyGraphicsDynamicCullMode;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicCullMode>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_FRONT_FACE] =
-        &ContextVk::handleDirtyGraphicsDynamicFrontFace;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicFrontFace>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_DEPTH_TEST_ENABLE] =
-        &ContextVk::handleDirtyGraphicsDynamicDepthTestEnable;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicDepthTestEnable>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_DEPTH_WRITE_ENABLE] =
-        &ContextVk::handleDirtyGraphicsDynamicDepthWriteEnable;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicDepthWriteEnable>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_DEPTH_COMPARE_OP] =
-        &ContextVk::handleDirtyGraphicsDynamicDepthCompareOp;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicDepthCompareOp>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_STENCIL_TEST_ENABLE] =
-        &ContextVk::handleDirtyGraphicsDynamicStencilTestEnable;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicStencilTestEnable>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_STENCIL_OP] =
-        &ContextVk::handleDirtyGraphicsDynamicStencilOp;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicStencilOp>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_RASTERIZER_DISCARD_ENABLE] =
-        &ContextVk::handleDirtyGraphicsDynamicRasterizerDiscardEnable;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicRasterizerDiscardEnable>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_DEPTH_BIAS_ENABLE] =
-        &ContextVk::handleDirtyGraphicsDynamicDepthBiasEnable;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicDepthBiasEnable>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_LOGIC_OP] =
-        &ContextVk::handleDirtyGraphicsDynamicLogicOp;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicLogicOp>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_PRIMITIVE_RESTART_ENABLE] =
-        &ContextVk::handleDirtyGraphicsDynamicPrimitiveRestartEnable;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicPrimitiveRestartEnable>;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION] =
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicColorBlendEquation>;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE] =
-        &ContextVk::handleDirtyGraphicsDynamicFragmentShadingRate;
+        &DispatchGraphicsDirtyBit<&ContextVk::handleDirtyGraphicsDynamicFragmentShadingRate>;
 
     mComputeDirtyBitHandlers[DIRTY_BIT_MEMORY_BARRIER] =
-        &ContextVk::handleDirtyComputeMemoryBarrier;
-    mComputeDirtyBitHandlers[DIRTY_BIT_EVENT_LOG]     = &ContextVk::handleDirtyComputeEventLog;
-    mComputeDirtyBitHandlers[DIRTY_BIT_PIPELINE_DESC] = &ContextVk::handleDirtyComputePipelineDesc;
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeMemoryBarrier>;
+    mComputeDirtyBitHandlers[DIRTY_BIT_EVENT_LOG] =
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeEventLog>;
+    mComputeDirtyBitHandlers[DIRTY_BIT_PIPELINE_DESC] =
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputePipelineDesc>;
     mComputeDirtyBitHandlers[DIRTY_BIT_PIPELINE_BINDING] =
-        &ContextVk::handleDirtyComputePipelineBinding;
-    mComputeDirtyBitHandlers[DIRTY_BIT_TEXTURES] = &ContextVk::handleDirtyComputeTextures;
-    mComputeDirtyBitHandlers[DIRTY_BIT_UNIFORMS] = &ContextVk::handleDirtyComputeUniforms;
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputePipelineBinding>;
+    mComputeDirtyBitHandlers[DIRTY_BIT_TEXTURES] =
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeTextures>;
+    mComputeDirtyBitHandlers[DIRTY_BIT_UNIFORMS] =
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeUniforms>;
     mComputeDirtyBitHandlers[DIRTY_BIT_DRIVER_UNIFORMS] =
-        &ContextVk::handleDirtyComputeDriverUniforms;
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeDriverUniforms>;
     mComputeDirtyBitHandlers[DIRTY_BIT_SHADER_RESOURCES] =
-        &ContextVk::handleDirtyComputeShaderResources;
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeShaderResources>;
     mComputeDirtyBitHandlers[DIRTY_BIT_UNIFORM_BUFFERS] =
-        &ContextVk::handleDirtyComputeUniformBuffers;
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeUniformBuffers>;
     mComputeDirtyBitHandlers[DIRTY_BIT_DESCRIPTOR_SETS] =
-        &ContextVk::handleDirtyComputeDescriptorSets;
+        &DispatchComputeDirtyBit<&ContextVk::handleDirtyComputeDescriptorSets>;
 
     mGraphicsDirtyBits = mNewGraphicsCommandBufferDirtyBits;
     mComputeDirtyBits  = mNewComputeCommandBufferDirtyBits;
@@ -1335,8 +1371,10 @@ void ContextVk::onDestroy(const gl::Context *context)
 
     mCommandPools.outsideRenderPassPool.destroy(device);
     mCommandPools.renderPassPool.destroy(device);
+    mParallelCommandEncoder.destroy(device);
 
     ASSERT(mCurrentGarbage.empty());
+    ASSERT(!mIsBatchingObjectDeletion && mObjectDeletionGarbage.empty());
 
     if (mCurrentQueueSerialIndex != kInvalidQueueSerialIndex)
     {
@@ -1421,6 +1459,7 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
         buffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment,
                     kDynamicVertexDataSize, true);
     }
+    mStreamedVertexBufferGenerations.fill(0);
 
 #if ANGLE_ENABLE_VULKAN_GPU_TRACE_EVENTS
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
@@ -1431,6 +1470,14 @@ angle::Result ContextVk::initialize(const angle::ImageLoadContext &imageLoadCont
     const unsigned char *gpuEventsEnabled =
         platform->getTraceCategoryEnabledFlag(platform, "gpu.angle.gpu");
     mGpuEventsEnabled = gpuEventsEnabled && *gpuEventsEnabled;
+    mGpuEventsSampled = mGpuEventsEnabled;
+
+    const std::string frameIntervalFromEnv = angle::GetEnvironmentVarOrAndroidProperty(
+        kGpuEventFrameIntervalVarName, kAndroidGpuEventFrameInterval);
+    if (!frameIntervalFromEnv.empty())
+    {
+        mGpuEventFrameInterval = std::max(atoi(frameIntervalFromEnv.c_str()), 1);
+    }
 #endif
 
     // Assign initial command buffers from queue
@@ -1591,6 +1638,21 @@ angle::Result ContextVk::finish(const gl::Context *context)
 angle::Result ContextVk::onFramebufferBoundary(const gl::Context *contextGL)
 {
     mShareGroupVk->onFramebufferBoundary();
+
+    if (mGpuEventsEnabled)
+    {
+        ANGLE_TRY(updateGpuEventSampling());
+    }
+
+    if (ANGLE_TRACE_COUNTERS_ENABLED("gpu.angle"))
+    {
+        traceCounters();
+    }
+
+    if (mRenderer->getFeatures().defragmentBufferPools.enabled)
+    {
+        ANGLE_TRY(mShareGroupVk->relocateBuffersFromEvacuatingBlocks(this));
+    }
     return mRenderer->syncPipelineCacheVk(this, mRenderer->getGlobalOps(), contextGL);
 }
 
@@ -1641,6 +1703,24 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
         invalidateGraphicsDriverUniforms();
     }
 
+    // Periodically start a new chunk of commands in the render pass, so the render pass can be
+    // encoded in parallel.
+    if (mParallelCommandEncoder.valid() && hasActiveRenderPass() &&
+        mRenderPassCommands->shouldInsertParallelEncodeBoundary() &&
+        canInsertParallelEncodeBoundary())
+    {
+        insertParallelEncodeBoundary();
+    }
+
+    // While the current pipeline is being created asynchronously, a fallback is bound in its
+    // place.  Keep rebinding on every draw, so the actual pipeline is picked up as soon as it's
+    // ready.
+    if (ANGLE_UNLIKELY(mCurrentGraphicsPipeline != nullptr &&
+                       mCurrentGraphicsPipeline->isCreationPending()))
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_PIPELINE_BINDING);
+    }
+
     DirtyBits dirtyBits = mGraphicsDirtyBits & dirtyBitMask;
 
     if (dirtyBits.any())
@@ -1650,8 +1730,7 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
              ++dirtyBitIter)
         {
             ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
-            ANGLE_TRY(
-                (this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
+            ANGLE_TRY(mGraphicsDirtyBitHandlers[*dirtyBitIter](this, &dirtyBitIter, dirtyBitMask));
         }
 
         // Reset the processed dirty bits, except for those that are expected to persist between
@@ -1665,6 +1744,19 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
 
     ASSERT(mState.getAndResetDirtyUniformBlocks().none());
 
+    // If no pipeline could be bound, drop the draw call.  No error is generated, so the front-end
+    // silently stops processing this draw call.
+    if (ANGLE_UNLIKELY(mSkipDrawForPendingGraphicsPipeline))
+    {
+        mSkipDrawForPendingGraphicsPipeline = false;
+        return angle::Result::Stop;
+    }
+
+    if (mIsFramebufferFetchWriteTracked)
+    {
+        trackFramebufferFetchDrawWrite();
+    }
+
     return angle::Result::Continue;
 }
 
@@ -1778,7 +1870,7 @@ angle::Result ContextVk::setupIndirectDraw(const gl::Context *context,
                         gl::DrawElementsType::InvalidEnum, nullptr, dirtyBitMask));
 
     // Process indirect buffer after render pass has started.
-    mRenderPassCommands->bufferRead(VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+    mRenderPassCommands->bufferRead(this, VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
                                     vk::PipelineStage::DrawIndirect, indirectBuffer);
 
     return angle::Result::Continue;
@@ -1887,17 +1979,23 @@ angle::Result ContextVk::setupLineLoopDraw(const gl::Context *context,
 
 angle::Result ContextVk::setupDispatch(const gl::Context *context)
 {
-    // TODO: We don't currently check if this flush is necessary.  It serves to make sure the
-    // barriers issued during dirty bit handling aren't reordered too early.
-    // http://anglebug.com/382090958
-    ANGLE_TRY(flushOutsideRenderPassCommands());
-
     ProgramExecutableVk *executableVk = vk::GetImpl(mState.getProgramExecutable());
     if (executableVk->updateAndCheckDirtyUniforms())
     {
         mComputeDirtyBits.set(DIRTY_BIT_UNIFORMS);
     }
 
+    // The barriers issued during dirty bit handling are executed before all the commands already
+    // recorded in the outside render pass command buffer, so it's flushed first if there could be
+    // any.  Otherwise, e.g. for back-to-back dispatches with the same resources, the dispatch is
+    // recorded in the same command buffer and the pipeline and descriptor sets are not rebound.
+    // Note that glMemoryBarrier already flushes the commands if they have any storage output.
+    // http://anglebug.com/382090958
+    if ((mComputeDirtyBits & mComputeBarrierDirtyBits).any())
+    {
+        ANGLE_TRY(flushOutsideRenderPassCommands());
+    }
+
     DirtyBits dirtyBits = mComputeDirtyBits;
 
     // Flush any relevant dirty bits.
@@ -1905,7 +2003,7 @@ angle::Result ContextVk::setupDispatch(const gl::Context *context)
          ++dirtyBitIter)
     {
         ASSERT(mComputeDirtyBitHandlers[*dirtyBitIter]);
-        ANGLE_TRY((this->*mComputeDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter));
+        ANGLE_TRY(mComputeDirtyBitHandlers[*dirtyBitIter](this, &dirtyBitIter));
     }
 
     mComputeDirtyBits.reset();
@@ -2159,7 +2257,8 @@ angle::Result ContextVk::createGraphicsPipeline()
     executableVk->waitForGraphicsPostLinkTasks(this, *mGraphicsPipelineDesc);
 
     vk::PipelineCacheAccess pipelineCache;
-    ANGLE_TRY(mRenderer->getPipelineCache(this, &pipelineCache));
+    ANGLE_TRY(mRenderer->getPipelineCache(this, executableVk->getPipelineCacheShardKey(),
+                                          &pipelineCache));
 
     vk::PipelineHelper *oldGraphicsPipeline = mCurrentGraphicsPipeline;
 
@@ -2182,9 +2281,21 @@ angle::Result ContextVk::createGraphicsPipeline()
         ASSERT(descPtr == nullptr);
         if (!getFeatures().supportsGraphicsPipelineLibrary.enabled)
         {
-            ANGLE_TRY(executableVk->createGraphicsPipeline(
-                this, vk::GraphicsPipelineSubset::Complete, &pipelineCache, PipelineSource::Draw,
-                *mGraphicsPipelineDesc, &descPtr, &mCurrentGraphicsPipeline));
+            if (getFeatures().asyncGraphicsPipelineCreationOnCacheMiss.enabled)
+            {
+                // Avoid stalling the draw call on pipeline creation; the pipeline is created on a
+                // worker thread, see handleDirtyGraphicsPipelineBinding().
+                ANGLE_TRY(executableVk->createGraphicsPipelineAsync(
+                    this, &pipelineCache, *mGraphicsPipelineDesc, &descPtr,
+                    &mCurrentGraphicsPipeline));
+            }
+            else
+            {
+                ANGLE_TRY(executableVk->createGraphicsPipeline(
+                    this, vk::GraphicsPipelineSubset::Complete, &pipelineCache,
+                    PipelineSource::Draw, *mGraphicsPipelineDesc, &descPtr,
+                    &mCurrentGraphicsPipeline));
+            }
         }
         else
         {
@@ -2251,6 +2362,11 @@ angle::Result ContextVk::createGraphicsPipeline()
                 interfacePipelineCache = &interfacePipelineCacheStorage;
             }
 
+            if (!mShareGroupVk->hasWarmedUpInterfacePipelines())
+            {
+                ANGLE_TRY(warmUpInterfacePipelines(interfacePipelineCache));
+            }
+
             // Recreate the vertex input subset if necessary
             ANGLE_TRY(CreateGraphicsPipelineSubset(
                 this, *mGraphicsPipelineDesc,
@@ -2308,7 +2424,7 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
     // If one can be found in the transition cache, recover it.
     if (mCurrentGraphicsPipeline != nullptr && mGraphicsPipelineTransition.any())
     {
-        ASSERT(mCurrentGraphicsPipeline->valid());
+        ASSERT(mCurrentGraphicsPipeline->valid() || mCurrentGraphicsPipeline->isCreationPending());
         shouldRecreatePipeline = !mCurrentGraphicsPipeline->findTransition(
             mGraphicsPipelineTransition, *mGraphicsPipelineDesc, &mCurrentGraphicsPipeline);
     }
@@ -2322,7 +2438,8 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
     mGraphicsPipelineTransition.reset();
 
     // Update the queue serial for the pipeline object.
-    ASSERT(mCurrentGraphicsPipeline && mCurrentGraphicsPipeline->valid());
+    ASSERT(mCurrentGraphicsPipeline && (mCurrentGraphicsPipeline->valid() ||
+                                        mCurrentGraphicsPipeline->isCreationPending()));
 
     const VkPipeline newPipeline = mCurrentGraphicsPipeline->getPipeline().getHandle();
 
@@ -2557,21 +2674,69 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineBinding(DirtyBits::Iterator
     const vk::Pipeline *pipeline = nullptr;
     ANGLE_TRY(mCurrentGraphicsPipeline->getPreferredPipeline(this, &pipeline));
 
+    if (ANGLE_UNLIKELY(!pipeline->valid()))
+    {
+        ANGLE_TRY(getPipelineForPendingGraphicsPipeline(&pipeline));
+        if (pipeline == nullptr)
+        {
+            mSkipDrawForPendingGraphicsPipeline = true;
+            return angle::Result::Continue;
+        }
+    }
+
     mRenderPassCommandBuffer->bindGraphicsPipeline(*pipeline);
 
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::getPipelineForPendingGraphicsPipeline(const vk::Pipeline **pipelineOut)
+{
+    ASSERT(mCurrentGraphicsPipeline->isCreationPending());
+
+    if (mPendingGraphicsPipeline != mCurrentGraphicsPipeline)
+    {
+        ProgramExecutableVk *executableVk = vk::GetImpl(mState.getProgramExecutable());
+        mPendingGraphicsPipeline          = mCurrentGraphicsPipeline;
+        mPendingGraphicsPipelineFallback =
+            executableVk->getCompatibleGraphicsPipeline(this, *mGraphicsPipelineDesc);
+    }
+
+    // Prefer drawing with a pipeline that is close enough.  The results may be slightly off until
+    // the actual pipeline is created.
+    if (mPendingGraphicsPipelineFallback != nullptr)
+    {
+        ++mPerfCounters.pendingGraphicsPipelineFallbacks;
+        mPendingGraphicsPipelineFallback->retainInRenderPass(mRenderPassCommands);
+        *pipelineOut = &mPendingGraphicsPipelineFallback->getPipeline();
+        return angle::Result::Continue;
+    }
+
+    // Otherwise if allowed, skip the draw entirely.
+    if (getFeatures().skipDrawOnPendingGraphicsPipeline.enabled)
+    {
+        ++mPerfCounters.pendingGraphicsPipelineSkippedDraws;
+        *pipelineOut = nullptr;
+        return angle::Result::Continue;
+    }
+
+    // As a last resort, wait for the pipeline to be created.
+    ++mPerfCounters.pendingGraphicsPipelineWaits;
+    ANGLE_TRY(mCurrentGraphicsPipeline->waitForPendingCreation(this));
+    *pipelineOut = &mCurrentGraphicsPipeline->getPipeline();
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::handleDirtyComputePipelineDesc(DirtyBits::Iterator *dirtyBitsIterator)
 {
     if (mCurrentComputePipeline == nullptr)
     {
-        vk::PipelineCacheAccess pipelineCache;
-        ANGLE_TRY(mRenderer->getPipelineCache(this, &pipelineCache));
-
         ProgramExecutableVk *executableVk = vk::GetImpl(mState.getProgramExecutable());
         ASSERT(executableVk);
 
+        vk::PipelineCacheAccess pipelineCache;
+        ANGLE_TRY(mRenderer->getPipelineCache(this, executableVk->getPipelineCacheShardKey(),
+                                              &pipelineCache));
+
         executableVk->waitForComputePostLinkTasks(this);
         ANGLE_TRY(executableVk->getOrCreateComputePipeline(
             this, &pipelineCache, PipelineSource::Draw, pipelineRobustness(),
@@ -2614,7 +2779,7 @@ ANGLE_INLINE angle::Result ContextVk::handleDirtyTexturesImpl(
             const gl::ShaderBitSet stages =
                 executable->getSamplerShaderBitsForTextureUnitIndex(textureUnit);
 
-            OnTextureBufferRead(buffer, stages, commandBufferHelper);
+            OnTextureBufferRead(this, buffer, stages, commandBufferHelper);
 
             textureVk->retainBufferViews(commandBufferHelper);
             continue;
@@ -2778,7 +2943,7 @@ angle::Result ContextVk::handleDirtyGraphicsVertexBuffers(DirtyBits::Iterator *d
         vk::BufferHelper *arrayBuffer = arrayBufferResources[attribIndex];
         if (arrayBuffer)
         {
-            mRenderPassCommands->bufferRead(VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
+            mRenderPassCommands->bufferRead(this, VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT,
                                             vk::PipelineStage::VertexInput, arrayBuffer);
         }
     }
@@ -2799,16 +2964,78 @@ angle::Result ContextVk::handleDirtyGraphicsIndexBuffer(DirtyBits::Iterator *dir
     mRenderPassCommandBuffer->bindIndexBuffer(buffer, bufferOffset + mCurrentIndexBufferOffset,
                                               getVkIndexType(mCurrentDrawElementsType));
 
-    mRenderPassCommands->bufferRead(VK_ACCESS_INDEX_READ_BIT, vk::PipelineStage::VertexInput,
-                                    elementArrayBuffer);
+    mRenderPassCommands->bufferRead(this, VK_ACCESS_INDEX_READ_BIT,
+                                    vk::PipelineStage::VertexInput, elementArrayBuffer);
 
     return angle::Result::Continue;
 }
 
+bool ContextVk::isFramebufferFetchBarrierNeeded() const
+{
+    if (!mIsFramebufferFetchWriteTracked)
+    {
+        return true;
+    }
+
+    // In a new render pass, nothing was written yet unless the write command count says so.
+    const uint32_t writeCommandCount = mRenderPassCommands->getRenderPassWriteCommandCount();
+    if (mFramebufferFetchRenderPassQueueSerial != mRenderPassCommands->getQueueSerial())
+    {
+        return writeCommandCount != 0;
+    }
+
+    if (writeCommandCount != mFramebufferFetchTrackedWriteCommandCount)
+    {
+        return true;
+    }
+
+    // Draws don't write outside the scissor, so a draw that doesn't overlap the area written since
+    // the last barrier can't read any of it.
+    const gl::Rectangle drawArea(mScissor.offset.x, mScissor.offset.y, mScissor.extent.width,
+                                 mScissor.extent.height);
+    return gl::ClipRectangle(drawArea, mFramebufferFetchUnsyncedWriteArea, nullptr);
+}
+
+void ContextVk::trackFramebufferFetchDrawWrite()
+{
+    if (mFramebufferFetchRenderPassQueueSerial != mRenderPassCommands->getQueueSerial())
+    {
+        mFramebufferFetchRenderPassQueueSerial    = mRenderPassCommands->getQueueSerial();
+        mFramebufferFetchTrackedWriteCommandCount = 0;
+        mFramebufferFetchUnsyncedWriteArea        = gl::Rectangle();
+    }
+
+    // The draw that follows adds one write command.  If more or others are recorded, the counts
+    // mismatch and the next barrier can't be skipped.
+    if (mFramebufferFetchTrackedWriteCommandCount !=
+        mRenderPassCommands->getRenderPassWriteCommandCount())
+    {
+        return;
+    }
+    mFramebufferFetchTrackedWriteCommandCount++;
+
+    const gl::Rectangle drawArea(mScissor.offset.x, mScissor.offset.y, mScissor.extent.width,
+                                 mScissor.extent.height);
+    if (mFramebufferFetchUnsyncedWriteArea.empty())
+    {
+        mFramebufferFetchUnsyncedWriteArea = drawArea;
+    }
+    else if (!drawArea.empty())
+    {
+        gl::GetEnclosingRectangle(mFramebufferFetchUnsyncedWriteArea, drawArea,
+                                  &mFramebufferFetchUnsyncedWriteArea);
+    }
+}
+
 angle::Result ContextVk::handleDirtyGraphicsFramebufferFetchBarrier(
     DirtyBits::Iterator *dirtyBitsIterator,
     DirtyBits dirtyBitMask)
 {
+    if (!isFramebufferFetchBarrierNeeded())
+    {
+        return angle::Result::Continue;
+    }
+
     VkMemoryBarrier memoryBarrier = {};
     memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
     memoryBarrier.srcAccessMask   = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
@@ -2818,6 +3045,13 @@ angle::Result ContextVk::handleDirtyGraphicsFramebufferFetchBarrier(
         VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
         GetLocalDependencyFlags(this), 1, &memoryBarrier, 0, nullptr, 0, nullptr);
 
+    // Start tracking the writes the next barrier has to make visible.
+    mIsFramebufferFetchWriteTracked        = true;
+    mFramebufferFetchRenderPassQueueSerial = mRenderPassCommands->getQueueSerial();
+    mFramebufferFetchTrackedWriteCommandCount =
+        mRenderPassCommands->getRenderPassWriteCommandCount();
+    mFramebufferFetchUnsyncedWriteArea = gl::Rectangle();
+
     return angle::Result::Continue;
 }
 
@@ -2888,7 +3122,7 @@ angle::Result ContextVk::handleDirtyShaderResourcesImpl(CommandBufferHelperT *co
     if (hasUniformBuffers)
     {
         mShaderBuffersDescriptorDesc.updateShaderBuffers(
-            commandBufferHelper, *executable, variableInfoMap,
+            this, commandBufferHelper, *executable, variableInfoMap,
             mState.getOffsetBindingPointerUniformBuffers(), executable->getUniformBlocks(),
             executableVk->getUniformBufferDescriptorType(), limits.maxUniformBufferRange,
             mEmptyBuffer, mShaderBufferWriteDescriptorDescs, mDeferredMemoryBarriers);
@@ -2896,7 +3130,7 @@ angle::Result ContextVk::handleDirtyShaderResourcesImpl(CommandBufferHelperT *co
     if (hasStorageBuffers)
     {
         mShaderBuffersDescriptorDesc.updateShaderBuffers(
-            commandBufferHelper, *executable, variableInfoMap,
+            this, commandBufferHelper, *executable, variableInfoMap,
             mState.getOffsetBindingPointerShaderStorageBuffers(),
             executable->getShaderStorageBlocks(), executableVk->getStorageBufferDescriptorType(),
             limits.maxStorageBufferRange, mEmptyBuffer, mShaderBufferWriteDescriptorDescs,
@@ -2905,7 +3139,7 @@ angle::Result ContextVk::handleDirtyShaderResourcesImpl(CommandBufferHelperT *co
     if (hasAtomicCounterBuffers)
     {
         mShaderBuffersDescriptorDesc.updateAtomicCounters(
-            commandBufferHelper, *executable, variableInfoMap,
+            this, commandBufferHelper, *executable, variableInfoMap,
             mState.getOffsetBindingPointerAtomicCounterBuffers(),
             executable->getAtomicCounterBuffers(), limits.minStorageBufferOffsetAlignment,
             mEmptyBuffer, mShaderBufferWriteDescriptorDescs);
@@ -2977,7 +3211,8 @@ angle::Result ContextVk::handleDirtyUniformBuffersImpl(CommandBufferT *commandBu
     {
         const GLuint binding = executable->getUniformBlockBinding(blockIndex);
         mShaderBuffersDescriptorDesc.updateOneShaderBuffer(
-            commandBufferHelper, variableInfoMap, mState.getOffsetBindingPointerUniformBuffers(),
+            this, commandBufferHelper, variableInfoMap,
+            mState.getOffsetBindingPointerUniformBuffers(),
             executable->getUniformBlocks()[blockIndex], binding,
             executableVk->getUniformBufferDescriptorType(), limits.maxUniformBufferRange,
             mEmptyBuffer, mShaderBufferWriteDescriptorDescs, mDeferredMemoryBarriers);
@@ -3034,7 +3269,7 @@ angle::Result ContextVk::handleDirtyGraphicsTransformFeedbackBuffersEmulation(
         {
             vk::BufferHelper *bufferHelper = bufferHelpers[bufferIndex];
             ASSERT(bufferHelper);
-            mRenderPassCommands->bufferWrite(VK_ACCESS_SHADER_WRITE_BIT,
+            mRenderPassCommands->bufferWrite(this, VK_ACCESS_SHADER_WRITE_BIT,
                                              vk::PipelineStage::VertexShader, bufferHelper);
         }
 
@@ -3094,7 +3329,7 @@ angle::Result ContextVk::handleDirtyGraphicsTransformFeedbackBuffersExtension(
     {
         vk::BufferHelper *bufferHelper = buffers[bufferIndex];
         ASSERT(bufferHelper);
-        mRenderPassCommands->bufferWrite(VK_ACCESS_TRANSFORM_FEEDBACK_WRITE_BIT_EXT,
+        mRenderPassCommands->bufferWrite(this, VK_ACCESS_TRANSFORM_FEEDBACK_WRITE_BIT_EXT,
                                          vk::PipelineStage::TransformFeedback, bufferHelper);
     }
 
@@ -3103,7 +3338,8 @@ angle::Result ContextVk::handleDirtyGraphicsTransformFeedbackBuffersExtension(
     // buffers of the transform feedback object are used together.  The rest of the buffers are
     // simply retained so they don't get deleted too early.
     ASSERT(counterBuffers[0].valid());
-    mRenderPassCommands->bufferWrite(VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_WRITE_BIT_EXT |
+    mRenderPassCommands->bufferWrite(this,
+                                     VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_WRITE_BIT_EXT |
                                          VK_ACCESS_TRANSFORM_FEEDBACK_COUNTER_READ_BIT_EXT,
                                      vk::PipelineStage::TransformFeedback, &counterBuffers[0]);
     for (size_t bufferIndex = 1; bufferIndex < bufferCount; ++bufferIndex)
@@ -3398,6 +3634,20 @@ angle::Result ContextVk::handleDirtyGraphicsDynamicPrimitiveRestartEnable(
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::handleDirtyGraphicsDynamicColorBlendEquation(
+    DirtyBits::Iterator *dirtyBitsIterator,
+    DirtyBits dirtyBitMask)
+{
+    gl::DrawBuffersArray<VkColorBlendEquationEXT> equations;
+    const uint32_t attachmentCount =
+        mGraphicsPipelineDesc->getColorBlendEquations(this, &mState.getBlendStateExt(), &equations);
+    if (attachmentCount > 0)
+    {
+        mRenderPassCommandBuffer->setColorBlendEquation(0, attachmentCount, equations.data());
+    }
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::handleDirtyGraphicsDynamicFragmentShadingRate(
     DirtyBits::Iterator *dirtyBitsIterator,
     DirtyBits dirtyBitMask)
@@ -3532,6 +3782,7 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
 
     mPerfCounters.descriptorSetCacheTotalSize                = 0;
     mPerfCounters.descriptorSetCacheKeySizeBytes             = 0;
+    mPerfCounters.descriptorSetCacheEvictions                = 0;
     mPerfCounters.uniformsAndXfbDescriptorSetCacheHits       = 0;
     mPerfCounters.uniformsAndXfbDescriptorSetCacheMisses     = 0;
     mPerfCounters.uniformsAndXfbDescriptorSetCacheTotalSize  = 0;
@@ -3574,6 +3825,9 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
         mPerfCounters.descriptorSetCacheTotalSize =
             uniCacheStats.getSize() + texCacheStats.getSize() + resCacheStats.getSize() +
             mVulkanCacheStats[VulkanCacheType::DriverUniformsDescriptors].getSize();
+        mPerfCounters.descriptorSetCacheEvictions = uniCacheStats.getEvictionCount() +
+                                                    texCacheStats.getEvictionCount() +
+                                                    resCacheStats.getEvictionCount();
 
         mPerfCounters.descriptorSetCacheKeySizeBytes = 0;
 
@@ -3601,6 +3855,10 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
 
     mPerfCounters.pendingSubmissionGarbageObjects =
         static_cast<uint64_t>(mRenderer->getPendingSubmissionGarbageSize());
+    mPerfCounters.appThreadGarbageCleanupDurationNs =
+        mRenderer->getAppThreadGarbageCleanupDurationNs();
+    mPerfCounters.cleanUpThreadGarbageCleanupDurationNs =
+        mRenderer->getCleanUpThreadGarbageCleanupDurationNs();
 }
 
 void ContextVk::updateOverlayOnPresent()
@@ -3697,6 +3955,14 @@ void ContextVk::updateOverlayOnPresent()
         overlay->getCountWidget(gl::WidgetId::VulkanTotalPipelineCacheMissTimeMs)
             ->set(mPerfCounters.pipelineCreationTotalCacheMissesDurationNs / 1000'000);
     }
+
+    // The timeline is only updated once the events of a sampled frame have completed.
+    if (!mGpuPassTimeline.empty())
+    {
+        overlay->getTextWidget(gl::WidgetId::VulkanGpuPassTimeline)
+            ->set(std::move(mGpuPassTimeline));
+        mGpuPassTimeline.clear();
+    }
 }
 
 void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelperCommon *commandBuffer)
@@ -3727,6 +3993,13 @@ void ContextVk::addOverlayUsedBuffersCount(vk::CommandBufferHelperCommon *comman
         descriptorCacheSize->add(mPerfCounters.descriptorSetCacheTotalSize);
         descriptorCacheSize->next();
     }
+
+    {
+        gl::RunningGraphWidget *descriptorCacheEvictions =
+            overlay->getRunningGraphWidget(gl::WidgetId::VulkanDescriptorCacheEvictions);
+        descriptorCacheEvictions->add(mPerfCounters.descriptorSetCacheEvictions);
+        descriptorCacheEvictions->next();
+    }
 }
 
 angle::Result ContextVk::submitCommands(const vk::Semaphore *signalSemaphore,
@@ -3817,6 +4090,11 @@ angle::Result ContextVk::synchronizeCpuGpuTime()
 {
     ASSERT(mGpuEventsEnabled);
 
+    if (getFeatures().supportsCalibratedTimestamps.enabled)
+    {
+        return synchronizeCpuGpuTimeWithCalibratedTimestamps();
+    }
+
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
@@ -3883,7 +4161,8 @@ angle::Result ContextVk::synchronizeCpuGpuTime()
     // a limited number of times and the Tcpu,Tgpu pair corresponding to smallest Te-Ts used for
     // calibration.
     //
-    // Note: Once VK_EXT_calibrated_timestamps is ubiquitous, this should be redone.
+    // With VK_EXT_calibrated_timestamps, synchronizeCpuGpuTimeWithCalibratedTimestamps() is used
+    // instead.
 
     ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::synchronizeCpuGpuTime");
 
@@ -3994,18 +4273,79 @@ angle::Result ContextVk::synchronizeCpuGpuTime()
 
     mGpuEventQueryPool.freeQuery(this, &timestampQuery);
 
+    updateGpuClockSync(TcpuS, TgpuCycles);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::synchronizeCpuGpuTimeWithCalibratedTimestamps()
+{
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    ASSERT(platform);
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::synchronizeCpuGpuTimeWithCalibratedTimestamps");
+
+    // The GPU clock is read directly, so the CPU time is taken right before and after it, and the
+    // middle of the two taken as the CPU time matching the GPU time.  As with the event-based
+    // synchronization, the read with the tightest range is used.
+    constexpr uint32_t kRetries = 10;
+
+    double tightestRangeS = 1e6f;
+    double TcpuS          = 0;
+    uint64_t TgpuCycles   = 0;
+    for (uint32_t i = 0; i < kRetries; ++i)
+    {
+        uint64_t gpuTimestampCycles = 0;
+        double TsS                  = platform->monotonicallyIncreasingTime(platform);
+        ANGLE_TRY(getCalibratedDeviceTimestamp(&gpuTimestampCycles));
+        double TeS = platform->monotonicallyIncreasingTime(platform);
+
+        if (mGpuEventTimestampOrigin == 0)
+        {
+            mGpuEventTimestampOrigin = gpuTimestampCycles;
+        }
+
+        double confidenceRangeS = TeS - TsS;
+        if (confidenceRangeS < tightestRangeS)
+        {
+            tightestRangeS = confidenceRangeS;
+            TcpuS          = (TsS + TeS) / 2.0;
+            TgpuCycles     = gpuTimestampCycles;
+        }
+    }
+
+    updateGpuClockSync(TcpuS, TgpuCycles);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::getCalibratedDeviceTimestamp(uint64_t *timestampCyclesOut)
+{
+    ASSERT(getFeatures().supportsCalibratedTimestamps.enabled);
+
+    VkCalibratedTimestampInfoEXT timestampInfo = {};
+    timestampInfo.sType                        = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+    timestampInfo.timeDomain                   = VK_TIME_DOMAIN_DEVICE_EXT;
+
+    uint64_t maxDeviation = 0;
+    ANGLE_VK_TRY(this, vkGetCalibratedTimestampsEXT(getDevice(), 1, &timestampInfo,
+                                                    timestampCyclesOut, &maxDeviation));
+
+    return angle::Result::Continue;
+}
+
+void ContextVk::updateGpuClockSync(double cpuTimestampS, uint64_t gpuTimestampCycles)
+{
     // timestampPeriod gives nanoseconds/cycle.
     double TgpuS =
-        (TgpuCycles - mGpuEventTimestampOrigin) *
+        (gpuTimestampCycles - mGpuEventTimestampOrigin) *
         static_cast<double>(getRenderer()->getPhysicalDeviceProperties().limits.timestampPeriod) /
         1'000'000'000.0;
 
-    flushGpuEvents(TgpuS, TcpuS);
+    flushGpuEvents(TgpuS, cpuTimestampS);
 
     mGpuClockSync.gpuTimestampS = TgpuS;
-    mGpuClockSync.cpuTimestampS = TcpuS;
-
-    return angle::Result::Continue;
+    mGpuClockSync.cpuTimestampS = cpuTimestampS;
 }
 
 angle::Result ContextVk::traceGpuEventImpl(vk::OutsideRenderPassCommandBuffer *commandBuffer,
@@ -4025,6 +4365,120 @@ angle::Result ContextVk::traceGpuEventImpl(vk::OutsideRenderPassCommandBuffer *c
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::traceUtilsGpuEventImpl(vk::OutsideRenderPassCommandBuffer *commandBuffer,
+                                                char phase,
+                                                const char *functionName)
+{
+    const uint64_t serial = mOutsideRenderPassCommands->getQueueSerial().getSerial().getValue();
+    return traceGpuEventImpl(commandBuffer, phase, GetTraceEventName(functionName, serial));
+}
+
+angle::Result ContextVk::updateGpuEventSampling()
+{
+    ASSERT(mGpuEventsEnabled);
+
+    ++mGpuEventFrameCounter;
+    const bool sampleFrame = mGpuEventFrameCounter % mGpuEventFrameInterval == 0;
+    if (sampleFrame == mGpuEventsSampled)
+    {
+        return angle::Result::Continue;
+    }
+
+    // The event encompassing the primary command buffer is the only one open at the frame
+    // boundary.  End it when sampling stops, and begin it when sampling starts, so every begin
+    // event is still paired with an end event.
+    EventName eventName = GetTraceEventName("Primary", mPrimaryBufferEventCounter);
+    if (mGpuEventsSampled)
+    {
+        ANGLE_TRY(traceGpuEvent(&mOutsideRenderPassCommands->getCommandBuffer(),
+                                TRACE_EVENT_PHASE_END, eventName));
+        mGpuEventsSampled = false;
+    }
+    else
+    {
+        mGpuEventsSampled = true;
+        ANGLE_TRY(traceGpuEvent(&mOutsideRenderPassCommands->getCommandBuffer(),
+                                TRACE_EVENT_PHASE_BEGIN, eventName));
+    }
+
+    return angle::Result::Continue;
+}
+
+void ContextVk::traceCounters()
+{
+    // Gathered the same way as in syncObjectPerfCounters(), but without touching the perf
+    // counters, which have their own per-frame reset logic.
+    VulkanCacheStats cacheStats;
+    CacheStatsAccumulator accumulator(&cacheStats);
+    mShareGroupVk->getMetaDescriptorPools()[DescriptorSetIndex::UniformsAndXfb]
+        .accumulateDescriptorCacheStats(VulkanCacheType::UniformsAndXfbDescriptors, &accumulator);
+    mShareGroupVk->getMetaDescriptorPools()[DescriptorSetIndex::Texture]
+        .accumulateDescriptorCacheStats(VulkanCacheType::TextureDescriptors, &accumulator);
+    mShareGroupVk->getMetaDescriptorPools()[DescriptorSetIndex::ShaderResource]
+        .accumulateDescriptorCacheStats(VulkanCacheType::ShaderResourcesDescriptors,
+                                        &accumulator);
+
+    const CacheStats &uniCacheStats = cacheStats[VulkanCacheType::UniformsAndXfbDescriptors];
+    ANGLE_TRACE_COUNTER("gpu.angle", "UniformsAndXfbDescriptorCacheSize", uniCacheStats.getSize());
+    ANGLE_TRACE_COUNTER("gpu.angle", "UniformsAndXfbDescriptorCacheMisses",
+                        uniCacheStats.getMissCount());
+
+    const CacheStats &texCacheStats = cacheStats[VulkanCacheType::TextureDescriptors];
+    ANGLE_TRACE_COUNTER("gpu.angle", "TextureDescriptorCacheSize", texCacheStats.getSize());
+    ANGLE_TRACE_COUNTER("gpu.angle", "TextureDescriptorCacheMisses", texCacheStats.getMissCount());
+
+    const CacheStats &resCacheStats = cacheStats[VulkanCacheType::ShaderResourcesDescriptors];
+    ANGLE_TRACE_COUNTER("gpu.angle", "ShaderResourcesDescriptorCacheSize",
+                        resCacheStats.getSize());
+    ANGLE_TRACE_COUNTER("gpu.angle", "ShaderResourcesDescriptorCacheMisses",
+                        resCacheStats.getMissCount());
+
+    ANGLE_TRACE_COUNTER("gpu.angle", "FramebufferCacheSize",
+                        mShareGroupVk->getFramebufferCache().getSize());
+
+    size_t bufferCount     = 0;
+    VkDeviceSize totalSize = 0;
+    mShareGroupVk->calculateTotalBufferCount(&bufferCount, &totalSize);
+    ANGLE_TRACE_COUNTER("gpu.angle", "BufferPoolBufferCount", bufferCount);
+    ANGLE_TRACE_COUNTER("gpu.angle", "BufferPoolMemoryKB", totalSize / 1024);
+
+    ANGLE_TRACE_COUNTER("gpu.angle", "InFlightCommandBatches",
+                        mRenderer->getInFlightCommandBatchCount());
+}
+
+void ContextVk::addToGpuPassTimeline(const GpuEvent &gpuEvent)
+{
+    if (gpuEvent.phase == TRACE_EVENT_PHASE_BEGIN)
+    {
+        mGpuEventBeginCycles.push_back(gpuEvent.gpuTimestampCycles);
+        return;
+    }
+    if (gpuEvent.phase != TRACE_EVENT_PHASE_END || mGpuEventBeginCycles.empty())
+    {
+        return;
+    }
+
+    const uint64_t beginCycles = mGpuEventBeginCycles.back();
+    mGpuEventBeginCycles.pop_back();
+
+    // Only the render passes and UtilsVk dispatches nested in the primary command buffer event are
+    // shown.
+    if (mGpuEventBeginCycles.size() != 1 || mGpuPassTimeline.size() >= kMaxGpuPassTimelineLength)
+    {
+        return;
+    }
+
+    const double durationUs =
+        (gpuEvent.gpuTimestampCycles - beginCycles) *
+        static_cast<double>(getRenderer()->getPhysicalDeviceProperties().limits.timestampPeriod) *
+        1e-3;
+
+    std::ostringstream passTime;
+    passTime << (mGpuPassTimeline.empty() ? "" : ", ") << gpuEvent.name.data() << ": "
+             << static_cast<uint64_t>(durationUs) << "us";
+    mGpuPassTimeline += passTime.str();
+}
+
 angle::Result ContextVk::checkCompletedGpuEvents()
 {
     ASSERT(mGpuEventsEnabled);
@@ -4061,6 +4515,11 @@ angle::Result ContextVk::checkCompletedGpuEvents()
         gpuEvent.name  = eventQuery.name;
         gpuEvent.phase = eventQuery.phase;
 
+        if (mState.getOverlay()->isEnabled())
+        {
+            addToGpuPassTimeline(gpuEvent);
+        }
+
         mGpuEvents.emplace_back(gpuEvent);
 
         ++finishedCount;
@@ -4561,9 +5020,21 @@ angle::Result ContextVk::multiDrawElementsIndirectHelper(const gl::Context *cont
             "Potential inefficiency emulating uint8 vertex attributes due to lack "
             "of hardware support");
 
-        ANGLE_TRY(vertexArrayVk->convertIndexBufferIndirectGPU(
-            this, currentIndirectBuf, currentIndirectBufOffset, &currentIndirectBuf));
-        currentIndirectBufOffset = 0;
+        if (drawcount > 1)
+        {
+            // The indirect conversion only handles one command.  Instead, convert the whole
+            // index buffer once; indices keep their position, so every command can be used as is
+            // in a single indirect draw.
+            gl::Buffer *elementArrayBuffer = mState.getVertexArray()->getElementArrayBuffer();
+            ANGLE_TRY(vertexArrayVk->convertIndexBufferGPU(this, vk::GetImpl(elementArrayBuffer),
+                                                           nullptr));
+        }
+        else
+        {
+            ANGLE_TRY(vertexArrayVk->convertIndexBufferIndirectGPU(
+                this, currentIndirectBuf, currentIndirectBufOffset, &currentIndirectBuf));
+            currentIndirectBufOffset = 0;
+        }
     }
 
     // If the line-loop handling function modifies the element array buffer in the vertex array,
@@ -4988,10 +5459,17 @@ void ContextVk::updateBlendFuncsAndEquations()
     FramebufferVk *framebufferVk              = vk::GetImpl(mState.getDrawFramebuffer());
     mCachedDrawFramebufferColorAttachmentMask = framebufferVk->getState().getEnabledDrawBuffers();
 
-    mGraphicsPipelineDesc->updateBlendFuncs(&mGraphicsPipelineTransition, blendStateExt,
-                                            mCachedDrawFramebufferColorAttachmentMask);
+    if (getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+    }
+    else
+    {
+        mGraphicsPipelineDesc->updateBlendFuncs(&mGraphicsPipelineTransition, blendStateExt,
+                                                mCachedDrawFramebufferColorAttachmentMask);
+    }
 
-    mGraphicsPipelineDesc->updateBlendEquations(&mGraphicsPipelineTransition, blendStateExt,
+    mGraphicsPipelineDesc->updateBlendEquations(this, &mGraphicsPipelineTransition, blendStateExt,
                                                 mCachedDrawFramebufferColorAttachmentMask);
 
     // This function may be called outside of ContextVk::syncState, and so invalidates the graphics
@@ -5602,14 +6080,25 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_BLEND_CONSTANTS);
                 break;
             case gl::state::DIRTY_BIT_BLEND_FUNCS:
-                mGraphicsPipelineDesc->updateBlendFuncs(
-                    &mGraphicsPipelineTransition, glState.getBlendStateExt(),
-                    drawFramebufferVk->getState().getColorAttachmentsMask());
+                if (getFeatures().useColorBlendEquationDynamicState.enabled)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+                }
+                else
+                {
+                    mGraphicsPipelineDesc->updateBlendFuncs(
+                        &mGraphicsPipelineTransition, glState.getBlendStateExt(),
+                        drawFramebufferVk->getState().getColorAttachmentsMask());
+                }
                 break;
             case gl::state::DIRTY_BIT_BLEND_EQUATIONS:
                 mGraphicsPipelineDesc->updateBlendEquations(
-                    &mGraphicsPipelineTransition, glState.getBlendStateExt(),
+                    this, &mGraphicsPipelineTransition, glState.getBlendStateExt(),
                     drawFramebufferVk->getState().getColorAttachmentsMask());
+                if (getFeatures().useColorBlendEquationDynamicState.enabled)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+                }
                 updateAdvancedBlendEquations(programExecutable);
                 break;
             case gl::state::DIRTY_BIT_COLOR_MASK:
@@ -5850,9 +6339,13 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                 gl::DrawBufferMask newColorAttachmentMask =
                     drawFramebufferVk->getState().getColorAttachmentsMask();
                 mGraphicsPipelineDesc->resetBlendFuncsAndEquations(
-                    &mGraphicsPipelineTransition, glState.getBlendStateExt(),
+                    this, &mGraphicsPipelineTransition, glState.getBlendStateExt(),
                     mCachedDrawFramebufferColorAttachmentMask, newColorAttachmentMask);
                 mCachedDrawFramebufferColorAttachmentMask = newColorAttachmentMask;
+                if (getFeatures().useColorBlendEquationDynamicState.enabled)
+                {
+                    mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION);
+                }
 
                 if (!getFeatures().preferDynamicRendering.enabled)
                 {
@@ -6113,6 +6606,16 @@ angle::Result ContextVk::onMakeCurrent(const gl::Context *context)
         ANGLE_TRY(allocateQueueSerialIndex());
     }
 
+    // Without worker threads, splitting the render pass for parallel encoding only adds overhead.
+    if (getFeatures().parallelRenderPassCommandEncoding.enabled &&
+        vk::RenderPassCommandBuffer::ExecutesInline() && !mParallelCommandEncoder.valid() &&
+        context->getWorkerThreadPool()->isAsync())
+    {
+        ANGLE_TRY(mParallelCommandEncoder.init(this, mRenderer->getQueueFamilyIndex(),
+                                               getProtectionType(),
+                                               context->getWorkerThreadPool()));
+    }
+
     // Flip viewports if the user did not request that the surface is flipped.
     const egl::Surface *drawSurface = context->getCurrentDrawSurface();
     const egl::Surface *readSurface = context->getCurrentReadSurface();
@@ -6267,6 +6770,24 @@ void ContextVk::updateSurfaceRotationDrawFramebuffer(const gl::State &glState,
                                                          isRotatedAspectRatio);
             invalidateCurrentGraphicsPipeline();
         }
+
+        if (getFeatures().bakeFlipInSpecConst.enabled)
+        {
+            bool flipX          = false;
+            bool flipY          = false;
+            bool invertViewport = false;
+            getDrawFramebufferFlip(&flipX, &flipY, &invertViewport);
+
+            // Similarly, the flip values are specialization constants with this feature.  They
+            // change when switching between the default framebuffer and FBOs.
+            if (vk::MakeFlipUniform(flipX, flipY, invertViewport) !=
+                mGraphicsPipelineDesc->getFlipUniform())
+            {
+                mGraphicsPipelineDesc->updateFlip(&mGraphicsPipelineTransition, flipX, flipY,
+                                                  invertViewport);
+                invalidateCurrentGraphicsPipeline();
+            }
+        }
     }
 }
 
@@ -6277,6 +6798,44 @@ void ContextVk::updateSurfaceRotationReadFramebuffer(const gl::State &glState,
         getSurfaceRotationImpl(glState.getReadFramebuffer(), currentReadSurface);
 }
 
+void ContextVk::getDrawFramebufferFlip(bool *flipXOut,
+                                       bool *flipYOut,
+                                       bool *invertViewportOut) const
+{
+    *flipXOut = false;
+    *flipYOut = false;
+
+    // Y-axis flipping only comes into play with the default framebuffer (i.e. a swapchain
+    // image). For 0-degree rotation, an FBO or pbuffer could be the draw framebuffer, and so we
+    // must check whether flipY should be positive or negative.  All other rotations, will be to
+    // the default framebuffer, and so the value of isViewportFlipEnabledForDrawFBO() is assumed
+    // true; the appropriate flipY value is chosen such that gl_FragCoord is positioned at the
+    // lower-left corner of the window.
+    switch (mCurrentRotationDrawFramebuffer)
+    {
+        case SurfaceRotation::Identity:
+            *flipYOut = isViewportFlipEnabledForDrawFBO();
+            break;
+        case SurfaceRotation::Rotated90Degrees:
+            ASSERT(isViewportFlipEnabledForDrawFBO());
+            break;
+        case SurfaceRotation::Rotated180Degrees:
+            ASSERT(isViewportFlipEnabledForDrawFBO());
+            *flipXOut = true;
+            break;
+        case SurfaceRotation::Rotated270Degrees:
+            ASSERT(isViewportFlipEnabledForDrawFBO());
+            *flipXOut = true;
+            *flipYOut = true;
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    *invertViewportOut = isViewportFlipEnabledForDrawFBO();
+}
+
 gl::Caps ContextVk::getNativeCaps() const
 {
     return mRenderer->getNativeCaps();
@@ -6808,7 +7367,7 @@ angle::Result ContextVk::dispatchComputeIndirect(const gl::Context *context, GLi
     ANGLE_TRY(setupDispatch(context));
 
     // Process indirect buffer after command buffer has started.
-    mOutsideRenderPassCommands->bufferRead(VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
+    mOutsideRenderPassCommands->bufferRead(this, VK_ACCESS_INDIRECT_COMMAND_READ_BIT,
                                            vk::PipelineStage::DrawIndirect, &buffer);
 
     mOutsideRenderPassCommands->getCommandBuffer().dispatchIndirect(buffer.getBuffer(),
@@ -6944,6 +7503,24 @@ void ContextVk::blendBarrier()
     }
 }
 
+void ContextVk::beginObjectDeletionBatch()
+{
+    ASSERT(!mIsBatchingObjectDeletion);
+    mIsBatchingObjectDeletion = true;
+}
+
+void ContextVk::endObjectDeletionBatch()
+{
+    ASSERT(mIsBatchingObjectDeletion);
+    mIsBatchingObjectDeletion = false;
+
+    if (!mObjectDeletionGarbage.empty())
+    {
+        mRenderer->collectGarbage(mObjectDeletionGarbageUse, std::move(mObjectDeletionGarbage));
+        mObjectDeletionGarbageUse.reset();
+    }
+}
+
 angle::Result ContextVk::acquireTextures(const gl::Context *context,
                                          const gl::TextureBarrierVector &textureBarriers)
 {
@@ -7091,37 +7668,10 @@ angle::Result ContextVk::handleDirtyGraphicsDriverUniforms(DirtyBits::Iterator *
     SetBitField(renderAreaHeight, drawFramebufferVk->getState().getDimensions().height);
     const uint32_t renderArea = renderAreaHeight << 16 | renderAreaWidth;
 
-    bool flipX = false;
-    bool flipY = false;
-    // Y-axis flipping only comes into play with the default framebuffer (i.e. a swapchain
-    // image). For 0-degree rotation, an FBO or pbuffer could be the draw framebuffer, and so we
-    // must check whether flipY should be positive or negative.  All other rotations, will be to
-    // the default framebuffer, and so the value of isViewportFlipEnabledForDrawFBO() is assumed
-    // true; the appropriate flipY value is chosen such that gl_FragCoord is positioned at the
-    // lower-left corner of the window.
-    switch (mCurrentRotationDrawFramebuffer)
-    {
-        case SurfaceRotation::Identity:
-            flipY = isViewportFlipEnabledForDrawFBO();
-            break;
-        case SurfaceRotation::Rotated90Degrees:
-            ASSERT(isViewportFlipEnabledForDrawFBO());
-            break;
-        case SurfaceRotation::Rotated180Degrees:
-            ASSERT(isViewportFlipEnabledForDrawFBO());
-            flipX = true;
-            break;
-        case SurfaceRotation::Rotated270Degrees:
-            ASSERT(isViewportFlipEnabledForDrawFBO());
-            flipX = true;
-            flipY = true;
-            break;
-        default:
-            UNREACHABLE();
-            break;
-    }
-
-    const bool invertViewport = isViewportFlipEnabledForDrawFBO();
+    bool flipX          = false;
+    bool flipY          = false;
+    bool invertViewport = false;
+    getDrawFramebufferFlip(&flipX, &flipY, &invertViewport);
 
     // Create the extended driver uniform, and populate the extended data fields if necessary.
     GraphicsDriverUniformsExtended driverUniformsExt = {};
@@ -7187,7 +7737,7 @@ angle::Result ContextVk::handleDirtyGraphicsDriverUniforms(DirtyBits::Iterator *
         {},
         {depthRangeNear, depthRangeFar},
         renderArea,
-        MakeFlipUniform(flipX, flipY, invertViewport),
+        vk::MakeFlipUniform(flipX, flipY, invertViewport),
         mGraphicsPipelineDesc->getEmulatedDitherControl(),
         misc,
     };
@@ -7362,6 +7912,9 @@ angle::Result ContextVk::initImageAllocation(vk::ImageHelper *imageHelper,
     bool shouldTryFallback = (result == VK_ERROR_OUT_OF_DEVICE_MEMORY);
     ANGLE_VK_CHECK(this, shouldTryFallback, result);
 
+    // The images held for recycling are the first to go.
+    mShareGroupVk->getImageRecycler()->releaseAll(mRenderer);
+
     // If memory allocation fails, it is possible to retry the allocation after cleaning the garbage
     // and waiting for submitted commands to finish if necessary.
     bool anyGarbageCleaned  = false;
@@ -7632,6 +8185,12 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
         recreatePipelineLayout = true;
     }
 
+    if (getFeatures().bakeStaticImmutableSamplers.enabled)
+    {
+        executableVk->updateBakedSamplers(mActiveTextures, mState.getSamplers(),
+                                          &recreatePipelineLayout);
+    }
+
     // Recreate the pipeline layout, if necessary.
     if (recreatePipelineLayout)
     {
@@ -7705,7 +8264,7 @@ angle::Result ContextVk::updateActiveImages(CommandBufferHelperT *commandBufferH
         {
             BufferVk *bufferVk = vk::GetImpl(textureVk->getBuffer().get());
 
-            OnImageBufferWrite(bufferVk, shaderStages, commandBufferHelper);
+            OnImageBufferWrite(this, bufferVk, shaderStages, commandBufferHelper);
 
             textureVk->retainBufferViews(commandBufferHelper);
             continue;
@@ -7950,6 +8509,19 @@ angle::Result ContextVk::getTimestamp(uint64_t *timestampOut)
     // introducing a GPU bubble.  This function directly generates a command buffer and submits
     // it instead of using the other member functions.  This is to avoid changing any state,
     // such as the queue serial.
+    //
+    // With VK_EXT_calibrated_timestamps, the GPU clock is read directly, which is the same clock
+    // timestamp queries write.
+    if (getFeatures().supportsCalibratedTimestamps.enabled)
+    {
+        ANGLE_TRY(getCalibratedDeviceTimestamp(timestampOut));
+
+        const double timestampPeriod =
+            static_cast<double>(mRenderer->getPhysicalDeviceProperties().limits.timestampPeriod);
+        *timestampOut = static_cast<uint64_t>(*timestampOut * timestampPeriod);
+
+        return angle::Result::Continue;
+    }
 
     // Create a query used to receive the GPU timestamp
     VkDevice device = getDevice();
@@ -8057,7 +8629,7 @@ angle::Result ContextVk::beginNewRenderPass(
 
     if (mCurrentGraphicsPipeline)
     {
-        ASSERT(mCurrentGraphicsPipeline->valid());
+        ASSERT(mCurrentGraphicsPipeline->valid() || mCurrentGraphicsPipeline->isCreationPending());
         mCurrentGraphicsPipeline->retainInRenderPass(mRenderPassCommands);
     }
     return angle::Result::Continue;
@@ -8073,6 +8645,15 @@ angle::Result ContextVk::startRenderPass(gl::Rectangle renderArea,
     ANGLE_TRY(drawFramebufferVk->startNewRenderPass(this, renderArea, &mRenderPassCommandBuffer,
                                                     renderPassDescChangedOut));
 
+    const vk::FramebufferDesc &framebufferDesc = drawFramebufferVk->getFramebufferDesc();
+    if (framebufferDesc == mRecentRenderPassFramebufferDescs[1] &&
+        !(framebufferDesc == mRecentRenderPassFramebufferDescs[0]))
+    {
+        mPerfCounters.renderPassMergeCandidates++;
+    }
+    mRecentRenderPassFramebufferDescs[1] = mRecentRenderPassFramebufferDescs[0];
+    mRecentRenderPassFramebufferDescs[0] = framebufferDesc;
+
     // For dynamic rendering, the FramebufferVk's render pass desc does not track whether
     // framebuffer fetch is in use.  In that case, ContextVk updates the command buffer's (and
     // graphics pipeline's) render pass desc only:
@@ -8152,7 +8733,7 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
 
     onRenderPassFinished(reason);
 
-    if (mGpuEventsEnabled)
+    if (mGpuEventsSampled)
     {
         EventName eventName = GetTraceEventName("RP", mPerfCounters.renderPasses);
         ANGLE_TRY(traceGpuEvent(&mOutsideRenderPassCommands->getCommandBuffer(),
@@ -8218,7 +8799,7 @@ angle::Result ContextVk::flushCommandsAndEndRenderPassWithoutSubmit(RenderPassCl
     // Generate a new serial for outside commands.
     generateOutsideRenderPassCommandsQueueSerial();
 
-    if (mGpuEventsEnabled)
+    if (mGpuEventsSampled)
     {
         EventName eventName = GetTraceEventName("RP", mPerfCounters.renderPasses);
         ANGLE_TRY(traceGpuEvent(&mOutsideRenderPassCommands->getCommandBuffer(),
@@ -8239,7 +8820,14 @@ angle::Result ContextVk::flushCommandsAndEndRenderPass(RenderPassClosureReason r
 
     ANGLE_TRY(flushCommandsAndEndRenderPassWithoutSubmit(reason));
 
-    if (mHasDeferredFlush || hasExcessPendingGarbage())
+    // A lower priority context whose priority was raised for its share group submits its render
+    // passes one at a time, so that they are not queued ahead of the work of the context the
+    // share group priority comes from as a single large batch.
+    const bool submitForShareGroupPriority =
+        getFeatures().submitPromotedContextCommandsAtRenderPassEnd.enabled &&
+        isPriorityRaisedByShareGroup();
+
+    if (mHasDeferredFlush || hasExcessPendingGarbage() || submitForShareGroupPriority)
     {
         // If we have deferred glFlush call in the middle of render pass, or if there is too much
         // pending garbage, perform a flush now.
@@ -8273,6 +8861,39 @@ angle::Result ContextVk::flushDirtyGraphicsRenderPass(DirtyBits::Iterator *dirty
     return angle::Result::Continue;
 }
 
+bool ContextVk::canInsertParallelEncodeBoundary() const
+{
+    // Queries, transform feedback and debug labels must begin and end in the same secondary
+    // command buffer, and vkCmdNextSubpass cannot be recorded in one.
+    if (mGraphicsPipelineDesc->getSubpass() != 0 || mCurrentTransformFeedbackQueueSerial.valid())
+    {
+        return false;
+    }
+    for (QueryVk *activeQuery : mActiveRenderPassQueries)
+    {
+        if (activeQuery != nullptr)
+        {
+            return false;
+        }
+    }
+    return !mRenderer->enableDebugUtils() && !mRenderer->angleDebuggerMode();
+}
+
+void ContextVk::insertParallelEncodeBoundary()
+{
+    ASSERT(mParallelCommandEncoder.valid());
+
+    mRenderPassCommands->insertParallelEncodeBoundary(&mParallelCommandEncoder);
+
+    // The command buffer state is not inherited by the next chunk of commands, so it must all be
+    // set again.  The render pass itself and the attachment accesses are not affected.
+    DirtyBits chunkDirtyBits = mNewGraphicsCommandBufferDirtyBits;
+    chunkDirtyBits.reset(DIRTY_BIT_RENDER_PASS);
+    chunkDirtyBits.reset(DIRTY_BIT_COLOR_ACCESS);
+    chunkDirtyBits.reset(DIRTY_BIT_DEPTH_STENCIL_ACCESS);
+    mGraphicsDirtyBits |= chunkDirtyBits;
+}
+
 angle::Result ContextVk::syncExternalMemory()
 {
     VkMemoryBarrier memoryBarrier = {};
@@ -8846,17 +9467,31 @@ angle::Result ContextVk::onResourceAccess(const vk::CommandBufferAccess &access)
         ASSERT(!isRenderPassStartedAndUsesBufferForWrite(*bufferAccess.buffer));
         ASSERT(!mOutsideRenderPassCommands->usesBufferForWrite(*bufferAccess.buffer));
 
-        mOutsideRenderPassCommands->bufferRead(bufferAccess.accessType, bufferAccess.stage,
+        mOutsideRenderPassCommands->bufferRead(this, bufferAccess.accessType, bufferAccess.stage,
                                                bufferAccess.buffer);
     }
 
     for (const vk::CommandBufferBufferAccess &bufferAccess : access.getWriteBuffers())
     {
-        ASSERT(!isRenderPassStartedAndUsesBuffer(*bufferAccess.buffer));
-        ASSERT(!mOutsideRenderPassCommands->usesBuffer(*bufferAccess.buffer));
+        vk::BufferHelper *buffer           = bufferAccess.buffer;
+        const QueueSerial &queueSerial     = mOutsideRenderPassCommands->getQueueSerial();
+        const bool isDisjointTransferWrite = buffer->canShareTransferWriteCommandBuffer(
+            queueSerial, bufferAccess.writeOffset, bufferAccess.writeSize);
+        ASSERT(!isRenderPassStartedAndUsesBuffer(*buffer));
+        ASSERT(isDisjointTransferWrite || !mOutsideRenderPassCommands->usesBuffer(*buffer));
 
-        mOutsideRenderPassCommands->bufferWrite(bufferAccess.accessType, bufferAccess.stage,
-                                                bufferAccess.buffer);
+        // The barrier of the first write of the range, in this same command buffer, already
+        // covers the write.
+        if (!isDisjointTransferWrite)
+        {
+            mOutsideRenderPassCommands->bufferWrite(this, bufferAccess.accessType,
+                                                    bufferAccess.stage, buffer);
+        }
+        if (bufferAccess.writeSize != VK_WHOLE_SIZE)
+        {
+            buffer->onTransferWriteRange(queueSerial, bufferAccess.writeOffset,
+                                         bufferAccess.writeSize);
+        }
     }
 
     for (const vk::CommandBufferBufferExternalAcquireRelease &bufferAcquireRelease :
@@ -8932,7 +9567,8 @@ angle::Result ContextVk::flushCommandBuffersIfNecessary(const vk::CommandBufferA
         }
     }
 
-    // Write buffers always need a new command buffer if previously used.
+    // Write buffers always need a new command buffer if previously used, unless only by transfer
+    // writes to other ranges of the buffer.
     for (const vk::CommandBufferBufferAccess &bufferAccess : access.getWriteBuffers())
     {
         if (isRenderPassStartedAndUsesBuffer(*bufferAccess.buffer))
@@ -8940,7 +9576,10 @@ angle::Result ContextVk::flushCommandBuffersIfNecessary(const vk::CommandBufferA
             return flushCommandsAndEndRenderPass(
                 RenderPassClosureReason::BufferUseThenOutOfRPWrite);
         }
-        else if (mOutsideRenderPassCommands->usesBuffer(*bufferAccess.buffer))
+        else if (mOutsideRenderPassCommands->usesBuffer(*bufferAccess.buffer) &&
+                 !bufferAccess.buffer->canShareTransferWriteCommandBuffer(
+                     mOutsideRenderPassCommands->getQueueSerial(), bufferAccess.writeOffset,
+                     bufferAccess.writeSize))
         {
             shouldCloseOutsideRenderPassCommands = true;
         }
@@ -9082,6 +9721,46 @@ const angle::PerfMonitorCounterGroups &ContextVk::getPerfMonitorCounters()
     return mPerfMonitorCounters;
 }
 
+void ContextVk::getMemoryUsageBreakdown(const gl::Context *context,
+                                        gl::MemoryUsageBreakdown *breakdown) const
+{
+    size_t usedMemory                 = 0;
+    size_t outsideRenderPassAllocated = 0;
+    size_t renderPassAllocated        = 0;
+    mOutsideRenderPassCommands->getCommandBuffer().getMemoryUsageStats(&usedMemory,
+                                                                       &outsideRenderPassAllocated);
+    mRenderPassCommands->getCommandBuffer().getMemoryUsageStats(&usedMemory, &renderPassAllocated);
+    (*breakdown)[gl::MemoryUsageCategory::CommandBuffers] =
+        outsideRenderPassAllocated + renderPassAllocated;
+
+    (*breakdown)[gl::MemoryUsageCategory::StagingBuffers] =
+        mRenderer->getMemoryAllocationTracker()->getActiveMemoryAllocationsSize(
+            ToUnderlying(vk::MemoryAllocationType::StagingImage));
+    (*breakdown)[gl::MemoryUsageCategory::PipelineCache] = mRenderer->getPipelineCacheSize();
+}
+
+angle::Result ContextVk::handleMemoryPressure(const gl::Context *context,
+                                              gl::MemoryPressureLevel level)
+{
+    if (level == gl::MemoryPressureLevel::Moderate)
+    {
+        // Free what the GPU is already done with, including the images held for recycling, and let
+        // the buffer pools drop the empty blocks they don't expect to need.
+        mShareGroupVk->getImageRecycler()->releaseAll(mRenderer);
+        mRenderer->cleanupGarbage(nullptr);
+        mShareGroupVk->pruneDefaultBufferPools();
+        return angle::Result::Continue;
+    }
+
+    // Wait for the GPU so that all the garbage can be freed, then drop every empty block.
+    mShareGroupVk->getImageRecycler()->releaseAll(mRenderer);
+    ANGLE_TRY(finishImpl(RenderPassClosureReason::OutOfMemory));
+    mRenderer->cleanupGarbage(nullptr);
+    mShareGroupVk->releaseEmptyDefaultBufferPoolBlocks();
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::switchToColorFramebufferFetchMode(bool hasColorFramebufferFetch)
 {
     ASSERT(!getFeatures().preferDynamicRendering.enabled);
@@ -9206,6 +9885,7 @@ ANGLE_INLINE void ContextVk::generateRenderPassCommandsQueueSerial(QueueSerial *
 void ContextVk::resetPerFramePerfCounters()
 {
     mPerfCounters.renderPasses                           = 0;
+    mPerfCounters.renderPassMergeCandidates              = 0;
     mPerfCounters.writeDescriptorSets                    = 0;
     mPerfCounters.flushedOutsideRenderPassCommandBuffers = 0;
     mPerfCounters.resolveImageCommands                   = 0;
@@ -9233,4 +9913,30 @@ angle::Result ContextVk::ensureInterfacePipelineCache()
 
     return angle::Result::Continue;
 }
+
+angle::Result ContextVk::warmUpInterfacePipelines(vk::PipelineCacheAccess *pipelineCache)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::warmUpInterfacePipelines");
+
+    mShareGroupVk->onInterfacePipelinesWarmedUp();
+
+    // The vertex input and fragment output libraries only depend on the parts of the description
+    // that are shared by many programs, so creating them all up front leaves only the shaders
+    // library to be created when a new program is first drawn with.
+    for (const vk::GraphicsPipelineDesc &desc :
+         mRenderer->getGraphicsPipelineDescCorpus()->getAllDescs())
+    {
+        vk::PipelineHelper *vertexInput    = nullptr;
+        vk::PipelineHelper *fragmentOutput = nullptr;
+        ANGLE_TRY(CreateGraphicsPipelineSubset(
+            this, desc, {}, GraphicsPipelineSubsetRenderPass::Unused,
+            mShareGroupVk->getVertexInputGraphicsPipelineCache(), pipelineCache, &vertexInput));
+        ANGLE_TRY(CreateGraphicsPipelineSubset(
+            this, desc, {}, GraphicsPipelineSubsetRenderPass::Required,
+            mShareGroupVk->getFragmentOutputGraphicsPipelineCache(), pipelineCache,
+            &fragmentOutput));
+    }
+
+    return angle::Result::Continue;
+}
 }  // namespace rx
@@ -384,6 +384,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // KHR_blend_equation_advanced
     void blendBarrier() override;
 
+    void beginObjectDeletionBatch() override;
+    void endObjectDeletionBatch() override;
+
     // GL_ANGLE_vulkan_image
     angle::Result acquireTextures(const gl::Context *context,
                                   const gl::TextureBarrierVector &textureBarriers) override;
@@ -400,6 +403,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     VkDevice getDevice() const;
     // Effective Context Priority
     egl::ContextPriority getPriority() const { return mContextPriority; }
+    // Whether the effective priority was raised to that of a higher priority context in the share
+    // group.
+    bool isPriorityRaisedByShareGroup() const { return mContextPriority > mInitialContextPriority; }
     vk::ProtectionType getProtectionType() const { return mProtectionType; }
 
     ANGLE_INLINE const angle::FeaturesVk &getFeatures() const { return mRenderer->getFeatures(); }
@@ -494,6 +500,20 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         }
     }
 
+    // Hands garbage to the renderer, or while an object deletion batch is open, holds it until the
+    // batch ends so the whole batch is tracked as one garbage entry.
+    template <typename... ArgsT>
+    void collectGarbage(const vk::ResourceUse &use, ArgsT... garbageIn)
+    {
+        if (!mIsBatchingObjectDeletion)
+        {
+            mRenderer->collectGarbage(use, garbageIn...);
+            return;
+        }
+        vk::CollectGarbage(&mObjectDeletionGarbage, garbageIn...);
+        mObjectDeletionGarbageUse.merge(use);
+    }
+
     angle::Result getCompatibleRenderPass(const vk::RenderPassDesc &desc,
                                           const vk::RenderPass **renderPassOut);
     angle::Result getRenderPassWithOps(const vk::RenderPassDesc &desc,
@@ -512,10 +532,21 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                              char phase,
                                              const EventName &name)
     {
-        if (mGpuEventsEnabled)
+        if (mGpuEventsSampled)
             return traceGpuEventImpl(commandBuffer, phase, name);
         return angle::Result::Continue;
     }
+    // GPU trace events around internal work done by UtilsVk, named after the queue serial of the
+    // commands they are recorded in, so that work can be told apart from the application's.
+    ANGLE_INLINE angle::Result traceUtilsGpuEvent(
+        vk::OutsideRenderPassCommandBuffer *commandBuffer,
+        char phase,
+        const char *functionName)
+    {
+        if (mGpuEventsSampled)
+            return traceUtilsGpuEventImpl(commandBuffer, phase, functionName);
+        return angle::Result::Continue;
+    }
 
     const gl::Debug &getDebug() const { return mState.getDebug(); }
     const gl::OverlayType *getOverlay() const { return mState.getOverlay(); }
@@ -767,8 +798,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // handleDirtyGraphicsPipeline(), and ProgramPipelineVk::link().
     void resetCurrentGraphicsPipeline()
     {
-        mCurrentGraphicsPipeline        = nullptr;
-        mCurrentGraphicsPipelineShaders = nullptr;
+        mCurrentGraphicsPipeline         = nullptr;
+        mCurrentGraphicsPipelineShaders  = nullptr;
+        mPendingGraphicsPipeline         = nullptr;
+        mPendingGraphicsPipelineFallback = nullptr;
     }
 
     void onProgramExecutableReset(ProgramExecutableVk *executableVk);
@@ -794,9 +827,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         if (newBufferOut)
         {
             mHasInFlightStreamedVertexBuffers.set(attribIndex);
+            ++mStreamedVertexBufferGenerations[attribIndex];
         }
         return angle::Result::Continue;
     }
+    // Changes every time a streamed vertex buffer moves to a new VkBuffer, after which previous
+    // allocations may be recycled.
+    uint32_t getStreamedVertexBufferGeneration(size_t attribIndex) const
+    {
+        return mStreamedVertexBufferGenerations[attribIndex];
+    }
 
     // Put the context in framebuffer fetch mode.  If the permanentlySwitchToFramebufferFetchMode
     // feature is enabled, this is done on first encounter of framebuffer fetch, and makes the
@@ -810,6 +850,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
 
+    void getMemoryUsageBreakdown(const gl::Context *context,
+                                 gl::MemoryUsageBreakdown *breakdown) const override;
+
+    angle::Result handleMemoryPressure(const gl::Context *context,
+                                       gl::MemoryPressureLevel level) override;
+
     void resetPerFramePerfCounters();
 
     // Accumulate cache stats for a specific cache
@@ -975,6 +1021,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         DIRTY_BIT_DYNAMIC_DEPTH_BIAS_ENABLE,
         DIRTY_BIT_DYNAMIC_LOGIC_OP,
         DIRTY_BIT_DYNAMIC_PRIMITIVE_RESTART_ENABLE,
+        // - In VK_EXT_extended_dynamic_state3
+        DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION,
         // - In VK_KHR_fragment_shading_rate
         DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE,
 
@@ -1072,6 +1120,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
     static_assert(DIRTY_BIT_DYNAMIC_PRIMITIVE_RESTART_ENABLE > DIRTY_BIT_RENDER_PASS,
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
+    static_assert(DIRTY_BIT_DYNAMIC_COLOR_BLEND_EQUATION > DIRTY_BIT_RENDER_PASS,
+                  "Render pass using dirty bit must be handled after the render pass dirty bit");
     static_assert(DIRTY_BIT_DYNAMIC_FRAGMENT_SHADING_RATE > DIRTY_BIT_RENDER_PASS,
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
 
@@ -1082,6 +1132,29 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     using ComputeDirtyBitHandler =
         angle::Result (ContextVk::*)(DirtyBits::Iterator *dirtyBitsIterator);
 
+    // The handler tables hold a function instantiated per handler, which makes the per-bit
+    // dispatch a plain indirect call with the handler inlined, instead of a call through a
+    // pointer-to-member (which has to check for virtual functions and adjust |this|).
+    using GraphicsDirtyBitDispatcher = angle::Result (*)(ContextVk *contextVk,
+                                                         DirtyBits::Iterator *dirtyBitsIterator,
+                                                         DirtyBits dirtyBitMask);
+    using ComputeDirtyBitDispatcher  = angle::Result (*)(ContextVk *contextVk,
+                                                        DirtyBits::Iterator *dirtyBitsIterator);
+
+    template <GraphicsDirtyBitHandler kHandler>
+    static angle::Result DispatchGraphicsDirtyBit(ContextVk *contextVk,
+                                                  DirtyBits::Iterator *dirtyBitsIterator,
+                                                  DirtyBits dirtyBitMask)
+    {
+        return (contextVk->*kHandler)(dirtyBitsIterator, dirtyBitMask);
+    }
+    template <ComputeDirtyBitHandler kHandler>
+    static angle::Result DispatchComputeDirtyBit(ContextVk *contextVk,
+                                                 DirtyBits::Iterator *dirtyBitsIterator)
+    {
+        return (contextVk->*kHandler)(dirtyBitsIterator);
+    }
+
     // The GpuEventQuery struct holds together a timestamp query and enough data to create a
     // trace event based on that. Use traceGpuEvent to insert such queries.  They will be readback
     // when the results are available, without inserting a GPU bubble.
@@ -1184,6 +1257,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                               const egl::Surface *currentDrawSurface);
     void updateSurfaceRotationReadFramebuffer(const gl::State &glState,
                                               const egl::Surface *currentReadSurface);
+    void getDrawFramebufferFlip(bool *flipXOut, bool *flipYOut, bool *invertViewportOut) const;
 
     angle::Result updateActiveTextures(const gl::Context *context, gl::Command command);
     template <typename CommandBufferHelperT>
@@ -1304,6 +1378,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result handleDirtyGraphicsDynamicPrimitiveRestartEnable(
         DirtyBits::Iterator *dirtyBitsIterator,
         DirtyBits dirtyBitMask);
+    angle::Result handleDirtyGraphicsDynamicColorBlendEquation(
+        DirtyBits::Iterator *dirtyBitsIterator,
+        DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsDynamicFragmentShadingRate(
         DirtyBits::Iterator *dirtyBitsIterator,
         DirtyBits dirtyBitMask);
@@ -1354,9 +1431,19 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result flushImpl(const gl::Context *context);
 
     angle::Result synchronizeCpuGpuTime();
+    angle::Result synchronizeCpuGpuTimeWithCalibratedTimestamps();
+    angle::Result getCalibratedDeviceTimestamp(uint64_t *timestampCyclesOut);
+    void updateGpuClockSync(double cpuTimestampS, uint64_t gpuTimestampCycles);
     angle::Result traceGpuEventImpl(vk::OutsideRenderPassCommandBuffer *commandBuffer,
                                     char phase,
                                     const EventName &name);
+    angle::Result traceUtilsGpuEventImpl(vk::OutsideRenderPassCommandBuffer *commandBuffer,
+                                         char phase,
+                                         const char *functionName);
+    angle::Result updateGpuEventSampling();
+    // Records cache, buffer pool and submit queue sizes as trace counters once a frame.
+    void traceCounters();
+    void addToGpuPassTimeline(const GpuEvent &gpuEvent);
     angle::Result checkCompletedGpuEvents();
     void flushGpuEvents(double nextSyncGpuTimestampS, double nextSyncCpuTimestampS);
     void handleDeviceLost();
@@ -1372,6 +1459,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                DirtyBits dirtyBitMask,
                                                RenderPassClosureReason reason);
 
+    // Split the render pass commands so that they can be encoded in parallel when the render pass
+    // is flushed.  See ParallelCommandEncoder.
+    bool canInsertParallelEncodeBoundary() const;
+    void insertParallelEncodeBoundary();
+
     // Mark the render pass to be closed on the next draw call.  The render pass is not actually
     // closed and can be restored with restoreFinishedRenderPass if necessary, for example to append
     // a resolve attachment.
@@ -1420,6 +1512,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void updateScissor(const gl::State &glState);
 
+    bool isFramebufferFetchBarrierNeeded() const;
+    void trackFramebufferFetchDrawWrite();
+
     void updateDepthStencil(const gl::State &glState);
     void updateDepthTestEnabled(const gl::State &glState);
     void updateDepthWriteEnabled(const gl::State &glState);
@@ -1454,6 +1549,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         const vk::SharedDescriptorSetCacheKey &sharedCacheKey);
 
     angle::Result createGraphicsPipeline();
+    angle::Result getPipelineForPendingGraphicsPipeline(const vk::Pipeline **pipelineOut);
 
     angle::Result allocateQueueSerialIndex();
     void releaseQueueSerialIndex();
@@ -1462,11 +1558,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     void generateRenderPassCommandsQueueSerial(QueueSerial *queueSerialOut);
 
     angle::Result ensureInterfacePipelineCache();
+    // Creates the vertex input and fragment output pipeline libraries of every description in the
+    // renderer's GraphicsPipelineDescCorpus, once per share group.
+    angle::Result warmUpInterfacePipelines(vk::PipelineCacheAccess *pipelineCache);
 
     angle::ImageLoadContext mImageLoadContext;
 
-    std::array<GraphicsDirtyBitHandler, DIRTY_BIT_MAX> mGraphicsDirtyBitHandlers;
-    std::array<ComputeDirtyBitHandler, DIRTY_BIT_MAX> mComputeDirtyBitHandlers;
+    std::array<GraphicsDirtyBitDispatcher, DIRTY_BIT_MAX> mGraphicsDirtyBitHandlers;
+    std::array<ComputeDirtyBitDispatcher, DIRTY_BIT_MAX> mComputeDirtyBitHandlers;
 
     vk::RenderPassCommandBuffer *mRenderPassCommandBuffer;
 
@@ -1475,8 +1574,27 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     vk::PipelineHelper *mCurrentGraphicsPipelineVertexInput;
     vk::PipelineHelper *mCurrentGraphicsPipelineFragmentOutput;
     vk::PipelineHelper *mCurrentComputePipeline;
+    // With asyncGraphicsPipelineCreationOnCacheMiss, |mCurrentGraphicsPipeline| may still be in
+    // the process of being created.  In that case, a compatible pipeline of the same program is
+    // bound in its place.  The search for that fallback is done once per pending pipeline;
+    // |mPendingGraphicsPipeline| is the pipeline for which |mPendingGraphicsPipelineFallback| was
+    // found.
+    vk::PipelineHelper *mPendingGraphicsPipeline;
+    vk::PipelineHelper *mPendingGraphicsPipelineFallback;
+    // Set if there is no fallback and skipDrawOnPendingGraphicsPipeline is enabled.
+    bool mSkipDrawForPendingGraphicsPipeline;
     gl::PrimitiveMode mCurrentDrawMode;
 
+    // A framebuffer fetch barrier is only needed if the draw may read pixels that were written
+    // since the last barrier in the render pass.  Once the context has issued one, the area
+    // written by draws since the last barrier is tracked, along with the render pass write command
+    // count those draws account for.  Writes that are not tracked, such as clears and UtilsVk
+    // draws, make the counts mismatch, and the next barrier is issued regardless of the area.
+    bool mIsFramebufferFetchWriteTracked;
+    QueueSerial mFramebufferFetchRenderPassQueueSerial;
+    uint32_t mFramebufferFetchTrackedWriteCommandCount;
+    gl::Rectangle mFramebufferFetchUnsyncedWriteArea;
+
     WindowSurfaceVk *mCurrentWindowSurface;
     // Records the current rotation of the surface (draw/read) framebuffer, derived from
     // mCurrentWindowSurface->getPreTransform().
@@ -1531,6 +1649,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     DirtyBits mIndexedDirtyBitsMask;
     DirtyBits mNewGraphicsCommandBufferDirtyBits;
     DirtyBits mNewComputeCommandBufferDirtyBits;
+    // Compute dirty bits whose handlers may record barriers in the outside render pass commands.
+    DirtyBits mComputeBarrierDirtyBits;
     DirtyBits mDynamicStateDirtyBits;
     DirtyBits mPersistentGraphicsDirtyBits;
     static constexpr DirtyBits kColorAccessChangeDirtyBits{DIRTY_BIT_COLOR_ACCESS};
@@ -1600,11 +1720,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // attributes. mHasInFlightStreamedVertexBuffers indicates if the dynamic buffer has any
     // in-flight buffer or not that we need to release at submission time.
     gl::AttribArray<vk::DynamicBuffer> mStreamedVertexBuffers;
+    gl::AttribArray<uint32_t> mStreamedVertexBufferGenerations;
     gl::AttributesMask mHasInFlightStreamedVertexBuffers;
 
     // We use a single pool for recording commands. We also keep a free list for pool recycling.
     vk::SecondaryCommandPools mCommandPools;
 
+    // Used to encode the render pass commands on worker threads, lazily initialized if the
+    // parallelRenderPassCommandEncoding feature is enabled.
+    vk::ParallelCommandEncoder mParallelCommandEncoder;
+
     // Per context queue serial
     SerialIndex mCurrentQueueSerialIndex;
     QueueSerial mLastFlushedQueueSerial;
@@ -1619,6 +1744,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // renderer's mSharedGarbageList.
     vk::GarbageObjects mCurrentGarbage;
 
+    // The garbage of the objects deleted in the current object deletion batch, and the merged use
+    // of all of them.
+    bool mIsBatchingObjectDeletion;
+    vk::GarbageObjects mObjectDeletionGarbage;
+    vk::ResourceUse mObjectDeletionGarbageUse;
+
     RenderPassCache mRenderPassCache;
     // Used with dynamic rendering as it doesn't use render passes.
     vk::RenderPass mNullRenderPass;
@@ -1647,6 +1778,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     UtilsVk mUtils;
 
     bool mGpuEventsEnabled;
+    // GPU events are only recorded in one of every mGpuEventFrameInterval frames, to bound the
+    // overhead of the timestamp queries.  mGpuEventsSampled is only changed at frame boundaries,
+    // where no event is left open other than the one encompassing the primary command buffer.
+    bool mGpuEventsSampled;
+    uint32_t mGpuEventFrameInterval;
+    uint64_t mGpuEventFrameCounter;
     vk::DynamicQueryPool mGpuEventQueryPool;
     // A list of queries that have yet to be turned into an event (their result is not yet
     // available).
@@ -1655,6 +1792,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     std::vector<GpuEvent> mGpuEvents;
     // The current frame index, used to generate a submission-encompassing event tagged with it.
     uint32_t mPrimaryBufferEventCounter;
+    // The begin timestamps of the completed events that are not yet ended, and the GPU time of
+    // each render pass and UtilsVk dispatch completed since the last overlay update.
+    std::vector<uint64_t> mGpuEventBeginCycles;
+    std::string mGpuPassTimeline;
 
     // Cached value of the color attachment mask of the current draw framebuffer.  This is used to
     // know which attachment indices have their blend state set in |mGraphicsPipelineDesc|, and
@@ -1690,6 +1831,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // True if current started render pass is allowed to reactivate.
     bool mAllowRenderPassToReactivate;
 
+    // The framebuffers of the last two render passes started for draw calls, most recent first.
+    // Used to count the render passes that follow a render pass to another framebuffer and that
+    // target the same framebuffer as the one before it (A, B, A), which could be merged if the
+    // render passes were reordered.
+    std::array<vk::FramebufferDesc, 2> mRecentRenderPassFramebufferDescs;
+
     // The size of copy commands issued between buffers and images. Used to submit the command
     // buffer for the outside render pass.
     VkDeviceSize mTotalBufferToImageCopySize;
@@ -1828,7 +1975,7 @@ uint32_t GetDriverUniformSize(vk::Context *context, PipelineType pipelineType);
     {                                                                           \
         char ANGLE_MESSAGE[200];                                                \
         snprintf(ANGLE_MESSAGE, sizeof(ANGLE_MESSAGE), __VA_ARGS__);            \
-        ANGLE_TRACE_EVENT0("gpu.angle", ANGLE_MESSAGE);                         \
+        ANGLE_TRACE_EVENT_COPY_INSTANT("gpu.angle", ANGLE_MESSAGE);             \
                                                                                 \
         contextVk->insertEventMarkerImpl(GL_DEBUG_SOURCE_OTHER, ANGLE_MESSAGE); \
     } while (0)
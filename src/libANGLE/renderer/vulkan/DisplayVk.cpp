@@ -9,6 +9,8 @@
 
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 
+#include "common/SimpleMutex.h"
+#include "common/base/anglebase/no_destructor.h"
 #include "common/debug.h"
 #include "common/system_utils.h"
 #include "libANGLE/BlobCache.h"
@@ -149,12 +151,117 @@ void InstallDebugAnnotator(egl::Display *display, vk::Renderer *renderer)
         display->setGlobalDebugAnnotator();
     }
 }
+
+// With shareRendererAcrossDisplays, the displays that make the same device selection with the same
+// feature overrides share one renderer.  The renderer stays in the list when the last display using
+// it is terminated, so the next one starts with the device and its caches already warm.
+struct SharedRendererKey
+{
+    bool operator==(const SharedRendererKey &other) const
+    {
+        return icd == other.icd && preferredVendorId == other.preferredVendorId &&
+               preferredDeviceId == other.preferredDeviceId &&
+               useDebugLayers == other.useDebugLayers && wsiExtension == other.wsiExtension &&
+               wsiLayer == other.wsiLayer && windowSystem == other.windowSystem &&
+               featureOverrides.enabled == other.featureOverrides.enabled &&
+               featureOverrides.disabled == other.featureOverrides.disabled &&
+               featureOverrides.allDisabled == other.featureOverrides.allDisabled;
+    }
+
+    angle::vk::ICD icd;
+    uint32_t preferredVendorId;
+    uint32_t preferredDeviceId;
+    vk::UseDebugLayers useDebugLayers;
+    std::string wsiExtension;
+    std::string wsiLayer;
+    angle::NativeWindowSystem windowSystem;
+    angle::FeatureOverrides featureOverrides;
+};
+
+struct SharedRenderer
+{
+    SharedRendererKey key;
+    vk::Renderer *renderer;
+    // The initialized displays using the renderer.  The first one provides its global ops.
+    std::vector<DisplayVk *> displays;
+};
+
+struct SharedRendererList
+{
+    angle::SimpleMutex mutex;
+    std::vector<SharedRenderer> renderers;
+};
+
+SharedRendererList &GetSharedRendererList()
+{
+    static angle::base::NoDestructor<SharedRendererList> sSharedRendererList;
+    return *sSharedRendererList;
+}
+
+vk::Renderer *AcquireSharedRenderer(const SharedRendererKey &key, DisplayVk *display)
+{
+    SharedRendererList &list = GetSharedRendererList();
+    std::lock_guard<angle::SimpleMutex> lock(list.mutex);
+
+    for (SharedRenderer &shared : list.renderers)
+    {
+        if (shared.key == key && !shared.renderer->isDeviceLost())
+        {
+            if (shared.displays.empty())
+            {
+                shared.renderer->setGlobalOps(display);
+            }
+            shared.displays.push_back(display);
+            return shared.renderer;
+        }
+    }
+    return nullptr;
+}
+
+void AddSharedRenderer(const SharedRendererKey &key, vk::Renderer *renderer, DisplayVk *display)
+{
+    SharedRendererList &list = GetSharedRendererList();
+    std::lock_guard<angle::SimpleMutex> lock(list.mutex);
+
+    list.renderers.push_back({key, renderer, {display}});
+}
+
+// Returns true if the renderer has no more displays and must be destroyed, which is only the case
+// if its device is lost.
+bool ReleaseSharedRenderer(vk::Renderer *renderer, DisplayVk *display)
+{
+    SharedRendererList &list = GetSharedRendererList();
+    std::lock_guard<angle::SimpleMutex> lock(list.mutex);
+
+    auto sharedIter = std::find_if(
+        list.renderers.begin(), list.renderers.end(),
+        [renderer](const SharedRenderer &shared) { return shared.renderer == renderer; });
+    ASSERT(sharedIter != list.renderers.end());
+
+    std::vector<DisplayVk *> &displays = sharedIter->displays;
+    displays.erase(std::find(displays.begin(), displays.end(), display));
+
+    if (!displays.empty())
+    {
+        renderer->setGlobalOps(displays.front());
+        return false;
+    }
+
+    renderer->setGlobalOps(nullptr);
+    if (renderer->isDeviceLost())
+    {
+        list.renderers.erase(sharedIter);
+        return true;
+    }
+    return false;
+}
 }  // namespace
 
 DisplayVk::DisplayVk(const egl::DisplayState &state)
     : DisplayImpl(state),
       vk::Context(new vk::Renderer()),
       mScratchBuffer(1000u),
+      mIsRendererShared(false),
       mSupportedColorspaceFormatsMap{}
 {}
 
@@ -175,10 +282,39 @@ egl::Error DisplayVk::initialize(egl::Display *display)
     const uint32_t preferredDeviceId =
         static_cast<uint32_t>(attribs.get(EGL_PLATFORM_ANGLE_DEVICE_ID_LOW_ANGLE, 0));
 
-    angle::Result result = mRenderer->initialize(
-        this, this, desiredICD, preferredVendorId, preferredDeviceId, useDebugLayers,
-        getWSIExtension(), getWSILayer(), getWindowSystem(), mState.featureOverrides);
-    ANGLE_TRY(angle::ToEGL(result, EGL_NOT_INITIALIZED));
+    const char *wsiLayer = getWSILayer();
+
+    SharedRendererKey sharedRendererKey;
+    sharedRendererKey.icd               = desiredICD;
+    sharedRendererKey.preferredVendorId = preferredVendorId;
+    sharedRendererKey.preferredDeviceId = preferredDeviceId;
+    sharedRendererKey.useDebugLayers    = useDebugLayers;
+    sharedRendererKey.wsiExtension      = getWSIExtension();
+    sharedRendererKey.wsiLayer          = wsiLayer != nullptr ? wsiLayer : "";
+    sharedRendererKey.windowSystem      = getWindowSystem();
+    sharedRendererKey.featureOverrides  = mState.featureOverrides;
+
+    vk::Renderer *sharedRenderer = AcquireSharedRenderer(sharedRendererKey, this);
+    if (sharedRenderer != nullptr)
+    {
+        // The renderer this display was created with was never initialized.
+        delete mRenderer;
+        mRenderer         = sharedRenderer;
+        mIsRendererShared = true;
+    }
+    else
+    {
+        angle::Result result = mRenderer->initialize(
+            this, this, desiredICD, preferredVendorId, preferredDeviceId, useDebugLayers,
+            getWSIExtension(), wsiLayer, getWindowSystem(), mState.featureOverrides);
+        ANGLE_TRY(angle::ToEGL(result, EGL_NOT_INITIALIZED));
+
+        if (mRenderer->getFeatures().shareRendererAcrossDisplays.enabled)
+        {
+            AddSharedRenderer(sharedRendererKey, mRenderer, this);
+            mIsRendererShared = true;
+        }
+    }
 
     mDeviceQueueIndex = mRenderer->getDeviceQueueIndex(egl::ContextPriority::Medium);
 
@@ -194,7 +330,21 @@ void DisplayVk::terminate()
     mRenderer->reloadVolkIfNeeded();
 
     ASSERT(mRenderer);
-    mRenderer->onDestroy(this);
+    if (!mIsRendererShared)
+    {
+        mRenderer->onDestroy(this);
+        return;
+    }
+
+    // The shared renderer is kept for other displays, and this display gets a new one in case it
+    // is initialized again.
+    if (ReleaseSharedRenderer(mRenderer, this))
+    {
+        mRenderer->onDestroy(this);
+        delete mRenderer;
+    }
+    mRenderer         = new vk::Renderer();
+    mIsRendererShared = false;
 }
 
 egl::Error DisplayVk::makeCurrent(egl::Display *display,
@@ -531,6 +681,9 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
     outExtensions->imageNativeBuffer     = getFeatures().supportsAndroidHardwareBuffer.enabled;
     outExtensions->surfacelessContext = true;
     outExtensions->glColorspace       = true;
+
+    // Paced through the swap history in WindowSurfaceVk::throttleCPU.
+    outExtensions->maxFrameLatencyANGLE = true;
     outExtensions->imageGlColorspace =
         outExtensions->glColorspace && getFeatures().supportsImageFormatList.enabled;
 
@@ -138,6 +138,10 @@ class DisplayVk : public DisplayImpl, public vk::Context, public vk::GlobalOps
 
     angle::ScratchBuffer mScratchBuffer;
 
+    // Whether mRenderer is shared with other displays, in which case it is owned by the list of
+    // shared renderers instead of this display.
+    bool mIsRendererShared;
+
     // Map of supported colorspace and associated surface format set.
     angle::HashMap<VkColorSpaceKHR, std::unordered_set<VkFormat>> mSupportedColorspaceFormatsMap;
 };
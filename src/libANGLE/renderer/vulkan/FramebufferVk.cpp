@@ -21,6 +21,7 @@
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/RenderTargetVk.h"
+#include "libANGLE/renderer/vulkan/RenderbufferVk.h"
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 #include "libANGLE/renderer/vulkan/vk_renderer.h"
@@ -40,6 +41,68 @@ constexpr VkClearValue kUninitializedClearValue = {{{0.95, 0.05, 0.95, 0.95}}};
 // automatically convert to the actual data type.
 constexpr unsigned int kEmulatedAlphaValue = 1;
 
+RenderbufferVk *GetReadColorRenderbuffer(const gl::Framebuffer *framebuffer)
+{
+    const gl::FramebufferAttachment *readAttachment = framebuffer->getState().getReadAttachment();
+    if (readAttachment == nullptr || readAttachment->type() != GL_RENDERBUFFER)
+    {
+        return nullptr;
+    }
+    return vk::GetImpl(readAttachment->getRenderbuffer());
+}
+
+// A transient renderbuffer can only be used as an attachment, so it's given regular memory before
+// it's read by a blit that isn't done in a subpass.
+angle::Result EnsureReadColorRenderbufferNotTransient(ContextVk *contextVk,
+                                                      const gl::Framebuffer *framebuffer)
+{
+    RenderbufferVk *readRenderbuffer = GetReadColorRenderbuffer(framebuffer);
+    return readRenderbuffer != nullptr ? readRenderbuffer->ensureNotTransient(contextVk)
+                                       : angle::Result::Continue;
+}
+
+bool IsReadColorRenderbufferTransient(const gl::Framebuffer *framebuffer)
+{
+    RenderbufferVk *readRenderbuffer = GetReadColorRenderbuffer(framebuffer);
+    return readRenderbuffer != nullptr && readRenderbuffer->isTransient();
+}
+
+// Splits the part of |outer| that is not covered by |inner| into up to four rectangles, given
+// that |outer| encloses |inner|:
+//
+//     +-----------------+
+//     |        0        |
+//     +-----+-----+-----+
+//     |  2  |inner|  3  |
+//     +-----+-----+-----+
+//     |        1        |
+//     +-----------------+
+//
+// Empty rectangles are not output.
+uint32_t GetAreaOutsideEnclosedRectangle(const gl::Rectangle &outer,
+                                         const gl::Rectangle &inner,
+                                         std::array<gl::Rectangle, 4> *areasOut)
+{
+    ASSERT(outer.encloses(inner));
+
+    const std::array<gl::Rectangle, 4> areas = {{
+        {outer.x, outer.y, outer.width, inner.y - outer.y},
+        {outer.x, inner.y1(), outer.width, outer.y1() - inner.y1()},
+        {outer.x, inner.y, inner.x - outer.x, inner.height},
+        {inner.x1(), inner.y, outer.x1() - inner.x1(), inner.height},
+    }};
+
+    uint32_t count = 0;
+    for (const gl::Rectangle &area : areas)
+    {
+        if (!area.empty())
+        {
+            (*areasOut)[count++] = area;
+        }
+    }
+    return count;
+}
+
 bool HasSrcBlitFeature(vk::Renderer *renderer, RenderTargetVk *srcRenderTarget)
 {
     angle::FormatID srcFormatID = srcRenderTarget->getImageActualFormatID();
@@ -1126,9 +1189,27 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
     // them.  They correspond to attachments that are not used in the blit.  This will cause the
     // read framebuffer to become dirty, so the attachments will be synced again on the next command
     // that might be using them.
+    //
+    // The clear of the color attachment that is the source of the blit is restaged as well, but its
+    // value is remembered.  If the blit writes to the whole draw framebuffer, the blit is replaced
+    // by a clear of the draw attachments, which is then deferred to the loadOp of the next render
+    // pass.  Otherwise the source clear is flushed right before the blit.
     const gl::State &glState              = contextVk->getState();
     const gl::Framebuffer *srcFramebuffer = glState.getReadFramebuffer();
     FramebufferVk *srcFramebufferVk       = vk::GetImpl(srcFramebuffer);
+
+    const bool blitColorBuffer   = (mask & GL_COLOR_BUFFER_BIT) != 0;
+    const bool blitDepthBuffer   = (mask & GL_DEPTH_BUFFER_BIT) != 0;
+    const bool blitStencilBuffer = (mask & GL_STENCIL_BUFFER_BIT) != 0;
+
+    const uint32_t srcColorIndexGL = srcFramebuffer->getState().getReadIndex();
+    const bool isSrcColorCleared =
+        blitColorBuffer && srcFramebufferVk->mDeferredClears.test(srcColorIndexGL) &&
+        srcFramebufferVk->getColorReadRenderTarget() ==
+            srcFramebufferVk->getColorDrawRenderTarget(srcColorIndexGL);
+    const VkClearValue srcColorClearValue =
+        isSrcColorCleared ? srcFramebufferVk->mDeferredClears[srcColorIndexGL] : VkClearValue{};
+
     if (srcFramebufferVk->mDeferredClears.any())
     {
         srcFramebufferVk->restageDeferredClearsForReadFramebuffer(contextVk);
@@ -1138,10 +1219,6 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
     // are issued before we issue the blit command.
     ANGLE_TRY(flushDeferredClears(contextVk));
 
-    const bool blitColorBuffer   = (mask & GL_COLOR_BUFFER_BIT) != 0;
-    const bool blitDepthBuffer   = (mask & GL_DEPTH_BUFFER_BIT) != 0;
-    const bool blitStencilBuffer = (mask & GL_STENCIL_BUFFER_BIT) != 0;
-
     // If a framebuffer contains a mixture of multisampled and multisampled-render-to-texture
     // attachments, this function could be simultaneously doing a blit on one attachment and resolve
     // on another.  For the most part, this means resolve semantics apply.  However, as the resolve
@@ -1342,7 +1419,33 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
     commonParams.flipY                  = flipY;
     commonParams.rotation               = rotation;
 
-    if (blitColorBuffer)
+    // If the source of the color blit is cleared, the blit result is the same clear regardless of
+    // stretching, flipping, filtering or resolve.  If the whole draw framebuffer is written to,
+    // stage that clear on the draw attachments instead; the source attachment keeps its own clear
+    // staged.
+    bool blitColorAsClear = false;
+    if (isSrcColorCleared)
+    {
+        if (canBlitColorAsClear(contextVk, srcFramebufferVk->getColorReadRenderTarget(), blitArea))
+        {
+            for (size_t colorIndexGL : mState.getEnabledDrawBuffers())
+            {
+                RenderTargetVk *drawRenderTarget = mRenderTargetCache.getColors()[colorIndexGL];
+                gl::ImageIndex imageIndex        = drawRenderTarget->getImageIndexForClear(
+                    mCurrentFramebufferDesc.getLayerCount());
+                drawRenderTarget->getImageForWrite().stageClear(
+                    imageIndex, VK_IMAGE_ASPECT_COLOR_BIT, srcColorClearValue);
+            }
+            blitColorAsClear = true;
+        }
+        else
+        {
+            ANGLE_TRY(
+                srcFramebufferVk->flushColorAttachmentUpdates(context, false, srcColorIndexGL));
+        }
+    }
+
+    if (blitColorBuffer && !blitColorAsClear)
     {
         RenderTargetVk *readRenderTarget      = srcFramebufferVk->getColorReadRenderTarget();
         UtilsVk::BlitResolveParameters params = commonParams;
@@ -1430,9 +1533,9 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
             // data already being present in the tile.
 
             // Additionally, when resolving with a resolve attachment, the src and destination
-            // offsets must match, the render area must match the resolve area, and there should be
-            // no flipping or rotation.  Fortunately, in GLES the blit source and destination areas
-            // are already required to be identical.
+            // offsets must match, the render area must be within the resolve area, and there should
+            // be no flipping or rotation.  Fortunately, in GLES the blit source and destination
+            // areas are already required to be identical.
             ASSERT(params.srcOffset[0] == params.dstOffset[0] &&
                    params.srcOffset[1] == params.dstOffset[1]);
             bool canResolveWithSubpass = mState.getEnabledDrawBuffers().count() == 1 &&
@@ -1440,6 +1543,8 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
                                          contextVk->hasStartedRenderPassWithQueueSerial(
                                              srcFramebufferVk->getLastRenderPassQueueSerial()) &&
                                          !colorAttachmentAlreadyInUse;
+            bool resolveRemainderWithCommand = false;
+            gl::Rectangle subpassResolveArea;
 
             if (canResolveWithSubpass)
             {
@@ -1448,23 +1553,49 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
                 const vk::RenderPassDesc &renderPassDesc = renderPassCommands.getRenderPassDesc();
 
                 // Make sure that:
-                // - The blit and render areas are identical
+                // - The blit and render areas are identical, or the blit area encloses the render
+                //   area and the rest of it can be resolved with a command afterwards
                 // - There is no resolve attachment for the corresponding index already
                 // Additionally, disable the optimization for a few corner cases that are
                 // unrealistic and inconvenient.
-                const uint32_t readColorIndexGL = srcFramebuffer->getState().getReadIndex();
+                const uint32_t readColorIndexGL  = srcFramebuffer->getState().getReadIndex();
+                const gl::Rectangle &renderArea = renderPassCommands.getRenderArea();
+                resolveRemainderWithCommand     = blitArea != renderArea;
                 canResolveWithSubpass =
-                    blitArea == renderPassCommands.getRenderArea() &&
+                    (!resolveRemainderWithCommand ||
+                     (blitArea.encloses(renderArea) &&
+                      !IsReadColorRenderbufferTransient(srcFramebuffer))) &&
                     !renderPassDesc.hasColorResolveAttachment(readColorIndexGL) &&
                     AllowAddingResolveAttachmentsToSubpass(renderPassDesc);
+                subpassResolveArea = renderArea;
             }
 
             if (canResolveWithSubpass)
             {
                 ANGLE_TRY(resolveColorWithSubpass(contextVk, params));
+
+                // The parts of the blit area the render pass didn't render to are resolved after
+                // the render pass, which only adds a dependency on the resolve attachment.
+                if (resolveRemainderWithCommand)
+                {
+                    ANGLE_TRY(EnsureReadColorRenderbufferNotTransient(contextVk, srcFramebuffer));
+
+                    std::array<gl::Rectangle, 4> remainingAreas;
+                    const uint32_t remainingAreaCount = GetAreaOutsideEnclosedRectangle(
+                        blitArea, subpassResolveArea, &remainingAreas);
+
+                    UtilsVk::BlitResolveParameters remainderParams = params;
+                    for (uint32_t areaIndex = 0; areaIndex < remainingAreaCount; ++areaIndex)
+                    {
+                        remainderParams.blitArea = remainingAreas[areaIndex];
+                        ANGLE_TRY(resolveColorWithCommand(contextVk, remainderParams,
+                                                          &readRenderTarget->getImageForCopy()));
+                    }
+                }
             }
             else
             {
+                ANGLE_TRY(EnsureReadColorRenderbufferNotTransient(contextVk, srcFramebuffer));
                 ANGLE_TRY(resolveColorWithCommand(contextVk, params,
                                                   &readRenderTarget->getImageForCopy()));
             }
@@ -1472,6 +1603,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
         else
         {
             // Otherwise use a shader to do blit or resolve.
+            ANGLE_TRY(EnsureReadColorRenderbufferNotTransient(contextVk, srcFramebuffer));
 
             // Flush the render pass, which may incur a vkQueueSubmit, before taking any views.
             // Otherwise the view serials would not reflect the render pass they are really used in.
@@ -1971,6 +2103,12 @@ angle::Result FramebufferVk::resolveColorWithSubpass(ContextVk *contextVk,
     drawRenderTarget->onColorResolve(contextVk, mCurrentFramebufferDesc.getLayerCount(),
                                      readColorIndexGL, *resolveImageView);
 
+    RenderbufferVk *readRenderbuffer = GetReadColorRenderbuffer(srcFramebuffer);
+    if (readRenderbuffer != nullptr)
+    {
+        readRenderbuffer->onColorResolveWithSubpass();
+    }
+
     // The render pass is already closed because of the change in the draw buffer.  Just don't let
     // it reactivate now that it has a resolve attachment.
     contextVk->disableRenderPassReactivation();
@@ -2056,6 +2194,48 @@ angle::Result FramebufferVk::resolveColorWithCommand(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+bool FramebufferVk::canBlitColorAsClear(ContextVk *contextVk,
+                                        RenderTargetVk *readRenderTarget,
+                                        const gl::Rectangle &blitArea) const
+{
+    // The clear is staged on the entire draw attachments, so the blit must cover all of them.
+    if (blitArea != getRotatedCompleteRenderArea(contextVk) ||
+        mCurrentFramebufferDesc.getLayerCount() != 1 || hasAnyExternalAttachments() ||
+        IsAnyAttachment3DWithoutAllLayers(mRenderTargetCache, mState.getColorAttachmentsMask(),
+                                          mCurrentFramebufferDesc.getLayerCount()))
+    {
+        return false;
+    }
+
+    if (readRenderTarget->isYuvResolve() || readRenderTarget->hasColorspaceOverrideForRead())
+    {
+        return false;
+    }
+
+    // The clear value is already adjusted to the format of the read attachment, so it can only be
+    // used as is if no conversion would have been done by the blit.
+    for (size_t colorIndexGL : mState.getEnabledDrawBuffers())
+    {
+        RenderTargetVk *drawRenderTarget = mRenderTargetCache.getColors()[colorIndexGL];
+        if (!AreSrcAndDstFormatsIdentical(readRenderTarget, drawRenderTarget) ||
+            readRenderTarget->getImageIntendedFormatID() !=
+                drawRenderTarget->getImageIntendedFormatID() ||
+            drawRenderTarget->isYuvResolve() || drawRenderTarget->hasColorspaceOverrideForWrite())
+        {
+            return false;
+        }
+
+        // Staging a clear on an image that is already used in the render pass would be applied
+        // out of order.
+        if (contextVk->isRenderPassStartedAndUsesImage(drawRenderTarget->getImageForRenderPass()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 gl::FramebufferStatus FramebufferVk::checkStatus(const gl::Context *context) const
 {
     // if we have both a depth and stencil buffer, they must refer to the same object
@@ -2219,6 +2399,21 @@ angle::Result FramebufferVk::invalidateImpl(ContextVk *contextVk,
         }
     }
 
+    // Now that the render pass discards them, renderbuffers that are repeatedly resolved and then
+    // invalidated may be made transient.
+    if (!isSubInvalidate)
+    {
+        for (size_t colorIndexGL : mState.getEnabledDrawBuffers())
+        {
+            const gl::FramebufferAttachment *color = mState.getColorAttachment(colorIndexGL);
+            if (invalidateColorBuffers.test(colorIndexGL) && color->type() == GL_RENDERBUFFER)
+            {
+                RenderbufferVk *renderbufferVk = vk::GetImpl(color->getRenderbuffer());
+                ANGLE_TRY(renderbufferVk->onEntireContentInvalidated(contextVk));
+            }
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -2529,7 +2724,9 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
     // completely covers the framebuffer, even if the operation that follows is scissored.
     //
     // Additionally, defer clears for read framebuffer attachments that are not taking part in a
-    // blit operation.
+    // blit operation.  Color clears of the read framebuffer are always deferred for blits; blit()
+    // either turns a blit from a cleared attachment into a clear of the draw framebuffer, or
+    // flushes the clear before the blit.
     const bool isBlitCommand = command >= gl::Command::Blit && command <= gl::Command::BlitAll;
 
     bool deferColorClears        = binding == GL_DRAW_FRAMEBUFFER;
@@ -2538,10 +2735,7 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
     {
         uint32_t blitMask =
             static_cast<uint32_t>(command) - static_cast<uint32_t>(gl::Command::Blit);
-        if ((blitMask & gl::CommandBlitBufferColor) == 0)
-        {
-            deferColorClears = true;
-        }
+        deferColorClears = true;
         if ((blitMask & (gl::CommandBlitBufferDepth | gl::CommandBlitBufferStencil)) == 0)
         {
             deferDepthStencilClears = true;
@@ -147,6 +147,7 @@ class FramebufferVk : public FramebufferImpl
     void releaseCurrentFramebuffer(ContextVk *contextVk);
 
     const QueueSerial &getLastRenderPassQueueSerial() const { return mLastRenderPassQueueSerial; }
+    const vk::FramebufferDesc &getFramebufferDesc() const { return mCurrentFramebufferDesc; }
 
     bool hasAnyExternalAttachments() const { return mIsExternalColorAttachments.any(); }
 
@@ -227,6 +228,11 @@ class FramebufferVk : public FramebufferImpl
                                           const UtilsVk::BlitResolveParameters &params,
                                           vk::ImageHelper *srcImage);
 
+    // Whether a color blit from a cleared read attachment can instead clear the draw attachments.
+    bool canBlitColorAsClear(ContextVk *contextVk,
+                             RenderTargetVk *readRenderTarget,
+                             const gl::Rectangle &blitArea) const;
+
     angle::Result clearImpl(const gl::Context *context,
                             gl::DrawBufferMask clearColorBuffers,
                             bool clearDepth,
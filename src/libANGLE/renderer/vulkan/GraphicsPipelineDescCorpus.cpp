@@ -0,0 +1,178 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GraphicsPipelineDescCorpus.cpp:
+//    Implements GraphicsPipelineDescCorpus.
+//
+
+#include "libANGLE/renderer/vulkan/GraphicsPipelineDescCorpus.h"
+
+#include <cstring>
+#include <fstream>
+
+#include "common/debug.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+constexpr char kCorpusMagic[8] = {'A', 'N', 'G', 'L', 'E', 'G', 'P', 'D'};
+constexpr uint32_t kCorpusVersion  = 1;
+
+struct CorpusHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t descSize;
+    uint64_t entryCount;
+};
+
+struct CorpusEntryHeader
+{
+    uint64_t programKey;
+    uint8_t permutationIndex;
+    uint8_t padding[7];
+};
+}  // anonymous namespace
+
+GraphicsPipelineDescCorpus::GraphicsPipelineDescCorpus() : mEntryCount(0) {}
+
+GraphicsPipelineDescCorpus::~GraphicsPipelineDescCorpus() = default;
+
+void GraphicsPipelineDescCorpus::record(uint64_t programKey,
+                                        uint8_t permutationIndex,
+                                        const GraphicsPipelineDesc &desc)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    std::vector<Entry> &entries = mEntries[programKey];
+    for (const Entry &entry : entries)
+    {
+        if (entry.permutationIndex == permutationIndex &&
+            entry.desc.keyEqual(desc, GraphicsPipelineSubset::Complete))
+        {
+            return;
+        }
+    }
+
+    entries.push_back({permutationIndex, desc});
+    ++mEntryCount;
+}
+
+std::vector<GraphicsPipelineDescCorpus::Entry> GraphicsPipelineDescCorpus::getEntries(
+    uint64_t programKey) const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    auto iter = mEntries.find(programKey);
+    if (iter == mEntries.end())
+    {
+        return {};
+    }
+    return iter->second;
+}
+
+std::vector<GraphicsPipelineDesc> GraphicsPipelineDescCorpus::getAllDescs() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    std::vector<GraphicsPipelineDesc> descs;
+    descs.reserve(mEntryCount);
+    for (const auto &programEntries : mEntries)
+    {
+        for (const Entry &entry : programEntries.second)
+        {
+            descs.push_back(entry.desc);
+        }
+    }
+    return descs;
+}
+
+bool GraphicsPipelineDescCorpus::empty() const
+{
+    return size() == 0;
+}
+
+size_t GraphicsPipelineDescCorpus::size() const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+    return mEntryCount;
+}
+
+bool GraphicsPipelineDescCorpus::load(const std::string &path)
+{
+    std::ifstream in(path, std::ifstream::binary);
+    if (!in.is_open())
+    {
+        return false;
+    }
+
+    CorpusHeader header = {};
+    in.read(reinterpret_cast<char *>(&header), sizeof(header));
+    if (!in || memcmp(header.magic, kCorpusMagic, sizeof(kCorpusMagic)) != 0 ||
+        header.version != kCorpusVersion || header.descSize != sizeof(GraphicsPipelineDesc))
+    {
+        WARN() << "Ignoring incompatible graphics pipeline desc corpus: " << path;
+        return false;
+    }
+
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    for (uint64_t index = 0; index < header.entryCount; ++index)
+    {
+        CorpusEntryHeader entryHeader;
+        Entry entry;
+        in.read(reinterpret_cast<char *>(&entryHeader), sizeof(entryHeader));
+        in.read(reinterpret_cast<char *>(&entry.desc), sizeof(entry.desc));
+        if (!in)
+        {
+            WARN() << "Graphics pipeline desc corpus is truncated: " << path;
+            break;
+        }
+
+        entry.permutationIndex = entryHeader.permutationIndex;
+        mEntries[entryHeader.programKey].push_back(entry);
+        ++mEntryCount;
+    }
+
+    return mEntryCount > 0;
+}
+
+bool GraphicsPipelineDescCorpus::save(const std::string &path) const
+{
+    std::ofstream out(path, std::ofstream::binary);
+    if (!out.is_open())
+    {
+        WARN() << "Unable to open " << path << " to write the graphics pipeline desc corpus";
+        return false;
+    }
+
+    std::lock_guard<angle::SimpleMutex> lock(mMutex);
+
+    CorpusHeader header = {};
+    memcpy(header.magic, kCorpusMagic, sizeof(kCorpusMagic));
+    header.version    = kCorpusVersion;
+    header.descSize   = sizeof(GraphicsPipelineDesc);
+    header.entryCount = mEntryCount;
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    for (const auto &programEntries : mEntries)
+    {
+        for (const Entry &entry : programEntries.second)
+        {
+            CorpusEntryHeader entryHeader = {};
+            entryHeader.programKey        = programEntries.first;
+            entryHeader.permutationIndex  = entry.permutationIndex;
+            out.write(reinterpret_cast<const char *>(&entryHeader), sizeof(entryHeader));
+            out.write(reinterpret_cast<const char *>(&entry.desc), sizeof(entry.desc));
+        }
+    }
+
+    return static_cast<bool>(out);
+}
+}  // namespace vk
+}  // namespace rx
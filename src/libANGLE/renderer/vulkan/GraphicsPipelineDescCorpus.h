@@ -0,0 +1,67 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// GraphicsPipelineDescCorpus.h:
+//    Defines GraphicsPipelineDescCorpus, a recorded set of GraphicsPipelineDescs keyed by program
+//    that is used to precompile pipelines when a matching program is linked.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_GRAPHICSPIPELINEDESCCORPUS_H_
+#define LIBANGLE_RENDERER_VULKAN_GRAPHICSPIPELINEDESCCORPUS_H_
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/SimpleMutex.h"
+#include "libANGLE/renderer/vulkan/vk_cache_utils.h"
+
+namespace rx
+{
+namespace vk
+{
+// The corpus maps a program key (a hash of the program's SPIR-V) to the graphics pipeline
+// descriptions that were used with that program.  In record mode, every newly created pipeline is
+// added to the corpus and the corpus is written to disk when the renderer is destroyed.  A corpus
+// loaded from disk is used at link time to warm up the pipeline cache on worker threads.
+//
+// The file format is tied to the exact build that produced it (sizeof(GraphicsPipelineDesc) is
+// validated on load), and the file is considered a trusted developer input.
+class GraphicsPipelineDescCorpus final : angle::NonCopyable
+{
+  public:
+    struct Entry
+    {
+        uint8_t permutationIndex;
+        GraphicsPipelineDesc desc;
+    };
+
+    GraphicsPipelineDescCorpus();
+    ~GraphicsPipelineDescCorpus();
+
+    // Adds the description if not already present for this program.  Thread-safe.
+    void record(uint64_t programKey, uint8_t permutationIndex, const GraphicsPipelineDesc &desc);
+
+    // Returns a copy of the entries recorded for this program.  Thread-safe.
+    std::vector<Entry> getEntries(uint64_t programKey) const;
+    // Returns a copy of the descriptions recorded for all programs.  Thread-safe.
+    std::vector<GraphicsPipelineDesc> getAllDescs() const;
+
+    bool empty() const;
+    size_t size() const;
+
+    // Returns false if the file is missing or was produced by an incompatible build.
+    bool load(const std::string &path);
+    bool save(const std::string &path) const;
+
+  private:
+    mutable angle::SimpleMutex mMutex;
+    std::unordered_map<uint64_t, std::vector<Entry>> mEntries;
+    size_t mEntryCount;
+};
+}  // namespace vk
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_GRAPHICSPIPELINEDESCCORPUS_H_
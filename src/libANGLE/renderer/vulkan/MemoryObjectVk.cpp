@@ -201,7 +201,7 @@ angle::Result MemoryObjectVk::createImage(ContextVk *contextVk,
         createFlags, vk::ImageLayout::ExternalPreInitialized, &externalMemoryImageCreateInfo,
         gl::LevelIndex(0), static_cast<uint32_t>(levels), layerCount,
         contextVk->isRobustResourceInitEnabled(), hasProtectedContent, vk::YcbcrConversionDesc{},
-        nullptr));
+        nullptr, nullptr));
 
     VkMemoryRequirements externalMemoryRequirements;
     image->getImage().getMemoryRequirements(renderer->getDevice(), &externalMemoryRequirements);
@@ -187,6 +187,34 @@ void LogMemoryHeapStats(vk::Renderer *renderer, vk::MemoryLogSeverity severity)
     // Output the log stream based on the level of severity.
     OutputMemoryLogStream(outStream, severity);
 }
+
+void LogSmallImagePoolStats(vk::Renderer *renderer, vk::MemoryLogSeverity severity)
+{
+    if (!renderer->getFeatures().useSmallImageMemoryPools.enabled)
+    {
+        return;
+    }
+
+    std::stringstream outStream;
+    outStream << "Small image memory pool info" << std::endl;
+
+    for (uint32_t i = 0; i < renderer->getMemoryProperties().getMemoryTypeCount(); i++)
+    {
+        vma::StatInfo::BasicInfo stats;
+        if (!renderer->getImageMemorySuballocator().getSmallImagePoolStats(renderer, i, &stats))
+        {
+            continue;
+        }
+
+        outStream << "Memory type index " << i << " | Block count: " << stats.blockCount
+                  << " | Block size: " << stats.blockBytes
+                  << " | Allocation count: " << stats.allocationCount
+                  << " | Allocation size: " << stats.allocationBytes << std::endl;
+    }
+
+    // Output the log stream based on the level of severity.
+    OutputMemoryLogStream(outStream, severity);
+}
 }  // namespace
 
 MemoryAllocationTracker::MemoryAllocationTracker(vk::Renderer *renderer)
@@ -236,6 +264,7 @@ void MemoryAllocationTracker::logMemoryStatsOnError()
     CheckForCurrentMemoryAllocations(mRenderer, vk::MemoryLogSeverity::WARN);
     LogPendingMemoryAllocation(mRenderer, vk::MemoryLogSeverity::WARN);
     LogMemoryHeapStats(mRenderer, vk::MemoryLogSeverity::WARN);
+    LogSmallImagePoolStats(mRenderer, vk::MemoryLogSeverity::WARN);
 }
 
 void MemoryAllocationTracker::onMemoryAllocImpl(vk::MemoryAllocationType allocType,
@@ -0,0 +1,192 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ParallelCommandEncoder:
+//    Implements the class methods for ParallelCommandEncoder.
+//
+
+#include "libANGLE/renderer/vulkan/ParallelCommandEncoder.h"
+
+#include "libANGLE/renderer/vulkan/vk_helpers.h"
+#include "libANGLE/trace.h"
+
+namespace rx
+{
+namespace vk
+{
+namespace
+{
+// Encodes the chunks firstChunk, firstChunk + chunkStride, firstChunk + 2 * chunkStride, ... of
+// the render pass commands.  All the chunks encoded by a task use the same command pool.
+class EncodeChunksTask : public angle::Closure
+{
+  public:
+    EncodeChunksTask(const priv::SecondaryCommandBuffer *commands,
+                     const VkCommandBufferBeginInfo *beginInfo,
+                     std::vector<VulkanSecondaryCommandBuffer> *chunkCommandBuffers,
+                     size_t firstChunk,
+                     size_t chunkStride)
+        : mCommands(commands),
+          mBeginInfo(beginInfo),
+          mChunkCommandBuffers(chunkCommandBuffers),
+          mFirstChunk(firstChunk),
+          mChunkStride(chunkStride),
+          mResult(VK_SUCCESS)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ParallelCommandEncoder::EncodeChunksTask");
+
+        for (size_t chunk = mFirstChunk; chunk < mChunkCommandBuffers->size();
+             chunk += mChunkStride)
+        {
+            // Note: VulkanSecondaryCommandBuffer's begin() and end() require a Context to report
+            // errors, which cannot be used from this thread.  The result is reported back instead.
+            priv::CommandBuffer &commandBuffer = (*mChunkCommandBuffers)[chunk];
+
+            mResult = commandBuffer.begin(*mBeginInfo);
+            if (mResult != VK_SUCCESS)
+            {
+                return;
+            }
+
+            mCommands->executeParallelEncodeChunk(commandBuffer.getHandle(), chunk);
+
+            mResult = commandBuffer.end();
+            if (mResult != VK_SUCCESS)
+            {
+                return;
+            }
+        }
+    }
+
+    VkResult getResult() const { return mResult; }
+
+  private:
+    const priv::SecondaryCommandBuffer *mCommands;
+    const VkCommandBufferBeginInfo *mBeginInfo;
+    std::vector<VulkanSecondaryCommandBuffer> *mChunkCommandBuffers;
+    size_t mFirstChunk;
+    size_t mChunkStride;
+    VkResult mResult;
+};
+}  // anonymous namespace
+
+ParallelCommandEncoder::ParallelCommandEncoder() = default;
+
+ParallelCommandEncoder::~ParallelCommandEncoder()
+{
+    ASSERT(mChunkCommandBuffers.empty());
+}
+
+angle::Result ParallelCommandEncoder::init(Context *context,
+                                           uint32_t queueFamilyIndex,
+                                           ProtectionType protectionType,
+                                           std::shared_ptr<angle::WorkerThreadPool> workerThreadPool)
+{
+    ASSERT(!valid());
+
+    for (SecondaryCommandPool &commandPool : mCommandPools)
+    {
+        ANGLE_TRY(commandPool.init(context, queueFamilyIndex, protectionType));
+    }
+
+    mWorkerThreadPool = std::move(workerThreadPool);
+    return angle::Result::Continue;
+}
+
+void ParallelCommandEncoder::destroy(VkDevice device)
+{
+    for (SecondaryCommandPool &commandPool : mCommandPools)
+    {
+        commandPool.destroy(device);
+    }
+    mWorkerThreadPool.reset();
+}
+
+angle::Result ParallelCommandEncoder::encode(Context *context,
+                                             priv::SecondaryCommandBuffer *commands,
+                                             const VkCommandBufferInheritanceInfo &inheritanceInfo,
+                                             PrimaryCommandBuffer *primary,
+                                             SecondaryCommandBufferCollector *collector)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ParallelCommandEncoder::encode");
+    ASSERT(valid());
+    ASSERT(mChunkCommandBuffers.empty());
+
+    const size_t chunkCount = commands->getParallelEncodeChunkCount();
+    const size_t taskCount  = std::min(chunkCount, kMaxTaskCount);
+
+    commands->prepareParallelExecute();
+
+    // Allocate the command buffers on this thread; the command pools are only ever accessed by
+    // one thread at a time: the task that uses it, or the context thread outside of encode().
+    mChunkCommandBuffers.resize(chunkCount);
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+    {
+        ANGLE_TRY(mChunkCommandBuffers[chunk].initialize(context, &mCommandPools[chunk % taskCount],
+                                                         true, nullptr));
+    }
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags =
+        VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    std::vector<std::shared_ptr<EncodeChunksTask>> tasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitableEvents;
+    tasks.reserve(taskCount);
+    waitableEvents.reserve(taskCount);
+
+    for (size_t taskIndex = 0; taskIndex < taskCount; ++taskIndex)
+    {
+        tasks.push_back(std::make_shared<EncodeChunksTask>(commands, &beginInfo,
+                                                           &mChunkCommandBuffers, taskIndex,
+                                                           taskCount));
+    }
+
+    // Post all but the first task to the worker threads; the first one is run on this thread.
+    for (size_t taskIndex = 1; taskIndex < taskCount; ++taskIndex)
+    {
+        std::shared_ptr<angle::WaitableEvent> waitableEvent =
+            mWorkerThreadPool->postWorkerTask(tasks[taskIndex]);
+        if (waitableEvent == nullptr)
+        {
+            (*tasks[taskIndex])();
+            continue;
+        }
+        waitableEvents.push_back(std::move(waitableEvent));
+    }
+    (*tasks[0])();
+    angle::WaitableEvent::WaitMany(&waitableEvents);
+
+    VkResult result = VK_SUCCESS;
+    for (const std::shared_ptr<EncodeChunksTask> &task : tasks)
+    {
+        if (task->getResult() != VK_SUCCESS)
+        {
+            result = task->getResult();
+        }
+    }
+
+    // Execute the chunks in order, and hand them over to the collector regardless of the result so
+    // they get freed.
+    for (VulkanSecondaryCommandBuffer &chunkCommandBuffer : mChunkCommandBuffers)
+    {
+        if (result == VK_SUCCESS)
+        {
+            chunkCommandBuffer.executeCommands(primary);
+        }
+        collector->collectCommandBuffer(std::move(chunkCommandBuffer));
+    }
+    mChunkCommandBuffers.clear();
+
+    ANGLE_VK_TRY(context, result);
+    return angle::Result::Continue;
+}
+}  // namespace vk
+}  // namespace rx
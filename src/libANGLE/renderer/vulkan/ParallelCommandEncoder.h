@@ -0,0 +1,76 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ParallelCommandEncoder:
+//    Encodes the commands of a render pass into Vulkan secondary command buffers on worker
+//    threads.
+//
+
+#ifndef LIBANGLE_RENDERER_VULKAN_PARALLELCOMMANDENCODER_H_
+#define LIBANGLE_RENDERER_VULKAN_PARALLELCOMMANDENCODER_H_
+
+#include "common/WorkerThread.h"
+#include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+#include "libANGLE/renderer/vulkan/SecondaryCommandPool.h"
+#include "libANGLE/renderer/vulkan/VulkanSecondaryCommandBuffer.h"
+
+namespace rx
+{
+namespace vk
+{
+class SecondaryCommandBufferCollector;
+
+// When the parallelRenderPassCommandEncoding feature is enabled, ContextVk periodically inserts
+// boundaries in the render pass's (ANGLE) secondary command buffer, after which all command buffer
+// state is re-emitted.  Each chunk of commands between two boundaries is thus self-contained.
+//
+// When the render pass is flushed, instead of replaying the commands inline in the primary command
+// buffer, the chunks are replayed in parallel into Vulkan secondary command buffers, which are
+// then executed in order in the primary command buffer.
+class ParallelCommandEncoder final : angle::NonCopyable
+{
+  public:
+    // The maximum number of tasks used to encode a render pass.  Each task uses its own command
+    // pool, as VkCommandPool must be externally synchronized.  If there are more chunks than tasks,
+    // every task encodes multiple chunks.
+    static constexpr size_t kMaxTaskCount = 8;
+
+    // The number of render pass write commands (i.e. draw calls and clears) after which ContextVk
+    // starts a new chunk.  This should be large enough to amortize the cost of re-emitting the
+    // command buffer state and of vkCmdExecuteCommands.
+    static constexpr uint32_t kWriteCommandsPerChunk = 128;
+
+    ParallelCommandEncoder();
+    ~ParallelCommandEncoder();
+
+    angle::Result init(Context *context,
+                       uint32_t queueFamilyIndex,
+                       ProtectionType protectionType,
+                       std::shared_ptr<angle::WorkerThreadPool> workerThreadPool);
+    void destroy(VkDevice device);
+
+    bool valid() const { return mWorkerThreadPool != nullptr; }
+
+    // Encode every chunk of |commands| and execute the resulting command buffers in |primary|.
+    // The render pass must have been begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS (or
+    // VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT with dynamic rendering).  The command
+    // buffers are handed over to |collector| to be freed once the submission is finished.
+    angle::Result encode(Context *context,
+                         priv::SecondaryCommandBuffer *commands,
+                         const VkCommandBufferInheritanceInfo &inheritanceInfo,
+                         PrimaryCommandBuffer *primary,
+                         SecondaryCommandBufferCollector *collector);
+
+  private:
+    std::shared_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
+    std::array<SecondaryCommandPool, kMaxTaskCount> mCommandPools;
+
+    // Scratch storage for the command buffers being encoded, one per chunk.
+    std::vector<VulkanSecondaryCommandBuffer> mChunkCommandBuffers;
+};
+}  // namespace vk
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_VULKAN_PARALLELCOMMANDENCODER_H_
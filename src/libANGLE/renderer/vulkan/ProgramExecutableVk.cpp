@@ -8,6 +8,7 @@
 
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 
+#include "common/hash_utils.h"
 #include "common/string_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
@@ -86,6 +87,31 @@ uint32_t GetInterfaceBlockArraySize(const std::vector<gl::InterfaceBlock> &block
     return arraySize;
 }
 
+SpvTransformOptions GetSpvTransformOptions(vk::Context *context,
+                                           gl::ShaderType shaderType,
+                                           bool isLastPreFragmentStage,
+                                           bool isTransformFeedbackProgram,
+                                           ProgramTransformOptions optionBits)
+{
+    SpvTransformOptions options;
+    options.shaderType               = shaderType;
+    options.isLastPreFragmentStage   = isLastPreFragmentStage;
+    options.isTransformFeedbackStage = isLastPreFragmentStage && isTransformFeedbackProgram &&
+                                       !optionBits.removeTransformFeedbackEmulation;
+    options.isTransformFeedbackEmulated = context->getFeatures().emulateTransformFeedback.enabled;
+    options.isMultisampledFramebufferFetch =
+        optionBits.multiSampleFramebufferFetch && shaderType == gl::ShaderType::Fragment;
+    options.enableSampleShading = optionBits.enableSampleShading;
+    options.removeDepthStencilInput =
+        optionBits.removeDepthStencilInput && shaderType == gl::ShaderType::Fragment;
+
+    options.useSpirvVaryingPrecisionFixer =
+        context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
+    options.removeDeadCode = context->getFeatures().removeDeadCodeInSpirv.enabled;
+
+    return options;
+}
+
 void SetupDefaultPipelineState(const vk::Context *context,
                                const gl::ProgramExecutable &glExecutable,
                                gl::PrimitiveMode mode,
@@ -236,6 +262,7 @@ vk::SpecializationConstants MakeSpecConsts(ProgramTransformOptions transformOpti
 
     specConsts.surfaceRotation = transformOptions.surfaceRotation;
     specConsts.dither          = desc.getEmulatedDitherControl();
+    specConsts.flip            = desc.getFlipUniform();
 
     return specConsts;
 }
@@ -358,6 +385,9 @@ class ProgramExecutableVk::WarmUpTaskCommon : public vk::Context, public LinkSub
 {
   public:
     WarmUpTaskCommon(vk::Renderer *renderer) : vk::Context(renderer) {}
+    WarmUpTaskCommon(vk::Renderer *renderer, ProgramExecutableVk *executableVk)
+        : vk::Context(renderer), mExecutableVk(executableVk)
+    {}
     WarmUpTaskCommon(vk::Renderer *renderer,
                      ProgramExecutableVk *executableVk,
                      vk::PipelineRobustness pipelineRobustness,
@@ -469,13 +499,13 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
                        vk::PipelineRobustness pipelineRobustness,
                        vk::PipelineProtectedAccess pipelineProtectedAccess,
                        vk::GraphicsPipelineSubset subset,
-                       const bool isSurfaceRotated,
+                       ProgramTransformOptions transformOptions,
                        const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
                        SharedRenderPass *compatibleRenderPass,
                        vk::PipelineHelper *placeholderPipelineHelper)
         : WarmUpTaskCommon(renderer, executableVk, pipelineRobustness, pipelineProtectedAccess),
           mPipelineSubset(subset),
-          mIsSurfaceRotated(isSurfaceRotated),
+          mTransformOptions(transformOptions),
           mGraphicsPipelineDesc(graphicsPipelineDesc),
           mWarmUpPipelineHelper(placeholderPipelineHelper),
           mCompatibleRenderPass(compatibleRenderPass)
@@ -488,7 +518,7 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
     void operator()() override
     {
         angle::Result result = mExecutableVk->warmUpGraphicsPipelineCache(
-            this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset, mIsSurfaceRotated,
+            this, mPipelineRobustness, mPipelineProtectedAccess, mPipelineSubset, mTransformOptions,
             mGraphicsPipelineDesc, mCompatibleRenderPass->get(), mWarmUpPipelineHelper);
         ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
 
@@ -510,7 +540,7 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
 
   private:
     vk::GraphicsPipelineSubset mPipelineSubset;
-    bool mIsSurfaceRotated;
+    ProgramTransformOptions mTransformOptions;
     vk::GraphicsPipelineDesc mGraphicsPipelineDesc;
     vk::PipelineHelper *mWarmUpPipelineHelper;
 
@@ -518,6 +548,34 @@ class ProgramExecutableVk::WarmUpGraphicsTask : public WarmUpTaskCommon
     SharedRenderPass *mCompatibleRenderPass;
 };
 
+// Transforms one shader stage for the permutations used by the warm up tasks.  The stages are
+// independent, so one task per stage is run in parallel with the others.
+class ProgramExecutableVk::WarmUpShaderTask : public WarmUpTaskCommon
+{
+  public:
+    WarmUpShaderTask(vk::Renderer *renderer,
+                     ProgramExecutableVk *executableVk,
+                     gl::ShaderType shaderType,
+                     angle::BitSet32<ProgramTransformOptions::kPermutationCount> permutations)
+        : WarmUpTaskCommon(renderer, executableVk),
+          mShaderType(shaderType),
+          mPermutations(permutations)
+    {}
+    ~WarmUpShaderTask() override = default;
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::WarmUpShaderTask");
+        angle::Result result =
+            mExecutableVk->initGraphicsShaderStagePrograms(this, mShaderType, mPermutations);
+        ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
+    }
+
+  private:
+    gl::ShaderType mShaderType;
+    angle::BitSet32<ProgramTransformOptions::kPermutationCount> mPermutations;
+};
+
 // ShaderInfo implementation.
 ShaderInfo::ShaderInfo() {}
 
@@ -598,10 +656,8 @@ ProgramInfo::~ProgramInfo() = default;
 
 angle::Result ProgramInfo::initProgram(vk::Context *context,
                                        gl::ShaderType shaderType,
-                                       bool isLastPreFragmentStage,
-                                       bool isTransformFeedbackProgram,
+                                       const SpvTransformOptions &options,
                                        const ShaderInfo &shaderInfo,
-                                       ProgramTransformOptions optionBits,
                                        const ShaderInterfaceVariableInfoMap &variableInfoMap)
 {
     const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
@@ -609,31 +665,26 @@ angle::Result ProgramInfo::initProgram(vk::Context *context,
     gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
     angle::spirv::Blob &transformedSpirvBlob = transformedSpirvBlobs[shaderType];
 
-    SpvTransformOptions options;
-    options.shaderType               = shaderType;
-    options.isLastPreFragmentStage   = isLastPreFragmentStage;
-    options.isTransformFeedbackStage = isLastPreFragmentStage && isTransformFeedbackProgram &&
-                                       !optionBits.removeTransformFeedbackEmulation;
-    options.isTransformFeedbackEmulated = context->getFeatures().emulateTransformFeedback.enabled;
-    options.isMultisampledFramebufferFetch =
-        optionBits.multiSampleFramebufferFetch && shaderType == gl::ShaderType::Fragment;
-    options.enableSampleShading = optionBits.enableSampleShading;
-    options.removeDepthStencilInput =
-        optionBits.removeDepthStencilInput && shaderType == gl::ShaderType::Fragment;
-
-    options.useSpirvVaryingPrecisionFixer =
-        context->getFeatures().varyingsRequireMatchingPrecisionInSpirv.enabled;
-
     ANGLE_TRY(
         SpvTransformSpirvCode(options, variableInfoMap, originalSpirvBlob, &transformedSpirvBlob));
     ANGLE_TRY(vk::InitShaderModule(context, &mShaders[shaderType], transformedSpirvBlob.data(),
                                    transformedSpirvBlob.size() * sizeof(uint32_t)));
 
+    mTransformOptions[shaderType] = options;
     mProgramHelper.setShader(shaderType, mShaders[shaderType]);
 
     return angle::Result::Continue;
 }
 
+void ProgramInfo::shareProgram(gl::ShaderType shaderType, const ProgramInfo &other)
+{
+    ASSERT(other.valid(shaderType));
+
+    mShaders[shaderType]          = other.mShaders[shaderType];
+    mTransformOptions[shaderType] = other.mTransformOptions[shaderType];
+    mProgramHelper.setShader(shaderType, mShaders[shaderType]);
+}
+
 void ProgramInfo::release(ContextVk *contextVk)
 {
     mProgramHelper.release(contextVk);
@@ -647,6 +698,7 @@ void ProgramInfo::release(ContextVk *contextVk)
 ProgramExecutableVk::ProgramExecutableVk(const gl::ProgramExecutable *executable)
     : ProgramExecutableImpl(executable),
       mImmutableSamplersMaxDescriptorCount(1),
+      mIsSamplerBakingDisabled(false),
       mUniformBufferDescriptorType(VK_DESCRIPTOR_TYPE_MAX_ENUM),
       mDynamicUniformDescriptorOffsets{},
       mValidGraphicsPermutations{},
@@ -726,6 +778,9 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
 {
     resetLayout(contextVk);
 
+    mBakedSamplerStates.clear();
+    mIsSamplerBakingDisabled = false;
+
     if (mPipelineCache.valid())
     {
         mPipelineCache.destroy(contextVk->getDevice());
@@ -760,8 +815,10 @@ angle::Result ProgramExecutableVk::initializePipelineCache(vk::Context *context,
 
     ANGLE_VK_TRY(context, mPipelineCache.init(context->getDevice(), pipelineCacheCreateInfo));
 
-    // Merge the pipeline cache into Renderer's.
-    if (context->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled)
+    // Merge the pipeline cache into Renderer's.  With shardPipelineCacheInBlobCache, the shard
+    // is selected by the pipeline layout, so the merge is deferred until the layout is created.
+    if (context->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled &&
+        !context->getFeatures().shardPipelineCacheInBlobCache.enabled)
     {
         ANGLE_TRY(context->getRenderer()->mergeIntoPipelineCache(context, mPipelineCache));
     }
@@ -823,6 +880,12 @@ angle::Result ProgramExecutableVk::load(ContextVk *contextVk,
     ANGLE_TRY(createPipelineLayout(contextVk, &contextVk->getPipelineLayoutCache(),
                                    &contextVk->getDescriptorSetLayoutCache(), nullptr));
 
+    if (mPipelineCache.valid() &&
+        contextVk->getFeatures().shardPipelineCacheInBlobCache.enabled)
+    {
+        ANGLE_TRY(mergePipelineCacheToRenderer(contextVk));
+    }
+
     ANGLE_TRY(initializeDescriptorPools(contextVk, &contextVk->getDescriptorSetLayoutCache(),
                                         &contextVk->getMetaDescriptorPools()));
 
@@ -881,8 +944,10 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
     vk::Renderer *renderer,
     vk::PipelineRobustness pipelineRobustness,
     vk::PipelineProtectedAccess pipelineProtectedAccess,
+    std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
     std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut)
 {
+    ASSERT(!linkSubTasksOut || linkSubTasksOut->empty());
     ASSERT(!postLinkSubTasksOut || postLinkSubTasksOut->empty());
 
     const vk::GraphicsPipelineSubset subset = GetWarmUpSubset(renderer->getFeatures());
@@ -908,6 +973,7 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
     else
     {
         ProgramTransformOptions transformOptions = {};
+        angle::BitSet32<ProgramTransformOptions::kPermutationCount> warmUpPermutations;
         SharedRenderPass *sharedRenderPass = new SharedRenderPass(std::move(compatibleRenderPass));
         for (bool surfaceRotation : surfaceRotationVariations)
         {
@@ -927,9 +993,36 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
                 pipelines.populate(mWarmUpGraphicsPipelineDesc, vk::Pipeline(), &pipelineHelper);
             }
 
+            warmUpPermutations.set(programIndex);
             warmUpSubTasks.push_back(std::make_shared<WarmUpGraphicsTask>(
                 renderer, this, pipelineRobustness, pipelineProtectedAccess, subset,
-                surfaceRotation, *graphicsPipelineDesc, sharedRenderPass, pipelineHelper));
+                transformOptions, *graphicsPipelineDesc, sharedRenderPass, pipelineHelper));
+        }
+
+        // Additionally precompile the pipelines this program was seen using in a previous run.
+        if (subset == vk::GraphicsPipelineSubset::Complete)
+        {
+            ANGLE_TRY(getPipelineCacheCorpusWarmUpTasks(&prepForWarmUpContext, pipelineRobustness,
+                                                        pipelineProtectedAccess, &warmUpSubTasks,
+                                                        &warmUpPermutations));
+        }
+
+        // Transform the shaders used by the warm up tasks.  This is done before the warm up tasks
+        // run, as they share the programs of each permutation.  If possible, each stage is
+        // transformed in a separate link subtask.
+        mValidGraphicsPermutations |= warmUpPermutations;
+        for (gl::ShaderType shaderType : mExecutable->getLinkedShaderStages())
+        {
+            if (linkSubTasksOut && postLinkSubTasksOut)
+            {
+                linkSubTasksOut->push_back(std::make_shared<WarmUpShaderTask>(
+                    renderer, this, shaderType, warmUpPermutations));
+            }
+            else
+            {
+                ANGLE_TRY(initGraphicsShaderStagePrograms(&prepForWarmUpContext, shaderType,
+                                                          warmUpPermutations));
+            }
         }
     }
 
@@ -952,6 +1045,97 @@ angle::Result ProgramExecutableVk::getPipelineCacheWarmUpTasks(
     return angle::Result::Continue;
 }
 
+angle::Result ProgramExecutableVk::getPipelineCacheCorpusWarmUpTasks(
+    vk::Context *context,
+    vk::PipelineRobustness pipelineRobustness,
+    vk::PipelineProtectedAccess pipelineProtectedAccess,
+    std::vector<std::shared_ptr<LinkSubTask>> *warmUpSubTasksOut,
+    angle::BitSet32<ProgramTransformOptions::kPermutationCount> *warmUpPermutationsOut)
+{
+    mWarmUpCorpusGraphicsPipelineDescs.clear();
+
+    vk::Renderer *renderer                 = context->getRenderer();
+    vk::GraphicsPipelineDescCorpus *corpus = renderer->getGraphicsPipelineDescCorpus();
+    const std::vector<vk::GraphicsPipelineDescCorpus::Entry> entries =
+        corpus->getEntries(getGraphicsPipelineDescCorpusKey());
+
+    for (const vk::GraphicsPipelineDescCorpus::Entry &entry : entries)
+    {
+        ProgramTransformOptions transformOptions = {};
+        transformOptions.permutationIndex        = entry.permutationIndex;
+        if (transformOptions.permutationIndex >= ProgramTransformOptions::kPermutationCount)
+        {
+            continue;
+        }
+
+        // Skip descs that are already cached, including the default warm up desc.
+        vk::PipelineHelper *pipelineHelper = nullptr;
+        mCompleteGraphicsPipelines[entry.permutationIndex].populate(entry.desc, vk::Pipeline(),
+                                                                    &pipelineHelper);
+        if (pipelineHelper == nullptr)
+        {
+            continue;
+        }
+
+        // The shaders are transformed by the caller and not in the task, as the tasks run in
+        // parallel.
+        warmUpPermutationsOut->set(transformOptions.permutationIndex);
+
+        // Each desc may have a different render pass, so every task gets its own.
+        vk::RenderPass compatibleRenderPass;
+        if (!context->getFeatures().preferDynamicRendering.enabled)
+        {
+            vk::AttachmentOpsArray ops;
+            RenderPassCache::InitializeOpsForCompatibleRenderPass(entry.desc.getRenderPassDesc(),
+                                                                  &ops);
+            ANGLE_TRY(RenderPassCache::MakeRenderPass(context, entry.desc.getRenderPassDesc(), ops,
+                                                      &compatibleRenderPass, nullptr));
+        }
+        SharedRenderPass *sharedRenderPass = new SharedRenderPass(std::move(compatibleRenderPass));
+
+        warmUpSubTasksOut->push_back(std::make_shared<WarmUpGraphicsTask>(
+            renderer, this, pipelineRobustness, pipelineProtectedAccess,
+            vk::GraphicsPipelineSubset::Complete, transformOptions, entry.desc, sharedRenderPass,
+            pipelineHelper));
+
+        mWarmUpCorpusGraphicsPipelineDescs.push_back(entry.desc);
+    }
+
+    return angle::Result::Continue;
+}
+
+uint64_t ProgramExecutableVk::getGraphicsPipelineDescCorpusKey()
+{
+    if (mGraphicsPipelineDescCorpusKey == 0)
+    {
+        // The key must be stable across runs, so it's derived from the SPIR-V of the program.
+        size_t key = 0;
+        for (gl::ShaderType shaderType : mExecutable->getLinkedShaderStages())
+        {
+            const angle::spirv::Blob &blob = mOriginalShaderInfo.getSpirvBlobs()[shaderType];
+            const size_t blobHash =
+                angle::ComputeGenericHash(blob.data(), blob.size() * sizeof(*blob.data()));
+            angle::HashCombine(key, static_cast<uint32_t>(shaderType), blobHash);
+        }
+        mGraphicsPipelineDescCorpusKey = key;
+    }
+    return mGraphicsPipelineDescCorpusKey;
+}
+
+void ProgramExecutableVk::recordGraphicsPipelineDesc(ContextVk *contextVk,
+                                                     ProgramTransformOptions transformOptions,
+                                                     const vk::GraphicsPipelineDesc &desc)
+{
+    vk::Renderer *renderer = contextVk->getRenderer();
+    if (!renderer->isGraphicsPipelineDescRecordingEnabled())
+    {
+        return;
+    }
+
+    renderer->getGraphicsPipelineDescCorpus()->record(getGraphicsPipelineDescCorpusKey(),
+                                                      transformOptions.permutationIndex, desc);
+}
+
 angle::Result ProgramExecutableVk::prepareForWarmUpPipelineCache(
     vk::Context *context,
     vk::PipelineRobustness pipelineRobustness,
@@ -1023,14 +1207,6 @@ angle::Result ProgramExecutableVk::prepareForWarmUpPipelineCache(
         surfaceRotationVariationsOut->push_back(true);
     }
 
-    ProgramTransformOptions transformOptions = {};
-    for (bool rotation : *surfaceRotationVariationsOut)
-    {
-        // Initialize graphics programs.
-        transformOptions.surfaceRotation = rotation;
-        ANGLE_TRY(initGraphicsShaderPrograms(context, transformOptions));
-    }
-
     return angle::Result::Continue;
 }
 
@@ -1066,7 +1242,7 @@ angle::Result ProgramExecutableVk::warmUpGraphicsPipelineCache(
     vk::PipelineRobustness pipelineRobustness,
     vk::PipelineProtectedAccess pipelineProtectedAccess,
     vk::GraphicsPipelineSubset subset,
-    const bool isSurfaceRotated,
+    ProgramTransformOptions transformOptions,
     const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
     const vk::RenderPass &renderPass,
     vk::PipelineHelper *placeholderPipelineHelper)
@@ -1079,9 +1255,7 @@ angle::Result ProgramExecutableVk::warmUpGraphicsPipelineCache(
     vk::PipelineCacheAccess pipelineCache;
     pipelineCache.init(&mPipelineCache, nullptr);
 
-    const vk::GraphicsPipelineDesc *descPtr  = nullptr;
-    ProgramTransformOptions transformOptions = {};
-    transformOptions.surfaceRotation         = isSurfaceRotated;
+    const vk::GraphicsPipelineDesc *descPtr = nullptr;
 
     ANGLE_TRY(createGraphicsPipelineImpl(context, transformOptions, subset, &pipelineCache,
                                          PipelineSource::WarmUp, graphicsPipelineDesc, renderPass,
@@ -1093,6 +1267,8 @@ angle::Result ProgramExecutableVk::warmUpGraphicsPipelineCache(
 
 void ProgramExecutableVk::waitForPostLinkTasksImpl(ContextVk *contextVk)
 {
+    mExecutable->schedulePostLinkTasks();
+
     const std::vector<std::shared_ptr<rx::LinkSubTask>> &postLinkSubTasks =
         mExecutable->getPostLinkSubTasks();
 
@@ -1131,6 +1307,8 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
 {
     ASSERT(mExecutable->hasLinkedShaderStage(gl::ShaderType::Vertex));
 
+    mExecutable->schedulePostLinkTasks();
+
     if (mExecutable->getPostLinkSubTasks().empty())
     {
         return;
@@ -1138,7 +1316,16 @@ void ProgramExecutableVk::waitForGraphicsPostLinkTasks(
 
     const vk::GraphicsPipelineSubset subset = GetWarmUpSubset(contextVk->getFeatures());
 
-    if (!mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset))
+    bool usesWarmUpDesc =
+        mWarmUpGraphicsPipelineDesc.keyEqual(currentGraphicsPipelineDesc, subset);
+    for (const vk::GraphicsPipelineDesc &corpusDesc : mWarmUpCorpusGraphicsPipelineDescs)
+    {
+        usesWarmUpDesc =
+            usesWarmUpDesc ||
+            corpusDesc.keyEqual(currentGraphicsPipelineDesc, vk::GraphicsPipelineSubset::Complete);
+    }
+
+    if (!usesWarmUpDesc)
     {
         // The GraphicsPipelineDesc used for warmup differs from the one used by the draw call.
         // There is no need to wait for the warmup tasks to complete.
@@ -1162,7 +1349,8 @@ angle::Result ProgramExecutableVk::mergePipelineCacheToRenderer(vk::Context *con
     if (context->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled)
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::mergePipelineCacheToRenderer");
-        ANGLE_TRY(context->getRenderer()->mergeIntoPipelineCache(context, mPipelineCache));
+        ANGLE_TRY(context->getRenderer()->mergeIntoPipelineCache(context, mPipelineCacheShardKey,
+                                                                 mPipelineCache));
     }
 
     return angle::Result::Continue;
@@ -1400,13 +1588,97 @@ angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
             const VkDescriptorType descType = samplerBinding.textureType == gl::TextureType::Buffer
                                                   ? VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER
                                                   : VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-            descOut->addBinding(info.binding, descType, arraySize, activeStages, nullptr);
+
+            const vk::Sampler *bakedSampler = nullptr;
+            if (activeTextures != nullptr && samplerIndex < mBakedSamplerStates.size() &&
+                mBakedSamplerStates[samplerIndex].sampler)
+            {
+                ASSERT(arraySize == 1 && descType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
+                bakedSampler = &mBakedSamplerStates[samplerIndex].sampler->get();
+            }
+            descOut->addBinding(info.binding, descType, arraySize, activeStages, bakedSampler);
         }
     }
 
     return angle::Result::Continue;
 }
 
+void ProgramExecutableVk::updateBakedSamplers(const gl::ActiveTextureArray<TextureVk *> &textures,
+                                              const gl::SamplerBindingVector &samplers,
+                                              bool *recreatePipelineLayoutOut)
+{
+    // The number of texture updates with the same sampler after which it's baked.  Baking changes
+    // the pipeline layout, so the pipelines are recreated once.
+    constexpr uint32_t kUnchangedCountBeforeBaking = 64;
+
+    if (mIsSamplerBakingDisabled)
+    {
+        return;
+    }
+
+    const std::vector<gl::SamplerBinding> &samplerBindings = mExecutable->getSamplerBindings();
+    const std::vector<gl::LinkedUniform> &uniforms         = mExecutable->getUniforms();
+    mBakedSamplerStates.resize(samplerBindings.size());
+
+    for (uint32_t samplerIndex = 0; samplerIndex < samplerBindings.size(); ++samplerIndex)
+    {
+        const gl::SamplerBinding &samplerBinding = samplerBindings[samplerIndex];
+        const gl::LinkedUniform &samplerUniform =
+            uniforms[mExecutable->getUniformIndexFromSamplerIndex(samplerIndex)];
+        BakedSamplerState &state = mBakedSamplerStates[samplerIndex];
+
+        // Only single samplers are baked, and not the ones that need a Ycbcr conversion, which
+        // are already immutable.
+        const GLuint textureUnit =
+            samplerBinding.getTextureUnit(mExecutable->getSamplerBoundTextureUnits(), 0);
+        const TextureVk *textureVk = textures[textureUnit];
+        const bool canBake =
+            samplerBinding.textureUnitsCount == 1 && samplerUniform.activeShaders().any() &&
+            samplerUniform.getOuterArraySizeProduct() == 1 &&
+            samplerBinding.textureType != gl::TextureType::Buffer &&
+            samplerBinding.samplerType != GL_SAMPLER_EXTERNAL_2D_Y2Y_EXT && textureVk != nullptr &&
+            !textureVk->getImage().hasImmutableSampler();
+
+        const gl::Sampler *sampler = canBake ? samplers[textureUnit].get() : nullptr;
+        const vk::SharedSamplerPtr *currentSampler =
+            !canBake  ? nullptr
+            : sampler ? &vk::GetImpl(sampler)->getSharedSampler()
+                      : &textureVk->getSharedSampler();
+
+        if (state.sampler)
+        {
+            if (currentSampler == nullptr ||
+                (*currentSampler)->getSamplerSerial() != state.sampler->getSamplerSerial())
+            {
+                // The sampler state is not static after all, so don't try again.
+                mBakedSamplerStates.clear();
+                mIsSamplerBakingDisabled   = true;
+                *recreatePipelineLayoutOut = true;
+                return;
+            }
+            continue;
+        }
+
+        if (currentSampler == nullptr)
+        {
+            state.unchangedCount = 0;
+            continue;
+        }
+
+        const vk::SamplerSerial serial = (*currentSampler)->getSamplerSerial();
+        if (serial != state.serial)
+        {
+            state.serial         = serial;
+            state.unchangedCount = 0;
+        }
+        else if (++state.unchangedCount == kUnchangedCountBeforeBaking)
+        {
+            state.sampler              = *currentSampler;
+            *recreatePipelineLayoutOut = true;
+        }
+    }
+}
+
 void ProgramExecutableVk::initializeWriteDescriptorDesc(vk::Context *context)
 {
     const gl::ShaderBitSet &linkedShaderStages = mExecutable->getLinkedShaderStages();
@@ -1480,6 +1752,39 @@ ProgramTransformOptions ProgramExecutableVk::getTransformOptions(
     return transformOptions;
 }
 
+angle::Result ProgramExecutableVk::initProgramImpl(
+    vk::Context *context,
+    gl::ShaderType shaderType,
+    bool isLastPreFragmentStage,
+    bool isTransformFeedbackProgram,
+    ProgramTransformOptions optionBits,
+    ProgramInfo *programInfo,
+    const ShaderInterfaceVariableInfoMap &variableInfoMap)
+{
+    const SpvTransformOptions options = GetSpvTransformOptions(
+        context, shaderType, isLastPreFragmentStage, isTransformFeedbackProgram, optionBits);
+
+    // Most permutation bits only affect one stage (and surfaceRotation none), so the other stages
+    // of a new permutation can typically reuse the shader module of an existing one.  Only this
+    // stage of the other permutations is accessed, as stages may be initialized in parallel.
+    if (shaderType != gl::ShaderType::Compute)
+    {
+        for (size_t programIndex : mValidGraphicsPermutations)
+        {
+            const ProgramInfo &otherProgramInfo = mGraphicsProgramInfos[programIndex];
+            if (&otherProgramInfo != programInfo && otherProgramInfo.valid(shaderType) &&
+                otherProgramInfo.getTransformOptions(shaderType) == options)
+            {
+                programInfo->shareProgram(shaderType, otherProgramInfo);
+                return angle::Result::Continue;
+            }
+        }
+    }
+
+    return programInfo->initProgram(context, shaderType, options, mOriginalShaderInfo,
+                                    variableInfoMap);
+}
+
 angle::Result ProgramExecutableVk::initGraphicsShaderPrograms(
     vk::Context *context,
     ProgramTransformOptions transformOptions)
@@ -1504,6 +1809,31 @@ angle::Result ProgramExecutableVk::initGraphicsShaderPrograms(
     return angle::Result::Continue;
 }
 
+angle::Result ProgramExecutableVk::initGraphicsShaderStagePrograms(
+    vk::Context *context,
+    gl::ShaderType shaderType,
+    angle::BitSet32<ProgramTransformOptions::kPermutationCount> permutations)
+{
+    const gl::ShaderBitSet linkedShaderStages = mExecutable->getLinkedShaderStages();
+    const bool isLastPreFragmentStage =
+        shaderType == gl::GetLastPreFragmentStage(linkedShaderStages);
+    const bool isTransformFeedbackProgram =
+        !mExecutable->getLinkedTransformFeedbackVaryings().empty();
+
+    for (size_t programIndex : permutations)
+    {
+        ASSERT(mValidGraphicsPermutations.test(programIndex));
+
+        ProgramTransformOptions transformOptions = {};
+        transformOptions.permutationIndex        = static_cast<uint8_t>(programIndex);
+        ANGLE_TRY(initProgram(context, shaderType, isLastPreFragmentStage,
+                              isTransformFeedbackProgram, transformOptions,
+                              &mGraphicsProgramInfos[programIndex], mVariableInfoMap));
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ProgramExecutableVk::initProgramThenCreateGraphicsPipeline(
     vk::Context *context,
     ProgramTransformOptions transformOptions,
@@ -1633,15 +1963,56 @@ angle::Result ProgramExecutableVk::createGraphicsPipeline(
         contextVk, transformOptions, pipelineSubset, pipelineCache, source, desc,
         *compatibleRenderPass, descPtrOut, pipelineOut));
 
+    if (pipelineSubset == vk::GraphicsPipelineSubset::Complete)
+    {
+        recordGraphicsPipelineDesc(contextVk, transformOptions, desc);
+    }
+
     if (useProgramPipelineCache &&
         contextVk->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled)
     {
-        ANGLE_TRY(contextVk->getRenderer()->mergeIntoPipelineCache(contextVk, mPipelineCache));
+        ANGLE_TRY(contextVk->getRenderer()->mergeIntoPipelineCache(
+            contextVk, mPipelineCacheShardKey, mPipelineCache));
     }
 
     return angle::Result::Continue;
 }
 
+angle::Result ProgramExecutableVk::createGraphicsPipelineAsync(
+    ContextVk *contextVk,
+    vk::PipelineCacheAccess *pipelineCache,
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
+    ProgramTransformOptions transformOptions = getTransformOptions(contextVk, desc);
+    const uint8_t programIndex               = transformOptions.permutationIndex;
+
+    ANGLE_TRY(initGraphicsShaderPrograms(contextVk, transformOptions));
+
+    // Add a placeholder to the cache, and attach a task that creates the actual pipeline.  The
+    // task is scheduled when the pipeline is first used.
+    mCompleteGraphicsPipelines[programIndex].addPendingPipeline(desc, descPtrOut, pipelineOut);
+
+    vk::SpecializationConstants specConsts = MakeSpecConsts(transformOptions, desc);
+    mGraphicsProgramInfos[programIndex].getShaderProgram().createMonolithicPipelineCreationTask(
+        contextVk, pipelineCache, desc, getPipelineLayout(), specConsts, *pipelineOut);
+
+    recordGraphicsPipelineDesc(contextVk, transformOptions, desc);
+
+    return angle::Result::Continue;
+}
+
+vk::PipelineHelper *ProgramExecutableVk::getCompatibleGraphicsPipeline(
+    ContextVk *contextVk,
+    const vk::GraphicsPipelineDesc &desc)
+{
+    ProgramTransformOptions transformOptions = getTransformOptions(contextVk, desc);
+    const uint8_t programIndex               = transformOptions.permutationIndex;
+
+    return mCompleteGraphicsPipelines[programIndex].getCompatiblePipeline(desc);
+}
+
 angle::Result ProgramExecutableVk::linkGraphicsPipelineLibraries(
     ContextVk *contextVk,
     vk::PipelineCacheAccess *pipelineCache,
@@ -1808,6 +2179,7 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
 
     ANGLE_TRY(pipelineLayoutCache->getPipelineLayout(context, pipelineLayoutDesc,
                                                      mDescriptorSetLayouts, &mPipelineLayout));
+    mPipelineCacheShardKey = pipelineLayoutDesc.hash();
 
     mDynamicUniformDescriptorOffsets.clear();
     mDynamicUniformDescriptorOffsets.resize(mExecutable->getLinkedShaderStageCount(), 0);
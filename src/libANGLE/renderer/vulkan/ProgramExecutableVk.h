@@ -78,11 +78,11 @@ class ProgramInfo final : angle::NonCopyable
 
     angle::Result initProgram(vk::Context *context,
                               gl::ShaderType shaderType,
-                              bool isLastPreFragmentStage,
-                              bool isTransformFeedbackProgram,
+                              const SpvTransformOptions &options,
                               const ShaderInfo &shaderInfo,
-                              ProgramTransformOptions optionBits,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap);
+    // Uses the shader module of another permutation, which was transformed with the same options.
+    void shareProgram(gl::ShaderType shaderType, const ProgramInfo &other);
     void release(ContextVk *contextVk);
 
     ANGLE_INLINE bool valid(gl::ShaderType shaderType) const
@@ -92,9 +92,15 @@ class ProgramInfo final : angle::NonCopyable
 
     vk::ShaderProgramHelper &getShaderProgram() { return mProgramHelper; }
 
+    const SpvTransformOptions &getTransformOptions(gl::ShaderType shaderType) const
+    {
+        return mTransformOptions[shaderType];
+    }
+
   private:
     vk::ShaderProgramHelper mProgramHelper;
     vk::ShaderModuleMap mShaders;
+    gl::ShaderMap<SpvTransformOptions> mTransformOptions;
 };
 
 using ImmutableSamplerIndexMap = angle::HashMap<vk::YcbcrConversionDesc, uint32_t>;
@@ -188,6 +194,17 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                          const vk::GraphicsPipelineDesc **descPtrOut,
                                          vk::PipelineHelper **pipelineOut);
 
+    // Add a complete pipeline to the cache whose creation is done asynchronously.  The resulting
+    // pipeline helper cannot be bound until |PipelineHelper::isCreationPending()| returns false.
+    angle::Result createGraphicsPipelineAsync(ContextVk *contextVk,
+                                              vk::PipelineCacheAccess *pipelineCache,
+                                              const vk::GraphicsPipelineDesc &desc,
+                                              const vk::GraphicsPipelineDesc **descPtrOut,
+                                              vk::PipelineHelper **pipelineOut);
+    // Find an already created complete pipeline that can be bound instead of the one for |desc|.
+    vk::PipelineHelper *getCompatibleGraphicsPipeline(ContextVk *contextVk,
+                                                      const vk::GraphicsPipelineDesc &desc);
+
     angle::Result linkGraphicsPipelineLibraries(ContextVk *contextVk,
                                                 vk::PipelineCacheAccess *pipelineCache,
                                                 const vk::GraphicsPipelineDesc &desc,
@@ -205,6 +222,8 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                              vk::PipelineHelper **pipelineOut);
 
     const vk::PipelineLayout &getPipelineLayout() const { return *mPipelineLayout; }
+    // Selects the Renderer's pipeline cache used for this executable's pipelines.
+    size_t getPipelineCacheShardKey() const { return mPipelineCacheShardKey; }
     void resetLayout(ContextVk *contextVk);
     angle::Result createPipelineLayout(vk::Context *context,
                                        PipelineLayoutCache *pipelineLayoutCache,
@@ -268,6 +287,14 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         return (mImmutableSamplerIndexMap == immutableSamplerIndexMap);
     }
 
+    // With bakeStaticImmutableSamplers, samplers that are bound with the same state for a while
+    // are made immutable samplers of the texture descriptor set layout.  Sets
+    // |recreatePipelineLayoutOut| if the layout needs to change, which is also the case if a baked
+    // sampler is no longer the one in use.
+    void updateBakedSamplers(const gl::ActiveTextureArray<TextureVk *> &textures,
+                             const gl::SamplerBindingVector &samplers,
+                             bool *recreatePipelineLayoutOut);
+
     size_t getDefaultUniformAlignedSize(vk::Context *context, gl::ShaderType shaderType) const
     {
         vk::Renderer *renderer = context->getRenderer();
@@ -320,12 +347,15 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                       vk::PipelineProtectedAccess pipelineProtectedAccess)
     {
         return getPipelineCacheWarmUpTasks(renderer, pipelineRobustness, pipelineProtectedAccess,
-                                           nullptr);
+                                           nullptr, nullptr);
     }
+    // If provided, the shaders needed by the warm up are transformed by one task per stage in
+    // linkSubTasksOut, which must then be finished before the tasks in postLinkSubTasksOut run.
     angle::Result getPipelineCacheWarmUpTasks(
         vk::Renderer *renderer,
         vk::PipelineRobustness pipelineRobustness,
         vk::PipelineProtectedAccess pipelineProtectedAccess,
+        std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
         std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
 
     void waitForPostLinkTasks(const gl::Context *context) override
@@ -383,6 +413,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     class WarmUpTaskCommon;
     class WarmUpComputeTask;
     class WarmUpGraphicsTask;
+    class WarmUpShaderTask;
 
     friend class ProgramVk;
     friend class ProgramPipelineVk;
@@ -421,15 +452,23 @@ class ProgramExecutableVk : public ProgramExecutableImpl
         // specialization constants.
         if (!programInfo->valid(shaderType))
         {
-            ANGLE_TRY(programInfo->initProgram(context, shaderType, isLastPreFragmentStage,
-                                               isTransformFeedbackProgram, mOriginalShaderInfo,
-                                               optionBits, variableInfoMap));
+            ANGLE_TRY(initProgramImpl(context, shaderType, isLastPreFragmentStage,
+                                      isTransformFeedbackProgram, optionBits, programInfo,
+                                      variableInfoMap));
         }
         ASSERT(programInfo->valid(shaderType));
 
         return angle::Result::Continue;
     }
 
+    angle::Result initProgramImpl(vk::Context *context,
+                                  gl::ShaderType shaderType,
+                                  bool isLastPreFragmentStage,
+                                  bool isTransformFeedbackProgram,
+                                  ProgramTransformOptions optionBits,
+                                  ProgramInfo *programInfo,
+                                  const ShaderInterfaceVariableInfoMap &variableInfoMap);
+
     ANGLE_INLINE angle::Result initGraphicsShaderProgram(
         vk::Context *context,
         gl::ShaderType shaderType,
@@ -460,6 +499,12 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                                 const vk::GraphicsPipelineDesc &desc);
     angle::Result initGraphicsShaderPrograms(vk::Context *context,
                                              ProgramTransformOptions transformOptions);
+    // Initializes a single stage for a number of permutations.  Different stages can be
+    // initialized in parallel; the caller is responsible for marking the permutations as valid.
+    angle::Result initGraphicsShaderStagePrograms(
+        vk::Context *context,
+        gl::ShaderType shaderType,
+        angle::BitSet32<ProgramTransformOptions::kPermutationCount> permutations);
     angle::Result initProgramThenCreateGraphicsPipeline(vk::Context *context,
                                                         ProgramTransformOptions transformOptions,
                                                         vk::GraphicsPipelineSubset pipelineSubset,
@@ -478,6 +523,16 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                              const vk::RenderPass &compatibleRenderPass,
                                              const vk::GraphicsPipelineDesc **descPtrOut,
                                              vk::PipelineHelper **pipelineOut);
+    angle::Result getPipelineCacheCorpusWarmUpTasks(
+        vk::Context *context,
+        vk::PipelineRobustness pipelineRobustness,
+        vk::PipelineProtectedAccess pipelineProtectedAccess,
+        std::vector<std::shared_ptr<LinkSubTask>> *warmUpSubTasksOut,
+        angle::BitSet32<ProgramTransformOptions::kPermutationCount> *warmUpPermutationsOut);
+    uint64_t getGraphicsPipelineDescCorpusKey();
+    void recordGraphicsPipelineDesc(ContextVk *contextVk,
+                                    ProgramTransformOptions transformOptions,
+                                    const vk::GraphicsPipelineDesc &desc);
     angle::Result prepareForWarmUpPipelineCache(
         vk::Context *context,
         vk::PipelineRobustness pipelineRobustness,
@@ -494,7 +549,7 @@ class ProgramExecutableVk : public ProgramExecutableImpl
                                               vk::PipelineRobustness pipelineRobustness,
                                               vk::PipelineProtectedAccess pipelineProtectedAccess,
                                               vk::GraphicsPipelineSubset subset,
-                                              const bool isSurfaceRotated,
+                                              ProgramTransformOptions transformOptions,
                                               const vk::GraphicsPipelineDesc &graphicsPipelineDesc,
                                               const vk::RenderPass &renderPass,
                                               vk::PipelineHelper *placeholderPipelineHelper);
@@ -526,6 +581,17 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     // deleted while this program is in use.
     uint32_t mImmutableSamplersMaxDescriptorCount;
     ImmutableSamplerIndexMap mImmutableSamplerIndexMap;
+
+    // Per sampler binding, how many times the same sampler was found in use, and the sampler
+    // once it's baked into the layout.  Baking stops for good once a baked sampler changes.
+    struct BakedSamplerState
+    {
+        vk::SamplerSerial serial;
+        uint32_t unchangedCount = 0;
+        vk::SharedSamplerPtr sampler;
+    };
+    std::vector<BakedSamplerState> mBakedSamplerStates;
+    bool mIsSamplerBakingDisabled;
     vk::PipelineLayoutPtr mPipelineLayout;
     vk::DescriptorSetLayoutPointerArray mDescriptorSetLayouts;
 
@@ -579,8 +645,14 @@ class ProgramExecutableVk : public ProgramExecutableImpl
     // With VK_EXT_graphics_pipeline_library, this cache is used for the "shaders" subset of the
     // pipeline.
     vk::PipelineCache mPipelineCache;
+    // Hash of the pipeline layout, used to select the shard of the Renderer's pipeline cache.
+    size_t mPipelineCacheShardKey = 0;
 
     vk::GraphicsPipelineDesc mWarmUpGraphicsPipelineDesc;
+    // Descs from the renderer's GraphicsPipelineDescCorpus that are being warmed up, and the key
+    // the program is identified with in the corpus (lazily computed, 0 if not yet known).
+    std::vector<vk::GraphicsPipelineDesc> mWarmUpCorpusGraphicsPipelineDescs;
+    uint64_t mGraphicsPipelineDescCorpusKey = 0;
 
     // The "layout" information for descriptorSets
     vk::WriteDescriptorDescs mShaderResourceWriteDescriptorDescs;
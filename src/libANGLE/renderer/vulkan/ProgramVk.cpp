@@ -77,10 +77,13 @@ class LinkTaskVk final : public vk::Context, public LinkTask
         ASSERT(linkSubTasksOut && linkSubTasksOut->empty());
         ASSERT(postLinkSubTasksOut && postLinkSubTasksOut->empty());
 
-        // In the Vulkan backend, the only subtasks are pipeline warm up, which is not required for
+        // In the Vulkan backend, the subtasks are pipeline warm up, which is not required for
         // link.  Running as a post-link task, the expensive warm up is run in a thread without
-        // holding up the link results.
-        angle::Result result = linkImpl(resources, mergedVaryings, postLinkSubTasksOut);
+        // holding up the link results.  The shaders of each stage needed for the warm up are
+        // transformed in parallel as link subtasks, which the front-end runs before the post-link
+        // tasks.
+        angle::Result result =
+            linkImpl(resources, mergedVaryings, linkSubTasksOut, postLinkSubTasksOut);
         ASSERT((result == angle::Result::Continue) == (mErrorCode == VK_SUCCESS));
     }
 
@@ -145,6 +148,7 @@ class LinkTaskVk final : public vk::Context, public LinkTask
   private:
     angle::Result linkImpl(const gl::ProgramLinkedResources &resources,
                            const gl::ProgramMergedVaryings &mergedVaryings,
+                           std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
                            std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut);
 
     void linkResources(const gl::ProgramLinkedResources &resources);
@@ -174,6 +178,7 @@ class LinkTaskVk final : public vk::Context, public LinkTask
 
 angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
                                    const gl::ProgramMergedVaryings &mergedVaryings,
+                                   std::vector<std::shared_ptr<LinkSubTask>> *linkSubTasksOut,
                                    std::vector<std::shared_ptr<LinkSubTask>> *postLinkSubTasksOut)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "LinkTaskVk::linkImpl");
@@ -218,8 +223,9 @@ angle::Result LinkTaskVk::linkImpl(const gl::ProgramLinkedResources &resources,
     // - Individual GLES1 tests are long, and this adds a considerable overhead to those tests
     if (!mState.isSeparable() && !mIsGLES1 && getFeatures().warmUpPipelineCacheAtLink.enabled)
     {
-        ANGLE_TRY(executableVk->getPipelineCacheWarmUpTasks(
-            mRenderer, mPipelineRobustness, mPipelineProtectedAccess, postLinkSubTasksOut));
+        ANGLE_TRY(executableVk->getPipelineCacheWarmUpTasks(mRenderer, mPipelineRobustness,
+                                                            mPipelineProtectedAccess,
+                                                            linkSubTasksOut, postLinkSubTasksOut));
     }
 
     return angle::Result::Continue;
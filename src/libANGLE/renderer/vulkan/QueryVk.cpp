@@ -21,6 +21,12 @@ namespace rx
 
 namespace
 {
+// The number of times the availability of a query result can be polled before the commands
+// writing it are flushed.  Polling is expected to happen until the result is available, so this
+// still guarantees that it eventually becomes available, but gives the application's own flush
+// (typically at swap) a chance to submit the query first.
+constexpr uint32_t kResultAvailablePollsBeforeFlush = 32;
+
 struct QueryReleaseHelper
 {
     void operator()(vk::QueryHelper &&query) { queryPool->freeQuery(contextVk, &query); }
@@ -108,7 +114,8 @@ QueryVk::QueryVk(gl::QueryType type)
     : QueryImpl(type),
       mTransformFeedbackPrimitivesDrawn(0),
       mCachedResult(0),
-      mCachedResultValid(false)
+      mCachedResultValid(false),
+      mUnsubmittedResultAvailablePollCount(0)
 {}
 
 QueryVk::~QueryVk() = default;
@@ -310,7 +317,8 @@ angle::Result QueryVk::begin(const gl::Context *context)
             RenderPassClosureReason::FramebufferBindingChange));
     }
 
-    mCachedResultValid = false;
+    mCachedResultValid                   = false;
+    mUnsubmittedResultAvailablePollCount = 0;
 
     // Transform feedback query is handled by a CPU-calculated value when emulated.
     if (IsEmulatedTransformFeedbackQuery(contextVk, mType))
@@ -429,7 +437,8 @@ angle::Result QueryVk::queryCounter(const gl::Context *context)
     ASSERT(mType == gl::QueryType::Timestamp);
     ContextVk *contextVk = vk::GetImpl(context);
 
-    mCachedResultValid = false;
+    mCachedResultValid                   = false;
+    mUnsubmittedResultAvailablePollCount = 0;
 
     if (!mQueryHelper.isReferenced())
     {
@@ -490,8 +499,16 @@ angle::Result QueryVk::getResult(const gl::Context *context, bool wait)
     // Note regarding time-elapsed: end should have been called after begin, so flushing when end
     // has pending work should flush begin too.
     // We only need to check mQueryHelper, not mStashedQueryHelper, since they are always in order.
+    //
+    // When only polling for availability, the flush is delayed for a number of polls.  Apps issuing
+    // many queries per frame typically poll them all once and rely on swap to submit them.
     if (contextVk->hasUnsubmittedUse(mQueryHelper.get()))
     {
+        if (!wait && ++mUnsubmittedResultAvailablePollCount < kResultAvailablePollsBeforeFlush)
+        {
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(contextVk->flushAndSubmitCommands(nullptr, nullptr,
                                                     RenderPassClosureReason::GetQueryResult));
 
@@ -79,6 +79,9 @@ class QueryVk : public QueryImpl
 
     uint64_t mCachedResult;
     bool mCachedResultValid;
+
+    // Number of times the result availability was polled while the query had not been submitted.
+    uint32_t mUnsubmittedResultAvailablePollCount;
 };
 
 }  // namespace rx
@@ -21,12 +21,19 @@ namespace rx
 namespace
 {
 angle::SubjectIndex kRenderbufferImageSubjectIndex = 0;
+
+// The number of times in a row a multisampled renderbuffer is resolved in a subpass and then
+// invalidated before it's made transient.
+constexpr uint32_t kResolveAndInvalidateCountBeforeTransient = 3;
 }  // namespace
 
 RenderbufferVk::RenderbufferVk(const gl::RenderbufferState &state)
     : RenderbufferImpl(state),
       mOwnsImage(false),
       mImage(nullptr),
+      mIsTransient(false),
+      mResolvedWithSubpass(false),
+      mResolveAndInvalidateCount(0),
       mImageObserverBinding(this, kRenderbufferImageSubjectIndex)
 {}
 
@@ -45,10 +52,8 @@ angle::Result RenderbufferVk::setStorageImpl(const gl::Context *context,
                                              GLsizei height,
                                              gl::MultisamplingMode mode)
 {
-    ContextVk *contextVk            = vk::GetImpl(context);
-    vk::Renderer *renderer          = contextVk->getRenderer();
-    const vk::Format &format        = renderer->getFormat(internalformat);
-    angle::FormatID textureFormatID = format.getActualRenderableImageFormatID();
+    ContextVk *contextVk   = vk::GetImpl(context);
+    vk::Renderer *renderer = contextVk->getRenderer();
 
     if (!mOwnsImage)
     {
@@ -80,6 +85,20 @@ angle::Result RenderbufferVk::setStorageImpl(const gl::Context *context,
         mImageViews.init(renderer);
     }
 
+    return initImage(contextVk, samples, internalformat, width, height, mode);
+}
+
+angle::Result RenderbufferVk::initImage(ContextVk *contextVk,
+                                        GLsizei samples,
+                                        GLenum internalformat,
+                                        GLsizei width,
+                                        GLsizei height,
+                                        gl::MultisamplingMode mode)
+{
+    vk::Renderer *renderer          = contextVk->getRenderer();
+    const vk::Format &format        = renderer->getFormat(internalformat);
+    angle::FormatID textureFormatID = format.getActualRenderableImageFormatID();
+
     const angle::Format &textureFormat = format.getActualRenderableImageFormat();
     const bool isDepthStencilFormat    = textureFormat.hasDepthOrStencilBits();
     ASSERT(textureFormat.redBits > 0 || isDepthStencilFormat);
@@ -110,6 +129,14 @@ angle::Result RenderbufferVk::setStorageImpl(const gl::Context *context,
         usage |= VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
     }
 
+    // A transient image can only be used as an attachment, see ensureNotTransient().
+    if (mIsTransient)
+    {
+        ASSERT(!isDepthStencilFormat && !isRenderToTexture);
+        usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT |
+                VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT;
+    }
+
     VkImageCreateFlags createFlags = vk::kVkImageCreateFlagsNone;
     if (isRenderToTexture &&
         renderer->getFeatures().supportsMultisampledRenderToSingleSampled.enabled)
@@ -130,9 +157,16 @@ angle::Result RenderbufferVk::setStorageImpl(const gl::Context *context,
     ANGLE_TRY(mImage->initExternal(
         contextVk, gl::TextureType::_2D, extents, format.getIntendedFormatID(), textureFormatID,
         imageSamples, usage, createFlags, vk::ImageLayout::Undefined, nullptr, gl::LevelIndex(0), 1,
-        1, robustInit, false, vk::YcbcrConversionDesc{}, nullptr));
+        1, robustInit, false, vk::YcbcrConversionDesc{}, nullptr, nullptr));
 
     VkMemoryPropertyFlags flags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT;
+    if (mIsTransient)
+    {
+        // The image is only made transient right after its contents are invalidated, so there is
+        // nothing to initialize.
+        mImage->removeStagedUpdates(contextVk, gl::LevelIndex(0), gl::LevelIndex(0));
+        flags |= VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+    }
     ANGLE_TRY(contextVk->initImageAllocation(mImage, false, renderer->getMemoryProperties(), flags,
                                              vk::MemoryAllocationType::RenderBufferStorageImage));
 
@@ -301,9 +335,77 @@ angle::Result RenderbufferVk::initializeContents(const gl::Context *context,
                                                  GLenum binding,
                                                  const gl::ImageIndex &imageIndex)
 {
+    ContextVk *contextVk = vk::GetImpl(context);
+    ANGLE_TRY(ensureNotTransient(contextVk));
+
     // Note: stageSubresourceRobustClear only uses the intended format to count channels.
     mImage->stageRobustResourceClear(imageIndex);
-    return mImage->flushAllStagedUpdates(vk::GetImpl(context));
+    return mImage->flushAllStagedUpdates(contextVk);
+}
+
+angle::Result RenderbufferVk::onEntireContentInvalidated(ContextVk *contextVk)
+{
+    if (!contextVk->getFeatures().preferTransientMultisampledRenderbuffers.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    mResolveAndInvalidateCount = mResolvedWithSubpass ? mResolveAndInvalidateCount + 1 : 0;
+    mResolvedWithSubpass       = false;
+
+    if (mIsTransient || mResolveAndInvalidateCount < kResolveAndInvalidateCountBeforeTransient ||
+        !canBeTransient(contextVk))
+    {
+        return angle::Result::Continue;
+    }
+
+    // The contents are undefined, so the image can be recreated without copying anything.  The
+    // render pass that drew to it (if still open) already discards it.
+    return reinitImage(contextVk, true);
+}
+
+angle::Result RenderbufferVk::ensureNotTransient(ContextVk *contextVk)
+{
+    mResolveAndInvalidateCount = 0;
+    if (!mIsTransient)
+    {
+        return angle::Result::Continue;
+    }
+
+    // A transient image can't be copied from, so its contents can't be preserved.  They are
+    // normally undefined at this point, unless the application stopped invalidating them.
+    if (mImage->hasSubresourceDefinedContent(gl::LevelIndex(0), 0, 1))
+    {
+        ANGLE_VK_PERF_WARNING(contextVk, GL_DEBUG_SEVERITY_HIGH,
+                              "Contents of a transient multisampled renderbuffer are lost as it "
+                              "is used outside a render pass");
+    }
+
+    return reinitImage(contextVk, false);
+}
+
+bool RenderbufferVk::canBeTransient(ContextVk *contextVk) const
+{
+    return mOwnsImage && mImage != nullptr && mImage->valid() && mState.getSamples() > 1 &&
+           mState.getMultisamplingMode() == gl::MultisamplingMode::Regular &&
+           mImage->getAspectFlags() == VK_IMAGE_ASPECT_COLOR_BIT &&
+           !mImage->hasEmulatedImageChannels() &&
+           contextVk->getRenderer()->getMemoryProperties().hasLazilyAllocatedMemory();
+}
+
+angle::Result RenderbufferVk::reinitImage(ContextVk *contextVk, bool isTransient)
+{
+    ASSERT(mOwnsImage && mImage != nullptr);
+
+    releaseImage(contextVk);
+    mIsTransient = isTransient;
+
+    ANGLE_TRY(initImage(contextVk, mState.getSamples(), mState.getFormat().info->internalFormat,
+                        mState.getWidth(), mState.getHeight(), mState.getMultisamplingMode()));
+
+    // Let the framebuffers this renderbuffer is attached to pick up the new image.
+    onStateChange(angle::SubjectMessage::SubjectChanged);
+    return angle::Result::Continue;
 }
 
 void RenderbufferVk::releaseOwnershipOfImage(const gl::Context *context)
@@ -357,6 +459,10 @@ void RenderbufferVk::releaseImage(ContextVk *contextVk)
     {
         mMultisampledImage.releaseImageFromShareContexts(renderer, contextVk, mImageSiblingSerial);
     }
+
+    mIsTransient               = false;
+    mResolvedWithSubpass       = false;
+    mResolveAndInvalidateCount = 0;
 }
 
 const gl::InternalFormat &RenderbufferVk::getImplementationSizedFormat() const
@@ -391,6 +497,7 @@ angle::Result RenderbufferVk::getRenderbufferImage(const gl::Context *context,
     }
 
     ContextVk *contextVk = vk::GetImpl(context);
+    ANGLE_TRY(ensureNotTransient(contextVk));
     ANGLE_TRY(mImage->flushAllStagedUpdates(contextVk));
 
     gl::MaybeOverrideLuminance(format, type, getColorReadFormat(context),
@@ -402,10 +509,13 @@ angle::Result RenderbufferVk::getRenderbufferImage(const gl::Context *context,
 
 angle::Result RenderbufferVk::ensureImageInitialized(const gl::Context *context)
 {
+    ContextVk *contextVk = vk::GetImpl(context);
     ANGLE_TRY(setStorageImpl(context, mState.getSamples(), mState.getFormat().info->internalFormat,
                              mState.getWidth(), mState.getHeight(), mState.getMultisamplingMode()));
 
-    return mImage->flushAllStagedUpdates(vk::GetImpl(context));
+    // The image is used outside a render pass by the callers.
+    ANGLE_TRY(ensureNotTransient(contextVk));
+    return mImage->flushAllStagedUpdates(contextVk);
 }
 
 void RenderbufferVk::onSubjectStateChange(angle::SubjectIndex index, angle::SubjectMessage message)
@@ -90,6 +90,15 @@ class RenderbufferVk : public RenderbufferImpl, public angle::ObserverInterface
 
     angle::Result ensureImageInitialized(const gl::Context *context);
 
+    // With preferTransientMultisampledRenderbuffers, a multisampled renderbuffer that is
+    // repeatedly resolved in a subpass (by glBlitFramebuffer) and then invalidated is made
+    // transient, i.e. backed by lazily allocated memory.  It's given regular memory again as soon
+    // as it's used other than as an attachment.
+    void onColorResolveWithSubpass() { mResolvedWithSubpass = true; }
+    bool isTransient() const { return mIsTransient; }
+    angle::Result onEntireContentInvalidated(ContextVk *contextVk);
+    angle::Result ensureNotTransient(ContextVk *contextVk);
+
   private:
     void releaseAndDeleteImage(ContextVk *contextVk);
     void releaseImage(ContextVk *contextVk);
@@ -100,6 +109,14 @@ class RenderbufferVk : public RenderbufferImpl, public angle::ObserverInterface
                                  GLsizei width,
                                  GLsizei height,
                                  gl::MultisamplingMode mode);
+    angle::Result initImage(ContextVk *contextVk,
+                            GLsizei samples,
+                            GLenum internalformat,
+                            GLsizei width,
+                            GLsizei height,
+                            gl::MultisamplingMode mode);
+    angle::Result reinitImage(ContextVk *contextVk, bool isTransient);
+    bool canBeTransient(ContextVk *contextVk) const;
 
     const gl::InternalFormat &getImplementationSizedFormat() const;
 
@@ -117,6 +134,13 @@ class RenderbufferVk : public RenderbufferImpl, public angle::ObserverInterface
     vk::ImageHelper *mImage;
     vk::ImageViewHelper mImageViews;
 
+    // Whether |mImage| is transient.  |mResolvedWithSubpass| says whether the image was resolved in
+    // a subpass since its contents were last invalidated, and |mResolveAndInvalidateCount| how many
+    // times in a row that happened.
+    bool mIsTransient;
+    bool mResolvedWithSubpass;
+    uint32_t mResolveAndInvalidateCount;
+
     // If renderbuffer is created through the EXT_multisampled_render_to_texture API, it is expected
     // that all rendering is done multisampled during the renderpass, and is automatically resolved
     // (into |mImage|) and discarded afterwards.  |mMultisampledImage| is the implicit image that
@@ -32,6 +32,11 @@ class SamplerVk : public SamplerImpl
         ASSERT(mSampler->valid());
         return *mSampler.get();
     }
+    const vk::SharedSamplerPtr &getSharedSampler() const
+    {
+        ASSERT(mSampler);
+        return mSampler;
+    }
 
   private:
     vk::SharedSamplerPtr mSampler;
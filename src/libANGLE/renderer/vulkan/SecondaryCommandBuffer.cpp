@@ -106,6 +106,8 @@ const char *GetCommandString(CommandID id)
             return "MemoryBarrier";
         case CommandID::NextSubpass:
             return "NextSubpass";
+        case CommandID::ParallelEncodeBoundary:
+            return "ParallelEncodeBoundary";
         case CommandID::PipelineBarrier:
             return "PipelineBarrier";
         case CommandID::PushConstants:
@@ -118,6 +120,8 @@ const char *GetCommandString(CommandID id)
             return "ResolveImage";
         case CommandID::SetBlendConstants:
             return "SetBlendConstants";
+        case CommandID::SetColorBlendEquation:
+            return "SetColorBlendEquation";
         case CommandID::SetCullMode:
             return "SetCullMode";
         case CommandID::SetDepthBias:
@@ -198,18 +202,49 @@ ANGLE_INLINE const CommandHeader *NextCommand(const CommandHeader *command)
 // Parse the cmds in this cmd buffer into given primary cmd buffer
 void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
 {
-    VkCommandBuffer cmdBuffer = primary->getHandle();
-
     ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeCommands");
 
     // Used for ring buffer allocators only.
     mCommandAllocator.terminateLastCommandBlock();
 
-    for (const CommandHeader *command : mCommands)
+    executeCommandRange(primary->getHandle(), {0, nullptr}, {0, nullptr});
+}
+
+void SecondaryCommandBuffer::executeParallelEncodeChunk(VkCommandBuffer cmdBuffer,
+                                                        size_t chunkIndex) const
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeParallelEncodeChunk");
+    ASSERT(chunkIndex < getParallelEncodeChunkCount());
+
+    const CommandPosition begin =
+        chunkIndex == 0 ? CommandPosition{0, nullptr} : mParallelEncodeBoundaries[chunkIndex - 1];
+    const CommandPosition end = chunkIndex < mParallelEncodeBoundaries.size()
+                                    ? mParallelEncodeBoundaries[chunkIndex]
+                                    : CommandPosition{0, nullptr};
+
+    executeCommandRange(cmdBuffer, begin, end);
+}
+
+void SecondaryCommandBuffer::executeCommandRange(VkCommandBuffer cmdBuffer,
+                                                 const CommandPosition &begin,
+                                                 const CommandPosition &end) const
+{
+    for (size_t blockIndex = begin.blockIndex; blockIndex < mCommands.size(); ++blockIndex)
     {
+        const CommandHeader *command = mCommands[blockIndex];
+        if (blockIndex == begin.blockIndex && begin.command != nullptr)
+        {
+            command = begin.command;
+        }
+
         for (const CommandHeader *currentCommand                      = command;
              currentCommand->id != CommandID::Invalid; currentCommand = NextCommand(currentCommand))
         {
+            if (currentCommand == end.command)
+            {
+                return;
+            }
+
             switch (currentCommand->id)
             {
                 case CommandID::BeginDebugUtilsLabel:
@@ -611,6 +646,10 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                     vkCmdNextSubpass(cmdBuffer, VK_SUBPASS_CONTENTS_INLINE);
                     break;
                 }
+                case CommandID::ParallelEncodeBoundary:
+                {
+                    break;
+                }
                 case CommandID::PipelineBarrier:
                 {
                     const PipelineBarrierParams *params =
@@ -687,6 +726,16 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
                     vkCmdSetBlendConstants(cmdBuffer, params->blendConstants);
                     break;
                 }
+                case CommandID::SetColorBlendEquation:
+                {
+                    const SetColorBlendEquationParams *params =
+                        getParamPtr<SetColorBlendEquationParams>(currentCommand);
+                    const VkColorBlendEquationEXT *colorBlendEquations =
+                        GetFirstArrayParameter<VkColorBlendEquationEXT>(params);
+                    vkCmdSetColorBlendEquationEXT(cmdBuffer, params->firstAttachment,
+                                                  params->attachmentCount, colorBlendEquations);
+                    break;
+                }
                 case CommandID::SetCullMode:
                 {
                     const SetCullModeParams *params =
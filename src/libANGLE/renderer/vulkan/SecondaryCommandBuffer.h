@@ -94,6 +94,7 @@ enum class CommandID : uint16_t
     MemoryBarrier,
     MemoryBarrier2,
     NextSubpass,
+    ParallelEncodeBoundary,
     PipelineBarrier,
     PipelineBarrier2,
     PushConstants,
@@ -101,6 +102,7 @@ enum class CommandID : uint16_t
     ResetQueryPool,
     ResolveImage,
     SetBlendConstants,
+    SetColorBlendEquation,
     SetCullMode,
     SetDepthBias,
     SetDepthBiasEnable,
@@ -598,6 +600,15 @@ struct SetBlendConstantsParams
 };
 VERIFY_8_BYTE_ALIGNMENT(SetBlendConstantsParams)
 
+struct SetColorBlendEquationParams
+{
+    CommandHeader header;
+
+    uint16_t firstAttachment;
+    uint16_t attachmentCount;
+};
+VERIFY_8_BYTE_ALIGNMENT(SetColorBlendEquationParams)
+
 struct SetCullModeParams
 {
     CommandHeader header;
@@ -1052,6 +1063,9 @@ class SecondaryCommandBuffer final : angle::NonCopyable
                       const VkImageResolve *regions);
 
     void setBlendConstants(const float blendConstants[4]);
+    void setColorBlendEquation(uint32_t firstAttachment,
+                               uint32_t attachmentCount,
+                               const VkColorBlendEquationEXT *colorBlendEquations);
     void setCullMode(VkCullModeFlags cullMode);
     void setDepthBias(float depthBiasConstantFactor,
                       float depthBiasClamp,
@@ -1109,6 +1123,19 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     // Parse the cmds in this cmd buffer into given primary cmd buffer for execution
     void executeCommands(PrimaryCommandBuffer *primary);
 
+    // Mark the point at which the commands may be split to be encoded in parallel.  The commands
+    // that follow the boundary must not depend on any state set by the commands that precede it.
+    // The boundary is a no-op when the commands are executed with executeCommands().
+    void insertParallelEncodeBoundary();
+    size_t getParallelEncodeChunkCount() const { return mParallelEncodeBoundaries.size() + 1; }
+    void clearParallelEncodeBoundaries() { mParallelEncodeBoundaries.clear(); }
+
+    // Parse the cmds of a single chunk (as delimited by the parallel encode boundaries) into the
+    // given Vulkan command buffer.  Different chunks may be executed concurrently, but only after
+    // prepareParallelExecute() is called.
+    void prepareParallelExecute() { mCommandAllocator.terminateLastCommandBlock(); }
+    void executeParallelEncodeChunk(VkCommandBuffer cmdBuffer, size_t chunkIndex) const;
+
     // Calculate memory usage of this command buffer for diagnostics.
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
     void getMemoryUsageStatsForPoolAlloc(size_t blockSize,
@@ -1149,6 +1176,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     void reset()
     {
         mCommands.clear();
+        mParallelEncodeBoundaries.clear();
         mCommandAllocator.reset(&mCommandTracker);
     }
 
@@ -1174,6 +1202,20 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     }
 
   private:
+    // A position in the command stream, identified by the command block it belongs to and the
+    // command itself.
+    struct CommandPosition
+    {
+        size_t blockIndex;
+        const CommandHeader *command;
+    };
+
+    // Execute the commands in [begin, end).  If |end.command| is nullptr, the commands are executed
+    // until the end of the command stream.
+    void executeCommandRange(VkCommandBuffer cmdBuffer,
+                             const CommandPosition &begin,
+                             const CommandPosition &end) const;
+
     void commonDebugUtilsLabel(CommandID cmd, const VkDebugUtilsLabelEXT &label);
     template <class StructType>
     ANGLE_INLINE StructType *commonInit(CommandID cmdID,
@@ -1267,6 +1309,9 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     std::vector<CommandHeader *> mCommands;
 
+    // Positions of the ParallelEncodeBoundary commands, if any.
+    std::vector<CommandPosition> mParallelEncodeBoundaries;
+
     // Allocator used by this class. If non-null then the class is valid.
     SecondaryCommandBlockPool mCommandAllocator;
 
@@ -1881,6 +1926,14 @@ ANGLE_INLINE void SecondaryCommandBuffer::nextSubpass(VkSubpassContents subpassC
     initCommand<EmptyParams>(CommandID::NextSubpass);
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::insertParallelEncodeBoundary()
+{
+    const EmptyParams *paramStruct = initCommand<EmptyParams>(CommandID::ParallelEncodeBoundary);
+    // The command was just allocated, so it necessarily belongs to the last command block.
+    ASSERT(!mCommands.empty());
+    mParallelEncodeBoundaries.push_back({mCommands.size() - 1, &paramStruct->header});
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::pipelineBarrier(
     VkPipelineStageFlags srcStageMask,
     VkPipelineStageFlags dstStageMask,
@@ -2023,6 +2076,24 @@ ANGLE_INLINE void SecondaryCommandBuffer::setBlendConstants(const float blendCon
     }
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::setColorBlendEquation(
+    uint32_t firstAttachment,
+    uint32_t attachmentCount,
+    const VkColorBlendEquationEXT *colorBlendEquations)
+{
+    uint8_t *writePtr;
+    const ArrayParamSize equationSize =
+        calculateArrayParameterSize<VkColorBlendEquationEXT>(attachmentCount);
+
+    SetColorBlendEquationParams *paramStruct = initCommand<SetColorBlendEquationParams>(
+        CommandID::SetColorBlendEquation, equationSize.allocateBytes, &writePtr);
+
+    SetBitField(paramStruct->firstAttachment, firstAttachment);
+    SetBitField(paramStruct->attachmentCount, attachmentCount);
+
+    storeArrayParameter(writePtr, colorBlendEquations, equationSize);
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::setCullMode(VkCullModeFlags cullMode)
 {
     SetCullModeParams *paramStruct = initCommand<SetCullModeParams>(CommandID::SetCullMode);
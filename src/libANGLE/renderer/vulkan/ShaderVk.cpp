@@ -84,6 +84,11 @@ std::shared_ptr<ShaderTranslateTask> ShaderVk::compile(const gl::Context *contex
     if (!contextVk->getFeatures().preferDriverUniformOverSpecConst.enabled)
     {
         options->useSpecializationConstant = true;
+
+        if (contextVk->getFeatures().bakeFlipInSpecConst.enabled)
+        {
+            options->useSpecializationConstantForFlip = true;
+        }
     }
 
     if (contextVk->getFeatures().clampFragDepth.enabled)
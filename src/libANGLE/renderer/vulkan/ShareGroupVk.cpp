@@ -66,6 +66,7 @@ ShareGroupVk::ShareGroupVk(const egl::ShareGroupState &state, vk::Renderer *rend
       mCurrentFrameCount(0),
       mContextsPriority(egl::ContextPriority::InvalidEnum),
       mIsContextsPriorityLocked(false),
+      mHasWarmedUpInterfacePipelines(false),
       mLastMonolithicPipelineJobTime(0)
 {
     mLastPruneTime = angle::GetCurrentSystemTime();
@@ -161,6 +162,10 @@ void ShareGroupVk::onDestroy(const egl::Display *display)
     DisplayVk *displayVk   = vk::GetImpl(display);
 
     mRefCountedEventsGarbageRecycler.destroy(mRenderer);
+    mImageRecycler.releaseAll(mRenderer);
+
+    mSuballocatedBuffers.clear();
+    mBuffersToRelocate.clear();
 
     for (std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
     {
@@ -197,11 +202,74 @@ void ShareGroupVk::onTextureRelease(TextureVk *textureVk)
     mTextureUpload.onTextureRelease(textureVk);
 }
 
+void ShareGroupVk::onBufferRelease(BufferVk *bufferVk)
+{
+    mSuballocatedBuffers.erase(bufferVk);
+    mBuffersToRelocate.erase(
+        std::remove(mBuffersToRelocate.begin(), mBuffersToRelocate.end(), bufferVk),
+        mBuffersToRelocate.end());
+}
+
+void ShareGroupVk::collectBuffersToRelocate()
+{
+    ASSERT(mBuffersToRelocate.empty());
+
+    bool anyBlockEvacuating = false;
+    for (std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
+    {
+        if (pool && pool->selectBlockForEvacuation())
+        {
+            anyBlockEvacuating = true;
+        }
+    }
+
+    if (!anyBlockEvacuating)
+    {
+        return;
+    }
+
+    for (BufferVk *bufferVk : mSuballocatedBuffers)
+    {
+        if (bufferVk->isInEvacuatingBufferBlock())
+        {
+            mBuffersToRelocate.push_back(bufferVk);
+        }
+    }
+}
+
+angle::Result ShareGroupVk::relocateBuffersFromEvacuatingBlocks(ContextVk *contextVk)
+{
+    // Maximum time spent relocating buffers per frame, in seconds.
+    constexpr double kBufferRelocationTimeBudget = 0.0005;
+
+    if (mBuffersToRelocate.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    const double deadline = angle::GetCurrentSystemTime() + kBufferRelocationTimeBudget;
+    while (!mBuffersToRelocate.empty() && angle::GetCurrentSystemTime() < deadline)
+    {
+        BufferVk *bufferVk = mBuffersToRelocate.back();
+        mBuffersToRelocate.pop_back();
+
+        // Buffers that are in use or mapped are skipped.  They will be found again at the next
+        // prune if their block is still being evacuated.
+        if (bufferVk->canRelocate(mRenderer))
+        {
+            ANGLE_TRY(bufferVk->relocate(contextVk));
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ShareGroupVk::scheduleMonolithicPipelineCreationTask(
     ContextVk *contextVk,
     vk::WaitableMonolithicPipelineCreationTask *taskOut)
 {
-    ASSERT(contextVk->getFeatures().preferMonolithicPipelinesOverLibraries.enabled);
+    ASSERT(contextVk->getFeatures().preferMonolithicPipelinesOverLibraries.enabled ||
+           contextVk->getFeatures().asyncGraphicsPipelineCreationOnCacheMiss.enabled);
 
     // Limit to a single task to avoid hogging all the cores.
     if (mMonolithicPipelineCreationEvent && !mMonolithicPipelineCreationEvent->isReady())
@@ -341,6 +409,26 @@ void ShareGroupVk::pruneDefaultBufferPools()
     }
 
     mRenderer->onBufferPoolPrune();
+}
+
+void ShareGroupVk::releaseEmptyDefaultBufferPoolBlocks()
+{
+    mLastPruneTime = angle::GetCurrentSystemTime();
+
+    for (std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
+    {
+        if (pool)
+        {
+            pool->releaseEmptyBuffers(mRenderer);
+        }
+    }
+
+    mRenderer->onBufferPoolPrune();
+
+    if (mRenderer->getFeatures().defragmentBufferPools.enabled && mBuffersToRelocate.empty())
+    {
+        collectBuffersToRelocate();
+    }
 
 #if ANGLE_ENABLE_BUFFER_POOL_STATS_LOGGING
     logBufferPools();
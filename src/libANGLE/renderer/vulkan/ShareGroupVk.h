@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_SHAREGROUPVK_H_
 #define LIBANGLE_RENDERER_VULKAN_SHAREGROUPVK_H_
 
+#include <unordered_set>
+
 #include "libANGLE/renderer/ShareGroupImpl.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -18,6 +20,8 @@
 
 namespace rx
 {
+class BufferVk;
+
 constexpr VkDeviceSize kMaxTotalEmptyBufferBytes = 16 * 1024 * 1024;
 
 class TextureUpload
@@ -65,6 +69,15 @@ class ShareGroupVk : public ShareGroupImpl
                                          BufferUsageType usageType);
 
     void pruneDefaultBufferPools();
+    // Destroys all the empty BufferBlocks of the default buffer pools, under memory pressure.
+    void releaseEmptyDefaultBufferPoolBlocks();
+
+    // Track the buffers suballocated from the default buffer pools, so the ones in a BufferBlock
+    // that is being evacuated can be found.  With defragmentBufferPools, those buffers are
+    // relocated at frame boundaries, within a time budget.
+    void onBufferAllocate(BufferVk *bufferVk) { mSuballocatedBuffers.insert(bufferVk); }
+    void onBufferRelease(BufferVk *bufferVk);
+    angle::Result relocateBuffersFromEvacuatingBlocks(ContextVk *contextVk);
 
     void calculateTotalBufferCount(size_t *bufferCount, VkDeviceSize *totalSize) const;
     void logBufferPools() const;
@@ -80,6 +93,7 @@ class ShareGroupVk : public ShareGroupImpl
     }
 
     void onTextureRelease(TextureVk *textureVk);
+    vk::ImageRecycler *getImageRecycler() { return &mImageRecycler; }
 
     VertexInputGraphicsPipelineCache *getVertexInputGraphicsPipelineCache()
     {
@@ -89,6 +103,10 @@ class ShareGroupVk : public ShareGroupImpl
     {
         return &mFragmentOutputGraphicsPipelineCache;
     }
+    // Whether the vertex input and fragment output libraries of the renderer's
+    // GraphicsPipelineDescCorpus have been created in this share group.
+    bool hasWarmedUpInterfacePipelines() const { return mHasWarmedUpInterfacePipelines; }
+    void onInterfacePipelinesWarmedUp() { mHasWarmedUpInterfacePipelines = true; }
 
     angle::Result scheduleMonolithicPipelineCreationTask(
         ContextVk *contextVk,
@@ -117,6 +135,7 @@ class ShareGroupVk : public ShareGroupImpl
     angle::Result updateContextsPriority(ContextVk *contextVk, egl::ContextPriority newPriority);
 
     bool isDueForBufferPoolPrune();
+    void collectBuffersToRelocate();
 
     vk::Renderer *mRenderer;
 
@@ -150,12 +169,17 @@ class ShareGroupVk : public ShareGroupImpl
     // The system time when last pruneEmptyBuffer gets called.
     double mLastPruneTime;
 
+    std::unordered_set<BufferVk *> mSuballocatedBuffers;
+    // Buffers found in evacuating BufferBlocks at the last prune that are not yet relocated.
+    std::vector<BufferVk *> mBuffersToRelocate;
+
     // Used when VK_EXT_graphics_pipeline_library is available, the vertex input and fragment output
     // partial pipelines are created in the following caches.  These caches are in the share group
     // because linked pipelines using these pipeline libraries are referenced from
     // ProgramExecutableVk, and as such must stay alive as long as the program may be alive.
     VertexInputGraphicsPipelineCache mVertexInputGraphicsPipelineCache;
     FragmentOutputGraphicsPipelineCache mFragmentOutputGraphicsPipelineCache;
+    bool mHasWarmedUpInterfacePipelines;
 
     // The system time when the last monolithic pipeline creation job was launched.  This is
     // rate-limited to avoid hogging all cores and interfering with the application threads.  A
@@ -168,6 +192,9 @@ class ShareGroupVk : public ShareGroupImpl
 
     // Holds RefCountedEvent that are free and ready to reuse
     vk::RefCountedEventsGarbageRecycler mRefCountedEventsGarbageRecycler;
+
+    // Holds the images of released textures, for reuse by textures of the same description.
+    vk::ImageRecycler mImageRecycler;
 };
 }  // namespace rx
 
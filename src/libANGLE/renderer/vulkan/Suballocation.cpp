@@ -25,7 +25,8 @@ BufferBlock::BufferBlock()
       mAllocatedBufferSize(0),
       mMemoryAllocationType(MemoryAllocationType::InvalidEnum),
       mMemoryTypeIndex(kInvalidMemoryTypeIndex),
-      mMappedMemory(nullptr)
+      mMappedMemory(nullptr),
+      mIsEvacuating(false)
 {}
 
 BufferBlock::BufferBlock(BufferBlock &&other)
@@ -39,7 +40,8 @@ BufferBlock::BufferBlock(BufferBlock &&other)
       mMemoryTypeIndex(other.mMemoryTypeIndex),
       mMappedMemory(other.mMappedMemory),
       mSerial(other.mSerial),
-      mCountRemainsEmpty(0)
+      mCountRemainsEmpty(0),
+      mIsEvacuating(other.mIsEvacuating)
 {}
 
 BufferBlock &BufferBlock::operator=(BufferBlock &&other)
@@ -55,6 +57,7 @@ BufferBlock &BufferBlock::operator=(BufferBlock &&other)
     std::swap(mMappedMemory, other.mMappedMemory);
     std::swap(mSerial, other.mSerial);
     std::swap(mCountRemainsEmpty, other.mCountRemainsEmpty);
+    std::swap(mIsEvacuating, other.mIsEvacuating);
     return *this;
 }
 
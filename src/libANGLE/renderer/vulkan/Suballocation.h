@@ -83,6 +83,11 @@ class BufferBlock final : angle::NonCopyable
     int32_t getAndIncrementEmptyCounter();
     void calculateStats(vma::StatInfo *pStatInfo) const;
 
+    // A block that is being evacuated is skipped by BufferPool::allocateBuffer, while the buffers
+    // suballocated from it are relocated to other blocks.  Once empty, the block can be freed.
+    void setEvacuating(bool evacuating) { mIsEvacuating = evacuating; }
+    bool isEvacuating() const { return mIsEvacuating; }
+
     void onNewDescriptorSet(const SharedDescriptorSetCacheKey &sharedCacheKey)
     {
         mDescriptorSetCacheManager.addKey(sharedCacheKey);
@@ -118,6 +123,7 @@ class BufferBlock final : angle::NonCopyable
     // buffer block is found to be empty when pruneEmptyBuffer is called. This gets reset whenever
     // it becomes non-empty.
     int32_t mCountRemainsEmpty;
+    bool mIsEvacuating;
     // Manages the descriptorSet cache that created with this BufferBlock.
     DescriptorSetCacheManager mDescriptorSetCacheManager;
 };
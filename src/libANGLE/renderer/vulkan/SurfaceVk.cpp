@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Overlay.h"
@@ -110,7 +111,8 @@ vk::PresentMode GetDesiredPresentMode(const std::vector<vk::PresentMode> &presen
 
 uint32_t GetMinImageCount(vk::Renderer *renderer,
                           const VkSurfaceCapabilitiesKHR &surfaceCaps,
-                          vk::PresentMode presentMode)
+                          vk::PresentMode presentMode,
+                          int32_t fifoImageCountAdjustment)
 {
     // - On mailbox, we need at least three images; one is being displayed to the user until the
     //   next v-sync, and the application alternatingly renders to the other two, one being
@@ -123,12 +125,20 @@ uint32_t GetMinImageCount(vk::Renderer *renderer,
 
     // For simplicity, we always allocate at least three images, unless double buffer FIFO is
     // specifically preferred.
-    const uint32_t imageCount =
+    uint32_t imageCount =
         renderer->getFeatures().preferDoubleBufferSwapchainOnFifoMode.enabled &&
                 presentMode == vk::PresentMode::FifoKHR
             ? 0x2u
             : 0x3u;
 
+    // With adaptSwapchainImageCount, FIFO swapchains may get one image more or less depending on
+    // how the application keeps up with the display.
+    if (presentMode == vk::PresentMode::FifoKHR || presentMode == vk::PresentMode::FifoRelaxedKHR)
+    {
+        imageCount = static_cast<uint32_t>(
+            std::max(2, static_cast<int32_t>(imageCount) + fifoImageCountAdjustment));
+    }
+
     uint32_t minImageCount = std::max(imageCount, surfaceCaps.minImageCount);
     // Make sure we don't exceed maxImageCount.
     if (surfaceCaps.maxImageCount > 0 && minImageCount > surfaceCaps.maxImageCount)
@@ -213,7 +223,7 @@ angle::Result InitImageHelper(DisplayVk *displayVk,
         displayVk, gl::TextureType::_2D, extents, vkFormat.getIntendedFormatID(),
         renderableFormatId, samples, usage, imageCreateFlags, vk::ImageLayout::Undefined, nullptr,
         gl::LevelIndex(0), 1, 1, isRobustResourceInitEnabled, hasProtectedContent,
-        vk::YcbcrConversionDesc{}, nullptr));
+        vk::YcbcrConversionDesc{}, nullptr, nullptr));
 
     return angle::Result::Continue;
 }
@@ -972,6 +982,7 @@ WindowSurfaceVk::WindowSurfaceVk(const egl::SurfaceState &surfaceState, EGLNativ
       mEmulatedPreTransform(VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR),
       mCompositeAlpha(VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR),
       mSurfaceColorSpace(VK_COLOR_SPACE_SRGB_NONLINEAR_KHR),
+      mMaxFrameLatency(surfaceState.attributes.getAsInt(EGL_MAX_FRAME_LATENCY_ANGLE, 0)),
       mCurrentSwapchainImageIndex(0),
       mDepthStencilImageBinding(this, kAnySurfaceImageSubjectIndex),
       mColorImageMSBinding(this, kAnySurfaceImageSubjectIndex),
@@ -1588,6 +1599,10 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context, const gl::E
     ASSERT(mAcquireOperation.state != impl::ImageAcquireState::Ready);
     ASSERT(mSwapchain == VK_NULL_HANDLE);
 
+    // The presents of the previous swapchain can't be waited on with the new one.
+    mPresentPacing.pendingPresentIds.clear();
+    mPresentPacing.imageCountChanged = false;
+
     vk::Renderer *renderer = context->getRenderer();
     VkDevice device        = renderer->getDevice();
 
@@ -1730,7 +1745,8 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context, const gl::E
         // mode imageCount here. Otherwise we may get into
         // VUID-VkSwapchainCreateInfoKHR-presentMode-02839.
         mSurfaceCaps   = surfaceCaps2.surfaceCapabilities;
-        mMinImageCount = GetMinImageCount(renderer, mSurfaceCaps, mDesiredSwapchainPresentMode);
+        mMinImageCount = GetMinImageCount(renderer, mSurfaceCaps, mDesiredSwapchainPresentMode,
+                                          mPresentPacing.imageCountAdjustment);
         swapchainInfo.minImageCount = mMinImageCount;
     }
 
@@ -1940,6 +1956,12 @@ angle::Result WindowSurfaceVk::checkForOutOfDateSwapchain(ContextVk *contextVk,
     bool swapchainMissing = (mSwapchain == VK_NULL_HANDLE);
     bool needRecreate     = forceRecreate || presentModeIncompatible || swapchainMissing;
 
+    // adaptSwapchainImageCount has changed the image count.
+    if (mPresentPacing.imageCountChanged)
+    {
+        needRecreate = true;
+    }
+
     // If there's no change, early out.
     if (!contextVk->getFeatures().perFrameWindowSizeQuery.enabled && !needRecreate)
     {
@@ -1953,7 +1975,8 @@ angle::Result WindowSurfaceVk::checkForOutOfDateSwapchain(ContextVk *contextVk,
     {
         // On Android, rotation can cause the minImageCount to change
         uint32_t minImageCount =
-            GetMinImageCount(contextVk->getRenderer(), mSurfaceCaps, mDesiredSwapchainPresentMode);
+            GetMinImageCount(contextVk->getRenderer(), mSurfaceCaps, mDesiredSwapchainPresentMode,
+                             mPresentPacing.imageCountAdjustment);
         if (mMinImageCount != minImageCount)
         {
             needRecreate     = true;
@@ -2425,6 +2448,19 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
         }
     }
 
+    VkPresentIdKHR presentIdInfo = {};
+    uint64_t presentId           = 0;
+    if (isPresentPacingEnabled(renderer))
+    {
+        presentId = ++mPresentPacing.lastPresentId;
+
+        presentIdInfo.sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentIdInfo.swapchainCount = 1;
+        presentIdInfo.pPresentIds    = &presentId;
+
+        vk::AddToPNextChain(&presentInfo, &presentIdInfo);
+    }
+
     // The ANI semaphore must have been submitted and waited.
     ASSERT(!mSwapchainImages[mCurrentSwapchainImageIndex]
                 .image->getAcquireNextImageSemaphore()
@@ -2433,6 +2469,11 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     VkResult presentResult =
         renderer->queuePresent(contextVk, contextVk->getPriority(), presentInfo);
 
+    if (presentId != 0 && presentResult == VK_SUCCESS)
+    {
+        updatePresentPacing(contextVk, presentId);
+    }
+
     // EGL_EXT_buffer_age
     // 4) What is the buffer age of a single buffered surface?
     //     RESOLVED: 0.  This falls out implicitly from the buffer age
@@ -2482,6 +2523,13 @@ angle::Result WindowSurfaceVk::throttleCPU(vk::Context *context,
     mSwapHistory.front()   = currentSubmitSerial;
     mSwapHistory.next();
 
+    // With a maximum frame latency of 1, wait for this frame's submission instead, so the app
+    // only starts on the next frame (and samples its input) once the GPU is done with this one.
+    if (mMaxFrameLatency == 1)
+    {
+        swapSerial = currentSubmitSerial;
+    }
+
     if (swapSerial.valid() && !context->getRenderer()->hasQueueSerialFinished(swapSerial))
     {
         // Make this call after unlocking the EGL lock.  Renderer::finishQueueSerial is necessarily
@@ -2591,6 +2639,109 @@ angle::Result WindowSurfaceVk::cleanUpOldSwapchains(vk::Context *context)
     return angle::Result::Continue;
 }
 
+bool WindowSurfaceVk::isPresentPacingEnabled(vk::Renderer *renderer) const
+{
+    return renderer->getFeatures().adaptSwapchainImageCount.enabled &&
+           renderer->getFeatures().supportsPresentWait.enabled &&
+           (mSwapchainPresentMode == vk::PresentMode::FifoKHR ||
+            mSwapchainPresentMode == vk::PresentMode::FifoRelaxedKHR);
+}
+
+void WindowSurfaceVk::updatePresentPacing(vk::Context *context, uint64_t presentId)
+{
+    // The number of frames over which the image count is decided, and the share of them that must
+    // be missed or queued up to change it.
+    constexpr uint32_t kPacingWindowFrameCount      = 120;
+    constexpr uint32_t kMinMissedFrameCount         = kPacingWindowFrameCount / 20;
+    constexpr uint32_t kMinQueuedUpFrameCount       = kPacingWindowFrameCount * 9 / 10;
+    constexpr double kMissedFrameIntervalMultiplier = 1.5;
+
+    impl::PresentPacing &pacing = mPresentPacing;
+
+    // Forget the presents that have reached the display.  FIFO presents reach it in order, and a
+    // timeout of 0 only polls.
+    while (!pacing.pendingPresentIds.empty())
+    {
+        VkResult result = vkWaitForPresentKHR(context->getDevice(), mSwapchain,
+                                              pacing.pendingPresentIds.front(), 0);
+        if (result == VK_TIMEOUT)
+        {
+            break;
+        }
+        if (result != VK_SUCCESS)
+        {
+            // The swapchain is out of date or lost, which the next acquire handles.
+            pacing.pendingPresentIds.clear();
+            return;
+        }
+        pacing.pendingPresentIds.pop_front();
+    }
+
+    const size_t queuedPresentCount = pacing.pendingPresentIds.size();
+    pacing.pendingPresentIds.push_back(presentId);
+
+    const double presentTime     = angle::GetCurrentSystemTime();
+    const double presentInterval = presentTime - pacing.lastPresentTime;
+    const bool isFirstPresent    = pacing.lastPresentTime == 0;
+    pacing.lastPresentTime       = presentTime;
+    if (isFirstPresent)
+    {
+        return;
+    }
+
+    if (queuedPresentCount == 0 && pacing.averagePresentInterval > 0 &&
+        presentInterval > pacing.averagePresentInterval * kMissedFrameIntervalMultiplier)
+    {
+        ++pacing.missedFrameCount;
+    }
+    else if (queuedPresentCount + 1 >= mSwapchainImages.size())
+    {
+        ++pacing.queuedUpFrameCount;
+    }
+
+    // Long frames are left out of the average, so it remains close to the frame time of the
+    // frames that keep up with the display.
+    pacing.averagePresentInterval =
+        pacing.averagePresentInterval == 0
+            ? presentInterval
+            : std::min(presentInterval, pacing.averagePresentInterval * 2) * 0.1 +
+                  pacing.averagePresentInterval * 0.9;
+
+    if (++pacing.frameCount < kPacingWindowFrameCount)
+    {
+        return;
+    }
+
+    int32_t imageCountAdjustment = pacing.imageCountAdjustment;
+    if (pacing.missedFrameCount >= kMinMissedFrameCount)
+    {
+        imageCountAdjustment = std::min(imageCountAdjustment + 1, 1);
+    }
+    else if (pacing.missedFrameCount == 0 && pacing.queuedUpFrameCount >= kMinQueuedUpFrameCount)
+    {
+        imageCountAdjustment = std::max(imageCountAdjustment - 1, -1);
+    }
+
+    pacing.frameCount         = 0;
+    pacing.missedFrameCount   = 0;
+    pacing.queuedUpFrameCount = 0;
+
+    if (imageCountAdjustment == pacing.imageCountAdjustment)
+    {
+        return;
+    }
+
+    const uint32_t minImageCount = GetMinImageCount(context->getRenderer(), mSurfaceCaps,
+                                                    mDesiredSwapchainPresentMode,
+                                                    imageCountAdjustment);
+    pacing.imageCountAdjustment = imageCountAdjustment;
+    if (minImageCount != mMinImageCount)
+    {
+        mMinImageCount           = minImageCount;
+        pacing.imageCountChanged = true;
+    }
+}
+
 angle::Result WindowSurfaceVk::swapImpl(const gl::Context *context,
                                         const EGLint *rects,
                                         EGLint n_rects,
@@ -2950,8 +3101,9 @@ void WindowSurfaceVk::setSwapInterval(DisplayVk *displayVk, EGLint interval)
     mDesiredSwapchainPresentMode = GetDesiredPresentMode(mPresentModes, interval);
 
     // minImageCount may vary based on the Present Mode
-    mMinImageCount =
-        GetMinImageCount(displayVk->getRenderer(), mSurfaceCaps, mDesiredSwapchainPresentMode);
+    mMinImageCount = GetMinImageCount(displayVk->getRenderer(), mSurfaceCaps,
+                                      mDesiredSwapchainPresentMode,
+                                      mPresentPacing.imageCountAdjustment);
 
     // On the next swap, if the desired present mode is different from the current one, the
     // swapchain will be recreated.
@@ -249,6 +249,33 @@ struct UnlockedAcquireResult : angle::NonCopyable
     uint32_t imageIndex = std::numeric_limits<uint32_t>::max();
 };
 
+// With adaptSwapchainImageCount, FIFO presents are given ids, and vkWaitForPresentKHR tells which
+// of them have reached the display.  Over a window of frames, two kinds of frames are counted:
+//
+// - Missed frames, which took noticeably longer than usual while no earlier present was queued, so
+//   the display had to show the previous frame again.  An extra image lets the application get
+//   ahead when its frames are faster, to cover for the slower ones.
+// - Queued up frames, presented while every other image was queued for the display.  The
+//   application is then throttled by the display, and every queued image only adds latency.
+struct PresentPacing
+{
+    // The ids of the presents not seen reaching the display yet, oldest first.
+    std::deque<uint64_t> pendingPresentIds;
+    uint64_t lastPresentId = 0;
+
+    double lastPresentTime        = 0;
+    double averagePresentInterval = 0;
+
+    uint32_t frameCount         = 0;
+    uint32_t missedFrameCount   = 0;
+    uint32_t queuedUpFrameCount = 0;
+
+    // Added to the image count of FIFO swapchains, between -1 and 1.
+    int32_t imageCountAdjustment = 0;
+    // Set when imageCountAdjustment changes, so the swapchain is recreated at the next acquire.
+    bool imageCountChanged = false;
+};
+
 struct ImageAcquireOperation : angle::NonCopyable
 {
     // Initially image needs to be acquired.
@@ -434,6 +461,9 @@ class WindowSurfaceVk : public SurfaceVk
                           bool *presentOutOfDate);
 
     angle::Result cleanUpPresentHistory(vk::Context *context);
+    // adaptSwapchainImageCount
+    bool isPresentPacingEnabled(vk::Renderer *renderer) const;
+    void updatePresentPacing(vk::Context *context, uint64_t presentId);
     angle::Result cleanUpOldSwapchains(vk::Context *context);
 
     // Throttle the CPU such that application's logic and command buffer recording doesn't get more
@@ -486,6 +516,12 @@ class WindowSurfaceVk : public SurfaceVk
     // acquire semaphore recycling (see mAcquireImageSemaphores above)
     angle::CircularBuffer<QueueSerial, impl::kSwapHistorySize> mSwapHistory;
 
+    // EGL_MAX_FRAME_LATENCY_ANGLE, or 0 if not given.  Only a latency of 1 changes anything, as
+    // mSwapHistory already limits the app to kSwapHistorySize frames in flight.
+    EGLint mMaxFrameLatency;
+
+    impl::PresentPacing mPresentPacing;
+
     // The previous swapchain which needs to be scheduled for destruction when appropriate.  This
     // will be done when the first image of the current swapchain is presented or when fences are
     // signaled (when VK_EXT_swapchain_maintenance1 is supported).  If there were older swapchains
@@ -492,6 +492,7 @@ bool NeedsRGBAEmulation(vk::Renderer *renderer, angle::FormatID formatID)
 TextureVk::TextureVk(const gl::TextureState &state, vk::Renderer *renderer)
     : TextureImpl(state),
       mOwnsImage(false),
+      mIsImageRecyclable(false),
       mRequiresMutableStorage(false),
       mRequiredImageAccess(vk::ImageAccess::SampleOnly),
       mImmutableSamplerDirty(false),
@@ -2652,11 +2653,11 @@ angle::Result TextureVk::generateMipmapsWithCPU(const gl::Context *context)
     {
         size_t bufferOffset = layer * baseLevelAllocationSize;
 
-        ANGLE_TRY(generateMipmapLevelsWithCPU(contextVk, angleFormat, layer, baseLevelGL + 1,
-                                              gl::LevelIndex(mState.getMipmapMaxLevel()),
-                                              baseLevelExtents.width, baseLevelExtents.height,
-                                              baseLevelExtents.depth, sourceRowPitch,
-                                              sourceDepthPitch, imageData + bufferOffset));
+        ANGLE_TRY(generateMipmapLevelsWithCPU(
+            contextVk, context->getWorkerThreadPool().get(), angleFormat, layer, baseLevelGL + 1,
+            gl::LevelIndex(mState.getMipmapMaxLevel()), baseLevelExtents.width,
+            baseLevelExtents.height, baseLevelExtents.depth, sourceRowPitch, sourceDepthPitch,
+            imageData + bufferOffset));
     }
 
     ASSERT(!TextureHasAnyRedefinedLevels(mRedefinedLevels));
@@ -4042,6 +4043,14 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
         }
     }
 
+    // Images with compression control, YUV conversion or protected memory are not recycled, so
+    // the recycler only has to match the image create info.
+    mIsImageRecyclable = renderer->getFeatures().recycleTextureImages.enabled &&
+                         compressionInfo == nullptr && !mState.hasProtectedContent() &&
+                         !angle::Format::Get(actualImageFormatID).isYUV;
+    vk::ImageRecycler *recycler =
+        mIsImageRecyclable ? contextVk->getShareGroup()->getImageRecycler() : nullptr;
+
     ANGLE_TRY(mImage->initExternal(
         contextVk, mState.getType(), vkExtent, intendedImageFormatID, actualImageFormatID, samples,
         mImageUsageFlags, mImageCreateFlags, vk::ImageLayout::Undefined, nullptr,
@@ -4049,7 +4058,7 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
         contextVk->isRobustResourceInitEnabled(), mState.hasProtectedContent(),
         vk::ImageHelper::deriveConversionDesc(contextVk, actualImageFormatID,
                                               intendedImageFormatID),
-        compressionInfo));
+        compressionInfo, recycler));
 
     ANGLE_TRY(updateTextureLabel(contextVk));
 
@@ -4063,9 +4072,13 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
         flags |= VK_MEMORY_PROPERTY_PROTECTED_BIT;
     }
 
-    ANGLE_TRY(contextVk->initImageAllocation(mImage, mState.hasProtectedContent(),
-                                             renderer->getMemoryProperties(), flags,
-                                             vk::MemoryAllocationType::TextureImage));
+    // A recycled image comes with its memory.
+    if (!mImage->hasMemory())
+    {
+        ANGLE_TRY(contextVk->initImageAllocation(mImage, mState.hasProtectedContent(),
+                                                 renderer->getMemoryProperties(), flags,
+                                                 vk::MemoryAllocationType::TextureImage));
+    }
 
     const uint32_t viewLevelCount =
         mState.getImmutableFormat() ? getMipLevelCount(ImageMipLevels::EnabledLevels) : levelCount;
@@ -4117,7 +4130,12 @@ void TextureVk::releaseImage(ContextVk *contextVk)
 
     if (mImage)
     {
-        if (mOwnsImage)
+        if (mOwnsImage && mIsImageRecyclable && mImage->valid())
+        {
+            mImage->releaseImageToRecycler(renderer, contextVk, mImageSiblingSerial,
+                                           contextVk->getShareGroup()->getImageRecycler());
+        }
+        else if (mOwnsImage)
         {
             mImage->releaseImageFromShareContexts(renderer, contextVk, mImageSiblingSerial);
         }
@@ -4145,7 +4163,8 @@ void TextureVk::releaseImage(ContextVk *contextVk)
     }
 
     onStateChange(angle::SubjectMessage::SubjectChanged);
-    mRedefinedLevels = {};
+    mRedefinedLevels   = {};
+    mIsImageRecyclable = false;
 }
 
 void TextureVk::releaseImageViews(ContextVk *contextVk)
@@ -4245,6 +4264,7 @@ uint32_t TextureVk::getMaxLevelCount() const
 }
 
 angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
+                                                     angle::WorkerThreadPool *workerThreadPool,
                                                      const angle::Format &sourceFormat,
                                                      GLuint layer,
                                                      gl::LevelIndex firstMipLevel,
@@ -4286,9 +4306,10 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
         // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        GenerateMipInParallel(workerThreadPool, sourceFormat.mipGenerationFunction,
+                              previousLevelWidth, previousLevelHeight, previousLevelDepth,
+                              previousLevelData, previousLevelRowPitch, previousLevelDepthPitch,
+                              destData, destRowPitch, destDepthPitch);
 
         // Swap for the next iteration
         previousLevelWidth      = mipWidth;
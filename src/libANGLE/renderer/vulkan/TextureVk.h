@@ -261,6 +261,11 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
         ASSERT(mSampler->valid());
         return *mSampler.get();
     }
+    const vk::SharedSamplerPtr &getSharedSampler() const
+    {
+        ASSERT(mSampler);
+        return mSampler;
+    }
 
     void resetSampler()
     {
@@ -482,6 +487,7 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
     angle::Result generateMipmapsWithCPU(const gl::Context *context);
 
     angle::Result generateMipmapLevelsWithCPU(ContextVk *contextVk,
+                                              angle::WorkerThreadPool *workerThreadPool,
                                               const angle::Format &sourceFormat,
                                               GLuint layer,
                                               gl::LevelIndex firstMipLevel,
@@ -642,6 +648,9 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
                                                  GLint *rates);
 
     bool mOwnsImage;
+    // Whether mImage was created by initImage with nothing imported or specific to it, so its
+    // VkImage can be recycled for other textures when released.
+    bool mIsImageRecyclable;
     // Generated from ImageVk if EGLImage target, or from throw-away generator if Surface target.
     UniqueSerial mImageSiblingSerial;
 
@@ -1211,7 +1211,9 @@ void UpdateDepthStencilAccess(ContextVk *contextVk, bool depthWrite, bool stenci
     }
 }
 
-void ResetDynamicState(ContextVk *contextVk, vk::RenderPassCommandBuffer *commandBuffer)
+void ResetDynamicState(ContextVk *contextVk,
+                       const vk::GraphicsPipelineDesc &pipelineDesc,
+                       vk::RenderPassCommandBuffer *commandBuffer)
 {
     // Reset dynamic state that might affect UtilsVk.  Mark all dynamic state dirty for simplicity.
     // Ideally, only dynamic state that is changed by UtilsVk will be marked dirty but, until such
@@ -1281,6 +1283,16 @@ void ResetDynamicState(ContextVk *contextVk, vk::RenderPassCommandBuffer *comman
     {
         commandBuffer->setVertexInput(0, nullptr, 0, nullptr);
     }
+    if (renderer->getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        gl::DrawBuffersArray<VkColorBlendEquationEXT> equations;
+        const uint32_t attachmentCount =
+            pipelineDesc.getColorBlendEquations(contextVk, nullptr, &equations);
+        if (attachmentCount > 0)
+        {
+            commandBuffer->setColorBlendEquation(0, attachmentCount, equations.data());
+        }
+    }
 
     // Let ContextVk know that it should refresh all dynamic state.
     contextVk->invalidateAllDynamicState();
@@ -1920,6 +1932,52 @@ angle::Result UtilsVk::setupComputeProgram(
     return angle::Result::Continue;
 }
 
+angle::Result UtilsVk::dispatchCompute(ContextVk *contextVk,
+                                       Function function,
+                                       vk::OutsideRenderPassCommandBuffer *commandBuffer,
+                                       uint32_t groupCountX,
+                                       uint32_t groupCountY,
+                                       uint32_t groupCountZ)
+{
+    const char *traceName = GetComputeFunctionTraceName(function);
+    ANGLE_TRY(contextVk->traceUtilsGpuEvent(commandBuffer, TRACE_EVENT_PHASE_BEGIN, traceName));
+    commandBuffer->dispatch(groupCountX, groupCountY, groupCountZ);
+    return contextVk->traceUtilsGpuEvent(commandBuffer, TRACE_EVENT_PHASE_END, traceName);
+}
+
+// static
+const char *UtilsVk::GetComputeFunctionTraceName(Function function)
+{
+    switch (function)
+    {
+        case Function::ConvertIndexBuffer:
+            return "ConvertIndex";
+        case Function::ConvertVertexBuffer:
+            return "ConvertVertex";
+        case Function::ClearTexture:
+            return "ClearTexture";
+        case Function::BlitResolveStencilNoExport:
+            return "ResolveStencil";
+        case Function::ConvertIndexIndirectBuffer:
+            return "ConvertIndexIndirect";
+        case Function::ConvertIndexIndirectLineLoopBuffer:
+            return "ConvertLineLoopIndirect";
+        case Function::ConvertIndirectLineLoopBuffer:
+            return "ConvertLineLoopArrays";
+        case Function::GenerateMipmap:
+            return "GenerateMipmap";
+        case Function::TransCodeEtcToBc:
+            return "TranscodeEtcToBc";
+        case Function::CopyImageToBuffer:
+            return "CopyImageToBuffer";
+        case Function::GenerateFragmentShadingRate:
+            return "GenerateShadingRate";
+        default:
+            UNREACHABLE();
+            return "Utils";
+    }
+}
+
 angle::Result UtilsVk::setupGraphicsProgramWithLayout(
     ContextVk *contextVk,
     const vk::PipelineLayout &pipelineLayout,
@@ -1981,7 +2039,7 @@ angle::Result UtilsVk::setupGraphicsProgramWithLayout(
                                      static_cast<uint32_t>(pushConstantsSize), pushConstants);
     }
 
-    ResetDynamicState(contextVk, commandBuffer);
+    ResetDynamicState(contextVk, *pipelineDesc, commandBuffer);
 
     return angle::Result::Continue;
 }
@@ -2060,7 +2118,8 @@ angle::Result UtilsVk::convertIndexBuffer(ContextVk *contextVk,
     const uint32_t kIndexCount              = params.maxIndex;
     const uint32_t kGroupCount =
         UnsignedCeilDivide(kIndexCount * kInvocationsPerIndex, kInvocationsPerGroup);
-    commandBuffer->dispatch(kGroupCount, 1, 1);
+    ANGLE_TRY(
+        dispatchCompute(contextVk, Function::ConvertIndexBuffer, commandBuffer, kGroupCount, 1, 1));
 
     return angle::Result::Continue;
 }
@@ -2130,7 +2189,8 @@ angle::Result UtilsVk::convertIndexIndirectBuffer(ContextVk *contextVk,
     const uint32_t kIndexCount              = params.maxIndex;
     const uint32_t kGroupCount =
         UnsignedCeilDivide(kIndexCount * kInvocationsPerIndex, kInvocationsPerGroup);
-    commandBuffer->dispatch(kGroupCount, 1, 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::ConvertIndexIndirectBuffer, commandBuffer,
+                              kGroupCount, 1, 1));
 
     return angle::Result::Continue;
 }
@@ -2197,7 +2257,8 @@ angle::Result UtilsVk::convertLineLoopIndexIndirectBuffer(
                                   &shaderParams, sizeof(ConvertIndexIndirectLineLoopShaderParams),
                                   commandBufferHelper));
 
-    commandBuffer->dispatch(1, 1, 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::ConvertIndexIndirectLineLoopBuffer,
+                              commandBuffer, 1, 1, 1));
 
     return angle::Result::Continue;
 }
@@ -2259,7 +2320,8 @@ angle::Result UtilsVk::convertLineLoopArrayIndirectBuffer(
                                   sizeof(ConvertIndirectLineLoopShaderParams),
                                   commandBufferHelper));
 
-    commandBuffer->dispatch(1, 1, 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::ConvertIndirectLineLoopBuffer, commandBuffer,
+                              1, 1, 1));
 
     return angle::Result::Continue;
 }
@@ -2482,7 +2544,8 @@ angle::Result UtilsVk::convertVertexBufferImpl(
                                   &mConvertVertex[flags], descriptorSet, &shaderParams,
                                   sizeof(shaderParams), commandBufferHelper));
 
-    commandBuffer->dispatch(UnsignedCeilDivide(shaderParams.outputCount, 64), 1, 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::ConvertVertexBuffer, commandBuffer,
+                              UnsignedCeilDivide(shaderParams.outputCount, 64), 1, 1));
 
     if (!additionalOffsetVertexCounts.empty())
     {
@@ -2507,7 +2570,8 @@ angle::Result UtilsVk::convertVertexBufferImpl(
             // Since multiple compute dispatch all convert from the same srcBuffer and write to the
             // same dstBuffer, even if the ranges overlap, they should end up with writing the same
             // values, thus no barrier is needed here.
-            commandBuffer->dispatch(UnsignedCeilDivide(constants.outputCount, 64), 1, 1);
+            ANGLE_TRY(dispatchCompute(contextVk, Function::ConvertVertexBuffer, commandBuffer,
+                                      UnsignedCeilDivide(constants.outputCount, 64), 1, 1));
         }
     }
 
@@ -3328,8 +3392,9 @@ angle::Result UtilsVk::stencilBlitResolveNoShaderExport(ContextVk *contextVk,
     ANGLE_TRY(setupComputeProgram(contextVk, Function::BlitResolveStencilNoExport, shader,
                                   &mBlitResolveStencilNoExport[flags], descriptorSet, &shaderParams,
                                   sizeof(shaderParams), commandBufferHelper));
-    commandBuffer->dispatch(UnsignedCeilDivide(bufferRowLengthInUints, 8),
-                            UnsignedCeilDivide(params.blitArea.height, 8), 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::BlitResolveStencilNoExport, commandBuffer,
+                              UnsignedCeilDivide(bufferRowLengthInUints, 8),
+                              UnsignedCeilDivide(params.blitArea.height, 8), 1));
 
     // Add a barrier prior to copy.
     VkMemoryBarrier memoryBarrier = {};
@@ -3932,8 +3997,9 @@ angle::Result UtilsVk::copyImageToBuffer(ContextVk *contextVk,
                                   &mCopyImageToBuffer[flags], descriptorSet, &shaderParams,
                                   sizeof(shaderParams), commandBufferHelper));
 
-    commandBuffer->dispatch(UnsignedCeilDivide(params.size[0], 8),
-                            UnsignedCeilDivide(params.size[1], 8), 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::CopyImageToBuffer, commandBuffer,
+                              UnsignedCeilDivide(params.size[0], 8),
+                              UnsignedCeilDivide(params.size[1], 8), 1));
 
     vk::ImageView srcViewObject = srcView.release();
     contextVk->addGarbage(&srcViewObject);
@@ -4109,7 +4175,12 @@ angle::Result UtilsVk::transCodeEtcToBc(ContextVk *contextVk,
     writeDescriptorSet[1].dstBinding      = 1;
     writeDescriptorSet[1].pImageInfo      = &imageInfo;
     writeDescriptorSet[1].descriptorCount = 1;
+
+    const vk::PipelineLayoutPtr &pipelineLayout = mPipelineLayouts[Function::TransCodeEtcToBc];
+
     // Due to limitation VUID-VkImageViewCreateInfo-image-07072, we have to copy layer by layer.
+    // The pipeline is bound once, and only the descriptor set and push constants change between
+    // the per-layer dispatches.
     for (uint32_t i = 0; i < copyRegion->imageSubresource.layerCount; ++i)
     {
         vk::DeviceScoped<vk::ImageView> scopedImageView(contextVk->getDevice());
@@ -4126,12 +4197,25 @@ angle::Result UtilsVk::transCodeEtcToBc(ContextVk *contextVk,
         writeDescriptorSet[1].dstSet = descriptorSet;
         vkUpdateDescriptorSets(contextVk->getDevice(), 2, writeDescriptorSet, 0, nullptr);
 
-        ANGLE_TRY(setupComputeProgram(contextVk, Function::TransCodeEtcToBc, shader,
-                                      &mEtcToBc[flags], descriptorSet, &shaderParams,
-                                      sizeof(shaderParams), commandBufferHelper));
+        if (i == 0)
+        {
+            ANGLE_TRY(setupComputeProgram(contextVk, Function::TransCodeEtcToBc, shader,
+                                          &mEtcToBc[flags], descriptorSet, &shaderParams,
+                                          sizeof(shaderParams), commandBufferHelper));
+        }
+        else
+        {
+            commandBuffer->bindDescriptorSets(*pipelineLayout, VK_PIPELINE_BIND_POINT_COMPUTE,
+                                              DescriptorSetIndex::Internal, 1, &descriptorSet, 0,
+                                              nullptr);
+            commandBuffer->pushConstants(*pipelineLayout, VK_SHADER_STAGE_COMPUTE_BIT, 0,
+                                         static_cast<uint32_t>(sizeof(shaderParams)),
+                                         &shaderParams);
+        }
 
         // Work group size is 8 x 8 x 1
-        commandBuffer->dispatch(UnsignedCeilDivide(width, 8), UnsignedCeilDivide(height, 8), 1);
+        ANGLE_TRY(dispatchCompute(contextVk, Function::TransCodeEtcToBc, commandBuffer,
+                                  UnsignedCeilDivide(width, 8), UnsignedCeilDivide(height, 8), 1));
         // Release temporary views
         vk::ImageView imageView = scopedImageView.release();
         contextVk->addGarbage(&imageView);
@@ -4218,7 +4302,8 @@ angle::Result UtilsVk::generateMipmap(ContextVk *contextVk,
                                   &mGenerateMipmap[flags], descriptorSet, &shaderParams,
                                   sizeof(shaderParams), commandBufferHelper));
 
-    commandBuffer->dispatch(workGroupX, workGroupY, 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::GenerateMipmap, commandBuffer, workGroupX,
+                              workGroupY, 1));
 
     return angle::Result::Continue;
 }
@@ -4907,7 +4992,8 @@ angle::Result UtilsVk::generateFragmentShadingRate(
                                   &mGenerateFragmentShadingRateAttachment, descriptorSet,
                                   &shadingRateParameters, sizeof(shadingRateParameters),
                                   commandBufferHelper));
-    commandBuffer->dispatch(workGroupX, workGroupY, 1);
+    ANGLE_TRY(dispatchCompute(contextVk, Function::GenerateFragmentShadingRate, commandBuffer,
+                              workGroupX, workGroupY, 1));
     return angle::Result::Continue;
 }
 
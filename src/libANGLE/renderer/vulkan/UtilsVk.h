@@ -594,6 +594,15 @@ class UtilsVk : angle::NonCopyable
         const void *pushConstants,
         size_t pushConstantsSize,
         vk::OutsideRenderPassCommandBufferHelper *commandBufferHelper);
+    // Records a dispatch of an internal compute function, between GPU trace events if they are
+    // enabled.
+    angle::Result dispatchCompute(ContextVk *contextVk,
+                                  Function function,
+                                  vk::OutsideRenderPassCommandBuffer *commandBuffer,
+                                  uint32_t groupCountX,
+                                  uint32_t groupCountY,
+                                  uint32_t groupCountZ);
+    static const char *GetComputeFunctionTraceName(Function function);
     angle::Result setupGraphicsProgramWithLayout(
         ContextVk *contextVk,
         const vk::PipelineLayout &pipelineLayout,
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/VertexArrayVk.h"
 
 #include "common/debug.h"
+#include "common/hash_utils.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -310,7 +311,12 @@ VertexArrayVk::VertexArrayVk(ContextVk *contextVk, const gl::VertexArrayState &s
       mCurrentArrayBufferDivisors{},
       mCurrentElementArrayBuffer(nullptr),
       mLineLoopHelper(contextVk->getRenderer()),
-      mDirtyLineLoopTranslation(true)
+      mDirtyLineLoopTranslation(true),
+      mLineLoopElementsType(gl::DrawElementsType::InvalidEnum),
+      mLineLoopElementsOffset(0),
+      mLineLoopElementsCount(0),
+      mLineLoopElementsPrimitiveRestart(false),
+      mLineLoopElementsIndexCount(0)
 {
     vk::BufferHelper &emptyBuffer = contextVk->getEmptyBuffer();
 
@@ -435,6 +441,11 @@ angle::Result VertexArrayVk::handleLineLoopIndexIndirect(ContextVk *contextVk,
                                                          vk::BufferHelper **indexBufferOut,
                                                          vk::BufferHelper **indirectBufferOut)
 {
+    // The line loop index buffer is overwritten, so the cached translations are no longer valid.
+    mLineLoopBufferFirstIndex.reset();
+    mLineLoopBufferLastIndex.reset();
+    mDirtyLineLoopTranslation = true;
+
     return mLineLoopHelper.streamIndicesIndirect(contextVk, glIndexType, srcIndexBuffer,
                                                  srcIndirectBuffer, indirectBufferOffset,
                                                  indexBufferOut, indirectBufferOut);
@@ -467,6 +478,11 @@ angle::Result VertexArrayVk::handleLineLoopIndirectDraw(const gl::Context *conte
             maxVertexCount = vertexCount;
         }
     }
+
+    mLineLoopBufferFirstIndex.reset();
+    mLineLoopBufferLastIndex.reset();
+    mDirtyLineLoopTranslation = true;
+
     ANGLE_TRY(mLineLoopHelper.streamArrayIndirect(contextVk, maxVertexCount + 1, indirectBufferVk,
                                                   indirectBufferOffset, indexBufferOut,
                                                   indirectBufferOut));
@@ -709,10 +725,11 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
 
             if (numVertices > 0)
             {
+                // Only the vertices covered by the dirty range are converted again.
                 const uint8_t *srcBytes = src + srcOffset;
-                size_t bytesToCopy      = maxNumVertices * dstFormat.pixelBytes;
+                size_t bytesToCopy      = numVertices * dstFormat.pixelBytes;
                 ANGLE_TRY(StreamVertexData(contextVk, conversion->getBuffer(), srcBytes,
-                                           bytesToCopy, dstOffset, maxNumVertices, srcStride,
+                                           bytesToCopy, dstOffset, numVertices, srcStride,
                                            vertexLoadFunction));
             }
         }
@@ -1247,6 +1264,8 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
     std::array<size_t, gl::MAX_VERTEX_ATTRIBS> mergedIndexes;
     std::array<AttributeRange, gl::MAX_VERTEX_ATTRIBS> mergeRanges;
     std::array<vk::BufferHelper *, gl::MAX_VERTEX_ATTRIBS> attribBufferHelper = {};
+    gl::AttributesMask reusedStreamedData;
+    const bool reuseStreamedData = contextVk->getFeatures().reuseStreamedVertexData.enabled;
     auto mergeAttribMask =
         mergeClientAttribsRange(renderer, activeStreamedAttribs, startVertex,
                                 startVertex + vertexCount, mergeRanges, mergedIndexes);
@@ -1265,6 +1284,7 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
         ASSERT(vertexFormat.getVertexInputAlignment(false) <= vk::kVertexBufferAlignment);
 
         vk::BufferHelper *vertexDataBuffer = nullptr;
+        const StreamedVertexData *streamed = nullptr;
         const uint8_t *src                 = static_cast<const uint8_t *>(attrib.pointer);
         const uint32_t divisor             = binding.getDivisor();
 
@@ -1343,30 +1363,93 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             ASSERT(binding.getBuffer().get() == nullptr);
             size_t mergedAttribIdx      = mergedIndexes[attribIndex];
             const AttributeRange &range = mergeRanges[attribIndex];
+            StreamedVertexData &lastStreamed = mLastStreamedVertexData[mergedAttribIdx];
             if (attribBufferHelper[mergedAttribIdx] == nullptr)
             {
                 size_t destOffset =
                     combined ? range.copyStartAddr - range.startAddr : startVertex * stride;
                 size_t bytesToAllocate = range.endAddr - range.startAddr;
-                ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(
-                    mergedAttribIdx, bytesToAllocate, &attribBufferHelper[mergedAttribIdx]));
-                ANGLE_TRY(StreamVertexData(
-                    contextVk, attribBufferHelper[mergedAttribIdx],
-                    (const uint8_t *)range.copyStartAddr, bytesToAllocate - destOffset, destOffset,
-                    vertexCount, binding.getStride(),
-                    combined ? nullptr : vertexFormat.getVertexLoadFunction(compressed)));
+                const uint8_t *copySrc = reinterpret_cast<const uint8_t *>(range.copyStartAddr);
+                const GLuint srcStride = binding.getStride();
+                const VertexCopyFunction loadFunction =
+                    combined ? nullptr : vertexFormat.getVertexLoadFunction(compressed);
+
+                uint64_t hash = 0;
+                if (reuseStreamedData && copySrc != nullptr)
+                {
+                    const size_t srcSize =
+                        combined ? bytesToAllocate - destOffset
+                                 : (vertexCount - 1) * srcStride +
+                                       ComputeVertexAttributeTypeSize(attrib);
+                    hash = XXH64(copySrc, srcSize, 0);
+
+                    if (lastStreamed.buffer != nullptr && lastStreamed.hash == hash &&
+                        lastStreamed.range.startAddr == range.startAddr &&
+                        lastStreamed.range.endAddr == range.endAddr &&
+                        lastStreamed.range.copyStartAddr == range.copyStartAddr &&
+                        lastStreamed.vertexCount == vertexCount &&
+                        lastStreamed.srcStride == srcStride &&
+                        lastStreamed.loadFunction == loadFunction &&
+                        lastStreamed.streamedBufferGeneration ==
+                            contextVk->getStreamedVertexBufferGeneration(mergedAttribIdx))
+                    {
+                        attribBufferHelper[mergedAttribIdx] = lastStreamed.buffer;
+                        reusedStreamedData.set(mergedAttribIdx);
+                    }
+                }
+
+                if (attribBufferHelper[mergedAttribIdx] == nullptr)
+                {
+                    ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(
+                        mergedAttribIdx, bytesToAllocate, &attribBufferHelper[mergedAttribIdx]));
+                    ANGLE_TRY(StreamVertexData(contextVk, attribBufferHelper[mergedAttribIdx],
+                                               copySrc, bytesToAllocate - destOffset, destOffset,
+                                               vertexCount, srcStride, loadFunction));
+
+                    vk::BufferHelper *buffer = attribBufferHelper[mergedAttribIdx];
+                    lastStreamed.buffer      = nullptr;
+                    if (reuseStreamedData && copySrc != nullptr)
+                    {
+                        lastStreamed.range        = range;
+                        lastStreamed.vertexCount  = vertexCount;
+                        lastStreamed.srcStride    = srcStride;
+                        lastStreamed.loadFunction = loadFunction;
+                        lastStreamed.hash         = hash;
+                        lastStreamed.streamedBufferGeneration =
+                            contextVk->getStreamedVertexBufferGeneration(mergedAttribIdx);
+                        lastStreamed.buffer       = buffer;
+                        lastStreamed.bufferHandle =
+                            buffer
+                                ->getBufferForVertexArray(contextVk, buffer->getSize(),
+                                                          &lastStreamed.bufferOffset)
+                                .getHandle();
+                    }
+                }
             }
             vertexDataBuffer = attribBufferHelper[mergedAttribIdx];
+            if (reusedStreamedData.test(mergedAttribIdx))
+            {
+                streamed = &lastStreamed;
+            }
             startOffset      = combined ? (uintptr_t)attrib.pointer - range.startAddr : 0;
         }
         ASSERT(vertexDataBuffer != nullptr);
         mCurrentArrayBuffers[attribIndex]      = vertexDataBuffer;
         mCurrentArrayBufferSerial[attribIndex] = vertexDataBuffer->getBufferSerial();
         VkDeviceSize bufferOffset;
-        mCurrentArrayBufferHandles[attribIndex] =
-            vertexDataBuffer
-                ->getBufferForVertexArray(contextVk, vertexDataBuffer->getSize(), &bufferOffset)
-                .getHandle();
+        if (streamed != nullptr)
+        {
+            // The buffer's current suballocation has moved on since the data was streamed.
+            mCurrentArrayBufferHandles[attribIndex] = streamed->bufferHandle;
+            bufferOffset                            = streamed->bufferOffset;
+        }
+        else
+        {
+            mCurrentArrayBufferHandles[attribIndex] =
+                vertexDataBuffer
+                    ->getBufferForVertexArray(contextVk, vertexDataBuffer->getSize(), &bufferOffset)
+                    .getHandle();
+        }
         mCurrentArrayBufferOffsets[attribIndex]  = bufferOffset + startOffset;
         mCurrentArrayBufferStrides[attribIndex]  = stride;
         mCurrentArrayBufferDivisors[attribIndex] = divisor;
@@ -1388,24 +1471,46 @@ angle::Result VertexArrayVk::handleLineLoop(ContextVk *contextVk,
     if (indexTypeOrInvalid != gl::DrawElementsType::InvalidEnum)
     {
         // Handle GL_LINE_LOOP drawElements.
-        if (mDirtyLineLoopTranslation)
+        gl::Buffer *elementArrayBuffer = mState.getElementArrayBuffer();
+
+        if (!elementArrayBuffer)
         {
-            gl::Buffer *elementArrayBuffer = mState.getElementArrayBuffer();
+            ANGLE_TRY(mLineLoopHelper.streamIndices(
+                contextVk, indexTypeOrInvalid, vertexOrIndexCount,
+                reinterpret_cast<const uint8_t *>(indices), indexBufferOut, indexCountOut));
 
-            if (!elementArrayBuffer)
-            {
-                ANGLE_TRY(mLineLoopHelper.streamIndices(
-                    contextVk, indexTypeOrInvalid, vertexOrIndexCount,
-                    reinterpret_cast<const uint8_t *>(indices), indexBufferOut, indexCountOut));
-            }
-            else
+            // Client memory indices are not tracked, and they replace any cached translation.
+            mDirtyLineLoopTranslation = true;
+        }
+        else
+        {
+            // When using an element array buffer, 'indices' is an offset to the first element.
+            intptr_t offset             = reinterpret_cast<intptr_t>(indices);
+            const bool primitiveRestart = contextVk->getState().isPrimitiveRestartEnabled();
+
+            // Writes through a persistent mapping are not tracked, so never reuse the translation
+            // of a mapped buffer.
+            if (mDirtyLineLoopTranslation || elementArrayBuffer->isMapped() ||
+                mLineLoopElementsType != indexTypeOrInvalid || mLineLoopElementsOffset != offset ||
+                mLineLoopElementsCount != vertexOrIndexCount ||
+                mLineLoopElementsPrimitiveRestart != primitiveRestart)
             {
-                // When using an element array buffer, 'indices' is an offset to the first element.
-                intptr_t offset                = reinterpret_cast<intptr_t>(indices);
                 BufferVk *elementArrayBufferVk = vk::GetImpl(elementArrayBuffer);
                 ANGLE_TRY(mLineLoopHelper.getIndexBufferForElementArrayBuffer(
                     contextVk, elementArrayBufferVk, indexTypeOrInvalid, vertexOrIndexCount, offset,
                     indexBufferOut, indexCountOut));
+
+                mLineLoopElementsType             = indexTypeOrInvalid;
+                mLineLoopElementsOffset           = offset;
+                mLineLoopElementsCount            = vertexOrIndexCount;
+                mLineLoopElementsPrimitiveRestart = primitiveRestart;
+                mLineLoopElementsIndexCount       = *indexCountOut;
+                mDirtyLineLoopTranslation         = false;
+            }
+            else
+            {
+                *indexBufferOut = mLineLoopHelper.getCurrentIndexBuffer();
+                *indexCountOut  = mLineLoopElementsIndexCount;
             }
         }
 
@@ -1430,6 +1535,7 @@ angle::Result VertexArrayVk::handleLineLoop(ContextVk *contextVk,
 
         mLineLoopBufferFirstIndex = firstVertex;
         mLineLoopBufferLastIndex  = lastVertex;
+        mDirtyLineLoopTranslation = true;
     }
     else
     {
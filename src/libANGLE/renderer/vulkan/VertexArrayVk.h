@@ -209,11 +209,37 @@ class VertexArrayVk : public VertexArrayImpl
     LineLoopHelper mLineLoopHelper;
     Optional<GLint> mLineLoopBufferFirstIndex;
     Optional<size_t> mLineLoopBufferLastIndex;
+    // The line loop drawElements last converted from the element array buffer.  Its indices are
+    // reused until the element array buffer or its data changes, or another line loop draw
+    // overwrites them.
     bool mDirtyLineLoopTranslation;
+    gl::DrawElementsType mLineLoopElementsType;
+    intptr_t mLineLoopElementsOffset;
+    GLsizei mLineLoopElementsCount;
+    bool mLineLoopElementsPrimitiveRestart;
+    uint32_t mLineLoopElementsIndexCount;
 
     // Track client and/or emulated attribs that we have to stream their buffer contents
     gl::AttributesMask mStreamingVertexAttribsMask;
 
+    // The last upload of client data per streamed vertex buffer.  With the
+    // reuseStreamedVertexData feature, a draw that streams the same range with the same contents
+    // reuses it, as long as the streamed vertex buffer it was allocated from is still current (and
+    // so hasn't been recycled).
+    struct StreamedVertexData
+    {
+        AttributeRange range;
+        size_t vertexCount                = 0;
+        GLuint srcStride                  = 0;
+        VertexCopyFunction loadFunction   = nullptr;
+        uint64_t hash                     = 0;
+        uint32_t streamedBufferGeneration = 0;
+        vk::BufferHelper *buffer          = nullptr;
+        VkBuffer bufferHandle             = VK_NULL_HANDLE;
+        VkDeviceSize bufferOffset         = 0;
+    };
+    gl::AttribArray<StreamedVertexData> mLastStreamedVertexData;
+
     // The attrib/binding dirty bits that requires graphics pipeline update
     gl::VertexArray::DirtyBindingBits mBindingDirtyBitsRequiresPipelineUpdate;
     gl::VertexArray::DirtyAttribBits mAttribDirtyBitsRequiresPipelineUpdate;
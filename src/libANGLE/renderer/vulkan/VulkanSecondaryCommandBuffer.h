@@ -70,6 +70,12 @@ class VulkanSecondaryCommandBuffer : public priv::CommandBuffer
 
     void executeCommands(PrimaryCommandBuffer *primary) { primary->executeCommands(1, this); }
 
+    // Parallel encoding only applies to ANGLE's secondary command buffers, as the commands are
+    // already encoded by the driver here.
+    void insertParallelEncodeBoundary() {}
+    size_t getParallelEncodeChunkCount() const { return 1; }
+    void clearParallelEncodeBoundaries() {}
+
     void beginQuery(const QueryPool &queryPool, uint32_t query, VkQueryControlFlags flags);
 
     void blitImage(const Image &srcImage,
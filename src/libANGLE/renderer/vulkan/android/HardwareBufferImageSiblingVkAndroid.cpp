@@ -448,7 +448,8 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
                              vkFormat->getActualRenderableImageFormatID(), 1, usage,
                              imageCreateFlags, vk::ImageLayout::ExternalPreInitialized,
                              imageCreateInfoPNext, gl::LevelIndex(0), mLevelCount, layerCount,
-                             robustInitEnabled, hasProtectedContent(), conversionDesc, nullptr));
+                             robustInitEnabled, hasProtectedContent(), conversionDesc, nullptr,
+                             nullptr));
 
     VkImportAndroidHardwareBufferInfoANDROID importHardwareBufferInfo = {};
     importHardwareBufferInfo.sType  = VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID;
@@ -332,6 +332,12 @@ std::string ClspvGetCompilerOptions(const CLDeviceVk *device)
     options += " --global-offset";
     options += " --enable-printf";
 
+    // Let clspv put the POD arguments of a kernel in push constants whenever they fit in the
+    // device's limit, rather than in the 128 bytes every device supports
+    const uint32_t maxPushConstantsSize =
+        rendererVk->getPhysicalDeviceProperties().limits.maxPushConstantsSize;
+    options += " --max-pushconstant-size=" + std::to_string(maxPushConstantsSize);
+
     // 8 bit storage buffer support
     if (!rendererVk->getFeatures().supports8BitStorageBuffer.enabled)
     {
@@ -555,7 +555,7 @@ angle::Result DmaBufImageSiblingVkLinux::initWithFormat(DisplayVk *displayVk,
                                    actualImageFormatID, 1, usageFlags, createFlags,
                                    vk::ImageLayout::ExternalPreInitialized, imageCreateInfoPNext,
                                    gl::LevelIndex(0), 1, 1, kIsRobustInitEnabled,
-                                   hasProtectedContent(), conversionDesc, nullptr));
+                                   hasProtectedContent(), conversionDesc, nullptr, nullptr));
 
     VkMemoryRequirements externalMemoryRequirements;
     mImage->getImage().getMemoryRequirements(renderer->getDevice(), &externalMemoryRequirements);
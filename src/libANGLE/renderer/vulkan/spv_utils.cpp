@@ -5401,6 +5401,692 @@ void SpirvVertexAttributeAliasingTransformer::writeExpandedMatrixInitialization(
         spirv::WriteStore(mSpirvBlobOut, matrixId, compositeId, nullptr);
     }
 }
+
+// Returns the result id of an instruction in a function, or an invalid id if it doesn't have one.
+// The instructions without a result id are all listed, out of the ones the SPIR-V builder can
+// generate.  Every other instruction has a result type followed by a result id.
+spirv::IdRef GetFunctionInstructionResultId(const uint32_t *instruction)
+{
+    spv::Op opCode;
+    uint32_t wordCount;
+    spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+    switch (opCode)
+    {
+        case spv::OpLabel:
+            return spirv::IdRef(instruction[1]);
+        case spv::OpNop:
+        case spv::OpLine:
+        case spv::OpNoLine:
+        case spv::OpStore:
+        case spv::OpCopyMemory:
+        case spv::OpImageWrite:
+        case spv::OpEmitVertex:
+        case spv::OpEndPrimitive:
+        case spv::OpEmitStreamVertex:
+        case spv::OpEndStreamPrimitive:
+        case spv::OpControlBarrier:
+        case spv::OpMemoryBarrier:
+        case spv::OpAtomicStore:
+        case spv::OpLoopMerge:
+        case spv::OpSelectionMerge:
+        case spv::OpBranch:
+        case spv::OpBranchConditional:
+        case spv::OpSwitch:
+        case spv::OpKill:
+        case spv::OpReturn:
+        case spv::OpReturnValue:
+        case spv::OpUnreachable:
+        case spv::OpFunctionEnd:
+        case spv::OpBeginInvocationInterlockEXT:
+        case spv::OpEndInvocationInterlockEXT:
+            return spirv::IdRef();
+        default:
+            ASSERT(wordCount > 2);
+            return spirv::IdRef(instruction[2]);
+    }
+}
+
+// A SPIR-V transformer that removes code that can never be executed, for the benefit of drivers
+// that compile SPIR-V slowly or don't optimize it well:
+//
+// - OpBranchConditional on a constant condition is replaced with an OpBranch to the target that is
+//   taken, and the OpSelectionMerge of its construct is removed.
+// - Blocks that are not reachable from their function's entry are removed.  Unreachable blocks
+//   that are the merge block or continue target of a reachable construct must remain, but are
+//   reduced to OpUnreachable and a branch back to the loop header respectively.
+// - Functions that are not reachable from the entry point are removed.
+//
+// The names and decorations of the ids defined in the removed code are removed with it.
+//
+// Specialization constants are not folded.  Their values are only known when a pipeline is
+// created, while the transformed SPIR-V is shared by every pipeline of the program.  Other
+// constant expressions are already folded by the translator.
+class SpirvDeadCodeRemover final : public SpirvTransformerBase
+{
+  public:
+    SpirvDeadCodeRemover(const spirv::Blob &spirvBlobIn,
+                         const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                         spirv::Blob *spirvBlobOut)
+        : SpirvTransformerBase(spirvBlobIn, variableInfoMap, spirvBlobOut)
+    {}
+
+    void transform();
+
+  private:
+    enum class BlockState
+    {
+        Removed,
+        Reachable,
+        // The block is unreachable but referenced by an OpSelectionMerge or OpLoopMerge.
+        EmptyMergeBlock,
+        // The block is unreachable but referenced as a continue target by an OpLoopMerge.
+        EmptyContinueTarget,
+    };
+
+    struct BlockInfo
+    {
+        spirv::IdRef label;
+        size_t beginWord = 0;
+        size_t endWord   = 0;
+
+        spv::Op mergeOp = spv::OpNop;
+        spirv::IdRef mergeBlock;
+        spirv::IdRef continueTarget;
+
+        spirv::IdRefList successors;
+        // If the block ends in OpBranchConditional on a constant, the target that is taken.
+        spirv::IdRef constantBranchTarget;
+
+        std::vector<spirv::IdRef> callees;
+
+        BlockState state = BlockState::Removed;
+        // For EmptyContinueTarget, the loop header to branch back to.
+        spirv::IdRef loopHeader;
+    };
+
+    struct FunctionInfo
+    {
+        spirv::IdRef id;
+        size_t beginWord = 0;
+        size_t endWord   = 0;
+        // Range of the function's blocks in mBlocks.
+        size_t firstBlock = 0;
+        size_t blockCount = 0;
+        bool isLive       = false;
+    };
+
+    // Analysis:
+    void gatherFunctionsAndBlocks();
+    void findReachableBlocks(const FunctionInfo &function);
+    void findLiveFunctions();
+    void markResultIdsRemoved(size_t beginWord, size_t endWord);
+
+    // Transform instructions:
+    void transformInstruction();
+    bool skipRemovedFunction(const uint32_t *instruction);
+    bool skipRemovedBlock(const uint32_t *instruction);
+    TransformationState transformNameOrDecorate(const uint32_t *instruction);
+    TransformationState transformSelectionMerge(const uint32_t *instruction);
+    TransformationState transformBranchConditional(const uint32_t *instruction);
+    TransformationState transformPhi(const uint32_t *instruction);
+
+    BlockInfo &getBlock(spirv::IdRef label)
+    {
+        ASSERT(label < mBlockIndexById.size() && mBlockIndexById[label] < mBlocks.size());
+        return mBlocks[mBlockIndexById[label]];
+    }
+
+    std::vector<FunctionInfo> mFunctions;
+    std::vector<BlockInfo> mBlocks;
+    std::vector<spirv::IdRef> mEntryPoints;
+
+    // Per id, the index of the corresponding function or block, and whether it's a boolean
+    // constant.
+    static constexpr uint32_t kInvalidIndex = std::numeric_limits<uint32_t>::max();
+    std::vector<uint32_t> mFunctionIndexById;
+    std::vector<uint32_t> mBlockIndexById;
+    std::vector<bool> mIsConstantTrueById;
+    std::vector<bool> mIsConstantFalseById;
+
+    // Per id, whether the id was defined in code that is removed.
+    std::vector<bool> mIsRemovedById;
+
+    // The block currently being transformed.
+    const BlockInfo *mCurrentBlock = nullptr;
+};
+
+void SpirvDeadCodeRemover::transform()
+{
+    onTransformBegin();
+
+    gatherFunctionsAndBlocks();
+    for (const FunctionInfo &function : mFunctions)
+    {
+        findReachableBlocks(function);
+    }
+    findLiveFunctions();
+
+    while (mCurrentWord < mSpirvBlobIn.size())
+    {
+        transformInstruction();
+    }
+}
+
+void SpirvDeadCodeRemover::gatherFunctionsAndBlocks()
+{
+    const uint32_t indexBound = mSpirvBlobIn[spirv::kHeaderIndexIndexBound];
+
+    mFunctionIndexById.resize(indexBound, kInvalidIndex);
+    mBlockIndexById.resize(indexBound, kInvalidIndex);
+    mIsConstantTrueById.resize(indexBound, false);
+    mIsConstantFalseById.resize(indexBound, false);
+    mIsRemovedById.resize(indexBound, false);
+
+    FunctionInfo *function = nullptr;
+    BlockInfo *block       = nullptr;
+
+    size_t currentWord = spirv::kHeaderIndexInstructions;
+    while (currentWord < mSpirvBlobIn.size())
+    {
+        const uint32_t *instruction = &mSpirvBlobIn[currentWord];
+
+        spv::Op opCode;
+        uint32_t wordCount;
+        spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+        bool isTerminator = false;
+
+        switch (opCode)
+        {
+            case spv::OpEntryPoint:
+            {
+                spv::ExecutionModel executionModel;
+                spirv::IdRef entryPoint;
+                spirv::LiteralString name;
+                spirv::ParseEntryPoint(instruction, &executionModel, &entryPoint, &name, nullptr);
+                mEntryPoints.push_back(entryPoint);
+                break;
+            }
+            case spv::OpConstantTrue:
+            case spv::OpConstantFalse:
+            {
+                spirv::IdResultType typeId;
+                spirv::IdResult id;
+                if (opCode == spv::OpConstantTrue)
+                {
+                    spirv::ParseConstantTrue(instruction, &typeId, &id);
+                    mIsConstantTrueById[id] = true;
+                }
+                else
+                {
+                    spirv::ParseConstantFalse(instruction, &typeId, &id);
+                    mIsConstantFalseById[id] = true;
+                }
+                break;
+            }
+            case spv::OpFunction:
+            {
+                spirv::IdResultType typeId;
+                spirv::IdResult id;
+                spv::FunctionControlMask functionControl;
+                spirv::IdRef functionType;
+                spirv::ParseFunction(instruction, &typeId, &id, &functionControl, &functionType);
+
+                mFunctionIndexById[id] = static_cast<uint32_t>(mFunctions.size());
+                mFunctions.emplace_back();
+                function             = &mFunctions.back();
+                function->id         = id;
+                function->beginWord  = currentWord;
+                function->firstBlock = mBlocks.size();
+                break;
+            }
+            case spv::OpFunctionEnd:
+                ASSERT(function != nullptr && block == nullptr);
+                function->endWord    = currentWord + wordCount;
+                function->blockCount = mBlocks.size() - function->firstBlock;
+                function             = nullptr;
+                break;
+            case spv::OpLabel:
+            {
+                spirv::IdResult id;
+                spirv::ParseLabel(instruction, &id);
+
+                mBlockIndexById[id] = static_cast<uint32_t>(mBlocks.size());
+                mBlocks.emplace_back();
+                block            = &mBlocks.back();
+                block->label     = id;
+                block->beginWord = currentWord;
+                break;
+            }
+            case spv::OpSelectionMerge:
+            {
+                spv::SelectionControlMask selectionControl;
+                spirv::ParseSelectionMerge(instruction, &block->mergeBlock, &selectionControl);
+                block->mergeOp = opCode;
+                break;
+            }
+            case spv::OpLoopMerge:
+            {
+                spv::LoopControlMask loopControl;
+                spirv::ParseLoopMerge(instruction, &block->mergeBlock, &block->continueTarget,
+                                      &loopControl);
+                block->mergeOp = opCode;
+                break;
+            }
+            case spv::OpFunctionCall:
+            {
+                spirv::IdResultType typeId;
+                spirv::IdResult id;
+                spirv::IdRef callee;
+                spirv::ParseFunctionCall(instruction, &typeId, &id, &callee, nullptr);
+                block->callees.push_back(callee);
+                break;
+            }
+            case spv::OpBranch:
+            {
+                spirv::IdRef target;
+                spirv::ParseBranch(instruction, &target);
+                block->successors.push_back(target);
+                isTerminator = true;
+                break;
+            }
+            case spv::OpBranchConditional:
+            {
+                spirv::IdRef condition;
+                spirv::IdRef trueLabel;
+                spirv::IdRef falseLabel;
+                spirv::ParseBranchConditional(instruction, &condition, &trueLabel, &falseLabel,
+                                              nullptr);
+                block->successors.push_back(trueLabel);
+                block->successors.push_back(falseLabel);
+                if (mIsConstantTrueById[condition])
+                {
+                    block->constantBranchTarget = trueLabel;
+                }
+                else if (mIsConstantFalseById[condition])
+                {
+                    block->constantBranchTarget = falseLabel;
+                }
+                isTerminator = true;
+                break;
+            }
+            case spv::OpSwitch:
+            {
+                spirv::IdRef selector;
+                spirv::IdRef defaultLabel;
+                spirv::PairLiteralIntegerIdRefList targets;
+                spirv::ParseSwitch(instruction, &selector, &defaultLabel, &targets);
+                block->successors.push_back(defaultLabel);
+                for (const spirv::PairLiteralIntegerIdRef &target : targets)
+                {
+                    block->successors.push_back(target.id);
+                }
+                isTerminator = true;
+                break;
+            }
+            case spv::OpKill:
+            case spv::OpReturn:
+            case spv::OpReturnValue:
+            case spv::OpUnreachable:
+                isTerminator = true;
+                break;
+            default:
+                break;
+        }
+
+        currentWord += wordCount;
+
+        if (isTerminator)
+        {
+            ASSERT(block != nullptr);
+            block->endWord = currentWord;
+            block          = nullptr;
+        }
+    }
+}
+
+void SpirvDeadCodeRemover::findReachableBlocks(const FunctionInfo &function)
+{
+    ASSERT(function.blockCount > 0);
+
+    // Walk the CFG from the entry block, only following the taken target of constant branches.
+    std::vector<size_t> blocksToVisit = {function.firstBlock};
+    mBlocks[function.firstBlock].state = BlockState::Reachable;
+
+    while (!blocksToVisit.empty())
+    {
+        const BlockInfo &block = mBlocks[blocksToVisit.back()];
+        blocksToVisit.pop_back();
+
+        auto visitSuccessor = [&](spirv::IdRef target) {
+            BlockInfo &successor = getBlock(target);
+            if (successor.state != BlockState::Reachable)
+            {
+                successor.state = BlockState::Reachable;
+                blocksToVisit.push_back(mBlockIndexById[target]);
+            }
+        };
+
+        if (block.constantBranchTarget.valid())
+        {
+            visitSuccessor(block.constantBranchTarget);
+        }
+        else
+        {
+            for (spirv::IdRef target : block.successors)
+            {
+                visitSuccessor(target);
+            }
+        }
+    }
+
+    // Keep the merge blocks and continue targets of reachable constructs, even if they are
+    // unreachable themselves.  The OpSelectionMerge of a constant branch is removed, so its merge
+    // block is not needed.
+    for (size_t index = 0; index < function.blockCount; ++index)
+    {
+        BlockInfo &block = mBlocks[function.firstBlock + index];
+        if (block.state != BlockState::Reachable || block.mergeOp == spv::OpNop)
+        {
+            continue;
+        }
+
+        if (block.mergeOp == spv::OpLoopMerge)
+        {
+            BlockInfo &continueTarget = getBlock(block.continueTarget);
+            if (continueTarget.state == BlockState::Removed)
+            {
+                continueTarget.state      = BlockState::EmptyContinueTarget;
+                continueTarget.loopHeader = block.label;
+            }
+        }
+        else if (block.constantBranchTarget.valid())
+        {
+            continue;
+        }
+
+        BlockInfo &mergeBlock = getBlock(block.mergeBlock);
+        if (mergeBlock.state == BlockState::Removed)
+        {
+            mergeBlock.state = BlockState::EmptyMergeBlock;
+        }
+    }
+
+    // Remember the ids defined in the code that is removed, so their names and decorations can be
+    // removed too.
+    for (size_t index = 0; index < function.blockCount; ++index)
+    {
+        const BlockInfo &block = mBlocks[function.firstBlock + index];
+        switch (block.state)
+        {
+            case BlockState::Removed:
+                markResultIdsRemoved(block.beginWord, block.endWord);
+                break;
+            case BlockState::EmptyMergeBlock:
+            case BlockState::EmptyContinueTarget:
+                // The OpLabel remains.
+                markResultIdsRemoved(block.beginWord + 2, block.endWord);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void SpirvDeadCodeRemover::findLiveFunctions()
+{
+    // Functions are live if they are called from a reachable block of a live function.
+    std::vector<size_t> functionsToVisit;
+    for (spirv::IdRef entryPoint : mEntryPoints)
+    {
+        const uint32_t functionIndex = mFunctionIndexById[entryPoint];
+        ASSERT(functionIndex != kInvalidIndex);
+        if (!mFunctions[functionIndex].isLive)
+        {
+            mFunctions[functionIndex].isLive = true;
+            functionsToVisit.push_back(functionIndex);
+        }
+    }
+
+    while (!functionsToVisit.empty())
+    {
+        const FunctionInfo &function = mFunctions[functionsToVisit.back()];
+        functionsToVisit.pop_back();
+
+        for (size_t index = 0; index < function.blockCount; ++index)
+        {
+            const BlockInfo &block = mBlocks[function.firstBlock + index];
+            if (block.state != BlockState::Reachable)
+            {
+                continue;
+            }
+
+            for (spirv::IdRef callee : block.callees)
+            {
+                const uint32_t functionIndex = mFunctionIndexById[callee];
+                ASSERT(functionIndex != kInvalidIndex);
+                if (!mFunctions[functionIndex].isLive)
+                {
+                    mFunctions[functionIndex].isLive = true;
+                    functionsToVisit.push_back(functionIndex);
+                }
+            }
+        }
+    }
+
+    for (const FunctionInfo &function : mFunctions)
+    {
+        if (!function.isLive)
+        {
+            markResultIdsRemoved(function.beginWord, function.endWord);
+        }
+    }
+}
+
+void SpirvDeadCodeRemover::markResultIdsRemoved(size_t beginWord, size_t endWord)
+{
+    size_t currentWord = beginWord;
+    while (currentWord < endWord)
+    {
+        const uint32_t *instruction = &mSpirvBlobIn[currentWord];
+
+        spv::Op opCode;
+        uint32_t wordCount;
+        spirv::GetInstructionOpAndLength(instruction, &opCode, &wordCount);
+
+        const spirv::IdRef id = GetFunctionInstructionResultId(instruction);
+        if (id.valid())
+        {
+            ASSERT(id < mIsRemovedById.size());
+            mIsRemovedById[id] = true;
+        }
+
+        currentWord += wordCount;
+    }
+}
+
+void SpirvDeadCodeRemover::transformInstruction()
+{
+    uint32_t wordCount;
+    spv::Op opCode;
+    const uint32_t *instruction = getCurrentInstruction(&opCode, &wordCount);
+
+    if (opCode == spv::OpFunction)
+    {
+        // SPIR-V is structured in sections.  Function declarations come last.
+        mIsInFunctionSection = true;
+    }
+
+    // Only look at interesting instructions.
+    TransformationState transformationState = TransformationState::Unchanged;
+
+    if (mIsInFunctionSection)
+    {
+        // Look at in-function opcodes.
+        switch (opCode)
+        {
+            case spv::OpFunction:
+                if (skipRemovedFunction(instruction))
+                {
+                    return;
+                }
+                break;
+            case spv::OpLabel:
+                if (skipRemovedBlock(instruction))
+                {
+                    return;
+                }
+                break;
+            case spv::OpSelectionMerge:
+                transformationState = transformSelectionMerge(instruction);
+                break;
+            case spv::OpBranchConditional:
+                transformationState = transformBranchConditional(instruction);
+                break;
+            case spv::OpPhi:
+                transformationState = transformPhi(instruction);
+                break;
+            default:
+                break;
+        }
+    }
+    else
+    {
+        // Look at global declaration opcodes.
+        switch (opCode)
+        {
+            case spv::OpName:
+            case spv::OpDecorate:
+                transformationState = transformNameOrDecorate(instruction);
+                break;
+            default:
+                break;
+        }
+    }
+
+    // If the instruction was not transformed, copy it to output as is.
+    if (transformationState == TransformationState::Unchanged)
+    {
+        copyInstruction(instruction, wordCount);
+    }
+
+    // Advance to next instruction.
+    mCurrentWord += wordCount;
+}
+
+TransformationState SpirvDeadCodeRemover::transformNameOrDecorate(const uint32_t *instruction)
+{
+    // Both OpName and OpDecorate take the target id as the first operand.
+    const spirv::IdRef target(instruction[1]);
+    ASSERT(target < mIsRemovedById.size());
+    return mIsRemovedById[target] ? TransformationState::Transformed
+                                  : TransformationState::Unchanged;
+}
+
+bool SpirvDeadCodeRemover::skipRemovedFunction(const uint32_t *instruction)
+{
+    spirv::IdResultType typeId;
+    spirv::IdResult id;
+    spv::FunctionControlMask functionControl;
+    spirv::IdRef functionType;
+    spirv::ParseFunction(instruction, &typeId, &id, &functionControl, &functionType);
+
+    const FunctionInfo &function = mFunctions[mFunctionIndexById[id]];
+    if (function.isLive)
+    {
+        return false;
+    }
+
+    mCurrentWord = function.endWord;
+    return true;
+}
+
+bool SpirvDeadCodeRemover::skipRemovedBlock(const uint32_t *instruction)
+{
+    spirv::IdResult id;
+    spirv::ParseLabel(instruction, &id);
+
+    const BlockInfo &block = getBlock(id);
+    mCurrentBlock          = &block;
+
+    switch (block.state)
+    {
+        case BlockState::Reachable:
+            return false;
+        case BlockState::EmptyMergeBlock:
+            spirv::WriteLabel(mSpirvBlobOut, id);
+            spirv::WriteUnreachable(mSpirvBlobOut);
+            break;
+        case BlockState::EmptyContinueTarget:
+            spirv::WriteLabel(mSpirvBlobOut, id);
+            spirv::WriteBranch(mSpirvBlobOut, block.loopHeader);
+            break;
+        default:
+            break;
+    }
+
+    mCurrentWord = block.endWord;
+    return true;
+}
+
+TransformationState SpirvDeadCodeRemover::transformSelectionMerge(const uint32_t *instruction)
+{
+    // A selection construct whose branch is constant is no longer a construct.
+    ASSERT(mCurrentBlock != nullptr);
+    return mCurrentBlock->constantBranchTarget.valid() ? TransformationState::Transformed
+                                                       : TransformationState::Unchanged;
+}
+
+TransformationState SpirvDeadCodeRemover::transformBranchConditional(const uint32_t *instruction)
+{
+    ASSERT(mCurrentBlock != nullptr);
+    if (!mCurrentBlock->constantBranchTarget.valid())
+    {
+        return TransformationState::Unchanged;
+    }
+
+    spirv::WriteBranch(mSpirvBlobOut, mCurrentBlock->constantBranchTarget);
+    return TransformationState::Transformed;
+}
+
+TransformationState SpirvDeadCodeRemover::transformPhi(const uint32_t *instruction)
+{
+    spirv::IdResultType typeId;
+    spirv::IdResult id;
+    spirv::PairIdRefIdRefList variableParentPairs;
+    spirv::ParsePhi(instruction, &typeId, &id, &variableParentPairs);
+
+    // Remove the incoming values from parents that are no longer predecessors of this block.  The
+    // translator only generates OpPhi in the merge block of selection constructs, so a parent is
+    // either reachable or removed.
+    size_t writeIndex = 0;
+    for (size_t index = 0; index < variableParentPairs.size(); ++index)
+    {
+        const spirv::PairIdRefIdRef &variableParent = variableParentPairs[index];
+        const BlockInfo &parent                     = getBlock(variableParent.id2);
+        if (parent.state != BlockState::Reachable)
+        {
+            continue;
+        }
+        if (parent.constantBranchTarget.valid() &&
+            parent.constantBranchTarget != mCurrentBlock->label)
+        {
+            continue;
+        }
+        variableParentPairs[writeIndex++] = variableParent;
+    }
+
+    if (writeIndex == variableParentPairs.size())
+    {
+        return TransformationState::Unchanged;
+    }
+
+    ASSERT(writeIndex > 0);
+    variableParentPairs.resize_down(writeIndex);
+    spirv::WritePhi(mSpirvBlobOut, typeId, id, variableParentPairs);
+    return TransformationState::Transformed;
+}
 }  // anonymous namespace
 
 SpvSourceOptions SpvCreateSourceOptions(const angle::FeaturesVk &features,
@@ -5635,6 +6321,14 @@ angle::Result SpvTransformSpirvCode(const SpvTransformOptions &options,
         aliasingTransformer.transform();
     }
 
+    // Finally, remove code that can never execute.
+    if (options.removeDeadCode)
+    {
+        spirv::Blob preTransformBlob = std::move(*spirvBlobOut);
+        SpirvDeadCodeRemover deadCodeRemover(preTransformBlob, variableInfoMap, spirvBlobOut);
+        deadCodeRemover.transform();
+    }
+
     spirvBlobOut->shrink_to_fit();
 
     if (options.validate)
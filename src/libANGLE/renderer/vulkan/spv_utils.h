@@ -53,8 +53,21 @@ struct SpvTransformOptions
     bool validate                       = true;
     bool useSpirvVaryingPrecisionFixer  = false;
     bool removeDepthStencilInput        = false;
+    bool removeDeadCode                 = false;
 };
 
+ANGLE_INLINE bool operator==(const SpvTransformOptions &a, const SpvTransformOptions &b)
+{
+    return a.shaderType == b.shaderType && a.isLastPreFragmentStage == b.isLastPreFragmentStage &&
+           a.isTransformFeedbackStage == b.isTransformFeedbackStage &&
+           a.isTransformFeedbackEmulated == b.isTransformFeedbackEmulated &&
+           a.isMultisampledFramebufferFetch == b.isMultisampledFramebufferFetch &&
+           a.enableSampleShading == b.enableSampleShading && a.validate == b.validate &&
+           a.useSpirvVaryingPrecisionFixer == b.useSpirvVaryingPrecisionFixer &&
+           a.removeDepthStencilInput == b.removeDepthStencilInput &&
+           a.removeDeadCode == b.removeDeadCode;
+}
+
 struct ShaderInterfaceVariableXfbInfo
 {
     static constexpr uint32_t kInvalid = std::numeric_limits<uint32_t>::max();
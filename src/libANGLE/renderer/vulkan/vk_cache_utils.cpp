@@ -1605,6 +1605,11 @@ void InitializeSpecializationInfo(
                     offsetof(vk::SpecializationConstants, dither);
                 (*specializationEntriesOut)[id].size = sizeof(specConsts.dither);
                 break;
+            case sh::vk::SpecializationConstantId::Flip:
+                (*specializationEntriesOut)[id].offset =
+                    offsetof(vk::SpecializationConstants, flip);
+                (*specializationEntriesOut)[id].size = sizeof(specConsts.flip);
+                break;
             default:
                 UNREACHABLE();
                 break;
@@ -1738,6 +1743,7 @@ enum class PipelineState
     DstAlphaBlendFactor   = SrcAlphaBlendFactor + gl::IMPLEMENTATION_MAX_DRAW_BUFFERS,
     AlphaBlendOp          = DstAlphaBlendFactor + gl::IMPLEMENTATION_MAX_DRAW_BUFFERS,
     EmulatedDitherControl = AlphaBlendOp + gl::IMPLEMENTATION_MAX_DRAW_BUFFERS,
+    Flip,
     DepthClampEnable,
     DepthBoundsTest,
     DepthCompareOp,
@@ -1834,6 +1840,9 @@ using PipelineStateBitSet   = angle::BitSetArray<angle::EnumSize<PipelineState>(
         (*valuesOut)[PipelineState::StencilOpPassBack]       = shaders.back.pass;
         (*valuesOut)[PipelineState::StencilOpDepthFailBack]  = shaders.back.depthFail;
         (*valuesOut)[PipelineState::StencilCompareBack]      = shaders.back.compare;
+
+        (*valuesOut)[PipelineState::Flip] =
+            shaders.flip.flipX | shaders.flip.flipY << 1 | shaders.flip.invertViewport << 2;
     }
 
     if (hasShadersOrFragmentOutput)
@@ -2055,6 +2064,7 @@ PipelineState GetPipelineState(size_t stateIndex, bool *isRangedOut, size_t *sub
         {PipelineState::DstAlphaBlendFactor, "dst_alpha_blend"},
         {PipelineState::AlphaBlendOp, "alpha_blend"},
         {PipelineState::EmulatedDitherControl, "dither"},
+        {PipelineState::Flip, "flip"},
         {PipelineState::DepthClampEnable, "depth_clamp"},
         {PipelineState::DepthBoundsTest, "depth_bounds_test"},
         {PipelineState::DepthCompareOp, "depth_compare"},
@@ -2428,6 +2438,7 @@ PipelineState GetPipelineState(size_t stateIndex, bool *isRangedOut, size_t *sub
         case PipelineState::BlendEnableMask:
         case PipelineState::MissingOutputsMask:
         case PipelineState::EmulatedDitherControl:
+        case PipelineState::Flip:
             out << "=0x" << std::hex << state << std::dec;
             break;
 
@@ -2485,6 +2496,7 @@ PipelineState GetPipelineState(size_t stateIndex, bool *isRangedOut, size_t *sub
         {PipelineState::DepthCompareOp, hasShaders ? VK_COMPARE_OP_LESS : 0},
         {PipelineState::SurfaceRotation, 0},
         {PipelineState::EmulatedDitherControl, 0},
+        {PipelineState::Flip, 0},
         {PipelineState::StencilOpFailFront, hasShaders ? VK_STENCIL_OP_KEEP : 0},
         {PipelineState::StencilOpPassFront, hasShaders ? VK_STENCIL_OP_KEEP : 0},
         {PipelineState::StencilOpDepthFailFront, hasShaders ? VK_STENCIL_OP_KEEP : 0},
@@ -3367,7 +3379,10 @@ void GraphicsPipelineDesc::initDefaults(const Context *context,
         SetBitField(mShaders.shaders.bits.depthCompareOp, VK_COMPARE_OP_LESS);
         mShaders.shaders.bits.surfaceRotation  = 0;
         mShaders.shaders.emulatedDitherControl = 0;
-        mShaders.shaders.padding               = 0;
+        mShaders.shaders.flip.flipX            = 0;
+        mShaders.shaders.flip.flipY            = 0;
+        mShaders.shaders.flip.invertViewport   = 0;
+        mShaders.shaders.flip.padding          = 0;
         SetBitField(mShaders.shaders.front.fail, VK_STENCIL_OP_KEEP);
         SetBitField(mShaders.shaders.front.pass, VK_STENCIL_OP_KEEP);
         SetBitField(mShaders.shaders.front.depthFail, VK_STENCIL_OP_KEEP);
@@ -4186,6 +4201,10 @@ void GraphicsPipelineDesc::initializePipelineFragmentOutputState(
     {
         dynamicStateListOut->push_back(VK_DYNAMIC_STATE_LOGIC_OP_EXT);
     }
+    if (context->getFeatures().useColorBlendEquationDynamicState.enabled)
+    {
+        dynamicStateListOut->push_back(VK_DYNAMIC_STATE_COLOR_BLEND_EQUATION_EXT);
+    }
 }
 
 void GraphicsPipelineDesc::updateVertexInput(ContextVk *contextVk,
@@ -4410,20 +4429,44 @@ void GraphicsPipelineDesc::updateBlendEnabled(GraphicsPipelineTransitionBits *tr
     transition->set(ANGLE_GET_TRANSITION_BIT(mFragmentOutput.blendMaskAndLogic.bits));
 }
 
-void GraphicsPipelineDesc::updateBlendEquations(GraphicsPipelineTransitionBits *transition,
+void GraphicsPipelineDesc::updateBlendEquations(Context *context,
+                                                GraphicsPipelineTransitionBits *transition,
                                                 const gl::BlendStateExt &blendStateExt,
                                                 gl::DrawBufferMask attachmentMask)
 {
     constexpr size_t kSizeBits = sizeof(PackedColorBlendAttachmentState) * 8;
 
+    // When advanced blend is emulated, the equation is passed to the shader through the driver
+    // uniforms and blending is disabled in the pipeline.  All advanced equations are then packed
+    // the same, so that switching between them does not change the pipeline.
+    const bool emulateAdvancedBlend =
+        !context->getFeatures().supportsBlendOperationAdvanced.enabled;
+    constexpr uint8_t kEmulatedAdvancedBlendOp =
+        static_cast<uint8_t>(VK_BLEND_OP_MULTIPLY_EXT - VK_BLEND_OP_ZERO_EXT);
+
     for (size_t attachmentIndex : attachmentMask)
     {
         PackedColorBlendAttachmentState &blendAttachmentState =
             mFragmentOutput.blend.attachments[attachmentIndex];
-        blendAttachmentState.colorBlendOp =
+
+        uint8_t colorBlendOp =
             PackGLBlendOp(blendStateExt.getEquationColorIndexed(attachmentIndex));
-        blendAttachmentState.alphaBlendOp =
+        uint8_t alphaBlendOp =
             PackGLBlendOp(blendStateExt.getEquationAlphaIndexed(attachmentIndex));
+        if (emulateAdvancedBlend && colorBlendOp > static_cast<uint8_t>(VK_BLEND_OP_MAX))
+        {
+            colorBlendOp = kEmulatedAdvancedBlendOp;
+            alphaBlendOp = kEmulatedAdvancedBlendOp;
+        }
+
+        if (blendAttachmentState.colorBlendOp == colorBlendOp &&
+            blendAttachmentState.alphaBlendOp == alphaBlendOp)
+        {
+            continue;
+        }
+
+        SetBitField(blendAttachmentState.colorBlendOp, colorBlendOp);
+        SetBitField(blendAttachmentState.alphaBlendOp, alphaBlendOp);
         transition->set(ANGLE_GET_INDEXED_TRANSITION_BIT(mFragmentOutput.blend.attachments,
                                                          attachmentIndex, kSizeBits));
     }
@@ -4451,7 +4494,8 @@ void GraphicsPipelineDesc::updateBlendFuncs(GraphicsPipelineTransitionBits *tran
     }
 }
 
-void GraphicsPipelineDesc::resetBlendFuncsAndEquations(GraphicsPipelineTransitionBits *transition,
+void GraphicsPipelineDesc::resetBlendFuncsAndEquations(Context *context,
+                                                       GraphicsPipelineTransitionBits *transition,
                                                        const gl::BlendStateExt &blendStateExt,
                                                        gl::DrawBufferMask previousAttachmentsMask,
                                                        gl::DrawBufferMask newAttachmentsMask)
@@ -4482,9 +4526,65 @@ void GraphicsPipelineDesc::resetBlendFuncsAndEquations(GraphicsPipelineTransitio
 
     if (attachmentsToAdd.any())
     {
-        updateBlendFuncs(transition, blendStateExt, attachmentsToAdd);
-        updateBlendEquations(transition, blendStateExt, attachmentsToAdd);
+        // With the ColorBlendEquation dynamic state, the blend funcs are always left at their
+        // defaults so they don't affect the pipeline key.
+        if (!context->getFeatures().useColorBlendEquationDynamicState.enabled)
+        {
+            updateBlendFuncs(transition, blendStateExt, attachmentsToAdd);
+        }
+        updateBlendEquations(context, transition, blendStateExt, attachmentsToAdd);
+    }
+}
+
+uint32_t GraphicsPipelineDesc::getColorBlendEquations(
+    Context *context,
+    const gl::BlendStateExt *blendStateExt,
+    gl::DrawBuffersArray<VkColorBlendEquationEXT> *equationsOut) const
+{
+    const RenderPassDesc &renderPass = mSharedNonVertexInput.renderPass;
+
+    // Same attachment indexing as initializePipelineFragmentOutputState.
+    uint32_t colorAttachmentIndex = 0;
+    for (uint32_t colorIndexGL = 0; colorIndexGL < renderPass.colorAttachmentRange();
+         ++colorIndexGL)
+    {
+        if (context->getFeatures().preferDynamicRendering.enabled &&
+            !renderPass.isColorAttachmentEnabled(colorIndexGL))
+        {
+            continue;
+        }
+
+        PackedColorBlendAttachmentState packedState =
+            mFragmentOutput.blend.attachments[colorIndexGL];
+        if (blendStateExt != nullptr)
+        {
+            packedState.srcColorBlendFactor =
+                PackGLBlendFactor(blendStateExt->getSrcColorIndexed(colorIndexGL));
+            packedState.dstColorBlendFactor =
+                PackGLBlendFactor(blendStateExt->getDstColorIndexed(colorIndexGL));
+            packedState.srcAlphaBlendFactor =
+                PackGLBlendFactor(blendStateExt->getSrcAlphaIndexed(colorIndexGL));
+            packedState.dstAlphaBlendFactor =
+                PackGLBlendFactor(blendStateExt->getDstAlphaIndexed(colorIndexGL));
+        }
+
+        VkPipelineColorBlendAttachmentState state = {};
+        UnpackBlendAttachmentState(packedState, &state);
+
+        // Advanced blend equations are emulated with blending disabled in the pipeline, but the
+        // dynamic state must still be a valid non-advanced equation.
+        const bool isAdvanced = packedState.colorBlendOp > static_cast<uint8_t>(VK_BLEND_OP_MAX);
+
+        VkColorBlendEquationEXT &equation = (*equationsOut)[colorAttachmentIndex++];
+        equation.srcColorBlendFactor      = state.srcColorBlendFactor;
+        equation.dstColorBlendFactor      = state.dstColorBlendFactor;
+        equation.colorBlendOp             = isAdvanced ? VK_BLEND_OP_ADD : state.colorBlendOp;
+        equation.srcAlphaBlendFactor      = state.srcAlphaBlendFactor;
+        equation.dstAlphaBlendFactor      = state.dstAlphaBlendFactor;
+        equation.alphaBlendOp             = isAdvanced ? VK_BLEND_OP_ADD : state.alphaBlendOp;
     }
+
+    return colorAttachmentIndex;
 }
 
 void GraphicsPipelineDesc::setColorWriteMasks(gl::BlendStateExt::ColorMaskStorage::Type colorMasks,
@@ -4753,6 +4853,17 @@ void GraphicsPipelineDesc::updateEmulatedDitherControl(GraphicsPipelineTransitio
     transition->set(ANGLE_GET_TRANSITION_BIT(mShaders.shaders.emulatedDitherControl));
 }
 
+void GraphicsPipelineDesc::updateFlip(GraphicsPipelineTransitionBits *transition,
+                                      bool flipX,
+                                      bool flipY,
+                                      bool invertViewport)
+{
+    SetBitField(mShaders.shaders.flip.flipX, flipX);
+    SetBitField(mShaders.shaders.flip.flipY, flipY);
+    SetBitField(mShaders.shaders.flip.invertViewport, invertViewport);
+    transition->set(ANGLE_GET_TRANSITION_BIT(mShaders.shaders.flip));
+}
+
 void GraphicsPipelineDesc::updateNonZeroStencilWriteMaskWorkaround(
     GraphicsPipelineTransitionBits *transition,
     bool enabled)
@@ -5176,27 +5287,56 @@ angle::Result PipelineHelper::getPreferredPipeline(ContextVk *contextVk,
         }
         else if (mMonolithicPipelineCreationTask.isReady())
         {
-            CreateMonolithicPipelineTask *task = &*mMonolithicPipelineCreationTask.getTask();
-            ANGLE_VK_TRY(contextVk, task->getResult());
+            ANGLE_TRY(onMonolithicPipelineCreated(contextVk));
+        }
+    }
 
-            mMonolithicCacheLookUpFeedback = task->getFeedback();
+    *pipelineOut = &mPipeline;
 
-            // The pipeline will not be used anymore.  Every context that has used this pipeline has
-            // already updated the serial.
-            mLinkedPipelineToRelease = std::move(mPipeline);
+    return angle::Result::Continue;
+}
 
-            // Replace it with the monolithic one.
-            mPipeline = std::move(task->getPipeline());
+angle::Result PipelineHelper::waitForPendingCreation(ContextVk *contextVk)
+{
+    ASSERT(isCreationPending());
 
-            mLinkedShaders = nullptr;
+    if (mMonolithicPipelineCreationTask.isPosted())
+    {
+        mMonolithicPipelineCreationTask.wait();
+    }
+    else
+    {
+        // The task was never scheduled (the share group paces these tasks), so run it right here.
+        const RenderPass *compatibleRenderPass = nullptr;
+        ANGLE_TRY(contextVk->getCompatibleRenderPass(
+            mMonolithicPipelineCreationTask.getTask()->getRenderPassDesc(), &compatibleRenderPass));
+        mMonolithicPipelineCreationTask.setRenderPass(compatibleRenderPass);
+        (*mMonolithicPipelineCreationTask.getTask())();
+    }
 
-            mMonolithicPipelineCreationTask.reset();
+    return onMonolithicPipelineCreated(contextVk);
+}
 
-            ++contextVk->getPerfCounters().monolithicPipelineCreation;
-        }
-    }
+angle::Result PipelineHelper::onMonolithicPipelineCreated(ContextVk *contextVk)
+{
+    CreateMonolithicPipelineTask *task = &*mMonolithicPipelineCreationTask.getTask();
+    ANGLE_VK_TRY(contextVk, task->getResult());
 
-    *pipelineOut = &mPipeline;
+    mMonolithicCacheLookUpFeedback = task->getFeedback();
+
+    // The pipeline will not be used anymore.  Every context that has used this pipeline has
+    // already updated the serial.  If the pipeline creation was deferred, there is no such
+    // pipeline.
+    mLinkedPipelineToRelease = std::move(mPipeline);
+
+    // Replace it with the monolithic one.
+    mPipeline = std::move(task->getPipeline());
+
+    mLinkedShaders = nullptr;
+
+    mMonolithicPipelineCreationTask.reset();
+
+    ++contextVk->getPerfCounters().monolithicPipelineCreation;
 
     return angle::Result::Continue;
 }
@@ -6439,6 +6579,7 @@ void DescriptorSetDescBuilder::setEmptyBuffer(uint32_t infoDescIndex,
 
 template <typename CommandBufferT>
 void DescriptorSetDescBuilder::updateOneShaderBuffer(
+    Context *context,
     CommandBufferT *commandBufferHelper,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
     const gl::BufferVector &buffers,
@@ -6486,8 +6627,8 @@ void DescriptorSetDescBuilder::updateOneShaderBuffer(
                                  descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
     if (isUniformBuffer)
     {
-        commandBufferHelper->bufferRead(VK_ACCESS_UNIFORM_READ_BIT, block.activeShaders(),
-                                        &bufferHelper);
+        commandBufferHelper->bufferRead(context, VK_ACCESS_UNIFORM_READ_BIT,
+                                        block.activeShaders(), &bufferHelper);
     }
     else
     {
@@ -6499,8 +6640,8 @@ void DescriptorSetDescBuilder::updateOneShaderBuffer(
             // marked read-only.  This also helps BufferVk make better decisions during
             // buffer data uploads and copies by knowing that the buffers are not actually
             // being written to.
-            commandBufferHelper->bufferRead(VK_ACCESS_SHADER_READ_BIT, block.activeShaders(),
-                                            &bufferHelper);
+            commandBufferHelper->bufferRead(context, VK_ACCESS_SHADER_READ_BIT,
+                                            block.activeShaders(), &bufferHelper);
         }
         else if ((bufferHelper.getCurrentWriteAccess() & VK_ACCESS_SHADER_WRITE_BIT) != 0 &&
                  (memoryBarrierBits & kBufferMemoryBarrierBits) == 0)
@@ -6515,6 +6656,7 @@ void DescriptorSetDescBuilder::updateOneShaderBuffer(
             // write. This is to ensure we do not break the existing usage even if we think they are
             // out of spec.
             commandBufferHelper->retainResourceForWrite(&bufferHelper);
+            bufferHelper.releaseCurrentWriteEvent(context);
         }
         else
         {
@@ -6523,7 +6665,8 @@ void DescriptorSetDescBuilder::updateOneShaderBuffer(
             for (const gl::ShaderType shaderType : block.activeShaders())
             {
                 const vk::PipelineStage pipelineStage = vk::GetPipelineStage(shaderType);
-                commandBufferHelper->bufferWrite(accessFlags, pipelineStage, &bufferHelper);
+                commandBufferHelper->bufferWrite(context, accessFlags, pipelineStage,
+                                                 &bufferHelper);
             }
         }
     }
@@ -6549,6 +6692,7 @@ void DescriptorSetDescBuilder::updateOneShaderBuffer(
 
 template <typename CommandBufferT>
 void DescriptorSetDescBuilder::updateShaderBuffers(
+    Context *context,
     CommandBufferT *commandBufferHelper,
     const gl::ProgramExecutable &executable,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -6569,14 +6713,15 @@ void DescriptorSetDescBuilder::updateShaderBuffers(
         const GLuint binding = isUniformBuffer
                                    ? executable.getUniformBlockBinding(blockIndex)
                                    : executable.getShaderStorageBlockBinding(blockIndex);
-        updateOneShaderBuffer(commandBufferHelper, variableInfoMap, buffers, blocks[blockIndex],
-                              binding, descriptorType, maxBoundBufferRange, emptyBuffer,
-                              writeDescriptorDescs, memoryBarrierBits);
+        updateOneShaderBuffer(context, commandBufferHelper, variableInfoMap, buffers,
+                              blocks[blockIndex], binding, descriptorType, maxBoundBufferRange,
+                              emptyBuffer, writeDescriptorDescs, memoryBarrierBits);
     }
 }
 
 template <typename CommandBufferT>
 void DescriptorSetDescBuilder::updateAtomicCounters(
+    Context *context,
     CommandBufferT *commandBufferHelper,
     const gl::ProgramExecutable &executable,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -6627,7 +6772,8 @@ void DescriptorSetDescBuilder::updateAtomicCounters(
         for (const gl::ShaderType shaderType : atomicCounterBuffer.activeShaders())
         {
             const vk::PipelineStage pipelineStage = vk::GetPipelineStage(shaderType);
-            commandBufferHelper->bufferWrite(VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
+            commandBufferHelper->bufferWrite(context,
+                                             VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT,
                                              pipelineStage, &bufferHelper);
         }
 
@@ -6652,6 +6798,7 @@ void DescriptorSetDescBuilder::updateAtomicCounters(
 
 // Explicit instantiation
 template void DescriptorSetDescBuilder::updateOneShaderBuffer<vk::RenderPassCommandBufferHelper>(
+    Context *context,
     RenderPassCommandBufferHelper *commandBufferHelper,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
     const gl::BufferVector &buffers,
@@ -6664,6 +6811,7 @@ template void DescriptorSetDescBuilder::updateOneShaderBuffer<vk::RenderPassComm
     const GLbitfield memoryBarrierBits);
 
 template void DescriptorSetDescBuilder::updateOneShaderBuffer<OutsideRenderPassCommandBufferHelper>(
+    Context *context,
     OutsideRenderPassCommandBufferHelper *commandBufferHelper,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
     const gl::BufferVector &buffers,
@@ -6676,6 +6824,7 @@ template void DescriptorSetDescBuilder::updateOneShaderBuffer<OutsideRenderPassC
     const GLbitfield memoryBarrierBits);
 
 template void DescriptorSetDescBuilder::updateShaderBuffers<OutsideRenderPassCommandBufferHelper>(
+    Context *context,
     OutsideRenderPassCommandBufferHelper *commandBufferHelper,
     const gl::ProgramExecutable &executable,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -6688,6 +6837,7 @@ template void DescriptorSetDescBuilder::updateShaderBuffers<OutsideRenderPassCom
     const GLbitfield memoryBarrierBits);
 
 template void DescriptorSetDescBuilder::updateShaderBuffers<RenderPassCommandBufferHelper>(
+    Context *context,
     RenderPassCommandBufferHelper *commandBufferHelper,
     const gl::ProgramExecutable &executable,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -6700,6 +6850,7 @@ template void DescriptorSetDescBuilder::updateShaderBuffers<RenderPassCommandBuf
     const GLbitfield memoryBarrierBits);
 
 template void DescriptorSetDescBuilder::updateAtomicCounters<OutsideRenderPassCommandBufferHelper>(
+    Context *context,
     OutsideRenderPassCommandBufferHelper *commandBufferHelper,
     const gl::ProgramExecutable &executable,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -6710,6 +6861,7 @@ template void DescriptorSetDescBuilder::updateAtomicCounters<OutsideRenderPassCo
     const WriteDescriptorDescs &writeDescriptorDescs);
 
 template void DescriptorSetDescBuilder::updateAtomicCounters<RenderPassCommandBufferHelper>(
+    Context *context,
     RenderPassCommandBufferHelper *commandBufferHelper,
     const gl::ProgramExecutable &executable,
     const ShaderInterfaceVariableInfoMap &variableInfoMap,
@@ -8053,6 +8205,50 @@ void GraphicsPipelineCache<Hash>::addToCache(PipelineSource source,
     *pipelineOut      = &insertedItem.first->second;
 }
 
+template <typename Hash>
+void GraphicsPipelineCache<Hash>::addPendingPipeline(const vk::GraphicsPipelineDesc &desc,
+                                                     const vk::GraphicsPipelineDesc **descPtrOut,
+                                                     vk::PipelineHelper **pipelineOut)
+{
+    addToCache(PipelineSource::Draw, desc, vk::Pipeline(), vk::CacheLookUpFeedback::None,
+               descPtrOut, pipelineOut);
+}
+
+template <typename Hash>
+vk::PipelineHelper *GraphicsPipelineCache<Hash>::getCompatiblePipeline(
+    const vk::GraphicsPipelineDesc &desc)
+{
+    // A pipeline can stand in for another pipeline of the same program if it has identical vertex
+    // input state and is compatible with the same render pass.  Among those, prefer the one that
+    // additionally matches the fragment output state (blend, etc), and then the one that matches
+    // the rest of the state (rasterization, depth/stencil, etc).
+    vk::PipelineHelper *bestPipeline = nullptr;
+    int bestScore                    = -1;
+    for (auto &item : mPayload)
+    {
+        const vk::GraphicsPipelineDesc &candidateDesc = item.first;
+        vk::PipelineHelper &candidate                 = item.second;
+
+        if (!candidate.valid() ||
+            !candidateDesc.keyEqual(desc, vk::GraphicsPipelineSubset::VertexInput) ||
+            !(candidateDesc.getRenderPassDesc() == desc.getRenderPassDesc()))
+        {
+            continue;
+        }
+
+        const int score =
+            (candidateDesc.keyEqual(desc, vk::GraphicsPipelineSubset::FragmentOutput) ? 2 : 0) +
+            (candidateDesc.keyEqual(desc, vk::GraphicsPipelineSubset::Shaders) ? 1 : 0);
+        if (score > bestScore)
+        {
+            bestPipeline = &candidate;
+            bestScore    = score;
+        }
+    }
+
+    return bestPipeline;
+}
+
 template <typename Hash>
 void GraphicsPipelineCache<Hash>::populate(const vk::GraphicsPipelineDesc &desc,
                                            vk::Pipeline &&pipeline,
@@ -8108,6 +8304,13 @@ template void GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::populate(
     const vk::GraphicsPipelineDesc &desc,
     vk::Pipeline &&pipeline,
     vk::PipelineHelper **pipelineHelperOut);
+template void GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::addPendingPipeline(
+    const vk::GraphicsPipelineDesc &desc,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut);
+template vk::PipelineHelper *
+GraphicsPipelineCache<GraphicsPipelineDescCompleteHash>::getCompatiblePipeline(
+    const vk::GraphicsPipelineDesc &desc);
 
 template void GraphicsPipelineCache<GraphicsPipelineDescVertexInputHash>::destroy(
     vk::Context *context);
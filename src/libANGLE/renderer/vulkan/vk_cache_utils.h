@@ -610,7 +610,14 @@ struct PackedPreRasterizationAndFragmentStates final
     static_assert(gl::IMPLEMENTATION_MAX_DRAW_BUFFERS <= 8,
                   "2 bits per draw buffer is needed for dither emulation");
     uint16_t emulatedDitherControl;
-    uint16_t padding;
+    // Only used with the bakeFlipInSpecConst feature.  See vk::MakeFlipUniform.
+    struct
+    {
+        uint16_t flipX : 1;
+        uint16_t flipY : 1;
+        uint16_t invertViewport : 1;
+        uint16_t padding : 13;
+    } flip;
 
     // Affecting VkPipelineDepthStencilStateCreateInfo
     // Dynamic in VK_EXT_extended_dynamic_state
@@ -936,13 +943,22 @@ class GraphicsPipelineDesc final
     void updateBlendFuncs(GraphicsPipelineTransitionBits *transition,
                           const gl::BlendStateExt &blendStateExt,
                           gl::DrawBufferMask attachmentMask);
-    void updateBlendEquations(GraphicsPipelineTransitionBits *transition,
+    void updateBlendEquations(Context *context,
+                              GraphicsPipelineTransitionBits *transition,
                               const gl::BlendStateExt &blendStateExt,
                               gl::DrawBufferMask attachmentMask);
-    void resetBlendFuncsAndEquations(GraphicsPipelineTransitionBits *transition,
+    void resetBlendFuncsAndEquations(Context *context,
+                                     GraphicsPipelineTransitionBits *transition,
                                      const gl::BlendStateExt &blendStateExt,
                                      gl::DrawBufferMask previousAttachmentsMask,
                                      gl::DrawBufferMask newAttachmentsMask);
+    // For the ColorBlendEquation dynamic state, returns the blend equations in the order of the
+    // pipeline's color blend attachments.  The blend factors come from |blendStateExt| if given,
+    // and from this description otherwise.
+    uint32_t getColorBlendEquations(
+        Context *context,
+        const gl::BlendStateExt *blendStateExt,
+        gl::DrawBuffersArray<VkColorBlendEquationEXT> *equationsOut) const;
     void setColorWriteMasks(gl::BlendStateExt::ColorMaskStorage::Type colorMasks,
                             const gl::DrawBufferMask &alphaMask,
                             const gl::DrawBufferMask &enabledDrawBuffers);
@@ -1010,6 +1026,16 @@ class GraphicsPipelineDesc final
     void updateEmulatedDitherControl(GraphicsPipelineTransitionBits *transition, uint16_t value);
     uint32_t getEmulatedDitherControl() const { return mShaders.shaders.emulatedDitherControl; }
 
+    void updateFlip(GraphicsPipelineTransitionBits *transition,
+                    bool flipX,
+                    bool flipY,
+                    bool invertViewport);
+    uint32_t getFlipUniform() const
+    {
+        return MakeFlipUniform(mShaders.shaders.flip.flipX, mShaders.shaders.flip.flipY,
+                               mShaders.shaders.flip.invertViewport);
+    }
+
     bool isLegacyDitherEnabled() const
     {
         return mSharedNonVertexInput.renderPass.isLegacyDitherEnabled();
@@ -1533,6 +1559,17 @@ class PipelineHelper final : public Resource
     // pipeline released.
     angle::Result getPreferredPipeline(ContextVk *contextVk, const Pipeline **pipelineOut);
 
+    // With asyncGraphicsPipelineCreationOnCacheMiss, a pipeline may be added to the cache before
+    // it's created, with only a monolithic pipeline creation task to create it.  Such a pipeline
+    // cannot be bound until the task is done.
+    bool isCreationPending() const
+    {
+        return !mPipeline.valid() && mMonolithicPipelineCreationTask.isValid();
+    }
+    // Wait for the pending creation of the pipeline, running the task on the calling thread if it
+    // was never scheduled.
+    angle::Result waitForPendingCreation(ContextVk *contextVk);
+
     ANGLE_INLINE bool findTransition(GraphicsPipelineTransitionBits bits,
                                      const GraphicsPipelineDesc &desc,
                                      PipelineHelper **pipelineOut) const
@@ -1577,6 +1614,7 @@ class PipelineHelper final : public Resource
 
   private:
     void reset();
+    angle::Result onMonolithicPipelineCreated(ContextVk *contextVk);
 
     std::vector<GraphicsPipelineTransition> mTransitions;
     Pipeline mPipeline;
@@ -1596,9 +1634,10 @@ class PipelineHelper final : public Resource
     Pipeline mLinkedPipelineToRelease;
 
     // An async task to create a monolithic pipeline.  Only used if the pipeline was originally
-    // created as a linked library.  The |getPipeline()| call will attempt to schedule this task
-    // through the share group, which manages and paces these tasks.  Once the task results are
-    // ready, |mPipeline| is released and replaced by the result of this task.
+    // created as a linked library, or if its creation was deferred on a cache miss.  The
+    // |getPipeline()| call will attempt to schedule this task through the share group, which
+    // manages and paces these tasks.  Once the task results are ready, |mPipeline| is released and
+    // replaced by the result of this task.
     WaitableMonolithicPipelineCreationTask mMonolithicPipelineCreationTask;
 };
 
@@ -1950,7 +1989,8 @@ class DescriptorSetDescBuilder final
 
     // Specific helpers for shader resource descriptors.
     template <typename CommandBufferT>
-    void updateOneShaderBuffer(CommandBufferT *commandBufferHelper,
+    void updateOneShaderBuffer(Context *context,
+                               CommandBufferT *commandBufferHelper,
                                const ShaderInterfaceVariableInfoMap &variableInfoMap,
                                const gl::BufferVector &buffers,
                                const gl::InterfaceBlock &block,
@@ -1961,7 +2001,8 @@ class DescriptorSetDescBuilder final
                                const WriteDescriptorDescs &writeDescriptorDescs,
                                const GLbitfield memoryBarrierBits);
     template <typename CommandBufferT>
-    void updateShaderBuffers(CommandBufferT *commandBufferHelper,
+    void updateShaderBuffers(Context *context,
+                             CommandBufferT *commandBufferHelper,
                              const gl::ProgramExecutable &executable,
                              const ShaderInterfaceVariableInfoMap &variableInfoMap,
                              const gl::BufferVector &buffers,
@@ -1972,7 +2013,8 @@ class DescriptorSetDescBuilder final
                              const WriteDescriptorDescs &writeDescriptorDescs,
                              const GLbitfield memoryBarrierBits);
     template <typename CommandBufferT>
-    void updateAtomicCounters(CommandBufferT *commandBufferHelper,
+    void updateAtomicCounters(Context *context,
+                              CommandBufferT *commandBufferHelper,
                               const gl::ProgramExecutable &executable,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap,
                               const gl::BufferVector &buffers,
@@ -2343,14 +2385,18 @@ class CacheStats final : angle::NonCopyable
     ~CacheStats() {}
 
     CacheStats(const CacheStats &rhs)
-        : mHitCount(rhs.mHitCount), mMissCount(rhs.mMissCount), mSize(rhs.mSize)
+        : mHitCount(rhs.mHitCount),
+          mMissCount(rhs.mMissCount),
+          mEvictionCount(rhs.mEvictionCount),
+          mSize(rhs.mSize)
     {}
 
     CacheStats &operator=(const CacheStats &rhs)
     {
-        mHitCount  = rhs.mHitCount;
-        mMissCount = rhs.mMissCount;
-        mSize      = rhs.mSize;
+        mHitCount      = rhs.mHitCount;
+        mMissCount     = rhs.mMissCount;
+        mEvictionCount = rhs.mEvictionCount;
+        mSize          = rhs.mSize;
         return *this;
     }
 
@@ -2363,15 +2409,22 @@ class CacheStats final : angle::NonCopyable
         mMissCount++;
         mSize++;
     }
+    ANGLE_INLINE void evictAndDecrementSize()
+    {
+        mEvictionCount++;
+        mSize--;
+    }
     ANGLE_INLINE void accumulate(const CacheStats &stats)
     {
         mHitCount += stats.mHitCount;
         mMissCount += stats.mMissCount;
+        mEvictionCount += stats.mEvictionCount;
         mSize += stats.mSize;
     }
 
     uint32_t getHitCount() const { return mHitCount; }
     uint32_t getMissCount() const { return mMissCount; }
+    uint32_t getEvictionCount() const { return mEvictionCount; }
 
     ANGLE_INLINE double getHitRatio() const
     {
@@ -2390,26 +2443,31 @@ class CacheStats final : angle::NonCopyable
 
     void reset()
     {
-        mHitCount  = 0;
-        mMissCount = 0;
-        mSize      = 0;
+        mHitCount      = 0;
+        mMissCount     = 0;
+        mEvictionCount = 0;
+        mSize          = 0;
     }
 
+    // Also resets the eviction count, which is tracked over the same period as hits and misses.
     void resetHitAndMissCount()
     {
-        mHitCount  = 0;
-        mMissCount = 0;
+        mHitCount      = 0;
+        mMissCount     = 0;
+        mEvictionCount = 0;
     }
 
     void accumulateCacheStats(VulkanCacheType cacheType, const CacheStats &cacheStats)
     {
         mHitCount += cacheStats.getHitCount();
         mMissCount += cacheStats.getMissCount();
+        mEvictionCount += cacheStats.getEvictionCount();
     }
 
   private:
     uint32_t mHitCount;
     uint32_t mMissCount;
+    uint32_t mEvictionCount;
     uint32_t mSize;
 };
 
@@ -2680,6 +2738,16 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                                 const vk::GraphicsPipelineDesc **descPtrOut,
                                 vk::PipelineHelper **pipelineOut);
 
+    // Add a pipeline whose creation is deferred.  The returned pipeline helper is invalid until
+    // the monolithic pipeline creation task attached to it by the caller is done.
+    void addPendingPipeline(const vk::GraphicsPipelineDesc &desc,
+                            const vk::GraphicsPipelineDesc **descPtrOut,
+                            vk::PipelineHelper **pipelineOut);
+
+    // Find a cached pipeline that can be bound in place of the pipeline for |desc|, even if it
+    // doesn't produce identical results.  Returns nullptr if there is no such pipeline.
+    vk::PipelineHelper *getCompatiblePipeline(const vk::GraphicsPipelineDesc &desc);
+
     // Helper for VulkanPipelineCachePerf that resets the object without destroying any object.
     void reset() { mPayload.clear(); }
 
@@ -8,7 +8,6 @@
 
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 
-#include "image_util/loadimage.h"
 #include "libANGLE/Texture.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/load_functions_table.h"
@@ -526,30 +525,6 @@ static_assert((int)angle::FormatID::ETC2_R8G8B8A8_UNORM_BLOCK ==
 static_assert((int)angle::FormatID::ETC2_R8G8B8_SRGB_BLOCK ==
               (int)angle::FormatID::EAC_R11G11_SNORM_BLOCK + 10);
 
-static const std::array<LoadImageFunction, kNumETCFormats> kEtcToBcLoadingFunc = {
-    angle::LoadEACRG11SToBC5,     // EAC_R11G11_SNORM
-    angle::LoadEACRG11ToBC5,      // EAC_R11G11_UNORM
-    angle::LoadEACR11SToBC4,      // EAC_R11_SNORM
-    angle::LoadEACR11ToBC4,       // EAC_R11_UNORM_BLOCK
-    angle::LoadETC1RGB8ToBC1,     // ETC1_LOSSY_DECODE_R8G8B8_UNORM
-    angle::LoadETC2RGB8ToBC1,     // ETC1_R8G8B8_UNORM
-    angle::LoadETC2SRGB8A1ToBC1,  // ETC2_R8G8B8A1_SRGB
-    angle::LoadETC2RGB8A1ToBC1,   // ETC2_R8G8B8A1_UNORM
-    angle::LoadETC2SRGBA8ToBC3,   // ETC2_R8G8B8A8_SRGB
-    angle::LoadETC2RGBA8ToBC3,    // ETC2_R8G8B8A8_UNORM
-    angle::LoadETC2SRGB8ToBC1,    // ETC2_R8G8B8_SRGB
-    angle::LoadETC2RGB8ToBC1,     // ETC2_R8G8B8_UNORM
-};
-
-LoadImageFunctionInfo GetEtcToBcTransCodingFunc(angle::FormatID formatID)
-{
-    ASSERT(IsETCFormat(formatID));
-    return LoadImageFunctionInfo(
-        kEtcToBcLoadingFunc[static_cast<uint32_t>(formatID) -
-                            static_cast<uint32_t>(angle::FormatID::EAC_R11G11_SNORM_BLOCK)],
-        true);
-}
-
 static constexpr angle::FormatID kEtcToBcFormatMapping[] = {
     angle::FormatID::BC5_RG_SNORM_BLOCK,         // EAC_R11G11_SNORM
     angle::FormatID::BC5_RG_UNORM_BLOCK,         // EAC_R11G11_UNORM
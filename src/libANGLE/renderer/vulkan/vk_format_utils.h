@@ -289,9 +289,6 @@ angle::FormatID GetTranscodeBCFormatID(angle::FormatID formatID);
 
 VkFormat AdjustASTCFormatForHDR(const vk::Renderer *renderer, VkFormat vkFormat);
 
-// Get Etc format cpu transcoding to Bc function.
-LoadImageFunctionInfo GetEtcToBcTransCodingFunc(angle::FormatID formatID);
-
 // Get the swizzle state based on format's requirements and emulations.
 gl::SwizzleState GetFormatSwizzle(const angle::Format &angleFormat, const bool sized);
 
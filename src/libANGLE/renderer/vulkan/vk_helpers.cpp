@@ -35,6 +35,15 @@ namespace
 // During descriptorSet cache eviction, we keep it in the cache only if it is recently used. If it
 // has not been used in the past kDescriptorSetCacheRetireAge frames, it will be evicted.
 constexpr uint32_t kDescriptorSetCacheRetireAge = 10;
+// The retire age is shortened to kDescriptorSetCacheMinRetireAge when the cache is not paying for
+// itself, i.e. when it has grown past kMaxCachedDescriptorSetsPerPool or when fewer than
+// kDescriptorSetCacheLowHitRatio of the lookups in the current frame hit the cache (typical of
+// texture streaming, where most descriptor sets are never reused).  The hit ratio is only trusted
+// once there have been kDescriptorSetCacheMinLookups lookups in the frame.
+constexpr uint32_t kDescriptorSetCacheMinRetireAge = 2;
+constexpr uint32_t kMaxCachedDescriptorSetsPerPool = 4096;
+constexpr double kDescriptorSetCacheLowHitRatio    = 0.5;
+constexpr uint32_t kDescriptorSetCacheMinLookups   = 64;
 
 // ANGLE_robust_resource_initialization requires color textures to be initialized to zero.
 constexpr VkClearColorValue kRobustInitColorValue = {{0, 0, 0, 0}};
@@ -47,6 +56,11 @@ constexpr VkClearDepthStencilValue kRobustInitDepthStencilValue = {1.0f, 0};
 constexpr VkImageAspectFlags kDepthStencilAspects =
     VK_IMAGE_ASPECT_STENCIL_BIT | VK_IMAGE_ASPECT_DEPTH_BIT;
 
+// The maximum number of staged buffer updates that are recorded with a single
+// vkCmdCopyBufferToImage.  This bounds the cost of checking each new update for overlap with the
+// batch.
+constexpr size_t kMaxBatchedBufferUpdateCopies = 256;
+
 constexpr angle::PackedEnumMap<PipelineStage, VkPipelineStageFlagBits> kPipelineStageFlagBitMap = {
     {PipelineStage::TopOfPipe, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT},
     {PipelineStage::DrawIndirect, VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT},
@@ -841,6 +855,29 @@ EventStage GetImageLayoutEventStage(ImageLayout layout)
     return barrierData.eventStage;
 }
 
+// Returns the event stage that tracks a buffer write at |writeStage|, or InvalidEnum if such writes
+// are not tracked with events (for example transform feedback).
+EventStage GetBufferWriteEventStage(PipelineStage writeStage)
+{
+    switch (writeStage)
+    {
+        case PipelineStage::Transfer:
+            return EventStage::Transfer;
+        case PipelineStage::VertexShader:
+            return EventStage::VertexShader;
+        case PipelineStage::TessellationControl:
+        case PipelineStage::TessellationEvaluation:
+        case PipelineStage::GeometryShader:
+            return EventStage::PreFragmentShaders;
+        case PipelineStage::FragmentShader:
+            return EventStage::FragmentShader;
+        case PipelineStage::ComputeShader:
+            return EventStage::ComputeShader;
+        default:
+            return EventStage::InvalidEnum;
+    }
+}
+
 bool HasBothDepthAndStencilAspects(VkImageAspectFlags aspectFlags)
 {
     return IsMaskFlagSet(aspectFlags, kDepthStencilAspects);
@@ -1195,6 +1232,25 @@ ImageLayerWriteMask GetImageLayerWriteMask(uint32_t layerStart, uint32_t layerCo
     return layerMask;
 }
 
+// Whether two buffer-to-image copies write to a common region of the image.
+bool DoBufferImageCopiesOverlap(const VkBufferImageCopy &a, const VkBufferImageCopy &b)
+{
+    auto rangesOverlap = [](int32_t aStart, uint32_t aSize, int32_t bStart, uint32_t bSize) {
+        return aStart < bStart + static_cast<int32_t>(bSize) &&
+               bStart < aStart + static_cast<int32_t>(aSize);
+    };
+
+    return (a.imageSubresource.aspectMask & b.imageSubresource.aspectMask) != 0 &&
+           rangesOverlap(a.imageSubresource.baseArrayLayer, a.imageSubresource.layerCount,
+                         b.imageSubresource.baseArrayLayer, b.imageSubresource.layerCount) &&
+           rangesOverlap(a.imageOffset.x, a.imageExtent.width, b.imageOffset.x,
+                         b.imageExtent.width) &&
+           rangesOverlap(a.imageOffset.y, a.imageExtent.height, b.imageOffset.y,
+                         b.imageExtent.height) &&
+           rangesOverlap(a.imageOffset.z, a.imageExtent.depth, b.imageOffset.z,
+                         b.imageExtent.depth);
+}
+
 ImageSubresourceRange MakeImageSubresourceReadRange(gl::LevelIndex level,
                                                     uint32_t levelCount,
                                                     uint32_t layer,
@@ -1826,14 +1882,23 @@ void CommandBufferHelperCommon::assertCanBeRecycledImpl()
     ASSERT(!DerivedT::ExecutesInline() || derived->getCommandBuffer().empty());
 }
 
-void CommandBufferHelperCommon::bufferWrite(VkAccessFlags writeAccessType,
+void CommandBufferHelperCommon::bufferWrite(Context *context,
+                                            VkAccessFlags writeAccessType,
                                             PipelineStage writeStage,
                                             BufferHelper *buffer)
 {
+    // The event of a write only covers the stage it was set for, so buffers that are written more
+    // than once in the same command buffer keep using pipeline barriers.
+    const bool isFirstWrite = !buffer->writtenByCommandBuffer(mQueueSerial);
     buffer->setWriteQueueSerial(mQueueSerial);
 
     VkPipelineStageFlagBits stageBits = kPipelineStageFlagBitMap[writeStage];
-    buffer->recordWriteBarrier(writeAccessType, stageBits, writeStage, &mPipelineBarriers);
+    buffer->recordWriteBarrier(context, writeAccessType, stageBits, writeStage, &mPipelineBarriers);
+
+    if (isFirstWrite && context->getFeatures().useVkEventForBufferBarrier.enabled)
+    {
+        buffer->setCurrentWriteRefCountedEvent(context, writeStage, mRefCountedEvents);
+    }
 
     // Make sure host-visible buffer writes result in a barrier inserted at the end of the frame to
     // make the results visible to the host.  The buffer may be mapped by the application in the
@@ -1857,12 +1922,14 @@ void CommandBufferHelperCommon::executeBarriers(Renderer *renderer, CommandsStat
     mEventBarriers.execute(renderer, &commandsState->primaryCommands);
 }
 
-void CommandBufferHelperCommon::bufferReadImpl(VkAccessFlags readAccessType,
+void CommandBufferHelperCommon::bufferReadImpl(Context *context,
+                                               VkAccessFlags readAccessType,
                                                PipelineStage readStage,
                                                BufferHelper *buffer)
 {
     VkPipelineStageFlagBits stageBits = kPipelineStageFlagBitMap[readStage];
-    buffer->recordReadBarrier(readAccessType, stageBits, readStage, &mPipelineBarriers);
+    buffer->recordReadBarrier(context, readAccessType, stageBits, readStage, &mPipelineBarriers,
+                              &mEventBarriers, &mRefCountedEventCollector);
     ASSERT(!usesBufferForWrite(*buffer));
 }
 
@@ -1872,6 +1939,7 @@ void CommandBufferHelperCommon::imageReadImpl(Context *context,
                                               BarrierType barrierType,
                                               ImageHelper *image)
 {
+    image->onStoreOpInferenceRead();
     if (image->isReadBarrierNecessary(context->getRenderer(), imageLayout))
     {
         updateImageLayoutAndBarrier(context, image, aspectFlags, imageLayout, barrierType);
@@ -2252,7 +2320,9 @@ RenderPassCommandBufferHelper::RenderPassCommandBufferHelper()
       mDepthStencilAttachmentIndex(kAttachmentIndexInvalid),
       mColorAttachmentsCount(0),
       mImageOptimizeForPresent(nullptr),
-      mImageOptimizeForPresentOriginalLayout(ImageLayout::Undefined)
+      mImageOptimizeForPresentOriginalLayout(ImageLayout::Undefined),
+      mParallelCommandEncoder(nullptr),
+      mParallelEncodeChunkStartWriteCommandCount(0)
 {}
 
 RenderPassCommandBufferHelper::~RenderPassCommandBufferHelper() {}
@@ -2304,6 +2374,9 @@ angle::Result RenderPassCommandBufferHelper::reset(
     mImageOptimizeForPresent               = nullptr;
     mImageOptimizeForPresentOriginalLayout = ImageLayout::Undefined;
 
+    mParallelCommandEncoder                    = nullptr;
+    mParallelEncodeChunkStartWriteCommandCount = 0;
+
     ASSERT(CheckSubpassCommandBufferCount(getSubpassCommandBufferCount()));
 
     // Collect/Reset the command buffers
@@ -2625,6 +2698,19 @@ void RenderPassCommandBufferHelper::finalizeColorImageLoadStore(
     if (storeOp == RenderPassStoreOp::Store)
     {
         colorAttachment.restoreContent();
+
+        // The contents are still considered defined if the store is dropped below, so that a
+        // future loadOp=LOAD is detected as a misprediction rather than silently turned into
+        // DONT_CARE.  Default framebuffer images may be presented without a barrier, and
+        // resolve/unresolve attachments depend on the multisampled contents, so skip those.
+        ImageHelper *image = colorAttachment.getImage();
+        if (context->getFeatures().inferAttachmentStoreOps.enabled && image != nullptr &&
+            !isDefault() && !mRenderPassDesc.getColorUnresolveAttachmentMask().any() &&
+            !mRenderPassDesc.getColorResolveAttachmentMask().any() &&
+            image->inferStoreOpDontCare(loadOp))
+        {
+            storeOp = RenderPassStoreOp::DontCare;
+        }
     }
 
     SetBitField(ops.loadOp, loadOp);
@@ -3071,7 +3157,12 @@ angle::Result RenderPassCommandBufferHelper::nextSubpass(ContextVk *contextVk,
         // rest of the commands, and there is no need to split command buffers.
         //
         // Note also that the command buffer handle doesn't change in this case.
+        //
+        // vkCmdNextSubpass cannot be recorded in a secondary command buffer, so parallel encoding
+        // is abandoned for this render pass.
         getCommandBuffer().nextSubpass(VK_SUBPASS_CONTENTS_INLINE);
+        getCommandBuffer().clearParallelEncodeBoundaries();
+        mParallelCommandEncoder = nullptr;
         return angle::Result::Continue;
     }
 
@@ -3185,9 +3276,17 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
         ExecutesInline() ? VK_SUBPASS_CONTENTS_INLINE
                          : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
 
+    // If the commands have been split in chunks, encode them in parallel in Vulkan secondary
+    // command buffers instead of executing them inline.
+    const bool encodeInParallel = ExecutesInline() && mParallelCommandEncoder != nullptr &&
+                                  getSubpassCommandBufferCount() == 1 &&
+                                  mCommandBuffers[0].getParallelEncodeChunkCount() > 1;
+    const VkSubpassContents subpassContents =
+        encodeInParallel ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS : kSubpassContents;
+
     if (!renderPass.valid())
     {
-        mRenderPassDesc.beginRendering(context, &primary, mRenderArea, kSubpassContents,
+        mRenderPassDesc.beginRendering(context, &primary, mRenderArea, subpassContents,
                                        mFramebuffer.getUnpackedImageViews(), mAttachmentOps,
                                        mClearValues, mFramebuffer.getLayers());
     }
@@ -3209,19 +3308,51 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
         mRenderPassDesc.beginRenderPass(
             context, &primary, renderPass,
             framebufferOverride ? framebufferOverride : mFramebuffer.getFramebuffer().getHandle(),
-            mRenderArea, kSubpassContents, mClearValues,
+            mRenderArea, subpassContents, mClearValues,
             mFramebuffer.isImageless() ? &attachmentBeginInfo : nullptr);
     }
 
     // Run commands inside the RenderPass.
-    for (uint32_t subpass = 0; subpass < getSubpassCommandBufferCount(); ++subpass)
+    if (encodeInParallel)
     {
-        if (subpass > 0)
+#if ANGLE_USE_CUSTOM_VULKAN_RENDER_PASS_CMD_BUFFERS
+        VkCommandBufferInheritanceInfo inheritanceInfo = {};
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        VkCommandBufferInheritanceRenderingInfo renderingInfo;
+        gl::DrawBuffersArray<VkFormat> colorFormatStorage;
+
+        if (!renderPass.valid())
+        {
+            mRenderPassDesc.populateRenderingInheritanceInfo(context->getRenderer(), &renderingInfo,
+                                                             &colorFormatStorage);
+            AddToPNextChain(&inheritanceInfo, &renderingInfo);
+        }
+        else
+        {
+            inheritanceInfo.renderPass  = renderPass.getHandle();
+            inheritanceInfo.subpass     = 0;
+            inheritanceInfo.framebuffer = framebufferOverride
+                                              ? framebufferOverride
+                                              : mFramebuffer.getFramebuffer().getHandle();
+        }
+
+        ANGLE_TRY(mParallelCommandEncoder->encode(context, &mCommandBuffers[0], inheritanceInfo,
+                                                  &primary, &commandsState->secondaryCommands));
+#else
+        UNREACHABLE();
+#endif
+    }
+    else
+    {
+        for (uint32_t subpass = 0; subpass < getSubpassCommandBufferCount(); ++subpass)
         {
-            ASSERT(!context->getFeatures().preferDynamicRendering.enabled);
-            primary.nextSubpass(kSubpassContents);
+            if (subpass > 0)
+            {
+                ASSERT(!context->getFeatures().preferDynamicRendering.enabled);
+                primary.nextSubpass(kSubpassContents);
+            }
+            mCommandBuffers[subpass].executeCommands(&primary);
         }
-        mCommandBuffers[subpass].executeCommands(&primary);
     }
 
     if (!renderPass.valid())
@@ -3256,6 +3387,17 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
     return reset(context, &commandsState->secondaryCommands);
 }
 
+void RenderPassCommandBufferHelper::insertParallelEncodeBoundary(ParallelCommandEncoder *encoder)
+{
+    ASSERT(ExecutesInline());
+    ASSERT(mRenderPassStarted);
+    ASSERT(mParallelCommandEncoder == nullptr || mParallelCommandEncoder == encoder);
+
+    getCommandBuffer().insertParallelEncodeBoundary();
+    mParallelCommandEncoder                    = encoder;
+    mParallelEncodeChunkStartWriteCommandCount = getRenderPassWriteCommandCount();
+}
+
 void RenderPassCommandBufferHelper::addColorResolveAttachment(size_t colorIndexGL,
                                                               ImageHelper *image,
                                                               VkImageView view,
@@ -3494,18 +3636,25 @@ angle::Result CommandBufferRecycler<CommandBufferHelperT>::getCommandBufferHelpe
     SecondaryCommandMemoryAllocator *commandsAllocator,
     CommandBufferHelperT **commandBufferHelperOut)
 {
-    std::unique_lock<angle::SimpleMutex> lock(mMutex);
-    if (mCommandBufferHelperFreeList.empty())
+    CommandBufferHelperT *commandBuffer = nullptr;
     {
-        CommandBufferHelperT *commandBuffer = new CommandBufferHelperT();
-        *commandBufferHelperOut             = commandBuffer;
-        ANGLE_TRY(commandBuffer->initialize(context));
+        std::unique_lock<angle::SimpleMutex> lock(mMutex);
+        if (!mCommandBufferHelperFreeList.empty())
+        {
+            commandBuffer = mCommandBufferHelperFreeList.back();
+            mCommandBufferHelperFreeList.pop_back();
+        }
     }
-    else
+
+    // The free list is shared by all contexts of the renderer, so a helper released by a context
+    // (along with the command memory it has grown) is picked up by the next context that needs
+    // one.  Creating a helper doesn't need the lock.
+    *commandBufferHelperOut = commandBuffer;
+    if (commandBuffer == nullptr)
     {
-        CommandBufferHelperT *commandBuffer = mCommandBufferHelperFreeList.back();
-        mCommandBufferHelperFreeList.pop_back();
+        commandBuffer           = new CommandBufferHelperT();
         *commandBufferHelperOut = commandBuffer;
+        ANGLE_TRY(commandBuffer->initialize(context));
     }
 
     ANGLE_TRY((*commandBufferHelperOut)->attachCommandPool(context, commandPool));
@@ -3878,7 +4027,8 @@ BufferPool::BufferPool()
       mSize(0),
       mMemoryTypeIndex(0),
       mTotalMemorySize(0),
-      mNumberOfNewBuffersNeededSinceLastPrune(0)
+      mNumberOfNewBuffersNeededSinceLastPrune(0),
+      mEvacuationAttempts(0)
 {}
 
 BufferPool::BufferPool(BufferPool &&other)
@@ -3886,7 +4036,8 @@ BufferPool::BufferPool(BufferPool &&other)
       mUsage(other.mUsage),
       mHostVisible(other.mHostVisible),
       mSize(other.mSize),
-      mMemoryTypeIndex(other.mMemoryTypeIndex)
+      mMemoryTypeIndex(other.mMemoryTypeIndex),
+      mEvacuationAttempts(0)
 {}
 
 void BufferPool::initWithFlags(Renderer *renderer,
@@ -3928,6 +4079,9 @@ void BufferPool::pruneEmptyBuffers(Renderer *renderer)
     {
         if (block->isEmpty())
         {
+            // An evacuated block is now free to be reused.
+            block->setEvacuating(false);
+
             // We will always free empty buffers that has smaller size. Or if the empty buffer has
             // been found empty for long enough time, or we accumulated too many empty buffers, we
             // also free it.
@@ -3979,6 +4133,50 @@ void BufferPool::pruneEmptyBuffers(Renderer *renderer)
     mNumberOfNewBuffersNeededSinceLastPrune = 0;
 }
 
+void BufferPool::releaseEmptyBuffers(Renderer *renderer)
+{
+    mNumberOfNewBuffersNeededSinceLastPrune = 0;
+    pruneEmptyBuffers(renderer);
+}
+
+bool BufferPool::selectBlockForEvacuation()
+{
+    BufferBlock *sparsestBlock      = nullptr;
+    VkDeviceSize sparsestBlockBytes = 0;
+    for (std::unique_ptr<BufferBlock> &block : mBufferBlocks)
+    {
+        if (block->isEvacuating())
+        {
+            if (++mEvacuationAttempts < kMaxBufferBlockEvacuationAttempts)
+            {
+                return true;
+            }
+            block->setEvacuating(false);
+            mEvacuationAttempts = 0;
+            return false;
+        }
+
+        vma::StatInfo statInfo;
+        block->calculateStats(&statInfo);
+        if (sparsestBlock == nullptr || statInfo.basicInfo.allocationBytes < sparsestBlockBytes)
+        {
+            sparsestBlock      = block.get();
+            sparsestBlockBytes = statInfo.basicInfo.allocationBytes;
+        }
+    }
+
+    // Only evacuate if there are other blocks to take the buffers in.
+    if (mBufferBlocks.size() < 2 ||
+        sparsestBlockBytes * kBufferBlockEvacuationUsageRatio >= sparsestBlock->getMemorySize())
+    {
+        return false;
+    }
+
+    sparsestBlock->setEvacuating(true);
+    mEvacuationAttempts = 0;
+    return true;
+}
+
 VkResult BufferPool::allocateNewBuffer(Context *context, VkDeviceSize sizeInBytes)
 {
     Renderer *renderer         = context->getRenderer();
@@ -4110,6 +4308,13 @@ VkResult BufferPool::allocateBuffer(Context *context,
             continue;
         }
 
+        if (block->isEvacuating())
+        {
+            // Don't allocate from a block whose buffers are being moved out of it.
+            ++iter;
+            continue;
+        }
+
         if (block->allocate(alignedSize, alignment, &allocation, &offset) == VK_SUCCESS)
         {
             suballocation->init(block.get(), allocation, offset, alignedSize);
@@ -4529,7 +4734,7 @@ bool DynamicDescriptorPool::evictStaleDescriptorSets(Renderer *renderer,
 
             // This should destroy descriptorSet, which is already invalid;
             it = decltype(it)(mLRUList.erase(std::next(it).base()));
-            mCacheStats.decrementSize();
+            mCacheStats.evictAndDecrementSize();
         }
         else
         {
@@ -4604,8 +4809,29 @@ angle::Result DynamicDescriptorPool::getOrAllocateDescriptorSet(
         return angle::Result::Continue;
     }
 
+    const bool isCacheFull = mCacheStats.getSize() >= kMaxCachedDescriptorSetsPerPool;
+    const bool isHitRatioLow =
+        mCacheStats.getHitCount() + mCacheStats.getMissCount() >= kDescriptorSetCacheMinLookups &&
+        mCacheStats.getHitRatio() < kDescriptorSetCacheLowHitRatio;
+    const uint32_t retireAge = isCacheFull || isHitRatioLow ? kDescriptorSetCacheMinRetireAge
+                                                            : kDescriptorSetCacheRetireAge;
+
+    // If the cache has reached its cap, trim it first and reuse the evicted descriptorSets so that
+    // the cache stays bounded even if the pools have room to spare.
+    success = false;
+    if (isCacheFull && currentFrame > retireAge)
+    {
+        if (evictStaleDescriptorSets(renderer, currentFrame - retireAge, currentFrame))
+        {
+            success = recycleFromGarbage(renderer, descriptorSetOut);
+        }
+    }
+
     // Try to allocate from the existing pool (or recycle from grabage list)
-    success = allocateFromExistingPool(context, descriptorSetLayout, descriptorSetOut);
+    if (!success)
+    {
+        success = allocateFromExistingPool(context, descriptorSetLayout, descriptorSetOut);
+    }
 
     // Try to recycle from the garbage list.
     if (!success)
@@ -4613,11 +4839,10 @@ angle::Result DynamicDescriptorPool::getOrAllocateDescriptorSet(
         success = recycleFromGarbage(context->getRenderer(), descriptorSetOut);
     }
 
-    // Try to evict oldest descriptorSets that has not being used in last
-    // kDescriptorSetCacheRetireAge.
-    if (!success && currentFrame > kDescriptorSetCacheRetireAge)
+    // Try to evict oldest descriptorSets that has not being used in last retireAge frames.
+    if (!success && !isCacheFull && currentFrame > retireAge)
     {
-        uint32_t oldestFrameToKeep = currentFrame - kDescriptorSetCacheRetireAge;
+        uint32_t oldestFrameToKeep = currentFrame - retireAge;
         if (evictStaleDescriptorSets(renderer, oldestFrameToKeep, currentFrame))
         {
             success = recycleFromGarbage(renderer, descriptorSetOut);
@@ -5351,6 +5576,8 @@ BufferHelper::BufferHelper()
       mCurrentReadAccess(0),
       mCurrentWriteStages(0),
       mCurrentReadStages(0),
+      mTransferWriteRangeStart(0),
+      mTransferWriteRangeEnd(0),
       mSerial(),
       mClientBuffer(nullptr),
       mIsReleasedToExternal(false)
@@ -5383,6 +5610,16 @@ BufferHelper &BufferHelper::operator=(BufferHelper &&other)
     mSerial                  = other.mSerial;
     mClientBuffer            = std::move(other.mClientBuffer);
 
+    ASSERT(!mCurrentWriteEvent.valid());
+    if (other.mCurrentWriteEvent.valid())
+    {
+        mCurrentWriteEvent = std::move(other.mCurrentWriteEvent);
+    }
+    mCurrentWriteEventQueueIndex   = other.mCurrentWriteEventQueueIndex;
+    mTransferWriteRangeQueueSerial = other.mTransferWriteRangeQueueSerial;
+    mTransferWriteRangeStart       = other.mTransferWriteRangeStart;
+    mTransferWriteRangeEnd         = other.mTransferWriteRangeEnd;
+
     return *this;
 }
 
@@ -5499,6 +5736,73 @@ angle::Result BufferHelper::initExternal(Context *context,
     return angle::Result::Continue;
 }
 
+VkResult BufferHelper::initHostExternal(Context *context,
+                                        VkMemoryPropertyFlags memoryProperties,
+                                        const VkBufferCreateInfo &requestedCreateInfo,
+                                        void *hostPtr)
+{
+    ASSERT(context->getFeatures().supportsExternalMemoryHost.enabled);
+
+    Renderer *renderer = context->getRenderer();
+    VkDevice device    = renderer->getDevice();
+
+    initializeBarrierTracker(context);
+
+    VkMemoryHostPointerPropertiesEXT hostPointerProperties = {};
+    hostPointerProperties.sType = VK_STRUCTURE_TYPE_MEMORY_HOST_POINTER_PROPERTIES_EXT;
+    VK_RESULT_TRY(vkGetMemoryHostPointerPropertiesEXT(
+        device, VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT, hostPtr,
+        &hostPointerProperties));
+
+    VkBufferCreateInfo modifiedCreateInfo             = requestedCreateInfo;
+    VkExternalMemoryBufferCreateInfo externCreateInfo = {};
+    externCreateInfo.sType       = VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO;
+    externCreateInfo.handleTypes = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    externCreateInfo.pNext       = nullptr;
+    modifiedCreateInfo.pNext     = &externCreateInfo;
+
+    DeviceScoped<Buffer> buffer(device);
+    VK_RESULT_TRY(buffer.get().init(device, modifiedCreateInfo));
+
+    // The imported memory is exactly the host allocation, so the buffer must fit in it, and only
+    // the memory types that can import the pointer are usable.
+    VkMemoryRequirements memoryRequirements;
+    buffer.get().getMemoryRequirements(device, &memoryRequirements);
+    VK_RESULT_CHECK(memoryRequirements.size <= requestedCreateInfo.size,
+                    VK_ERROR_INVALID_EXTERNAL_HANDLE);
+    memoryRequirements.size = requestedCreateInfo.size;
+    memoryRequirements.memoryTypeBits &= hostPointerProperties.memoryTypeBits;
+
+    // Coherent memory is required, so that neither the host nor the device writes have to be
+    // flushed.  Note that the allocation below accepts any compatible memory type, as is done for
+    // all external memory, so the memory type is checked beforehand.
+    const VkMemoryPropertyFlags requiredMemoryProperties =
+        memoryProperties | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    VkMemoryPropertyFlags memoryPropertyFlagsOut = 0;
+    uint32_t memoryTypeIndex                     = 0;
+    VK_RESULT_TRY(renderer->getMemoryProperties().findCompatibleMemoryIndex(
+        context, memoryRequirements, requiredMemoryProperties, false, &memoryPropertyFlagsOut,
+        &memoryTypeIndex));
+
+    VkImportMemoryHostPointerInfoEXT importHostPointerInfo = {};
+    importHostPointerInfo.sType        = VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT;
+    importHostPointerInfo.handleType   = VK_EXTERNAL_MEMORY_HANDLE_TYPE_HOST_ALLOCATION_BIT_EXT;
+    importHostPointerInfo.pHostPointer = hostPtr;
+
+    DeviceScoped<DeviceMemory> deviceMemory(device);
+    VK_RESULT_TRY(AllocateBufferMemoryWithRequirements(
+        context, MemoryAllocationType::BufferExternal, requiredMemoryProperties,
+        memoryRequirements, &importHostPointerInfo, &buffer.get(), &memoryPropertyFlagsOut,
+        &memoryTypeIndex, &deviceMemory.get()));
+
+    mSuballocation.initWithEntireBuffer(context, buffer.get(), MemoryAllocationType::BufferExternal,
+                                        memoryTypeIndex, deviceMemory.get(), memoryPropertyFlagsOut,
+                                        requestedCreateInfo.size, memoryRequirements.size);
+
+    return mSuballocation.map(context);
+}
+
 VkResult BufferHelper::initSuballocation(Context *context,
                                          uint32_t memoryTypeIndex,
                                          size_t size,
@@ -5537,6 +5841,8 @@ void BufferHelper::initializeBarrierTracker(Context *context)
     mCurrentReadAccess       = 0;
     mCurrentWriteStages      = 0;
     mCurrentReadStages       = 0;
+    mCurrentWriteEvent.release(context);
+    mTransferWriteRangeQueueSerial = QueueSerial();
 }
 
 angle::Result BufferHelper::initializeNonZeroMemory(Context *context,
@@ -5657,6 +5963,7 @@ bool BufferHelper::onBufferUserSizeChange(Renderer *renderer)
 
 void BufferHelper::destroy(Renderer *renderer)
 {
+    mCurrentWriteEvent.release(renderer);
     mDescriptorSetCacheManager.destroyKeys(renderer);
     unmap(renderer);
     mBufferWithUserSize.destroy(renderer->getDevice());
@@ -5672,6 +5979,7 @@ void BufferHelper::release(Renderer *renderer)
 {
     ASSERT(mDescriptorSetCacheManager.empty());
     unmap(renderer);
+    mCurrentWriteEvent.release(renderer);
 
     if (mSuballocation.valid())
     {
@@ -5771,8 +6079,9 @@ void BufferHelper::acquireFromExternal(DeviceQueueIndex externalQueueFamilyIndex
 {
     changeQueueFamily(externalQueueFamilyIndex.familyIndex(), newDeviceQueueIndex.familyIndex(),
                       commandBuffer);
-    mCurrentDeviceQueueIndex = newDeviceQueueIndex;
-    mIsReleasedToExternal    = false;
+    mCurrentDeviceQueueIndex       = newDeviceQueueIndex;
+    mIsReleasedToExternal          = false;
+    mTransferWriteRangeQueueSerial = QueueSerial();
 }
 
 void BufferHelper::releaseToExternal(DeviceQueueIndex externalQueueIndex,
@@ -5784,7 +6093,8 @@ void BufferHelper::releaseToExternal(DeviceQueueIndex externalQueueIndex,
                           commandBuffer);
         mCurrentDeviceQueueIndex = kInvalidDeviceQueueIndex;
     }
-    mIsReleasedToExternal = true;
+    mIsReleasedToExternal          = true;
+    mTransferWriteRangeQueueSerial = QueueSerial();
 }
 
 bool BufferHelper::isReleasedToExternal() const
@@ -5792,18 +6102,70 @@ bool BufferHelper::isReleasedToExternal() const
     return mIsReleasedToExternal;
 }
 
-void BufferHelper::recordReadBarrier(VkAccessFlags readAccessType,
+bool BufferHelper::canShareTransferWriteCommandBuffer(const QueueSerial &queueSerial,
+                                                      VkDeviceSize offset,
+                                                      VkDeviceSize size) const
+{
+    if (size == VK_WHOLE_SIZE || mTransferWriteRangeQueueSerial != queueSerial)
+    {
+        return false;
+    }
+    return offset >= mTransferWriteRangeEnd || offset + size <= mTransferWriteRangeStart;
+}
+
+void BufferHelper::onTransferWriteRange(const QueueSerial &queueSerial,
+                                        VkDeviceSize offset,
+                                        VkDeviceSize size)
+{
+    ASSERT(size != VK_WHOLE_SIZE);
+    ASSERT(writtenByCommandBuffer(queueSerial));
+
+    // Written ranges are merged into one, which is enough for sequential uploads, such as to a
+    // ring buffer.
+    if (mTransferWriteRangeQueueSerial != queueSerial)
+    {
+        mTransferWriteRangeQueueSerial = queueSerial;
+        mTransferWriteRangeStart       = offset;
+        mTransferWriteRangeEnd         = offset + size;
+        return;
+    }
+    mTransferWriteRangeStart = std::min(mTransferWriteRangeStart, offset);
+    mTransferWriteRangeEnd   = std::max(mTransferWriteRangeEnd, offset + size);
+}
+
+void BufferHelper::recordReadBarrier(Context *context,
+                                     VkAccessFlags readAccessType,
                                      VkPipelineStageFlags readStage,
                                      PipelineStage stageIndex,
-                                     PipelineBarrierArray *barriers)
+                                     PipelineBarrierArray *pipelineBarriers,
+                                     EventBarrierArray *eventBarriers,
+                                     RefCountedEventCollector *eventCollector)
 {
+    mTransferWriteRangeQueueSerial = QueueSerial();
+
     // If there was a prior write and we are making a read that is either a new access type or from
     // a new stage, we need a barrier
     if (mCurrentWriteAccess != 0 && (((mCurrentReadAccess & readAccessType) != readAccessType) ||
                                      ((mCurrentReadStages & readStage) != readStage)))
     {
-        barriers->mergeMemoryBarrier(stageIndex, mCurrentWriteStages, readStage,
-                                     mCurrentWriteAccess, readAccessType);
+        // Reads are never recorded in the command buffer of the write, so the event has been (or
+        // will be, before this command buffer executes) set after the write.  Waiting for it
+        // only waits for the writer's command buffer, and not for everything that ran at the
+        // write stages since then, as a pipeline barrier would.
+        if (mCurrentWriteEvent.valid() &&
+            mCurrentWriteEventQueueIndex == context->getDeviceQueueIndex())
+        {
+            eventBarriers->addBufferMemoryEvent(context->getRenderer(), mCurrentWriteEvent,
+                                                mCurrentWriteAccess, readStage, readAccessType);
+            // Keep the event alive until this command buffer completes.  The buffer keeps its
+            // own reference for the reads that follow.
+            eventCollector->emplace_back(mCurrentWriteEvent);
+        }
+        else
+        {
+            pipelineBarriers->mergeMemoryBarrier(stageIndex, mCurrentWriteStages, readStage,
+                                                 mCurrentWriteAccess, readAccessType);
+        }
     }
 
     // Accumulate new read usage.
@@ -5811,11 +6173,18 @@ void BufferHelper::recordReadBarrier(VkAccessFlags readAccessType,
     mCurrentReadStages |= readStage;
 }
 
-void BufferHelper::recordWriteBarrier(VkAccessFlags writeAccessType,
+void BufferHelper::recordWriteBarrier(Context *context,
+                                      VkAccessFlags writeAccessType,
                                       VkPipelineStageFlags writeStage,
                                       PipelineStage stageIndex,
                                       PipelineBarrierArray *barriers)
 {
+    // Write-after-read hazards must wait for the reads, which are not tracked by events, so writes
+    // always use a pipeline barrier.  The previous write's event is no longer needed; the command
+    // buffers that waited for it hold their own references.
+    mCurrentWriteEvent.release(context);
+    mTransferWriteRangeQueueSerial = QueueSerial();
+
     // We don't need to check mCurrentReadStages here since if it is not zero, mCurrentReadAccess
     // must not be zero as well. stage is finer grain than accessType.
     ASSERT((!mCurrentReadStages && !mCurrentReadAccess) ||
@@ -5834,6 +6203,37 @@ void BufferHelper::recordWriteBarrier(VkAccessFlags writeAccessType,
     mCurrentReadStages  = 0;
 }
 
+void BufferHelper::setCurrentWriteRefCountedEvent(Context *context,
+                                                  PipelineStage writeStage,
+                                                  EventMaps &eventMaps)
+{
+    ASSERT(context->getFeatures().useVkEventForBufferBarrier.enabled);
+    ASSERT(!mCurrentWriteEvent.valid());
+
+    // Contexts without a share group, such as OpenCL's, have no recycler to release events to.
+    const EventStage stage = GetBufferWriteEventStage(writeStage);
+    if (stage == EventStage::InvalidEnum ||
+        context->getRefCountedEventsGarbageRecycler() == nullptr)
+    {
+        return;
+    }
+
+    // All buffers written at the same stage of a command buffer are tracked by the same event, the
+    // same way images are.
+    if (!eventMaps.map[stage].valid())
+    {
+        if (!eventMaps.map[stage].init(context, stage))
+        {
+            // If VkEvent creation fail, we fallback to pipelineBarrier
+            return;
+        }
+        eventMaps.mask.set(stage);
+    }
+
+    mCurrentWriteEvent           = eventMaps.map[stage];
+    mCurrentWriteEventQueueIndex = context->getDeviceQueueIndex();
+}
+
 void BufferHelper::fillWithColor(const angle::Color<uint8_t> &color,
                                  const gl::InternalFormat &internalFormat)
 {
@@ -5932,6 +6332,10 @@ angle::Result InitMappableDeviceMemory(Context *context,
 }
 
 // ImageHelper implementation.
+// Number of consecutive times an image's stored contents must be overwritten without being read
+// before inferAttachmentStoreOps starts dropping the store.
+constexpr uint8_t kStoreOpInferenceThreshold = 3;
+
 ImageHelper::ImageHelper()
 {
     resetCachedProperties();
@@ -5972,6 +6376,10 @@ void ImageHelper::resetCachedProperties()
     mYcbcrConversionDesc.reset();
     mCurrentSingleClearValue.reset();
     mRenderPassUsageFlags.reset();
+    mUnconsumedStoreCount     = 0;
+    mHasUnconsumedStore       = false;
+    mStoreDroppedByInference  = false;
+    mStoreOpInferenceDisabled = false;
 
     setEntireContentUndefined();
 }
@@ -6127,7 +6535,7 @@ angle::Result ImageHelper::init(Context *context,
                         mipLevels, layerCount, isRobustResourceInitEnabled, hasProtectedContent,
                         deriveConversionDesc(context, format.getActualRenderableImageFormatID(),
                                              format.getIntendedFormatID()),
-                        nullptr);
+                        nullptr, nullptr);
 }
 
 angle::Result ImageHelper::initFromCreateInfo(Context *context,
@@ -6210,7 +6618,7 @@ angle::Result ImageHelper::initMSAASwapchain(Context *context,
                            format.getActualRenderableImageFormatID(), samples, usage,
                            kVkImageCreateFlagsNone, ImageLayout::Undefined, nullptr, firstLevel,
                            mipLevels, layerCount, isRobustResourceInitEnabled, hasProtectedContent,
-                           YcbcrConversionDesc{}, nullptr));
+                           YcbcrConversionDesc{}, nullptr, nullptr));
     if (rotatedAspectRatio)
     {
         std::swap(mExtents.width, mExtents.height);
@@ -6235,7 +6643,8 @@ angle::Result ImageHelper::initExternal(Context *context,
                                         bool isRobustResourceInitEnabled,
                                         bool hasProtectedContent,
                                         YcbcrConversionDesc conversionDesc,
-                                        const void *compressionControl)
+                                        const void *compressionControl,
+                                        ImageRecycler *recycler)
 {
     ASSERT(!valid());
     ASSERT(!IsAnySubresourceContentDefined(mContentDefined));
@@ -6339,11 +6748,28 @@ angle::Result ImageHelper::initExternal(Context *context,
     mLastNonShaderReadOnlyLayout = ImageLayout::Undefined;
     mCurrentShaderReadStageMask  = 0;
 
-    ANGLE_VK_TRY(context, mImage.init(context->getDevice(), imageInfo));
-
     // Find the image formats in pNext chain in imageInfo.
     deriveImageViewFormatFromCreateInfoPNext(imageInfo, mViewFormats);
 
+    ImageRecycler::RecycledImage recycledImage;
+    if (recycler != nullptr && recycler->fetch(renderer, imageInfo, mViewFormats, &recycledImage))
+    {
+        // The image and its memory are reused as is.  Its previous contents are discarded by
+        // starting from the Undefined layout, like a new image.
+        ASSERT(initialLayout == ImageLayout::Undefined);
+        mImage                   = std::move(recycledImage.image);
+        mDeviceMemory            = std::move(recycledImage.deviceMemory);
+        mVmaAllocation           = std::move(recycledImage.vmaAllocation);
+        mAllocationSize          = recycledImage.allocationSize;
+        mMemoryAllocationType    = recycledImage.allocationType;
+        mMemoryTypeIndex         = recycledImage.memoryTypeIndex;
+        mCurrentDeviceQueueIndex = context->getDeviceQueueIndex();
+    }
+    else
+    {
+        ANGLE_VK_TRY(context, mImage.init(context->getDevice(), imageInfo));
+    }
+
     mVkImageCreateInfo               = imageInfo;
     mVkImageCreateInfo.pNext         = nullptr;
     mVkImageCreateInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
@@ -6487,6 +6913,11 @@ void ImageHelper::deriveExternalImageTiling(const void *createInfoChain)
 }
 
 void ImageHelper::releaseImage(Renderer *renderer)
+{
+    releaseImage(renderer, nullptr);
+}
+
+void ImageHelper::releaseImage(Renderer *renderer, ContextVk *contextVk)
 {
     // mDeviceMemory and mVmaAllocation should not be valid at the same time.
     ASSERT(!mDeviceMemory.valid() || !mVmaAllocation.valid());
@@ -6502,11 +6933,27 @@ void ImageHelper::releaseImage(Renderer *renderer)
     }
     mCurrentEvent.release(renderer);
     mLastNonShaderReadOnlyEvent.release(renderer);
-    renderer->collectGarbage(mUse, &mImage, &mDeviceMemory, &mVmaAllocation);
+    if (contextVk != nullptr)
+    {
+        contextVk->collectGarbage(mUse, &mImage, &mDeviceMemory, &mVmaAllocation);
+    }
+    else
+    {
+        renderer->collectGarbage(mUse, &mImage, &mDeviceMemory, &mVmaAllocation);
+    }
+    resetImageStateOnRelease();
+}
+
+void ImageHelper::resetImageStateOnRelease()
+{
     mViewFormats.clear();
     mUse.reset();
-    mImageSerial          = kInvalidImageSerial;
-    mMemoryAllocationType = MemoryAllocationType::InvalidEnum;
+    mImageSerial              = kInvalidImageSerial;
+    mMemoryAllocationType     = MemoryAllocationType::InvalidEnum;
+    mUnconsumedStoreCount     = 0;
+    mHasUnconsumedStore       = false;
+    mStoreDroppedByInference  = false;
+    mStoreOpInferenceDisabled = false;
     setEntireContentUndefined();
 }
 
@@ -6516,7 +6963,33 @@ void ImageHelper::releaseImageFromShareContexts(Renderer *renderer,
 {
     finalizeImageLayoutInShareContexts(renderer, contextVk, imageSiblingSerial);
     contextVk->addToPendingImageGarbage(mUse, mAllocationSize);
-    releaseImage(renderer);
+    releaseImage(renderer, contextVk);
+}
+
+void ImageHelper::releaseImageToRecycler(Renderer *renderer,
+                                         ContextVk *contextVk,
+                                         UniqueSerial imageSiblingSerial,
+                                         ImageRecycler *recycler)
+{
+    finalizeImageLayoutInShareContexts(renderer, contextVk, imageSiblingSerial);
+
+    // The memory stays allocated while the image is in the recycler, so it is not tracked as
+    // deallocated here.
+    ImageRecycler::RecycledImage recycledImage;
+    recycledImage.createInfo      = mVkImageCreateInfo;
+    recycledImage.viewFormats     = mViewFormats;
+    recycledImage.use             = mUse;
+    recycledImage.image           = std::move(mImage);
+    recycledImage.deviceMemory    = std::move(mDeviceMemory);
+    recycledImage.vmaAllocation   = std::move(mVmaAllocation);
+    recycledImage.allocationSize  = mAllocationSize;
+    recycledImage.allocationType  = mMemoryAllocationType;
+    recycledImage.memoryTypeIndex = mMemoryTypeIndex;
+    recycler->recycle(renderer, std::move(recycledImage));
+
+    mCurrentEvent.release(renderer);
+    mLastNonShaderReadOnlyEvent.release(renderer);
+    resetImageStateOnRelease();
 }
 
 void ImageHelper::finalizeImageLayoutInShareContexts(Renderer *renderer,
@@ -7175,7 +7648,7 @@ angle::Result ImageHelper::initImplicitMultisampledRenderToTexture(
                            samples, kMultisampledUsageFlags, kMultisampledCreateFlags,
                            ImageLayout::Undefined, nullptr, resolveImage.getFirstAllocatedLevel(),
                            kLevelCount, resolveImage.getLayerCount(), isRobustResourceInitEnabled,
-                           hasProtectedContent, YcbcrConversionDesc{}, nullptr));
+                           hasProtectedContent, YcbcrConversionDesc{}, nullptr, nullptr));
 
     // Remove the emulated format clear from the multisampled image if any.  There is one already
     // staged on the resolve image if needed.
@@ -7663,6 +8136,8 @@ void ImageHelper::recordReadSubresourceBarrier(Context *context,
                                                uint32_t layerCount,
                                                OutsideRenderPassCommandBufferHelper *commands)
 {
+    onStoreOpInferenceRead();
+
     // This barrier is used for an image with both read/write permissions, including during mipmap
     // generation and self-copy.
     if (isReadSubresourceBarrierNecessary(newLayout, levelStart, levelCount, layerStart,
@@ -7689,6 +8164,8 @@ void ImageHelper::recordReadBarrier(Context *context,
                                     ImageLayout newLayout,
                                     OutsideRenderPassCommandBufferHelper *commands)
 {
+    onStoreOpInferenceRead();
+
     if (!isReadBarrierNecessary(context->getRenderer(), newLayout))
     {
         return;
@@ -8517,16 +8994,11 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
         ANGLE_VK_CHECK_MATH(contextVk, storageFormatInfo.computeBufferImageHeight(
                                            glExtents.height, &bufferImageHeight));
 
-        if (contextVk->getFeatures().supportsComputeTranscodeEtcToBc.enabled &&
-            IsETCFormat(vkFormat.getIntendedFormatID()) && IsBCFormat(storageFormat.id))
-        {
-            useComputeTransCoding =
-                shouldUseComputeForTransCoding(vk::LevelIndex(index.getLevelIndex()));
-            if (!useComputeTransCoding)
-            {
-                loadFunctionInfo = GetEtcToBcTransCodingFunc(vkFormat.getIntendedFormatID());
-            }
-        }
+        // Every level of an ETC texture emulated with BC is transcoded on the GPU; the ETC data
+        // is copied as-is to the staging buffer and converted when the update is flushed.
+        useComputeTransCoding = contextVk->getFeatures().supportsComputeTranscodeEtcToBc.enabled &&
+                                IsETCFormat(vkFormat.getIntendedFormatID()) &&
+                                IsBCFormat(storageFormat.id);
     }
     else
     {
@@ -8605,13 +9077,37 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
     const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
 
     // If possible, copy the buffer to the image directly on the host, to avoid having to use a temp
-    // image (and do a double copy).
-    if (applyUpdate != ApplyImageUpdate::Defer && !loadFunctionInfo.requiresConversion &&
-        inputRowPitch == outputRowPitch && inputDepthPitch == outputDepthPitch)
+    // image (and do a double copy).  ETC data that is transcoded to BC on the GPU cannot take this
+    // path, as the data has to go through the compute shader.
+    //
+    // Client rows of color formats that are padded (through GL_UNPACK_ROW_LENGTH,
+    // GL_UNPACK_IMAGE_HEIGHT or GL_UNPACK_ALIGNMENT) are copied directly too, with the padding
+    // expressed as the row length and image height of the copy.  This avoids the staging buffer for
+    // streamed textures whose source rows are not tightly packed.
+    GLuint memoryRowLength   = bufferRowLength;
+    GLuint memoryImageHeight = bufferImageHeight;
+
+    bool canCopyOnHost = applyUpdate != ApplyImageUpdate::Defer &&
+                         !loadFunctionInfo.requiresConversion && !useComputeTransCoding;
+    if (canCopyOnHost && (inputRowPitch != outputRowPitch || inputDepthPitch != outputDepthPitch))
+    {
+        const GLuint texelBytes = storageFormat.pixelBytes;
+        canCopyOnHost = !storageFormat.isBlock && !storageFormat.isYUV &&
+                        !storageFormat.hasDepthOrStencilBits() && texelBytes != 0 &&
+                        outputRowPitch == texelBytes * glExtents.width && inputRowPitch != 0 &&
+                        inputRowPitch % texelBytes == 0 && inputDepthPitch % inputRowPitch == 0;
+        if (canCopyOnHost)
+        {
+            memoryRowLength   = inputRowPitch / texelBytes;
+            memoryImageHeight = inputDepthPitch / inputRowPitch;
+        }
+    }
+
+    if (canCopyOnHost)
     {
         bool copied = false;
         ANGLE_TRY(updateSubresourceOnHost(contextVk, applyUpdate, index, glExtents, offset, source,
-                                          bufferRowLength, bufferImageHeight, &copied));
+                                          memoryRowLength, memoryImageHeight, &copied));
         if (copied)
         {
             *updateAppliedImmediatelyOut = true;
@@ -9207,6 +9703,46 @@ void ImageHelper::restoreSubresourceStencilContent(gl::LevelIndex level,
                                   &getLevelStencilContentDefined(toVkLevel(level)));
 }
 
+bool ImageHelper::inferStoreOpDontCare(RenderPassLoadOp loadOp)
+{
+    if (loadOp == RenderPassLoadOp::Load)
+    {
+        // The previous contents are read by this render pass.
+        onStoreOpInferenceRead();
+    }
+    else if (mHasUnconsumedStore && mUnconsumedStoreCount < kStoreOpInferenceThreshold)
+    {
+        ++mUnconsumedStoreCount;
+    }
+
+    // This render pass's store is the new unconsumed store.
+    mHasUnconsumedStore = true;
+
+    // Only whole-image history is tracked, so limit inference to images with a single subresource.
+    // Images that are shared outside of ANGLE may be read without ANGLE knowing.
+    const bool isEligible = !mStoreOpInferenceDisabled && mLevelCount == 1 && mLayerCount == 1 &&
+                            mMemoryAllocationType != MemoryAllocationType::ImageExternal &&
+                            !mIsReleasedToExternal;
+    mStoreDroppedByInference = isEligible && mUnconsumedStoreCount >= kStoreOpInferenceThreshold;
+    return mStoreDroppedByInference;
+}
+
+void ImageHelper::onStoreOpInferenceRead()
+{
+    if (mStoreDroppedByInference)
+    {
+        // The dropped store was needed after all.  The contents read are undefined; stop inferring
+        // for this image so the misprediction does not repeat.
+        mStoreOpInferenceDisabled = true;
+        WARN() << "Attachment contents read after their store was dropped by inference; disabling "
+                  "store op inference for this image";
+    }
+
+    mUnconsumedStoreCount    = 0;
+    mHasUnconsumedStore      = false;
+    mStoreDroppedByInference = false;
+}
+
 void ImageHelper::restoreSubresourceContentImpl(gl::LevelIndex level,
                                                 uint32_t layerIndex,
                                                 uint32_t layerCount,
@@ -9878,6 +10414,8 @@ angle::Result ImageHelper::flushSingleSubresourceStagedUpdates(ContextVk *contex
     if (deferredClears)
     {
         Optional<size_t> foundClear;
+        size_t intersectingUpdateCount = 0;
+        bool foundSplitClear           = false;
 
         for (size_t updateIndex = 0; updateIndex < levelUpdates->size(); ++updateIndex)
         {
@@ -9885,10 +10423,21 @@ angle::Result ImageHelper::flushSingleSubresourceStagedUpdates(ContextVk *contex
 
             if (update.intersectsLayerRange(layer, layerCount))
             {
+                ++intersectingUpdateCount;
+
                 // On any data update or the clear does not match exact layer range, we'll need to
-                // do a full upload.
+                // do a full upload.  The exception is a single clear of more layers than the
+                // attachment, typically the robust resource initialization of a whole array
+                // level, which is split below.
                 const bool isClear = IsClearOfAllChannels(update.updateSource);
-                if (isClear && update.matchesLayerRange(layer, layerCount))
+                const bool isSplitClear = isClear && isClearOfMoreLayers(update, layer, layerCount);
+                if (isSplitClear && intersectingUpdateCount == 1)
+                {
+                    foundClear      = updateIndex;
+                    foundSplitClear = true;
+                }
+                else if (isClear && !isSplitClear && !foundSplitClear &&
+                         update.matchesLayerRange(layer, layerCount))
                 {
                     foundClear = updateIndex;
                 }
@@ -9903,8 +10452,8 @@ angle::Result ImageHelper::flushSingleSubresourceStagedUpdates(ContextVk *contex
         // If we have a valid index we defer the clear using the clear reference.
         if (foundClear.valid())
         {
-            size_t foundIndex         = foundClear.value();
-            const ClearUpdate &update = (*levelUpdates)[foundIndex].data.clear;
+            size_t foundIndex        = foundClear.value();
+            const ClearUpdate update = (*levelUpdates)[foundIndex].data.clear;
 
             // Note that this set command handles combined or separate depth/stencil clears.
             deferredClears->store(deferredClearIndex, update.aspectFlags, update.value);
@@ -9913,6 +10462,15 @@ angle::Result ImageHelper::flushSingleSubresourceStagedUpdates(ContextVk *contex
             // setContentDefined directly.
             setContentDefined(toVkLevel(levelGL), 1, layer, layerCount, update.aspectFlags);
 
+            if (foundSplitClear)
+            {
+                // The clear is the only update to these layers.  Keep clearing the layers around
+                // the attachment the usual way.
+                splitClearLayerRange(foundIndex, levelUpdates, layer, layerCount);
+                mCurrentSingleClearValue.reset();
+                return angle::Result::Continue;
+            }
+
             // We process the updates again to erase any clears for this level.
             removeSingleSubresourceStagedUpdates(contextVk, levelGL, layer, layerCount);
             return angle::Result::Continue;
@@ -9924,6 +10482,58 @@ angle::Result ImageHelper::flushSingleSubresourceStagedUpdates(ContextVk *contex
     return flushStagedUpdates(contextVk, levelGL, levelGL + 1, layer, layer + layerCount, {});
 }
 
+bool ImageHelper::isClearOfMoreLayers(const SubresourceUpdate &update,
+                                      uint32_t layer,
+                                      uint32_t layerCount) const
+{
+    // Unlike matchesLayerRange(), resolve VK_REMAINING_ARRAY_LAYERS to the layers of this image.
+    uint32_t updateBaseLayer, updateLayerCount;
+    update.getDestSubresource(mLayerCount, &updateBaseLayer, &updateLayerCount);
+    const uint32_t updateLayerEnd = updateBaseLayer + updateLayerCount;
+
+    return updateBaseLayer <= layer && updateLayerEnd >= layer + layerCount &&
+           updateLayerCount > layerCount;
+}
+
+void ImageHelper::splitClearLayerRange(size_t updateIndex,
+                                       std::vector<SubresourceUpdate> *levelUpdates,
+                                       uint32_t layer,
+                                       uint32_t layerCount)
+{
+    const ClearUpdate clear         = (*levelUpdates)[updateIndex].data.clear;
+    const UpdateSource updateSource = (*levelUpdates)[updateIndex].updateSource;
+    const gl::LevelIndex levelGL(clear.levelIndex);
+
+    uint32_t clearBaseLayer, clearLayerCount;
+    (*levelUpdates)[updateIndex].getDestSubresource(mLayerCount, &clearBaseLayer,
+                                                    &clearLayerCount);
+    const uint32_t clearLayerEnd = clearBaseLayer + clearLayerCount;
+    const uint32_t layerEnd      = layer + layerCount;
+
+    // Replace the clear with the clears of the layers before and after the given range, in place
+    // so their order relative to the updates of other layers is preserved.
+    std::vector<SubresourceUpdate> remainingClears;
+    if (clearBaseLayer < layer)
+    {
+        remainingClears.emplace_back(clear.aspectFlags, clear.value, levelGL, clearBaseLayer,
+                                     layer - clearBaseLayer);
+    }
+    if (layerEnd < clearLayerEnd)
+    {
+        remainingClears.emplace_back(clear.aspectFlags, clear.value, levelGL, layerEnd,
+                                     clearLayerEnd - layerEnd);
+    }
+    for (SubresourceUpdate &remainingClear : remainingClears)
+    {
+        remainingClear.updateSource = updateSource;
+    }
+
+    levelUpdates->erase(levelUpdates->begin() + updateIndex);
+    levelUpdates->insert(levelUpdates->begin() + updateIndex,
+                         std::make_move_iterator(remainingClears.begin()),
+                         std::make_move_iterator(remainingClears.end()));
+}
+
 angle::Result ImageHelper::flushStagedClearEmulatedChannelsUpdates(ContextVk *contextVk,
                                                                    gl::LevelIndex levelGLStart,
                                                                    gl::LevelIndex levelGLLimit,
@@ -10048,6 +10658,96 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
             adjustLayerRange(*levelUpdates, &adjustedLayerStart, &adjustedLayerEnd);
         }
 
+        // Many small uploads (such as glyphs uploaded to an atlas) result in many buffer updates
+        // to the same layers of a level, typically suballocated from the same staging VkBuffer.
+        // Consecutive such updates that write to disjoint regions of the image are batched and
+        // recorded with a single vkCmdCopyBufferToImage.  Only the first update of the batch goes
+        // through the barrier logic below; the rest write to the same layers but don't overlap
+        // with the batch, so they need no barrier between them.
+        std::vector<SubresourceUpdate> batchedBufferUpdates;
+        std::vector<VkBufferImageCopy> batchedCopyRegions;
+
+        auto canAddToBufferUpdateBatch = [&](const SubresourceUpdate &update) {
+            if (batchedBufferUpdates.empty() || transCoding ||
+                update.updateSource != UpdateSource::Buffer ||
+                batchedCopyRegions.size() >= kMaxBatchedBufferUpdateCopies)
+            {
+                return false;
+            }
+
+            const BufferUpdate &first           = batchedBufferUpdates.front().data.buffer;
+            const VkBufferImageCopy &copyRegion = update.data.buffer.copyRegion;
+            if (update.data.buffer.bufferHelper->getBuffer().getHandle() !=
+                    first.bufferHelper->getBuffer().getHandle() ||
+                copyRegion.imageSubresource.aspectMask !=
+                    first.copyRegion.imageSubresource.aspectMask ||
+                copyRegion.imageSubresource.baseArrayLayer !=
+                    first.copyRegion.imageSubresource.baseArrayLayer ||
+                copyRegion.imageSubresource.layerCount !=
+                    first.copyRegion.imageSubresource.layerCount)
+            {
+                return false;
+            }
+
+            for (const VkBufferImageCopy &batchedRegion : batchedCopyRegions)
+            {
+                if (DoBufferImageCopiesOverlap(batchedRegion, copyRegion))
+                {
+                    return false;
+                }
+            }
+            return true;
+        };
+
+        auto flushBufferUpdateBatch = [&]() -> angle::Result {
+            if (batchedBufferUpdates.empty())
+            {
+                return angle::Result::Continue;
+            }
+
+            CommandBufferAccess bufferAccess;
+            VkDeviceSize batchSize = 0;
+            for (SubresourceUpdate &batchedUpdate : batchedBufferUpdates)
+            {
+                BufferHelper *currentBuffer = batchedUpdate.data.buffer.bufferHelper;
+                ANGLE_TRY(currentBuffer->flush(renderer));
+                bufferAccess.onBufferTransferRead(currentBuffer);
+                batchSize += currentBuffer->getSize();
+            }
+            ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper(bufferAccess,
+                                                                          &commandBuffer));
+
+            const VkBuffer srcBuffer =
+                batchedBufferUpdates.front().data.buffer.bufferHelper->getBuffer().getHandle();
+            commandBuffer->getCommandBuffer().copyBufferToImage(
+                srcBuffer, mImage, getCurrentLayout(renderer),
+                static_cast<uint32_t>(batchedCopyRegions.size()), batchedCopyRegions.data());
+
+            bool commandBufferWasFlushed = false;
+            ANGLE_TRY(contextVk->onCopyUpdate(batchSize, &commandBufferWasFlushed));
+
+            for (SubresourceUpdate &batchedUpdate : batchedBufferUpdates)
+            {
+                uint32_t batchedBaseLayer, batchedLayerCount;
+                batchedUpdate.getDestSubresource(mLayerCount, &batchedBaseLayer,
+                                                 &batchedLayerCount);
+                onWrite(updateMipLevelGL, 1, batchedBaseLayer, batchedLayerCount,
+                        batchedUpdate.data.buffer.copyRegion.imageSubresource.aspectMask);
+
+                // Update total staging buffer size.
+                mTotalStagedBufferUpdateSize -= batchedUpdate.data.buffer.bufferHelper->getSize();
+                batchedUpdate.release(renderer);
+            }
+            batchedBufferUpdates.clear();
+            batchedCopyRegions.clear();
+
+            if (commandBufferWasFlushed)
+            {
+                ANGLE_TRY(contextVk->getOutsideRenderPassCommandBufferHelper({}, &commandBuffer));
+            }
+            return angle::Result::Continue;
+        };
+
         for (SubresourceUpdate &update : *levelUpdates)
         {
             ASSERT(IsClearOfAllChannels(update.updateSource) ||
@@ -10104,6 +10804,13 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
                     }
                     update.data.buffer.copyRegion.imageSubresource.mipLevel =
                         updateMipLevelVk.get();
+
+                    if (canAddToBufferUpdateBatch(update))
+                    {
+                        batchedCopyRegions.push_back(update.data.buffer.copyRegion);
+                        batchedBufferUpdates.emplace_back(std::move(update));
+                        continue;
+                    }
                     break;
                 }
                 case UpdateSource::Image:
@@ -10124,6 +10831,10 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
                 }
             }
 
+            // This update cannot be added to the current batch, so record the batch before any
+            // barrier or command of this update.
+            ANGLE_TRY(flushBufferUpdateBatch());
+
             // When a barrier is necessary when uploading updates to a level, we could instead move
             // to the next level and continue uploads in parallel.  Once all levels need a barrier,
             // a single barrier can be issued and we could continue with the rest of the updates
@@ -10213,6 +10924,16 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
                 }
                 case UpdateSource::Buffer:
                 {
+                    if (!transCoding)
+                    {
+                        // Start a new batch.  The copy is recorded once an update that cannot be
+                        // added to the batch is encountered, or at the end of the level.
+                        ASSERT(batchedBufferUpdates.empty());
+                        batchedCopyRegions.push_back(update.data.buffer.copyRegion);
+                        batchedBufferUpdates.emplace_back(std::move(update));
+                        break;
+                    }
+
                     BufferUpdate &bufferUpdate = update.data.buffer;
 
                     BufferHelper *currentBuffer = bufferUpdate.bufferHelper;
@@ -10281,13 +11002,15 @@ angle::Result ImageHelper::flushStagedUpdatesImpl(ContextVk *contextVk,
             update.release(renderer);
         }
 
+        ANGLE_TRY(flushBufferUpdateBatch());
+
         // Only remove the updates that were actually applied to the image.
         *levelUpdates = std::move(updatesToKeep);
     }
 
     // After applying the updates, the image serial should match the current queue serial of the
     // outside command buffer.
-    if (mUse.getSerials()[commandBuffer->getQueueSerial().getIndex()] !=
+    if (mUse.getSerial(commandBuffer->getQueueSerial().getIndex()) !=
         commandBuffer->getQueueSerial().getSerial())
     {
         // There has been a submission after the retainImage() call. Update the queue serial again.
@@ -10675,7 +11398,7 @@ void ImageHelper::pruneSupersededUpdatesForLevel(ContextVk *contextVk,
         else if (update.updateSource == UpdateSource::ClearPartial)
         {
             currentUpdateBox = gl::Box(
-                update.data.clearPartial.offset.x, update.data.clearPartial.offset.z,
+                update.data.clearPartial.offset.x, update.data.clearPartial.offset.y,
                 update.data.clearPartial.offset.z, update.data.clearPartial.extent.width,
                 update.data.clearPartial.extent.height, update.data.clearPartial.extent.depth);
         }
@@ -11115,9 +11838,8 @@ bool ImageHelper::canCopyWithTransformForReadPixels(const PackPixelsParams &pack
     // Only allow copies to PBOs with identical format.
     const bool isSameFormatCopy = *readFormat == *packPixelsParams.destFormat;
 
-    // Disallow any transformation.
-    const bool needsTransformation =
-        packPixelsParams.rotation != SurfaceRotation::Identity || packPixelsParams.reverseRowOrder;
+    // Disallow rotation.  A y-flip is done by copying each row separately.
+    const bool needsTransformation = packPixelsParams.rotation != SurfaceRotation::Identity;
 
     // Disallow copies when the output pitch cannot be correctly specified in Vulkan.
     const bool isPitchMultipleOfTexelSize =
@@ -11430,8 +12152,14 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
         ANGLE_TRACE_EVENT0("gpu.angle", "ImageHelper::readPixelsImpl - PBO");
 
         const ptrdiff_t pixelsOffset = reinterpret_cast<ptrdiff_t>(pixels);
-        if (canCopyWithTransformForReadPixels(packPixelsParams, srcExtent, readFormat,
-                                              pixelsOffset))
+        const bool canCopyWithTransform = canCopyWithTransformForReadPixels(
+            packPixelsParams, srcExtent, readFormat, pixelsOffset);
+        const bool canCopyWithCompute =
+            canCopyWithComputeForReadPixels(packPixelsParams, srcExtent, readFormat, pixelsOffset);
+
+        // A y-flipped transfer copy takes one region per row, so prefer the compute path for those
+        // when possible.
+        if (canCopyWithTransform && !(packPixelsParams.reverseRowOrder && canCopyWithCompute))
         {
             BufferHelper &packBuffer      = GetImpl(packPixelsParams.packBuffer)->getBuffer();
             VkDeviceSize packBufferOffset = packBuffer.getOffset();
@@ -11453,11 +12181,35 @@ angle::Result ImageHelper::readPixelsImpl(ContextVk *contextVk,
             region.imageOffset       = srcOffset;
             region.imageSubresource  = srcSubresource;
 
-            copyCommandBuffer->copyImageToBuffer(src->getImage(), src->getCurrentLayout(renderer),
-                                                 packBuffer.getBuffer().getHandle(), 1, &region);
+            if (!packPixelsParams.reverseRowOrder)
+            {
+                copyCommandBuffer->copyImageToBuffer(
+                    src->getImage(), src->getCurrentLayout(renderer),
+                    packBuffer.getBuffer().getHandle(), 1, &region);
+                return angle::Result::Continue;
+            }
+
+            // The last row of the image goes to the first row of the buffer.
+            std::vector<VkBufferImageCopy> rowRegions(srcExtent.height, region);
+            for (uint32_t row = 0; row < srcExtent.height; ++row)
+            {
+                VkBufferImageCopy &rowRegion = rowRegions[row];
+                rowRegion.bufferImageHeight  = 1;
+                rowRegion.bufferOffset =
+                    region.bufferOffset +
+                    static_cast<VkDeviceSize>(srcExtent.height - 1 - row) *
+                        packPixelsParams.outputPitch;
+                rowRegion.imageExtent.height = 1;
+                rowRegion.imageOffset.y      = srcOffset.y + static_cast<int32_t>(row);
+            }
+
+            copyCommandBuffer->copyImageToBuffer(
+                src->getImage(), src->getCurrentLayout(renderer),
+                packBuffer.getBuffer().getHandle(), static_cast<uint32_t>(rowRegions.size()),
+                rowRegions.data());
             return angle::Result::Continue;
         }
-        if (canCopyWithComputeForReadPixels(packPixelsParams, srcExtent, readFormat, pixelsOffset))
+        if (canCopyWithCompute)
         {
             ANGLE_TRY(readPixelsWithCompute(contextVk, src, packPixelsParams, srcOffset, srcExtent,
                                             pixelsOffset, srcSubresource));
@@ -12016,6 +12768,97 @@ ComputePipelineOptions GetComputePipelineOptions(vk::PipelineRobustness robustne
     return pipelineOptions;
 }
 
+// ImageRecycler implementation.
+ImageRecycler::ImageRecycler() : mTotalSize(0) {}
+
+ImageRecycler::~ImageRecycler()
+{
+    ASSERT(mImages.empty());
+}
+
+void ImageRecycler::recycle(Renderer *renderer, RecycledImage &&recycledImage)
+{
+    // Keep the pool small; it only needs to hold the images released in about a frame.
+    constexpr size_t kMaxImageCount      = 16;
+    constexpr VkDeviceSize kMaxTotalSize = 64 * 1024 * 1024;
+
+    mTotalSize += recycledImage.allocationSize;
+    mImages.push_back(std::move(recycledImage));
+
+    while (mImages.size() > kMaxImageCount || mTotalSize > kMaxTotalSize)
+    {
+        releaseOldest(renderer);
+    }
+}
+
+bool ImageRecycler::fetch(Renderer *renderer,
+                          const VkImageCreateInfo &createInfo,
+                          const ImageHelper::ImageFormats &viewFormats,
+                          RecycledImage *recycledImageOut)
+{
+    for (auto iter = mImages.begin(); iter != mImages.end(); ++iter)
+    {
+        const VkImageCreateInfo &recycledInfo = iter->createInfo;
+        if (recycledInfo.flags != createInfo.flags ||
+            recycledInfo.imageType != createInfo.imageType ||
+            recycledInfo.format != createInfo.format ||
+            recycledInfo.extent.width != createInfo.extent.width ||
+            recycledInfo.extent.height != createInfo.extent.height ||
+            recycledInfo.extent.depth != createInfo.extent.depth ||
+            recycledInfo.mipLevels != createInfo.mipLevels ||
+            recycledInfo.arrayLayers != createInfo.arrayLayers ||
+            recycledInfo.samples != createInfo.samples ||
+            recycledInfo.tiling != createInfo.tiling || recycledInfo.usage != createInfo.usage ||
+            !(iter->viewFormats == viewFormats))
+        {
+            continue;
+        }
+
+        // Only images the GPU is done with are reused, so no synchronization with their previous
+        // uses is needed.
+        if (!renderer->hasResourceUseFinished(iter->use))
+        {
+            continue;
+        }
+
+        mTotalSize -= iter->allocationSize;
+        *recycledImageOut = std::move(*iter);
+        mImages.erase(iter);
+        return true;
+    }
+
+    return false;
+}
+
+void ImageRecycler::releaseAll(Renderer *renderer)
+{
+    while (!mImages.empty())
+    {
+        releaseOldest(renderer);
+    }
+}
+
+void ImageRecycler::releaseOldest(Renderer *renderer)
+{
+    RecycledImage &oldest = mImages.front();
+
+    if (oldest.deviceMemory.valid())
+    {
+        renderer->onMemoryDealloc(oldest.allocationType, oldest.allocationSize,
+                                  oldest.memoryTypeIndex, oldest.deviceMemory.getHandle());
+    }
+    if (oldest.vmaAllocation.valid())
+    {
+        renderer->onMemoryDealloc(oldest.allocationType, oldest.allocationSize,
+                                  oldest.memoryTypeIndex, oldest.vmaAllocation.getHandle());
+    }
+    renderer->collectGarbage(oldest.use, &oldest.image, &oldest.deviceMemory,
+                             &oldest.vmaAllocation);
+
+    mTotalSize -= oldest.allocationSize;
+    mImages.pop_front();
+}
+
 // ImageViewHelper implementation.
 ImageViewHelper::ImageViewHelper()
     : mCurrentBaseMaxLevelHash(0),
@@ -13046,10 +13889,12 @@ void CommandBufferAccess::onBufferRead(VkAccessFlags readAccessType,
 
 void CommandBufferAccess::onBufferWrite(VkAccessFlags writeAccessType,
                                         PipelineStage writeStage,
-                                        BufferHelper *buffer)
+                                        BufferHelper *buffer,
+                                        VkDeviceSize writeOffset,
+                                        VkDeviceSize writeSize)
 {
     ASSERT(!buffer->isReleasedToExternal());
-    mWriteBuffers.emplace_back(buffer, writeAccessType, writeStage);
+    mWriteBuffers.emplace_back(buffer, writeAccessType, writeStage, writeOffset, writeSize);
 }
 
 void CommandBufferAccess::onImageRead(VkImageAspectFlags aspectFlags,
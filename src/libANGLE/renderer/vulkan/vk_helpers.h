@@ -12,11 +12,13 @@
 #include "common/MemoryBuffer.h"
 #include "common/SimpleMutex.h"
 #include "libANGLE/renderer/vulkan/MemoryTracking.h"
+#include "libANGLE/renderer/vulkan/ParallelCommandEncoder.h"
 #include "libANGLE/renderer/vulkan/Suballocation.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 #include "libANGLE/renderer/vulkan/vk_ref_counted_event.h"
 
+#include <deque>
 #include <functional>
 
 namespace gl
@@ -1015,6 +1017,13 @@ class BufferHelper : public ReadWriteResource
                                VkMemoryPropertyFlags memoryProperties,
                                const VkBufferCreateInfo &requestedCreateInfo,
                                GLeglClientBufferEXT clientBuffer);
+    // Imports |hostPtr| with VK_EXT_external_memory_host as the memory of the buffer, which must be
+    // as large as the buffer.  Fails if the allocation can't be imported as coherent memory, in
+    // which case the caller is expected to fall back to a regular allocation.
+    VkResult initHostExternal(Context *context,
+                              VkMemoryPropertyFlags memoryProperties,
+                              const VkBufferCreateInfo &requestedCreateInfo,
+                              void *hostPtr);
     VkResult initSuballocation(Context *context,
                                uint32_t memoryTypeIndex,
                                size_t size,
@@ -1080,16 +1089,41 @@ class BufferHelper : public ReadWriteResource
     // Returns true if the image is owned by an external API or instance.
     bool isReleasedToExternal() const;
 
-    void recordReadBarrier(VkAccessFlags readAccessType,
+    // Transfer writes that don't overlap don't need a barrier between them, so a write to a range
+    // that is disjoint from the ones the command buffer with |queueSerial| has written so far can
+    // be recorded in that command buffer, covered by the barrier of its first write.  Any other
+    // access to the buffer ends the tracking of the written range.
+    bool canShareTransferWriteCommandBuffer(const QueueSerial &queueSerial,
+                                            VkDeviceSize offset,
+                                            VkDeviceSize size) const;
+    void onTransferWriteRange(const QueueSerial &queueSerial,
+                              VkDeviceSize offset,
+                              VkDeviceSize size);
+
+    // If the last write is tracked by an event of the same queue, the read waits for that event
+    // instead of issuing a pipeline barrier.
+    void recordReadBarrier(Context *context,
+                           VkAccessFlags readAccessType,
                            VkPipelineStageFlags readStage,
                            PipelineStage stageIndex,
-                           PipelineBarrierArray *barriers);
+                           PipelineBarrierArray *pipelineBarriers,
+                           EventBarrierArray *eventBarriers,
+                           RefCountedEventCollector *eventCollector);
 
-    void recordWriteBarrier(VkAccessFlags writeAccessType,
+    void recordWriteBarrier(Context *context,
+                            VkAccessFlags writeAccessType,
                             VkPipelineStageFlags writeStage,
                             PipelineStage stageIndex,
                             PipelineBarrierArray *barriers);
 
+    // Tracks the write that was just recorded with the command buffer's event for |writeStage|.
+    void setCurrentWriteRefCountedEvent(Context *context,
+                                        PipelineStage writeStage,
+                                        EventMaps &eventMaps);
+    // For writes that are recorded without a barrier, which the previous write's event can't
+    // track.
+    void releaseCurrentWriteEvent(Context *context) { mCurrentWriteEvent.release(context); }
+
     void fillWithColor(const angle::Color<uint8_t> &color,
                        const gl::InternalFormat &internalFormat);
 
@@ -1145,6 +1179,15 @@ class BufferHelper : public ReadWriteResource
     VkFlags mCurrentReadAccess;
     VkPipelineStageFlags mCurrentWriteStages;
     VkPipelineStageFlags mCurrentReadStages;
+    // The event that is set after the last write, and the queue it can be waited on.  Only valid
+    // when useVkEventForBufferBarrier is enabled.
+    RefCountedEvent mCurrentWriteEvent;
+    DeviceQueueIndex mCurrentWriteEventQueueIndex;
+    // The range written by the transfers of the command buffer with this serial, if it has no
+    // other access to the buffer.
+    QueueSerial mTransferWriteRangeQueueSerial;
+    VkDeviceSize mTransferWriteRangeStart;
+    VkDeviceSize mTransferWriteRangeEnd;
 
     BufferSerial mSerial;
     // Manages the descriptorSet cache that created with this BufferHelper object.
@@ -1181,6 +1224,12 @@ class BufferPool : angle::NonCopyable
     void destroy(Renderer *renderer, bool orphanAllowed);
     // Remove and destroy empty BufferBlocks
     void pruneEmptyBuffers(Renderer *renderer);
+    // Like pruneEmptyBuffers, but doesn't keep any empty BufferBlock around for future
+    // suballocations.
+    void releaseEmptyBuffers(Renderer *renderer);
+    // Marks the least used BufferBlock as evacuating if it is sparse enough, so that its buffers
+    // can be relocated and the block freed.  Returns true if a block of this pool is evacuating.
+    bool selectBlockForEvacuation();
 
     bool valid() const { return mSize != 0; }
 
@@ -1203,6 +1252,13 @@ class BufferPool : angle::NonCopyable
     // Tracks the number of new buffers needed for suballocation since last pruneEmptyBuffers call.
     // We will use this heuristic information to decide how many empty buffers to keep around.
     size_t mNumberOfNewBuffersNeededSinceLastPrune;
+    // Number of selectBlockForEvacuation calls that found the same block still evacuating.  If the
+    // block can't be emptied in kMaxBufferBlockEvacuationAttempts calls (for example because its
+    // buffers are mapped), the evacuation is abandoned.
+    uint32_t mEvacuationAttempts;
+    static constexpr uint32_t kMaxBufferBlockEvacuationAttempts = 4;
+    // A block is evacuated if less than 1/kBufferBlockEvacuationUsageRatio of it is in use.
+    static constexpr VkDeviceSize kBufferBlockEvacuationUsageRatio = 4;
     // max size to go down the suballocation code path. Any allocation greater or equal this size
     // will call into vulkan directly to allocate a dedicated VkDeviceMemory.
     static constexpr size_t kMaxBufferSizeForSuballocation = 4 * 1024 * 1024;
@@ -1233,6 +1289,7 @@ class PackedClearValuesArray final
 
 class ImageHelper;
 using ImageHelperPtr = ImageHelper *;
+class ImageRecycler;
 
 // Reference to a render pass attachment (color or depth/stencil) alongside render-pass-related
 // tracking such as when the attachment is last written to or invalidated.  This is used to
@@ -1394,19 +1451,26 @@ constexpr uint32_t kInfiniteCmdCount = 0xFFFFFFFF;
 class CommandBufferHelperCommon : angle::NonCopyable
 {
   public:
-    void bufferWrite(VkAccessFlags writeAccessType, PipelineStage writeStage, BufferHelper *buffer);
-
-    void bufferRead(VkAccessFlags readAccessType, PipelineStage readStage, BufferHelper *buffer)
+    void bufferWrite(Context *context,
+                     VkAccessFlags writeAccessType,
+                     PipelineStage writeStage,
+                     BufferHelper *buffer);
+
+    void bufferRead(Context *context,
+                    VkAccessFlags readAccessType,
+                    PipelineStage readStage,
+                    BufferHelper *buffer)
     {
-        bufferReadImpl(readAccessType, readStage, buffer);
+        bufferReadImpl(context, readAccessType, readStage, buffer);
         setBufferReadQueueSerial(buffer);
     }
 
-    void bufferRead(VkAccessFlags readAccessType,
+    void bufferRead(Context *context,
+                    VkAccessFlags readAccessType,
                     const gl::ShaderBitSet &readShaderStages,
                     BufferHelper *buffer)
     {
-        bufferReadImpl(readAccessType, readShaderStages, buffer);
+        bufferReadImpl(context, readAccessType, readShaderStages, buffer);
         setBufferReadQueueSerial(buffer);
     }
 
@@ -1496,17 +1560,19 @@ class CommandBufferHelperCommon : angle::NonCopyable
     template <class DerivedT>
     void assertCanBeRecycledImpl();
 
-    void bufferReadImpl(VkAccessFlags readAccessType,
+    void bufferReadImpl(Context *context,
+                        VkAccessFlags readAccessType,
                         PipelineStage readStage,
                         BufferHelper *buffer);
-    void bufferReadImpl(VkAccessFlags readAccessType,
+    void bufferReadImpl(Context *context,
+                        VkAccessFlags readAccessType,
                         const gl::ShaderBitSet &readShaderStages,
                         BufferHelper *buffer)
     {
         for (gl::ShaderType shaderType : readShaderStages)
         {
             const vk::PipelineStage readStage = vk::GetPipelineStage(shaderType);
-            bufferReadImpl(readAccessType, readStage, buffer);
+            bufferReadImpl(context, readAccessType, readStage, buffer);
         }
     }
     void imageReadImpl(Context *context,
@@ -2009,12 +2075,13 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
 
     bool isDefault() const { return mFramebuffer.isDefault(); }
 
-  private:
-    uint32_t getSubpassCommandBufferCount() const { return mCurrentSubpassCommandBufferIndex + 1; }
-
-    angle::Result initializeCommandBuffer(Context *context);
-    angle::Result beginRenderPassCommandBuffer(ContextVk *contextVk);
-    angle::Result endRenderPassCommandBuffer(ContextVk *contextVk);
+    // Parallel encoding of the render pass commands.  See ParallelCommandEncoder.
+    bool shouldInsertParallelEncodeBoundary()
+    {
+        return getRenderPassWriteCommandCount() - mParallelEncodeChunkStartWriteCommandCount >=
+               ParallelCommandEncoder::kWriteCommandsPerChunk;
+    }
+    void insertParallelEncodeBoundary(ParallelCommandEncoder *encoder);
 
     uint32_t getRenderPassWriteCommandCount()
     {
@@ -2023,6 +2090,13 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
         return mPreviousSubpassesCmdCount + getCommandBuffer().getRenderPassWriteCommandCount();
     }
 
+  private:
+    uint32_t getSubpassCommandBufferCount() const { return mCurrentSubpassCommandBufferIndex + 1; }
+
+    angle::Result initializeCommandBuffer(Context *context);
+    angle::Result beginRenderPassCommandBuffer(ContextVk *contextVk);
+    angle::Result endRenderPassCommandBuffer(ContextVk *contextVk);
+
     void updateStartedRenderPassWithDepthStencilMode(RenderPassAttachment *resolveAttachment,
                                                      bool renderPassHasWriteOrClear,
                                                      RenderPassUsageFlags dsUsageFlags,
@@ -2094,6 +2168,11 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     ImageHelper *mImageOptimizeForPresent;
     ImageLayout mImageOptimizeForPresentOriginalLayout;
 
+    // If the render pass commands are split in chunks, the encoder used to encode them in
+    // parallel, and the write command count at the start of the last chunk.
+    ParallelCommandEncoder *mParallelCommandEncoder;
+    uint32_t mParallelEncodeChunkStartWriteCommandCount;
+
     friend class CommandBufferHelperCommon;
 };
 
@@ -2216,7 +2295,8 @@ class ImageHelper final : public Resource, public angle::Subject
                                bool isRobustResourceInitEnabled,
                                bool hasProtectedContent,
                                YcbcrConversionDesc conversionDesc,
-                               const void *compressionControl);
+                               const void *compressionControl,
+                               ImageRecycler *recycler);
     VkResult initMemory(Context *context,
                         const MemoryProperties &memoryProperties,
                         VkMemoryPropertyFlags flags,
@@ -2370,6 +2450,15 @@ class ImageHelper final : public Resource, public angle::Subject
     void finalizeImageLayoutInShareContexts(Renderer *renderer,
                                             ContextVk *contextVk,
                                             UniqueSerial imageSiblingSerial);
+    // Similar to releaseImageFromShareContexts, but hands the VkImage and its memory to |recycler|
+    // instead of the garbage list, so a later image of the same description can reuse them.
+    void releaseImageToRecycler(Renderer *renderer,
+                                ContextVk *contextVk,
+                                UniqueSerial imageSiblingSerial,
+                                ImageRecycler *recycler);
+    // Whether the image already has its memory bound, which is the case when initExternal reused
+    // a recycled image.
+    bool hasMemory() const { return mDeviceMemory.valid() || mVmaAllocation.valid(); }
 
     void releaseStagedUpdates(Renderer *renderer);
 
@@ -2880,6 +2969,16 @@ class ImageHelper final : public Resource, public angle::Subject
     void restoreSubresourceStencilContent(gl::LevelIndex level,
                                           uint32_t layerIndex,
                                           uint32_t layerCount);
+
+    // Store op inference for color attachments (see the inferAttachmentStoreOps feature).  Called
+    // when a render pass that writes to this image with storeOp=STORE is finalized.  Returns true
+    // if the image's contents have been repeatedly overwritten without being read, in which case
+    // the store can be dropped.
+    bool inferStoreOpDontCare(RenderPassLoadOp loadOp);
+    // Called whenever the image is read, which ends the current overwrite streak.  If the last
+    // store was dropped by inference, the prediction was wrong and inference is disabled for this
+    // image from then on.
+    void onStoreOpInferenceRead();
     angle::Result reformatStagedBufferUpdates(ContextVk *contextVk,
                                               angle::FormatID srcFormatID,
                                               angle::FormatID dstFormatID);
@@ -3040,6 +3139,11 @@ class ImageHelper final : public Resource, public angle::Subject
 
     void deriveExternalImageTiling(const void *createInfoChain);
 
+    // The garbage goes through |contextVk| when given, so it can be part of an object deletion
+    // batch.
+    void releaseImage(Renderer *renderer, ContextVk *contextVk);
+    void resetImageStateOnRelease();
+
     // Used to initialize ImageFormats from actual format, with no pNext from a VkImageCreateInfo
     // object.
     void setImageFormatsFromActualFormat(VkFormat actualFormat, ImageFormats &imageFormatsOut);
@@ -3049,6 +3153,16 @@ class ImageHelper final : public Resource, public angle::Subject
     // extents are not known).
     void removeSupersededUpdates(ContextVk *contextVk, const gl::TexLevelMask skipLevelsAllFaces);
 
+    // Whether a clear covers [layer, layer + layerCount) and more layers, in which case it is split
+    // so that the given range can be cleared through the render pass loadOp instead.
+    bool isClearOfMoreLayers(const SubresourceUpdate &update,
+                             uint32_t layer,
+                             uint32_t layerCount) const;
+    void splitClearLayerRange(size_t updateIndex,
+                              std::vector<SubresourceUpdate> *levelUpdates,
+                              uint32_t layer,
+                              uint32_t layerCount);
+
     void initImageMemoryBarrierStruct(Renderer *renderer,
                                       VkImageAspectFlags aspectMask,
                                       ImageLayout newLayout,
@@ -3253,14 +3367,6 @@ class ImageHelper final : public Resource, public angle::Subject
         return actualFormatLinear == srcDataFormatIDLinear;
     }
 
-    static constexpr int kThreadholdForComputeTransCoding = 4096;
-    bool shouldUseComputeForTransCoding(LevelIndex level)
-    {
-        // Using texture size instead of extent size to simplify the problem.
-        gl::Extents ext = getLevelExtents2D(level);
-        return ext.width * ext.height > kThreadholdForComputeTransCoding;
-    }
-
     void adjustLayerRange(const std::vector<SubresourceUpdate> &levelUpdates,
                           uint32_t *layerStart,
                           uint32_t *layerEnd);
@@ -3344,6 +3450,13 @@ class ImageHelper final : public Resource, public angle::Subject
     gl::TexLevelArray<LevelContentDefinedMask> mContentDefined;
     gl::TexLevelArray<LevelContentDefinedMask> mStencilContentDefined;
 
+    // Store op inference state.  mUnconsumedStoreCount counts how many times in a row the stored
+    // contents of the image were overwritten by a later render pass without being read in between.
+    uint8_t mUnconsumedStoreCount;
+    bool mHasUnconsumedStore;
+    bool mStoreDroppedByInference;
+    bool mStoreOpInferenceDisabled;
+
     // Used for memory allocation tracking.
     // Memory size allocated for the image in the memory during the initialization.
     VkDeviceSize mAllocationSize;
@@ -3373,6 +3486,50 @@ ANGLE_INLINE bool RenderPassCommandBufferHelper::startedAndUsesImageWithBarrier(
     return mRenderPassStarted && image.getBarrierQueueSerial() == mQueueSerial;
 }
 
+// A small pool of the VkImages of released textures, along with their memory.  Applications that
+// delete and recreate (or redefine) textures of the same description every frame can then reuse
+// an image the GPU is done with instead of creating a new one and allocating its memory.  The pool
+// is per share group, and is accessed under the share group lock.
+class ImageRecycler final : angle::NonCopyable
+{
+  public:
+    struct RecycledImage
+    {
+        VkImageCreateInfo createInfo;
+        ImageHelper::ImageFormats viewFormats;
+        ResourceUse use;
+        Image image;
+        DeviceMemory deviceMemory;
+        Allocation vmaAllocation;
+        VkDeviceSize allocationSize;
+        MemoryAllocationType allocationType;
+        uint32_t memoryTypeIndex;
+    };
+
+    ImageRecycler();
+    ~ImageRecycler();
+
+    // Takes ownership of the image, evicting the oldest images if the pool gets too large.
+    void recycle(Renderer *renderer, RecycledImage &&recycledImage);
+    // Finds an image that the GPU has finished with and matches |createInfo| and |viewFormats|.
+    bool fetch(Renderer *renderer,
+               const VkImageCreateInfo &createInfo,
+               const ImageHelper::ImageFormats &viewFormats,
+               RecycledImage *recycledImageOut);
+
+    // Sends all the images to the garbage list, for example under memory pressure.
+    void releaseAll(Renderer *renderer);
+
+    size_t getImageCount() const { return mImages.size(); }
+    VkDeviceSize getTotalSize() const { return mTotalSize; }
+
+  private:
+    void releaseOldest(Renderer *renderer);
+
+    std::deque<RecycledImage> mImages;
+    VkDeviceSize mTotalSize;
+};
+
 // A vector of image views, such as one per level or one per layer.
 using ImageViewVector = std::vector<ImageView>;
 
@@ -3909,6 +4066,10 @@ struct CommandBufferBufferAccess
     BufferHelper *buffer;
     VkAccessFlags accessType;
     PipelineStage stage;
+    // The range that is written by a transfer, in the offsets of the VkBuffer.  The whole buffer
+    // is assumed written unless specified.
+    VkDeviceSize writeOffset = 0;
+    VkDeviceSize writeSize   = VK_WHOLE_SIZE;
 };
 struct CommandBufferImageAccess
 {
@@ -3946,6 +4107,11 @@ class CommandBufferAccess : angle::NonCopyable
     {
         onBufferWrite(VK_ACCESS_TRANSFER_WRITE_BIT, PipelineStage::Transfer, buffer);
     }
+    // Transfer writes to disjoint ranges of the same buffer can share a command buffer.
+    void onBufferTransferWrite(BufferHelper *buffer, VkDeviceSize offset, VkDeviceSize size)
+    {
+        onBufferWrite(VK_ACCESS_TRANSFER_WRITE_BIT, PipelineStage::Transfer, buffer, offset, size);
+    }
     void onBufferSelfCopy(BufferHelper *buffer)
     {
         onBufferWrite(VK_ACCESS_TRANSFER_READ_BIT | VK_ACCESS_TRANSFER_WRITE_BIT,
@@ -4067,7 +4233,9 @@ class CommandBufferAccess : angle::NonCopyable
     void onBufferRead(VkAccessFlags readAccessType, PipelineStage readStage, BufferHelper *buffer);
     void onBufferWrite(VkAccessFlags writeAccessType,
                        PipelineStage writeStage,
-                       BufferHelper *buffer);
+                       BufferHelper *buffer,
+                       VkDeviceSize writeOffset = 0,
+                       VkDeviceSize writeSize   = VK_WHOLE_SIZE);
 
     void onImageRead(VkImageAspectFlags aspectFlags, ImageLayout imageLayout, ImageHelper *image);
     void onImageWrite(gl::LevelIndex levelStart,
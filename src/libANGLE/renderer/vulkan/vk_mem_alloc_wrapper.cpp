@@ -102,6 +102,7 @@ VkResult AllocateAndBindMemoryForImage(VmaAllocator allocator,
                                        VkMemoryPropertyFlags preferredFlags,
                                        uint32_t memoryTypeBits,
                                        bool allocateDedicatedMemory,
+                                       VmaPool pool,
                                        VmaAllocation *pAllocationOut,
                                        uint32_t *pMemoryTypeIndexOut,
                                        VkDeviceSize *sizeOut)
@@ -113,6 +114,7 @@ VkResult AllocateAndBindMemoryForImage(VmaAllocator allocator,
     allocationCreateInfo.memoryTypeBits          = memoryTypeBits;
     allocationCreateInfo.flags =
         allocateDedicatedMemory ? VMA_ALLOCATION_CREATE_DEDICATED_MEMORY_BIT : 0;
+    allocationCreateInfo.pool        = pool;
     VmaAllocationInfo allocationInfo = {};
 
     result = vmaAllocateMemoryForImage(allocator, *pImage, &allocationCreateInfo, pAllocationOut,
@@ -175,6 +177,28 @@ void GetMemoryTypeProperties(VmaAllocator allocator,
     vmaGetMemoryTypeProperties(allocator, memoryTypeIndex, pFlags);
 }
 
+VkResult CreatePool(VmaAllocator allocator,
+                    uint32_t memoryTypeIndex,
+                    VkDeviceSize blockSize,
+                    VmaPool *pPool)
+{
+    VmaPoolCreateInfo poolCreateInfo = {};
+    poolCreateInfo.memoryTypeIndex   = memoryTypeIndex;
+    poolCreateInfo.blockSize         = blockSize;
+
+    return vmaCreatePool(allocator, &poolCreateInfo, pPool);
+}
+
+void DestroyPool(VmaAllocator allocator, VmaPool pool)
+{
+    vmaDestroyPool(allocator, pool);
+}
+
+void GetPoolStats(VmaAllocator allocator, VmaPool pool, StatInfo::BasicInfo *pStats)
+{
+    vmaGetPoolStatistics(allocator, pool, reinterpret_cast<VmaStatistics *>(pStats));
+}
+
 VkResult MapMemory(VmaAllocator allocator, VmaAllocation allocation, void **ppData)
 {
     return vmaMapMemory(allocator, allocation, ppData);
@@ -76,6 +76,7 @@ VkResult AllocateAndBindMemoryForImage(VmaAllocator allocator,
                                        VkMemoryPropertyFlags preferredFlags,
                                        uint32_t memoryTypeBits,
                                        bool allocateDedicatedMemory,
+                                       VmaPool pool,
                                        VmaAllocation *pAllocationOut,
                                        uint32_t *pMemoryTypeIndexOut,
                                        VkDeviceSize *sizeOut);
@@ -98,6 +99,13 @@ void GetMemoryTypeProperties(VmaAllocator allocator,
                              uint32_t memoryTypeIndex,
                              VkMemoryPropertyFlags *pFlags);
 
+VkResult CreatePool(VmaAllocator allocator,
+                    uint32_t memoryTypeIndex,
+                    VkDeviceSize blockSize,
+                    VmaPool *pPool);
+void DestroyPool(VmaAllocator allocator, VmaPool pool);
+void GetPoolStats(VmaAllocator allocator, VmaPool pool, StatInfo::BasicInfo *pStats);
+
 VkResult MapMemory(VmaAllocator allocator, VmaAllocation allocation, void **ppData);
 
 void UnmapMemory(VmaAllocator allocator, VmaAllocation allocation);
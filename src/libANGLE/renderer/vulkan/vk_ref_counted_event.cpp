@@ -411,6 +411,29 @@ void EventBarrierArray::addImageEvent(Renderer *renderer,
                            imageMemoryBarrier);
 }
 
+void EventBarrierArray::addBufferMemoryEvent(Renderer *renderer,
+                                             const RefCountedEvent &waitEvent,
+                                             VkAccessFlags srcAccess,
+                                             VkPipelineStageFlags dstStageMask,
+                                             VkAccessFlags dstAccess)
+{
+    ASSERT(waitEvent.valid());
+    for (EventBarrier &barrier : mBarriers)
+    {
+        if (barrier.hasEvent(waitEvent.getEvent().getHandle()) &&
+            barrier.mImageMemoryBarrierCount == 0)
+        {
+            barrier.mMemoryBarrierSrcAccess |= srcAccess;
+            barrier.addAdditionalStageAccess(dstStageMask, dstAccess);
+            return;
+        }
+    }
+
+    VkPipelineStageFlags srcStageFlags = renderer->getEventPipelineStageMask(waitEvent);
+    mBarriers.emplace_back(srcStageFlags, dstStageMask, srcAccess, dstAccess,
+                           waitEvent.getEvent().getHandle());
+}
+
 void EventBarrierArray::execute(Renderer *renderer, PrimaryCommandBuffer *primary)
 {
     while (!mBarriers.empty())
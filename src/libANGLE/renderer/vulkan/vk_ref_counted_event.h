@@ -510,6 +510,14 @@ class EventBarrierArray final
                        VkPipelineStageFlags dstStageMask,
                        const VkImageMemoryBarrier &imageMemoryBarrier);
 
+    // Buffers don't use VkBufferMemoryBarrier, so the waits for the same event are merged into one
+    // global memory barrier.
+    void addBufferMemoryEvent(Renderer *renderer,
+                              const RefCountedEvent &waitEvent,
+                              VkAccessFlags srcAccess,
+                              VkPipelineStageFlags dstStageMask,
+                              VkAccessFlags dstAccess);
+
     void reset() { ASSERT(mBarriers.empty()); }
 
     void addDiagnosticsString(std::ostringstream &out) const;
@@ -14,6 +14,7 @@
 
 #include <EGL/eglext.h>
 #include <fstream>
+#include <thread>
 
 #include "common/debug.h"
 #include "common/platform.h"
@@ -85,6 +86,11 @@ constexpr uint32_t kPreferredDefaultUniformBufferSize = 64 * 1024u;
 // value will use a dedicated VkDeviceMemory.
 constexpr size_t kImageSizeThresholdForDedicatedMemoryAllocation = 4 * 1024 * 1024;
 
+// With useSmallImageMemoryPools, images smaller than this are suballocated from a pool of their
+// memory type, each pool allocating VkDeviceMemory blocks of kSmallImagePoolBlockSize.
+constexpr VkDeviceSize kSmallImagePoolSizeThreshold = 256 * 1024;
+constexpr VkDeviceSize kSmallImagePoolBlockSize     = 4 * 1024 * 1024;
+
 // Pipeline cache header version. It should be incremented any time there is an update to the cache
 // header or data structure.
 constexpr uint32_t kPipelineCacheVersion = 3;
@@ -888,6 +894,30 @@ gl::Version LimitVersionTo(const gl::Version &current, const gl::Version &lower)
     return true;
 }
 
+// Finds the first memory type allowed by |memoryTypeBits| that has all of |propertyFlags| set,
+// and that is not protected or lazily allocated unless requested.
+uint32_t FindSmallImagePoolMemoryType(Renderer *renderer,
+                                      VkMemoryPropertyFlags propertyFlags,
+                                      uint32_t memoryTypeBits)
+{
+    constexpr VkMemoryPropertyFlags kUnrequestedFlagsMask =
+        VK_MEMORY_PROPERTY_PROTECTED_BIT | VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT;
+
+    const vk::MemoryProperties &memoryProperties = renderer->getMemoryProperties();
+    for (size_t memoryIndex : angle::BitSet<32>(memoryTypeBits))
+    {
+        VkMemoryPropertyFlags memoryFlags =
+            memoryProperties.getMemoryType(static_cast<uint32_t>(memoryIndex)).propertyFlags;
+        if ((memoryFlags & propertyFlags) == propertyFlags &&
+            (memoryFlags & ~propertyFlags & kUnrequestedFlagsMask) == 0)
+        {
+            return static_cast<uint32_t>(memoryIndex);
+        }
+    }
+
+    return kInvalidMemoryTypeIndex;
+}
+
 // Exclude memory type indices that include the host-visible bit from VMA image suballocation.
 uint32_t GetMemoryTypeBitsExcludingHostVisible(Renderer *renderer,
                                                VkMemoryPropertyFlags propertyFlags,
@@ -1002,6 +1032,7 @@ void UnpackHeaderDataForPipelineCache(CacheDataHeader *data,
 }
 
 void ComputePipelineCacheVkChunkKey(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                    const size_t shardIndex,
                                     const size_t slotIndex,
                                     const size_t chunkIndex,
                                     angle::BlobCacheKey *hashOut)
@@ -1018,6 +1049,13 @@ void ComputePipelineCacheVkChunkKey(const VkPhysicalDeviceProperties &physicalDe
     hashStream << std::hex << physicalDeviceProperties.vendorID;
     hashStream << std::hex << physicalDeviceProperties.deviceID;
 
+    // Add shardIndex to generate unique keys for each shard.  The first shard is the only one used
+    // without shardPipelineCacheInBlobCache, so it's left out of the key to keep that key stable.
+    if (shardIndex != 0)
+    {
+        hashStream << "s" << std::hex << static_cast<uint32_t>(shardIndex) << "s";
+    }
+
     // Add slotIndex to generate unique keys for each slot.
     hashStream << std::hex << static_cast<uint32_t>(slotIndex);
 
@@ -1046,6 +1084,7 @@ PipelineCacheVkChunkInfos GetPipelineCacheVkChunkInfos(Renderer *renderer,
                                                        const angle::MemoryBuffer &compressedData,
                                                        const size_t numChunks,
                                                        const size_t chunkSize,
+                                                       const size_t shardIndex,
                                                        const size_t slotIndex);
 
 // Returns the number of stored chunks.  "lastNumStoredChunks" is the number of chunks,
@@ -1062,11 +1101,13 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                 Renderer *renderer,
                                 const size_t startChunk,
                                 const size_t numChunks,
+                                const size_t shardIndex,
                                 const size_t slotIndex,
                                 angle::MemoryBuffer *scratchBuffer);
 
 void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
                                      Renderer *renderer,
+                                     const size_t shardIndex,
                                      const std::vector<uint8_t> &cacheData,
                                      const size_t maxTotalSize)
 {
@@ -1115,12 +1156,13 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     }
 
     size_t previousSlotIndex = 0;
-    const size_t slotIndex   = renderer->getNextPipelineCacheBlobCacheSlotIndex(&previousSlotIndex);
-    const size_t previousNumChunks = renderer->updatePipelineCacheChunkCount(numChunks);
+    const size_t slotIndex =
+        renderer->getNextPipelineCacheBlobCacheSlotIndex(shardIndex, &previousSlotIndex);
+    const size_t previousNumChunks = renderer->updatePipelineCacheChunkCount(shardIndex, numChunks);
     const bool isSlotChanged       = (slotIndex != previousSlotIndex);
 
-    PipelineCacheVkChunkInfos chunkInfos =
-        GetPipelineCacheVkChunkInfos(renderer, compressedData, numChunks, chunkSize, slotIndex);
+    PipelineCacheVkChunkInfos chunkInfos = GetPipelineCacheVkChunkInfos(
+        renderer, compressedData, numChunks, chunkSize, shardIndex, slotIndex);
 
     // Store all chunks without checking if they already exist (because they can't).
     size_t numStoredChunks = StorePipelineCacheVkChunks(globalOps, renderer, 0, chunkInfos,
@@ -1132,7 +1174,7 @@ void CompressAndStorePipelineCacheVk(vk::GlobalOps *globalOps,
     if (isSlotChanged || previousNumChunks > numChunks)
     {
         const size_t startChunk = isSlotChanged ? 0 : numChunks;
-        ErasePipelineCacheVkChunks(globalOps, renderer, startChunk, previousNumChunks,
+        ErasePipelineCacheVkChunks(globalOps, renderer, startChunk, previousNumChunks, shardIndex,
                                    previousSlotIndex, &scratchBuffer);
     }
 
@@ -1162,6 +1204,7 @@ PipelineCacheVkChunkInfos GetPipelineCacheVkChunkInfos(Renderer *renderer,
                                                        const angle::MemoryBuffer &compressedData,
                                                        const size_t numChunks,
                                                        const size_t chunkSize,
+                                                       const size_t shardIndex,
                                                        const size_t slotIndex)
 {
     const VkPhysicalDeviceProperties &physicalDeviceProperties =
@@ -1178,7 +1221,8 @@ PipelineCacheVkChunkInfos GetPipelineCacheVkChunkInfos(Renderer *renderer,
 
         // Create unique hash key.
         angle::BlobCacheKey cacheHash;
-        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, chunkIndex, &cacheHash);
+        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex, chunkIndex,
+                                       &cacheHash);
 
         if (kEnableCRCForPipelineCache)
         {
@@ -1293,6 +1337,7 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
                                 Renderer *renderer,
                                 const size_t startChunk,
                                 const size_t numChunks,
+                                const size_t shardIndex,
                                 const size_t slotIndex,
                                 angle::MemoryBuffer *scratchBuffer)
 {
@@ -1311,40 +1356,53 @@ void ErasePipelineCacheVkChunks(vk::GlobalOps *globalOps,
     for (size_t chunkIndex = startChunk; chunkIndex < numChunks; ++chunkIndex)
     {
         egl::BlobCache::Key chunkCacheHash;
-        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, chunkIndex,
+        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex, chunkIndex,
                                        &chunkCacheHash);
         globalOps->putBlob(chunkCacheHash, keyData);
     }
 }
 
+// The pipeline cache data of a single shard, pending compression and storage in the blob cache.
+struct PipelineCacheShardData
+{
+    size_t shardIndex;
+    std::vector<uint8_t> cacheData;
+};
+using PipelineCacheShardDataList = std::vector<PipelineCacheShardData>;
+
 class CompressAndStorePipelineCacheTask : public angle::Closure
 {
   public:
     CompressAndStorePipelineCacheTask(vk::GlobalOps *globalOps,
                                       Renderer *renderer,
-                                      std::vector<uint8_t> &&cacheData,
+                                      PipelineCacheShardDataList &&shardData,
                                       size_t kMaxTotalSize)
         : mGlobalOps(globalOps),
           mRenderer(renderer),
-          mCacheData(std::move(cacheData)),
+          mShardData(std::move(shardData)),
           mMaxTotalSize(kMaxTotalSize)
     {}
 
     void operator()() override
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "CompressAndStorePipelineCacheVk");
-        CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, mCacheData, mMaxTotalSize);
+        for (const PipelineCacheShardData &shardData : mShardData)
+        {
+            CompressAndStorePipelineCacheVk(mGlobalOps, mRenderer, shardData.shardIndex,
+                                            shardData.cacheData, mMaxTotalSize);
+        }
     }
 
   private:
     vk::GlobalOps *mGlobalOps;
     Renderer *mRenderer;
-    std::vector<uint8_t> mCacheData;
+    PipelineCacheShardDataList mShardData;
     size_t mMaxTotalSize;
 };
 
 angle::Result GetAndDecompressPipelineCacheVk(vk::Context *context,
                                               vk::GlobalOps *globalOps,
+                                              const size_t shardIndex,
                                               angle::MemoryBuffer *uncompressedData,
                                               bool *success)
 {
@@ -1356,7 +1414,8 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::Context *context,
     const VkPhysicalDeviceProperties &physicalDeviceProperties =
         renderer->getPhysicalDeviceProperties();
 
-    const size_t firstSlotIndex = renderer->getNextPipelineCacheBlobCacheSlotIndex(nullptr);
+    const size_t firstSlotIndex =
+        renderer->getNextPipelineCacheBlobCacheSlotIndex(shardIndex, nullptr);
     size_t slotIndex            = firstSlotIndex;
 
     angle::BlobCacheKey chunkCacheHash;
@@ -1366,7 +1425,8 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::Context *context,
     while (true)
     {
         // Compute the hash key of chunkIndex 0 and find the first cache data in blob cache.
-        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, 0, &chunkCacheHash);
+        ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex, 0,
+                                       &chunkCacheHash);
 
         if (globalOps->getBlob(chunkCacheHash, &keyData) &&
             keyData.size() >= sizeof(CacheDataHeader))
@@ -1376,7 +1436,7 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::Context *context,
         }
         // Nothing in the cache for current slotIndex.
 
-        slotIndex = renderer->getNextPipelineCacheBlobCacheSlotIndex(nullptr);
+        slotIndex = renderer->getNextPipelineCacheBlobCacheSlotIndex(shardIndex, nullptr);
         if (slotIndex == firstSlotIndex)
         {
             // Nothing in all slots.
@@ -1417,7 +1477,7 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::Context *context,
         return angle::Result::Continue;
     }
 
-    renderer->updatePipelineCacheChunkCount(numChunks);
+    renderer->updatePipelineCacheChunkCount(shardIndex, numChunks);
 
     size_t chunkSize      = keyData.size() - sizeof(CacheDataHeader);
     size_t compressedSize = 0;
@@ -1436,8 +1496,8 @@ angle::Result GetAndDecompressPipelineCacheVk(vk::Context *context,
         if (chunkIndex > 0)
         {
             // Get the unique key by chunkIndex.
-            ComputePipelineCacheVkChunkKey(physicalDeviceProperties, slotIndex, chunkIndex,
-                                           &chunkCacheHash);
+            ComputePipelineCacheVkChunkKey(physicalDeviceProperties, shardIndex, slotIndex,
+                                           chunkIndex, &chunkCacheHash);
 
             if (!globalOps->getBlob(chunkCacheHash, &keyData) ||
                 keyData.size() < sizeof(CacheDataHeader))
@@ -1624,6 +1684,25 @@ void DumpPipelineCacheGraph(Renderer *renderer, const std::ostringstream &graph)
     out.close();
 }
 
+void DumpGraphicsPipelineDescCorpus(Renderer *renderer, const GraphicsPipelineDescCorpus &corpus)
+{
+    std::string dumpPath = renderer->getPipelineCacheGraphDumpPath();
+
+    static std::atomic<uint32_t> sRendererIndex(0);
+    std::string filename = dumpPath;
+    filename += angle::GetExecutableName();
+    filename += std::to_string(sRendererIndex.fetch_add(1));
+    filename += ".pipeline_descs";
+
+    INFO() << "Dumping " << corpus.size() << " graphics pipeline descs to: \"" << filename
+           << "\"";
+
+    if (!corpus.save(filename))
+    {
+        ERR() << "Failed to write \"" << filename << "\"";
+    }
+}
+
 bool CanSupportMSRTSSForRGBA8(Renderer *renderer)
 {
     // The support is checked for a basic 2D texture.
@@ -1737,6 +1816,8 @@ Renderer::Renderer()
       mDebugUtilsMessenger(VK_NULL_HANDLE),
       mPhysicalDevice(VK_NULL_HANDLE),
       mCurrentQueueFamilyIndex(std::numeric_limits<uint32_t>::max()),
+      mAsyncQueueFamilyIndex(vk::QueueFamily::kInvalidIndex),
+      mAsyncQueue(VK_NULL_HANDLE),
       mMaxVertexAttribDivisor(1),
       mMaxVertexAttribStride(0),
       mMaxColorInputAttachmentCount(0),
@@ -1747,11 +1828,7 @@ Renderer::Renderer()
       mHostVisibleVertexConversionBufferMemoryTypeIndex(kInvalidMemoryTypeIndex),
       mDeviceLocalVertexConversionBufferMemoryTypeIndex(kInvalidMemoryTypeIndex),
       mVertexConversionBufferAlignment(1),
-      mCurrentPipelineCacheBlobCacheSlotIndex(0),
-      mPipelineCacheChunkCount(0),
       mPipelineCacheVkUpdateTimeout(kPipelineCacheVkUpdatePeriod),
-      mPipelineCacheSizeAtLastSync(0),
-      mPipelineCacheInitialized(false),
       mValidationMessageCount(0),
       mIsColorFramebufferFetchCoherent(false),
       mIsColorFramebufferFetchUsed(false),
@@ -1779,6 +1856,19 @@ Renderer::Renderer()
     {
         mPipelineCacheGraphDumpPath = kDefaultPipelineCacheGraphDumpPath;
     }
+
+    mRecordGraphicsPipelineDescs =
+        (angle::GetEnvironmentVarOrAndroidProperty("ANGLE_DUMP_GRAPHICS_PIPELINE_DESCS",
+                                                   "angle.dump_graphics_pipeline_descs") == "1");
+
+    // A corpus recorded by a previous run is used to warm up the pipeline cache at link time.
+    const std::string corpusPath = angle::GetEnvironmentVarOrAndroidProperty(
+        "ANGLE_GRAPHICS_PIPELINE_DESC_CORPUS", "angle.graphics_pipeline_desc_corpus");
+    if (!corpusPath.empty() && mGraphicsPipelineDescCorpus.load(corpusPath))
+    {
+        INFO() << "Loaded " << mGraphicsPipelineDescCorpus.size()
+               << " graphics pipeline descs from: \"" << corpusPath << "\"";
+    }
 }
 
 Renderer::~Renderer() {}
@@ -1816,8 +1906,11 @@ void Renderer::onDestroy(vk::Context *context)
         oneOffCommandPool.destroy(mDevice);
     }
 
-    mPipelineCacheInitialized = false;
-    mPipelineCache.destroy(mDevice);
+    for (PipelineCacheShard &shard : mPipelineCacheShards)
+    {
+        shard.initialized = false;
+        shard.cache.destroy(mDevice);
+    }
 
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
@@ -1876,12 +1969,20 @@ void Renderer::onDestroy(vk::Context *context)
     {
         DumpPipelineCacheGraph(this, mPipelineCacheGraph);
     }
+
+    if (mRecordGraphicsPipelineDescs && !mGraphicsPipelineDescCorpus.empty())
+    {
+        DumpGraphicsPipelineDescCorpus(this, mGraphicsPipelineDescCorpus);
+    }
 }
 
 void Renderer::notifyDeviceLost()
 {
     mDeviceLost = true;
-    mGlobalOps->notifyDeviceLost();
+    if (mGlobalOps != nullptr)
+    {
+        mGlobalOps->notifyDeviceLost();
+    }
 }
 
 bool Renderer::isDeviceLost() const
@@ -2319,6 +2420,18 @@ angle::Result Renderer::initialize(vk::Context *context,
     }
     ANGLE_VK_CHECK(context, queueFamilyMatchCount > 0, VK_ERROR_INITIALIZATION_FAILED);
 
+    // Look for a queue family without graphics support, which can be used for internal work that
+    // runs alongside the graphics queue.  Compute families also support transfer, so they are
+    // preferred over transfer-only families.
+    mAsyncQueueFamilyIndex = vk::QueueFamily::FindDedicatedIndex(
+        mQueueFamilyProperties, VK_QUEUE_COMPUTE_BIT, VK_QUEUE_GRAPHICS_BIT);
+    if (mAsyncQueueFamilyIndex == vk::QueueFamily::kInvalidIndex)
+    {
+        mAsyncQueueFamilyIndex =
+            vk::QueueFamily::FindDedicatedIndex(mQueueFamilyProperties, VK_QUEUE_TRANSFER_BIT,
+                                                VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT);
+    }
+
     // Store the physical device memory properties so we can find the right memory pools.
     mMemoryProperties.init(mPhysicalDevice);
     ANGLE_VK_CHECK(context, mMemoryProperties.getMemoryTypeCount() > 0,
@@ -2336,15 +2449,23 @@ angle::Result Renderer::initialize(vk::Context *context,
     ANGLE_TRY(
         setupDevice(context, featureOverrides, wsiLayer, useVulkanSwapchain, nativeWindowSystem));
 
+    // Initialize the format table.  It only depends on the features and on the physical device's
+    // format properties, so it is built in parallel with the creation of the device, which both
+    // take a significant part of eglInitialize.  Nothing else queries the format properties until
+    // the thread is joined.
+    std::thread formatTableThread([this]() {
+        ANGLE_TRACE_EVENT0("gpu.angle", "Renderer::initialize FormatTable");
+        mFormatTable.initialize(this, &mNativeTextureCaps);
+    });
+
     // If only one queue family, that's the only choice and the device is initialize with that.  If
     // there is more than one queue, we still create the device with the first queue family and hope
     // for the best.  We cannot wait for a window surface to know which supports present because of
     // EGL_KHR_surfaceless_context or simply pbuffers.  So far, only MoltenVk seems to expose
     // multiple queue families, and using the first queue family is fine with it.
-    ANGLE_TRY(createDeviceAndQueue(context, firstGraphicsQueueFamily));
-
-    // Initialize the format table.
-    mFormatTable.initialize(this, &mNativeTextureCaps);
+    angle::Result result = createDeviceAndQueue(context, firstGraphicsQueueFamily);
+    formatTableThread.join();
+    ANGLE_TRY(result);
 
     // Null terminate the extension list returned for EGL_VULKAN_INSTANCE_EXTENSIONS_ANGLE.
     mEnabledInstanceExtensions.push_back(nullptr);
@@ -2554,6 +2675,10 @@ angle::Result Renderer::initializeMemoryAllocator(vk::Context *context)
 // - VK_EXT_shader_atomic_float                        shaderImageFloat32Atomics (feature)
 // - VK_EXT_image_compression_control                  imageCompressionControl (feature)
 // - VK_EXT_image_compression_control_swapchain        imageCompressionControlSwapchain (feature)
+// - VK_EXT_descriptor_buffer                          descriptorBuffer (feature),
+//                                                     uniformBufferDescriptorSize (property),
+//                                                     storageBufferDescriptorSize (property),
+//                                                     descriptorBufferOffsetAlignment (property)
 //
 void Renderer::appendDeviceExtensionFeaturesNotPromoted(
     const vk::ExtensionNameList &deviceExtensionNames,
@@ -2654,6 +2779,11 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceFeatures, &mPipelineProtectedAccessFeatures);
     }
 
+    if (ExtensionFound(VK_EXT_SHADER_OBJECT_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mShaderObjectFeatures);
+    }
+
     // The EXT and ARM versions are interchangeable. The structs and enums alias each other.
     if (ExtensionFound(VK_EXT_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_EXTENSION_NAME,
                        deviceExtensionNames))
@@ -2676,6 +2806,16 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceFeatures, &mSwapchainMaintenance1Features);
     }
 
+    if (ExtensionFound(VK_KHR_PRESENT_ID_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mPresentIdFeatures);
+    }
+
+    if (ExtensionFound(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mPresentWaitFeatures);
+    }
+
     if (ExtensionFound(VK_EXT_LEGACY_DITHERING_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(deviceFeatures, &mDitheringFeatures);
@@ -2686,6 +2826,11 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
         vk::AddToPNextChain(deviceProperties, &mDrmProperties);
     }
 
+    if (ExtensionFound(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceProperties, &mExternalMemoryHostProperties);
+    }
+
     if (ExtensionFound(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME, deviceExtensionNames))
     {
         // VkPhysicalDeviceHostImageCopyPropertiesEXT has a count + array query.  Typically, that
@@ -2737,6 +2882,12 @@ void Renderer::appendDeviceExtensionFeaturesNotPromoted(
     {
         vk::AddToPNextChain(deviceFeatures, &mImageCompressionControlSwapchainFeatures);
     }
+
+    if (ExtensionFound(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mDescriptorBufferFeatures);
+        vk::AddToPNextChain(deviceProperties, &mDescriptorBufferProperties);
+    }
 }
 
 // The following features and properties used by ANGLE have been promoted to Vulkan 1.1:
@@ -2787,6 +2938,10 @@ void Renderer::appendDeviceExtensionFeaturesPromotedTo11(
 // - VK_KHR_8bit_storage                    storageBuffer8BitAccess (feature)
 //                                          uniformAndStorageBuffer8BitAccess (feature)
 //                                          storagePushConstant8 (feature)
+// - VK_EXT_descriptor_indexing             runtimeDescriptorArray (feature)
+//                                          descriptorBindingPartiallyBound (feature)
+//                                          descriptorBindingSampledImageUpdateAfterBind (feature)
+//                                          descriptorBindingUpdateUnusedWhilePending (feature)
 // - VK_KHR_shader_float_controls           shaderRoundingModeRTEFloat16 (property)
 //                                          shaderRoundingModeRTEFloat32 (property)
 //                                          shaderRoundingModeRTEFloat64 (property)
@@ -2856,6 +3011,11 @@ void Renderer::appendDeviceExtensionFeaturesPromotedTo12(
     {
         vk::AddToPNextChain(deviceFeatures, &m8BitStorageFeatures);
     }
+
+    if (ExtensionFound(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mDescriptorIndexingFeatures);
+    }
 }
 
 // The following features and properties used by ANGLE have been promoted to Vulkan 1.3:
@@ -2887,6 +3047,11 @@ void Renderer::appendDeviceExtensionFeaturesPromotedTo13(
         vk::AddToPNextChain(deviceFeatures, &mExtendedDynamicState2Features);
     }
 
+    if (ExtensionFound(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(deviceFeatures, &mExtendedDynamicState3Features);
+    }
+
     if (ExtensionFound(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(deviceFeatures, &mSynchronization2Features);
@@ -3014,6 +3179,10 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mExtendedDynamicState2Features.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_2_FEATURES_EXT;
 
+    mExtendedDynamicState3Features = {};
+    mExtendedDynamicState3Features.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_3_FEATURES_EXT;
+
     mGraphicsPipelineLibraryFeatures = {};
     mGraphicsPipelineLibraryFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT;
@@ -3058,6 +3227,9 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mPipelineProtectedAccessFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_PROTECTED_ACCESS_FEATURES_EXT;
 
+    mShaderObjectFeatures       = {};
+    mShaderObjectFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_OBJECT_FEATURES_EXT;
+
     mRasterizationOrderAttachmentAccessFeatures = {};
     mRasterizationOrderAttachmentAccessFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_FEATURES_EXT;
@@ -3073,12 +3245,22 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mSwapchainMaintenance1Features.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SWAPCHAIN_MAINTENANCE_1_FEATURES_EXT;
 
+    mPresentIdFeatures       = {};
+    mPresentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+    mPresentWaitFeatures       = {};
+    mPresentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+
     mDitheringFeatures       = {};
     mDitheringFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LEGACY_DITHERING_FEATURES_EXT;
 
     mDrmProperties       = {};
     mDrmProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRM_PROPERTIES_EXT;
 
+    mExternalMemoryHostProperties = {};
+    mExternalMemoryHostProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT;
+
     mTimelineSemaphoreFeatures = {};
     mTimelineSemaphoreFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
@@ -3093,6 +3275,10 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     m8BitStorageFeatures       = {};
     m8BitStorageFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES_KHR;
 
+    mDescriptorIndexingFeatures = {};
+    mDescriptorIndexingFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES_EXT;
+
     m16BitStorageFeatures       = {};
     m16BitStorageFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES_KHR;
 
@@ -3119,6 +3305,14 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mImageCompressionControlSwapchainFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_COMPRESSION_CONTROL_SWAPCHAIN_FEATURES_EXT;
 
+    mDescriptorBufferFeatures = {};
+    mDescriptorBufferFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_FEATURES_EXT;
+
+    mDescriptorBufferProperties = {};
+    mDescriptorBufferProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_BUFFER_PROPERTIES_EXT;
+
     mTextureCompressionASTCHDRFeatures = {};
     mTextureCompressionASTCHDRFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES;
@@ -3181,6 +3375,7 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mPrimitiveTopologyListRestartFeatures.pNext       = nullptr;
     mExtendedDynamicStateFeatures.pNext               = nullptr;
     mExtendedDynamicState2Features.pNext              = nullptr;
+    mExtendedDynamicState3Features.pNext              = nullptr;
     mGraphicsPipelineLibraryFeatures.pNext            = nullptr;
     mGraphicsPipelineLibraryProperties.pNext          = nullptr;
     mVertexInputDynamicStateFeatures.pNext            = nullptr;
@@ -3191,16 +3386,21 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mImagelessFramebufferFeatures.pNext               = nullptr;
     mPipelineRobustnessFeatures.pNext                 = nullptr;
     mPipelineProtectedAccessFeatures.pNext            = nullptr;
+    mShaderObjectFeatures.pNext                       = nullptr;
     mRasterizationOrderAttachmentAccessFeatures.pNext = nullptr;
     mShaderAtomicFloatFeatures.pNext                  = nullptr;
     mMaintenance5Features.pNext                       = nullptr;
     mSwapchainMaintenance1Features.pNext              = nullptr;
+    mPresentIdFeatures.pNext                          = nullptr;
+    mPresentWaitFeatures.pNext                        = nullptr;
     mDitheringFeatures.pNext                          = nullptr;
     mDrmProperties.pNext                              = nullptr;
+    mExternalMemoryHostProperties.pNext               = nullptr;
     mTimelineSemaphoreFeatures.pNext                  = nullptr;
     mHostImageCopyFeatures.pNext                      = nullptr;
     mHostImageCopyProperties.pNext                    = nullptr;
     m8BitStorageFeatures.pNext                        = nullptr;
+    mDescriptorIndexingFeatures.pNext                 = nullptr;
     m16BitStorageFeatures.pNext                       = nullptr;
     mSynchronization2Features.pNext                   = nullptr;
     mBlendOperationAdvancedFeatures.pNext             = nullptr;
@@ -3208,6 +3408,8 @@ void Renderer::queryDeviceExtensionFeatures(const vk::ExtensionNameList &deviceE
     mFloatControlProperties.pNext                     = nullptr;
     mImageCompressionControlFeatures.pNext            = nullptr;
     mImageCompressionControlSwapchainFeatures.pNext   = nullptr;
+    mDescriptorBufferFeatures.pNext                   = nullptr;
+    mDescriptorBufferProperties.pNext                 = nullptr;
     mTextureCompressionASTCHDRFeatures.pNext          = nullptr;
 #if defined(ANGLE_PLATFORM_ANDROID)
     mExternalFormatResolveFeatures.pNext   = nullptr;
@@ -3327,6 +3529,11 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         mEnabledDeviceExtensions.push_back(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME);
     }
 
+    if (mFeatures.supportsCalibratedTimestamps.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+    }
+
     if (mFeatures.bresenhamLineRasterization.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_EXT_LINE_RASTERIZATION_EXTENSION_NAME);
@@ -3451,6 +3658,12 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         vk::AddToPNextChain(&mEnabledFeatures, &mPipelineProtectedAccessFeatures);
     }
 
+    if (mFeatures.supportsShaderObject.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_SHADER_OBJECT_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mShaderObjectFeatures);
+    }
+
     if (mFeatures.supportsRasterizationOrderAttachmentAccess.enabled)
     {
         if (ExtensionFound(VK_EXT_RASTERIZATION_ORDER_ATTACHMENT_ACCESS_EXTENSION_NAME,
@@ -3488,6 +3701,14 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         vk::AddToPNextChain(&mEnabledFeatures, &mSwapchainMaintenance1Features);
     }
 
+    if (mFeatures.supportsPresentWait.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+        mEnabledDeviceExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mPresentIdFeatures);
+        vk::AddToPNextChain(&mEnabledFeatures, &mPresentWaitFeatures);
+    }
+
     if (mFeatures.supportsLegacyDithering.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_EXT_LEGACY_DITHERING_EXTENSION_NAME);
@@ -3536,6 +3757,15 @@ void Renderer::enableDeviceExtensionsNotPromoted(const vk::ExtensionNameList &de
         vk::AddToPNextChain(&mEnabledFeatures, &mImageCompressionControlSwapchainFeatures);
     }
 
+    if (getFeatures().supportsDescriptorBuffer.enabled)
+    {
+        // Capture/replay of descriptor buffers is not used, and may have a cost to keep enabled.
+        mDescriptorBufferFeatures.descriptorBufferCaptureReplay = VK_FALSE;
+
+        mEnabledDeviceExtensions.push_back(VK_EXT_DESCRIPTOR_BUFFER_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mDescriptorBufferFeatures);
+    }
+
 #if defined(ANGLE_PLATFORM_WINDOWS)
     // We only need the VK_EXT_full_screen_exclusive extension if we are opting
     // out of it via VK_FULL_SCREEN_EXCLUSIVE_DISALLOWED_EXT (i.e. working
@@ -3685,6 +3915,12 @@ void Renderer::enableDeviceExtensionsPromotedTo12(const vk::ExtensionNameList &d
         mEnabledDeviceExtensions.push_back(VK_KHR_8BIT_STORAGE_EXTENSION_NAME);
         vk::AddToPNextChain(&mEnabledFeatures, &m8BitStorageFeatures);
     }
+
+    if (mFeatures.supportsDescriptorIndexing.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_DESCRIPTOR_INDEXING_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mDescriptorIndexingFeatures);
+    }
 }
 
 // See comment above appendDeviceExtensionFeaturesPromotedTo13.
@@ -3707,6 +3943,12 @@ void Renderer::enableDeviceExtensionsPromotedTo13(const vk::ExtensionNameList &d
         vk::AddToPNextChain(&mEnabledFeatures, &mExtendedDynamicState2Features);
     }
 
+    if (mFeatures.supportsExtendedDynamicState3.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_EXTENDED_DYNAMIC_STATE_3_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mExtendedDynamicState3Features);
+    }
+
     if (mFeatures.supportsSynchronization2.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME);
@@ -3831,6 +4073,10 @@ void Renderer::initDeviceExtensionEntryPoints()
         // extension
         InitExtendedDynamicState2EXTFunctions(mDevice);
     }
+    if (mFeatures.supportsExtendedDynamicState3.enabled)
+    {
+        InitExtendedDynamicState3EXTFunctions(mDevice);
+    }
     if (mFeatures.supportsFragmentShadingRate.enabled)
     {
         InitFragmentShadingRateKHRDeviceFunction(mDevice);
@@ -3839,10 +4085,22 @@ void Renderer::initDeviceExtensionEntryPoints()
     {
         InitGetPastPresentationTimingGoogleFunction(mDevice);
     }
+    if (mFeatures.supportsPresentWait.enabled)
+    {
+        InitPresentWaitFunctions(mDevice);
+    }
+    if (mFeatures.supportsCalibratedTimestamps.enabled)
+    {
+        InitCalibratedTimestampsDeviceFunction(mDevice);
+    }
     if (mFeatures.supportsHostImageCopy.enabled)
     {
         InitHostImageCopyFunctions(mDevice);
     }
+    if (mFeatures.supportsDescriptorBuffer.enabled)
+    {
+        InitDescriptorBufferFunctions(mDevice);
+    }
     if (mFeatures.supportsVertexInputDynamicState.enabled)
     {
         InitVertexInputDynamicStateEXTFunctions(mDevice);
@@ -3862,6 +4120,11 @@ void Renderer::initDeviceExtensionEntryPoints()
         InitExternalFenceFdFunctions(mDevice);
     }
 
+    if (mFeatures.supportsExternalMemoryHost.enabled)
+    {
+        InitExternalMemoryHostFunctions(mDevice);
+    }
+
 #    if defined(ANGLE_PLATFORM_ANDROID)
     if (mFeatures.supportsAndroidHardwareBuffer.enabled)
     {
@@ -4028,13 +4291,27 @@ angle::Result Renderer::createDeviceAndQueue(vk::Context *context, uint32_t queu
                                    static_cast<uint32_t>(egl::ContextPriority::EnumCount));
 
     uint32_t queueCreateInfoCount              = 1;
-    VkDeviceQueueCreateInfo queueCreateInfo[1] = {};
+    VkDeviceQueueCreateInfo queueCreateInfo[2] = {};
     queueCreateInfo[0].sType                   = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
     queueCreateInfo[0].flags = enableProtectedContent ? VK_DEVICE_QUEUE_CREATE_PROTECTED_BIT : 0;
     queueCreateInfo[0].queueFamilyIndex = queueFamilyIndex;
     queueCreateInfo[0].queueCount       = queueCount;
     queueCreateInfo[0].pQueuePriorities = vk::QueueFamily::kQueuePriorities;
 
+    // A single queue is created from the dedicated family, with medium priority.
+    const bool createAsyncQueue = mFeatures.createDedicatedAsyncQueue.enabled &&
+                                  mAsyncQueueFamilyIndex != vk::QueueFamily::kInvalidIndex;
+    if (createAsyncQueue)
+    {
+        ASSERT(mAsyncQueueFamilyIndex != queueFamilyIndex);
+        queueCreateInfo[1].sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+        queueCreateInfo[1].flags            = 0;
+        queueCreateInfo[1].queueFamilyIndex = mAsyncQueueFamilyIndex;
+        queueCreateInfo[1].queueCount       = 1;
+        queueCreateInfo[1].pQueuePriorities = vk::QueueFamily::kQueuePriorities;
+        ++queueCreateInfoCount;
+    }
+
     // Setup device initialization struct
     VkDeviceCreateInfo createInfo    = {};
     createInfo.sType                 = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -4082,6 +4359,10 @@ angle::Result Renderer::createDeviceAndQueue(vk::Context *context, uint32_t queu
     initDeviceExtensionEntryPoints();
 
     ANGLE_TRY(mCommandQueue.init(context, queueFamily, enableProtectedContent, queueCount));
+    if (createAsyncQueue)
+    {
+        vkGetDeviceQueue(mDevice, mAsyncQueueFamilyIndex, 0, &mAsyncQueue);
+    }
     ANGLE_TRY(mCleanUpThread.init());
 
     if (mFeatures.forceMaxUniformBufferSize16KB.enabled)
@@ -4093,8 +4374,11 @@ angle::Result Renderer::createDeviceAndQueue(vk::Context *context, uint32_t queu
         mDefaultUniformBufferSize, getPhysicalDeviceProperties().limits.maxUniformBufferRange);
 
     // Vulkan pipeline cache will be initialized lazily in ensurePipelineCacheInitialized() method.
-    ASSERT(!mPipelineCacheInitialized);
-    ASSERT(!mPipelineCache.valid());
+    for (const PipelineCacheShard &shard : mPipelineCacheShards)
+    {
+        ASSERT(!shard.initialized);
+        ASSERT(!shard.cache.valid());
+    }
 
     // Track the set of supported pipeline stages.  This is used when issuing image layout
     // transitions that cover many stages (such as AllGraphicsReadOnly) to mask out unsupported
@@ -4193,7 +4477,8 @@ void Renderer::initializeValidationMessageSuppressions()
             kExposeNonConformantSkippedMessages + ArraySize(kExposeNonConformantSkippedMessages));
     }
 
-    if (getFeatures().useVkEventForImageBarrier.enabled &&
+    if ((getFeatures().useVkEventForImageBarrier.enabled ||
+         getFeatures().useVkEventForBufferBarrier.enabled) &&
         (!vk::OutsideRenderPassCommandBuffer::ExecutesInline() ||
          !vk::RenderPassCommandBuffer::ExecutesInline()))
     {
@@ -4505,6 +4790,36 @@ void Renderer::queryAndCacheFragmentShadingRates()
     }
 }
 
+bool Renderer::canSupportCalibratedTimestamps() const
+{
+#if !defined(ANGLE_SHARED_LIBVULKAN)
+    InitCalibratedTimestampsInstanceFunction(mInstance);
+#endif  // !defined(ANGLE_SHARED_LIBVULKAN)
+    ASSERT(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT);
+
+    // Only the device time domain is used; the CPU side is timed with the platform's clock, which
+    // is the one trace events use.
+    uint32_t timeDomainCount = 0;
+    VkResult result =
+        vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(mPhysicalDevice, &timeDomainCount, nullptr);
+    if (result != VK_SUCCESS || timeDomainCount == 0)
+    {
+        return false;
+    }
+
+    std::vector<VkTimeDomainEXT> timeDomains(timeDomainCount);
+    result = vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(mPhysicalDevice, &timeDomainCount,
+                                                            timeDomains.data());
+    if (result != VK_SUCCESS)
+    {
+        return false;
+    }
+    timeDomains.resize(timeDomainCount);
+
+    return std::find(timeDomains.begin(), timeDomains.end(), VK_TIME_DOMAIN_DEVICE_EXT) !=
+           timeDomains.end();
+}
+
 bool Renderer::canSupportFragmentShadingRate() const
 {
     // VK_KHR_create_renderpass2 is required for VK_KHR_fragment_shading_rate
@@ -4870,6 +5185,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         !mFeatures.supportsRenderPassLoadStoreOpNone.enabled &&
             ExtensionFound(VK_QCOM_RENDER_PASS_STORE_OPS_EXTENSION_NAME, deviceExtensionNames));
 
+    // Store op inference predicts that the contents are not needed from the history of the image,
+    // which an application can violate at any time.  Opt-in only.
+    ANGLE_FEATURE_CONDITION(&mFeatures, inferAttachmentStoreOps, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsDepthClipControl,
                             mDepthClipControlFeatures.depthClipControl == VK_TRUE);
 
@@ -5011,6 +5330,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // http://anglebug.com/42265957
     ANGLE_FEATURE_CONDITION(&mFeatures, varyingsRequireMatchingPrecisionInSpirv, isPowerVR);
 
+    // Dead code removal is cheap, but most drivers do it just as well.  It is disabled by default
+    // and can be enabled for drivers whose shader compilers are measured to benefit from it.
+    ANGLE_FEATURE_CONDITION(&mFeatures, removeDeadCodeInSpirv, false);
+
     // IMR devices are less sensitive to the src/dst stage masks in barriers, and behave more
     // efficiently when all barriers are aggregated, rather than individually and precisely
     // specified.
@@ -5048,6 +5371,12 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         (isQualcommProprietary && qualcommDriverVersion < QualcommDriverVersion(512, 513, 0)) ||
             isARM || isPowerVR || isSwiftShader);
 
+    // Baking the flip values in specialization constants lets the driver fold the flip math in
+    // the shaders, at the cost of a pipeline variant per flip state (typically one for the default
+    // framebuffer and one for FBOs).  It has no effect if preferDriverUniformOverSpecConst is
+    // enabled, and is not enabled by default until the trade-off is evaluated on more drivers.
+    ANGLE_FEATURE_CONDITION(&mFeatures, bakeFlipInSpecConst, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, preferCachedNoncoherentForDynamicStreamBufferUsage,
                             IsMeteorLake(mPhysicalDeviceProperties.deviceID));
 
@@ -5112,6 +5441,12 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                                 (mFeatures.supportsDepthStencilResolve.enabled &&
                                  mFeatures.allowMultisampledRenderToTextureEmulation.enabled));
 
+    // Multisampled renderbuffers that are only ever resolved with glBlitFramebuffer and
+    // invalidated need no memory on tilers, but they can't be read outside a render pass once
+    // transient.  As the contents may be lost if the application breaks that pattern, this is only
+    // enabled on demand.
+    ANGLE_FEATURE_CONDITION(&mFeatures, preferTransientMultisampledRenderbuffers, false);
+
     // Currently we enable cube map arrays based on the imageCubeArray Vk feature.
     // TODO: Check device caps for full cube map array support. http://anglebug.com/42263705
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsImageCubeArray,
@@ -5164,6 +5499,28 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, preferSubmitAtFBOBoundary,
                             isTileBasedRenderer || isSwiftShader);
 
+    // Gathering submissions from multiple contexts only helps apps that submit from several threads
+    // at once, and delays the return of the submitting threads slightly.  Off until measured.
+    ANGLE_FEATURE_CONDITION(&mFeatures, batchQueueSubmitsAcrossContexts, false);
+
+    // The contexts of a share group run at the highest of their priorities.  Background contexts
+    // sharing with a UI context would otherwise hold the high priority queue with large batches.
+    ANGLE_FEATURE_CONDITION(&mFeatures, submitPromotedContextCommandsAtRenderPassEnd, true);
+
+    // Reusing the images of released textures avoids creating a VkImage and allocating its memory
+    // for every texture that is recreated with the same description.  Recycled memory isn't
+    // refilled, so this is disabled when testing with non-zero memory.
+    ANGLE_FEATURE_CONDITION(&mFeatures, recycleTextureImages,
+                            !mFeatures.allocateNonZeroMemory.enabled);
+
+    // Baking samplers into the descriptor set layouts recreates the pipelines of the program once,
+    // so it's only worth it where immutable samplers make sampling or descriptor updates cheaper.
+    ANGLE_FEATURE_CONDITION(&mFeatures, bakeStaticImmutableSamplers, false);
+
+    // Nothing is submitted to the dedicated queue yet; routing UtilsVk work to it needs queue
+    // family ownership transfers and completion tracking of its own.
+    ANGLE_FEATURE_CONDITION(&mFeatures, createDedicatedAsyncQueue, false);
+
     // In order to support immutable samplers tied to external formats, we need to overallocate
     // descriptor counts for such immutable samplers
     ANGLE_FEATURE_CONDITION(&mFeatures, useMultipleDescriptorsForExternalFormats, true);
@@ -5208,6 +5565,16 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                             mSwapchainMaintenance1Features.swapchainMaintenance1 == VK_TRUE &&
                                 useVulkanSwapchain == UseVulkanSwapchain::Yes);
 
+    // VK_KHR_present_wait is only used with present ids, to know when presents reach the display.
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsPresentWait,
+                            mPresentIdFeatures.presentId == VK_TRUE &&
+                                mPresentWaitFeatures.presentWait == VK_TRUE &&
+                                useVulkanSwapchain == UseVulkanSwapchain::Yes);
+
+    // Recreating the swapchain is not free, and the image count it settles on depends on the
+    // application, so this is not enabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, adaptSwapchainImageCount, false);
+
     // The VK_EXT_legacy_dithering extension enables dithering support without emulation
     // Disable the usage of VK_EXT_legacy_dithering on ARM until the driver bug
     // http://issuetracker.google.com/293136916, http://issuetracker.google.com/292282210 are fixed.
@@ -5290,6 +5657,14 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // Use VMA for image suballocation.
     ANGLE_FEATURE_CONDITION(&mFeatures, useVmaForImageSuballocation, true);
 
+    // Pool small images by memory type.  Not enabled by default until its effect on memory usage
+    // has been measured.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useSmallImageMemoryPools, false);
+
+    // Relocate buffers out of sparse buffer blocks.  Not enabled by default until the cost of the
+    // copies has been measured against the memory saved.
+    ANGLE_FEATURE_CONDITION(&mFeatures, defragmentBufferPools, false);
+
     // Emit SPIR-V 1.4 when supported.  The following old drivers have various bugs with SPIR-V 1.4:
     //
     // - Nvidia drivers - Crashes when creating pipelines, not using any SPIR-V 1.4 features.  Known
@@ -5434,6 +5809,18 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
             mExtendedDynamicState2Features.extendedDynamicState2LogicOp == VK_TRUE &&
             !(IsLinux() && isIntel && isMesaLessThan22_2) && !(IsAndroid() && isGalaxyS23));
 
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsExtendedDynamicState3,
+        mExtendedDynamicState3Features.extendedDynamicState3ColorBlendEquation == VK_TRUE &&
+            !isExtendedDynamicStateBuggy);
+
+    // The ColorBlendEquation dynamic state cannot specify advanced blend operations, so it is not
+    // used when they are natively supported.  When they are emulated, blending is disabled in the
+    // pipeline instead.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useColorBlendEquationDynamicState,
+                            mFeatures.supportsExtendedDynamicState3.enabled &&
+                                !mFeatures.supportsBlendOperationAdvanced.enabled);
+
     // Samsung Vulkan driver with API level < 1.3.244 has a bug in imageless framebuffer support.
     // http://issuetracker.google.com/42266906
     const bool isSamsungDriverWithImagelessFramebufferBug =
@@ -5541,6 +5928,12 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         mFeatures.supportsGraphicsPipelineLibrary.enabled &&
             !(IsWindows() && isIntel && intelDriverVersion < IntelDriverVersion(101, 5379)));
 
+    // Without VK_EXT_graphics_pipeline_library, pipeline cache misses at draw time can be handled
+    // asynchronously, trading off temporary rendering artifacts for no stalls.  This is opt-in, as
+    // is skipping draw calls when no fallback pipeline exists.
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncGraphicsPipelineCreationOnCacheMiss, false);
+    ANGLE_FEATURE_CONDITION(&mFeatures, skipDrawOnPendingGraphicsPipeline, false);
+
     // Whether the pipeline caches should merge into the global pipeline cache.  This should only be
     // enabled on platforms if:
     //
@@ -5589,6 +5982,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, verifyPipelineCacheInBlobCache,
                             !mFeatures.hasBlobCacheThatEvictsOldItemsFirst.enabled);
 
+    // Sharding the pipeline cache makes each sync cheaper, but changes the set of keys used in the
+    // blob cache (invalidating the existing cache entries), so it is not yet enabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, shardPipelineCacheInBlobCache, false);
+
     // On ARM, dynamic state for stencil write mask doesn't work correctly in the presence of
     // discard or alpha to coverage, if the static state provided when creating the pipeline has a
     // value of 0.
@@ -5606,6 +6003,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     // Only enable it on integrations without EGL_FRONT_BUFFER_AUTO_REFRESH_ANDROID passthrough.
     ANGLE_FEATURE_CONDITION(&mFeatures, forceContinuousRefreshOnSharedPresent, false);
 
+    // Splitting render passes to encode them on worker threads trades GPU-side efficiency (due to
+    // re-emitted state and vkCmdExecuteCommands) for CPU time.  Disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, parallelRenderPassCommandEncoding, false);
+
     // Enable setting frame timestamp surface attribute on Android platform.
     // Frame timestamp is enabled by calling into "vkGetPastPresentationTimingGOOGLE"
     // which, on Android platforms, makes the necessary ANativeWindow API calls.
@@ -5613,6 +6014,13 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
                             IsAndroid() && ExtensionFound(VK_GOOGLE_DISPLAY_TIMING_EXTENSION_NAME,
                                                           deviceExtensionNames));
 
+    // Calibrated timestamps let GL_TIMESTAMP and the CPU/GPU clock synchronization of GPU trace
+    // events read the GPU clock without a submission.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsCalibratedTimestamps,
+        ExtensionFound(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME, deviceExtensionNames) &&
+            canSupportCalibratedTimestamps());
+
     // Only enable VK_EXT_host_image_copy on hardware where identicalMemoryTypeRequirements is set.
     // That lets ANGLE avoid having to fallback to non-host-copyable image allocations if the
     // host-copyable one fails due to out-of-that-specific-kind-of-memory.
@@ -5632,12 +6040,10 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     //    decide cpu or gpu upload texture based on texture size.
     constexpr VkSubgroupFeatureFlags kRequiredSubgroupOp =
         VK_SUBGROUP_FEATURE_SHUFFLE_BIT | VK_SUBGROUP_FEATURE_CLUSTERED_BIT;
-    static constexpr bool kSupportTranscodeEtcToBc = false;
-    static constexpr uint32_t kMaxTexelBufferSize  = 64 * 1024 * 1024;
-    const VkPhysicalDeviceLimits &limitsVk         = mPhysicalDeviceProperties.limits;
+    static constexpr uint32_t kMaxTexelBufferSize = 64 * 1024 * 1024;
+    const VkPhysicalDeviceLimits &limitsVk        = mPhysicalDeviceProperties.limits;
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsComputeTranscodeEtcToBc,
                             !mPhysicalDeviceFeatures.textureCompressionETC2 &&
-                                kSupportTranscodeEtcToBc &&
                                 (mSubgroupProperties.supportedOperations & kRequiredSubgroupOp) ==
                                     kRequiredSubgroupOp &&
                                 (limitsVk.maxTexelBufferElements >= kMaxTexelBufferSize));
@@ -5701,6 +6107,15 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
                             mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
 
+    // The subset of VK_EXT_descriptor_indexing needed to keep all the textures of a share group in
+    // one large descriptor array, updated as textures are created and destroyed.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsDescriptorIndexing,
+        mDescriptorIndexingFeatures.runtimeDescriptorArray == VK_TRUE &&
+            mDescriptorIndexingFeatures.descriptorBindingPartiallyBound == VK_TRUE &&
+            mDescriptorIndexingFeatures.descriptorBindingSampledImageUpdateAfterBind == VK_TRUE &&
+            mDescriptorIndexingFeatures.descriptorBindingUpdateUnusedWhilePending == VK_TRUE);
+
     // 8bit storage features
     ANGLE_FEATURE_CONDITION(&mFeatures, supports8BitStorageBuffer,
                             m8BitStorageFeatures.storageBuffer8BitAccess == VK_TRUE);
@@ -5736,6 +6151,12 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, useVkEventForImageBarrier,
                             isTileBasedRenderer || isSwiftShader);
 
+    // Buffers written by a compute or transfer command buffer and read by a later render pass
+    // (or the other way around) are typical in GPU-driven frames.  Waiting on the writer's event
+    // keeps the unrelated work submitted in between from being serialized.  Until that is
+    // measured on real workloads, this is only enabled for SwiftShader for test coverage.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useVkEventForBufferBarrier, isSwiftShader);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsMaintenance5,
                             mMaintenance5Features.maintenance5 == VK_TRUE);
 
@@ -5786,6 +6207,11 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
     ANGLE_FEATURE_CONDITION(&mFeatures, permanentlySwitchToFramebufferFetchMode,
                             isTileBasedRenderer && !mFeatures.preferDynamicRendering.enabled);
 
+    // Shader objects can only be used with dynamic rendering.
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsShaderObject,
+                            mShaderObjectFeatures.shaderObject == VK_TRUE &&
+                                mFeatures.preferDynamicRendering.enabled);
+
     // Vulkan supports depth/stencil input attachments same as it does with color.
     // GL_ARM_shader_framebuffer_fetch_depth_stencil requires coherent behavior however, so this
     // extension is exposed only where coherent framebuffer fetch is available.
@@ -5814,8 +6240,19 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
         &mFeatures, supportsImageCompressionControlSwapchain,
         mImageCompressionControlSwapchainFeatures.imageCompressionControlSwapchain == VK_TRUE);
 
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsDescriptorBuffer,
+                            mDescriptorBufferFeatures.descriptorBuffer == VK_TRUE);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsAstcSliced3d, isARM);
 
+    // Hashing costs about as much as the copy it saves, so this only pays off for applications
+    // that redraw unchanged client arrays.
+    ANGLE_FEATURE_CONDITION(&mFeatures, reuseStreamedVertexData, false);
+
+    // Sharing the device makes a device loss affect every display, and the device of an idle
+    // renderer is only released at process exit, so this is left to the application.
+    ANGLE_FEATURE_CONDITION(&mFeatures, shareRendererAcrossDisplays, false);
+
     ANGLE_FEATURE_CONDITION(
         &mFeatures, supportsTextureCompressionAstcHdr,
         mTextureCompressionASTCHDRFeatures.textureCompressionASTC_HDR == VK_TRUE);
@@ -5846,13 +6283,15 @@ void Renderer::initFeatures(const vk::ExtensionNameList &deviceExtensionNames,
 void Renderer::appBasedFeatureOverrides(const vk::ExtensionNameList &extensions) {}
 
 angle::Result Renderer::initPipelineCache(vk::Context *context,
+                                          size_t shardIndex,
                                           vk::PipelineCache *pipelineCache,
                                           bool *success)
 {
     angle::MemoryBuffer initialData;
     if (!mFeatures.disablePipelineCacheLoadForTesting.enabled)
     {
-        ANGLE_TRY(GetAndDecompressPipelineCacheVk(context, mGlobalOps, &initialData, success));
+        ANGLE_TRY(GetAndDecompressPipelineCacheVk(context, mGlobalOps, shardIndex, &initialData,
+                                                  success));
     }
 
     VkPipelineCacheCreateInfo pipelineCacheCreateInfo = {};
@@ -5867,79 +6306,115 @@ angle::Result Renderer::initPipelineCache(vk::Context *context,
     return angle::Result::Continue;
 }
 
-angle::Result Renderer::ensurePipelineCacheInitialized(vk::Context *context)
+angle::Result Renderer::ensurePipelineCacheInitialized(vk::Context *context, size_t shardIndex)
 {
+    PipelineCacheShard &shard = mPipelineCacheShards[shardIndex];
+
     // If it is initialized already, there is nothing to do
-    if (mPipelineCacheInitialized)
+    if (shard.initialized)
     {
         return angle::Result::Continue;
     }
 
-    std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
+    std::unique_lock<angle::SimpleMutex> lock(shard.mutex);
 
     // If another thread initialized it first don't redo it
-    if (mPipelineCacheInitialized)
+    if (shard.initialized)
     {
         return angle::Result::Continue;
     }
 
     // We should now create the pipeline cache with the blob cache pipeline data.
     bool loadedFromBlobCache = false;
-    ANGLE_TRY(initPipelineCache(context, &mPipelineCache, &loadedFromBlobCache));
+    ANGLE_TRY(initPipelineCache(context, shardIndex, &shard.cache, &loadedFromBlobCache));
     if (loadedFromBlobCache)
     {
-        ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, &mPipelineCacheSizeAtLastSync,
-                                                  mPipelineCacheSizeAtLastSync, nullptr));
+        ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, shardIndex, &shard.sizeAtLastSync,
+                                                  shard.sizeAtLastSync, nullptr));
     }
 
-    mPipelineCacheInitialized = true;
+    shard.initialized = true;
 
     return angle::Result::Continue;
 }
 
-size_t Renderer::getNextPipelineCacheBlobCacheSlotIndex(size_t *previousSlotIndexOut)
+size_t Renderer::getPipelineCacheShardIndex(size_t shardKey) const
+{
+    return mFeatures.shardPipelineCacheInBlobCache.enabled ? shardKey % kPipelineCacheShardCount
+                                                           : 0;
+}
+
+size_t Renderer::getNextPipelineCacheBlobCacheSlotIndex(size_t shardIndex,
+                                                        size_t *previousSlotIndexOut)
 {
+    PipelineCacheShard &shard = mPipelineCacheShards[shardIndex];
+
     if (previousSlotIndexOut != nullptr)
     {
-        *previousSlotIndexOut = mCurrentPipelineCacheBlobCacheSlotIndex;
+        *previousSlotIndexOut = shard.blobCacheSlotIndex;
     }
     if (getFeatures().useDualPipelineBlobCacheSlots.enabled)
     {
-        mCurrentPipelineCacheBlobCacheSlotIndex = 1 - mCurrentPipelineCacheBlobCacheSlotIndex;
+        shard.blobCacheSlotIndex = 1 - shard.blobCacheSlotIndex;
     }
-    return mCurrentPipelineCacheBlobCacheSlotIndex;
+    return shard.blobCacheSlotIndex;
 }
 
-size_t Renderer::updatePipelineCacheChunkCount(size_t chunkCount)
+size_t Renderer::updatePipelineCacheChunkCount(size_t shardIndex, size_t chunkCount)
 {
-    const size_t previousChunkCount = mPipelineCacheChunkCount;
-    mPipelineCacheChunkCount        = chunkCount;
+    PipelineCacheShard &shard       = mPipelineCacheShards[shardIndex];
+    const size_t previousChunkCount = shard.chunkCount;
+    shard.chunkCount                = chunkCount;
     return previousChunkCount;
 }
 
+size_t Renderer::getPipelineCacheSize()
+{
+    size_t totalSize = 0;
+    for (PipelineCacheShard &shard : mPipelineCacheShards)
+    {
+        if (!shard.initialized)
+        {
+            continue;
+        }
+
+        std::unique_lock<angle::SimpleMutex> lock(shard.mutex);
+        size_t shardSize = 0;
+        if (shard.cache.getCacheData(mDevice, &shardSize, nullptr) == VK_SUCCESS)
+        {
+            totalSize += shardSize;
+        }
+    }
+    return totalSize;
+}
+
 angle::Result Renderer::getPipelineCache(vk::Context *context,
+                                         size_t shardKey,
                                          vk::PipelineCacheAccess *pipelineCacheOut)
 {
-    ANGLE_TRY(ensurePipelineCacheInitialized(context));
+    const size_t shardIndex = getPipelineCacheShardIndex(shardKey);
+    ANGLE_TRY(ensurePipelineCacheInitialized(context, shardIndex));
 
+    PipelineCacheShard &shard = mPipelineCacheShards[shardIndex];
     angle::SimpleMutex *pipelineCacheMutex =
         context->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled ||
                 context->getFeatures().preferMonolithicPipelinesOverLibraries.enabled
-            ? &mPipelineCacheMutex
+            ? &shard.mutex
             : nullptr;
 
-    pipelineCacheOut->init(&mPipelineCache, pipelineCacheMutex);
+    pipelineCacheOut->init(&shard.cache, pipelineCacheMutex);
     return angle::Result::Continue;
 }
 
 angle::Result Renderer::mergeIntoPipelineCache(vk::Context *context,
+                                               size_t shardKey,
                                                const vk::PipelineCache &pipelineCache)
 {
     // It is an error to call into this method when the feature is disabled.
     ASSERT(context->getFeatures().mergeProgramPipelineCachesToGlobalCache.enabled);
 
     vk::PipelineCacheAccess globalCache;
-    ANGLE_TRY(getPipelineCache(context, &globalCache));
+    ANGLE_TRY(getPipelineCache(context, shardKey, &globalCache));
 
     globalCache.merge(this, pipelineCache);
 
@@ -5986,6 +6461,7 @@ void Renderer::initializeFrontendFeatures(angle::FrontendFeatures *features) con
     ANGLE_FEATURE_CONDITION(features, forceGlErrorChecking, (IsAndroid() && isSwiftShader));
 
     ANGLE_FEATURE_CONDITION(features, cacheCompiledShader, true);
+    ANGLE_FEATURE_CONDITION(features, cacheCompiledShaderByPreprocessedSource, true);
 
     // https://issuetracker.google.com/292285899
     ANGLE_FEATURE_CONDITION(features, uncurrentEglSurfaceUponSurfaceDestroy, true);
@@ -5996,19 +6472,25 @@ void Renderer::initializeFrontendFeatures(angle::FrontendFeatures *features) con
     // Always run the link's warm up job in a thread.  It's an optimization only, and does not block
     // the link resolution.
     ANGLE_FEATURE_CONDITION(features, alwaysRunLinkSubJobsThreaded, true);
+    // ContextVk keeps its own state, and the state of the ContextVks in a share group is
+    // invalidated through the shared objects' observers.
+    ANGLE_FEATURE_CONDITION(features, skipStateInvalidationOnMakeCurrent, true);
 }
 
 angle::Result Renderer::getLockedPipelineCacheDataIfNew(vk::Context *context,
+                                                        size_t shardIndex,
                                                         size_t *pipelineCacheSizeOut,
                                                         size_t lastSyncSize,
                                                         std::vector<uint8_t> *pipelineCacheDataOut)
 {
-    // Because this function may call |getCacheData| twice, |mPipelineCacheMutex| is not passed to
+    PipelineCacheShard &shard = mPipelineCacheShards[shardIndex];
+
+    // Because this function may call |getCacheData| twice, the shard's |mutex| is not passed to
     // |PipelineAccessCache|, and is expected to be locked once **by the caller**.
-    mPipelineCacheMutex.assertLocked();
+    shard.mutex.assertLocked();
 
     vk::PipelineCacheAccess globalCache;
-    globalCache.init(&mPipelineCache, nullptr);
+    globalCache.init(&shard.cache, nullptr);
 
     ANGLE_VK_TRY(context, globalCache.getCacheData(context, pipelineCacheSizeOut, nullptr));
 
@@ -6050,12 +6532,12 @@ angle::Result Renderer::syncPipelineCacheVk(vk::Context *context,
                                             vk::GlobalOps *globalOps,
                                             const gl::Context *contextGL)
 {
-    // Skip syncing until pipeline cache is initialized.
-    if (!mPipelineCacheInitialized)
+    // Skip syncing until pipeline cache is initialized.  Without shardPipelineCacheInBlobCache,
+    // only the first shard is ever used.
+    if (!mFeatures.shardPipelineCacheInBlobCache.enabled && !mPipelineCacheShards[0].initialized)
     {
         return angle::Result::Continue;
     }
-    ASSERT(mPipelineCache.valid());
 
     if (!mFeatures.syncMonolithicPipelinesToBlobCache.enabled)
     {
@@ -6080,18 +6562,35 @@ angle::Result Renderer::syncPipelineCacheVk(vk::Context *context,
         return angle::Result::Continue;
     }
 
-    size_t pipelineCacheSize = 0;
-    std::vector<uint8_t> pipelineCacheData;
+    // Only the shards that have grown since the last sync are serialized and stored.
+    PipelineCacheShardDataList pipelineCacheShardData;
+    for (size_t shardIndex = 0; shardIndex < kPipelineCacheShardCount; ++shardIndex)
     {
-        std::unique_lock<angle::SimpleMutex> lock(mPipelineCacheMutex);
-        ANGLE_TRY(getLockedPipelineCacheDataIfNew(
-            context, &pipelineCacheSize, mPipelineCacheSizeAtLastSync, &pipelineCacheData));
+        PipelineCacheShard &shard = mPipelineCacheShards[shardIndex];
+        if (!shard.initialized)
+        {
+            continue;
+        }
+        ASSERT(shard.cache.valid());
+
+        size_t pipelineCacheSize = 0;
+        std::vector<uint8_t> pipelineCacheData;
+        {
+            std::unique_lock<angle::SimpleMutex> lock(shard.mutex);
+            ANGLE_TRY(getLockedPipelineCacheDataIfNew(context, shardIndex, &pipelineCacheSize,
+                                                      shard.sizeAtLastSync, &pipelineCacheData));
+        }
+        if (pipelineCacheData.empty())
+        {
+            continue;
+        }
+        shard.sizeAtLastSync = pipelineCacheSize;
+        pipelineCacheShardData.push_back({shardIndex, std::move(pipelineCacheData)});
     }
-    if (pipelineCacheData.empty())
+    if (pipelineCacheShardData.empty())
     {
         return angle::Result::Continue;
     }
-    mPipelineCacheSizeAtLastSync = pipelineCacheSize;
 
     if (mFeatures.enableAsyncPipelineCacheCompression.enabled)
     {
@@ -6102,14 +6601,19 @@ angle::Result Renderer::syncPipelineCacheVk(vk::Context *context,
         // Create task to compress.
         mCompressEvent = contextGL->getWorkerThreadPool()->postWorkerTask(
             std::make_shared<CompressAndStorePipelineCacheTask>(
-                globalOps, this, std::move(pipelineCacheData), kMaxTotalSize));
+                globalOps, this, std::move(pipelineCacheShardData), kMaxTotalSize),
+            angle::WorkerTaskPriority::Idle);
     }
     else
     {
         // If enableAsyncPipelineCacheCompression is disabled, to avoid the risk, set kMaxTotalSize
         // to 64k.
         constexpr size_t kMaxTotalSize = 64 * 1024;
-        CompressAndStorePipelineCacheVk(globalOps, this, pipelineCacheData, kMaxTotalSize);
+        for (const PipelineCacheShardData &shardData : pipelineCacheShardData)
+        {
+            CompressAndStorePipelineCacheVk(globalOps, this, shardData.shardIndex,
+                                            shardData.cacheData, kMaxTotalSize);
+        }
     }
 
     return angle::Result::Continue;
@@ -6273,7 +6777,8 @@ bool Renderer::haveSameFormatFeatureBits(angle::FormatID formatID1, angle::Forma
 
 void Renderer::cleanupGarbage(bool *anyGarbageCleanedOut)
 {
-    bool anyCleaned = false;
+    const double startTime = angle::GetCurrentSystemTime();
+    bool anyCleaned        = false;
 
     // Clean up general garbage
     anyCleaned = (mSharedGarbageList.cleanupSubmittedGarbage(this) > 0) || anyCleaned;
@@ -6288,6 +6793,17 @@ void Renderer::cleanupGarbage(bool *anyGarbageCleanedOut)
     // Clean up RefCountedEvent that are done resetting
     anyCleaned = (mRefCountedEventRecycler.cleanupResettingEvents(this) > 0) || anyCleaned;
 
+    const uint64_t durationNs =
+        static_cast<uint64_t>((angle::GetCurrentSystemTime() - startTime) * 1'000'000'000);
+    if (std::this_thread::get_id() == getCleanUpThreadId())
+    {
+        mCleanUpThreadGarbageCleanupDurationNs.fetch_add(durationNs, std::memory_order_relaxed);
+    }
+    else
+    {
+        mAppThreadGarbageCleanupDurationNs.fetch_add(durationNs, std::memory_order_relaxed);
+    }
+
     if (anyGarbageCleanedOut != nullptr)
     {
         *anyGarbageCleanedOut = anyCleaned;
@@ -6733,10 +7249,24 @@ const char *Renderer::GetVulkanObjectTypeName(VkObjectType type)
     return GetVkObjectTypeName(type);
 }
 
-ImageMemorySuballocator::ImageMemorySuballocator() {}
+ImageMemorySuballocator::ImageMemorySuballocator()
+{
+    mSmallImagePools.fill(VK_NULL_HANDLE);
+}
 ImageMemorySuballocator::~ImageMemorySuballocator() {}
 
-void ImageMemorySuballocator::destroy(Renderer *renderer) {}
+void ImageMemorySuballocator::destroy(Renderer *renderer)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mSmallImagePoolsMutex);
+    for (VmaPool &pool : mSmallImagePools)
+    {
+        if (pool != VK_NULL_HANDLE)
+        {
+            vma::DestroyPool(renderer->getAllocator().getHandle(), pool);
+            pool = VK_NULL_HANDLE;
+        }
+    }
+}
 
 VkResult ImageMemorySuballocator::allocateAndBindMemory(
     Context *context,
@@ -6769,10 +7299,36 @@ VkResult ImageMemorySuballocator::allocateAndBindMemory(
                                                                memoryRequirements->memoryTypeBits);
     }
 
-    // Allocate and bind memory for the image. Try allocating on the device first.
-    VkResult result = vma::AllocateAndBindMemoryForImage(
-        allocator.getHandle(), &image->mHandle, requiredFlags, preferredFlags, memoryTypeBits,
-        allocateDedicatedMemory, &allocationOut->mHandle, memoryTypeIndexOut, sizeOut);
+    // Small images are suballocated from the pool of their memory type if enabled, which prevents
+    // VMA from giving them a dedicated allocation when the driver prefers one.
+    VmaPool smallImagePool = VK_NULL_HANDLE;
+    if (renderer->getFeatures().useSmallImageMemoryPools.enabled && !allocateDedicatedMemory &&
+        memoryRequirements->size < kSmallImagePoolSizeThreshold)
+    {
+        uint32_t poolMemoryTypeIndex =
+            FindSmallImagePoolMemoryType(renderer, requiredFlags | preferredFlags, memoryTypeBits);
+        if (poolMemoryTypeIndex != kInvalidMemoryTypeIndex)
+        {
+            smallImagePool = getOrCreateSmallImagePool(renderer, poolMemoryTypeIndex);
+        }
+    }
+
+    // Allocate and bind memory for the image. Try allocating on the device first.  If the pool
+    // allocation fails, the image falls back to the default VMA allocation.
+    VkResult result = VK_ERROR_OUT_OF_DEVICE_MEMORY;
+    if (smallImagePool != VK_NULL_HANDLE)
+    {
+        result = vma::AllocateAndBindMemoryForImage(
+            allocator.getHandle(), &image->mHandle, requiredFlags, preferredFlags, memoryTypeBits,
+            false, smallImagePool, &allocationOut->mHandle, memoryTypeIndexOut, sizeOut);
+    }
+    if (result != VK_SUCCESS)
+    {
+        result = vma::AllocateAndBindMemoryForImage(
+            allocator.getHandle(), &image->mHandle, requiredFlags, preferredFlags, memoryTypeBits,
+            allocateDedicatedMemory, VK_NULL_HANDLE, &allocationOut->mHandle, memoryTypeIndexOut,
+            sizeOut);
+    }
 
     // We need to get the property flags of the allocated memory if successful.
     if (result == VK_SUCCESS)
@@ -6819,5 +7375,34 @@ bool ImageMemorySuballocator::needsDedicatedMemory(VkDeviceSize size) const
     return size >= kImageSizeThresholdForDedicatedMemoryAllocation;
 }
 
+bool ImageMemorySuballocator::getSmallImagePoolStats(Renderer *renderer,
+                                                     uint32_t memoryTypeIndex,
+                                                     vma::StatInfo::BasicInfo *statsOut) const
+{
+    std::lock_guard<angle::SimpleMutex> lock(mSmallImagePoolsMutex);
+    VmaPool pool = mSmallImagePools[memoryTypeIndex];
+    if (pool == VK_NULL_HANDLE)
+    {
+        return false;
+    }
+
+    vma::GetPoolStats(renderer->getAllocator().getHandle(), pool, statsOut);
+    return true;
+}
+
+VmaPool ImageMemorySuballocator::getOrCreateSmallImagePool(Renderer *renderer,
+                                                           uint32_t memoryTypeIndex)
+{
+    std::lock_guard<angle::SimpleMutex> lock(mSmallImagePoolsMutex);
+    VmaPool &pool = mSmallImagePools[memoryTypeIndex];
+    if (pool == VK_NULL_HANDLE &&
+        vma::CreatePool(renderer->getAllocator().getHandle(), memoryTypeIndex,
+                        kSmallImagePoolBlockSize, &pool) != VK_SUCCESS)
+    {
+        pool = VK_NULL_HANDLE;
+    }
+    return pool;
+}
+
 }  // namespace vk
 }  // namespace rx
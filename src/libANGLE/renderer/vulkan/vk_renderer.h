@@ -26,6 +26,7 @@
 #include "libANGLE/Caps.h"
 #include "libANGLE/renderer/vulkan/CommandQueue.h"
 #include "libANGLE/renderer/vulkan/DebugAnnotatorVk.h"
+#include "libANGLE/renderer/vulkan/GraphicsPipelineDescCorpus.h"
 #include "libANGLE/renderer/vulkan/MemoryTracking.h"
 #include "libANGLE/renderer/vulkan/QueryVk.h"
 #include "libANGLE/renderer/vulkan/UtilsVk.h"
@@ -92,6 +93,20 @@ class ImageMemorySuballocator : angle::NonCopyable
 
     // Determines if dedicated memory is required for the allocation.
     bool needsDedicatedMemory(VkDeviceSize size) const;
+
+    // Returns the statistics of the small image pool of the given memory type.  Returns false if
+    // no such pool has been created.
+    bool getSmallImagePoolStats(vk::Renderer *renderer,
+                                uint32_t memoryTypeIndex,
+                                vma::StatInfo::BasicInfo *statsOut) const;
+
+  private:
+    // Returns the pool used for small images of the given memory type, creating it if necessary.
+    // Returns VK_NULL_HANDLE if the pool could not be created.
+    VmaPool getOrCreateSmallImagePool(vk::Renderer *renderer, uint32_t memoryTypeIndex);
+
+    mutable angle::SimpleMutex mSmallImagePoolsMutex;
+    std::array<VmaPool, VK_MAX_MEMORY_TYPES> mSmallImagePools;
 };
 
 // Supports one semaphore from current surface, and one semaphore passed to
@@ -192,6 +207,11 @@ class Renderer : angle::NonCopyable
     {
         return mDrmProperties;
     }
+    const VkPhysicalDeviceDescriptorBufferPropertiesEXT &
+    getPhysicalDeviceDescriptorBufferProperties() const
+    {
+        return mDescriptorBufferProperties;
+    }
     const VkPhysicalDevicePrimitivesGeneratedQueryFeaturesEXT &
     getPhysicalDevicePrimitivesGeneratedQueryFeatures() const
     {
@@ -202,6 +222,11 @@ class Renderer : angle::NonCopyable
     {
         return mHostImageCopyProperties;
     }
+    const VkPhysicalDeviceExternalMemoryHostPropertiesEXT &
+    getPhysicalDeviceExternalMemoryHostProperties() const
+    {
+        return mExternalMemoryHostProperties;
+    }
     const VkPhysicalDeviceFeatures &getPhysicalDeviceFeatures() const
     {
         return mPhysicalDeviceFeatures;
@@ -232,6 +257,10 @@ class Renderer : angle::NonCopyable
     {
         return mCommandQueue.getDeviceQueueIndex(priority);
     }
+    // The queue family without graphics support found on the device, and the queue created from it
+    // with the createDedicatedAsyncQueue feature (VK_NULL_HANDLE otherwise).
+    uint32_t getAsyncQueueFamilyIndex() const { return mAsyncQueueFamilyIndex; }
+    VkQueue getAsyncQueue() const { return mAsyncQueue; }
     const DeviceQueueIndex getDefaultDeviceQueueIndex() const
     {
         // By default it will always use medium priority
@@ -248,15 +277,18 @@ class Renderer : angle::NonCopyable
     const vk::Format &getFormat(angle::FormatID formatID) const { return mFormatTable[formatID]; }
 
     // Get the pipeline cache data after retrieving the size, but only if the size is increased
-    // since last query.  This function should be called with the |mPipelineCacheMutex| lock already
+    // since last query.  This function should be called with the shard's |mutex| lock already
     // held.
     angle::Result getLockedPipelineCacheDataIfNew(vk::Context *context,
+                                                  size_t shardIndex,
                                                   size_t *pipelineCacheSizeOut,
                                                   size_t lastSyncSize,
                                                   std::vector<uint8_t> *pipelineCacheDataOut);
     angle::Result syncPipelineCacheVk(vk::Context *context,
                                       vk::GlobalOps *globalOps,
                                       const gl::Context *contextGL);
+    // The serialized size of all the pipeline cache shards, for EGL_ANGLE_memory_usage_report.
+    size_t getPipelineCacheSize();
 
     const angle::FeaturesVk &getFeatures() const { return mFeatures; }
     uint32_t getMaxVertexAttribDivisor() const { return mMaxVertexAttribDivisor; }
@@ -341,7 +373,8 @@ class Renderer : angle::NonCopyable
     {
         ASSERT(!sharedGarbage.empty());
         vk::SharedGarbage garbage(use, std::move(sharedGarbage));
-        mSharedGarbageList.add(this, std::move(garbage));
+        mSharedGarbageList.add(this, std::move(garbage),
+                               isAsyncCommandBufferResetAndGarbageCleanupEnabled());
     }
 
     void collectSuballocationGarbage(const vk::ResourceUse &use,
@@ -349,13 +382,29 @@ class Renderer : angle::NonCopyable
                                      vk::Buffer &&buffer)
     {
         vk::BufferSuballocationGarbage garbage(use, std::move(suballocation), std::move(buffer));
-        mSuballocationGarbageList.add(this, std::move(garbage));
+        mSuballocationGarbageList.add(this, std::move(garbage),
+                                      isAsyncCommandBufferResetAndGarbageCleanupEnabled());
     }
 
-    size_t getNextPipelineCacheBlobCacheSlotIndex(size_t *previousSlotIndexOut);
-    size_t updatePipelineCacheChunkCount(size_t chunkCount);
-    angle::Result getPipelineCache(vk::Context *context, vk::PipelineCacheAccess *pipelineCacheOut);
+    size_t getNextPipelineCacheBlobCacheSlotIndex(size_t shardIndex, size_t *previousSlotIndexOut);
+    size_t updatePipelineCacheChunkCount(size_t shardIndex, size_t chunkCount);
+    angle::Result getPipelineCache(vk::Context *context, vk::PipelineCacheAccess *pipelineCacheOut)
+    {
+        return getPipelineCache(context, 0, pipelineCacheOut);
+    }
+    // When shardPipelineCacheInBlobCache is enabled, |shardKey| selects which of the global
+    // pipeline caches is used.  Pipelines with the same key (typically the hash of their pipeline
+    // layout) end up in the same cache, and thus in the same set of blob cache entries.
+    angle::Result getPipelineCache(vk::Context *context,
+                                   size_t shardKey,
+                                   vk::PipelineCacheAccess *pipelineCacheOut);
+    angle::Result mergeIntoPipelineCache(vk::Context *context,
+                                         const vk::PipelineCache &pipelineCache)
+    {
+        return mergeIntoPipelineCache(context, 0, pipelineCache);
+    }
     angle::Result mergeIntoPipelineCache(vk::Context *context,
+                                         size_t shardKey,
                                          const vk::PipelineCache &pipelineCache);
 
     void onNewValidationMessage(const std::string &message);
@@ -388,8 +437,14 @@ class Renderer : angle::NonCopyable
         return mCommandQueue.getPerfCounters();
     }
     void resetCommandQueuePerFrameCounters() { mCommandQueue.resetPerFramePerfCounters(); }
+    size_t getInFlightCommandBatchCount() const
+    {
+        return mCommandQueue.getInFlightCommandBatchCount();
+    }
 
     vk::GlobalOps *getGlobalOps() const { return mGlobalOps; }
+    // Used when the displays sharing the renderer change.  Null while no display uses it.
+    void setGlobalOps(vk::GlobalOps *globalOps) { mGlobalOps = globalOps; }
 
     bool enableDebugUtils() const { return mEnableDebugUtils; }
     bool angleDebuggerMode() const { return mAngleDebuggerMode; }
@@ -590,6 +645,17 @@ class Renderer : angle::NonCopyable
         return mSharedGarbageList.getUnsubmittedGarbageSize();
     }
 
+    // Accumulated time spent in cleanupGarbage(), split by whether it ran on the cleanup thread or
+    // on an application thread.
+    uint64_t getAppThreadGarbageCleanupDurationNs() const
+    {
+        return mAppThreadGarbageCleanupDurationNs.load(std::memory_order_relaxed);
+    }
+    uint64_t getCleanUpThreadGarbageCleanupDurationNs() const
+    {
+        return mCleanUpThreadGarbageCleanupDurationNs.load(std::memory_order_relaxed);
+    }
+
     ANGLE_INLINE VkFilter getPreferredFilterForYUV(VkFilter defaultFilter)
     {
         return getFeatures().preferLinearFilterForYUV.enabled ? VK_FILTER_LINEAR : defaultFilter;
@@ -668,6 +734,14 @@ class Renderer : angle::NonCopyable
         return mPipelineCacheGraphDumpPath.c_str();
     }
 
+    // Graphics pipeline descs recorded by a previous run (ANGLE_GRAPHICS_PIPELINE_DESC_CORPUS), or
+    // being recorded by this one (ANGLE_DUMP_GRAPHICS_PIPELINE_DESCS).
+    vk::GraphicsPipelineDescCorpus *getGraphicsPipelineDescCorpus()
+    {
+        return &mGraphicsPipelineDescCorpus;
+    }
+    bool isGraphicsPipelineDescRecordingEnabled() const { return mRecordGraphicsPipelineDescs; }
+
     vk::RefCountedEventRecycler *getRefCountedEventRecycler() { return &mRefCountedEventRecycler; }
 
     std::thread::id getCleanUpThreadId() const { return mCleanUpThread.getThreadId(); }
@@ -732,9 +806,11 @@ class Renderer : angle::NonCopyable
                       angle::NativeWindowSystem nativeWindowSystem);
     void appBasedFeatureOverrides(const vk::ExtensionNameList &extensions);
     angle::Result initPipelineCache(vk::Context *context,
+                                    size_t shardIndex,
                                     vk::PipelineCache *pipelineCache,
                                     bool *success);
-    angle::Result ensurePipelineCacheInitialized(vk::Context *context);
+    angle::Result ensurePipelineCacheInitialized(vk::Context *context, size_t shardIndex);
+    size_t getPipelineCacheShardIndex(size_t shardKey) const;
 
     template <VkFormatFeatureFlags VkFormatProperties::*features>
     VkFormatFeatureFlags getFormatFeatureBits(angle::FormatID formatID,
@@ -751,6 +827,8 @@ class Renderer : angle::NonCopyable
     void queryAndCacheFragmentShadingRates();
     // Determine support for shading rate based rendering
     bool canSupportFragmentShadingRate() const;
+    // Determine support for reading the GPU clock with VK_EXT_calibrated_timestamps
+    bool canSupportCalibratedTimestamps() const;
     // Determine support for foveated rendering
     bool canSupportFoveatedRendering() const;
     // Prefer host visible device local via device local based on device type and heap size.
@@ -840,6 +918,7 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceSamplerYcbcrConversionFeatures mSamplerYcbcrConversionFeatures;
     VkPhysicalDeviceExtendedDynamicStateFeaturesEXT mExtendedDynamicStateFeatures;
     VkPhysicalDeviceExtendedDynamicState2FeaturesEXT mExtendedDynamicState2Features;
+    VkPhysicalDeviceExtendedDynamicState3FeaturesEXT mExtendedDynamicState3Features;
     VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT mGraphicsPipelineLibraryFeatures;
     VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT mGraphicsPipelineLibraryProperties;
     VkPhysicalDeviceVertexInputDynamicStateFeaturesEXT mVertexInputDynamicStateFeatures;
@@ -851,13 +930,17 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceImagelessFramebufferFeaturesKHR mImagelessFramebufferFeatures;
     VkPhysicalDevicePipelineRobustnessFeaturesEXT mPipelineRobustnessFeatures;
     VkPhysicalDevicePipelineProtectedAccessFeaturesEXT mPipelineProtectedAccessFeatures;
+    VkPhysicalDeviceShaderObjectFeaturesEXT mShaderObjectFeatures;
     VkPhysicalDeviceRasterizationOrderAttachmentAccessFeaturesEXT
         mRasterizationOrderAttachmentAccessFeatures;
     VkPhysicalDeviceShaderAtomicFloatFeaturesEXT mShaderAtomicFloatFeatures;
     VkPhysicalDeviceMaintenance5FeaturesKHR mMaintenance5Features;
     VkPhysicalDeviceSwapchainMaintenance1FeaturesEXT mSwapchainMaintenance1Features;
+    VkPhysicalDevicePresentIdFeaturesKHR mPresentIdFeatures;
+    VkPhysicalDevicePresentWaitFeaturesKHR mPresentWaitFeatures;
     VkPhysicalDeviceLegacyDitheringFeaturesEXT mDitheringFeatures;
     VkPhysicalDeviceDrmPropertiesEXT mDrmProperties;
+    VkPhysicalDeviceExternalMemoryHostPropertiesEXT mExternalMemoryHostProperties;
     VkPhysicalDeviceTimelineSemaphoreFeaturesKHR mTimelineSemaphoreFeatures;
     VkPhysicalDeviceHostImageCopyFeaturesEXT mHostImageCopyFeatures;
     VkPhysicalDeviceHostImageCopyPropertiesEXT mHostImageCopyProperties;
@@ -867,11 +950,14 @@ class Renderer : angle::NonCopyable
     VkPhysicalDeviceImageCompressionControlFeaturesEXT mImageCompressionControlFeatures;
     VkPhysicalDeviceImageCompressionControlSwapchainFeaturesEXT
         mImageCompressionControlSwapchainFeatures;
+    VkPhysicalDeviceDescriptorBufferFeaturesEXT mDescriptorBufferFeatures;
+    VkPhysicalDeviceDescriptorBufferPropertiesEXT mDescriptorBufferProperties;
 #if defined(ANGLE_PLATFORM_ANDROID)
     VkPhysicalDeviceExternalFormatResolveFeaturesANDROID mExternalFormatResolveFeatures;
     VkPhysicalDeviceExternalFormatResolvePropertiesANDROID mExternalFormatResolveProperties;
 #endif
     VkPhysicalDevice8BitStorageFeatures m8BitStorageFeatures;
+    VkPhysicalDeviceDescriptorIndexingFeatures mDescriptorIndexingFeatures;
     VkPhysicalDevice16BitStorageFeatures m16BitStorageFeatures;
     VkPhysicalDeviceSynchronization2Features mSynchronization2Features;
     VkPhysicalDeviceVariablePointersFeatures mVariablePointersFeatures;
@@ -884,6 +970,9 @@ class Renderer : angle::NonCopyable
         mSupportedFragmentShadingRateSampleCounts;
     std::vector<VkQueueFamilyProperties> mQueueFamilyProperties;
     uint32_t mCurrentQueueFamilyIndex;
+    // A queue family without graphics support, preferably compute, or kInvalidIndex if none.
+    uint32_t mAsyncQueueFamilyIndex;
+    VkQueue mAsyncQueue;
     uint32_t mMaxVertexAttribDivisor;
     VkDeviceSize mMaxVertexAttribStride;
     mutable uint32_t mMaxColorInputAttachmentCount;
@@ -901,6 +990,8 @@ class Renderer : angle::NonCopyable
     vk::BufferBlockGarbageList mOrphanedBufferBlockList;
     // Holds RefCountedEvent that are free and ready to reuse
     vk::RefCountedEventRecycler mRefCountedEventRecycler;
+    std::atomic<uint64_t> mAppThreadGarbageCleanupDurationNs{0};
+    std::atomic<uint64_t> mCleanUpThreadGarbageCleanupDurationNs{0};
 
     VkDeviceSize mPendingGarbageSizeLimit;
 
@@ -926,19 +1017,28 @@ class Renderer : angle::NonCopyable
     uint32_t mDeviceLocalVertexConversionBufferMemoryTypeIndex;
     size_t mVertexConversionBufferAlignment;
 
-    // The mutex protects -
-    // 1. initialization of the cache
-    // 2. Vulkan driver guarantess synchronization for read and write operations but the spec
-    //    requires external synchronization when mPipelineCache is the dstCache of
-    //    vkMergePipelineCaches. Lock the mutex if mergeProgramPipelineCachesToGlobalCache is
-    //    enabled
-    angle::SimpleMutex mPipelineCacheMutex;
-    vk::PipelineCache mPipelineCache;
-    size_t mCurrentPipelineCacheBlobCacheSlotIndex;
-    size_t mPipelineCacheChunkCount;
+    // The global pipeline cache is split in shards when shardPipelineCacheInBlobCache is enabled.
+    // Each shard is independently loaded from and stored to the blob cache, so that a change in
+    // one shard doesn't require reserializing and recompressing the entire cache.  Without the
+    // feature, only the first shard is used.
+    static constexpr size_t kPipelineCacheShardCount = 16;
+    struct PipelineCacheShard
+    {
+        // The mutex protects -
+        // 1. initialization of the cache
+        // 2. Vulkan driver guarantess synchronization for read and write operations but the spec
+        //    requires external synchronization when |cache| is the dstCache of
+        //    vkMergePipelineCaches. Lock the mutex if mergeProgramPipelineCachesToGlobalCache is
+        //    enabled
+        angle::SimpleMutex mutex;
+        vk::PipelineCache cache;
+        size_t blobCacheSlotIndex = 0;
+        size_t chunkCount         = 0;
+        size_t sizeAtLastSync     = 0;
+        std::atomic<bool> initialized{false};
+    };
+    std::array<PipelineCacheShard, kPipelineCacheShardCount> mPipelineCacheShards;
     uint32_t mPipelineCacheVkUpdateTimeout;
-    size_t mPipelineCacheSizeAtLastSync;
-    std::atomic<bool> mPipelineCacheInitialized;
 
     // Latest validation data for debug overlay.
     std::string mLastValidationMessage;
@@ -1048,6 +1148,10 @@ class Renderer : angle::NonCopyable
     bool mDumpPipelineCacheGraph;
     std::string mPipelineCacheGraphDumpPath;
 
+    // Pipeline descs used to precompile pipelines at link time, or recorded to be dumped at exit.
+    vk::GraphicsPipelineDescCorpus mGraphicsPipelineDescCorpus;
+    bool mRecordGraphicsPipelineDescs;
+
     // A placeholder descriptor set layout handle for layouts with no bindings.
     vk::DescriptorSetLayoutPtr mPlaceHolderDescriptorSetLayout;
 };
@@ -44,11 +44,11 @@ angle::Result Resource::waitForIdle(ContextVk *contextVk,
 
 std::ostream &operator<<(std::ostream &os, const ResourceUse &use)
 {
-    const Serials &serials = use.getSerials();
+    const QueueSerials &serials = use.getQueueSerials();
     os << '{';
     for (size_t i = 0; i < serials.size(); i++)
     {
-        os << serials[i].getValue();
+        os << serials[i].getIndex() << ':' << serials[i].getSerial().getValue();
         if (i < serials.size() - 1)
         {
             os << ",";
@@ -24,13 +24,13 @@ namespace vk
 // We expect almost all reasonable usage case should have at most 4 current contexts now. When
 // exceeded, it should still work, but storage will grow.
 static constexpr size_t kMaxFastQueueSerials = 4;
-// Serials is an array of queue serials, which when paired with the index of the serials in the
-// array result in QueueSerials. The array may expand if needed. Since it owned by Resource object
-// which is protected by shared lock, it is safe to reallocate storage if needed. When it passes to
-// renderer at garbage collection time, we will make a copy. The array size is expected to be small.
-// But in future if we run into situation that array size is too big, we can change to packed array
-// of QueueSerials.
-using Serials = angle::FastVector<Serial, kMaxFastQueueSerials>;
+// QueueSerials is a sparse list of queue serials, one for each serial index that has used a
+// resource, in no particular order. A resource is typically used by very few of the queue serial
+// indices in flight, so the cost of tracking it remains constant however many contexts are
+// current. Since it is owned by Resource object which is protected by shared lock, it is safe to
+// reallocate storage if needed. When it passes to renderer at garbage collection time, we will
+// make a copy.
+using QueueSerials = angle::FastVector<QueueSerial, kMaxFastQueueSerials>;
 
 // Tracks how a resource is used by ANGLE and by a VkQueue. The serial indicates the most recent use
 // of a resource in the VkQueue. We use the monotonically incrementing serial number to determine if
@@ -42,7 +42,6 @@ class ResourceUse final
     ~ResourceUse() = default;
 
     ResourceUse(const QueueSerial &queueSerial) { setQueueSerial(queueSerial); }
-    ResourceUse(const Serials &otherSerials) { mSerials = otherSerials; }
 
     // Copy constructor
     ResourceUse(const ResourceUse &other) : mSerials(other.mSerials) {}
@@ -65,17 +64,27 @@ class ResourceUse final
 
     void reset() { mSerials.clear(); }
 
-    const Serials &getSerials() const { return mSerials; }
+    const QueueSerials &getQueueSerials() const { return mSerials; }
+
+    // Returns the most recent use at the given serial index, or kZeroSerial if it was never used at
+    // that index.
+    Serial getSerial(SerialIndex index) const
+    {
+        const QueueSerial *queueSerial = find(index);
+        return queueSerial != nullptr ? queueSerial->getSerial() : kZeroSerial;
+    }
 
     void setSerial(SerialIndex index, Serial serial)
     {
         ASSERT(index != kInvalidQueueSerialIndex);
-        if (ANGLE_UNLIKELY(mSerials.size() <= index))
+        QueueSerial *queueSerial = find(index);
+        if (ANGLE_UNLIKELY(queueSerial == nullptr))
         {
-            mSerials.resize(index + 1, kZeroSerial);
+            mSerials.push_back(QueueSerial(index, serial));
+            return;
         }
-        ASSERT(mSerials[index] <= serial);
-        mSerials[index] = serial;
+        ASSERT(queueSerial->getSerial() <= serial);
+        *queueSerial = QueueSerial(index, serial);
     }
 
     void setQueueSerial(const QueueSerial &queueSerial)
@@ -86,10 +95,9 @@ class ResourceUse final
     // Returns true if there is at least one serial is greater than
     bool operator>(const AtomicQueueSerialFixedArray &serials) const
     {
-        ASSERT(mSerials.size() <= serials.size());
-        for (SerialIndex i = 0; i < mSerials.size(); ++i)
+        for (const QueueSerial &queueSerial : mSerials)
         {
-            if (mSerials[i] > serials[i])
+            if (queueSerial > serials)
             {
                 return true;
             }
@@ -100,22 +108,21 @@ class ResourceUse final
     // Returns true if it contains a serial that is greater than
     bool operator>(const QueueSerial &queuSerial) const
     {
-        return mSerials.size() > queuSerial.getIndex() &&
-               mSerials[queuSerial.getIndex()] > queuSerial.getSerial();
+        const QueueSerial *ownSerial = find(queuSerial.getIndex());
+        return ownSerial != nullptr && *ownSerial > queuSerial;
     }
     bool operator>=(const QueueSerial &queueSerial) const
     {
-        return mSerials.size() > queueSerial.getIndex() &&
-               mSerials[queueSerial.getIndex()] >= queueSerial.getSerial();
+        const QueueSerial *ownSerial = find(queueSerial.getIndex());
+        return ownSerial != nullptr && *ownSerial >= queueSerial;
     }
 
     // Returns true if all serials are less than or equal
     bool operator<=(const AtomicQueueSerialFixedArray &serials) const
     {
-        ASSERT(mSerials.size() <= serials.size());
-        for (SerialIndex i = 0; i < mSerials.size(); ++i)
+        for (const QueueSerial &queueSerial : mSerials)
         {
-            if (mSerials[i] > serials[i])
+            if (queueSerial > serials)
             {
                 return false;
             }
@@ -127,31 +134,46 @@ class ResourceUse final
     {
         ASSERT(commandBufferQueueSerial.valid());
         // Return true if we have the exact queue serial in the array.
-        return mSerials.size() > commandBufferQueueSerial.getIndex() &&
-               mSerials[commandBufferQueueSerial.getIndex()] ==
-                   commandBufferQueueSerial.getSerial();
+        const QueueSerial *ownSerial = find(commandBufferQueueSerial.getIndex());
+        return ownSerial != nullptr && *ownSerial == commandBufferQueueSerial;
     }
 
     // Merge other's serials into this object.
     void merge(const ResourceUse &other)
     {
-        if (mSerials.size() < other.mSerials.size())
+        for (const QueueSerial &otherSerial : other.mSerials)
         {
-            mSerials.resize(other.mSerials.size(), kZeroSerial);
+            QueueSerial *ownSerial = find(otherSerial.getIndex());
+            if (ownSerial == nullptr)
+            {
+                mSerials.push_back(otherSerial);
+            }
+            else if (*ownSerial < otherSerial)
+            {
+                *ownSerial = otherSerial;
+            }
         }
+    }
 
-        for (SerialIndex i = 0; i < other.mSerials.size(); ++i)
+  private:
+    QueueSerial *find(SerialIndex index)
+    {
+        for (QueueSerial &queueSerial : mSerials)
         {
-            if (mSerials[i] < other.mSerials[i])
+            if (queueSerial.getIndex() == index)
             {
-                mSerials[i] = other.mSerials[i];
+                return &queueSerial;
             }
         }
+        return nullptr;
+    }
+    const QueueSerial *find(SerialIndex index) const
+    {
+        return const_cast<ResourceUse *>(this)->find(index);
     }
 
-  private:
-    // The most recent time of use in a VkQueue.
-    Serials mSerials;
+    // The most recent time of use in a VkQueue, for each serial index that used the resource.
+    QueueSerials mSerials;
 };
 std::ostream &operator<<(std::ostream &os, const ResourceUse &use);
 
@@ -195,10 +217,13 @@ class SharedGarbageList final : angle::NonCopyable
         ASSERT(mUnsubmittedQueue.empty());
     }
 
-    void add(Renderer *renderer, T &&garbage)
+    // When |deferDestroy| is true, garbage is always enqueued even if its GPU use has already
+    // completed, so that the destruction happens when the cleanup thread calls
+    // cleanupSubmittedGarbage() instead of on the calling thread.
+    void add(Renderer *renderer, T &&garbage, bool deferDestroy)
     {
         VkDeviceSize size = garbage.getSize();
-        if (garbage.destroyIfComplete(renderer))
+        if (!deferDestroy && garbage.destroyIfComplete(renderer))
         {
             mTotalGarbageDestroyed += size;
         }
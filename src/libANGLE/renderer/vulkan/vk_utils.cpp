@@ -635,6 +635,24 @@ angle::Result InitShaderModule(Context *context,
     return angle::Result::Continue;
 }
 
+uint32_t MakeFlipUniform(bool flipX, bool flipY, bool invertViewport)
+{
+    // Create snorm values of either -1 or 1, based on whether flipping is enabled or not
+    // respectively.
+    constexpr uint8_t kSnormOne      = 0x7F;
+    constexpr uint8_t kSnormMinusOne = 0x81;
+
+    // .xy are flips for the fragment stage.
+    uint32_t x = flipX ? kSnormMinusOne : kSnormOne;
+    uint32_t y = flipY ? kSnormMinusOne : kSnormOne;
+
+    // .zw are flips for the vertex stage.
+    uint32_t z = x;
+    uint32_t w = flipY != invertViewport ? kSnormMinusOne : kSnormOne;
+
+    return x | y << 8 | z << 16 | w << 24;
+}
+
 gl::TextureType Get2DTextureType(uint32_t layerCount, GLint samples)
 {
     if (layerCount > 1)
@@ -917,6 +935,9 @@ PFN_vkGetPhysicalDeviceMemoryProperties2KHR vkGetPhysicalDeviceMemoryProperties2
 // VK_KHR_external_semaphore_fd
 PFN_vkImportSemaphoreFdKHR vkImportSemaphoreFdKHR = nullptr;
 
+// VK_EXT_external_memory_host
+PFN_vkGetMemoryHostPointerPropertiesEXT vkGetMemoryHostPointerPropertiesEXT = nullptr;
+
 // VK_EXT_host_query_reset
 PFN_vkResetQueryPoolEXT vkResetQueryPoolEXT = nullptr;
 
@@ -1008,6 +1029,9 @@ PFN_vkCmdSetPatchControlPointsEXT vkCmdSetPatchControlPointsEXT           = null
 PFN_vkCmdSetPrimitiveRestartEnableEXT vkCmdSetPrimitiveRestartEnableEXT   = nullptr;
 PFN_vkCmdSetRasterizerDiscardEnableEXT vkCmdSetRasterizerDiscardEnableEXT = nullptr;
 
+// VK_EXT_extended_dynamic_state3
+PFN_vkCmdSetColorBlendEquationEXT vkCmdSetColorBlendEquationEXT = nullptr;
+
 // VK_EXT_vertex_input_dynamic_state
 PFN_vkCmdSetVertexInputEXT vkCmdSetVertexInputEXT = nullptr;
 
@@ -1026,6 +1050,14 @@ PFN_vkCmdSetFragmentShadingRateKHR vkCmdSetFragmentShadingRateKHR
 // VK_GOOGLE_display_timing
 PFN_vkGetPastPresentationTimingGOOGLE vkGetPastPresentationTimingGOOGLE = nullptr;
 
+// VK_KHR_present_wait
+PFN_vkWaitForPresentKHR vkWaitForPresentKHR = nullptr;
+
+// VK_EXT_calibrated_timestamps
+PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT vkGetPhysicalDeviceCalibrateableTimeDomainsEXT =
+    nullptr;
+PFN_vkGetCalibratedTimestampsEXT vkGetCalibratedTimestampsEXT = nullptr;
+
 // VK_EXT_host_image_copy
 PFN_vkCopyImageToImageEXT vkCopyImageToImageEXT                     = nullptr;
 PFN_vkCopyImageToMemoryEXT vkCopyImageToMemoryEXT                   = nullptr;
@@ -1033,6 +1065,13 @@ PFN_vkCopyMemoryToImageEXT vkCopyMemoryToImageEXT                   = nullptr;
 PFN_vkGetImageSubresourceLayout2EXT vkGetImageSubresourceLayout2EXT = nullptr;
 PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT           = nullptr;
 
+// VK_EXT_descriptor_buffer
+PFN_vkGetDescriptorSetLayoutSizeEXT vkGetDescriptorSetLayoutSizeEXT                   = nullptr;
+PFN_vkGetDescriptorSetLayoutBindingOffsetEXT vkGetDescriptorSetLayoutBindingOffsetEXT = nullptr;
+PFN_vkGetDescriptorEXT vkGetDescriptorEXT                                             = nullptr;
+PFN_vkCmdBindDescriptorBuffersEXT vkCmdBindDescriptorBuffersEXT                       = nullptr;
+PFN_vkCmdSetDescriptorBufferOffsetsEXT vkCmdSetDescriptorBufferOffsetsEXT             = nullptr;
+
 // VK_KHR_Synchronization2
 PFN_vkCmdPipelineBarrier2KHR vkCmdPipelineBarrier2KHR = nullptr;
 PFN_vkCmdWriteTimestamp2KHR vkCmdWriteTimestamp2KHR   = nullptr;
@@ -1090,6 +1129,11 @@ void InitExternalSemaphoreFdFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkImportSemaphoreFdKHR);
 }
 
+void InitExternalMemoryHostFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetMemoryHostPointerPropertiesEXT);
+}
+
 void InitHostQueryResetFunctions(VkDevice device)
 {
     GET_DEVICE_FUNC(vkResetQueryPoolEXT);
@@ -1135,6 +1179,12 @@ void InitExtendedDynamicState2EXTFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCmdSetRasterizerDiscardEnableEXT);
 }
 
+// VK_EXT_extended_dynamic_state3
+void InitExtendedDynamicState3EXTFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCmdSetColorBlendEquationEXT);
+}
+
 // VK_EXT_vertex_input_dynamic_state
 void InitVertexInputDynamicStateEXTFunctions(VkDevice device)
 {
@@ -1172,6 +1222,23 @@ void InitGetPastPresentationTimingGoogleFunction(VkDevice device)
     GET_DEVICE_FUNC(vkGetPastPresentationTimingGOOGLE);
 }
 
+// VK_KHR_present_wait
+void InitPresentWaitFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkWaitForPresentKHR);
+}
+
+// VK_EXT_calibrated_timestamps
+void InitCalibratedTimestampsInstanceFunction(VkInstance instance)
+{
+    GET_INSTANCE_FUNC(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT);
+}
+
+void InitCalibratedTimestampsDeviceFunction(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetCalibratedTimestampsEXT);
+}
+
 // VK_EXT_host_image_copy
 void InitHostImageCopyFunctions(VkDevice device)
 {
@@ -1182,6 +1249,16 @@ void InitHostImageCopyFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkTransitionImageLayoutEXT);
 }
 
+// VK_EXT_descriptor_buffer
+void InitDescriptorBufferFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetDescriptorSetLayoutSizeEXT);
+    GET_DEVICE_FUNC(vkGetDescriptorSetLayoutBindingOffsetEXT);
+    GET_DEVICE_FUNC(vkGetDescriptorEXT);
+    GET_DEVICE_FUNC(vkCmdBindDescriptorBuffersEXT);
+    GET_DEVICE_FUNC(vkCmdSetDescriptorBufferOffsetsEXT);
+}
+
 void InitSynchronization2Functions(VkDevice device)
 {
     GET_DEVICE_FUNC(vkCmdPipelineBarrier2KHR);
@@ -369,7 +369,8 @@ class Context : angle::NonCopyable
     const DeviceQueueIndex &getDeviceQueueIndex() const { return mDeviceQueueIndex; }
 
   protected:
-    Renderer *const mRenderer;
+    // Only replaced by DisplayVk, when it shares the renderer of another display.
+    Renderer *mRenderer;
     // Stash the ShareGroupVk's RefCountedEventRecycler here ImageHelper to conveniently access
     RefCountedEventsGarbageRecycler *mShareGroupRefCountedEventsGarbageRecycler;
     DeviceQueueIndex mDeviceQueueIndex;
@@ -1181,12 +1182,17 @@ struct SpecializationConstants final
 {
     VkBool32 surfaceRotation;
     uint32_t dither;
+    uint32_t flip;
 };
 ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
 
 template <typename T>
 using SpecializationConstantMap = angle::PackedEnumMap<sh::vk::SpecializationConstantId, T>;
 
+// Packs the flip values as expected by the flipXY driver uniform and the Flip specialization
+// constant.
+uint32_t MakeFlipUniform(bool flipX, bool flipY, bool invertViewport);
+
 using ShaderModulePtr = SharedPtr<ShaderModule>;
 using ShaderModuleMap = gl::ShaderMap<ShaderModulePtr>;
 
@@ -1385,6 +1391,9 @@ void InitGGPStreamDescriptorSurfaceFunctions(VkInstance instance);
 // VK_KHR_external_semaphore_fd
 void InitExternalSemaphoreFdFunctions(VkDevice device);
 
+// VK_EXT_external_memory_host
+void InitExternalMemoryHostFunctions(VkDevice device);
+
 // VK_EXT_host_query_reset
 void InitHostQueryResetFunctions(VkDevice device);
 
@@ -1400,6 +1409,9 @@ void InitExtendedDynamicStateEXTFunctions(VkDevice device);
 // VK_EXT_extended_dynamic_state2
 void InitExtendedDynamicState2EXTFunctions(VkDevice device);
 
+// VK_EXT_extended_dynamic_state3
+void InitExtendedDynamicState3EXTFunctions(VkDevice device);
+
 // VK_EXT_vertex_input_dynamic_state
 void InitVertexInputDynamicStateEXTFunctions(VkDevice device);
 
@@ -1416,9 +1428,19 @@ void InitFragmentShadingRateKHRDeviceFunction(VkDevice device);
 // VK_GOOGLE_display_timing
 void InitGetPastPresentationTimingGoogleFunction(VkDevice device);
 
+// VK_KHR_present_wait
+void InitPresentWaitFunctions(VkDevice device);
+
+// VK_EXT_calibrated_timestamps
+void InitCalibratedTimestampsInstanceFunction(VkInstance instance);
+void InitCalibratedTimestampsDeviceFunction(VkDevice device);
+
 // VK_EXT_host_image_copy
 void InitHostImageCopyFunctions(VkDevice device);
 
+// VK_EXT_descriptor_buffer
+void InitDescriptorBufferFunctions(VkDevice device);
+
 // VK_KHR_Synchronization2
 void InitSynchronization2Functions(VkDevice device);
 
@@ -344,6 +344,9 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
                        const void *data);
 
     void setBlendConstants(const float blendConstants[4]);
+    void setColorBlendEquation(uint32_t firstAttachment,
+                               uint32_t attachmentCount,
+                               const VkColorBlendEquationEXT *colorBlendEquations);
     void setCullMode(VkCullModeFlags cullMode);
     void setDepthBias(float depthBiasConstantFactor,
                       float depthBiasClamp,
@@ -1089,6 +1092,15 @@ ANGLE_INLINE void CommandBuffer::setBlendConstants(const float blendConstants[4]
     vkCmdSetBlendConstants(mHandle, blendConstants);
 }
 
+ANGLE_INLINE void CommandBuffer::setColorBlendEquation(
+    uint32_t firstAttachment,
+    uint32_t attachmentCount,
+    const VkColorBlendEquationEXT *colorBlendEquations)
+{
+    ASSERT(valid());
+    vkCmdSetColorBlendEquationEXT(mHandle, firstAttachment, attachmentCount, colorBlendEquations);
+}
+
 ANGLE_INLINE void CommandBuffer::setCullMode(VkCullModeFlags cullMode)
 {
     ASSERT(valid());
@@ -122,10 +122,24 @@ angle::Result BufferWgpu::setSubData(const gl::Context *context,
         uint8_t *mappedData = mBuffer.getMapWritePointer(offset, size);
         memcpy(mappedData, data, size);
     }
+    else if (offset % webgpu::kBufferCopyToBufferAlignment == 0 &&
+             size % webgpu::kBufferCopyToBufferAlignment == 0)
+    {
+        // Copy through the staging belt so that the write is ordered with the commands recorded
+        // so far, and doesn't cost a queue write per call.
+        webgpu::StagingAllocation staging;
+        ANGLE_TRY(contextWgpu->getStagingBelt().allocate(
+            contextWgpu, size, webgpu::kBufferCopyToBufferAlignment, &staging));
+        memcpy(staging.data, data, size);
+
+        ANGLE_TRY(contextWgpu->endRenderPass(webgpu::RenderPassClosureReason::BufferUpload));
+        contextWgpu->ensureCommandEncoderCreated();
+        contextWgpu->getCurrentCommandEncoder().CopyBufferToBuffer(
+            staging.buffer, staging.offset, mBuffer.getBuffer(), offset, size);
+    }
     else
     {
-        // TODO: Upload into a staging buffer and copy to the destination buffer so that the copy
-        // happens at the right point in time for command buffer recording.
+        // TODO: Handle unaligned updates by expanding them to cover the surrounding words.
         wgpu::Queue &queue = contextWgpu->getQueue();
         queue.WriteBuffer(mBuffer.getBuffer(), offset, data, size);
     }
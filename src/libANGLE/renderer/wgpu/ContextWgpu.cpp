@@ -57,6 +57,10 @@ constexpr angle::PackedEnumMap<webgpu::RenderPassClosureReason, const char *>
          "Render pass closed due to index buffer read back for streamed client data"},
         {webgpu::RenderPassClosureReason::VertexArrayStreaming,
          "Render pass closed for uploading streamed client data"},
+        {webgpu::RenderPassClosureReason::BufferUpload,
+         "Render pass closed for copying buffer data from the staging belt"},
+        {webgpu::RenderPassClosureReason::TextureUpload,
+         "Render pass closed for copying texture data from the staging belt"},
     }};
 
 }  // namespace
@@ -79,6 +83,7 @@ ContextWgpu::~ContextWgpu() {}
 void ContextWgpu::onDestroy(const gl::Context *context)
 {
     mImageLoadContext = {};
+    mStagingBelt.destroy();
 }
 
 angle::Result ContextWgpu::initialize(const angle::ImageLoadContext &imageLoadContext)
@@ -111,9 +116,42 @@ angle::Result ContextWgpu::flush(webgpu::RenderPassClosureReason closureReason)
         wgpu::CommandBuffer commandBuffer = mCurrentCommandEncoder.Finish();
         mCurrentCommandEncoder            = nullptr;
 
+        mStagingBelt.prepareForSubmit();
         getQueue().Submit(1, &commandBuffer);
+        mStagingBelt.onSubmit();
     }
 
+    // Queue writes made from now on happen after the submitted work, so the ring can be reused.
+    mUniformRingOffset = 0;
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextWgpu::writeUniformRingData(const uint8_t *data,
+                                                size_t size,
+                                                wgpu::Buffer *bufferOut,
+                                                uint32_t *offsetOut)
+{
+    ASSERT(size % webgpu::kBufferCopyToBufferAlignment == 0);
+
+    const size_t alignment =
+        static_cast<size_t>(mDisplay->getLimitsWgpu().minUniformBufferOffsetAlignment);
+    size_t offset          = roundUp(mUniformRingOffset, alignment);
+    if (!mUniformRingBuffer || offset + size > mUniformRingBuffer.GetSize())
+    {
+        // The current ring may still be read by draws recorded since the last submission.
+        wgpu::BufferDescriptor desc;
+        desc.size          = std::max(kUniformRingSize, size);
+        desc.usage         = wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst;
+        mUniformRingBuffer = getDevice().CreateBuffer(&desc);
+        offset             = 0;
+    }
+
+    getQueue().WriteBuffer(mUniformRingBuffer, offset, data, size);
+    mUniformRingOffset = offset + size;
+
+    *bufferOut = mUniformRingBuffer;
+    *offsetOut = static_cast<uint32_t>(offset);
     return angle::Result::Continue;
 }
 
@@ -1276,9 +1314,13 @@ angle::Result ContextWgpu::handleDirtyBindGroups(DirtyBits::Iterator *dirtyBitsI
 {
     ProgramExecutableWgpu *executableWgpu = webgpu::GetImpl(mState.getProgramExecutable());
     wgpu::BindGroup bindGroup;
-    ANGLE_TRY(executableWgpu->updateUniformsAndGetBindGroup(this, &bindGroup));
+    uint32_t dynamicOffsets[webgpu::kMaxBindGroupDynamicOffsets];
+    uint32_t dynamicOffsetCount = 0;
+    ANGLE_TRY(executableWgpu->updateUniformsAndGetBindGroup(this, &bindGroup, dynamicOffsets,
+                                                            &dynamicOffsetCount));
     // TODO(anglebug.com/376553328): need to set up every bind group here.
-    mCommandBuffer.setBindGroup(sh::kDefaultUniformBlockBindGroup, bindGroup);
+    mCommandBuffer.setBindGroup(sh::kDefaultUniformBlockBindGroup, bindGroup, dynamicOffsetCount,
+                                dynamicOffsets);
 
     return angle::Result::Continue;
 }
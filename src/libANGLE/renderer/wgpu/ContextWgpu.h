@@ -19,6 +19,7 @@
 #include "libANGLE/renderer/wgpu/wgpu_format_utils.h"
 #include "libANGLE/renderer/wgpu/wgpu_helpers.h"
 #include "libANGLE/renderer/wgpu/wgpu_pipeline_state.h"
+#include "libANGLE/renderer/wgpu/wgpu_staging_belt.h"
 #include "libANGLE/renderer/wgpu/wgpu_utils.h"
 
 namespace rx
@@ -265,6 +266,14 @@ class ContextWgpu : public ContextImpl
     DisplayWgpu *getDisplay() { return mDisplay; }
     wgpu::Device &getDevice() { return mDisplay->getDevice(); }
     wgpu::Queue &getQueue() { return mDisplay->getQueue(); }
+
+    // Copies default uniform data into the uniform ring buffer, which programs bind with dynamic
+    // offsets.  The ring only wraps around at submission, so |bufferOut| changes when it fills up
+    // before that.
+    angle::Result writeUniformRingData(const uint8_t *data,
+                                       size_t size,
+                                       wgpu::Buffer *bufferOut,
+                                       uint32_t *offsetOut);
     wgpu::Instance &getInstance() { return mDisplay->getInstance(); }
     angle::ImageLoadContext &getImageLoadContext() { return mImageLoadContext; }
     const webgpu::Format &getFormat(GLenum internalFormat) const
@@ -292,6 +301,10 @@ class ContextWgpu : public ContextImpl
     void ensureCommandEncoderCreated();
     wgpu::CommandEncoder &getCurrentCommandEncoder();
 
+    // Uploads written into the staging belt must be copied by commands recorded in the current
+    // command encoder; see webgpu::StagingBelt.
+    webgpu::StagingBelt &getStagingBelt() { return mStagingBelt; }
+
   private:
     // Dirty bits.
     enum DirtyBitType : size_t
@@ -364,11 +377,17 @@ class ContextWgpu : public ContextImpl
 
     webgpu::CommandBuffer mCommandBuffer;
 
+    webgpu::StagingBelt mStagingBelt;
+
     webgpu::RenderPipelineDesc mRenderPipelineDesc;
     wgpu::RenderPipeline mCurrentGraphicsPipeline;
     gl::AttributesMask mCurrentRenderPipelineAllAttributes;
 
     gl::DrawElementsType mCurrentIndexBufferType = gl::DrawElementsType::InvalidEnum;
+
+    static constexpr size_t kUniformRingSize = 1024 * 1024;
+    wgpu::Buffer mUniformRingBuffer;
+    size_t mUniformRingOffset = 0;
 };
 
 }  // namespace rx
@@ -45,7 +45,11 @@ egl::Error DisplayWgpu::initialize(egl::Display *display)
     return egl::NoError();
 }
 
-void DisplayWgpu::terminate() {}
+void DisplayWgpu::terminate()
+{
+    std::lock_guard<std::mutex> lock(mShaderModuleCacheMutex);
+    mShaderModuleCache.clear();
+}
 
 egl::Error DisplayWgpu::makeCurrent(egl::Display *display,
                                     egl::Surface *drawSurface,
@@ -230,6 +234,19 @@ angle::NativeWindowSystem DisplayWgpu::getWindowSystem() const
 #endif
 }
 
+wgpu::ShaderModule DisplayWgpu::getCachedShaderModule(const std::string &source)
+{
+    std::lock_guard<std::mutex> lock(mShaderModuleCacheMutex);
+    auto iter = mShaderModuleCache.find(source);
+    return iter != mShaderModuleCache.end() ? iter->second : nullptr;
+}
+
+void DisplayWgpu::cacheShaderModule(const std::string &source, const wgpu::ShaderModule &module)
+{
+    std::lock_guard<std::mutex> lock(mShaderModuleCacheMutex);
+    mShaderModuleCache.emplace(source, module);
+}
+
 void DisplayWgpu::generateExtensions(egl::DisplayExtensions *outExtensions) const
 {
     *outExtensions = mEGLExtensions;
@@ -244,7 +261,11 @@ egl::Error DisplayWgpu::createWgpuDevice()
 {
     dawnProcSetProcs(&dawn::native::GetProcs());
 
+    // Let Dawn persist compiled pipelines in the blob cache.
+    mDawnPlatform = std::make_unique<webgpu::DawnPlatform>(getBlobCache());
+
     dawn::native::DawnInstanceDescriptor dawnInstanceDescriptor;
+    dawnInstanceDescriptor.platform = mDawnPlatform.get();
 
     wgpu::InstanceDescriptor instanceDescriptor;
     instanceDescriptor.features.timedWaitAnyEnable = true;
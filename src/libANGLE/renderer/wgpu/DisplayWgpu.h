@@ -13,8 +13,12 @@
 #include <dawn/native/DawnNative.h>
 #include <dawn/webgpu_cpp.h>
 
+#include <mutex>
+
+#include "common/hash_containers.h"
 #include "libANGLE/renderer/DisplayImpl.h"
 #include "libANGLE/renderer/ShareGroupImpl.h"
+#include "libANGLE/renderer/wgpu/wgpu_dawn_platform.h"
 #include "libANGLE/renderer/wgpu/wgpu_format_utils.h"
 
 namespace rx
@@ -107,6 +111,11 @@ class DisplayWgpu : public DisplayImpl
 
     std::map<EGLNativeWindowType, wgpu::Surface> &getSurfaceCache() { return mSurfaceCache; }
 
+    // Shader modules that compiled successfully, keyed by their final WGSL source. Called from
+    // the link subtasks, which may run in parallel.
+    wgpu::ShaderModule getCachedShaderModule(const std::string &source);
+    void cacheShaderModule(const std::string &source, const wgpu::ShaderModule &module);
+
     const webgpu::Format &getFormat(GLenum internalFormat) const
     {
         return mFormatTable[internalFormat];
@@ -118,6 +127,9 @@ class DisplayWgpu : public DisplayImpl
 
     egl::Error createWgpuDevice();
 
+    // Must outlive mInstance.
+    std::unique_ptr<webgpu::DawnPlatform> mDawnPlatform;
+
     wgpu::Adapter mAdapter;
     wgpu::Instance mInstance;
     wgpu::Device mDevice;
@@ -141,6 +153,11 @@ class DisplayWgpu : public DisplayImpl
     // wgpu::Surface created for each window for the lifetime of the display.
     std::map<EGLNativeWindowType, wgpu::Surface> mSurfaceCache;
 
+    // Programs relinked with the same shaders, or sharing a shader, produce the same WGSL. Caching
+    // the modules avoids having Dawn parse and validate it again.
+    std::mutex mShaderModuleCacheMutex;
+    angle::HashMap<std::string, wgpu::ShaderModule> mShaderModuleCache;
+
     webgpu::FormatTable mFormatTable;
 };
 
@@ -37,42 +37,41 @@ ProgramExecutableWgpu::~ProgramExecutableWgpu() = default;
 void ProgramExecutableWgpu::destroy(const gl::Context *context) {}
 
 angle::Result ProgramExecutableWgpu::updateUniformsAndGetBindGroup(ContextWgpu *contextWgpu,
-                                                                   wgpu::BindGroup *outBindGroup)
-{
-    if (mDefaultUniformBlocksDirty.any())
+                                                                   wgpu::BindGroup *outBindGroup,
+                                                                   uint32_t *outDynamicOffsets,
+                                                                   uint32_t *outDynamicOffsetCount)
+{
+    // The data is written again even if it isn't dirty, since the ring may have been reused
+    // since it was last written.  It is ordered by binding number like the dynamic offsets.
+    wgpu::Buffer ringBuffer;
+    *outDynamicOffsetCount = 0;
+    for (gl::ShaderType shaderType : {gl::ShaderType::Vertex, gl::ShaderType::Fragment})
     {
-        // TODO(anglebug.com/376553328): this creates an entire new buffer every time a single
-        // uniform changes, and the old ones are just garbage collected. This should be optimized.
-        webgpu::BufferHelper defaultUniformBuffer;
-
-        gl::ShaderMap<uint64_t> offsets =
-            {};  // offset in the GPU-side buffer of each shader stage's uniform data.
-        size_t requiredSpace;
-
-        angle::CheckedNumeric<size_t> requiredSpaceChecked =
-            calcUniformUpdateRequiredSpace(contextWgpu, &offsets);
-        if (!requiredSpaceChecked.AssignIfValid(&requiredSpace))
+        const angle::MemoryBuffer &uniformData = mDefaultUniformBlocks[shaderType]->uniformData;
+        if (uniformData.size() == 0)
         {
-            return angle::Result::Stop;
+            continue;
         }
 
-        ANGLE_TRY(defaultUniformBuffer.initBuffer(
-            contextWgpu->getDevice(), requiredSpace,
-            wgpu::BufferUsage::Uniform | wgpu::BufferUsage::CopyDst, webgpu::MapAtCreation::Yes));
-
-        ASSERT(defaultUniformBuffer.valid());
-
-        // Copy all of the CPU-side data into this buffer which will be visible to the GPU after it
-        // is unmapped here on the CPU.
-        uint8_t *bufferData = defaultUniformBuffer.getMapWritePointer(0, requiredSpace);
-        for (gl::ShaderType shaderType : mExecutable->getLinkedShaderStages())
+        wgpu::Buffer buffer;
+        uint32_t offset;
+        ANGLE_TRY(contextWgpu->writeUniformRingData(uniformData.data(), uniformData.size(),
+                                                    &buffer, &offset));
+        if (ringBuffer && ringBuffer.Get() != buffer.Get())
         {
-            const angle::MemoryBuffer &uniformData = mDefaultUniformBlocks[shaderType]->uniformData;
-            memcpy(&bufferData[offsets[shaderType]], uniformData.data(), uniformData.size());
-            mDefaultUniformBlocksDirty.reset(shaderType);
+            // The ring filled up in between the stages; write every stage to the new buffer.
+            return updateUniformsAndGetBindGroup(contextWgpu, outBindGroup, outDynamicOffsets,
+                                                 outDynamicOffsetCount);
         }
-        ANGLE_TRY(defaultUniformBuffer.unmap());
+        ringBuffer = buffer;
 
+        ASSERT(*outDynamicOffsetCount < webgpu::kMaxBindGroupDynamicOffsets);
+        outDynamicOffsets[(*outDynamicOffsetCount)++] = offset;
+    }
+    mDefaultUniformBlocksDirty.reset();
+
+    if (!mDefaultBindGroup || mDefaultBindGroupBuffer.Get() != ringBuffer.Get())
+    {
         // Create the BindGroupEntries
         std::vector<wgpu::BindGroupEntry> bindings;
         auto addBindingToGroupIfNecessary = [&](uint32_t bindingIndex, gl::ShaderType shaderType) {
@@ -80,15 +79,15 @@ angle::Result ProgramExecutableWgpu::updateUniformsAndGetBindGroup(ContextWgpu *
             {
                 wgpu::BindGroupEntry bindGroupEntry;
                 bindGroupEntry.binding = bindingIndex;
-                bindGroupEntry.buffer  = defaultUniformBuffer.getBuffer();
-                bindGroupEntry.offset  = offsets[shaderType];
+                bindGroupEntry.buffer  = ringBuffer;
+                bindGroupEntry.offset  = 0;
                 bindGroupEntry.size    = mDefaultUniformBlocks[shaderType]->uniformData.size();
                 bindings.push_back(bindGroupEntry);
             }
         };
 
         // Add the BindGroupEntry for the default blocks of both the vertex and fragment shaders.
-        // They will use the same buffer with a different offset.
+        // They will use the same buffer with a different dynamic offset.
         addBindingToGroupIfNecessary(sh::kDefaultVertexUniformBlockBinding, gl::ShaderType::Vertex);
         addBindingToGroupIfNecessary(sh::kDefaultFragmentUniformBlockBinding,
                                      gl::ShaderType::Fragment);
@@ -100,6 +99,7 @@ angle::Result ProgramExecutableWgpu::updateUniformsAndGetBindGroup(ContextWgpu *
         bindGroupDesc.entryCount = bindings.size();
         bindGroupDesc.entries    = bindings.data();
         mDefaultBindGroup        = contextWgpu->getDevice().CreateBindGroup(&bindGroupDesc);
+        mDefaultBindGroupBuffer  = ringBuffer;
     }
 
     ASSERT(mDefaultBindGroup);
@@ -108,32 +108,6 @@ angle::Result ProgramExecutableWgpu::updateUniformsAndGetBindGroup(ContextWgpu *
     return angle::Result::Continue;
 }
 
-angle::CheckedNumeric<size_t> ProgramExecutableWgpu::getDefaultUniformAlignedSize(
-    ContextWgpu *context,
-    gl::ShaderType shaderType) const
-{
-    size_t alignment = angle::base::checked_cast<size_t>(
-        context->getDisplay()->getLimitsWgpu().minUniformBufferOffsetAlignment);
-    return CheckedRoundUp(mDefaultUniformBlocks[shaderType]->uniformData.size(), alignment);
-}
-
-angle::CheckedNumeric<size_t> ProgramExecutableWgpu::calcUniformUpdateRequiredSpace(
-    ContextWgpu *context,
-    gl::ShaderMap<uint64_t> *uniformOffsets) const
-{
-    angle::CheckedNumeric<size_t> requiredSpace = 0;
-    for (gl::ShaderType shaderType : mExecutable->getLinkedShaderStages())
-    {
-        (*uniformOffsets)[shaderType] = requiredSpace.ValueOrDie();
-        requiredSpace += getDefaultUniformAlignedSize(context, shaderType);
-        if (!requiredSpace.IsValid())
-        {
-            break;
-        }
-    }
-    return requiredSpace;
-}
-
 angle::Result ProgramExecutableWgpu::resizeUniformBlockMemory(
     const gl::ShaderMap<size_t> &requiredBufferSize)
 {
@@ -383,6 +357,8 @@ void ProgramExecutableWgpu::genBindingLayoutIfNecessary(ContextWgpu *context)
             bindGroupLayoutEntry.visibility  = wgpuVisibility;
             bindGroupLayoutEntry.binding     = bindingIndex;
             bindGroupLayoutEntry.buffer.type = wgpu::BufferBindingType::Uniform;
+            // The data lives in the context's uniform ring at a different offset every time.
+            bindGroupLayoutEntry.buffer.hasDynamicOffset = true;
             // By setting a `minBindingSize`, some validation is pushed from every draw call to
             // pipeline creation time.
             bindGroupLayoutEntry.buffer.minBindingSize =
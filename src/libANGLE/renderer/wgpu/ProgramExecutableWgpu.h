@@ -31,8 +31,12 @@ class ProgramExecutableWgpu : public ProgramExecutableImpl
 
     void destroy(const gl::Context *context) override;
 
+    // Writes the default uniforms into the context's uniform ring.  |outDynamicOffsets| holds
+    // at least webgpu::kMaxBindGroupDynamicOffsets elements.
     angle::Result updateUniformsAndGetBindGroup(ContextWgpu *context,
-                                                wgpu::BindGroup *outBindGroup);
+                                                wgpu::BindGroup *outBindGroup,
+                                                uint32_t *outDynamicOffsets,
+                                                uint32_t *outDynamicOffsetCount);
 
     angle::Result resizeUniformBlockMemory(const gl::ShaderMap<size_t> &requiredBufferSize);
 
@@ -104,11 +108,6 @@ class ProgramExecutableWgpu : public ProgramExecutableImpl
                                     wgpu::RenderPipeline *pipelineOut);
 
   private:
-    angle::CheckedNumeric<size_t> getDefaultUniformAlignedSize(ContextWgpu *context,
-                                                               gl::ShaderType shaderType) const;
-    angle::CheckedNumeric<size_t> calcUniformUpdateRequiredSpace(
-        ContextWgpu *context,
-        gl::ShaderMap<uint64_t> *uniformOffsets) const;
     // The layout of the resource bind groups (numbering for buffers, textures, samplers) can be
     // determined once the program is linked, and should be passed in pipeline creation. Fills in
     // `mPipelineLayout` and `mDefaultBindGroupLayout` if they haven't been already.
@@ -121,8 +120,10 @@ class ProgramExecutableWgpu : public ProgramExecutableImpl
     wgpu::PipelineLayout mPipelineLayout;
     // Holds the binding group layout for the default bind group.
     wgpu::BindGroupLayout mDefaultBindGroupLayout;
-    // Holds the most recent BindGroup. Note there may be others in the command buffer.
+    // The default uniforms are bound with dynamic offsets, so the bind group only changes with
+    // the uniform ring buffer it was created for.
     wgpu::BindGroup mDefaultBindGroup;
+    wgpu::Buffer mDefaultBindGroupBuffer;
 
     // Holds layout info for basic GL uniforms, which needs to be laid out in a buffer for WGSL
     // similarly to a UBO.
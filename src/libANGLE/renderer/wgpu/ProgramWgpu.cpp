@@ -16,6 +16,7 @@
 #include "common/log_utils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/ProgramExecutable.h"
+#include "libANGLE/renderer/wgpu/DisplayWgpu.h"
 #include "libANGLE/renderer/wgpu/ProgramExecutableWgpu.h"
 #include "libANGLE/renderer/wgpu/wgpu_utils.h"
 #include "libANGLE/renderer/wgpu/wgpu_wgsl_util.h"
@@ -69,13 +70,15 @@ void InitDefaultUniformBlock(const std::vector<sh::ShaderVariable> &uniforms,
 class CreateWGPUShaderModuleTask : public LinkSubTask
 {
   public:
-    CreateWGPUShaderModuleTask(wgpu::Instance instance,
+    CreateWGPUShaderModuleTask(DisplayWgpu *display,
+                               wgpu::Instance instance,
                                wgpu::Device device,
                                const gl::SharedCompiledShaderState &compiledShaderState,
                                const gl::ProgramExecutable &executable,
                                gl::ProgramMergedVaryings mergedVaryings,
                                TranslatedWGPUShaderModule &resultShaderModule)
-        : mInstance(instance),
+        : mDisplay(display),
+          mInstance(instance),
           mDevice(device),
           mCompiledShaderState(compiledShaderState),
           mExecutable(executable),
@@ -120,6 +123,12 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
             std::cout << finalShaderSource;
         }
 
+        mShaderModule.module = mDisplay->getCachedShaderModule(finalShaderSource);
+        if (mShaderModule.module)
+        {
+            return;
+        }
+
         wgpu::ShaderModuleWGSLDescriptor shaderModuleWGSLDescriptor;
         shaderModuleWGSLDescriptor.code = finalShaderSource.c_str();
 
@@ -172,9 +181,15 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
         {
             mResult = angle::Result::Stop;
         }
+
+        if (mResult == angle::Result::Continue)
+        {
+            mDisplay->cacheShaderModule(finalShaderSource, mShaderModule.module);
+        }
     }
 
   private:
+    DisplayWgpu *mDisplay;
     wgpu::Instance mInstance;
     wgpu::Device mDevice;
     gl::SharedCompiledShaderState mCompiledShaderState;
@@ -190,8 +205,12 @@ class CreateWGPUShaderModuleTask : public LinkSubTask
 class LinkTaskWgpu : public LinkTask
 {
   public:
-    LinkTaskWgpu(wgpu::Instance instance, wgpu::Device device, ProgramWgpu *program)
-        : mInstance(instance),
+    LinkTaskWgpu(DisplayWgpu *display,
+                 wgpu::Instance instance,
+                 wgpu::Device device,
+                 ProgramWgpu *program)
+        : mDisplay(display),
+          mInstance(instance),
           mDevice(device),
           mProgram(program),
           mExecutable(&mProgram->getState().getExecutable())
@@ -216,7 +235,7 @@ class LinkTaskWgpu : public LinkTask
             if (shaders[shaderType])
             {
                 auto task = std::make_shared<CreateWGPUShaderModuleTask>(
-                    mInstance, mDevice, shaders[shaderType], *executable->getExecutable(),
+                    mDisplay, mInstance, mDevice, shaders[shaderType], *executable->getExecutable(),
                     mergedVaryings, executable->getShaderModule(shaderType));
                 linkSubTasksOut->push_back(task);
             }
@@ -326,6 +345,7 @@ class LinkTaskWgpu : public LinkTask
         }
     }
 
+    DisplayWgpu *mDisplay;
     wgpu::Instance mInstance;
     wgpu::Device mDevice;
     ProgramWgpu *mProgram = nullptr;
@@ -356,10 +376,11 @@ void ProgramWgpu::setSeparable(bool separable) {}
 
 angle::Result ProgramWgpu::link(const gl::Context *context, std::shared_ptr<LinkTask> *linkTaskOut)
 {
+    DisplayWgpu *display    = webgpu::GetDisplay(context);
     wgpu::Device device     = webgpu::GetDevice(context);
     wgpu::Instance instance = webgpu::GetInstance(context);
 
-    *linkTaskOut = std::shared_ptr<LinkTask>(new LinkTaskWgpu(instance, device, this));
+    *linkTaskOut = std::shared_ptr<LinkTask>(new LinkTaskWgpu(display, instance, device, this));
     return angle::Result::Continue;
 }
 
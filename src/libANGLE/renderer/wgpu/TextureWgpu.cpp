@@ -415,6 +415,18 @@ angle::Result TextureWgpu::setSubImageImpl(const gl::Context *context,
     uint32_t outputDepthPitch         = outputRowPitch * glExtents.height;
     uint32_t allocationSize           = outputDepthPitch * glExtents.depth;
 
+    // Levels that don't need to be respecified can be written right away, which goes through
+    // the staging belt rather than a new buffer per upload.
+    gl::LevelIndex levelGL(index.getLevelIndex());
+    if (mImage->canUploadDirectly(levelGL) &&
+        !IsTextureLevelRedefined(mRedefinedLevels, mState.getType(), levelGL))
+    {
+        return mImage->uploadTextureThroughStagingBelt(
+            contextWgpu, webgpuFormat, type, glExtents, gl::Offset(area.x, area.y, area.z),
+            inputRowPitch, inputDepthPitch, outputRowPitch, outputDepthPitch, allocationSize, index,
+            pixels);
+    }
+
     ANGLE_TRY(mImage->stageTextureUpload(contextWgpu, webgpuFormat, type, glExtents, inputRowPitch,
                                          inputDepthPitch, outputRowPitch, outputDepthPitch,
                                          allocationSize, index, pixels));
@@ -66,11 +66,21 @@ void CommandBuffer::drawIndexed(uint32_t indexCount,
     drawIndexedCommand->firstInstance      = firstInstance;
 }
 
-void CommandBuffer::setBindGroup(uint32_t groupIndex, wgpu::BindGroup bindGroup)
+void CommandBuffer::setBindGroup(uint32_t groupIndex,
+                                 wgpu::BindGroup bindGroup,
+                                 uint32_t dynamicOffsetCount,
+                                 const uint32_t *dynamicOffsets)
 {
+    ASSERT(dynamicOffsetCount <= kMaxBindGroupDynamicOffsets);
+
     SetBindGroupCommand *setBindGroupCommand = initCommand<CommandID::SetBindGroup>();
     setBindGroupCommand->groupIndex          = groupIndex;
+    setBindGroupCommand->dynamicOffsetCount  = dynamicOffsetCount;
     setBindGroupCommand->bindGroup = GetReferencedObject(mReferencedBindGroups, bindGroup);
+    for (uint32_t i = 0; i < dynamicOffsetCount; ++i)
+    {
+        setBindGroupCommand->dynamicOffsets[i] = dynamicOffsets[i];
+    }
 }
 
 void CommandBuffer::setPipeline(wgpu::RenderPipeline pipeline)
@@ -194,7 +204,9 @@ void CommandBuffer::recordCommands(wgpu::RenderPassEncoder encoder)
                     const SetBindGroupCommand &setBindGroupCommand =
                         GetCommandAndIterate<CommandID::SetBindGroup>(&currentCommand);
                     encoder.SetBindGroup(setBindGroupCommand.groupIndex,
-                                         *setBindGroupCommand.bindGroup);
+                                         *setBindGroupCommand.bindGroup,
+                                         setBindGroupCommand.dynamicOffsetCount,
+                                         setBindGroupCommand.dynamicOffsets);
                     break;
                 }
 
@@ -120,15 +120,19 @@ struct PushDebugGroupCommand
     uint64_t pad;
 };
 
+// The default uniform bind group has one dynamic offset per shader stage.
+constexpr uint32_t kMaxBindGroupDynamicOffsets = 2;
+
 struct SetBindGroupCommand
 {
     uint32_t groupIndex;
-    uint32_t pad0;
+    uint32_t dynamicOffsetCount;
     union
     {
         const wgpu::BindGroup *bindGroup;
         uint64_t pad1;  // Pad to 64 bits on 32-bit systems
     };
+    uint32_t dynamicOffsets[kMaxBindGroupDynamicOffsets];
 };
 
 struct SetBlendConstantCommand
@@ -237,7 +241,10 @@ class CommandBuffer
                      uint32_t firstIndex,
                      int32_t baseVertex,
                      uint32_t firstInstance);
-    void setBindGroup(uint32_t groupIndex, wgpu::BindGroup bindGroup);
+    void setBindGroup(uint32_t groupIndex,
+                      wgpu::BindGroup bindGroup,
+                      uint32_t dynamicOffsetCount = 0,
+                      const uint32_t *dynamicOffsets = nullptr);
     void setPipeline(wgpu::RenderPipeline pipeline);
     void setScissorRect(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
     void setViewport(float x, float y, float width, float height, float minDepth, float maxDepth);
@@ -0,0 +1,95 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// wgpu_dawn_platform.cpp:
+//    Implements the class methods for DawnPlatform.
+//
+
+#include "libANGLE/renderer/wgpu/wgpu_dawn_platform.h"
+
+#include <cstring>
+
+#include "common/MemoryBuffer.h"
+#include "common/base/anglebase/sha1.h"
+#include "libANGLE/BlobCache.h"
+
+namespace rx
+{
+namespace webgpu
+{
+namespace
+{
+// Dawn keys are arbitrarily long; the blob cache wants fixed size keys.  Prefix them so they
+// can't collide with the program cache's keys.
+egl::BlobCache::Key HashDawnKey(const void *key, size_t keySize)
+{
+    static constexpr char kDawnKeyPrefix[] = "Dawn";
+
+    angle::base::SecureHashAlgorithm sha1;
+    sha1.Update(kDawnKeyPrefix, sizeof(kDawnKeyPrefix));
+    sha1.Update(key, keySize);
+    sha1.Final();
+    return sha1.DigestAsArray();
+}
+}  // anonymous namespace
+
+DawnPlatform::DawnPlatform(egl::BlobCache *blobCache) : mCachingInterface(blobCache) {}
+
+DawnPlatform::~DawnPlatform() = default;
+
+dawn::platform::CachingInterface *DawnPlatform::GetCachingInterface()
+{
+    return &mCachingInterface;
+}
+
+DawnPlatform::CachingInterface::CachingInterface(egl::BlobCache *blobCache)
+    : mBlobCache(blobCache)
+{}
+
+DawnPlatform::CachingInterface::~CachingInterface() = default;
+
+size_t DawnPlatform::CachingInterface::LoadData(const void *key,
+                                                size_t keySize,
+                                                void *value,
+                                                size_t valueSize)
+{
+    angle::ScratchBuffer scratchBuffer;
+    egl::BlobCache::Value cachedValue;
+    if (!mBlobCache->get(nullptr, &scratchBuffer, HashDawnKey(key, keySize), &cachedValue))
+    {
+        return 0;
+    }
+
+    // Dawn first queries the size with a null |value|, then loads into a buffer of that size.
+    if (value == nullptr)
+    {
+        return cachedValue.size();
+    }
+    if (valueSize < cachedValue.size())
+    {
+        return 0;
+    }
+
+    memcpy(value, cachedValue.data(), cachedValue.size());
+    return cachedValue.size();
+}
+
+void DawnPlatform::CachingInterface::StoreData(const void *key,
+                                               size_t keySize,
+                                               const void *value,
+                                               size_t valueSize)
+{
+    angle::MemoryBuffer buffer;
+    if (valueSize == 0 || !buffer.resize(valueSize))
+    {
+        return;
+    }
+    memcpy(buffer.data(), value, valueSize);
+
+    mBlobCache->put(nullptr, HashDawnKey(key, keySize), std::move(buffer));
+}
+
+}  // namespace webgpu
+}  // namespace rx
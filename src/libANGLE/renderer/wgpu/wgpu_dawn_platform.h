@@ -0,0 +1,62 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// wgpu_dawn_platform.h:
+//    Defines the Dawn platform used by the WebGPU back-end, which backs Dawn's persistent cache
+//    with the display's blob cache.
+//
+
+#ifndef LIBANGLE_RENDERER_WGPU_WGPU_DAWN_PLATFORM_H_
+#define LIBANGLE_RENDERER_WGPU_WGPU_DAWN_PLATFORM_H_
+
+#include <dawn/platform/DawnPlatform.h>
+
+#include "common/angleutils.h"
+
+namespace egl
+{
+class BlobCache;
+}  // namespace egl
+
+namespace rx
+{
+namespace webgpu
+{
+
+// Dawn stores compiled pipelines (and the backend pipeline caches it derives from them) through
+// the caching interface, so pipelines created on a previous run are not compiled again.  Dawn may
+// call the interface from its own threads; egl::BlobCache is thread safe.
+class DawnPlatform final : public dawn::platform::Platform, angle::NonCopyable
+{
+  public:
+    explicit DawnPlatform(egl::BlobCache *blobCache);
+    ~DawnPlatform() override;
+
+    dawn::platform::CachingInterface *GetCachingInterface() override;
+
+  private:
+    class CachingInterface final : public dawn::platform::CachingInterface
+    {
+      public:
+        explicit CachingInterface(egl::BlobCache *blobCache);
+        ~CachingInterface() override;
+
+        size_t LoadData(const void *key, size_t keySize, void *value, size_t valueSize) override;
+        void StoreData(const void *key,
+                       size_t keySize,
+                       const void *value,
+                       size_t valueSize) override;
+
+      private:
+        egl::BlobCache *mBlobCache;
+    };
+
+    CachingInterface mCachingInterface;
+};
+
+}  // namespace webgpu
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_WGPU_WGPU_DAWN_PLATFORM_H_
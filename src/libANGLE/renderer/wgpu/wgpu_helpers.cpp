@@ -5,6 +5,9 @@
 //
 
 #include "libANGLE/renderer/wgpu/wgpu_helpers.h"
+
+#include <numeric>
+
 #include "libANGLE/formatutils.h"
 
 #include "libANGLE/renderer/wgpu/ContextWgpu.h"
@@ -118,9 +121,18 @@ angle::Result ImageHelper::flushSingleLevelUpdates(ContextWgpu *contextWgpu,
     {
         return angle::Result::Continue;
     }
-    wgpu::Device device          = contextWgpu->getDevice();
-    wgpu::Queue queue            = contextWgpu->getQueue();
-    wgpu::CommandEncoder encoder = device.CreateCommandEncoder();
+    // Texture uploads are copied in the context's command encoder, which may also be copying
+    // their data out of the staging belt.
+    bool hasTextureUpdates = std::any_of(
+        currentLevelQueue->begin(), currentLevelQueue->end(), [](const SubresourceUpdate &update) {
+            return update.updateSource == UpdateSource::Texture;
+        });
+    if (hasTextureUpdates)
+    {
+        ANGLE_TRY(contextWgpu->endRenderPass(RenderPassClosureReason::TextureUpload));
+        contextWgpu->ensureCommandEncoderCreated();
+    }
+    wgpu::CommandEncoder &encoder = contextWgpu->getCurrentCommandEncoder();
     wgpu::ImageCopyTexture dst;
     dst.texture = mTexture;
     std::vector<wgpu::RenderPassColorAttachment> colorAttachments;
@@ -190,9 +202,6 @@ angle::Result ImageHelper::flushSingleLevelUpdates(ContextWgpu *contextWgpu,
         frameBuffer->updateDepthStencilAttachment(CreateNewDepthStencilAttachment(
             depthValue, stencilValue, textureView, updateDepth, updateStencil));
     }
-    wgpu::CommandBuffer commandBuffer = encoder.Finish();
-    queue.Submit(1, &commandBuffer);
-    encoder = nullptr;
     currentLevelQueue->clear();
 
     return angle::Result::Continue;
@@ -256,6 +265,73 @@ angle::Result ImageHelper::stageTextureUpload(ContextWgpu *contextWgpu,
     return angle::Result::Continue;
 }
 
+bool ImageHelper::canUploadDirectly(gl::LevelIndex level)
+{
+    if (!mInitialized || !isTextureLevelInAllocatedImage(level))
+    {
+        return false;
+    }
+    std::vector<SubresourceUpdate> *levelUpdates = getLevelUpdates(level);
+    return !levelUpdates || levelUpdates->empty();
+}
+
+angle::Result ImageHelper::uploadTextureThroughStagingBelt(ContextWgpu *contextWgpu,
+                                                           const webgpu::Format &webgpuFormat,
+                                                           GLenum type,
+                                                           const gl::Extents &glExtents,
+                                                           const gl::Offset &origin,
+                                                           GLuint inputRowPitch,
+                                                           GLuint inputDepthPitch,
+                                                           uint32_t outputRowPitch,
+                                                           uint32_t outputDepthPitch,
+                                                           uint32_t allocationSize,
+                                                           const gl::ImageIndex &index,
+                                                           const uint8_t *pixels)
+{
+    if (pixels == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+    ASSERT(canUploadDirectly(gl::LevelIndex(index.getLevelIndex())));
+
+    // The buffer offset of a copy must be a multiple of both the texel size and 4 bytes.
+    const angle::Format &actualFormat = webgpuFormat.getActualImageFormat();
+    const size_t alignment =
+        std::lcm(static_cast<size_t>(actualFormat.pixelBytes), kBufferCopyToBufferAlignment);
+
+    StagingAllocation staging;
+    ANGLE_TRY(
+        contextWgpu->getStagingBelt().allocate(contextWgpu, allocationSize, alignment, &staging));
+
+    LoadImageFunctionInfo loadFunctionInfo = webgpuFormat.getTextureLoadFunction(type);
+    loadFunctionInfo.loadFunction(contextWgpu->getImageLoadContext(), glExtents.width,
+                                  glExtents.height, glExtents.depth, pixels, inputRowPitch,
+                                  inputDepthPitch, staging.data, outputRowPitch, outputDepthPitch);
+
+    wgpu::ImageCopyBuffer src;
+    src.buffer              = staging.buffer;
+    src.layout.offset       = staging.offset;
+    src.layout.bytesPerRow  = outputRowPitch;
+    src.layout.rowsPerImage = glExtents.height;
+
+    // Cube map faces are addressed as array layers.
+    wgpu::ImageCopyTexture dst;
+    dst.texture  = mTexture;
+    dst.mipLevel = toWgpuLevel(gl::LevelIndex(index.getLevelIndex())).get();
+    dst.origin   = {static_cast<uint32_t>(origin.x), static_cast<uint32_t>(origin.y),
+                    static_cast<uint32_t>(index.hasLayer() ? index.getLayerIndex() : origin.z)};
+
+    wgpu::Extent3D copySize = {static_cast<uint32_t>(glExtents.width),
+                               static_cast<uint32_t>(glExtents.height),
+                               static_cast<uint32_t>(glExtents.depth)};
+
+    ANGLE_TRY(contextWgpu->endRenderPass(RenderPassClosureReason::TextureUpload));
+    contextWgpu->ensureCommandEncoderCreated();
+    contextWgpu->getCurrentCommandEncoder().CopyBufferToTexture(&src, &dst, &copySize);
+
+    return angle::Result::Continue;
+}
+
 void ImageHelper::stageClear(gl::LevelIndex targetLevel,
                              ClearValues clearValues,
                              bool hasDepth,
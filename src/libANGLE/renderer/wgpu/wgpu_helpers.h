@@ -118,6 +118,23 @@ class ImageHelper
                                      const gl::ImageIndex &index,
                                      const uint8_t *pixels);
 
+    // Whether an upload to |level| can be copied into the texture right away instead of being
+    // staged, i.e. the level is allocated and has no staged updates that must happen before it.
+    bool canUploadDirectly(gl::LevelIndex level);
+    // Loads |pixels| into the context's staging belt and records the copy into the texture.
+    angle::Result uploadTextureThroughStagingBelt(ContextWgpu *contextWgpu,
+                                                  const webgpu::Format &webgpuFormat,
+                                                  GLenum type,
+                                                  const gl::Extents &glExtents,
+                                                  const gl::Offset &origin,
+                                                  GLuint inputRowPitch,
+                                                  GLuint inputDepthPitch,
+                                                  uint32_t outputRowPitch,
+                                                  uint32_t outputDepthPitch,
+                                                  uint32_t allocationSize,
+                                                  const gl::ImageIndex &index,
+                                                  const uint8_t *pixels);
+
     void stageClear(gl::LevelIndex targetLevel,
                     ClearValues clearValues,
                     bool hasDepth,
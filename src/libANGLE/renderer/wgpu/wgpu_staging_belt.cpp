@@ -0,0 +1,157 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// wgpu_staging_belt.cpp:
+//    Implements the StagingBelt class.
+//
+
+#include "libANGLE/renderer/wgpu/wgpu_staging_belt.h"
+
+#include <algorithm>
+
+#include "common/mathutil.h"
+#include "libANGLE/renderer/wgpu/ContextWgpu.h"
+#include "libANGLE/renderer/wgpu/wgpu_utils.h"
+
+namespace rx
+{
+namespace webgpu
+{
+
+StagingBelt::StagingBelt() = default;
+
+StagingBelt::~StagingBelt() = default;
+
+void StagingBelt::destroy()
+{
+    mCurrentChunk = {};
+    mFilledChunks.clear();
+    mSubmittingChunks.clear();
+    mMappingChunks.clear();
+    mFreeChunks.clear();
+}
+
+angle::Result StagingBelt::allocate(ContextWgpu *context,
+                                    size_t size,
+                                    size_t alignment,
+                                    StagingAllocation *allocationOut)
+{
+    ASSERT(alignment > 0);
+
+    size_t offset = roundUp(mCurrentChunk.used, alignment);
+    if (!mCurrentChunk.buffer || offset + size > mCurrentChunk.size)
+    {
+        if (mCurrentChunk.buffer)
+        {
+            mFilledChunks.push_back(std::move(mCurrentChunk));
+            mCurrentChunk = {};
+        }
+
+        collectMappedChunks(context->getInstance());
+
+        auto iter = std::find_if(mFreeChunks.begin(), mFreeChunks.end(),
+                                 [size](const Chunk &chunk) { return chunk.size >= size; });
+        if (iter != mFreeChunks.end())
+        {
+            mCurrentChunk = std::move(*iter);
+            mFreeChunks.erase(iter);
+        }
+        else
+        {
+            wgpu::BufferDescriptor desc;
+            desc.size             = roundUp(std::max(kChunkSize, size), kBufferSizeAlignment);
+            desc.usage            = wgpu::BufferUsage::MapWrite | wgpu::BufferUsage::CopySrc;
+            desc.mappedAtCreation = true;
+
+            mCurrentChunk.buffer = context->getDevice().CreateBuffer(&desc);
+            mCurrentChunk.size   = static_cast<size_t>(desc.size);
+            mCurrentChunk.data =
+                static_cast<uint8_t *>(mCurrentChunk.buffer.GetMappedRange(0, desc.size));
+        }
+
+        mCurrentChunk.used = 0;
+        offset             = 0;
+    }
+
+    ANGLE_CHECK(context, mCurrentChunk.data != nullptr, "Failed to map a staging buffer.",
+                GL_OUT_OF_MEMORY);
+
+    allocationOut->buffer = mCurrentChunk.buffer;
+    allocationOut->offset = offset;
+    allocationOut->data   = mCurrentChunk.data + offset;
+    mCurrentChunk.used    = offset + size;
+
+    return angle::Result::Continue;
+}
+
+void StagingBelt::prepareForSubmit()
+{
+    if (mCurrentChunk.buffer)
+    {
+        mFilledChunks.push_back(std::move(mCurrentChunk));
+        mCurrentChunk = {};
+    }
+
+    for (Chunk &chunk : mFilledChunks)
+    {
+        chunk.buffer.Unmap();
+        chunk.data = nullptr;
+        mSubmittingChunks.push_back(std::move(chunk));
+    }
+    mFilledChunks.clear();
+}
+
+void StagingBelt::onSubmit()
+{
+    wgpu::BufferMapCallbackInfo callbackInfo;
+    callbackInfo.mode = wgpu::CallbackMode::AllowProcessEvents;
+    // Chunks are collected by polling their map state, so there is nothing to do here.
+    callbackInfo.callback = [](WGPUBufferMapAsyncStatus status, void *userdata) {};
+
+    for (Chunk &chunk : mSubmittingChunks)
+    {
+        // Chunks made for a single large upload are not worth keeping around.
+        if (chunk.size > kChunkSize)
+        {
+            continue;
+        }
+
+        chunk.buffer.MapAsync(wgpu::MapMode::Write, 0, chunk.size, callbackInfo);
+        mMappingChunks.push_back(std::move(chunk));
+    }
+    mSubmittingChunks.clear();
+}
+
+void StagingBelt::collectMappedChunks(wgpu::Instance &instance)
+{
+    if (mMappingChunks.empty())
+    {
+        return;
+    }
+
+    instance.ProcessEvents();
+
+    auto iter = mMappingChunks.begin();
+    while (iter != mMappingChunks.end())
+    {
+        const wgpu::BufferMapState mapState = iter->buffer.GetMapState();
+        if (mapState == wgpu::BufferMapState::Pending)
+        {
+            ++iter;
+            continue;
+        }
+
+        // A chunk that failed to map is simply dropped.
+        if (mapState == wgpu::BufferMapState::Mapped && mFreeChunks.size() < kMaxFreeChunks)
+        {
+            iter->data = static_cast<uint8_t *>(iter->buffer.GetMappedRange(0, iter->size));
+            mFreeChunks.push_back(std::move(*iter));
+        }
+        iter = mMappingChunks.erase(iter);
+    }
+}
+
+}  // namespace webgpu
+}  // namespace rx
@@ -0,0 +1,90 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// wgpu_staging_belt.h:
+//    Defines the StagingBelt class, which sub-allocates upload memory from persistently mapped
+//    buffers.
+//
+
+#ifndef LIBANGLE_RENDERER_WGPU_WGPU_STAGING_BELT_H_
+#define LIBANGLE_RENDERER_WGPU_WGPU_STAGING_BELT_H_
+
+#include <dawn/webgpu_cpp.h>
+#include <stdint.h>
+#include <vector>
+
+#include "common/angleutils.h"
+#include "libANGLE/Error.h"
+
+namespace rx
+{
+
+class ContextWgpu;
+
+namespace webgpu
+{
+
+struct StagingAllocation
+{
+    wgpu::Buffer buffer;
+    uint64_t offset = 0;
+    uint8_t *data   = nullptr;
+};
+
+// Uploads are written into large mapped chunks and copied to their destination by commands
+// recorded in the context's command encoder, instead of mapping a new buffer or making a queue
+// write per upload.  Chunks are unmapped before the encoder is submitted and mapped back with
+// MapAsync after that.  Once mapped again, they are recycled for later uploads.
+class StagingBelt final : angle::NonCopyable
+{
+  public:
+    StagingBelt();
+    ~StagingBelt();
+
+    void destroy();
+
+    // The allocation stays valid until the next submission, and must only be read by commands
+    // recorded before it.
+    angle::Result allocate(ContextWgpu *context,
+                           size_t size,
+                           size_t alignment,
+                           StagingAllocation *allocationOut);
+
+    // Must be called before submitting commands that read from allocations.
+    void prepareForSubmit();
+    // Starts mapping back the chunks that were just submitted.
+    void onSubmit();
+
+  private:
+    struct Chunk
+    {
+        wgpu::Buffer buffer;
+        size_t size   = 0;
+        size_t used   = 0;
+        uint8_t *data = nullptr;
+    };
+
+    void collectMappedChunks(wgpu::Instance &instance);
+
+    static constexpr size_t kChunkSize = 1024 * 1024;
+    // Recycled chunks beyond this many are dropped.
+    static constexpr size_t kMaxFreeChunks = 4;
+
+    // The chunk being written to and the chunks that filled up before the next submission, all
+    // mapped.
+    Chunk mCurrentChunk;
+    std::vector<Chunk> mFilledChunks;
+    // Unmapped and waiting to be submitted.
+    std::vector<Chunk> mSubmittingChunks;
+    // MapAsync was called on these after submission.
+    std::vector<Chunk> mMappingChunks;
+    // Mapped and ready for reuse.
+    std::vector<Chunk> mFreeChunks;
+};
+
+}  // namespace webgpu
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_WGPU_WGPU_STAGING_BELT_H_
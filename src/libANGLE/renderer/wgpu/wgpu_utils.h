@@ -155,6 +155,8 @@ enum class RenderPassClosureReason
     GLReadPixels,
     IndexRangeReadback,
     VertexArrayStreaming,
+    BufferUpload,
+    TextureUpload,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -11,19 +11,54 @@
 
 #include <platform/PlatformMethods.h>
 #include "common/base/anglebase/trace_event/trace_event.h"
+#include "common/track_event.h"
 
+#if defined(ANGLE_ENABLE_TRACK_EVENT_TRACING)
+// Event names must be string literals, except with the COPY variants.  Arguments are not recorded.
+#    define ANGLE_TRACE_EVENT_BEGIN(CATEGORY, EVENT, ...) ANGLE_TRACK_EVENT_BEGIN(CATEGORY, EVENT)
+#    define ANGLE_TRACE_EVENT_END(CATEGORY, EVENT, ...) ANGLE_TRACK_EVENT_END(CATEGORY)
+#    define ANGLE_TRACE_EVENT_INSTANT(CATEGORY, EVENT, ...) \
+        ANGLE_TRACK_EVENT_INSTANT(CATEGORY, EVENT)
+#    define ANGLE_TRACE_EVENT(CATEGORY, EVENT, ...) ANGLE_TRACK_EVENT(CATEGORY, EVENT)
+
+#    define ANGLE_TRACE_EVENT_COPY_BEGIN(CATEGORY, EVENT) \
+        ANGLE_TRACK_EVENT_COPY_BEGIN(CATEGORY, EVENT)
+#    define ANGLE_TRACE_EVENT_COPY_END(CATEGORY, EVENT) ANGLE_TRACK_EVENT_END(CATEGORY)
+#    define ANGLE_TRACE_EVENT_COPY_INSTANT(CATEGORY, EVENT) \
+        ANGLE_TRACK_EVENT_COPY_INSTANT(CATEGORY, EVENT)
+
+#    define ANGLE_TRACE_COUNTER(CATEGORY, NAME, VALUE) \
+        ANGLE_TRACK_EVENT_COUNTER(CATEGORY, NAME, VALUE)
+#    define ANGLE_TRACE_COUNTERS_ENABLED(CATEGORY) ANGLE_TRACK_EVENT_ENABLED(CATEGORY)
+#else
 // TODO: Pass platform directly to these methods. http://anglebug.com/42260698
-#define ANGLE_TRACE_EVENT_BEGIN(CATEGORY, EVENT, ...) \
-    TRACE_EVENT_BEGIN(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
+#    define ANGLE_TRACE_EVENT_BEGIN(CATEGORY, EVENT, ...) \
+        TRACE_EVENT_BEGIN(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
+
+#    define ANGLE_TRACE_EVENT_END(CATEGORY, EVENT, ...) \
+        TRACE_EVENT_END(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
+
+#    define ANGLE_TRACE_EVENT_INSTANT(CATEGORY, EVENT, ...) \
+        TRACE_EVENT_INSTANT(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
 
-#define ANGLE_TRACE_EVENT_END(CATEGORY, EVENT, ...) \
-    TRACE_EVENT_END(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
+#    define ANGLE_TRACE_EVENT(CATEGORY, EVENT, ...) \
+        TRACE_EVENT(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
 
-#define ANGLE_TRACE_EVENT_INSTANT(CATEGORY, EVENT, ...) \
-    TRACE_EVENT_INSTANT(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
+// For event names that are not string literals, such as debug markers.
+#    define ANGLE_TRACE_EVENT_COPY_BEGIN(CATEGORY, EVENT) \
+        TRACE_EVENT_COPY_BEGIN(ANGLEPlatformCurrent(), CATEGORY, EVENT)
+#    define ANGLE_TRACE_EVENT_COPY_END(CATEGORY, EVENT) \
+        TRACE_EVENT_COPY_END(ANGLEPlatformCurrent(), CATEGORY, EVENT)
+#    define ANGLE_TRACE_EVENT_COPY_INSTANT(CATEGORY, EVENT) \
+        TRACE_EVENT_COPY_INSTANT(ANGLEPlatformCurrent(), CATEGORY, EVENT)
 
-#define ANGLE_TRACE_EVENT(CATEGORY, EVENT, ...) \
-    TRACE_EVENT(ANGLEPlatformCurrent(), CATEGORY, EVENT, ##__VA_ARGS__)
+// Records the value of a counter, shown as its own track.  Counters that take some work to gather
+// can be skipped when ANGLE_TRACE_COUNTERS_ENABLED is false.
+#    define ANGLE_TRACE_COUNTER(CATEGORY, NAME, VALUE) \
+        TRACE_COUNTER1(ANGLEPlatformCurrent(), CATEGORY, NAME, VALUE)
+#    define ANGLE_TRACE_COUNTERS_ENABLED(CATEGORY) \
+        (*TRACE_EVENT_API_GET_CATEGORY_ENABLED(ANGLEPlatformCurrent(), CATEGORY) != 0)
+#endif  // defined(ANGLE_ENABLE_TRACK_EVENT_TRACING)
 
 // Deprecated, use ANGLE_TRACE_EVENT_BEGIN
 #define ANGLE_TRACE_EVENT_BEGIN0(CATEGORY, EVENT) ANGLE_TRACE_EVENT_BEGIN(CATEGORY, EVENT)
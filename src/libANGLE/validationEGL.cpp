@@ -2516,6 +2516,22 @@ bool ValidateCreateWindowSurfaceAttributes(const ValidationContext *val,
                 }
                 break;
 
+            case EGL_MAX_FRAME_LATENCY_ANGLE:
+                if (!displayExtensions.maxFrameLatencyANGLE)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "Attribute EGL_MAX_FRAME_LATENCY_ANGLE requires "
+                                  "EGL_ANGLE_max_frame_latency.");
+                    return false;
+                }
+                if (value < 1)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "EGL_MAX_FRAME_LATENCY_ANGLE must be at least 1.");
+                    return false;
+                }
+                break;
+
             case EGL_VG_COLORSPACE:
                 if (value != EGL_VG_COLORSPACE_sRGB)
                 {
@@ -5960,11 +5976,14 @@ bool ValidateQueryContext(const ValidationContext *val,
             break;
 
         case EGL_CONTEXT_MEMORY_USAGE_ANGLE:
+        case EGL_CONTEXT_MEMORY_USAGE_CATEGORY_COUNT_ANGLE:
+        case EGL_CONTEXT_MEMORY_USAGE_BREAKDOWN_ANGLE:
             if (!display->getExtensions().memoryUsageReportANGLE)
             {
                 val->setError(EGL_BAD_ATTRIBUTE,
-                              "Attribute EGL_CONTEXT_MEMORY_USAGE_ANGLE requires "
-                              "EGL_ANGLE_memory_usage_report.");
+                              "Attribute 0x%04X requires "
+                              "EGL_ANGLE_memory_usage_report.",
+                              attribute);
                 return false;
             }
             break;
@@ -6635,6 +6654,38 @@ bool ValidateQueryDeviceStringEXT(const ValidationContext *val, const Device *de
     return true;
 }
 
+bool ValidateHandleMemoryPressureANGLE(const ValidationContext *val,
+                                       const Display *display,
+                                       gl::ContextID contextID,
+                                       EGLint level)
+{
+    ANGLE_VALIDATION_TRY(ValidateDisplay(val, display));
+
+    if (!display->getExtensions().memoryPressureANGLE)
+    {
+        val->setError(EGL_BAD_ACCESS, "EGL_ANGLE_memory_pressure is not available.");
+        return false;
+    }
+
+    if (contextID.value != 0)
+    {
+        ANGLE_VALIDATION_TRY(ValidateContext(val, display, contextID));
+    }
+
+    switch (level)
+    {
+        case EGL_MEMORY_PRESSURE_MODERATE_ANGLE:
+        case EGL_MEMORY_PRESSURE_CRITICAL_ANGLE:
+            break;
+
+        default:
+            val->setError(EGL_BAD_PARAMETER, "Invalid memory pressure level.");
+            return false;
+    }
+
+    return true;
+}
+
 bool ValidateReleaseHighPowerGPUANGLE(const ValidationContext *val,
                                       const Display *display,
                                       gl::ContextID contextID)
@@ -249,6 +249,12 @@ bool ValidateQueryDisplayAttribANGLE(const ValidationContext *val,
                                      EGLint attribute,
                                      const EGLAttrib *value);
 
+// EGL_ANGLE_memory_pressure
+bool ValidateHandleMemoryPressureANGLE(const ValidationContext *val,
+                                       const egl::Display *dpyPacked,
+                                       gl::ContextID ctxPacked,
+                                       EGLint level);
+
 // EGL_ANGLE_metal_shared_event_sync
 bool ValidateCopyMetalSharedEventANGLE(const ValidationContext *val,
                                        const egl::Display *dpyPacked,
@@ -1052,6 +1052,18 @@ ANGLE_INLINE bool ValidateDrawInstancedAttribs(const Context *context,
     return true;
 }
 
+// Whether |first| is non-negative and |count| and |primcount| are positive, which is the case
+// for all draw calls that do any work.  The sign bits of the arguments (and of count - 1 and
+// primcount - 1, which catch zero) are combined so that this is a single branch.
+ANGLE_INLINE bool AreDrawArraysArgumentsNonEmpty(GLint first, GLsizei count, GLsizei primcount)
+{
+    const uint32_t signBits = static_cast<uint32_t>(first) | static_cast<uint32_t>(count) |
+                              (static_cast<uint32_t>(count) - 1u) |
+                              static_cast<uint32_t>(primcount) |
+                              (static_cast<uint32_t>(primcount) - 1u);
+    return (signBits & 0x8000'0000u) == 0;
+}
+
 ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
                                            angle::EntryPoint entryPoint,
                                            PrimitiveMode mode,
@@ -1059,32 +1071,22 @@ ANGLE_INLINE bool ValidateDrawArraysCommon(const Context *context,
                                            GLsizei count,
                                            GLsizei primcount)
 {
-    if (first < 0)
+    if (ANGLE_UNLIKELY(!AreDrawArraysArgumentsNonEmpty(first, count, primcount)))
     {
-        ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, err::kNegativeStart);
-        return false;
-    }
-
-    if (count <= 0)
-    {
-        if (count < 0)
+        if (first < 0)
         {
-            ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, err::kNegativeCount);
+            ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, err::kNegativeStart);
             return false;
         }
 
-        // Early exit.
-        return ValidateDrawBase(context, entryPoint, mode);
-    }
-
-    if (primcount <= 0)
-    {
-        if (primcount < 0)
+        if (count < 0 || (count > 0 && primcount < 0))
         {
             ANGLE_VALIDATION_ERROR(GL_INVALID_VALUE, err::kNegativeCount);
             return false;
         }
-        // Early exit.
+
+        // Early exit for empty draw calls.
+        ASSERT(count == 0 || primcount == 0);
         return ValidateDrawBase(context, entryPoint, mode);
     }
 
@@ -71,6 +71,7 @@ PFNEGLACQUIREEXTERNALCONTEXTANGLEPROC l_EGL_AcquireExternalContextANGLE;
 PFNEGLRELEASEEXTERNALCONTEXTANGLEPROC l_EGL_ReleaseExternalContextANGLE;
 PFNEGLQUERYDISPLAYATTRIBANGLEPROC l_EGL_QueryDisplayAttribANGLE;
 PFNEGLQUERYSTRINGIANGLEPROC l_EGL_QueryStringiANGLE;
+PFNEGLHANDLEMEMORYPRESSUREANGLEPROC l_EGL_HandleMemoryPressureANGLE;
 PFNEGLCOPYMETALSHAREDEVENTANGLEPROC l_EGL_CopyMetalSharedEventANGLE;
 PFNEGLSETVALIDATIONENABLEDANGLEPROC l_EGL_SetValidationEnabledANGLE;
 PFNEGLFORCEGPUSWITCHANGLEPROC l_EGL_ForceGPUSwitchANGLE;
@@ -223,6 +224,8 @@ void LoadLibEGL_EGL(LoadProc loadProc)
         loadProc("EGL_QueryDisplayAttribANGLE"));
     l_EGL_QueryStringiANGLE =
         reinterpret_cast<PFNEGLQUERYSTRINGIANGLEPROC>(loadProc("EGL_QueryStringiANGLE"));
+    l_EGL_HandleMemoryPressureANGLE = reinterpret_cast<PFNEGLHANDLEMEMORYPRESSUREANGLEPROC>(
+        loadProc("EGL_HandleMemoryPressureANGLE"));
     l_EGL_CopyMetalSharedEventANGLE = reinterpret_cast<PFNEGLCOPYMETALSHAREDEVENTANGLEPROC>(
         loadProc("EGL_CopyMetalSharedEventANGLE"));
     l_EGL_SetValidationEnabledANGLE = reinterpret_cast<PFNEGLSETVALIDATIONENABLEDANGLEPROC>(
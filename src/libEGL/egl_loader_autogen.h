@@ -75,6 +75,7 @@
 #define EGL_ReleaseExternalContextANGLE l_EGL_ReleaseExternalContextANGLE
 #define EGL_QueryDisplayAttribANGLE l_EGL_QueryDisplayAttribANGLE
 #define EGL_QueryStringiANGLE l_EGL_QueryStringiANGLE
+#define EGL_HandleMemoryPressureANGLE l_EGL_HandleMemoryPressureANGLE
 #define EGL_CopyMetalSharedEventANGLE l_EGL_CopyMetalSharedEventANGLE
 #define EGL_SetValidationEnabledANGLE l_EGL_SetValidationEnabledANGLE
 #define EGL_ForceGPUSwitchANGLE l_EGL_ForceGPUSwitchANGLE
@@ -196,6 +197,7 @@ ANGLE_NO_EXPORT extern PFNEGLACQUIREEXTERNALCONTEXTANGLEPROC l_EGL_AcquireExtern
 ANGLE_NO_EXPORT extern PFNEGLRELEASEEXTERNALCONTEXTANGLEPROC l_EGL_ReleaseExternalContextANGLE;
 ANGLE_NO_EXPORT extern PFNEGLQUERYDISPLAYATTRIBANGLEPROC l_EGL_QueryDisplayAttribANGLE;
 ANGLE_NO_EXPORT extern PFNEGLQUERYSTRINGIANGLEPROC l_EGL_QueryStringiANGLE;
+ANGLE_NO_EXPORT extern PFNEGLHANDLEMEMORYPRESSUREANGLEPROC l_EGL_HandleMemoryPressureANGLE;
 ANGLE_NO_EXPORT extern PFNEGLCOPYMETALSHAREDEVENTANGLEPROC l_EGL_CopyMetalSharedEventANGLE;
 ANGLE_NO_EXPORT extern PFNEGLSETVALIDATIONENABLEDANGLEPROC l_EGL_SetValidationEnabledANGLE;
 ANGLE_NO_EXPORT extern PFNEGLFORCEGPUSWITCHANGLEPROC l_EGL_ForceGPUSwitchANGLE;
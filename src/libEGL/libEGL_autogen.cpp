@@ -508,6 +508,13 @@ EGLBoolean EGLAPIENTRY eglQueryDisplayAttribANGLE(EGLDisplay dpy,
     return EGL_QueryDisplayAttribANGLE(dpy, attribute, value);
 }
 
+// EGL_ANGLE_memory_pressure
+void EGLAPIENTRY eglHandleMemoryPressureANGLE(EGLDisplay dpy, EGLContext ctx, EGLint level)
+{
+    EnsureEGLLoaded();
+    return EGL_HandleMemoryPressureANGLE(dpy, ctx, level);
+}
+
 // EGL_ANGLE_metal_shared_event_sync
 void *EGLAPIENTRY eglCopyMetalSharedEventANGLE(EGLDisplay dpy, EGLSyncKHR sync)
 {
@@ -142,6 +142,11 @@ ScopedContextMutexLock GetContextLock_QueryDisplayAttribANGLE(Thread *thread,
                                                               egl::Display *dpyPacked,
                                                               EGLint attribute);
 
+// EGL_ANGLE_memory_pressure
+ScopedContextMutexLock GetContextLock_HandleMemoryPressureANGLE(Thread *thread,
+                                                                egl::Display *dpyPacked,
+                                                                gl::ContextID ctxPacked);
+
 // EGL_ANGLE_metal_shared_event_sync
 ScopedContextMutexLock GetContextLock_CopyMetalSharedEventANGLE(Thread *thread,
                                                                 egl::Display *dpyPacked);
@@ -412,6 +412,15 @@ ANGLE_INLINE ScopedContextMutexLock GetContextLock_QueryDisplayAttribANGLE(Threa
     return {};
 }
 
+// EGL_ANGLE_memory_pressure
+ANGLE_INLINE ScopedContextMutexLock
+GetContextLock_HandleMemoryPressureANGLE(Thread *thread,
+                                         egl::Display *dpyPacked,
+                                         gl::ContextID ctxPacked)
+{
+    return TryLockContext(dpyPacked, ctxPacked);
+}
+
 // EGL_ANGLE_metal_shared_event_sync
 ANGLE_INLINE ScopedContextMutexLock
 GetContextLock_CopyMetalSharedEventANGLE(Thread *thread, egl::Display *dpyPacked)
@@ -1086,6 +1086,20 @@ void SetValidationEnabledANGLE(Thread *thread, EGLBoolean validationState)
     thread->setSuccess();
 }
 
+void HandleMemoryPressureANGLE(Thread *thread,
+                               Display *display,
+                               gl::ContextID contextID,
+                               EGLint level)
+{
+    ANGLE_EGL_TRY_PREPARE_FOR_CALL(thread, display->prepareForCall(),
+                                   "eglHandleMemoryPressureANGLE", GetDisplayIfValid(display));
+    gl::Context *context = contextID.value != 0 ? display->getContext(contextID) : nullptr;
+    ANGLE_EGL_TRY(thread, display->handleMemoryPressure(context, level),
+                  "eglHandleMemoryPressureANGLE", GetDisplayIfValid(display));
+
+    thread->setSuccess();
+}
+
 EGLBoolean QuerySupportedCompressionRatesEXT(Thread *thread,
                                              egl::Display *display,
                                              egl::Config *configPacked,
@@ -283,5 +283,9 @@ EGLBoolean ExportVkImageANGLE(Thread *thread,
 void *CopyMetalSharedEventANGLE(Thread *thread, egl::Display *dpyPacked, egl::SyncID syncPacked);
 void WaitUntilWorkScheduledANGLE(Thread *thread, egl::Display *dpyPacked);
 void SetValidationEnabledANGLE(Thread *thread, EGLBoolean validationState);
+void HandleMemoryPressureANGLE(Thread *thread,
+                               egl::Display *dpyPacked,
+                               gl::ContextID ctxPacked,
+                               EGLint level);
 }  // namespace egl
 #endif  // LIBGLESV2_EGL_EXT_STUBS_AUTOGEN_H_
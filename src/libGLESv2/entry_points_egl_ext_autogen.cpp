@@ -613,6 +613,40 @@ EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribANGLE(EGLDisplay dpy,
     return returnValue;
 }
 
+// EGL_ANGLE_memory_pressure
+void EGLAPIENTRY EGL_HandleMemoryPressureANGLE(EGLDisplay dpy, EGLContext ctx, EGLint level)
+{
+
+    Thread *thread = egl::GetCurrentThread();
+    ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
+    {
+        ANGLE_SCOPED_GLOBAL_LOCK();
+        EGL_EVENT(HandleMemoryPressureANGLE,
+                  "dpy = 0x%016" PRIxPTR ", ctx = 0x%016" PRIxPTR ", level = %d", (uintptr_t)dpy,
+                  (uintptr_t)ctx, level);
+
+        egl::Display *dpyPacked = PackParam<egl::Display *>(dpy);
+        gl::ContextID ctxPacked = PackParam<gl::ContextID>(ctx);
+
+        {
+            ANGLE_EGL_SCOPED_CONTEXT_LOCK(HandleMemoryPressureANGLE, thread, dpyPacked, ctxPacked);
+            if (IsEGLValidationEnabled())
+            {
+                ANGLE_EGL_VALIDATE_VOID(thread, HandleMemoryPressureANGLE,
+                                        GetDisplayIfValid(dpyPacked), dpyPacked, ctxPacked, level);
+            }
+            else
+            {
+            }
+
+            HandleMemoryPressureANGLE(thread, dpyPacked, ctxPacked, level);
+        }
+
+        ANGLE_CAPTURE_EGL(HandleMemoryPressureANGLE, true, thread, dpyPacked, ctxPacked, level);
+    }
+    ASSERT(!egl::Display::GetCurrentThreadUnlockedTailCall()->any());
+}
+
 // EGL_ANGLE_metal_shared_event_sync
 void *EGLAPIENTRY EGL_CopyMetalSharedEventANGLE(EGLDisplay dpy, EGLSyncKHR sync)
 {
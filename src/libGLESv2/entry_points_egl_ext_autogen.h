@@ -79,6 +79,11 @@ ANGLE_EXPORT EGLBoolean EGLAPIENTRY EGL_QueryDisplayAttribANGLE(EGLDisplay dpy,
                                                                 EGLint attribute,
                                                                 EGLAttrib *value);
 
+// EGL_ANGLE_memory_pressure
+ANGLE_EXPORT void EGLAPIENTRY EGL_HandleMemoryPressureANGLE(EGLDisplay dpy,
+                                                            EGLContext ctx,
+                                                            EGLint level);
+
 // EGL_ANGLE_metal_shared_event_sync
 ANGLE_EXPORT void *EGLAPIENTRY EGL_CopyMetalSharedEventANGLE(EGLDisplay dpy, EGLSyncKHR sync);
 
@@ -1818,7 +1818,7 @@ void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
 
     if (context)
     {
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+        SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBooleanv(context, angle::EntryPoint::GLGetBooleanv, pname, data));
@@ -1905,7 +1905,7 @@ void GL_APIENTRY GL_GetFloatv(GLenum pname, GLfloat *data)
 
     if (context)
     {
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+        SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetFloatv(context, angle::EntryPoint::GLGetFloatv, pname, data));
@@ -1965,7 +1965,7 @@ void GL_APIENTRY GL_GetIntegerv(GLenum pname, GLint *data)
 
     if (context)
     {
-        SCOPED_SHARE_CONTEXT_LOCK(context);
+        SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetIntegerv(context, angle::EntryPoint::GLGetIntegerv, pname, data));
@@ -168,21 +168,30 @@ static ANGLE_INLINE void DirtyContextIfNeeded(Context *context)
 
 #if !defined(ANGLE_ENABLE_SHARE_CONTEXT_LOCK)
 #    define SCOPED_SHARE_CONTEXT_LOCK(context)
+#    define SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname)
 #    define SCOPED_EGL_IMAGE_SHARE_CONTEXT_LOCK(context, imageID) ANGLE_SCOPED_GLOBAL_LOCK()
 #else
 #    if defined(ANGLE_FORCE_CONTEXT_CHECK_EVERY_CALL)
 #        define SCOPED_SHARE_CONTEXT_LOCK(context)          \
             egl::ScopedGlobalEGLMutexLock shareContextLock; \
             DirtyContextIfNeeded(context)
+#        define SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname) \
+            SCOPED_SHARE_CONTEXT_LOCK(context)
 #        define SCOPED_EGL_IMAGE_SHARE_CONTEXT_LOCK(context, imageID) \
             SCOPED_SHARE_CONTEXT_LOCK(context)
 #    elif !defined(ANGLE_ENABLE_CONTEXT_MUTEX)
 #        define SCOPED_SHARE_CONTEXT_LOCK(context) \
             egl::ScopedOptionalGlobalMutexLock shareContextLock(context->isShared())
+#        define SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname) \
+            egl::ScopedOptionalGlobalMutexLock shareContextLock(      \
+                context->isShared() && !PrivateState::IsPrivateStateQuery(pname))
 #        define SCOPED_EGL_IMAGE_SHARE_CONTEXT_LOCK(context, imageID) ANGLE_SCOPED_GLOBAL_LOCK()
 #    else
 #        define SCOPED_SHARE_CONTEXT_LOCK(context) \
             egl::ScopedContextMutexLock shareContextLock(context->getContextMutex())
+#        define SCOPED_STATE_QUERY_SHARE_CONTEXT_LOCK(context, pname) \
+            egl::ScopedContextMutexLock shareContextLock(             \
+                PrivateState::IsPrivateStateQuery(pname) ? nullptr : &context->getContextMutex())
 #        define SCOPED_EGL_IMAGE_SHARE_CONTEXT_LOCK(context, imageID) \
             ANGLE_SCOPED_GLOBAL_LOCK();                               \
             egl::ScopedContextMutexLock shareContextLock =            \
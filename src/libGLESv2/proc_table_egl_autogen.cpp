@@ -89,6 +89,7 @@ const ProcEntry g_procTable[] = {
     {"eglGetSyncAttribKHR", P(EGL_GetSyncAttribKHR)},
     {"eglGetSyncValuesCHROMIUM", P(EGL_GetSyncValuesCHROMIUM)},
     {"eglHandleGPUSwitchANGLE", P(EGL_HandleGPUSwitchANGLE)},
+    {"eglHandleMemoryPressureANGLE", P(EGL_HandleMemoryPressureANGLE)},
     {"eglInitialize", P(EGL_Initialize)},
     {"eglLabelObjectKHR", P(EGL_LabelObjectKHR)},
     {"eglLockSurfaceKHR", P(EGL_LockSurfaceKHR)},
@@ -0,0 +1,155 @@
+#! /usr/bin/env vpython3
+#
+# Copyright 2024 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+# compare_frame_breakdowns.py:
+#   Compares the per-frame breakdowns written by angle_perftests --frame-breakdown (collected by
+#   run_perf_tests.py --frame-breakdown-dir) for a baseline and a candidate build.  Every metric's
+#   change is the ratio of the medians, with a confidence interval from bootstrapping the frames.
+#   A change is a regression only when the whole interval is above the threshold, so noisy
+#   metrics don't fail the comparison.
+#
+#   Example:
+#     compare_frame_breakdowns.py baseline_dir candidate_dir --threshold 0.03
+
+import argparse
+import glob
+import json
+import logging
+import os
+import random
+import statistics
+import sys
+
+DEFAULT_THRESHOLD = 0.03
+DEFAULT_CONFIDENCE = 0.95
+DEFAULT_ITERATIONS = 2000
+
+EXIT_FAILURE = 1
+EXIT_SUCCESS = 0
+
+
+def _load_breakdowns(path):
+    if os.path.isdir(path):
+        paths = sorted(glob.glob(os.path.join(path, 'frame_breakdown*.json')))
+    else:
+        paths = [path]
+
+    breakdowns = {}
+    for breakdown_path in paths:
+        with open(breakdown_path) as f:
+            breakdown = json.load(f)
+        breakdowns[breakdown['test']] = breakdown['metrics']
+    return breakdowns
+
+
+def _bootstrap_median_ratio(baseline, candidate, iterations, confidence, rng):
+    ratios = []
+    for _ in range(iterations):
+        baseline_median = statistics.median(rng.choices(baseline, k=len(baseline)))
+        candidate_median = statistics.median(rng.choices(candidate, k=len(candidate)))
+        if baseline_median > 0:
+            ratios.append(candidate_median / baseline_median)
+
+    if not ratios:
+        return None
+    ratios.sort()
+    tail = (1.0 - confidence) / 2.0
+    low = ratios[int(tail * (len(ratios) - 1))]
+    high = ratios[int((1.0 - tail) * (len(ratios) - 1))]
+    return low, high
+
+
+def _compare_metric(metric, baseline, candidate, args, rng):
+    baseline_median = statistics.median(baseline)
+    candidate_median = statistics.median(candidate)
+    result = {
+        'baseline_median': baseline_median,
+        'candidate_median': candidate_median,
+        'regression': False,
+    }
+    if baseline_median <= 0:
+        return result
+
+    interval = _bootstrap_median_ratio(baseline, candidate, args.iterations, args.confidence, rng)
+    if interval is None:
+        return result
+
+    result['change'] = candidate_median / baseline_median - 1.0
+    result['change_ci'] = [interval[0] - 1.0, interval[1] - 1.0]
+    # Only times are gated on; counts such as the number of render passes are reported.
+    result['regression'] = metric.endswith('_ms') and interval[0] - 1.0 > args.threshold
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('baseline', help='Frame breakdown file or directory of the baseline.')
+    parser.add_argument('candidate', help='Frame breakdown file or directory of the candidate.')
+    parser.add_argument(
+        '--threshold',
+        help='Relative slowdown the confidence interval must exceed to be a regression. '
+        'Default is %.2f.' % DEFAULT_THRESHOLD,
+        type=float,
+        default=DEFAULT_THRESHOLD)
+    parser.add_argument(
+        '--confidence',
+        help='Confidence level of the intervals. Default is %.2f.' % DEFAULT_CONFIDENCE,
+        type=float,
+        default=DEFAULT_CONFIDENCE)
+    parser.add_argument(
+        '--iterations',
+        help='Number of bootstrap iterations. Default is %d.' % DEFAULT_ITERATIONS,
+        type=int,
+        default=DEFAULT_ITERATIONS)
+    parser.add_argument('--seed', help='Random seed, for reproducible intervals.', type=int)
+    parser.add_argument('--output', help='Writes the comparison to this JSON file.')
+    parser.add_argument('-l', '--log', help='Log output level. Default is info.', default='info')
+    args = parser.parse_args()
+
+    logging.basicConfig(level=args.log.upper())
+    rng = random.Random(args.seed)
+
+    baseline = _load_breakdowns(args.baseline)
+    candidate = _load_breakdowns(args.candidate)
+
+    comparison = {}
+    regressions = 0
+    for test in sorted(set(baseline) & set(candidate)):
+        comparison[test] = {}
+        for metric in sorted(set(baseline[test]) & set(candidate[test])):
+            baseline_values = baseline[test][metric]
+            candidate_values = candidate[test][metric]
+            if not baseline_values or not candidate_values:
+                continue
+
+            result = _compare_metric(metric, baseline_values, candidate_values, args, rng)
+            comparison[test][metric] = result
+
+            if 'change' in result:
+                logging.info('%s %s: %.4f -> %.4f (%+.1f%%, CI [%+.1f%%, %+.1f%%])%s' %
+                             (test, metric, result['baseline_median'], result['candidate_median'],
+                              result['change'] * 100, result['change_ci'][0] * 100,
+                              result['change_ci'][1] * 100,
+                              ' REGRESSION' if result['regression'] else ''))
+            if result['regression']:
+                regressions += 1
+
+    for test in sorted(set(baseline) ^ set(candidate)):
+        logging.warning('%s is only in the %s' %
+                        (test, 'baseline' if test in baseline else 'candidate'))
+
+    if args.output:
+        with open(args.output, 'w') as out_file:
+            out_file.write(json.dumps(comparison, indent=2))
+
+    if regressions:
+        logging.error('Found %d regression%s.' % (regressions, 's' if regressions > 1 else ''))
+        return EXIT_FAILURE
+    return EXIT_SUCCESS
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -228,3 +228,81 @@ TEST_F(ShCompileTest, DecimalSepLocale)
         }
     }
 }
+
+// Shaders that differ only in comments, whitespace and unused macros have the same normalized
+// preprocessed source.
+TEST_F(ShCompileTest, NormalizedPreprocessedSourceIgnoresCommentsAndWhitespace)
+{
+    constexpr char kSource1[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(1.0, 0.0, 0.0, 1.0);
+})";
+
+    constexpr char kSource2[] = R"(// A comment
+precision   mediump float; /* another comment */
+#define UNUSED_MACRO 3
+
+void main() {
+        gl_FragColor = vec4(1.0,
+                            0.0,
+                            0.0,
+                            1.0);
+}
+)";
+
+    constexpr char kSource3[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(0.0, 1.0, 0.0, 1.0);
+})";
+
+    ShCompileOptions compileOptions = {};
+    std::string normalized1;
+    std::string normalized2;
+    std::string normalized3;
+
+    const char *parts1[] = {kSource1};
+    const char *parts2[] = {kSource2};
+    const char *parts3[] = {kSource3};
+    ASSERT_TRUE(
+        sh::GetNormalizedPreprocessedSource(mCompiler, parts1, 1, compileOptions, &normalized1));
+    ASSERT_TRUE(
+        sh::GetNormalizedPreprocessedSource(mCompiler, parts2, 1, compileOptions, &normalized2));
+    ASSERT_TRUE(
+        sh::GetNormalizedPreprocessedSource(mCompiler, parts3, 1, compileOptions, &normalized3));
+
+    EXPECT_EQ(normalized1, normalized2);
+    EXPECT_NE(normalized1, normalized3);
+}
+
+// Directives that affect compilation are kept in the normalized preprocessed source.
+TEST_F(ShCompileTest, NormalizedPreprocessedSourceKeepsDirectives)
+{
+    constexpr char kSource1[] = R"(#extension GL_OES_standard_derivatives : enable
+precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(dFdx(1.0));
+})";
+
+    constexpr char kSource2[] = R"(#extension GL_OES_standard_derivatives : disable
+precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(dFdx(1.0));
+})";
+
+    ShCompileOptions compileOptions = {};
+    std::string normalized1;
+    std::string normalized2;
+
+    const char *parts1[] = {kSource1};
+    const char *parts2[] = {kSource2};
+    ASSERT_TRUE(
+        sh::GetNormalizedPreprocessedSource(mCompiler, parts1, 1, compileOptions, &normalized1));
+    ASSERT_TRUE(
+        sh::GetNormalizedPreprocessedSource(mCompiler, parts2, 1, compileOptions, &normalized2));
+
+    EXPECT_NE(normalized1, normalized2);
+}
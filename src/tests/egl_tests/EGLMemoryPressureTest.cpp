@@ -0,0 +1,112 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EGLMemoryPressureTest:
+//   Tests pertaining to EGL_ANGLE_memory_pressure extension.
+//
+
+#include <gtest/gtest.h>
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+class EGLMemoryPressureTest : public ANGLETest<>
+{
+  protected:
+    bool hasMemoryPressureExtension() const
+    {
+        return IsEGLDisplayExtensionEnabled(getEGLWindow()->getDisplay(),
+                                            "EGL_ANGLE_memory_pressure");
+    }
+
+    void drawAndCheck(const GLColor &color)
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+        glUseProgram(program);
+        GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+        ASSERT_NE(-1, colorLocation);
+        glUniform4fv(colorLocation, 1, color.toNormalizedVector().data());
+
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, color);
+    }
+};
+
+// Test that invalid parameters generate errors.
+TEST_P(EGLMemoryPressureTest, InvalidParameters)
+{
+    ANGLE_SKIP_TEST_IF(!hasMemoryPressureExtension());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLContext context = getEGLWindow()->getContext();
+
+    eglHandleMemoryPressureANGLE(EGL_NO_DISPLAY, EGL_NO_CONTEXT,
+                                 EGL_MEMORY_PRESSURE_MODERATE_ANGLE);
+    EXPECT_EGL_ERROR(EGL_BAD_DISPLAY);
+
+    eglHandleMemoryPressureANGLE(display, context, EGL_NONE);
+    EXPECT_EGL_ERROR(EGL_BAD_PARAMETER);
+
+    eglHandleMemoryPressureANGLE(display, EGL_NO_CONTEXT, 0);
+    EXPECT_EGL_ERROR(EGL_BAD_PARAMETER);
+}
+
+// Test that the display caches can be released without a context.
+TEST_P(EGLMemoryPressureTest, NoContext)
+{
+    ANGLE_SKIP_TEST_IF(!hasMemoryPressureExtension());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    drawAndCheck(GLColor::red);
+
+    eglHandleMemoryPressureANGLE(display, EGL_NO_CONTEXT, EGL_MEMORY_PRESSURE_MODERATE_ANGLE);
+    ASSERT_EGL_SUCCESS();
+    eglHandleMemoryPressureANGLE(display, EGL_NO_CONTEXT, EGL_MEMORY_PRESSURE_CRITICAL_ANGLE);
+    ASSERT_EGL_SUCCESS();
+
+    drawAndCheck(GLColor::green);
+}
+
+// Test that rendering continues to work after the context released its memory, including with
+// buffers and programs created before the call.
+TEST_P(EGLMemoryPressureTest, RenderAfterRelease)
+{
+    ANGLE_SKIP_TEST_IF(!hasMemoryPressureExtension());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLContext context = getEGLWindow()->getContext();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    std::vector<GLColor> data(16, GLColor::blue);
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, data.size() * sizeof(GLColor), data.data(), GL_DYNAMIC_DRAW);
+    ASSERT_GL_NO_ERROR();
+
+    for (EGLint level : {EGL_MEMORY_PRESSURE_MODERATE_ANGLE, EGL_MEMORY_PRESSURE_CRITICAL_ANGLE})
+    {
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        ASSERT_GL_NO_ERROR();
+
+        eglHandleMemoryPressureANGLE(display, context, level);
+        ASSERT_EGL_SUCCESS();
+
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+
+        // Shaders compiled after the call may need to recreate the released compiler.
+        drawAndCheck(GLColor::red);
+
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(GLColor), &GLColor::yellow);
+        ASSERT_GL_NO_ERROR();
+    }
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMemoryPressureTest);
+ANGLE_INSTANTIATE_TEST_ES3(EGLMemoryPressureTest);
@@ -36,8 +36,35 @@ class EGLMemoryUsageReportTest : public ANGLETest<>
         return (static_cast<uint64_t>(parts[0]) & 0xffffffff) |
                ((static_cast<uint64_t>(parts[1]) & 0xffffffff) << 32);
     }
+
+    std::vector<uint64_t> getMemoryUsageBreakdown(EGLDisplay display, EGLContext context)
+    {
+        GLint categoryCount = 0;
+        EXPECT_EGL_TRUE(eglQueryContext(display, context,
+                                        EGL_CONTEXT_MEMORY_USAGE_CATEGORY_COUNT_ANGLE,
+                                        &categoryCount));
+
+        std::vector<GLint> parts(categoryCount * 2);
+        EXPECT_EGL_TRUE(eglQueryContext(display, context, EGL_CONTEXT_MEMORY_USAGE_BREAKDOWN_ANGLE,
+                                        parts.data()));
+
+        std::vector<uint64_t> breakdown(categoryCount);
+        for (GLint category = 0; category < categoryCount; ++category)
+        {
+            breakdown[category] = (static_cast<uint64_t>(parts[category * 2]) & 0xffffffff) |
+                                  ((static_cast<uint64_t>(parts[category * 2 + 1]) & 0xffffffff)
+                                   << 32);
+        }
+        return breakdown;
+    }
 };
 
+// The indices of the categories of EGL_CONTEXT_MEMORY_USAGE_BREAKDOWN_ANGLE.
+constexpr size_t kTexturesCategory      = 0;
+constexpr size_t kBuffersCategory       = 1;
+constexpr size_t kRenderbuffersCategory = 2;
+constexpr size_t kShaderCodeCategory    = 3;
+
 // Basic memory usage queries
 TEST_P(EGLMemoryUsageReportTest, BasicQuery)
 {
@@ -113,5 +140,48 @@ TEST_P(EGLMemoryUsageReportTest, QueryNonCurrentContext)
     EXPECT_EGL_TRUE(eglDestroyContext(display, context2));
 }
 
+// Test that the breakdown accounts for the objects in their categories, and agrees with the total.
+TEST_P(EGLMemoryUsageReportTest, BreakdownQuery)
+{
+    ANGLE_SKIP_TEST_IF(!hasMemoryUsageReportExtension());
+
+    constexpr GLint kTextureDim        = 256;
+    constexpr GLuint kTextureSize      = kTextureDim * kTextureDim * 4;
+    constexpr GLuint kBufferSize       = 4096;
+    constexpr GLint kRenderbufferDim   = 128;
+    constexpr GLuint kRenderbufferSize = kRenderbufferDim * kRenderbufferDim * 4;
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLContext context = getEGLWindow()->getContext();
+
+    std::vector<uint64_t> breakdown1 = getMemoryUsageBreakdown(display, context);
+    ASSERT_GT(breakdown1.size(), kShaderCodeCategory);
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, kBufferSize, nullptr, GL_STATIC_DRAW);
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kTextureDim, kTextureDim);
+
+    GLRenderbuffer rbo;
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, kRenderbufferDim, kRenderbufferDim);
+    ASSERT_GL_NO_ERROR();
+
+    std::vector<uint64_t> breakdown2 = getMemoryUsageBreakdown(display, context);
+    ASSERT_EQ(breakdown1.size(), breakdown2.size());
+
+    EXPECT_EQ(breakdown2[kTexturesCategory] - breakdown1[kTexturesCategory], kTextureSize);
+    EXPECT_EQ(breakdown2[kBuffersCategory] - breakdown1[kBuffersCategory], kBufferSize);
+    EXPECT_EQ(breakdown2[kRenderbuffersCategory] - breakdown1[kRenderbuffersCategory],
+              kRenderbufferSize);
+
+    EXPECT_EQ(breakdown2[kTexturesCategory] + breakdown2[kBuffersCategory] +
+                  breakdown2[kRenderbuffersCategory],
+              getMemoryUsage(display, context));
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMemoryUsageReportTest);
 ANGLE_INSTANTIATE_TEST_ES3(EGLMemoryUsageReportTest);
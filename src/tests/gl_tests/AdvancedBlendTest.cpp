@@ -365,6 +365,59 @@ TEST_P(AdvancedBlendTestES32, AdvancedBlendEnabledAndThenDisabled)
     testAdvancedBlendEnabledAndThenDisabled(APIExtensionVersion::Core);
 }
 
+// Test that switching between advanced blend equations from draw to draw blends each draw with its
+// own equation.  In the Vulkan backend, the emulated equations share a pipeline.
+TEST_P(AdvancedBlendTestES32, SwitchEquationsBetweenDraws)
+{
+    constexpr char kVS[] = R"(#version 320 es
+in highp vec4 a_position;
+void main()
+{
+    gl_Position = a_position;
+})";
+
+    constexpr char kFS[] = R"(#version 320 es
+layout(blend_support_multiply, blend_support_screen) out;
+layout(location = 0) out mediump vec4 o_color;
+uniform mediump vec4 u_color;
+void main()
+{
+    o_color = u_color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    GLint colorLoc = glGetUniformLocation(program, "u_color");
+    ASSERT_NE(colorLoc, -1);
+
+    const int w = getWindowWidth();
+    const int h = getWindowHeight();
+
+    glClearColor(0.5, 0.5, 0.5, 1.0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glEnable(GL_BLEND);
+    glEnable(GL_SCISSOR_TEST);
+
+    auto draw = [&](int x, GLenum equation, float r, float g, float b) {
+        glScissor(x, 0, w / 2, h);
+        glBlendEquation(equation);
+        glUniform4f(colorLoc, r, g, b, 1);
+        glBlendBarrier();
+        drawQuad(program, "a_position", 0.5f);
+    };
+
+    draw(0, GL_MULTIPLY, 1, 0.5, 0);
+    draw(w / 2, GL_SCREEN, 1, 0.5, 0);
+    draw(0, GL_SCREEN, 0, 0.5, 1);
+    draw(w / 2, GL_MULTIPLY, 0, 0.5, 1);
+    ASSERT_GL_NO_ERROR();
+
+    // Left: multiply, then screen.  Right: screen, then multiply.
+    EXPECT_PIXEL_COLOR_NEAR(w / 4, h / 2, GLColor(128, 159, 255, 255), kPixelColorThreshhold);
+    EXPECT_PIXEL_COLOR_NEAR(3 * w / 4, h / 2, GLColor(0, 96, 128, 255), kPixelColorThreshhold);
+}
+
 // Test querying advanced blend equation coherent on supported devices (enabled by default).
 TEST_P(AdvancedBlendTest, AdvancedBlendCoherentQuery)
 {
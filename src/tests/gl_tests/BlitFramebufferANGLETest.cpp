@@ -4006,6 +4006,143 @@ TEST_P(BlitFramebufferTest, ResolveWithRotation)
     EXPECT_PIXEL_RECT_EQ(w / 2, h / 2, w / 2, h / 2, GLColor::yellow);
 }
 
+// Test resolving a multisampled renderbuffer and invalidating it frame after frame, which may make
+// the renderbuffer transient.
+TEST_P(BlitFramebufferTest, ResolveAndInvalidateRepeatedly)
+{
+    constexpr GLsizei kSize = 16;
+    glViewport(0, 0, kSize, kSize);
+
+    GLRenderbuffer msaaColor;
+    glBindRenderbuffer(GL_RENDERBUFFER, msaaColor);
+    glRenderbufferStorageMultisample(GL_RENDERBUFFER, 4, GL_RGBA8, kSize, kSize);
+
+    GLFramebuffer msaaFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, msaaFBO);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, msaaColor);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    GLTexture resolveColor;
+    glBindTexture(GL_TEXTURE_2D, resolveColor);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+
+    GLFramebuffer resolveFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, resolveFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, resolveColor, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Passthrough(), essl1_shaders::fs::Checkered());
+
+    const GLColor kClearColors[] = {GLColor::cyan, GLColor::magenta, GLColor::white};
+    constexpr GLenum kAttachment = GL_COLOR_ATTACHMENT0;
+
+    for (uint32_t frame = 0; frame < 8; ++frame)
+    {
+        const GLColor &clearColor = kClearColors[frame % ArraySize(kClearColors)];
+        const bool drawCheckered  = frame % 2 == 1;
+
+        glBindFramebuffer(GL_FRAMEBUFFER, msaaFBO);
+        glClearColor(clearColor.R / 255.0f, clearColor.G / 255.0f, clearColor.B / 255.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (drawCheckered)
+        {
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+
+        glBindFramebuffer(GL_DRAW_FRAMEBUFFER, resolveFBO);
+        glBlitFramebuffer(0, 0, kSize, kSize, 0, 0, kSize, kSize, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+        glInvalidateFramebuffer(GL_READ_FRAMEBUFFER, 1, &kAttachment);
+        ASSERT_GL_NO_ERROR();
+
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, resolveFBO);
+        if (drawCheckered)
+        {
+            EXPECT_PIXEL_RECT_EQ(0, 0, kSize / 2, kSize / 2, GLColor::red);
+            EXPECT_PIXEL_RECT_EQ(kSize / 2, 0, kSize / 2, kSize / 2, GLColor::blue);
+            EXPECT_PIXEL_RECT_EQ(0, kSize / 2, kSize / 2, kSize / 2, GLColor::green);
+            EXPECT_PIXEL_RECT_EQ(kSize / 2, kSize / 2, kSize / 2, kSize / 2, GLColor::yellow);
+        }
+        else
+        {
+            EXPECT_PIXEL_RECT_EQ(0, 0, kSize, kSize, clearColor);
+        }
+    }
+}
+
+// Test blitting from a framebuffer that is only cleared, both to the whole destination and to a
+// part of it, and that the source retains its clear.
+TEST_P(BlitFramebufferTest, BlitFromClearedFramebuffer)
+{
+    constexpr GLsizei kSrcSize = 8;
+    constexpr GLsizei kDstSize = 16;
+
+    GLTexture srcColor;
+    glBindTexture(GL_TEXTURE_2D, srcColor);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSrcSize, kSrcSize);
+
+    GLFramebuffer srcFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, srcFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, srcColor, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    GLTexture dstColor;
+    glBindTexture(GL_TEXTURE_2D, dstColor);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kDstSize, kDstSize);
+
+    GLFramebuffer dstFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, dstFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, dstColor, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    // Blit a cleared framebuffer to the whole destination, with stretching.
+    glBindFramebuffer(GL_FRAMEBUFFER, srcFBO);
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dstFBO);
+    glBlitFramebuffer(0, 0, kSrcSize, kSrcSize, 0, 0, kDstSize, kDstSize, GL_COLOR_BUFFER_BIT,
+                      GL_LINEAR);
+    ASSERT_GL_NO_ERROR();
+
+    // Blit a differently cleared framebuffer to a part of the destination.
+    glBindFramebuffer(GL_FRAMEBUFFER, srcFBO);
+    glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dstFBO);
+    glBlitFramebuffer(0, 0, kSrcSize, kSrcSize, 0, 0, kSrcSize, kSrcSize, GL_COLOR_BUFFER_BIT,
+                      GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, dstFBO);
+    EXPECT_PIXEL_RECT_EQ(0, 0, kSrcSize, kSrcSize, GLColor::blue);
+    EXPECT_PIXEL_RECT_EQ(kSrcSize, 0, kDstSize - kSrcSize, kDstSize, GLColor::red);
+    EXPECT_PIXEL_RECT_EQ(0, kSrcSize, kSrcSize, kDstSize - kSrcSize, GLColor::red);
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, srcFBO);
+    EXPECT_PIXEL_RECT_EQ(0, 0, kSrcSize, kSrcSize, GLColor::blue);
+
+    // Blit the cleared framebuffer to the whole destination again, then draw to it.
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, dstFBO);
+    glBlitFramebuffer(0, 0, kSrcSize, kSrcSize, 0, 0, kDstSize, kDstSize, GL_COLOR_BUFFER_BIT,
+                      GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLoc = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(colorLoc, -1);
+    glUniform4f(colorLoc, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, dstFBO);
+    glViewport(0, 0, kDstSize / 2, kDstSize);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, kDstSize / 2, kDstSize, GLColor::green);
+    EXPECT_PIXEL_RECT_EQ(kDstSize / 2, 0, kDstSize / 2, kDstSize, GLColor::blue);
+}
+
 // Test blitting a 3D texture to a 3D texture
 TEST_P(BlitFramebufferTest, Blit3D)
 {
@@ -4061,6 +4198,8 @@ ANGLE_INSTANTIATE_TEST_ES3_AND(BlitFramebufferTest,
                                    .disable(Feature::SupportsExtendedDynamicState2),
                                ES3_VULKAN().disable(Feature::SupportsExtendedDynamicState2),
                                ES3_VULKAN().enable(Feature::DisableFlippingBlitWithCommand),
+                               ES3_VULKAN().enable(
+                                   Feature::PreferTransientMultisampledRenderbuffers),
                                ES3_METAL().disable(Feature::HasShaderStencilOutput));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BlitFramebufferTestES31);
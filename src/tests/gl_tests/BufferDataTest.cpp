@@ -2334,6 +2334,95 @@ void main()
     ASSERT_GL_NO_ERROR();
 }
 
+// Test that updates to disjoint ranges of a buffer followed by overlapping updates all land, as
+// the disjoint ones may be recorded back to back without a barrier in between.
+TEST_P(BufferDataTestES3, DisjointThenOverlappingSubData)
+{
+    constexpr uint32_t kRangeSize  = 64;
+    constexpr uint32_t kRangeCount = 8;
+    constexpr uint32_t kBufferSize = kRangeSize * kRangeCount;
+
+    std::vector<uint8_t> expected(kBufferSize, 0);
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, kBufferSize, expected.data(), GL_DYNAMIC_DRAW);
+
+    // Make the buffer busy so the updates below go through the GPU where possible.
+    glClear(GL_COLOR_BUFFER_BIT);
+    glFlush();
+
+    // Write every range once.
+    for (uint32_t range = 0; range < kRangeCount; ++range)
+    {
+        std::vector<uint8_t> data(kRangeSize, static_cast<uint8_t>(range + 1));
+        glBufferSubData(GL_ARRAY_BUFFER, range * kRangeSize, kRangeSize, data.data());
+        std::copy(data.begin(), data.end(), expected.begin() + range * kRangeSize);
+    }
+
+    // Then write ranges that straddle the previous ones.
+    for (uint32_t range = 0; range + 1 < kRangeCount; ++range)
+    {
+        const uint32_t offset = range * kRangeSize + kRangeSize / 2;
+        std::vector<uint8_t> data(kRangeSize, static_cast<uint8_t>(0x80 + range));
+        glBufferSubData(GL_ARRAY_BUFFER, offset, kRangeSize, data.data());
+        std::copy(data.begin(), data.end(), expected.begin() + offset);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    const uint8_t *mapped = static_cast<const uint8_t *>(
+        glMapBufferRange(GL_ARRAY_BUFFER, 0, kBufferSize, GL_MAP_READ_BIT));
+    ASSERT_NE(mapped, nullptr);
+    for (uint32_t i = 0; i < kBufferSize; ++i)
+    {
+        EXPECT_EQ(mapped[i], expected[i]) << "at byte " << i;
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that a static buffer that is frequently updated and then respecified keeps its contents
+// correct, as the backend may move it to different memory on respecification.
+TEST_P(BufferDataTestES3, FrequentlyUpdatedStaticBufferRespecified)
+{
+    constexpr uint32_t kBufferSize  = 256;
+    constexpr uint32_t kUpdateCount = 32;
+
+    std::vector<uint8_t> data(kBufferSize, 0);
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, kBufferSize, data.data(), GL_STATIC_DRAW);
+
+    for (uint32_t update = 0; update < kUpdateCount; ++update)
+    {
+        std::fill(data.begin(), data.end(), static_cast<uint8_t>(update));
+        glBufferSubData(GL_ARRAY_BUFFER, 0, kBufferSize, data.data());
+        glClear(GL_COLOR_BUFFER_BIT);
+    }
+
+    // Respecify the data store, then partially update it.
+    std::fill(data.begin(), data.end(), 0x40);
+    glBufferData(GL_ARRAY_BUFFER, kBufferSize, data.data(), GL_STATIC_DRAW);
+
+    std::vector<uint8_t> subData(kBufferSize / 2, 0x80);
+    glBufferSubData(GL_ARRAY_BUFFER, kBufferSize / 4, subData.size(), subData.data());
+    std::copy(subData.begin(), subData.end(), data.begin() + kBufferSize / 4);
+    ASSERT_GL_NO_ERROR();
+
+    const uint8_t *mapped = static_cast<const uint8_t *>(
+        glMapBufferRange(GL_ARRAY_BUFFER, 0, kBufferSize, GL_MAP_READ_BIT));
+    ASSERT_NE(mapped, nullptr);
+    for (uint32_t i = 0; i < kBufferSize; ++i)
+    {
+        EXPECT_EQ(mapped[i], data[i]) << "at byte " << i;
+    }
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST_ES2(BufferDataTest);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BufferSubDataTest);
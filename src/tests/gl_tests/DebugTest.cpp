@@ -381,6 +381,92 @@ TEST_P(DebugTestES3, DebugCallback)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test that messages reach the callback in order when the output is not synchronous, at the latest
+// by glFinish, including when more messages are generated than can be queued.
+TEST_P(DebugTestES3, AsynchronousCallback)
+{
+    ANGLE_SKIP_TEST_IF(!mDebugExtensionAvailable);
+
+    std::vector<Message> messages;
+
+    glDebugMessageCallbackKHR(Callback, &messages);
+    glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+    constexpr GLuint kMessageCount = 1000;
+    for (GLuint id = 0; id < kMessageCount; ++id)
+    {
+        glDebugMessageInsertKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, id,
+                                GL_DEBUG_SEVERITY_NOTIFICATION, -1, "Message");
+    }
+    glFinish();
+
+    ASSERT_EQ(kMessageCount, messages.size());
+    for (GLuint id = 0; id < kMessageCount; ++id)
+    {
+        EXPECT_EQ(id, messages[id].id);
+        EXPECT_EQ("Message", messages[id].message);
+    }
+
+    // Messages that are still queued go to the callback that was set when they were generated.
+    std::vector<Message> otherMessages;
+    glDebugMessageInsertKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, kMessageCount,
+                            GL_DEBUG_SEVERITY_NOTIFICATION, -1, "Message");
+    glDebugMessageCallbackKHR(Callback, &otherMessages);
+    glFinish();
+
+    EXPECT_EQ(kMessageCount + 1, messages.size());
+    EXPECT_EQ(0u, otherMessages.size());
+
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test message control by ids, which are not filtered by the source, type and severity alone.
+TEST_P(DebugTestES3, MessageControlIds)
+{
+    ANGLE_SKIP_TEST_IF(!mDebugExtensionAvailable);
+
+    std::vector<Message> messages;
+
+    glDebugMessageCallbackKHR(Callback, &messages);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+
+    // Filter everything out, then enable a single id.
+    glDebugMessageControlKHR(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE);
+    const GLuint enabledId = 2;
+    glDebugMessageControlKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, GL_DONT_CARE, 1,
+                             &enabledId, GL_TRUE);
+
+    for (GLuint id = 1; id <= 3; ++id)
+    {
+        glDebugMessageInsertKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, id,
+                                GL_DEBUG_SEVERITY_HIGH, -1, "Message 1");
+    }
+    glDebugMessageInsertKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_MARKER, enabledId,
+                            GL_DEBUG_SEVERITY_HIGH, -1, "Message 2");
+
+    ASSERT_EQ(1u, messages.size());
+    EXPECT_EQ(enabledId, messages[0].id);
+
+    // Filter everything in, then disable a single id.
+    messages.clear();
+    glDebugMessageControlKHR(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+    const GLuint disabledId = 2;
+    glDebugMessageControlKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, GL_DONT_CARE, 1,
+                             &disabledId, GL_FALSE);
+
+    for (GLuint id = 1; id <= 3; ++id)
+    {
+        glDebugMessageInsertKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, id,
+                                GL_DEBUG_SEVERITY_HIGH, -1, "Message 3");
+    }
+
+    ASSERT_EQ(2u, messages.size());
+    EXPECT_EQ(1u, messages[0].id);
+    EXPECT_EQ(3u, messages[1].id);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test the glGetPointervKHR entry point
 TEST_P(DebugTestES3, GetPointer)
 {
@@ -724,7 +810,8 @@ TEST_P(DebugTestES32, ObjectPtrLabels)
 }
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DebugTestES3);
-ANGLE_INSTANTIATE_TEST_ES3(DebugTestES3);
+ANGLE_INSTANTIATE_TEST_ES3_AND(DebugTestES3,
+                               ES3_VULKAN().enable(Feature::DeliverDebugCallbacksAsynchronously));
 
 ANGLE_INSTANTIATE_TEST(DebugTest,
                        ANGLE_ALL_TEST_PLATFORMS_ES1,
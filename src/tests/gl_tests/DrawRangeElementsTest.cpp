@@ -140,7 +140,83 @@ TEST_P(WebGLDrawRangeElementsTest, DrawRangeElementBaseVertexOESArrayZeroCount)
     doDrawRangeElementsVariant(DrawCallVariants::DrawRangeElementsBaseVertexOES);
 }
 
+class DrawRangeElementsTestES3 : public DrawRangeElementsTest
+{};
+
+// Test glDrawRangeElements with interleaved client side vertex attributes and indices, drawing
+// from the middle of the vertices.
+TEST_P(DrawRangeElementsTestES3, InterleavedClientArrays)
+{
+    constexpr char kVS[] = R"(attribute vec2 a_pos;
+attribute vec4 a_color;
+varying vec4 v_color;
+void main()
+{
+    v_color = a_color;
+    gl_Position = vec4(a_pos, 0.0, 1.0);
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_color;
+void main()
+{
+    gl_FragColor = v_color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+
+    GLint posLocation   = glGetAttribLocation(program, "a_pos");
+    GLint colorLocation = glGetAttribLocation(program, "a_color");
+    ASSERT_NE(-1, posLocation);
+    ASSERT_NE(-1, colorLocation);
+
+    struct Vertex
+    {
+        GLfloat position[2];
+        GLubyte color[4];
+    };
+
+    // A red quad over the left half, a green quad over the right half, and a blue quad over the
+    // whole window.
+    const Vertex vertices[] = {
+        {{-1, -1}, {255, 0, 0, 255}}, {{0, -1}, {255, 0, 0, 255}}, {{0, 1}, {255, 0, 0, 255}},
+        {{-1, 1}, {255, 0, 0, 255}},  {{0, -1}, {0, 255, 0, 255}}, {{1, -1}, {0, 255, 0, 255}},
+        {{1, 1}, {0, 255, 0, 255}},   {{0, 1}, {0, 255, 0, 255}},  {{-1, -1}, {0, 0, 255, 255}},
+        {{1, -1}, {0, 0, 255, 255}},  {{1, 1}, {0, 0, 255, 255}},  {{-1, 1}, {0, 0, 255, 255}},
+    };
+
+    glVertexAttribPointer(posLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          &vertices[0].position);
+    glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex),
+                          &vertices[0].color);
+    glEnableVertexAttribArray(posLocation);
+    glEnableVertexAttribArray(colorLocation);
+
+    const GLubyte indices[] = {0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7, 8, 9, 10, 8, 10, 11};
+
+    glClearColor(0, 0, 0, 0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Draw the green quad, then the red one, from ranges that don't start at zero.
+    glDrawRangeElements(GL_TRIANGLES, 4, 7, 6, GL_UNSIGNED_BYTE, &indices[6]);
+    glDrawRangeElements(GL_TRIANGLES, 0, 3, 6, GL_UNSIGNED_BYTE, &indices[0]);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 4, getWindowHeight() / 2, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() * 3 / 4, getWindowHeight() / 2, GLColor::green);
+
+    // Cover everything with the blue quad.
+    glDrawRangeElements(GL_TRIANGLES, 8, 11, 6, GL_UNSIGNED_BYTE, &indices[12]);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 4, getWindowHeight() / 2, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() * 3 / 4, getWindowHeight() / 2, GLColor::blue);
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DrawRangeElementsTest);
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(WebGLDrawRangeElementsTest);
 
+ANGLE_INSTANTIATE_TEST_ES3(DrawRangeElementsTestES3);
+
 }  // namespace
@@ -6153,6 +6153,64 @@ void main (void)
     EXPECT_PIXEL_RECT_EQ(8, 0, getWindowWidth() - 8, getWindowHeight(), GLColor::magenta);
 }
 
+// Verify that draws reading the framebuffer see the results of earlier draws, when the draws are
+// batched by scissor: disjoint draws first, then draws that overlap them.
+TEST_P(FramebufferFetchES31, ScissoredDisjointThenOverlappingDraws)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_EXT_shader_framebuffer_fetch"));
+
+    constexpr char kVS[] = R"(#version 310 es
+in highp vec4 position;
+void main (void)
+{
+    gl_Position = position;
+})";
+
+    constexpr char kFS[] = R"(#version 310 es
+#extension GL_EXT_shader_framebuffer_fetch : require
+
+layout(location = 0) inout highp vec4 color;
+uniform highp vec4 u_color;
+
+void main (void)
+{
+    color += u_color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, "u_color");
+    ASSERT_NE(colorLocation, -1);
+
+    const int w = getWindowWidth();
+    const int h = getWindowHeight();
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glEnable(GL_SCISSOR_TEST);
+
+    // Add red to the left and right halves in separate draws, which don't overlap.
+    glUniform4f(colorLocation, 0.2, 0, 0, 0);
+    glScissor(0, 0, w / 2, h);
+    drawQuad(program, "position", 0);
+    glScissor(w / 2, 0, w - w / 2, h);
+    drawQuad(program, "position", 0);
+
+    // Add red to the whole framebuffer, which overlaps both.
+    glScissor(0, 0, w, h);
+    drawQuad(program, "position", 0);
+
+    // Add green to the left half twice, the second draw overlapping the first.
+    glUniform4f(colorLocation, 0, 0.4, 0, 0);
+    glScissor(0, 0, w / 2, h);
+    drawQuad(program, "position", 0);
+    drawQuad(program, "position", 0);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, w / 2, h, GLColor(102, 204, 0, 255));
+    EXPECT_PIXEL_RECT_EQ(w / 2, 0, w - w / 2, h, GLColor(102, 0, 0, 255));
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FramebufferFetchES31);
 ANGLE_INSTANTIATE_TEST_ES31_AND(FramebufferFetchES31,
                                 ES31_VULKAN().disable(Feature::SupportsSPIRV14));
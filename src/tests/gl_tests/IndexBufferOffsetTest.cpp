@@ -572,6 +572,54 @@ TEST_P(IndexBufferOffsetTest, DrawWithDifferentCountsSameOffset)
     EXPECT_GL_NO_ERROR();
 }
 
+// Updates parts of a uint8 index buffer between draws, makes sure every draw uses the latest
+// indices and not a stale translation of the buffer.
+TEST_P(IndexBufferOffsetTest, UInt8IndexPartialUpdatesBetweenDraws)
+{
+    GLubyte indexData[] = {0, 1, 2, 0, 1, 2};
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indexData), indexData, GL_STATIC_DRAW);
+    glUseProgram(mProgram);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+    glVertexAttribPointer(mPositionAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glEnableVertexAttribArray(mPositionAttributeLocation);
+
+    glUniform4f(mColorUniformLocation, 1.0f, 0.0f, 0.0f, 1.0f);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+    const int lowerLeftX  = getWindowWidth() / 4;
+    const int lowerLeftY  = getWindowHeight() / 4;
+    const int upperRightX = getWindowWidth() * 3 / 4;
+    const int upperRightY = getWindowHeight() * 3 / 4;
+
+    // Both triangles cover the lower left half.
+    for (int iteration = 0; iteration < 3; ++iteration)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr);
+        EXPECT_PIXEL_COLOR_EQ(lowerLeftX, lowerLeftY, GLColor::red);
+        EXPECT_PIXEL_COLOR_EQ(upperRightX, upperRightY, GLColor::black);
+    }
+
+    // Move the second triangle to the upper right half, at an odd offset.
+    const GLubyte upperRight[] = {1, 2, 3};
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 3, sizeof(upperRight), upperRight);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr);
+    EXPECT_PIXEL_COLOR_EQ(lowerLeftX, lowerLeftY, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(upperRightX, upperRightY, GLColor::red);
+
+    // Make the first triangle degenerate with a single index update.
+    const GLubyte degenerate = 2;
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, 1, &degenerate);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, nullptr);
+    EXPECT_PIXEL_COLOR_EQ(lowerLeftX, lowerLeftY, GLColor::black);
+    EXPECT_PIXEL_COLOR_EQ(upperRightX, upperRightY, GLColor::red);
+
+    EXPECT_GL_NO_ERROR();
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(IndexBufferOffsetTest);
 
 ANGLE_INSTANTIATE_TEST_ES3(IndexBufferOffsetTestES3);
@@ -219,6 +219,35 @@ TEST_P(LineLoopTest, LineLoopUIntIndexBuffer)
     runTest(GL_UNSIGNED_INT, buf, reinterpret_cast<const void *>(sizeof(GLuint)));
 }
 
+// Test that a line loop drawn again from the same index buffer sees the updates to its indices.
+TEST_P(LineLoopTest, LineLoopIndexBufferUpdatedBetweenDraws)
+{
+    // http://anglebug.com/42265165: Disable D3D11 SDK Layers warnings checks.
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLfloat positions[20]        = {};
+    static const GLushort degenerateIndices[] = {0, 0, 0, 0, 0, 0};
+    static const GLushort indices[]           = {0, 7, 6, 9, 8, 0};
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(degenerateIndices), degenerateIndices,
+                 GL_DYNAMIC_DRAW);
+
+    // Draw the degenerate line loop, which doesn't produce any pixels.
+    glClear(GL_COLOR_BUFFER_BIT);
+    glUseProgram(mProgram);
+    glEnableVertexAttribArray(mPositionLocation);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, positions);
+    glDrawElements(GL_LINE_LOOP, 4, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(sizeof(GLushort)));
+
+    // Update the indices and draw the same line loop again, twice.
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(indices), indices);
+    runTest(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+    runTest(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+}
+
 // Test that drawing elements between line loop arrays using the same array buffer does not result
 // in incorrect rendering.
 TEST_P(LineLoopTest, DrawTriangleElementsBetweenArrays)
@@ -1824,6 +1824,113 @@ void main()
     EXPECT_PIXEL_RECT_EQ(0, 0, kWidth, kHeight, GLColor::yellow);
 }
 
+// Test switching the fragment stage of a pipeline back and forth, with the sampler binding of one
+// of the programs changed while the other is in use.
+TEST_P(ProgramPipelineTest31, SwitchStagesWithSamplerBindingChange)
+{
+    ANGLE_SKIP_TEST_IF(!IsVulkan());
+
+    constexpr int kWidth  = 2;
+    constexpr int kHeight = 2;
+
+    const GLchar *vertString = R"(#version 310 es
+precision highp float;
+in vec2 a_position;
+out vec2 texCoord;
+void main()
+{
+    gl_Position = vec4(a_position, 0, 1);
+    texCoord = a_position * 0.5 + vec2(0.5);
+})";
+
+    const GLchar *textureFragString = R"(#version 310 es
+precision highp float;
+in vec2 texCoord;
+uniform sampler2D tex;
+out vec4 my_FragColor;
+void main()
+{
+    my_FragColor = texture(tex, texCoord);
+})";
+
+    const GLchar *colorFragString = R"(#version 310 es
+precision highp float;
+in vec2 texCoord;
+uniform vec4 color;
+out vec4 my_FragColor;
+void main()
+{
+    my_FragColor = color;
+})";
+
+    std::array<GLColor, kWidth * kHeight> redColor = {
+        {GLColor::red, GLColor::red, GLColor::red, GLColor::red}};
+    std::array<GLColor, kWidth * kHeight> greenColor = {
+        {GLColor::green, GLColor::green, GLColor::green, GLColor::green}};
+
+    // Create a red texture in texture unit 0 and a green texture in texture unit 1
+    GLTexture redTex;
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, redTex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kWidth, kHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 redColor.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    GLTexture greenTex;
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, greenTex);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kWidth, kHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                 greenColor.data());
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glActiveTexture(GL_TEXTURE0);
+    ASSERT_GL_NO_ERROR();
+
+    bindProgramPipeline(vertString, textureFragString);
+
+    GLuint colorFragProg = glCreateShaderProgramv(GL_FRAGMENT_SHADER, 1, &colorFragString);
+    ASSERT_NE(colorFragProg, 0u);
+
+    GLint texLocation = glGetUniformLocation(mFragProg, "tex");
+    ASSERT_NE(texLocation, -1);
+    GLint colorLocation = glGetUniformLocation(colorFragProg, "color");
+    ASSERT_NE(colorLocation, -1);
+    glProgramUniform1i(mFragProg, texLocation, 0);
+    glProgramUniform4f(colorFragProg, colorLocation, 0.0f, 0.0f, 1.0f, 1.0f);
+    ASSERT_GL_NO_ERROR();
+
+    // Draw red with the texture program
+    drawQuadWithPPO("a_position", 0.5f, 1.0f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_RECT_EQ(0, 0, kWidth, kHeight, GLColor::red);
+
+    // Draw blue with the color program
+    glUseProgramStages(mPipeline, GL_FRAGMENT_SHADER_BIT, colorFragProg);
+    drawQuadWithPPO("a_position", 0.5f, 1.0f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_RECT_EQ(0, 0, kWidth, kHeight, GLColor::blue);
+
+    // Make the texture program sample texture unit 1 while it's not used by the pipeline, then
+    // draw green with it
+    glProgramUniform1i(mFragProg, texLocation, 1);
+    glUseProgramStages(mPipeline, GL_FRAGMENT_SHADER_BIT, mFragProg);
+    drawQuadWithPPO("a_position", 0.5f, 1.0f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_RECT_EQ(0, 0, kWidth, kHeight, GLColor::green);
+
+    // Change the color of the color program, and switch to it and back again before drawing
+    // with it
+    glProgramUniform4f(colorFragProg, colorLocation, 1.0f, 1.0f, 0.0f, 1.0f);
+    glUseProgramStages(mPipeline, GL_FRAGMENT_SHADER_BIT, colorFragProg);
+    glUseProgramStages(mPipeline, GL_FRAGMENT_SHADER_BIT, mFragProg);
+    glUseProgramStages(mPipeline, GL_FRAGMENT_SHADER_BIT, colorFragProg);
+    drawQuadWithPPO("a_position", 0.5f, 1.0f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_RECT_EQ(0, 0, kWidth, kHeight, GLColor::yellow);
+
+    glDeleteProgram(colorFragProg);
+}
+
 // Verify that image uniforms can be used with separable programs
 TEST_P(ProgramPipelineTest31, ImageUniforms)
 {
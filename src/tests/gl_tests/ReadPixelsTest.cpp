@@ -443,6 +443,60 @@ TEST_P(ReadPixelsPBOTest, Snorm)
     }
 }
 
+// Test reverse row order read pixels to PBO of a float renderbuffer, which is copied row by row.
+TEST_P(ReadPixelsPBOTest, ReverseRowOrderFloat)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_EXT_color_buffer_float"));
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_pack_reverse_row_order"));
+
+    constexpr GLsizei kSize = 4;
+
+    GLRenderbuffer rbo;
+    glBindRenderbuffer(GL_RENDERBUFFER, rbo);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA32F, kSize, kSize);
+    ASSERT_GL_NO_ERROR();
+
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, rbo);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    // Clear every row to a different color.
+    glEnable(GL_SCISSOR_TEST);
+    for (GLsizei row = 0; row < kSize; ++row)
+    {
+        const GLfloat clearValue[4] = {static_cast<GLfloat>(row), 0.5f, 0.25f, 1.0f};
+        glScissor(0, row, kSize, 1);
+        glClearBufferfv(GL_COLOR, 0, clearValue);
+    }
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    constexpr GLsizei kBufferSize = kSize * kSize * 4 * sizeof(GLfloat);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPBO);
+    glBufferData(GL_PIXEL_PACK_BUFFER, kBufferSize, nullptr, GL_STATIC_DRAW);
+    glPixelStorei(GL_PACK_REVERSE_ROW_ORDER_ANGLE, GL_TRUE);
+    glReadPixels(0, 0, kSize, kSize, GL_RGBA, GL_FLOAT, 0);
+    ASSERT_GL_NO_ERROR();
+
+    const GLfloat *result = static_cast<const GLfloat *>(
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, kBufferSize, GL_MAP_READ_BIT));
+    ASSERT_NE(result, nullptr);
+    for (GLsizei row = 0; row < kSize; ++row)
+    {
+        for (GLsizei x = 0; x < kSize; ++x)
+        {
+            const GLfloat *pixel = result + (row * kSize + x) * 4;
+            EXPECT_EQ(pixel[0], static_cast<GLfloat>(kSize - 1 - row)) << row << " " << x;
+            EXPECT_EQ(pixel[1], 0.5f) << row << " " << x;
+            EXPECT_EQ(pixel[2], 0.25f) << row << " " << x;
+            EXPECT_EQ(pixel[3], 1.0f) << row << " " << x;
+        }
+    }
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test read pixel to PBO of an sRGB unorm renderbuffer
 TEST_P(ReadPixelsPBOTest, SrgbUnorm)
 {
@@ -1926,6 +1926,46 @@ TEST_P(RobustResourceInitTestES3, Texture2DArray)
     }
 }
 
+// Test that rendering to one layer of a 2D array texture leaves the other layers initialized.
+TEST_P(RobustResourceInitTestES3, Texture2DArrayRenderToLayer)
+{
+    ANGLE_SKIP_TEST_IF(!hasGLExtension());
+
+    constexpr int kLayers      = 4;
+    constexpr int kRenderLayer = 2;
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D_ARRAY, texture);
+    glTexStorage3D(GL_TEXTURE_2D_ARRAY, 1, GL_RGBA8, kWidth, kHeight, kLayers);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, kRenderLayer);
+    ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    // Draw to the middle of the layer only.
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glViewport(0, 0, kWidth, kHeight);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(kWidth / 4, kHeight / 4, kWidth / 2, kHeight / 2);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    for (int layer = 0; layer < kLayers; ++layer)
+    {
+        if (layer == kRenderLayer)
+        {
+            checkNonZeroPixels3D(&texture, kWidth / 4, kHeight / 4, kWidth / 2, kHeight / 2,
+                                 layer, GLColor::red);
+        }
+        else
+        {
+            checkNonZeroPixels3D(&texture, 0, 0, 0, 0, layer, GLColor::transparentBlack);
+        }
+    }
+}
+
 // Test that using TexStorage2D followed by CompressedSubImage works with robust init.
 // Taken from WebGL test conformance/extensions/webgl-compressed-texture-s3tc.
 TEST_P(RobustResourceInitTestES3, CompressedSubImage)
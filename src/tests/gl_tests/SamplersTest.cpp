@@ -169,9 +169,102 @@ void main()
     EXPECT_PIXEL_RECT_EQ(0, 0, kWidth, kHeight, GLColor::yellow);
 }
 
+// Tests that a texture sampled with different sampler states in turn keeps the right completeness
+// for each.
+TEST_P(SamplersTest, AlternateCompleteAndIncompleteSamplers)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+    glUseProgram(program);
+    GLint location = glGetUniformLocation(program, essl1_shaders::Texture2DUniform());
+    ASSERT_NE(location, -1);
+
+    // A texture without mips, which is only complete without mipmap filtering.
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+    GLSampler mipmapSampler;
+    glSamplerParameteri(mipmapSampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    GLSampler linearSampler;
+    glSamplerParameteri(linearSampler, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glBindSampler(1, mipmapSampler);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glBindSampler(2, linearSampler);
+    ASSERT_GL_NO_ERROR();
+
+    // Unit 0 uses the texture's own sampler state.
+    const GLColor kExpectedColors[] = {GLColor::red, GLColor::black, GLColor::red};
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        for (GLint unit = 0; unit < 3; ++unit)
+        {
+            glUniform1i(location, unit);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+            EXPECT_PIXEL_COLOR_EQ(0, 0, kExpectedColors[unit]);
+        }
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
+// Tests that changing the state of a sampler that was used unchanged for many draws takes effect.
+TEST_P(SamplersTest, ChangeSamplerAfterManyDrawsWithSameSampler)
+{
+    constexpr char kFS[] = R"(precision mediump float;
+uniform sampler2D tex;
+void main()
+{
+    gl_FragColor = texture2D(tex, vec2(1.25, 0.5));
+})";
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), kFS);
+    glUseProgram(program);
+
+    // Two textures with the texels swapped, so that alternating them keeps the sampler the same.
+    const GLColor kTexelsA[] = {GLColor::red, GLColor::green};
+    const GLColor kTexelsB[] = {GLColor::green, GLColor::red};
+    GLTexture textures[2];
+    for (int index = 0; index < 2; ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 2, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     index == 0 ? kTexelsA : kTexelsB);
+    }
+
+    GLSampler sampler;
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glBindSampler(0, sampler);
+    ASSERT_GL_NO_ERROR();
+
+    // With GL_REPEAT, the first texel is sampled.
+    constexpr int kIterations = 200;
+    for (int iteration = 0; iteration < kIterations; ++iteration)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[iteration % 2]);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, iteration % 2 == 0 ? GLColor::red : GLColor::green);
+    }
+
+    // With GL_CLAMP_TO_EDGE, the second texel is sampled.
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    for (int iteration = 0; iteration < 2; ++iteration)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[iteration % 2]);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, iteration % 2 == 0 ? GLColor::green : GLColor::red);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 // Samplers are only supported on ES3.
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SamplersTest);
-ANGLE_INSTANTIATE_TEST_ES3(SamplersTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(SamplersTest,
+                               ES3_VULKAN().enable(Feature::BakeStaticImmutableSamplers));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(SamplersTest31);
 ANGLE_INSTANTIATE_TEST_ES31(SamplersTest31);
@@ -605,6 +605,34 @@ TEST_P(TriangleFanDrawTest, DrawTriangleFanElements)
     verifyTriangles();
 }
 
+// Triangle fans test with an index buffer that is updated between draws of the same range.
+TEST_P(TriangleFanDrawTest, DrawTriangleFanElementsIndexBufferUpdatedBetweenDraws)
+{
+    const std::vector<GLubyte> degenerateIndices = {0, 0, 0, 0, 0};
+    const std::vector<GLubyte> indices           = {0, 1, 2, 3, 4};
+
+    GLBuffer indexBuffer;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, degenerateIndices.size(), degenerateIndices.data(),
+                 GL_DYNAMIC_DRAW);
+
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDrawElements(GL_TRIANGLE_FAN, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_BYTE, 0);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, 0, GLColor::red);
+
+    // Draw the same range after updating the indices, twice.
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indices.size(), indices.data());
+    for (int drawIndex = 0; drawIndex < 2; ++drawIndex)
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        glDrawElements(GL_TRIANGLE_FAN, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_BYTE,
+                       0);
+        EXPECT_GL_NO_ERROR();
+
+        verifyTriangles();
+    }
+}
+
 // Triangle fans test with primitive restart index at the middle.
 TEST_P(TriangleFanDrawTest, DrawTriangleFanPrimitiveRestartAtMiddle)
 {
@@ -2124,6 +2124,78 @@ TEST_P(Texture2DTest, SimpleUpload)
     EXPECT_EQ(pixelsRed, output);
 }
 
+// Test that deleting several textures in one call, right after they are drawn with, leaves the
+// remaining textures usable.
+TEST_P(Texture2DTest, DeleteManyTexturesAfterDraw)
+{
+    setUpProgram();
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+
+    constexpr GLsizei kTextureCount = 16;
+    GLuint textures[kTextureCount];
+    glGenTextures(kTextureCount, textures);
+    for (GLuint texture : textures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     &GLColor::red);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        drawQuad(mProgram, "position", 0.5f);
+    }
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glDeleteTextures(kTextureCount, textures);
+    ASSERT_GL_NO_ERROR();
+
+    glBindTexture(GL_TEXTURE_2D, mTexture2D);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::green);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that textures deleted and recreated with the same description every frame, as well as
+// textures redefined back and forth between two sizes, are sampled with their latest contents.
+// The Vulkan backend may recycle the images of the released textures.
+TEST_P(Texture2DTest, RecreateTexturesOfSameDescription)
+{
+    setUpProgram();
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+
+    const std::array<GLColor, 4> kColors = {GLColor::red, GLColor::green, GLColor::blue,
+                                            GLColor::yellow};
+
+    GLTexture redefinedTexture;
+    for (uint32_t frame = 0; frame < 8; ++frame)
+    {
+        const GLColor &color = kColors[frame % kColors.size()];
+
+        GLTexture texture;
+        glBindTexture(GL_TEXTURE_2D, texture);
+        std::vector<GLColor> pixels(4 * 4, color);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        drawQuad(mProgram, "position", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, color);
+
+        // Alternate the size of the other texture, so its image is released every frame.
+        const GLsizei size = (frame % 2) == 0 ? 2 : 4;
+        glBindTexture(GL_TEXTURE_2D, redefinedTexture);
+        pixels.assign(size * size, kColors[(frame + 1) % kColors.size()]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, size, size, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     pixels.data());
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        drawQuad(mProgram, "position", 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, kColors[(frame + 1) % kColors.size()]);
+
+        swapBuffers();
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test that interleaved superseded updates work as expected
 TEST_P(Texture2DTest, InterleavedSupersedingTextureUpdates)
 {
@@ -7995,6 +8067,148 @@ TEST_P(Texture2DTestES3, PixelUnpackStateTexSubImage)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test that glTexSubImage2D from client memory respects GL_UNPACK_ROW_LENGTH and
+// GL_UNPACK_ALIGNMENT when the texture is idle, in which case the data may be copied to it directly
+// on the host.
+TEST_P(Texture2DTestES3, TexSubImagePaddedRowsWhileIdle)
+{
+    constexpr GLsizei kSize      = 16;
+    constexpr GLsizei kSubWidth  = 5;
+    constexpr GLsizei kSubHeight = 7;
+    constexpr GLint kRowLength   = 11;
+
+    GLTexture tex;
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+
+    std::vector<GLColor> initialData(kSize * kSize, GLColor::red);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE,
+                    initialData.data());
+
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    // Make sure the texture is no longer in use by the GPU.
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    glFinish();
+
+    // Upload with padded rows; only the first kSubWidth texels of each row are used.
+    std::vector<GLColor> subData(kRowLength * kSubHeight, GLColor::blue);
+    for (GLsizei y = 0; y < kSubHeight; ++y)
+    {
+        for (GLsizei x = 0; x < kSubWidth; ++x)
+        {
+            subData[y * kRowLength + x] = GLColor::green;
+        }
+    }
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, kRowLength);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 2, 3, kSubWidth, kSubHeight, GL_RGBA, GL_UNSIGNED_BYTE,
+                    subData.data());
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(2, 3, kSubWidth, kSubHeight, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(1, 3, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(2 + kSubWidth, 3, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(2, 3 + kSubHeight, GLColor::red);
+    glFinish();
+
+    // Upload single-channel data whose rows are padded to GL_UNPACK_ALIGNMENT.
+    GLTexture texR8;
+    glBindTexture(GL_TEXTURE_2D, texR8);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_R8, kSize, kSize);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texR8, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    glClearColor(0, 0, 0, 0);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor(0, 0, 0, 255));
+    glFinish();
+
+    constexpr GLsizei kAlignedRowBytes = 8;
+    std::vector<GLubyte> r8Data(kAlignedRowBytes * kSubHeight, 0x10);
+    for (GLsizei y = 0; y < kSubHeight; ++y)
+    {
+        for (GLsizei x = 0; x < kSubWidth; ++x)
+        {
+            r8Data[y * kAlignedRowBytes + x] = 0xFF;
+        }
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, kAlignedRowBytes);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSubWidth, kSubHeight, GL_RED, GL_UNSIGNED_BYTE,
+                    r8Data.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, kSubWidth, kSubHeight, GLColor(255, 0, 0, 255));
+    EXPECT_PIXEL_COLOR_EQ(kSubWidth, 0, GLColor(0, 0, 0, 255));
+}
+
+// Test that many small glTexSubImage2D calls to the same texture, some of which overwrite earlier
+// ones, are applied in order.  This mimics a glyph atlas being filled.
+TEST_P(Texture2DTestES3, ManySmallTexSubImagesWithOverlap)
+{
+    constexpr GLsizei kSize      = 64;
+    constexpr GLsizei kTileSize  = 4;
+    constexpr GLsizei kTileCount = kSize / kTileSize;
+
+    GLTexture tex;
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+
+    const std::vector<GLColor> redTile(kTileSize * kTileSize, GLColor::red);
+    const std::vector<GLColor> greenTile(kTileSize * kTileSize, GLColor::green);
+    const std::vector<GLColor> blueTile(kTileSize * kTileSize, GLColor::blue);
+
+    // Fill every tile with red, then overwrite every other tile with green, and finally overwrite
+    // a 2x2 tile block straddling those with blue.
+    for (GLsizei y = 0; y < kTileCount; ++y)
+    {
+        for (GLsizei x = 0; x < kTileCount; ++x)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x * kTileSize, y * kTileSize, kTileSize, kTileSize,
+                            GL_RGBA, GL_UNSIGNED_BYTE, redTile.data());
+        }
+    }
+    for (GLsizei y = 0; y < kTileCount; ++y)
+    {
+        for (GLsizei x = (y % 2); x < kTileCount; x += 2)
+        {
+            glTexSubImage2D(GL_TEXTURE_2D, 0, x * kTileSize, y * kTileSize, kTileSize, kTileSize,
+                            GL_RGBA, GL_UNSIGNED_BYTE, greenTile.data());
+        }
+    }
+    glTexSubImage2D(GL_TEXTURE_2D, 0, kTileSize / 2, kTileSize / 2, kTileSize, kTileSize, GL_RGBA,
+                    GL_UNSIGNED_BYTE, blueTile.data());
+    ASSERT_GL_NO_ERROR();
+
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    for (GLsizei y = 0; y < kTileCount; ++y)
+    {
+        for (GLsizei x = 0; x < kTileCount; ++x)
+        {
+            // The tiles partially covered by blue are checked separately.
+            if (x < 2 && y < 2)
+            {
+                continue;
+            }
+            const GLColor expected = (x + y) % 2 == 0 ? GLColor::green : GLColor::red;
+            EXPECT_PIXEL_COLOR_EQ(x * kTileSize + kTileSize - 1, y * kTileSize + kTileSize - 1,
+                                  expected);
+        }
+    }
+    EXPECT_PIXEL_RECT_EQ(kTileSize / 2, kTileSize / 2, kTileSize, kTileSize, GLColor::blue);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    EXPECT_PIXEL_COLOR_EQ(kTileSize * 2 - 1, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(0, kTileSize * 2 - 1, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(kTileSize * 2 - 1, kTileSize * 2 - 1, GLColor::green);
+}
+
 // Test for http://anglebug.com/42265405.
 TEST_P(Texture2DTestES3, TextureRGBUpdateWithPBO)
 {
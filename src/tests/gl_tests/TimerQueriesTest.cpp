@@ -561,6 +561,38 @@ TEST_P(TimerQueriesTestES3, TimestampGetInteger64)
     EXPECT_LT(result1, result2);
 }
 
+// Tests that glGetInteger64v(GL_TIMESTAMP) uses the same clock as timestamp queries.
+TEST_P(TimerQueriesTestES3, TimestampGetInteger64MatchesQueryCounter)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_EXT_disjoint_timer_query"));
+    // http://anglebug.com/40096654
+    ANGLE_SKIP_TEST_IF(IsAndroid());
+
+    GLint queryTimestampBits = 0;
+    glGetQueryivEXT(GL_TIMESTAMP_EXT, GL_QUERY_COUNTER_BITS_EXT, &queryTimestampBits);
+    ASSERT_GL_NO_ERROR();
+    ANGLE_SKIP_TEST_IF(!queryTimestampBits);
+
+    GLint64 before = 0;
+    glGetInteger64v(GL_TIMESTAMP_EXT, &before);
+
+    GLQuery query;
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.8f);
+    glQueryCounterEXT(query, GL_TIMESTAMP_EXT);
+    ASSERT_GL_NO_ERROR();
+
+    GLuint64 queryResult = 0;
+    getQueryResult(query, &queryResult);
+
+    GLint64 after = 0;
+    glGetInteger64v(GL_TIMESTAMP_EXT, &after);
+    ASSERT_GL_NO_ERROR();
+
+    std::cout << "Timestamps: " << before << " " << queryResult << " " << after << std::endl;
+    EXPECT_LE(static_cast<GLuint64>(before), queryResult);
+    EXPECT_LE(queryResult, static_cast<GLuint64>(after));
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND(TimerstampQueriesTest,
                                ES3_D3D11().disable(Feature::EnableTimestampQueries),
                                ES3_D3D11().enable(Feature::EnableTimestampQueries));
@@ -570,4 +602,5 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TimestampQueriesTest);
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(TimerQueriesTest);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TimerQueriesTestES3);
-ANGLE_INSTANTIATE_TEST_ES3(TimerQueriesTestES3);
+ANGLE_INSTANTIATE_TEST_ES3_AND(TimerQueriesTestES3,
+                               ES3_VULKAN().disable(Feature::SupportsCalibratedTimestamps));
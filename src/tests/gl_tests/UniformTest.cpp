@@ -451,6 +451,35 @@ TEST_P(BasicUniformUsageTest, Vec4MultipleDraws)
     EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::red);
 }
 
+// Tests that setting a uniform to the value it already has, which backends may skip, does not
+// affect later updates to it.
+TEST_P(BasicUniformUsageTest, Vec4RedundantUpdates)
+{
+    glUseProgram(mProgram);
+
+    glUniform1f(mUniformFLocation, 0.0f);
+    glUniform1i(mUniformILocation, 0);
+    glUniform4f(mUniformVec4Location, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // Set the same values again, then draw red and back to green without a flush in between.
+    glUniform1f(mUniformFLocation, 0.0f);
+    glUniform4f(mUniformVec4Location, 0.0f, 1.0f, 0.0f, 1.0f);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+
+    glUniform4f(mUniformVec4Location, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+
+    glUniform4f(mUniformVec4Location, 0.0f, 1.0f, 0.0f, 1.0f);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f, /*positionAttribXYScale=*/0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+}
+
 // Named differently to instantiate on different backends.
 using SimpleUniformUsageTest = SimpleUniformTest;
 
@@ -1524,6 +1553,81 @@ TEST_P(UniformTestES31, UniformLocationInFragmentShader)
     EXPECT_EQ(12, glGetUniformLocation(program, "tex2D"));
 }
 
+// Test the name forms accepted by glGetUniformLocation and glGetUniformIndices: base names of
+// arrays, array elements, struct members and arrays of arrays, and the subscripts that are not
+// accepted.
+TEST_P(UniformTestES31, LocationAndIndexNameForms)
+{
+    constexpr char kFS[] = R"(#version 310 es
+precision mediump float;
+struct S
+{
+    vec4 a;
+    float b[2];
+};
+uniform S s[2];
+uniform vec4 v[3];
+uniform float f;
+uniform vec4 aoa[2][2];
+out vec4 color;
+void main()
+{
+    color = s[0].a + s[1].a + vec4(s[0].b[0] + s[0].b[1] + s[1].b[0] + s[1].b[1]) + v[0] + v[1] +
+            v[2] + vec4(f) + aoa[0][0] + aoa[0][1] + aoa[1][0] + aoa[1][1];
+})";
+
+    ANGLE_GL_PROGRAM(program, essl31_shaders::vs::Simple(), kFS);
+
+    const GLint v0 = glGetUniformLocation(program, "v[0]");
+    EXPECT_NE(-1, v0);
+    EXPECT_EQ(v0, glGetUniformLocation(program, "v"));
+    EXPECT_NE(-1, glGetUniformLocation(program, "v[2]"));
+    EXPECT_NE(v0, glGetUniformLocation(program, "v[2]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "v[3]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "v[01]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "v[+1]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "v[ 1]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "v[0][0]"));
+
+    const GLint s1b0 = glGetUniformLocation(program, "s[1].b[0]");
+    EXPECT_NE(-1, s1b0);
+    EXPECT_EQ(s1b0, glGetUniformLocation(program, "s[1].b"));
+    EXPECT_NE(-1, glGetUniformLocation(program, "s[1].b[1]"));
+    EXPECT_NE(s1b0, glGetUniformLocation(program, "s[1].b[1]"));
+    EXPECT_NE(-1, glGetUniformLocation(program, "s[0].a"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "s[0].a[0]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "s[1]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "s[2].a"));
+
+    EXPECT_NE(-1, glGetUniformLocation(program, "f"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "f[0]"));
+
+    const GLint aoa10 = glGetUniformLocation(program, "aoa[1][0]");
+    EXPECT_NE(-1, aoa10);
+    EXPECT_EQ(aoa10, glGetUniformLocation(program, "aoa[1]"));
+    EXPECT_NE(-1, glGetUniformLocation(program, "aoa[1][1]"));
+    EXPECT_EQ(-1, glGetUniformLocation(program, "aoa[1][2]"));
+
+    // Only the names of active resources are accepted by glGetUniformIndices, with or without the
+    // final [0] of arrays.
+    const GLchar *names[] = {"v", "v[0]", "v[1]", "s[1].b", "s[1].b[0]", "f", "f[0]", "aoa[1]"};
+    GLuint indices[ArraySize(names)];
+    glGetUniformIndices(program, static_cast<GLsizei>(ArraySize(names)), names, indices);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_NE(GL_INVALID_INDEX, indices[0]);
+    EXPECT_EQ(indices[0], indices[1]);
+    EXPECT_EQ(GL_INVALID_INDEX, indices[2]);
+    EXPECT_NE(GL_INVALID_INDEX, indices[3]);
+    EXPECT_EQ(indices[3], indices[4]);
+    EXPECT_NE(GL_INVALID_INDEX, indices[5]);
+    EXPECT_EQ(GL_INVALID_INDEX, indices[6]);
+    EXPECT_NE(GL_INVALID_INDEX, indices[7]);
+
+    EXPECT_EQ(indices[0], glGetProgramResourceIndex(program, GL_UNIFORM, "v"));
+    EXPECT_EQ(v0, glGetProgramResourceLocation(program, GL_UNIFORM, "v"));
+}
+
 // Test two unused uniforms that have the same location.
 // ESSL 3.10.4 section 4.4.3: "No two default-block uniform variables in the program can have the
 // same location, even if they are unused, otherwise a compiler or linker error will be generated."
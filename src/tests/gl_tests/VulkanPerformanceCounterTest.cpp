@@ -457,6 +457,10 @@ class VulkanPerformanceCounterTest_SingleBuffer : public VulkanPerformanceCounte
     }
 };
 
+// Pipelines may be substituted with compatible ones in this mode, which would fail other tests.
+class VulkanPerformanceCounterTest_AsyncPipeline : public VulkanPerformanceCounterTest
+{};
+
 class VulkanPerformanceCounterTest_Prerotation : public VulkanPerformanceCounterTest
 {
   protected:
@@ -1740,6 +1744,64 @@ TEST_P(VulkanPerformanceCounterTest_ES31, ResolveToFBOWithInvalidate)
     ASSERT_GL_NO_ERROR();
 }
 
+// Test resolving a multisampled texture with a blit that is larger than the render area of the
+// render pass that drew to it.  The render area is resolved in the render pass, and the rest with
+// resolve commands.
+TEST_P(VulkanPerformanceCounterTest_ES31, ResolveToFBOLargerThanRenderArea)
+{
+    constexpr int kSize = 16;
+
+    GLTexture msaaTexture;
+    glBindTexture(GL_TEXTURE_2D_MULTISAMPLE, msaaTexture);
+    glTexStorage2DMultisample(GL_TEXTURE_2D_MULTISAMPLE, 4, GL_RGBA8, kSize, kSize, GL_FALSE);
+
+    GLFramebuffer msaaFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, msaaFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D_MULTISAMPLE,
+                           msaaTexture, 0);
+    EXPECT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    // Fill the whole image in a separate render pass.
+    glClearColor(0, 0, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glFinish();
+
+    GLTexture resolveTexture;
+    glBindTexture(GL_TEXTURE_2D, resolveTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+
+    GLFramebuffer resolveFBO;
+    glBindFramebuffer(GL_FRAMEBUFFER, resolveFBO);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, resolveTexture, 0);
+    EXPECT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_FRAMEBUFFER));
+
+    angle::VulkanPerfCounters expected;
+    expected.colorAttachmentResolves = getPerfCounters().colorAttachmentResolves + 1;
+
+    // Draw to the middle of the image only, so the render area is limited to the scissor.
+    glBindFramebuffer(GL_FRAMEBUFFER, msaaFBO);
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(kSize / 4, kSize / 4, kSize / 2, kSize / 2);
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    glDisable(GL_SCISSOR_TEST);
+
+    // Resolve the whole image.
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, resolveFBO);
+    glBlitFramebuffer(0, 0, kSize, kSize, 0, 0, kSize, kSize, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, resolveFBO);
+    EXPECT_PIXEL_RECT_EQ(kSize / 4, kSize / 4, kSize / 2, kSize / 2, GLColor::red);
+    EXPECT_PIXEL_RECT_EQ(0, 0, kSize, kSize / 4, GLColor::blue);
+    EXPECT_PIXEL_RECT_EQ(0, kSize * 3 / 4, kSize, kSize / 4, GLColor::blue);
+    EXPECT_PIXEL_RECT_EQ(0, kSize / 4, kSize / 4, kSize / 2, GLColor::blue);
+    EXPECT_PIXEL_RECT_EQ(kSize * 3 / 4, kSize / 4, kSize / 4, kSize / 2, GLColor::blue);
+
+    EXPECT_EQ(expected.colorAttachmentResolves, getPerfCounters().colorAttachmentResolves);
+    EXPECT_GT(getPerfCounters().resolveImageCommands, 0u);
+}
+
 // Test resolving different attachments of an FBO to separate FBOs then invalidate
 TEST_P(VulkanPerformanceCounterTest_ES31, MultisampleResolveBothAttachments)
 {
@@ -6520,6 +6582,62 @@ void main()
     EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
 }
 
+// Test that back-to-back dispatches that only change uniforms are recorded in the same command
+// buffer.
+TEST_P(VulkanPerformanceCounterTest_ES31, BackToBackDispatchesDontFlushCommands)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    constexpr char kCS[] = R"(#version 310 es
+layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+uniform uint index;
+layout(std430, binding=0) buffer buf {
+    uint outData[4];
+};
+
+void main()
+{
+    outData[index] = index + 1u;
+})";
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kCS);
+    glUseProgram(program);
+    GLint indexLocation = glGetUniformLocation(program, "index");
+    ASSERT_NE(-1, indexLocation);
+
+    constexpr GLuint kInitData[4] = {};
+    GLBuffer ssbo;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, ssbo);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, sizeof(kInitData), kInitData, GL_STATIC_DRAW);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, ssbo);
+
+    glUniform1ui(indexLocation, 0);
+    glDispatchCompute(1, 1, 1);
+    ASSERT_GL_NO_ERROR();
+
+    uint64_t expectedFlushCount = getPerfCounters().flushedOutsideRenderPassCommandBuffers;
+
+    for (GLuint index = 1; index < 4; ++index)
+    {
+        glUniform1ui(indexLocation, index);
+        glDispatchCompute(1, 1, 1);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedFlushCount, getPerfCounters().flushedOutsideRenderPassCommandBuffers);
+
+    glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+    const GLuint *ptr = reinterpret_cast<const GLuint *>(
+        glMapBufferRange(GL_SHADER_STORAGE_BUFFER, 0, sizeof(kInitData), GL_MAP_READ_BIT));
+    ASSERT_NE(nullptr, ptr);
+    for (GLuint index = 0; index < 4; ++index)
+    {
+        EXPECT_EQ(index + 1, ptr[index]);
+    }
+    glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Test that one texture sampled by fragment shader, compute shader and fragment
 // shader sequentlly.
 TEST_P(VulkanPerformanceCounterTest_ES31, TextureSampleByDrawDispatchDraw)
@@ -8306,6 +8424,53 @@ TEST_P(VulkanPerformanceCounterTest, AsyncMonolithicPipelineCreation)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
 }
 
+// Verify that with asyncGraphicsPipelineCreationOnCacheMiss, pipeline cache misses are handled by
+// using a compatible pipeline while the actual pipeline is created.
+TEST_P(VulkanPerformanceCounterTest_AsyncPipeline, AsyncPipelineCreationOnCacheMiss)
+{
+    ANGLE_SKIP_TEST_IF(!isFeatureEnabled(Feature::AsyncGraphicsPipelineCreationOnCacheMiss) ||
+                       isFeatureEnabled(Feature::SupportsGraphicsPipelineLibrary));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLoc = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(colorLoc, -1);
+
+    // The first pipeline of the program has nothing to fall back to, so the draw call waits for
+    // it.
+    const uint64_t expectedWaits = getPerfCounters().pendingGraphicsPipelineWaits + 1;
+    glUniform4f(colorLoc, 1.0f, 0.0f, 0.0f, 1.0f);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_EQ(getPerfCounters().pendingGraphicsPipelineWaits, expectedWaits);
+
+    // Enabling blend requires a new pipeline.  Until it's created, the previous pipeline is used.
+    // With a cleared framebuffer, the results are identical.
+    const uint64_t expectedFallbacks = getPerfCounters().pendingGraphicsPipelineFallbacks + 1;
+    const uint64_t expectedMonolithicPipelineCreationCount =
+        getPerfCounters().monolithicPipelineCreation + 1;
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glUniform4f(colorLoc, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    uint32_t drawCount                 = 0;
+    constexpr uint32_t kDrawCountLimit = 1000;
+    do
+    {
+        glClear(GL_COLOR_BUFFER_BIT);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        ++drawCount;
+    } while (getPerfCounters().monolithicPipelineCreation <
+                 expectedMonolithicPipelineCreationCount &&
+             drawCount < kDrawCountLimit);
+
+    EXPECT_GE(getPerfCounters().pendingGraphicsPipelineFallbacks, expectedFallbacks);
+    EXPECT_EQ(getPerfCounters().pendingGraphicsPipelineWaits, expectedWaits);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Verify that changing framebuffer and back doesn't break the render pass.
 TEST_P(VulkanPerformanceCounterTest, FBOChangeAndBackDoesNotBreakRenderPass)
 {
@@ -8357,6 +8522,36 @@ TEST_P(VulkanPerformanceCounterTest, FBOChangeAndClearAndBackDoesNotBreakRenderP
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
 }
 
+// Verify that drawing to a framebuffer, then to another one and then to the first one again is
+// counted as a render pass merge candidate.
+TEST_P(VulkanPerformanceCounterTest, FBOChangeAndDrawAndBackCountsRenderPassMergeCandidate)
+{
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 16, 16);
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    ANGLE_GL_PROGRAM(drawRed, essl3_shaders::vs::Simple(), essl3_shaders::fs::Red());
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    drawQuad(drawRed, essl1_shaders::PositionAttrib(), 0);
+
+    uint64_t expectedMergeCandidates = getPerfCounters().renderPassMergeCandidates + 1;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    drawQuad(drawRed, essl1_shaders::PositionAttrib(), 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    drawQuad(drawRed, essl1_shaders::PositionAttrib(), 0);
+
+    EXPECT_EQ(getPerfCounters().renderPassMergeCandidates, expectedMergeCandidates);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+}
+
 // This is test for optimization in vulkan backend. efootball_pes_2021 usage shows this usage
 // pattern and we expect implementation to reuse the storage for performance.
 TEST_P(VulkanPerformanceCounterTest,
@@ -8482,4 +8677,13 @@ ANGLE_INSTANTIATE_TEST(
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_SingleBuffer);
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_SingleBuffer, ES3_VULKAN());
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_AsyncPipeline);
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_AsyncPipeline,
+                       ES3_VULKAN()
+                           .disable(Feature::SupportsGraphicsPipelineLibrary)
+                           .enable(Feature::AsyncGraphicsPipelineCreationOnCacheMiss),
+                       ES3_VULKAN_SWIFTSHADER()
+                           .disable(Feature::SupportsGraphicsPipelineLibrary)
+                           .enable(Feature::AsyncGraphicsPipelineCreationOnCacheMiss));
+
 }  // anonymous namespace
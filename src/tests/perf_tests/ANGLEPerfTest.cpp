@@ -27,10 +27,14 @@
 #include "util/shader_utils.h"
 #include "util/test_utils.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <numeric>
 #include <sstream>
 #include <string>
@@ -68,6 +72,12 @@ constexpr TraceCategory gTraceCategories[2] = {
     {1, "gpu.angle.gpu"},
 };
 
+// Trace events are also recorded when only the frame breakdown is written.
+bool TraceEventsEnabled()
+{
+    return gEnableTrace || gFrameBreakdown;
+}
+
 void EmptyPlatformMethod(PlatformMethods *, const char *) {}
 
 void CustomLogError(PlatformMethods *platform, const char *errorMessage)
@@ -88,7 +98,7 @@ TraceEventHandle AddPerfTraceEvent(PlatformMethods *platform,
                                    const unsigned long long *argValues,
                                    unsigned char flags)
 {
-    if (!gEnableTrace)
+    if (!TraceEventsEnabled())
         return 0;
 
     // Discover the category name based on categoryEnabledFlag.  This flag comes from the first
@@ -111,7 +121,7 @@ TraceEventHandle AddPerfTraceEvent(PlatformMethods *platform,
 const unsigned char *GetPerfTraceCategoryEnabled(PlatformMethods *platform,
                                                  const char *categoryName)
 {
-    if (gEnableTrace)
+    if (TraceEventsEnabled())
     {
         for (const TraceCategory &category : gTraceCategories)
         {
@@ -201,6 +211,282 @@ void DumpTraceEventsToJSONFile(const std::vector<TraceEvent> &traceEvents,
     }
 }
 
+// The ANGLE subsystems the CPU time of a frame is split into.  Trace events are assigned to the
+// first subsystem whose pattern their name contains, or else to the subsystem of the event they
+// are nested in.  The time spent in the frame outside any ANGLE event (in the application,
+// validation, and state synchronization, which are not traced) is counted as the frontend's.
+enum class FrameSubsystem
+{
+    Frontend,
+    GarbageCollection,
+    Wait,
+    Submission,
+    CommandRecording,
+    OtherBackend,
+
+    EnumCount,
+};
+
+constexpr const char *kFrameSubsystemMetrics[] = {
+    "cpu_frontend_ms",   "cpu_garbage_collection_ms", "cpu_wait_ms",
+    "cpu_submission_ms", "cpu_command_recording_ms",  "cpu_other_backend_ms",
+};
+static_assert(ArraySize(kFrameSubsystemMetrics) ==
+                  static_cast<size_t>(FrameSubsystem::EnumCount),
+              "Missing subsystem metric");
+
+struct FrameSubsystemPattern
+{
+    const char *pattern;
+    FrameSubsystem subsystem;
+};
+
+constexpr FrameSubsystemPattern kFrameSubsystemPatterns[] = {
+    {"Garbage", FrameSubsystem::GarbageCollection},
+    {"releaseFinishedCommands", FrameSubsystem::GarbageCollection},
+    {"freeCollectedBuffers", FrameSubsystem::GarbageCollection},
+    {"recycle", FrameSubsystem::GarbageCollection},
+    {"WaitSemaphores", FrameSubsystem::Submission},
+    {"Wait", FrameSubsystem::Wait},
+    {"wait", FrameSubsystem::Wait},
+    {"finish", FrameSubsystem::Wait},
+    {"throttleCPU", FrameSubsystem::Wait},
+    {"acquireNextSwapchainImage", FrameSubsystem::Wait},
+    {"Submit", FrameSubsystem::Submission},
+    {"submit", FrameSubsystem::Submission},
+    {"present", FrameSubsystem::Submission},
+    {"swap", FrameSubsystem::Submission},
+    {"flush", FrameSubsystem::CommandRecording},
+    {"CommandBuffer", FrameSubsystem::CommandRecording},
+    {"CommandEncoder", FrameSubsystem::CommandRecording},
+};
+
+constexpr char kStepEventName[] = "step";
+
+bool IsHarnessEvent(const char *name)
+{
+    return strcmp(name, kStepEventName) == 0 || strncmp(name, "Frame ", 6) == 0;
+}
+
+FrameSubsystem GetFrameSubsystem(const char *name, const FrameSubsystem *parent)
+{
+    if (IsHarnessEvent(name))
+    {
+        return FrameSubsystem::Frontend;
+    }
+    for (const FrameSubsystemPattern &pattern : kFrameSubsystemPatterns)
+    {
+        if (strstr(name, pattern.pattern) != nullptr)
+        {
+            return pattern.subsystem;
+        }
+    }
+    return parent != nullptr && *parent != FrameSubsystem::Frontend
+               ? *parent
+               : FrameSubsystem::OtherBackend;
+}
+
+struct FrameBreakdown
+{
+    double startTime = 0;
+    double endTime   = 0;
+    std::array<double, static_cast<size_t>(FrameSubsystem::EnumCount)> cpuTimes = {};
+    std::vector<double> renderPassGpuTimes;
+    double dispatchGpuTime = 0;
+};
+
+// Returns the frame |timestamp| falls in, or nullptr if it is outside all frames.
+FrameBreakdown *FindFrame(std::vector<FrameBreakdown> *frames, double timestamp)
+{
+    auto iter = std::lower_bound(
+        frames->begin(), frames->end(), timestamp,
+        [](const FrameBreakdown &frame, double time) { return frame.endTime < time; });
+    if (iter == frames->end() || iter->startTime > timestamp)
+    {
+        return nullptr;
+    }
+    return &*iter;
+}
+
+// Frames are delimited by the harness' "step" events, starting from |firstEvent| so the warmup
+// steps are left out.  GPU events are assigned to the frame the GPU started them in, which is
+// usually later than the frame that recorded them.
+std::vector<FrameBreakdown> ComputeFrameBreakdowns(const std::vector<TraceEvent> &traceEvents,
+                                                   size_t firstEvent)
+{
+    std::vector<FrameBreakdown> frames;
+    for (size_t index = firstEvent; index < traceEvents.size(); ++index)
+    {
+        const TraceEvent &event = traceEvents[index];
+        if (strcmp(event.name, kStepEventName) != 0)
+        {
+            continue;
+        }
+        if (event.phase == TRACE_EVENT_PHASE_BEGIN)
+        {
+            frames.emplace_back();
+            frames.back().startTime = event.timestamp;
+            frames.back().endTime   = std::numeric_limits<double>::max();
+        }
+        else if (event.phase == TRACE_EVENT_PHASE_END && !frames.empty())
+        {
+            frames.back().endTime = event.timestamp;
+        }
+    }
+    if (!frames.empty() && frames.back().endTime == std::numeric_limits<double>::max())
+    {
+        frames.pop_back();
+    }
+
+    struct OpenSlice
+    {
+        FrameSubsystem subsystem;
+        double startTime;
+        double childTime;
+    };
+    std::map<uint32_t, std::vector<OpenSlice>> cpuSlices;
+    std::map<std::string, double> gpuSliceStartTimes;
+
+    for (const TraceEvent &event : traceEvents)
+    {
+        if (event.phase != TRACE_EVENT_PHASE_BEGIN && event.phase != TRACE_EVENT_PHASE_END)
+        {
+            continue;
+        }
+
+        if (strcmp(event.categoryName, gTraceCategories[1].name) == 0)
+        {
+            if (event.phase == TRACE_EVENT_PHASE_BEGIN)
+            {
+                gpuSliceStartTimes[event.name] = event.timestamp;
+                continue;
+            }
+
+            auto startIter = gpuSliceStartTimes.find(event.name);
+            if (startIter == gpuSliceStartTimes.end())
+            {
+                continue;
+            }
+            const double startTime = startIter->second;
+            gpuSliceStartTimes.erase(startIter);
+
+            // The primary command buffer events contain all the others.
+            FrameBreakdown *frame = FindFrame(&frames, startTime);
+            if (frame == nullptr || strncmp(event.name, "Primary ", 8) == 0)
+            {
+                continue;
+            }
+            const double duration = event.timestamp - startTime;
+            if (strncmp(event.name, "RP ", 3) == 0 || strncmp(event.name, "FBO ", 4) == 0)
+            {
+                frame->renderPassGpuTimes.push_back(duration);
+            }
+            else
+            {
+                frame->dispatchGpuTime += duration;
+            }
+            continue;
+        }
+
+        std::vector<OpenSlice> &openSlices = cpuSlices[event.tid];
+        if (event.phase == TRACE_EVENT_PHASE_BEGIN)
+        {
+            const FrameSubsystem *parent =
+                openSlices.empty() ? nullptr : &openSlices.back().subsystem;
+            openSlices.push_back({GetFrameSubsystem(event.name, parent), event.timestamp, 0});
+            continue;
+        }
+
+        if (openSlices.empty())
+        {
+            continue;
+        }
+        const OpenSlice slice = openSlices.back();
+        openSlices.pop_back();
+
+        const double duration = event.timestamp - slice.startTime;
+        if (!openSlices.empty())
+        {
+            openSlices.back().childTime += duration;
+        }
+
+        FrameBreakdown *frame = FindFrame(&frames, event.timestamp);
+        if (frame != nullptr)
+        {
+            frame->cpuTimes[static_cast<size_t>(slice.subsystem)] += duration - slice.childTime;
+        }
+    }
+
+    return frames;
+}
+
+// Writes one array per metric, with a value per frame, so runs of different builds can be
+// compared metric by metric.  See src/tests/compare_frame_breakdowns.py.
+void DumpFrameBreakdownToJSONFile(const std::vector<FrameBreakdown> &frames,
+                                  const std::string &testName,
+                                  const std::string &outputFileName)
+{
+    js::Document doc(js::kObjectType);
+    js::Document::AllocatorType &allocator = doc.GetAllocator();
+
+    auto addMetric = [&](js::Value *metrics, const char *name, auto getValue) {
+        js::Value values(js::kArrayType);
+        for (const FrameBreakdown &frame : frames)
+        {
+            values.PushBack(getValue(frame), allocator);
+        }
+        metrics->AddMember(js::StringRef(name), values, allocator);
+    };
+
+    js::Value metrics(js::kObjectType);
+    addMetric(&metrics, "cpu_frame_time_ms", [](const FrameBreakdown &frame) {
+        return (frame.endTime - frame.startTime) * kMilliSecondsPerSecond;
+    });
+    for (size_t subsystem = 0; subsystem < ArraySize(kFrameSubsystemMetrics); ++subsystem)
+    {
+        addMetric(&metrics, kFrameSubsystemMetrics[subsystem],
+                  [subsystem](const FrameBreakdown &frame) {
+                      return frame.cpuTimes[subsystem] * kMilliSecondsPerSecond;
+                  });
+    }
+    addMetric(&metrics, "gpu_render_pass_ms", [](const FrameBreakdown &frame) {
+        return std::accumulate(frame.renderPassGpuTimes.begin(), frame.renderPassGpuTimes.end(),
+                               0.0) *
+               kMilliSecondsPerSecond;
+    });
+    addMetric(&metrics, "gpu_render_pass_count", [](const FrameBreakdown &frame) {
+        return static_cast<double>(frame.renderPassGpuTimes.size());
+    });
+    addMetric(&metrics, "gpu_internal_dispatch_ms", [](const FrameBreakdown &frame) {
+        return frame.dispatchGpuTime * kMilliSecondsPerSecond;
+    });
+
+    js::Value renderPasses(js::kArrayType);
+    for (const FrameBreakdown &frame : frames)
+    {
+        js::Value frameRenderPasses(js::kArrayType);
+        for (double gpuTime : frame.renderPassGpuTimes)
+        {
+            frameRenderPasses.PushBack(gpuTime * kMilliSecondsPerSecond, allocator);
+        }
+        renderPasses.PushBack(frameRenderPasses, allocator);
+    }
+
+    doc.AddMember("test", js::Value(testName.c_str(), allocator), allocator);
+    doc.AddMember("frameCount", static_cast<uint64_t>(frames.size()), allocator);
+    doc.AddMember("metrics", metrics, allocator);
+    doc.AddMember("renderPassGpuTimesMs", renderPasses, allocator);
+
+    if (WriteJsonFile(outputFileName, &doc))
+    {
+        printf("Wrote frame breakdown to %s\n", outputFileName.c_str());
+    }
+    else
+    {
+        printf("Error writing frame breakdown to %s\n", outputFileName.c_str());
+    }
+}
+
 [[maybe_unused]] void KHRONOS_APIENTRY PerfTestDebugCallback(GLenum source,
                                                              GLenum type,
                                                              GLuint id,
@@ -785,6 +1071,11 @@ std::string RenderTestParams::story() const
         strstr << "_" << samples << "_samples";
     }
 
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
     return strstr.str();
 }
 
@@ -918,6 +1209,7 @@ void ANGLERenderTest::SetUp()
     mConfigParams.colorSpace  = mTestParams.colorSpace;
     mConfigParams.multisample = mTestParams.multisample;
     mConfigParams.samples     = mTestParams.samples;
+    mConfigParams.noError     = mTestParams.noError;
     if (mTestParams.surfaceType != SurfaceType::WindowWithVSync)
     {
         mConfigParams.swapInterval = 0;
@@ -1033,6 +1325,11 @@ void ANGLERenderTest::SetUp()
     // Runs warmup if enabled
     ANGLEPerfTest::SetUp();
 
+    {
+        std::lock_guard<std::mutex> lock(mTraceEventMutex);
+        mFirstMeasuredTraceEvent = mTraceEventBuffer.size();
+    }
+
     initPerfCounters();
 }
 
@@ -1069,6 +1366,18 @@ void ANGLERenderTest::TearDown()
         DumpTraceEventsToJSONFile(mTraceEventBuffer, gTraceFile);
     }
 
+    if (gFrameBreakdown && !mSkipTest)
+    {
+        std::string outputFile = "frame_breakdown" + mBackend + "_" + mStory + ".json";
+        if (gRenderTestOutputDir)
+        {
+            outputFile = std::string(gRenderTestOutputDir) + GetPathSeparator() + outputFile;
+        }
+        DumpFrameBreakdownToJSONFile(
+            ComputeFrameBreakdowns(mTraceEventBuffer, mFirstMeasuredTraceEvent),
+            mName + mBackend + "." + mStory, outputFile);
+    }
+
     ANGLEPerfTest::TearDown();
 }
 
@@ -1162,7 +1471,7 @@ void ANGLERenderTest::updatePerfCounters()
 
 void ANGLERenderTest::beginInternalTraceEvent(const char *name)
 {
-    if (gEnableTrace)
+    if (TraceEventsEnabled())
     {
         mTraceEventBuffer.emplace_back(TRACE_EVENT_PHASE_BEGIN, gTraceCategories[0].name, name,
                                        MonotonicallyIncreasingTime(&mPlatformMethods),
@@ -1172,7 +1481,7 @@ void ANGLERenderTest::beginInternalTraceEvent(const char *name)
 
 void ANGLERenderTest::endInternalTraceEvent(const char *name)
 {
-    if (gEnableTrace)
+    if (TraceEventsEnabled())
     {
         mTraceEventBuffer.emplace_back(TRACE_EVENT_PHASE_END, gTraceCategories[0].name, name,
                                        MonotonicallyIncreasingTime(&mPlatformMethods),
@@ -1182,7 +1491,7 @@ void ANGLERenderTest::endInternalTraceEvent(const char *name)
 
 void ANGLERenderTest::beginGLTraceEvent(const char *name, double hostTimeSec)
 {
-    if (gEnableTrace)
+    if (TraceEventsEnabled())
     {
         mTraceEventBuffer.emplace_back(TRACE_EVENT_PHASE_BEGIN, gTraceCategories[1].name, name,
                                        hostTimeSec, getCurrentThreadSerial());
@@ -1191,7 +1500,7 @@ void ANGLERenderTest::beginGLTraceEvent(const char *name, double hostTimeSec)
 
 void ANGLERenderTest::endGLTraceEvent(const char *name, double hostTimeSec)
 {
-    if (gEnableTrace)
+    if (TraceEventsEnabled())
     {
         mTraceEventBuffer.emplace_back(TRACE_EVENT_PHASE_END, gTraceCategories[1].name, name,
                                        hostTimeSec, getCurrentThreadSerial());
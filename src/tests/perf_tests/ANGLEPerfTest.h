@@ -182,6 +182,7 @@ struct RenderTestParams : public angle::PlatformParameters
     EGLenum colorSpace             = EGL_COLORSPACE_LINEAR;
     bool multisample               = false;
     EGLint samples                 = -1;
+    bool noError                   = false;
 };
 
 class ANGLERenderTest : public ANGLEPerfTest
@@ -273,6 +274,8 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     // Trace event record that can be output.
     std::vector<TraceEvent> mTraceEventBuffer;
+    // The first event recorded after the warmup, where the frame breakdown starts.
+    size_t mFirstMeasuredTraceEvent = 0;
 
     // Handle to the entry point binding library.
     std::unique_ptr<angle::Library> mEntryPointsLib;
@@ -301,6 +304,14 @@ ParamsT NullDevice(const ParamsT &input)
     return output;
 }
 
+template <typename ParamsT>
+ParamsT NoError(const ParamsT &input)
+{
+    ParamsT output = input;
+    output.noError = true;
+    return output;
+}
+
 template <typename ParamsT>
 ParamsT Passthrough(const ParamsT &input)
 {
@@ -25,6 +25,8 @@ int gStepsPerTrial                 = kDefaultStepsPerTrial;
 int gMaxStepsPerformed             = kDefaultMaxStepsPerformed;
 bool gEnableTrace                  = false;
 const char *gTraceFile             = "ANGLETrace.json";
+bool gFrameBreakdown               = false;
+const char *gShaderCorpus          = nullptr;
 const char *gScreenshotDir         = nullptr;
 const char *gRenderTestOutputDir   = nullptr;
 bool gSaveScreenshots              = false;
@@ -57,6 +59,8 @@ bool PerfTestArg(int *argc, char **argv, int argIndex)
 {
     return ParseFlag("--run-to-key-frame", argc, argv, argIndex, &gRunToKeyFrame) ||
            ParseFlag("--enable-trace", argc, argv, argIndex, &gEnableTrace) ||
+           ParseFlag("--frame-breakdown", argc, argv, argIndex, &gFrameBreakdown) ||
+           ParseCStringArg("--shader-corpus", argc, argv, argIndex, &gShaderCorpus) ||
            ParseFlag("-v", argc, argv, argIndex, &gVerboseLogging) ||
            ParseFlag("--verbose", argc, argv, argIndex, &gVerboseLogging) ||
            ParseFlag("--verbose-logging", argc, argv, argIndex, &gVerboseLogging) ||
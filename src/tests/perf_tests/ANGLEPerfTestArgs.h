@@ -20,7 +20,10 @@ extern int gStepsPerTrial;
 extern int gMaxStepsPerformed;
 extern bool gEnableTrace;
 extern const char *gTraceFile;
+extern bool gFrameBreakdown;
+extern const char *gShaderCorpus;
 extern const char *gScreenshotDir;
+extern const char *gRenderTestOutputDir;
 extern bool gSaveScreenshots;
 extern int gScreenshotFrame;
 extern bool gRunToKeyFrame;
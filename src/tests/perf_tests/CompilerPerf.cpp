@@ -8,10 +8,19 @@
 //   compiles the same shader repeatedly. There are different variations of the tests using
 //   different shaders.
 //
+// CompilerCorpusPerfTest:
+//   Compiles every shader of a corpus given with --shader-corpus, such as the shaders of the
+//   restricted traces extracted by extract_trace_shaders.py, and reports the time and pool
+//   allocations of every compilation phase.
+//
 
 #include "ANGLEPerfTest.h"
+#include "ANGLEPerfTestArgs.h"
+
+#include <map>
 
 #include "GLSLANG/ShaderLang.h"
+#include "common/string_utils.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
 #include "compiler/translator/PoolAlloc.h"
@@ -162,6 +171,51 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// Calls many overloaded built-in functions, which stresses built-in function lookup.
+const char *kBuiltInHeavyESSL300FragSource = R"(#version 300 es
+precision highp float;
+precision highp int;
+
+uniform sampler2D s;
+uniform highp sampler3D s3;
+uniform vec4 u[4];
+uniform int ui;
+
+in vec2 uv;
+out vec4 my_FragColor;
+
+vec4 shade(vec4 a, vec4 b)
+{
+    vec4 c = mix(a, b, clamp(dot(a, b), 0.0, 1.0));
+    c += smoothstep(vec4(0.0), vec4(1.0), abs(a - b)) * step(0.5, length(a));
+    c += vec4(normalize(cross(a.xyz, b.yzx) + vec3(0.001)), fract(a.w));
+    c += pow(abs(a), vec4(2.2)) + exp2(-b) + log2(abs(b) + 1.0) + inversesqrt(abs(a) + 1.0);
+    c += sin(a) * cos(b) + tan(a * 0.1) + atan(a.y, b.x) + asin(clamp(a, -1.0, 1.0));
+    c += floor(a) + ceil(b) + round(a) + trunc(b) + sign(a) + mod(a, 3.0) + min(a, b) + max(a, b);
+    c += vec4(floatBitsToInt(a.x), floatBitsToUint(a.y), packHalf2x16(a.zw), ui);
+    c += unpackHalf2x16(uint(ui)).xyxy + vec4(lessThan(a, b)) + vec4(any(greaterThan(a, b)));
+    c += reflect(a, normalize(b)) + refract(a, normalize(b), 0.5) + faceforward(a, b, a);
+    return c;
+}
+
+void main()
+{
+    vec4 c = texture(s, uv) + textureLod(s, uv, 1.0) + texelFetch(s, ivec2(uv), 0);
+    c += textureGrad(s, uv, dFdx(uv), dFdy(uv)) + textureOffset(s, uv, ivec2(1, -1));
+    c += textureProj(s, vec3(uv, 1.0)) + texture(s3, vec3(uv, fwidth(uv.x)));
+    c += vec4(textureSize(s, 0), textureSize(s3, 0).xy);
+    mat4 m = mat4(u[0], u[1], u[2], u[3]);
+    c += inverse(m) * transpose(m) * c + outerProduct(u[0], u[1]) * c;
+    c *= determinant(m) + distance(u[0], u[1]);
+    for (int i = 0; i < 4; ++i)
+    {
+        c = shade(c, u[i]);
+    }
+    my_FragColor = c;
+})";
+
+const char *kBuiltInHeavyESSL300Id = "BuiltInHeavyESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
@@ -334,15 +388,315 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
     CompilerPerfParameters(SH_HLSL_4_1_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_HLSL_4_1_OUTPUT,
+                           kBuiltInHeavyESSL300FragSource,
+                           kBuiltInHeavyESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
                            kRealWorldESSL100FragSource,
                            kRealWorldESSL100Id),
     CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_GLSL_450_CORE_OUTPUT,
+                           kBuiltInHeavyESSL300FragSource,
+                           kBuiltInHeavyESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kBuiltInHeavyESSL300FragSource, kBuiltInHeavyESSL300Id));
+
+// Preprocessing is measured on its own after the test, as compiling already preprocesses.
+constexpr int kNumPreprocessIterations = 10;
+
+std::ostream &operator<<(std::ostream &stream, const CompilerParameters &p)
+{
+    stream << p.str();
+    return stream;
+}
+
+struct CorpusShader
+{
+    sh::GLenum type;
+    std::string source;
+};
+
+// The corpus is a file listing one shader file per line, relative to the corpus file.  The stage
+// of each shader is given by its extension.
+bool GetShaderTypeFromFileName(const std::string &fileName, sh::GLenum *typeOut)
+{
+    constexpr std::pair<const char *, sh::GLenum> kShaderExtensions[] = {
+        {".vert", GL_VERTEX_SHADER},
+        {".frag", GL_FRAGMENT_SHADER},
+        {".comp", GL_COMPUTE_SHADER},
+        {".geom", GL_GEOMETRY_SHADER_EXT},
+        {".tesc", GL_TESS_CONTROL_SHADER_EXT},
+        {".tese", GL_TESS_EVALUATION_SHADER_EXT},
+    };
+
+    for (const auto &[extension, type] : kShaderExtensions)
+    {
+        if (angle::EndsWith(fileName, extension))
+        {
+            *typeOut = type;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool LoadShaderCorpus(const std::string &corpusPath, std::vector<CorpusShader> *shadersOut)
+{
+    std::string corpus;
+    if (!angle::ReadFileToString(corpusPath, &corpus))
+    {
+        return false;
+    }
+
+    const size_t separator = corpusPath.find_last_of("/\\");
+    const std::string corpusDir =
+        separator == std::string::npos ? "" : corpusPath.substr(0, separator + 1);
+
+    for (const std::string &fileName :
+         angle::SplitString(corpus, "\n", angle::TRIM_WHITESPACE, angle::SPLIT_WANT_NONEMPTY))
+    {
+        CorpusShader shader;
+        if (!GetShaderTypeFromFileName(fileName, &shader.type))
+        {
+            std::cerr << "Unknown shader stage of " << fileName << "\n";
+            continue;
+        }
+        if (!angle::ReadFileToString(corpusDir + fileName, &shader.source))
+        {
+            std::cerr << "Could not read " << corpusDir + fileName << "\n";
+            continue;
+        }
+        shadersOut->push_back(std::move(shader));
+    }
+    return true;
+}
+
+class CompilerCorpusPerfTest : public ANGLEPerfTest,
+                               public ::testing::WithParamInterface<CompilerParameters>
+{
+  public:
+    CompilerCorpusPerfTest();
+
+    void step() override;
+
+    void SetUp() override;
+    void TearDown() override;
+
+    void reportPhaseStats();
+
+  private:
+    sh::TCompiler *getCompiler(sh::GLenum type);
+    bool compileShader(const CorpusShader &shader);
+    void reportPhaseMetric(const std::string &metric, double value, const char *units);
+
+    ShBuiltInResources mResources;
+    ShCompileOptions mCompileOptions;
+    angle::PoolAllocator mAllocator;
+    std::map<sh::GLenum, sh::TCompiler *> mCompilers;
+    std::vector<CorpusShader> mShaders;
+    size_t mCompileCount;
+};
+
+CompilerCorpusPerfTest::CompilerCorpusPerfTest()
+    : ANGLEPerfTest("CompilerCorpusPerf", "", std::string("Corpus_") + GetParam().str(), 1),
+      mCompileOptions{},
+      mCompileCount(0)
+{}
+
+void CompilerCorpusPerfTest::SetUp()
+{
+    InitializePoolIndex();
+    mAllocator.push();
+    SetGlobalPoolAllocator(&mAllocator);
+
+    sh::InitBuiltInResources(&mResources);
+    mResources.FragmentPrecisionHigh        = true;
+    mResources.OES_standard_derivatives     = true;
+    mResources.OES_EGL_image_external       = true;
+    mResources.OES_EGL_image_external_essl3 = true;
+    mResources.EXT_shader_texture_lod       = true;
+    mResources.EXT_frag_depth               = true;
+    mResources.EXT_draw_buffers             = true;
+    mResources.EXT_geometry_shader          = true;
+    mResources.EXT_tessellation_shader      = true;
+    mResources.MaxDrawBuffers               = 8;
+
+    mCompileOptions.objectCode                    = true;
+    mCompileOptions.initializeUninitializedLocals = true;
+    mCompileOptions.initOutputVariables           = true;
+
+    if (angle::gShaderCorpus == nullptr)
+    {
+        skipTest("No shader corpus, see --shader-corpus");
+    }
+    else if (!LoadShaderCorpus(angle::gShaderCorpus, &mShaders))
+    {
+        failTest(std::string("Could not read the shader corpus ") + angle::gShaderCorpus);
+    }
+
+    // Shaders that fail to compile, for example because they use extensions that aren't enabled
+    // here, are left out.
+    size_t numFailedShaders = 0;
+    for (auto iter = mShaders.begin(); iter != mShaders.end();)
+    {
+        if (compileShader(*iter))
+        {
+            ++iter;
+        }
+        else
+        {
+            iter = mShaders.erase(iter);
+            ++numFailedShaders;
+        }
+    }
+    if (numFailedShaders > 0)
+    {
+        std::cout << numFailedShaders << " shaders of the corpus failed to compile.\n";
+    }
+
+    if (!mSkipTest && mShaders.empty())
+    {
+        skipTest("No shader of the corpus compiles");
+    }
+
+    // Times are reported per shader.
+    mIterationsPerStep = std::max(static_cast<int>(mShaders.size()), 1);
+
+    ANGLEPerfTest::SetUp();
+
+    // Only the measured compilations are included in the stats.
+    for (auto &[type, compiler] : mCompilers)
+    {
+        compiler->setPhaseStatsEnabled(true);
+    }
+    mCompileCount = 0;
+}
+
+void CompilerCorpusPerfTest::TearDown()
+{
+    for (auto &[type, compiler] : mCompilers)
+    {
+        SafeDelete(compiler);
+    }
+    mCompilers.clear();
+
+    SetGlobalPoolAllocator(nullptr);
+    mAllocator.pop();
+
+    FreePoolIndex();
+
+    ANGLEPerfTest::TearDown();
+}
+
+sh::TCompiler *CompilerCorpusPerfTest::getCompiler(sh::GLenum type)
+{
+    auto iter = mCompilers.find(type);
+    if (iter != mCompilers.end())
+    {
+        return iter->second;
+    }
+
+    sh::TCompiler *compiler = sh::ConstructCompiler(type, SH_GLES3_2_SPEC, GetParam().output);
+    if (compiler != nullptr && !compiler->Init(mResources))
+    {
+        SafeDelete(compiler);
+    }
+    mCompilers[type] = compiler;
+    return compiler;
+}
+
+bool CompilerCorpusPerfTest::compileShader(const CorpusShader &shader)
+{
+    sh::TCompiler *compiler = getCompiler(shader.type);
+    const char *shaderStrings[] = {shader.source.c_str()};
+    return compiler != nullptr && compiler->compile(shaderStrings, 1, mCompileOptions);
+}
+
+void CompilerCorpusPerfTest::step()
+{
+    for (const CorpusShader &shader : mShaders)
+    {
+        compileShader(shader);
+    }
+    mCompileCount += mShaders.size();
+}
+
+void CompilerCorpusPerfTest::reportPhaseMetric(const std::string &metric,
+                                               double value,
+                                               const char *units)
+{
+    perf_test::MetricInfo metricInfo;
+    if (!mReporter->GetMetricInfo(metric, &metricInfo))
+    {
+        mReporter->RegisterFyiMetric(metric, units);
+    }
+    recordDoubleMetric(metric.c_str(), value, units);
+}
+
+void CompilerCorpusPerfTest::reportPhaseStats()
+{
+    if (mSkipTest || mCompileCount == 0)
+    {
+        return;
+    }
+
+    std::string normalizedSource;
+    for (int iteration = 0; iteration < kNumPreprocessIterations; ++iteration)
+    {
+        for (const CorpusShader &shader : mShaders)
+        {
+            const char *shaderStrings[] = {shader.source.c_str()};
+            getCompiler(shader.type)
+                ->getNormalizedPreprocessedSource(shaderStrings, 1, mCompileOptions,
+                                                  &normalizedSource);
+        }
+    }
+    const size_t preprocessCount = mShaders.size() * kNumPreprocessIterations;
+
+    sh::CompilePhaseStatsMap phaseStats;
+    for (const auto &[type, compiler] : mCompilers)
+    {
+        if (compiler == nullptr)
+        {
+            continue;
+        }
+        for (const auto &[phase, stats] : compiler->getPhaseStats())
+        {
+            sh::CompilePhaseStats &total = phaseStats[phase];
+            total.nanoseconds += stats.nanoseconds;
+            total.allocationCount += stats.allocationCount;
+            total.allocatedBytes += stats.allocatedBytes;
+        }
+    }
+
+    // Every metric is the average over the shaders of the corpus.
+    for (const auto &[phase, stats] : phaseStats)
+    {
+        const double count =
+            static_cast<double>(phase == "Preprocess" ? preprocessCount : mCompileCount);
+        reportPhaseMetric("." + phase + "_time", static_cast<double>(stats.nanoseconds) / count,
+                          "ns");
+        reportPhaseMetric("." + phase + "_allocations",
+                          static_cast<double>(stats.allocationCount) / count, "count");
+        reportPhaseMetric("." + phase + "_allocated_bytes",
+                          static_cast<double>(stats.allocatedBytes) / count, "sizeInBytes");
+    }
+}
+
+TEST_P(CompilerCorpusPerfTest, Run)
+{
+    run();
+    reportPhaseStats();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerCorpusPerfTest,
+                       CompilerParameters(SH_HLSL_4_1_OUTPUT),
+                       CompilerParameters(SH_GLSL_450_CORE_OUTPUT),
+                       CompilerParameters(SH_ESSL_OUTPUT));
 
 }  // anonymous namespace
@@ -0,0 +1,509 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ContainerPerf:
+//   Performance tests for the containers on ANGLE's hot paths (FastVector, FlatUnorderedMap,
+//   BitSetArray and SizedMRUCache), next to the containers they are used instead of.  HashMap is
+//   absl::flat_hash_map when ANGLE is built with abseil.  Keys are random 64-bit values, like the
+//   hashes the descriptor set and pipeline caches are keyed with, and lookups favor a few hot keys
+//   the way draw calls do.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "common/FastVector.h"
+#include "common/bitset_utils.h"
+#include "common/hash_containers.h"
+#include "libANGLE/SizedMRUCache.h"
+
+namespace
+{
+// Every step does this many operations, so the results are per operation.
+constexpr size_t kOperationsPerStep = 4096;
+// The inline storage of the flat containers, past which they allocate.
+constexpr size_t kInlineStorageSize = 16;
+constexpr size_t kBitSetArraySize   = 512;
+
+volatile uint64_t gSink = 0;
+
+enum class Container
+{
+    FlatUnorderedMap,
+    HashMap,
+    StdUnorderedMap,
+    FastVector,
+    StdVector,
+    BitSetArray,
+    SizedMRUCache,
+};
+
+enum class Operation
+{
+    Insert,
+    Lookup,
+    Iterate,
+    // Erases entries and inserts new ones at a constant size, like a cache that is evicting.
+    EraseHeavy,
+};
+
+struct ContainerParams
+{
+    Container container;
+    Operation operation;
+    size_t size;
+};
+
+const char *GetContainerName(Container container)
+{
+    switch (container)
+    {
+        case Container::FlatUnorderedMap:
+            return "flat_unordered_map";
+        case Container::HashMap:
+            return "hash_map";
+        case Container::StdUnorderedMap:
+            return "std_unordered_map";
+        case Container::FastVector:
+            return "fast_vector";
+        case Container::StdVector:
+            return "std_vector";
+        case Container::BitSetArray:
+            return "bitset_array";
+        case Container::SizedMRUCache:
+            return "sized_mru_cache";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+const char *GetOperationName(Operation operation)
+{
+    switch (operation)
+    {
+        case Operation::Insert:
+            return "insert";
+        case Operation::Lookup:
+            return "lookup";
+        case Operation::Iterate:
+            return "iterate";
+        case Operation::EraseHeavy:
+            return "erase_heavy";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
+std::string GetStory(const ContainerParams &params)
+{
+    std::stringstream story;
+    story << "_" << GetContainerName(params.container) << "_"
+          << GetOperationName(params.operation) << "_" << params.size;
+    return story.str();
+}
+
+using FlatMap     = angle::FlatUnorderedMap<uint64_t, uint32_t, kInlineStorageSize>;
+using HashMap     = angle::HashMap<uint64_t, uint32_t>;
+using StdMap      = std::unordered_map<uint64_t, uint32_t>;
+using FlatVector  = angle::FastVector<uint64_t, kInlineStorageSize>;
+using BitSetArray = angle::BitSetArray<kBitSetArraySize>;
+using MRUCache    = angle::SizedMRUCache<uint64_t, uint32_t>;
+
+void MapInsert(FlatMap *map, uint64_t key, uint32_t value)
+{
+    map->insert(key, value);
+}
+
+template <typename MapT>
+void MapInsert(MapT *map, uint64_t key, uint32_t value)
+{
+    map->emplace(key, value);
+}
+
+class ContainerPerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<ContainerParams>
+{
+  public:
+    ContainerPerfTest();
+    void step() override;
+
+  private:
+    template <typename MapT>
+    void stepMap(MapT *map);
+    template <typename VectorT>
+    void stepVector(VectorT *vector);
+    void stepBitSetArray();
+    void stepMRUCache();
+
+    template <typename MapT>
+    void fillMap(MapT *map);
+    template <typename VectorT>
+    void fillVector(VectorT *vector);
+
+    size_t rounds() const { return std::max<size_t>(1, kOperationsPerStep / GetParam().size); }
+
+    // Twice the container size, so the erase-heavy runs have new keys to insert.
+    std::vector<uint64_t> mKeys;
+    // Indices of the keys that are looked up, skewed towards the first ones.
+    std::vector<size_t> mLookups;
+    // The oldest inserted key in the erase-heavy runs.
+    size_t mNextErase = 0;
+
+    FlatMap mFlatMap;
+    HashMap mHashMap;
+    StdMap mStdMap;
+    FlatVector mFastVector;
+    std::vector<uint64_t> mStdVector;
+    BitSetArray mBitSetArray;
+    MRUCache mMRUCache;
+};
+
+ContainerPerfTest::ContainerPerfTest()
+    : ANGLEPerfTest("ContainerPerf", "", GetStory(GetParam()), kOperationsPerStep),
+      mMRUCache(GetParam().size)
+{
+    const size_t size = GetParam().size;
+
+    std::mt19937_64 generator(0);
+    for (size_t index = 0; index < size * 2; ++index)
+    {
+        mKeys.push_back(generator());
+    }
+
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    for (size_t index = 0; index < kOperationsPerStep; ++index)
+    {
+        const double skewed = std::pow(distribution(generator), 3.0);
+        mLookups.push_back(std::min(size - 1, static_cast<size_t>(skewed * size)));
+    }
+
+    switch (GetParam().container)
+    {
+        case Container::FlatUnorderedMap:
+            fillMap(&mFlatMap);
+            break;
+        case Container::HashMap:
+            fillMap(&mHashMap);
+            break;
+        case Container::StdUnorderedMap:
+            fillMap(&mStdMap);
+            break;
+        case Container::FastVector:
+            fillVector(&mFastVector);
+            break;
+        case Container::StdVector:
+            fillVector(&mStdVector);
+            break;
+        case Container::BitSetArray:
+            for (size_t index = 0; index < size; ++index)
+            {
+                mBitSetArray.set(mKeys[index] % kBitSetArraySize);
+            }
+            break;
+        case Container::SizedMRUCache:
+            for (size_t index = 0; index < size; ++index)
+            {
+                mMRUCache.put(mKeys[index], static_cast<uint32_t>(index), 1);
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+template <typename MapT>
+void ContainerPerfTest::fillMap(MapT *map)
+{
+    map->clear();
+    for (size_t index = 0; index < GetParam().size; ++index)
+    {
+        MapInsert(map, mKeys[index], static_cast<uint32_t>(index));
+    }
+    mNextErase = 0;
+}
+
+template <typename VectorT>
+void ContainerPerfTest::fillVector(VectorT *vector)
+{
+    vector->clear();
+    for (size_t index = 0; index < GetParam().size; ++index)
+    {
+        vector->push_back(mKeys[index]);
+    }
+    mNextErase = 0;
+}
+
+void ContainerPerfTest::step()
+{
+    switch (GetParam().container)
+    {
+        case Container::FlatUnorderedMap:
+            stepMap(&mFlatMap);
+            break;
+        case Container::HashMap:
+            stepMap(&mHashMap);
+            break;
+        case Container::StdUnorderedMap:
+            stepMap(&mStdMap);
+            break;
+        case Container::FastVector:
+            stepVector(&mFastVector);
+            break;
+        case Container::StdVector:
+            stepVector(&mStdVector);
+            break;
+        case Container::BitSetArray:
+            stepBitSetArray();
+            break;
+        case Container::SizedMRUCache:
+            stepMRUCache();
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+template <typename MapT>
+void ContainerPerfTest::stepMap(MapT *map)
+{
+    const size_t size = GetParam().size;
+    uint64_t sum      = 0;
+
+    switch (GetParam().operation)
+    {
+        case Operation::Insert:
+            for (size_t round = 0; round < rounds(); ++round)
+            {
+                fillMap(map);
+            }
+            break;
+        case Operation::Lookup:
+            for (size_t lookup : mLookups)
+            {
+                auto iter = map->find(mKeys[lookup]);
+                if (iter != map->end())
+                {
+                    sum += iter->second;
+                }
+            }
+            break;
+        case Operation::Iterate:
+            for (size_t round = 0; round < rounds(); ++round)
+            {
+                for (const auto &keyAndValue : *map)
+                {
+                    sum += keyAndValue.second;
+                }
+            }
+            break;
+        case Operation::EraseHeavy:
+            for (size_t operation = 0; operation < kOperationsPerStep; ++operation)
+            {
+                const size_t eraseIndex  = mNextErase;
+                const size_t insertIndex = (mNextErase + size) % mKeys.size();
+                mNextErase               = (mNextErase + 1) % mKeys.size();
+
+                map->erase(map->find(mKeys[eraseIndex]));
+                MapInsert(map, mKeys[insertIndex], static_cast<uint32_t>(insertIndex));
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    gSink = gSink + sum;
+}
+
+template <typename VectorT>
+void ContainerPerfTest::stepVector(VectorT *vector)
+{
+    uint64_t sum = 0;
+
+    switch (GetParam().operation)
+    {
+        case Operation::Insert:
+            for (size_t round = 0; round < rounds(); ++round)
+            {
+                fillVector(vector);
+            }
+            break;
+        case Operation::Lookup:
+            for (size_t lookup : mLookups)
+            {
+                sum += (*vector)[lookup];
+            }
+            break;
+        case Operation::Iterate:
+            for (size_t round = 0; round < rounds(); ++round)
+            {
+                for (uint64_t value : *vector)
+                {
+                    sum += value;
+                }
+            }
+            break;
+        case Operation::EraseHeavy:
+            // Removes by moving the last element into the hole, as FastVector's
+            // remove_and_permute does, so both vectors do the same work.
+            for (size_t lookup : mLookups)
+            {
+                (*vector)[lookup] = vector->back();
+                vector->pop_back();
+                vector->push_back(mKeys[lookup + GetParam().size]);
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    gSink = gSink + sum;
+}
+
+void ContainerPerfTest::stepBitSetArray()
+{
+    const size_t size = GetParam().size;
+    uint64_t sum      = 0;
+
+    switch (GetParam().operation)
+    {
+        case Operation::Insert:
+            for (size_t round = 0; round < rounds(); ++round)
+            {
+                mBitSetArray.reset();
+                for (size_t index = 0; index < size; ++index)
+                {
+                    mBitSetArray.set(mKeys[index] % kBitSetArraySize);
+                }
+            }
+            break;
+        case Operation::Lookup:
+            for (size_t lookup : mLookups)
+            {
+                sum += mBitSetArray.test(mKeys[lookup] % kBitSetArraySize);
+            }
+            break;
+        case Operation::Iterate:
+            for (size_t round = 0; round < rounds(); ++round)
+            {
+                for (size_t bit : mBitSetArray)
+                {
+                    sum += bit;
+                }
+            }
+            break;
+        case Operation::EraseHeavy:
+            for (size_t lookup : mLookups)
+            {
+                mBitSetArray.reset(mKeys[lookup] % kBitSetArraySize);
+                mBitSetArray.set(mKeys[lookup + size] % kBitSetArraySize);
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    gSink = gSink + sum;
+}
+
+void ContainerPerfTest::stepMRUCache()
+{
+    const size_t size = GetParam().size;
+    uint64_t sum      = 0;
+
+    switch (GetParam().operation)
+    {
+        case Operation::Insert:
+            for (size_t round = 0; round < rounds(); ++round)
+            {
+                mMRUCache.clear();
+                for (size_t index = 0; index < size; ++index)
+                {
+                    mMRUCache.put(mKeys[index], static_cast<uint32_t>(index), 1);
+                }
+            }
+            break;
+        case Operation::Lookup:
+            for (size_t lookup : mLookups)
+            {
+                const uint32_t *value = nullptr;
+                if (mMRUCache.get(mKeys[lookup], &value))
+                {
+                    sum += *value;
+                }
+            }
+            break;
+        case Operation::EraseHeavy:
+            // The cache is full, so every new entry evicts the least recently used one.
+            for (size_t operation = 0; operation < kOperationsPerStep; ++operation)
+            {
+                const size_t index = (mNextErase + size) % mKeys.size();
+                mNextErase         = (mNextErase + 1) % mKeys.size();
+                mMRUCache.put(mKeys[index], static_cast<uint32_t>(index), 1);
+            }
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    gSink = gSink + sum;
+}
+
+std::vector<ContainerParams> GetContainerParams()
+{
+    constexpr Container kContainers[] = {
+        Container::FlatUnorderedMap, Container::HashMap,    Container::StdUnorderedMap,
+        Container::FastVector,       Container::StdVector,  Container::BitSetArray,
+        Container::SizedMRUCache,
+    };
+    constexpr Operation kOperations[] = {Operation::Insert, Operation::Lookup, Operation::Iterate,
+                                         Operation::EraseHeavy};
+    // Within the inline storage, and past it.
+    constexpr size_t kSizes[] = {8, 256};
+
+    std::vector<ContainerParams> params;
+    for (Container container : kContainers)
+    {
+        for (Operation operation : kOperations)
+        {
+            // SizedMRUCache is not iterated on any hot path.
+            if (container == Container::SizedMRUCache && operation == Operation::Iterate)
+            {
+                continue;
+            }
+            for (size_t size : kSizes)
+            {
+                params.push_back({container, operation, size});
+            }
+        }
+    }
+    return params;
+}
+
+TEST_P(ContainerPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         ContainerPerfTest,
+                         ::testing::ValuesIn(GetContainerParams()),
+                         [](const ::testing::TestParamInfo<ContainerParams> &info) {
+                             return GetStory(info.param).substr(1);
+                         });
+}  // anonymous namespace
@@ -0,0 +1,127 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// DirtyBitDispatchPerf:
+//   Performance test for dispatching dirty bit handlers the way ContextVk does per draw call,
+//   through a table of member function pointers or of per-handler function instantiations.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <array>
+#include <utility>
+
+#include "common/bitset_utils.h"
+#include "libANGLE/Error.h"
+
+namespace
+{
+constexpr int kIterationsPerStep = 1000;
+constexpr size_t kDirtyBitCount  = 48;
+
+volatile uint32_t gHandled = 0;
+
+class Handlers
+{
+  public:
+    using DirtyBits = angle::BitSet64<kDirtyBitCount>;
+
+    using Handler    = angle::Result (Handlers::*)(DirtyBits::Iterator *iter, DirtyBits mask);
+    using Dispatcher = angle::Result (*)(Handlers *handlers,
+                                         DirtyBits::Iterator *iter,
+                                         DirtyBits mask);
+
+    template <Handler kHandler>
+    static angle::Result Dispatch(Handlers *handlers, DirtyBits::Iterator *iter, DirtyBits mask)
+    {
+        return (handlers->*kHandler)(iter, mask);
+    }
+
+    template <uint32_t kValue>
+    angle::Result handle(DirtyBits::Iterator *iter, DirtyBits mask)
+    {
+        gHandled = gHandled + kValue;
+        return angle::Result::Continue;
+    }
+};
+
+template <size_t... kIndices>
+void InitTables(std::array<Handlers::Handler, kDirtyBitCount> *handlers,
+                std::array<Handlers::Dispatcher, kDirtyBitCount> *dispatchers,
+                std::index_sequence<kIndices...>)
+{
+    *handlers    = {&Handlers::handle<kIndices>...};
+    *dispatchers = {&Handlers::Dispatch<&Handlers::handle<kIndices>>...};
+}
+
+enum class DispatchMode
+{
+    MemberFunctionPointer,
+    FunctionPointer,
+};
+
+class DirtyBitDispatchPerfTest : public ANGLEPerfTest,
+                                 public ::testing::WithParamInterface<DispatchMode>
+{
+  public:
+    DirtyBitDispatchPerfTest();
+    void step() override;
+
+  private:
+    Handlers mHandlers;
+    std::array<Handlers::Handler, kDirtyBitCount> mHandlerTable;
+    std::array<Handlers::Dispatcher, kDirtyBitCount> mDispatcherTable;
+};
+
+DirtyBitDispatchPerfTest::DirtyBitDispatchPerfTest()
+    : ANGLEPerfTest("DirtyBitDispatchPerf",
+                    "",
+                    GetParam() == DispatchMode::MemberFunctionPointer ? "_member_function_pointer"
+                                                                      : "_function_pointer",
+                    kIterationsPerStep)
+{
+    InitTables(&mHandlerTable, &mDispatcherTable, std::make_index_sequence<kDirtyBitCount>());
+}
+
+void DirtyBitDispatchPerfTest::step()
+{
+    // A handful of bits are typically dirty in a draw call, spread across the mask.
+    Handlers::DirtyBits dirtyBits;
+    dirtyBits.set(1);
+    dirtyBits.set(9);
+    dirtyBits.set(17);
+    dirtyBits.set(30);
+    dirtyBits.set(41);
+    const Handlers::DirtyBits dirtyBitMask = Handlers::DirtyBits().set();
+
+    for (int i = 0; i < kIterationsPerStep; i++)
+    {
+        if (GetParam() == DispatchMode::MemberFunctionPointer)
+        {
+            for (auto iter = dirtyBits.begin(); iter != dirtyBits.end(); ++iter)
+            {
+                (void)(mHandlers.*mHandlerTable[*iter])(&iter, dirtyBitMask);
+            }
+        }
+        else
+        {
+            for (auto iter = dirtyBits.begin(); iter != dirtyBits.end(); ++iter)
+            {
+                (void)mDispatcherTable[*iter](&mHandlers, &iter, dirtyBitMask);
+            }
+        }
+    }
+}
+
+TEST_P(DirtyBitDispatchPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         DirtyBitDispatchPerfTest,
+                         ::testing::Values(DispatchMode::MemberFunctionPointer,
+                                           DispatchMode::FunctionPointer));
+}  // anonymous namespace
@@ -51,11 +51,24 @@ struct DrawElementsPerfParams final : public DrawCallPerfParams
             strstr << "_ushort";
         }
 
+        if (largeIndexCount)
+        {
+            strstr << "_large_index_count";
+        }
+
+        if (primitiveRestart)
+        {
+            strstr << "_primitive_restart";
+        }
+
         return strstr.str();
     }
 
     GLenum type             = GL_UNSIGNED_INT;
     bool indexBufferChanged = false;
+    // Large index buffers make the CPU index range computation on buffer change dominate.
+    bool largeIndexCount  = false;
+    bool primitiveRestart = false;
 };
 
 std::ostream &operator<<(std::ostream &os, const DrawElementsPerfParams &params)
@@ -129,6 +142,18 @@ void DrawElementsPerfBenchmark::initializeBenchmark()
         mIntIndexData.push_back(rand() % mCount);
     }
 
+    if (params.primitiveRestart)
+    {
+        // Cut the strip of triangles every few primitives.
+        constexpr int kRestartInterval = 64;
+        for (int i = kRestartInterval - 1; i < mCount; i += kRestartInterval)
+        {
+            mShortIndexData[i] = std::numeric_limits<GLushort>::max();
+            mIntIndexData[i]   = std::numeric_limits<GLuint>::max();
+        }
+        glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+    }
+
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
 
     mBufferSize = ElementTypeSize(params.type) * mCount;
@@ -230,6 +255,26 @@ P CombineIndexBufferChanged(const P &in, bool indexBufferChanged)
     return out;
 }
 
+P CombineLargeIndexCount(const P &in, bool primitiveRestart)
+{
+    P out = in;
+
+    // Keep the index count within the range of GL_UNSIGNED_SHORT.
+    out.numTris            = 20000;
+    out.indexBufferChanged = true;
+    out.largeIndexCount    = true;
+    out.primitiveRestart   = primitiveRestart;
+    out.iterationsPerStep /= 100;
+
+    if (primitiveRestart)
+    {
+        out.majorVersion = 3;
+        out.minorVersion = 0;
+    }
+
+    return out;
+}
+
 std::vector<GLenum> gIndexTypes = {GL_UNSIGNED_INT, GL_UNSIGNED_SHORT};
 std::vector<P> gWithIndexType   = CombineWithValues({P()}, gIndexTypes, CombineIndexType);
 std::vector<P> gWithRenderer =
@@ -238,6 +283,21 @@ std::vector<P> gWithChange =
     CombineWithValues(gWithRenderer, {false, true}, CombineIndexBufferChanged);
 std::vector<P> gWithDevice = CombineWithFuncs(gWithChange, {Passthrough<P>, NullDevice<P>});
 
-ANGLE_INSTANTIATE_TEST_ARRAY(DrawElementsPerfBenchmark, gWithDevice);
+// Streaming large index buffers, which measures the index range computation on buffer change.
+std::vector<P> gWithLargeIndexCount =
+    CombineWithValues(CombineWithFuncs(gWithIndexType, {Vulkan<P>}), {false, true},
+                      CombineLargeIndexCount);
+std::vector<P> gWithLargeIndexCountDevice =
+    CombineWithFuncs(gWithLargeIndexCount, {Passthrough<P>, NullDevice<P>});
+
+std::vector<P> GetDrawElementsPerfParams()
+{
+    std::vector<P> params = gWithDevice;
+    params.insert(params.end(), gWithLargeIndexCountDevice.begin(),
+                  gWithLargeIndexCountDevice.end());
+    return params;
+}
+
+ANGLE_INSTANTIATE_TEST_ARRAY(DrawElementsPerfBenchmark, GetDrawElementsPerfParams());
 
 }  // anonymous namespace
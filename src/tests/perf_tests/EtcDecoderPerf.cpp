@@ -0,0 +1,180 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// EtcDecoderPerf: Performance test for the CPU ETC2 and EAC decoders.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <gmock/gmock.h>
+
+#include <random>
+
+#include "common/WorkerThread.h"
+#include "image_util/loadimage.h"
+
+using namespace testing;
+
+namespace
+{
+using angle::ImageLoadContext;
+using angle::WorkerThreadPool;
+
+enum class EtcFormat
+{
+    RGB8,
+    RGBA8,
+    R11,
+    RG11,
+};
+
+struct EtcDecoderParams
+{
+    EtcDecoderParams(EtcFormat format, uint32_t size, bool multiThreaded)
+        : format(format), size(size), multiThreaded(multiThreaded)
+    {}
+
+    EtcFormat format;
+    uint32_t size;
+    bool multiThreaded;
+};
+
+std::ostream &operator<<(std::ostream &os, const EtcDecoderParams &params)
+{
+    switch (params.format)
+    {
+        case EtcFormat::RGB8:
+            os << "RGB8";
+            break;
+        case EtcFormat::RGBA8:
+            os << "RGBA8";
+            break;
+        case EtcFormat::R11:
+            os << "R11";
+            break;
+        case EtcFormat::RG11:
+            os << "RG11";
+            break;
+    }
+    os << "_" << params.size << "x" << params.size;
+    if (params.multiThreaded)
+    {
+        os << "_multi_threaded";
+    }
+    return os;
+}
+
+size_t GetBlockSize(EtcFormat format)
+{
+    return format == EtcFormat::RGBA8 || format == EtcFormat::RG11 ? 16 : 8;
+}
+
+size_t GetOutputPixelSize(EtcFormat format)
+{
+    switch (format)
+    {
+        case EtcFormat::RGB8:
+        case EtcFormat::RGBA8:
+            return 4;
+        case EtcFormat::R11:
+            return 1;
+        case EtcFormat::RG11:
+            return 2;
+    }
+    return 0;
+}
+
+class EtcDecoderPerfTest : public ANGLEPerfTest, public WithParamInterface<EtcDecoderParams>
+{
+  public:
+    EtcDecoderPerfTest();
+
+    void step() override;
+
+    std::string getName();
+
+    ImageLoadContext mContext;
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+};
+
+EtcDecoderPerfTest::EtcDecoderPerfTest()
+    : ANGLEPerfTest(getName(), "", "_run", 1, "us"),
+      mOutput(GetParam().size * GetParam().size * GetOutputPixelSize(GetParam().format))
+{
+    mContext.singleThreadPool = WorkerThreadPool::Create(1, ANGLEPlatformCurrent());
+    if (GetParam().multiThreaded)
+    {
+        mContext.multiThreadPool = WorkerThreadPool::Create(0, ANGLEPlatformCurrent());
+    }
+
+    // Random blocks exercise all block modes.
+    const size_t blockCount = (GetParam().size / 4) * (GetParam().size / 4);
+    mInput.resize(blockCount * GetBlockSize(GetParam().format));
+    std::mt19937 generator(0);
+    for (uint8_t &byte : mInput)
+    {
+        byte = static_cast<uint8_t>(generator());
+    }
+}
+
+void EtcDecoderPerfTest::step()
+{
+    const size_t size           = GetParam().size;
+    const size_t inputRowPitch  = (size / 4) * GetBlockSize(GetParam().format);
+    const size_t outputRowPitch = size * GetOutputPixelSize(GetParam().format);
+
+    switch (GetParam().format)
+    {
+        case EtcFormat::RGB8:
+            angle::LoadETC2RGB8ToRGBA8(mContext, size, size, 1, mInput.data(), inputRowPitch, 0,
+                                       mOutput.data(), outputRowPitch, 0);
+            break;
+        case EtcFormat::RGBA8:
+            angle::LoadETC2RGBA8ToRGBA8(mContext, size, size, 1, mInput.data(), inputRowPitch, 0,
+                                        mOutput.data(), outputRowPitch, 0);
+            break;
+        case EtcFormat::R11:
+            angle::LoadEACR11ToR8(mContext, size, size, 1, mInput.data(), inputRowPitch, 0,
+                                  mOutput.data(), outputRowPitch, 0);
+            break;
+        case EtcFormat::RG11:
+            angle::LoadEACRG11ToRG8(mContext, size, size, 1, mInput.data(), inputRowPitch, 0,
+                                    mOutput.data(), outputRowPitch, 0);
+            break;
+    }
+}
+
+std::string EtcDecoderPerfTest::getName()
+{
+    std::stringstream ss;
+    ss << UnitTest::GetInstance()->current_test_suite()->name() << "/" << GetParam();
+    return ss.str();
+}
+
+// Measures the speed of ETC2 and EAC decoding on the CPU.
+TEST_P(EtcDecoderPerfTest, Run)
+{
+    this->run();
+}
+
+std::vector<EtcDecoderParams> GetEtcDecoderParams()
+{
+    std::vector<EtcDecoderParams> params;
+    for (EtcFormat format : {EtcFormat::RGB8, EtcFormat::RGBA8, EtcFormat::R11, EtcFormat::RG11})
+    {
+        params.emplace_back(format, 256, false);
+        params.emplace_back(format, 4096, false);
+        params.emplace_back(format, 4096, true);
+    }
+    return params;
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         EtcDecoderPerfTest,
+                         ValuesIn(GetEtcDecoderParams()),
+                         PrintToStringParamName());
+
+}  // anonymous namespace
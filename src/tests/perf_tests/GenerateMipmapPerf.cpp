@@ -33,6 +33,7 @@ struct GenerateMipmapParams final : public RenderTestParams
         textureHeight = 1080;
 
         internalFormat = GL_RGBA;
+        format         = GL_RGBA;
 
         webgl = false;
     }
@@ -43,6 +44,7 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLsizei textureHeight;
 
     GLenum internalFormat;
+    GLenum format;
 
     bool webgl;
 };
@@ -67,6 +69,10 @@ std::string GenerateMipmapParams::story() const
     {
         strstr << "_rgb";
     }
+    else if (internalFormat == GL_SRGB8_ALPHA8)
+    {
+        strstr << "_srgb";
+    }
 
     return strstr.str();
 }
@@ -158,7 +164,7 @@ void GenerateMipmapBenchmarkBase::initializeBenchmark()
     FillWithRandomData(&mTextureData);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, GL_UNSIGNED_BYTE, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -219,7 +225,7 @@ void GenerateMipmapBenchmark::drawBenchmark()
         std::array<uint8_t, 4> randomData;
         FillWithRandomData(&randomData);
 
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.internalFormat, GL_UNSIGNED_BYTE,
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, params.format, GL_UNSIGNED_BYTE,
                         randomData.data());
 
         // Generate mipmaps
@@ -248,7 +254,7 @@ void GenerateMipmapWithRedefineBenchmark::drawBenchmark()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
     glTexImage2D(GL_TEXTURE_2D, 0, params.internalFormat, params.textureWidth, params.textureHeight,
-                 0, params.internalFormat, GL_UNSIGNED_BYTE, mTextureData.data());
+                 0, params.format, GL_UNSIGNED_BYTE, mTextureData.data());
 
     // Perform a draw so the image data is flushed.
     glDrawArrays(GL_TRIANGLES, 0, 3);
@@ -324,6 +330,7 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     if (emulatedFormat)
     {
         params.internalFormat = GL_RGB;
+        params.format         = GL_RGB;
     }
     if (singleIteration)
     {
@@ -332,6 +339,15 @@ GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool e
     return params;
 }
 
+GenerateMipmapParams SRGB(GenerateMipmapParams params)
+{
+    // sRGB formats take a different path than linear formats in some backends, such as the compute
+    // path in Vulkan, which only supports linear formats.
+    params.internalFormat = GL_SRGB8_ALPHA8;
+    params.format         = GL_RGBA;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(GenerateMipmapBenchmark, Run)
@@ -356,7 +372,11 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        VulkanParams(false, false, false),
                        VulkanParams(true, false, false),
                        VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(true, false, true),
+                       SRGB(D3D11Params(false, false)),
+                       SRGB(MetalParams(false, false)),
+                       SRGB(OpenGLOrGLESParams(false, false)),
+                       SRGB(VulkanParams(false, false, false)));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
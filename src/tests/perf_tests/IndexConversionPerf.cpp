@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 // IndexConversionPerf:
-//   Performance tests for ANGLE index conversion in D3D11.
+//   Performance tests for ANGLE index conversion in D3D11, and index range computation.
 //
 
 #include "ANGLEPerfTest.h"
@@ -211,6 +211,22 @@ IndexConversionPerfParams IndexRangeOffsetPerfD3D11Params()
     return params;
 }
 
+// On Vulkan, there is no index conversion, but the index buffer update invalidates the index range
+// cache, so these measure the CPU index range computation of the whole (or offset) range.
+IndexConversionPerfParams IndexConversionPerfVulkanParams()
+{
+    IndexConversionPerfParams params = IndexConversionPerfD3D11Params();
+    params.eglParameters             = egl_platform::VULKAN_NULL();
+    return params;
+}
+
+IndexConversionPerfParams IndexRangeOffsetPerfVulkanParams()
+{
+    IndexConversionPerfParams params = IndexRangeOffsetPerfD3D11Params();
+    params.eglParameters             = egl_platform::VULKAN_NULL();
+    return params;
+}
+
 TEST_P(IndexConversionPerfTest, Run)
 {
     run();
@@ -218,7 +234,9 @@ TEST_P(IndexConversionPerfTest, Run)
 
 ANGLE_INSTANTIATE_TEST(IndexConversionPerfTest,
                        IndexConversionPerfD3D11Params(),
-                       IndexRangeOffsetPerfD3D11Params());
+                       IndexRangeOffsetPerfD3D11Params(),
+                       IndexConversionPerfVulkanParams(),
+                       IndexRangeOffsetPerfVulkanParams());
 
 // This test suite is not instantiated on some OSes.
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IndexConversionPerfTest);
@@ -30,6 +30,17 @@ enum class PreRotation
     _270,
 };
 
+// Where the shaders take the pre-rotation and flip values from.
+enum class PreRotationSource
+{
+    // The rotation is a specialization constant, and the flip is a driver uniform.
+    Default,
+    // Both are driver uniforms.
+    DriverUniform,
+    // Both are specialization constants.
+    SpecConst,
+};
+
 struct PreRotationParams final : public RenderTestParams
 {
     PreRotationParams()
@@ -38,11 +49,13 @@ struct PreRotationParams final : public RenderTestParams
         trackGpuTime      = true;
 
         preRotation = PreRotation::_0;
+        source      = PreRotationSource::Default;
     }
 
     std::string story() const override;
 
     PreRotation preRotation;
+    PreRotationSource source;
 };
 
 std::ostream &operator<<(std::ostream &os, const PreRotationParams &params)
@@ -72,6 +85,18 @@ std::string PreRotationParams::story() const
             break;
     }
 
+    switch (source)
+    {
+        case PreRotationSource::Default:
+            break;
+        case PreRotationSource::DriverUniform:
+            strstr << "_DriverUniform";
+            break;
+        case PreRotationSource::SpecConst:
+            strstr << "_SpecConst";
+            break;
+    }
+
     return strstr.str();
 }
 
@@ -195,6 +220,20 @@ PreRotationParams VulkanParams(PreRotation preRotation)
     return params;
 }
 
+PreRotationParams DriverUniform(PreRotationParams params)
+{
+    params.source = PreRotationSource::DriverUniform;
+    params.eglParameters.enable(Feature::PreferDriverUniformOverSpecConst);
+    return params;
+}
+
+PreRotationParams SpecConst(PreRotationParams params)
+{
+    params.source = PreRotationSource::SpecConst;
+    params.eglParameters.enable(Feature::BakeFlipInSpecConst);
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(PreRotationBenchmark, Run)
@@ -209,4 +248,8 @@ ANGLE_INSTANTIATE_TEST(PreRotationBenchmark,
                        VulkanParams(PreRotation::_0),
                        VulkanParams(PreRotation::_90),
                        VulkanParams(PreRotation::_180),
-                       VulkanParams(PreRotation::_270));
+                       VulkanParams(PreRotation::_270),
+                       DriverUniform(VulkanParams(PreRotation::_0)),
+                       DriverUniform(VulkanParams(PreRotation::_90)),
+                       SpecConst(VulkanParams(PreRotation::_0)),
+                       SpecConst(VulkanParams(PreRotation::_90)));
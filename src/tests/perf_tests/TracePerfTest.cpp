@@ -30,7 +30,9 @@
 #include <cassert>
 #include <fstream>
 #include <functional>
+#include <future>
 #include <sstream>
+#include <thread>
 
 // When --minimize-gpu-work is specified, we want to reduce GPU work to minimum and lift up the CPU
 // overhead to surface so that we can see how much CPU overhead each driver has for each app trace.
@@ -203,6 +205,7 @@ class TracePerfTest : public ANGLERenderTest
     };
 
     void sampleTime();
+    void preloadBinaryData();
 
     enum class ScreenshotType
     {
@@ -235,6 +238,7 @@ class TracePerfTest : public ANGLERenderTest
     GLuint mDrawFramebufferBinding                                      = 0;
     GLuint mReadFramebufferBinding                                      = 0;
     EGLContext mEglContext                                              = 0;
+    std::thread::id mReplayThreadId;
     uint32_t mCurrentFrame                                              = 0;
     uint32_t mCurrentIteration                                          = 0;
     uint32_t mCurrentOffscreenGridIteration                             = 0;
@@ -243,6 +247,8 @@ class TracePerfTest : public ANGLERenderTest
     bool mScreenshotSaved                                               = false;
     int32_t mScreenshotFrame                                            = gScreenshotFrame;
     std::unique_ptr<TraceLibrary> mTraceReplay;
+    std::string mPreloadedBinaryDataFileName;
+    std::future<std::vector<uint8_t>> mPreloadedBinaryData;
 
     static constexpr int kFpsNumFrames               = 4;
     std::array<double, kFpsNumFrames> mFpsStartTimes = {0, 0, 0, 0};
@@ -1955,6 +1961,44 @@ TracePerfTest::TracePerfTest(std::unique_ptr<const TracePerfParams> params)
             mStepsToRun = keyFrame;
         }
     }
+
+    if (!mSkipTest)
+    {
+        preloadBinaryData();
+    }
+}
+
+// Reading and decompressing the binary data of large traces takes seconds, so it starts on a
+// worker thread before the display and window are set up, and overlaps with them.
+void TracePerfTest::preloadBinaryData()
+{
+    const TraceInfo &traceInfo = mParams->traceInfo;
+
+    char testDataDir[kMaxPath] = {};
+    if (!FindTraceTestDataPath(traceInfo.name, testDataDir, kMaxPath))
+    {
+        return;
+    }
+
+    // The file name the trace passes to InitializeReplay*().  If it turns out different, the
+    // binary data is loaded when the replay asks for it instead.
+    mPreloadedBinaryDataFileName = std::string(traceInfo.name) + ".angledata";
+    if (traceInfo.isBinaryDataCompressed)
+    {
+        mPreloadedBinaryDataFileName += ".gz";
+    }
+
+    std::string binaryDataDir  = testDataDir;
+    std::string debugOutputDir = gScreenshotDir ? gScreenshotDir : "";
+    std::string fileName       = mPreloadedBinaryDataFileName;
+    bool isCompressed          = traceInfo.isBinaryDataCompressed;
+
+    mPreloadedBinaryData = std::async(std::launch::async, [=]() {
+        std::vector<uint8_t> binaryData;
+        LoadBinaryDataFile(binaryDataDir, debugOutputDir, fileName.c_str(), isCompressed,
+                           &binaryData);
+        return binaryData;
+    });
 }
 
 void TracePerfTest::startTest()
@@ -1983,6 +2027,8 @@ void TracePerfTest::initializeBenchmark()
 {
     const TraceInfo &traceInfo = mParams->traceInfo;
 
+    mReplayThreadId = std::this_thread::get_id();
+
     char testDataDir[kMaxPath] = {};
     if (!FindTraceTestDataPath(traceInfo.name, testDataDir, kMaxPath))
     {
@@ -2035,6 +2081,11 @@ void TracePerfTest::initializeBenchmark()
     {
         mTraceReplay->setDebugOutputDir(gScreenshotDir);
     }
+    if (mPreloadedBinaryData.valid())
+    {
+        mTraceReplay->setPreloadedBinaryData(mPreloadedBinaryDataFileName,
+                                             std::move(mPreloadedBinaryData));
+    }
 
     if (gMinimizeGPUWork)
     {
@@ -2466,6 +2517,14 @@ void TracePerfTest::onEglMakeCurrent(EGLDisplay display,
                                      EGLSurface read,
                                      EGLContext context)
 {
+    // Threaded replays make side contexts current on threads of their own, which can't share the
+    // window surface of the replay thread.
+    if (std::this_thread::get_id() != mReplayThreadId)
+    {
+        eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context);
+        return;
+    }
+
     getGLWindow()->makeCurrentGeneric(reinterpret_cast<GLWindowContext>(context));
 }
 
@@ -20,8 +20,12 @@ enum class TestMode
     BufferData,
     BindBuffer,
     UpdateBufferData,
+    BufferSubData,
 };
 
+// The number of glBufferSubData calls made between draws in the BufferSubData mode.
+constexpr int kBufferSubDataUpdatesPerDraw = 100;
+
 struct VertexArrayParams final : public RenderTestParams
 {
     VertexArrayParams()
@@ -63,6 +67,10 @@ std::string VertexArrayParams::story() const
     {
         strstr << "_updatebufferdata";
     }
+    else if (testMode == TestMode::BufferSubData)
+    {
+        strstr << "_buffersubdata";
+    }
 
     return strstr.str();
 }
@@ -130,6 +138,15 @@ void main()
 
     glBindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, mBuffers[0]);
+
+    if (GetParam().testMode == TestMode::BufferSubData)
+    {
+        glBufferData(GL_ARRAY_BUFFER, GetParam().bufferSize[0], nullptr, GL_DYNAMIC_DRAW);
+        glUseProgram(mProgram);
+        glBindVertexArray(mVertexArrays[0]);
+    }
+
+    ASSERT_GL_NO_ERROR();
 }
 
 void VertexArrayBenchmark::rebindVertexArray(GLuint vertexArrayID, GLuint bufferID)
@@ -173,6 +190,18 @@ void VertexArrayBenchmark::drawBenchmark()
     {
         glBufferData(GL_ARRAY_BUFFER, 128, nullptr, GL_STATIC_DRAW);
     }
+    else if (params.testMode == TestMode::BufferSubData)
+    {
+        // Stream small updates into the buffer of the bound vertex array between draws.
+        const GLuint updateCount = params.bufferSize[0] / sizeof(GLfloat);
+        for (int update = 0; update < kBufferSubDataUpdatesPerDraw; ++update)
+        {
+            const GLfloat value = static_cast<GLfloat>(update);
+            glBufferSubData(GL_ARRAY_BUFFER, (update % updateCount) * sizeof(GLfloat),
+                            sizeof(GLfloat), &value);
+        }
+        glDrawArrays(GL_POINTS, 0, 1);
+    }
     else if (params.testMode == TestMode::UpdateBufferData)
     {
         int bufferSizeIndex = 0;
@@ -227,5 +256,6 @@ ANGLE_INSTANTIATE_TEST(VertexArrayBenchmark,
                        VulkanNullParams(TestMode::BindBuffer),
                        VulkanNullParams(TestMode::BufferData),
                        VulkanNullParams(TestMode::UpdateBufferData),
+                       VulkanNullParams(TestMode::BufferSubData),
                        params::Native(VertexArrayParams()));
 }  // namespace
@@ -21,7 +21,10 @@ constexpr unsigned int kIterationsPerStep = 10;
 
 struct VulkanBarriersPerfParams final : public RenderTestParams
 {
-    VulkanBarriersPerfParams(bool bufferCopy, bool largeTransfers, bool slowFS)
+    VulkanBarriersPerfParams(bool bufferCopy,
+                             bool largeTransfers,
+                             bool slowFS,
+                             bool bufferEvents = false)
     {
         iterationsPerStep = kIterationsPerStep;
 
@@ -36,6 +39,14 @@ struct VulkanBarriersPerfParams final : public RenderTestParams
         doBufferCopy          = bufferCopy;
         doLargeTransfers      = largeTransfers;
         doSlowFragmentShaders = slowFS;
+        useBufferEvents       = bufferEvents;
+
+        // Each buffer copy reads the buffer written by the previous one, in an earlier command
+        // buffer, which can then wait on the event of the previous copy instead of a barrier.
+        if (useBufferEvents)
+        {
+            eglParameters.enable(Feature::UseVkEventForBufferBarrier);
+        }
     }
 
     std::string story() const override;
@@ -47,6 +58,7 @@ struct VulkanBarriersPerfParams final : public RenderTestParams
     bool doBufferCopy;
     bool doLargeTransfers;
     bool doSlowFragmentShaders;
+    bool useBufferEvents;
 };
 
 constexpr int VulkanBarriersPerfParams::kImageSizes[];
@@ -130,6 +142,10 @@ std::string VulkanBarriersPerfParams::story() const
     {
         sout << "_slowfs";
     }
+    if (useBufferEvents)
+    {
+        sout << "_buffer_events";
+    }
 
     return sout.str();
 }
@@ -408,4 +424,6 @@ ANGLE_INSTANTIATE_TEST(VulkanBarriersPerfBenchmark,
                        VulkanBarriersPerfParams(false, false, false),
                        VulkanBarriersPerfParams(true, false, false),
                        VulkanBarriersPerfParams(false, true, false),
-                       VulkanBarriersPerfParams(false, true, true));
+                       VulkanBarriersPerfParams(false, true, true),
+                       VulkanBarriersPerfParams(true, false, false, true),
+                       VulkanBarriersPerfParams(true, true, true, true));
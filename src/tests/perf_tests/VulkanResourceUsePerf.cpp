@@ -0,0 +1,137 @@
+//
+// Copyright 2024 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// VulkanResourceUsePerf:
+//   Performance benchmark for the tracking of resource uses by many contexts, each with its own
+//   queue serial index.  The contexts submit in turn, and every submission is followed by the
+//   garbage collection checks of all resources.  The time per step should remain flat as the
+//   number of contexts grows.
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/renderer/vulkan/vk_resource.h"
+#include "util/random_utils.h"
+
+using namespace rx;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+constexpr size_t kResourceCount           = 4096;
+
+struct Params
+{
+    size_t contextCount;
+};
+
+std::string GetStory(const Params &params)
+{
+    std::stringstream story;
+    story << "_" << params.contextCount << "_contexts";
+    return story.str();
+}
+
+class VulkanResourceUsePerfTest : public ANGLEPerfTest,
+                                  public ::testing::WithParamInterface<Params>
+{
+  public:
+    VulkanResourceUsePerfTest();
+
+    void SetUp() override;
+    void step() override;
+
+  private:
+    struct Resource
+    {
+        vk::ResourceUse use;
+        // The contexts using the resource.  Most resources are private to a context, while some
+        // are shared with another one.
+        std::vector<SerialIndex> users;
+    };
+
+    std::vector<Resource> mResources;
+    // The resources used by each context.
+    std::vector<std::vector<size_t>> mContextResources;
+    std::vector<AtomicSerialFactory> mSerialFactories;
+    AtomicQueueSerialFixedArray mCompletedSerials;
+    size_t mFinishedCount = 0;
+};
+
+VulkanResourceUsePerfTest::VulkanResourceUsePerfTest()
+    : ANGLEPerfTest("VulkanResourceUsePerf", "", GetStory(GetParam()), kIterationsPerStep),
+      mSerialFactories(GetParam().contextCount)
+{}
+
+void VulkanResourceUsePerfTest::SetUp()
+{
+    ANGLEPerfTest::SetUp();
+
+    const size_t contextCount = GetParam().contextCount;
+    ASSERT_LE(contextCount, kMaxQueueSerialIndexCount);
+
+    angle::RNG rng(0x12345678u);
+    mResources.resize(kResourceCount);
+    mContextResources.resize(contextCount);
+    for (size_t resourceIndex = 0; resourceIndex < kResourceCount; ++resourceIndex)
+    {
+        Resource &resource = mResources[resourceIndex];
+        resource.users.push_back(static_cast<SerialIndex>(resourceIndex % contextCount));
+        if (contextCount > 1 && rng.randomIntBetween(0, 7) == 0)
+        {
+            SerialIndex otherUser = static_cast<SerialIndex>(rng.randomIntBetween(
+                0, static_cast<int>(contextCount - 1)));
+            if (otherUser != resource.users[0])
+            {
+                resource.users.push_back(otherUser);
+            }
+        }
+
+        for (SerialIndex user : resource.users)
+        {
+            mContextResources[user].push_back(resourceIndex);
+        }
+    }
+}
+
+void VulkanResourceUsePerfTest::step()
+{
+    const size_t contextCount = GetParam().contextCount;
+
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        for (SerialIndex context = 0; context < contextCount; ++context)
+        {
+            // Record the use of the context's resources by its next submission, and complete it.
+            const QueueSerial submitSerial(context, mSerialFactories[context].generate());
+            for (size_t resourceIndex : mContextResources[context])
+            {
+                mResources[resourceIndex].use.setQueueSerial(submitSerial);
+            }
+            mCompletedSerials.setQueueSerial(submitSerial);
+
+            // Check which resources have finished, like the garbage collection does.
+            for (const Resource &resource : mResources)
+            {
+                if (resource.use <= mCompletedSerials)
+                {
+                    ++mFinishedCount;
+                }
+            }
+        }
+    }
+}
+
+TEST_P(VulkanResourceUsePerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(,
+                         VulkanResourceUsePerfTest,
+                         ::testing::Values(Params{1}, Params{4}, Params{64}, Params{128}),
+                         [](const ::testing::TestParamInfo<Params> &info) {
+                             return GetStory(info.param).substr(1);
+                         });
+}  // anonymous namespace
@@ -0,0 +1,157 @@
+#! /usr/bin/env python3
+#
+# Copyright 2024 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+'''
+extract_trace_shaders.py
+
+Writes the shaders created by the restricted traces to a directory, as a corpus for
+CompilerCorpusPerfTest in angle_white_box_perftests:
+
+    python3 extract_trace_shaders.py --out-dir /tmp/shader_corpus
+    angle_white_box_perftests --gtest_filter=*CompilerCorpus* --shader-corpus /tmp/shader_corpus/corpus.txt
+
+Every shader is written once, to <trace>_<index>.<stage>, and listed in corpus.txt.
+'''
+
+import argparse
+import fnmatch
+import hashlib
+import json
+import logging
+import os
+import re
+import sys
+
+DEFAULT_LOG_LEVEL = 'info'
+CORPUS_FILE_NAME = 'corpus.txt'
+
+SHADER_STAGE_EXTENSIONS = [
+    ('GL_VERTEX_SHADER', 'vert'),
+    ('GL_FRAGMENT_SHADER', 'frag'),
+    ('GL_COMPUTE_SHADER', 'comp'),
+    ('GL_GEOMETRY_SHADER', 'geom'),
+    ('GL_TESS_CONTROL_SHADER', 'tesc'),
+    ('GL_TESS_EVALUATION_SHADER', 'tese'),
+]
+
+# The calls and string sets written by FrameCapture, for example:
+#
+#   CreateShader(GL_VERTEX_SHADER, 43);
+#   glShaderSource(gShaderProgramMap[43], 1, glShaderSource_string_5, &gBinaryData[100]);
+#
+#   const char *const glShaderSource_string_5[] = {
+#   "precision mediump float;\n"
+#   ...
+#   };
+CREATE_SHADER_RE = re.compile(r'CreateShader\((GL_\w+), (\d+)\)')
+SHADER_SOURCE_RE = re.compile(r'glShaderSource\(gShaderProgramMap\[(\d+)\], \d+, (\w+)')
+STRING_SET_RE = re.compile(r'const char \*const (glShaderSource_string_\d+)\[\] = \{(.*?)\n\};',
+                           re.DOTALL)
+STRING_LITERAL_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+CALL_RE = re.compile('|'.join([CREATE_SHADER_RE.pattern, SHADER_SOURCE_RE.pattern]))
+
+
+def decode_string_set(body):
+    # The strings of a set are concatenated, like glShaderSource does.
+    literals = STRING_LITERAL_RE.findall(body)
+    return ''.join(literal.encode('latin-1').decode('unicode_escape') for literal in literals)
+
+
+def get_stage_extension(shader_type):
+    for stage, extension in SHADER_STAGE_EXTENSIONS:
+        if shader_type.startswith(stage):
+            return extension
+    return None
+
+
+def extract_trace_shaders(trace_dir):
+    sources = sorted(
+        os.path.join(trace_dir, name)
+        for name in os.listdir(trace_dir)
+        if name.endswith('.cpp') or name.endswith('.c'))
+
+    contents = []
+    for source in sources:
+        with open(source, encoding='latin-1') as f:
+            contents.append(f.read())
+
+    string_sets = {}
+    for content in contents:
+        for match in STRING_SET_RE.finditer(content):
+            string_sets[match.group(1)] = decode_string_set(match.group(2))
+
+    # Shader ids are reused, so a source belongs to the shader created last with its id.
+    shader_types = {}
+    shaders = []
+    for content in contents:
+        for match in CALL_RE.finditer(content):
+            if match.group(1):
+                shader_types[match.group(2)] = match.group(1)
+                continue
+
+            shader_id, string_set = match.group(3), match.group(4)
+            extension = get_stage_extension(shader_types.get(shader_id, ''))
+            if extension is None or string_set not in string_sets:
+                logging.debug('Skipping %s of shader %s' % (string_set, shader_id))
+                continue
+            shaders.append((extension, string_sets[string_set]))
+    return shaders
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--out-dir', help='Directory to write the corpus to.', required=True)
+    parser.add_argument(
+        '--traces', help='Traces to extract. Supports fnmatch expressions.', default='*')
+    parser.add_argument(
+        '--trace-dir',
+        help='Directory of the traces. Defaults to this directory.',
+        default=os.path.dirname(os.path.abspath(__file__)))
+    parser.add_argument(
+        '-l', '--log', help='Log output level. Default is %s.' % DEFAULT_LOG_LEVEL,
+        default=DEFAULT_LOG_LEVEL)
+    args = parser.parse_args()
+
+    logging.basicConfig(level=args.log.upper())
+
+    with open(os.path.join(args.trace_dir, 'restricted_traces.json')) as f:
+        traces = [trace.split(' ')[0] for trace in json.load(f)['traces']]
+    traces = fnmatch.filter(traces, args.traces)
+
+    os.makedirs(args.out_dir, exist_ok=True)
+
+    seen = set()
+    corpus = []
+    for trace in traces:
+        trace_dir = os.path.join(args.trace_dir, trace)
+        if not os.path.isdir(trace_dir):
+            logging.warning('Skipping %s, which is not downloaded' % trace)
+            continue
+
+        shaders = extract_trace_shaders(trace_dir)
+        written = 0
+        for extension, source in shaders:
+            digest = hashlib.sha1((extension + source).encode('utf-8')).hexdigest()
+            if digest in seen:
+                continue
+            seen.add(digest)
+
+            file_name = '%s_%d.%s' % (trace, written, extension)
+            with open(os.path.join(args.out_dir, file_name), 'w', encoding='utf-8') as out_file:
+                out_file.write(source)
+            corpus.append(file_name)
+            written += 1
+        logging.info('%s: %d shaders' % (trace, written))
+
+    with open(os.path.join(args.out_dir, CORPUS_FILE_NAME), 'w') as corpus_file:
+        corpus_file.write(''.join(file_name + '\n' for file_name in corpus))
+
+    logging.info('Wrote %d shaders to %s' % (len(corpus), args.out_dir))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -293,6 +293,30 @@ def _run_perf(args, common_args, env, steps_per_trial=None):
     return FAIL, None, None
 
 
+def _run_frame_breakdown(args, common_args, env, steps_per_trial=None):
+    # Runs separately from the samples, since recording trace events slows the test down.
+    run_args = common_args + ['--trials', '1', '--frame-breakdown']
+
+    if steps_per_trial:
+        run_args += ['--steps-per-trial', str(steps_per_trial)]
+    else:
+        run_args += ['--trial-time', str(args.trial_time)]
+
+    if not args.smoke_test_mode:
+        run_args += ['--warmup']
+
+    with temporary_dir() as render_output_dir:
+        run_args += ['--render-test-output-dir=%s' % render_output_dir]
+
+        exit_code, output, _ = _run_test_suite(args, run_args, env)
+        if exit_code != EXIT_SUCCESS:
+            raise RuntimeError('%s failed. Output:\n%s' % (args.test_suite, output))
+
+        os.makedirs(args.frame_breakdown_dir, exist_ok=True)
+        for path in glob.glob(os.path.join(render_output_dir, 'frame_breakdown*.json')):
+            shutil.move(path, os.path.join(args.frame_breakdown_dir, os.path.basename(path)))
+
+
 class _MaxErrorsException(Exception):
     pass
 
@@ -414,6 +438,14 @@ def _run_tests(tests, args, extra_flags, env):
             test_histogram_set.Merge(sample_histogram)
             metrics.append(sample_metrics)
 
+        if not results.has_result(test) and args.frame_breakdown_dir:
+            try:
+                _run_frame_breakdown(args, common_args, env, steps_per_trial)
+            except RuntimeError as e:
+                logging.error(e)
+                results.result_fail(test)
+                total_errors += 1
+
         if not results.has_result(test):
             assert len(wall_times) == (args.samples_per_test * args.trials_per_sample)
             stats = _wall_times_stats(wall_times)
@@ -563,6 +595,11 @@ def main():
         '--split-shard-samples',
         help='Attempt to mitigate variance between machines by splitting samples between shards.',
         action='store_true')
+    parser.add_argument(
+        '--frame-breakdown-dir',
+        help='Also runs every test once more with per-frame CPU time by subsystem and GPU time '
+        'by render pass, and writes them to this directory. Compare two directories with '
+        'compare_frame_breakdowns.py.')
     parser.add_argument(
         '--custom-throttling-temp',
         help='Android: custom thermal throttling with limit set to this temperature (off by default)',
@@ -16,6 +16,7 @@ namespace angle
 namespace
 {
 constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
+    {Feature::AdaptSwapchainImageCount, "adaptSwapchainImageCount"},
     {Feature::AddAndTrueToLoopCondition, "addAndTrueToLoopCondition"},
     {Feature::AddMockTextureNoRenderTarget, "addMockTextureNoRenderTarget"},
     {Feature::AdjustClearColorPrecision, "adjustClearColorPrecision"},
@@ -48,10 +49,15 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AlwaysUseStagedBufferUpdates, "alwaysUseStagedBufferUpdates"},
     {Feature::AppendAliasedMemoryDecorations, "appendAliasedMemoryDecorations"},
     {Feature::AsyncCommandBufferResetAndGarbageCleanup, "asyncCommandBufferResetAndGarbageCleanup"},
+    {Feature::AsyncCompileVertexExecutables, "asyncCompileVertexExecutables"},
+    {Feature::AsyncGraphicsPipelineCreationOnCacheMiss, "asyncGraphicsPipelineCreationOnCacheMiss"},
     {Feature::Avoid1BitAlphaTextureFormats, "avoid1BitAlphaTextureFormats"},
     {Feature::AvoidBindFragDataLocation, "avoidBindFragDataLocation"},
     {Feature::AvoidOpSelectWithMismatchingRelaxedPrecision, "avoidOpSelectWithMismatchingRelaxedPrecision"},
     {Feature::AvoidStencilTextureSwizzle, "avoidStencilTextureSwizzle"},
+    {Feature::BakeFlipInSpecConst, "bakeFlipInSpecConst"},
+    {Feature::BakeStaticImmutableSamplers, "bakeStaticImmutableSamplers"},
+    {Feature::BatchQueueSubmitsAcrossContexts, "batchQueueSubmitsAcrossContexts"},
     {Feature::BgraTexImageFormatsBroken, "bgraTexImageFormatsBroken"},
     {Feature::BindCompleteFramebufferForTimerQueries, "bindCompleteFramebufferForTimerQueries"},
     {Feature::BindTransformFeedbackBufferBeforeBindBufferRange, "bindTransformFeedbackBufferBeforeBindBufferRange"},
@@ -59,6 +65,8 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::BottomLeftOriginPresentRegionRectangles, "bottomLeftOriginPresentRegionRectangles"},
     {Feature::BresenhamLineRasterization, "bresenhamLineRasterization"},
     {Feature::CacheCompiledShader, "cacheCompiledShader"},
+    {Feature::CacheCompiledShaderByPreprocessedSource, "cacheCompiledShaderByPreprocessedSource"},
+    {Feature::CacheProgramsAsynchronously, "cacheProgramsAsynchronously"},
     {Feature::CallClearTwice, "callClearTwice"},
     {Feature::ClampArrayAccess, "clampArrayAccess"},
     {Feature::ClampFragDepth, "clampFragDepth"},
@@ -71,10 +79,15 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::CompileJobIsThreadSafe, "compileJobIsThreadSafe"},
     {Feature::CompileMetalShaders, "compileMetalShaders"},
     {Feature::CompressVertexData, "compressVertexData"},
+    {Feature::ConvertUnpackBufferOnGPU, "convertUnpackBufferOnGPU"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization, "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
     {Feature::CopyTextureToBufferForReadOptimization, "copyTextureToBufferForReadOptimization"},
     {Feature::CorruptProgramBinaryForTesting, "corruptProgramBinaryForTesting"},
+    {Feature::CreateDedicatedAsyncQueue, "createDedicatedAsyncQueue"},
     {Feature::DecodeEncodeSRGBForGenerateMipmap, "decodeEncodeSRGBForGenerateMipmap"},
+    {Feature::DeferPostLinkTasksUntilUse, "deferPostLinkTasksUntilUse"},
+    {Feature::DefragmentBufferPools, "defragmentBufferPools"},
+    {Feature::DeliverDebugCallbacksAsynchronously, "deliverDebugCallbacksAsynchronously"},
     {Feature::DepthStencilBlitExtraCopy, "depthStencilBlitExtraCopy"},
     {Feature::DescriptorSetCache, "descriptorSetCache"},
     {Feature::DisableAnisotropicFiltering, "disableAnisotropicFiltering"},
@@ -156,6 +169,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::EnableShaderSubstitution, "enableShaderSubstitution"},
     {Feature::EnableTimestampQueries, "enableTimestampQueries"},
     {Feature::EnableTranslatedShaderSubstitution, "enableTranslatedShaderSubstitution"},
+    {Feature::EncodeRenderPassesInParallel, "encodeRenderPassesInParallel"},
     {Feature::EnsureNonEmptyBufferIsBoundForDraw, "ensureNonEmptyBufferIsBoundForDraw"},
     {Feature::ExpandIntegerPowExpressions, "expandIntegerPowExpressions"},
     {Feature::ExplicitFragmentLocations, "explicitFragmentLocations"},
@@ -207,6 +221,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::HasShaderStencilOutput, "hasShaderStencilOutput"},
     {Feature::HasStencilAutoResolve, "hasStencilAutoResolve"},
     {Feature::HasTextureSwizzle, "hasTextureSwizzle"},
+    {Feature::InferAttachmentStoreOps, "inferAttachmentStoreOps"},
     {Feature::InitFragmentOutputVariables, "initFragmentOutputVariables"},
     {Feature::InitializeCurrentVertexAttributes, "initializeCurrentVertexAttributes"},
     {Feature::InjectAsmStatementIntoLoopBodies, "injectAsmStatementIntoLoopBodies"},
@@ -235,10 +250,12 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::PackLastRowSeparatelyForPaddingInclusion, "packLastRowSeparatelyForPaddingInclusion"},
     {Feature::PackOverlappingRowsSeparatelyPackBuffer, "packOverlappingRowsSeparatelyPackBuffer"},
     {Feature::PadBuffersToMaxVertexAttribStride, "padBuffersToMaxVertexAttribStride"},
+    {Feature::ParallelRenderPassCommandEncoding, "parallelRenderPassCommandEncoding"},
     {Feature::PassHighpToPackUnormSnormBuiltins, "passHighpToPackUnormSnormBuiltins"},
     {Feature::PerFrameWindowSizeQuery, "perFrameWindowSizeQuery"},
     {Feature::PermanentlySwitchToFramebufferFetchMode, "permanentlySwitchToFramebufferFetchMode"},
     {Feature::PersistentlyMappedBuffers, "persistentlyMappedBuffers"},
+    {Feature::PoolUploadStagingTextures, "poolUploadStagingTextures"},
     {Feature::PreAddTexelFetchOffsets, "preAddTexelFetchOffsets"},
     {Feature::PreemptivelyStartProvokingVertexCommandBuffer, "preemptivelyStartProvokingVertexCommandBuffer"},
     {Feature::PreferAggregateBarrierCalls, "preferAggregateBarrierCalls"},
@@ -257,15 +274,19 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::PreferSkippingInvalidateForEmulatedFormats, "preferSkippingInvalidateForEmulatedFormats"},
     {Feature::PreferSubmitAtFBOBoundary, "preferSubmitAtFBOBoundary"},
     {Feature::PreferSubmitOnAnySamplesPassedQueryEnd, "preferSubmitOnAnySamplesPassedQueryEnd"},
+    {Feature::PreferTransientMultisampledRenderbuffers, "preferTransientMultisampledRenderbuffers"},
     {Feature::PreTransformTextureCubeGradDerivatives, "preTransformTextureCubeGradDerivatives"},
+    {Feature::PrewarmInputLayouts, "prewarmInputLayouts"},
     {Feature::PrintMetalShaders, "printMetalShaders"},
     {Feature::PromotePackedFormatsTo8BitPerChannel, "promotePackedFormatsTo8BitPerChannel"},
     {Feature::ProvokingVertex, "provokingVertex"},
     {Feature::QueryCounterBitsGeneratesErrors, "queryCounterBitsGeneratesErrors"},
     {Feature::ReadPixelsUsingImplementationColorReadFormatForNorm16, "readPixelsUsingImplementationColorReadFormatForNorm16"},
     {Feature::ReapplyUBOBindingsAfterUsingBinaryProgram, "reapplyUBOBindingsAfterUsingBinaryProgram"},
+    {Feature::RecycleTextureImages, "recycleTextureImages"},
     {Feature::RegenerateStructNames, "regenerateStructNames"},
     {Feature::RejectWebglShadersWithUndefinedBehavior, "rejectWebglShadersWithUndefinedBehavior"},
+    {Feature::RemoveDeadCodeInSpirv, "removeDeadCodeInSpirv"},
     {Feature::RemoveDynamicIndexingOfSwizzledVector, "removeDynamicIndexingOfSwizzledVector"},
     {Feature::RemoveInvariantAndCentroidForESSL3, "removeInvariantAndCentroidForESSL3"},
     {Feature::RequireGpuFamily2, "requireGpuFamily2"},
@@ -273,6 +294,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ResetTexImage2DBaseLevel, "resetTexImage2DBaseLevel"},
     {Feature::ResyncDepthRangeOnClipControl, "resyncDepthRangeOnClipControl"},
     {Feature::RetainSPIRVDebugInfo, "retainSPIRVDebugInfo"},
+    {Feature::ReuseStreamedVertexData, "reuseStreamedVertexData"},
     {Feature::RewriteFloatUnaryMinusOperator, "rewriteFloatUnaryMinusOperator"},
     {Feature::RewriteRepeatedAssignToSwizzled, "rewriteRepeatedAssignToSwizzled"},
     {Feature::RewriteRowMajorMatrices, "rewriteRowMajorMatrices"},
@@ -286,11 +308,16 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SetDataFasterThanImageUpload, "setDataFasterThanImageUpload"},
     {Feature::SetPrimitiveRestartFixedIndexForDrawArrays, "setPrimitiveRestartFixedIndexForDrawArrays"},
     {Feature::SetZeroLevelBeforeGenerateMipmap, "setZeroLevelBeforeGenerateMipmap"},
+    {Feature::ShardPipelineCacheInBlobCache, "shardPipelineCacheInBlobCache"},
+    {Feature::ShareRendererAcrossDisplays, "shareRendererAcrossDisplays"},
     {Feature::ShiftInstancedArrayDataWithOffset, "shiftInstancedArrayDataWithOffset"},
     {Feature::SingleThreadedTextureDecompression, "singleThreadedTextureDecompression"},
+    {Feature::SkipDrawOnPendingGraphicsPipeline, "skipDrawOnPendingGraphicsPipeline"},
+    {Feature::SkipStateInvalidationOnMakeCurrent, "skipStateInvalidationOnMakeCurrent"},
     {Feature::SkipVSConstantRegisterZero, "skipVSConstantRegisterZero"},
     {Feature::SlowDownMonolithicPipelineCreationForTesting, "slowDownMonolithicPipelineCreationForTesting"},
     {Feature::SrgbBlendingBroken, "srgbBlendingBroken"},
+    {Feature::SubmitPromotedContextCommandsAtRenderPassEnd, "submitPromotedContextCommandsAtRenderPassEnd"},
     {Feature::Supports16BitInputOutput, "supports16BitInputOutput"},
     {Feature::Supports16BitPushConstant, "supports16BitPushConstant"},
     {Feature::Supports16BitStorageBuffer, "supports16BitStorageBuffer"},
@@ -304,6 +331,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsBindMemory2, "supportsBindMemory2"},
     {Feature::SupportsBlendOperationAdvanced, "supportsBlendOperationAdvanced"},
     {Feature::SupportsBlendOperationAdvancedCoherent, "supportsBlendOperationAdvancedCoherent"},
+    {Feature::SupportsCalibratedTimestamps, "supportsCalibratedTimestamps"},
     {Feature::SupportsColorWriteEnable, "supportsColorWriteEnable"},
     {Feature::SupportsComputeTranscodeEtcToBc, "supportsComputeTranscodeEtcToBc"},
     {Feature::SupportsCustomBorderColor, "supportsCustomBorderColor"},
@@ -317,10 +345,13 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsDepthClipControl, "supportsDepthClipControl"},
     {Feature::SupportsDepthStencilIndependentResolveNone, "supportsDepthStencilIndependentResolveNone"},
     {Feature::SupportsDepthStencilResolve, "supportsDepthStencilResolve"},
+    {Feature::SupportsDescriptorBuffer, "supportsDescriptorBuffer"},
+    {Feature::SupportsDescriptorIndexing, "supportsDescriptorIndexing"},
     {Feature::SupportsDynamicRendering, "supportsDynamicRendering"},
     {Feature::SupportsDynamicRenderingLocalRead, "supportsDynamicRenderingLocalRead"},
     {Feature::SupportsExtendedDynamicState, "supportsExtendedDynamicState"},
     {Feature::SupportsExtendedDynamicState2, "supportsExtendedDynamicState2"},
+    {Feature::SupportsExtendedDynamicState3, "supportsExtendedDynamicState3"},
     {Feature::SupportsExternalFenceCapabilities, "supportsExternalFenceCapabilities"},
     {Feature::SupportsExternalFenceFd, "supportsExternalFenceFd"},
     {Feature::SupportsExternalFormatResolve, "supportsExternalFormatResolve"},
@@ -369,6 +400,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsPipelineStatisticsQuery, "supportsPipelineStatisticsQuery"},
     {Feature::SupportsPortabilityEnumeration, "supportsPortabilityEnumeration"},
     {Feature::SupportsPresentation, "supportsPresentation"},
+    {Feature::SupportsPresentWait, "supportsPresentWait"},
     {Feature::SupportsPrimitivesGeneratedQuery, "supportsPrimitivesGeneratedQuery"},
     {Feature::SupportsPrimitiveTopologyListRestart, "supportsPrimitiveTopologyListRestart"},
     {Feature::SupportsProtectedMemory, "supportsProtectedMemory"},
@@ -393,6 +425,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsShaderFramebufferFetchNonCoherentEXT, "supportsShaderFramebufferFetchNonCoherentEXT"},
     {Feature::SupportsShaderInt8, "supportsShaderInt8"},
     {Feature::SupportsShaderNonSemanticInfo, "supportsShaderNonSemanticInfo"},
+    {Feature::SupportsShaderObject, "supportsShaderObject"},
     {Feature::SupportsShaderStencilExport, "supportsShaderStencilExport"},
     {Feature::SupportsSharedPresentableImageExtension, "supportsSharedPresentableImageExtension"},
     {Feature::SupportsSignedZeroInfNanPreserveFp16, "supportsSignedZeroInfNanPreserveFp16"},
@@ -418,6 +451,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SyncDefaultVertexArraysToDefault, "syncDefaultVertexArraysToDefault"},
     {Feature::SyncMonolithicPipelinesToBlobCache, "syncMonolithicPipelinesToBlobCache"},
     {Feature::UnbindFBOBeforeSwitchingContext, "unbindFBOBeforeSwitchingContext"},
+    {Feature::UncompressedProgramCache, "uncompressedProgramCache"},
     {Feature::UncurrentEglSurfaceUponSurfaceDestroy, "uncurrentEglSurfaceUponSurfaceDestroy"},
     {Feature::UnfoldShortCircuits, "unfoldShortCircuits"},
     {Feature::UnpackLastRowSeparatelyForPaddingInclusion, "unpackLastRowSeparatelyForPaddingInclusion"},
@@ -425,6 +459,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UnsizedSRGBReadPixelsDoesntTransform, "unsizedSRGBReadPixelsDoesntTransform"},
     {Feature::UploadDataToIosurfacesWithStagingBuffers, "uploadDataToIosurfacesWithStagingBuffers"},
     {Feature::UploadTextureDataInChunks, "uploadTextureDataInChunks"},
+    {Feature::UseColorBlendEquationDynamicState, "useColorBlendEquationDynamicState"},
     {Feature::UseCullModeDynamicState, "useCullModeDynamicState"},
     {Feature::UseDepthBiasEnableDynamicState, "useDepthBiasEnableDynamicState"},
     {Feature::UseDepthCompareOpDynamicState, "useDepthCompareOpDynamicState"},
@@ -433,18 +468,24 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::UseDualPipelineBlobCacheSlots, "useDualPipelineBlobCacheSlots"},
     {Feature::UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache, "useEmptyBlobsToEraseOldPipelineCacheFromBlobCache"},
     {Feature::UseFrontFaceDynamicState, "useFrontFaceDynamicState"},
+    {Feature::UseHeapsForRenderTargetTextures, "useHeapsForRenderTargetTextures"},
     {Feature::UseIntermediateTextureForGenerateMipmap, "useIntermediateTextureForGenerateMipmap"},
+    {Feature::UseMultiBind, "useMultiBind"},
     {Feature::UseMultipleDescriptorsForExternalFormats, "useMultipleDescriptorsForExternalFormats"},
     {Feature::UseNonZeroStencilWriteMaskStaticState, "useNonZeroStencilWriteMaskStaticState"},
+    {Feature::UsePersistentMappedStreamingBuffer, "usePersistentMappedStreamingBuffer"},
+    {Feature::UsePipelineBinaryArchive, "usePipelineBinaryArchive"},
     {Feature::UsePrimitiveRestartEnableDynamicState, "usePrimitiveRestartEnableDynamicState"},
     {Feature::UseRasterizerDiscardEnableDynamicState, "useRasterizerDiscardEnableDynamicState"},
     {Feature::UseResetCommandBufferBitForSecondaryPools, "useResetCommandBufferBitForSecondaryPools"},
     {Feature::UseShadowBuffersWhenAppropriate, "useShadowBuffersWhenAppropriate"},
+    {Feature::UseSmallImageMemoryPools, "useSmallImageMemoryPools"},
     {Feature::UseStencilOpDynamicState, "useStencilOpDynamicState"},
     {Feature::UseStencilTestEnableDynamicState, "useStencilTestEnableDynamicState"},
     {Feature::UseSystemMemoryForConstantBuffers, "useSystemMemoryForConstantBuffers"},
     {Feature::UseUnusedBlocksWithStandardOrSharedLayout, "useUnusedBlocksWithStandardOrSharedLayout"},
     {Feature::UseVertexInputBindingStrideDynamicState, "useVertexInputBindingStrideDynamicState"},
+    {Feature::UseVkEventForBufferBarrier, "useVkEventForBufferBarrier"},
     {Feature::UseVkEventForImageBarrier, "useVkEventForImageBarrier"},
     {Feature::UseVmaForImageSuballocation, "useVmaForImageSuballocation"},
     {Feature::VaryingsRequireMatchingPrecisionInSpirv, "varyingsRequireMatchingPrecisionInSpirv"},
@@ -452,6 +493,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::VertexIDDoesNotIncludeBaseVertex, "vertexIDDoesNotIncludeBaseVertex"},
     {Feature::WaitIdleBeforeSwapchainRecreation, "waitIdleBeforeSwapchainRecreation"},
     {Feature::WarmUpPipelineCacheAtLink, "warmUpPipelineCacheAtLink"},
+    {Feature::WrapStreamingBuffersWithoutDiscard, "wrapStreamingBuffersWithoutDiscard"},
     {Feature::WrapSwitchInIfTrue, "wrapSwitchInIfTrue"},
     {Feature::WriteHelperSampleMask, "writeHelperSampleMask"},
     {Feature::ZeroMaxLodWorkaround, "zeroMaxLodWorkaround"},
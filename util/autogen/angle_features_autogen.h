@@ -16,6 +16,7 @@ namespace angle
 {
 enum class Feature
 {
+    AdaptSwapchainImageCount,
     AddAndTrueToLoopCondition,
     AddMockTextureNoRenderTarget,
     AdjustClearColorPrecision,
@@ -48,10 +49,15 @@ enum class Feature
     AlwaysUseStagedBufferUpdates,
     AppendAliasedMemoryDecorations,
     AsyncCommandBufferResetAndGarbageCleanup,
+    AsyncCompileVertexExecutables,
+    AsyncGraphicsPipelineCreationOnCacheMiss,
     Avoid1BitAlphaTextureFormats,
     AvoidBindFragDataLocation,
     AvoidOpSelectWithMismatchingRelaxedPrecision,
     AvoidStencilTextureSwizzle,
+    BakeFlipInSpecConst,
+    BakeStaticImmutableSamplers,
+    BatchQueueSubmitsAcrossContexts,
     BgraTexImageFormatsBroken,
     BindCompleteFramebufferForTimerQueries,
     BindTransformFeedbackBufferBeforeBindBufferRange,
@@ -59,6 +65,8 @@ enum class Feature
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
     CacheCompiledShader,
+    CacheCompiledShaderByPreprocessedSource,
+    CacheProgramsAsynchronously,
     CallClearTwice,
     ClampArrayAccess,
     ClampFragDepth,
@@ -71,10 +79,15 @@ enum class Feature
     CompileJobIsThreadSafe,
     CompileMetalShaders,
     CompressVertexData,
+    ConvertUnpackBufferOnGPU,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
     CopyTextureToBufferForReadOptimization,
     CorruptProgramBinaryForTesting,
+    CreateDedicatedAsyncQueue,
     DecodeEncodeSRGBForGenerateMipmap,
+    DeferPostLinkTasksUntilUse,
+    DefragmentBufferPools,
+    DeliverDebugCallbacksAsynchronously,
     DepthStencilBlitExtraCopy,
     DescriptorSetCache,
     DisableAnisotropicFiltering,
@@ -156,6 +169,7 @@ enum class Feature
     EnableShaderSubstitution,
     EnableTimestampQueries,
     EnableTranslatedShaderSubstitution,
+    EncodeRenderPassesInParallel,
     EnsureNonEmptyBufferIsBoundForDraw,
     ExpandIntegerPowExpressions,
     ExplicitFragmentLocations,
@@ -207,6 +221,7 @@ enum class Feature
     HasShaderStencilOutput,
     HasStencilAutoResolve,
     HasTextureSwizzle,
+    InferAttachmentStoreOps,
     InitFragmentOutputVariables,
     InitializeCurrentVertexAttributes,
     InjectAsmStatementIntoLoopBodies,
@@ -235,10 +250,12 @@ enum class Feature
     PackLastRowSeparatelyForPaddingInclusion,
     PackOverlappingRowsSeparatelyPackBuffer,
     PadBuffersToMaxVertexAttribStride,
+    ParallelRenderPassCommandEncoding,
     PassHighpToPackUnormSnormBuiltins,
     PerFrameWindowSizeQuery,
     PermanentlySwitchToFramebufferFetchMode,
     PersistentlyMappedBuffers,
+    PoolUploadStagingTextures,
     PreAddTexelFetchOffsets,
     PreemptivelyStartProvokingVertexCommandBuffer,
     PreferAggregateBarrierCalls,
@@ -257,15 +274,19 @@ enum class Feature
     PreferSkippingInvalidateForEmulatedFormats,
     PreferSubmitAtFBOBoundary,
     PreferSubmitOnAnySamplesPassedQueryEnd,
+    PreferTransientMultisampledRenderbuffers,
     PreTransformTextureCubeGradDerivatives,
+    PrewarmInputLayouts,
     PrintMetalShaders,
     PromotePackedFormatsTo8BitPerChannel,
     ProvokingVertex,
     QueryCounterBitsGeneratesErrors,
     ReadPixelsUsingImplementationColorReadFormatForNorm16,
     ReapplyUBOBindingsAfterUsingBinaryProgram,
+    RecycleTextureImages,
     RegenerateStructNames,
     RejectWebglShadersWithUndefinedBehavior,
+    RemoveDeadCodeInSpirv,
     RemoveDynamicIndexingOfSwizzledVector,
     RemoveInvariantAndCentroidForESSL3,
     RequireGpuFamily2,
@@ -273,6 +294,7 @@ enum class Feature
     ResetTexImage2DBaseLevel,
     ResyncDepthRangeOnClipControl,
     RetainSPIRVDebugInfo,
+    ReuseStreamedVertexData,
     RewriteFloatUnaryMinusOperator,
     RewriteRepeatedAssignToSwizzled,
     RewriteRowMajorMatrices,
@@ -286,11 +308,16 @@ enum class Feature
     SetDataFasterThanImageUpload,
     SetPrimitiveRestartFixedIndexForDrawArrays,
     SetZeroLevelBeforeGenerateMipmap,
+    ShardPipelineCacheInBlobCache,
+    ShareRendererAcrossDisplays,
     ShiftInstancedArrayDataWithOffset,
     SingleThreadedTextureDecompression,
+    SkipDrawOnPendingGraphicsPipeline,
+    SkipStateInvalidationOnMakeCurrent,
     SkipVSConstantRegisterZero,
     SlowDownMonolithicPipelineCreationForTesting,
     SrgbBlendingBroken,
+    SubmitPromotedContextCommandsAtRenderPassEnd,
     Supports16BitInputOutput,
     Supports16BitPushConstant,
     Supports16BitStorageBuffer,
@@ -304,6 +331,7 @@ enum class Feature
     SupportsBindMemory2,
     SupportsBlendOperationAdvanced,
     SupportsBlendOperationAdvancedCoherent,
+    SupportsCalibratedTimestamps,
     SupportsColorWriteEnable,
     SupportsComputeTranscodeEtcToBc,
     SupportsCustomBorderColor,
@@ -317,10 +345,13 @@ enum class Feature
     SupportsDepthClipControl,
     SupportsDepthStencilIndependentResolveNone,
     SupportsDepthStencilResolve,
+    SupportsDescriptorBuffer,
+    SupportsDescriptorIndexing,
     SupportsDynamicRendering,
     SupportsDynamicRenderingLocalRead,
     SupportsExtendedDynamicState,
     SupportsExtendedDynamicState2,
+    SupportsExtendedDynamicState3,
     SupportsExternalFenceCapabilities,
     SupportsExternalFenceFd,
     SupportsExternalFormatResolve,
@@ -369,6 +400,7 @@ enum class Feature
     SupportsPipelineStatisticsQuery,
     SupportsPortabilityEnumeration,
     SupportsPresentation,
+    SupportsPresentWait,
     SupportsPrimitivesGeneratedQuery,
     SupportsPrimitiveTopologyListRestart,
     SupportsProtectedMemory,
@@ -393,6 +425,7 @@ enum class Feature
     SupportsShaderFramebufferFetchNonCoherentEXT,
     SupportsShaderInt8,
     SupportsShaderNonSemanticInfo,
+    SupportsShaderObject,
     SupportsShaderStencilExport,
     SupportsSharedPresentableImageExtension,
     SupportsSignedZeroInfNanPreserveFp16,
@@ -418,6 +451,7 @@ enum class Feature
     SyncDefaultVertexArraysToDefault,
     SyncMonolithicPipelinesToBlobCache,
     UnbindFBOBeforeSwitchingContext,
+    UncompressedProgramCache,
     UncurrentEglSurfaceUponSurfaceDestroy,
     UnfoldShortCircuits,
     UnpackLastRowSeparatelyForPaddingInclusion,
@@ -425,6 +459,7 @@ enum class Feature
     UnsizedSRGBReadPixelsDoesntTransform,
     UploadDataToIosurfacesWithStagingBuffers,
     UploadTextureDataInChunks,
+    UseColorBlendEquationDynamicState,
     UseCullModeDynamicState,
     UseDepthBiasEnableDynamicState,
     UseDepthCompareOpDynamicState,
@@ -433,18 +468,24 @@ enum class Feature
     UseDualPipelineBlobCacheSlots,
     UseEmptyBlobsToEraseOldPipelineCacheFromBlobCache,
     UseFrontFaceDynamicState,
+    UseHeapsForRenderTargetTextures,
     UseIntermediateTextureForGenerateMipmap,
+    UseMultiBind,
     UseMultipleDescriptorsForExternalFormats,
     UseNonZeroStencilWriteMaskStaticState,
+    UsePersistentMappedStreamingBuffer,
+    UsePipelineBinaryArchive,
     UsePrimitiveRestartEnableDynamicState,
     UseRasterizerDiscardEnableDynamicState,
     UseResetCommandBufferBitForSecondaryPools,
     UseShadowBuffersWhenAppropriate,
+    UseSmallImageMemoryPools,
     UseStencilOpDynamicState,
     UseStencilTestEnableDynamicState,
     UseSystemMemoryForConstantBuffers,
     UseUnusedBlocksWithStandardOrSharedLayout,
     UseVertexInputBindingStrideDynamicState,
+    UseVkEventForBufferBarrier,
     UseVkEventForImageBarrier,
     UseVmaForImageSuballocation,
     VaryingsRequireMatchingPrecisionInSpirv,
@@ -452,6 +493,7 @@ enum class Feature
     VertexIDDoesNotIncludeBaseVertex,
     WaitIdleBeforeSwapchainRecreation,
     WarmUpPipelineCacheAtLink,
+    WrapStreamingBuffersWithoutDiscard,
     WrapSwitchInIfTrue,
     WriteHelperSampleMask,
     ZeroMaxLodWorkaround,
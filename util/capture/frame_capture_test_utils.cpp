@@ -271,20 +271,23 @@ TraceLibrary::TraceLibrary(const std::string &traceName,
     mTraceInfo = traceInfo;
 }
 
-uint8_t *TraceLibrary::LoadBinaryData(const char *fileName)
+bool LoadBinaryDataFile(const std::string &binaryDataDir,
+                        const std::string &debugOutputDir,
+                        const char *fileName,
+                        bool isCompressed,
+                        std::vector<uint8_t> *binaryDataOut)
 {
     std::ostringstream pathBuffer;
-    pathBuffer << mBinaryDataDir << "/" << fileName;
+    pathBuffer << binaryDataDir << "/" << fileName;
     FILE *fp = fopen(pathBuffer.str().c_str(), "rb");
     if (fp == 0)
     {
-        fprintf(stderr, "Error loading binary data file: %s\n", fileName);
-        exit(1);
+        return false;
     }
     fseek(fp, 0, SEEK_END);
     long size = ftell(fp);
     fseek(fp, 0, SEEK_SET);
-    if (mTraceInfo.isBinaryDataCompressed)
+    if (isCompressed)
     {
         if (!strstr(fileName, ".gz"))
         {
@@ -300,21 +303,21 @@ uint8_t *TraceLibrary::LoadBinaryData(const char *fileName)
             exit(1);
         }
 
-        if (!UncompressData(compressedData, &mBinaryData))
+        if (!UncompressData(compressedData, binaryDataOut))
         {
             // Workaround for sporadic failures https://issuetracker.google.com/296921272
-            SaveDebugFile(mDebugOutputDir, fileName, ".gzdbg_input.gz", compressedData);
-            SaveDebugFile(mDebugOutputDir, fileName, ".gzdbg_attempt1", mBinaryData);
+            SaveDebugFile(debugOutputDir, fileName, ".gzdbg_input.gz", compressedData);
+            SaveDebugFile(debugOutputDir, fileName, ".gzdbg_attempt1", *binaryDataOut);
             std::vector<uint8_t> uncompressedData;
             bool secondResult = UncompressData(compressedData, &uncompressedData);
-            SaveDebugFile(mDebugOutputDir, fileName, ".gzdbg_attempt2", uncompressedData);
+            SaveDebugFile(debugOutputDir, fileName, ".gzdbg_attempt2", uncompressedData);
             if (!secondResult)
             {
                 std::cerr << "Uncompress retry failed\n";
                 exit(1);
             }
             std::cerr << "Uncompress retry succeeded, moving to mBinaryData\n";
-            mBinaryData = std::move(uncompressedData);
+            *binaryDataOut = std::move(uncompressedData);
         }
     }
     else
@@ -324,11 +327,41 @@ uint8_t *TraceLibrary::LoadBinaryData(const char *fileName)
             fprintf(stderr, "Filename does not end in .angledata");
             exit(1);
         }
-        mBinaryData.resize(size + 1);
-        (void)fread(mBinaryData.data(), 1, size, fp);
+        binaryDataOut->resize(size + 1);
+        (void)fread(binaryDataOut->data(), 1, size, fp);
     }
     fclose(fp);
 
+    return true;
+}
+
+void TraceLibrary::setPreloadedBinaryData(const std::string &fileName,
+                                          std::future<std::vector<uint8_t>> &&binaryData)
+{
+    mPreloadedBinaryDataFileName = fileName;
+    mPreloadedBinaryData         = std::move(binaryData);
+}
+
+uint8_t *TraceLibrary::LoadBinaryData(const char *fileName)
+{
+    if (mPreloadedBinaryData.valid() && mPreloadedBinaryDataFileName == fileName)
+    {
+        mBinaryData = mPreloadedBinaryData.get();
+
+        // An empty preload failed to open the file, and is reported below.
+        if (!mBinaryData.empty())
+        {
+            return mBinaryData.data();
+        }
+    }
+
+    if (!LoadBinaryDataFile(mBinaryDataDir, mDebugOutputDir, fileName,
+                            mTraceInfo.isBinaryDataCompressed, &mBinaryData))
+    {
+        fprintf(stderr, "Error loading binary data file: %s\n", fileName);
+        exit(1);
+    }
+
     return mBinaryData.data();
 }
 
@@ -10,6 +10,7 @@
 #ifndef UTIL_CAPTURE_FRAME_CAPTURE_TEST_UTILS_H_
 #define UTIL_CAPTURE_FRAME_CAPTURE_TEST_UTILS_H_
 
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -94,6 +95,11 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
         mTraceFunctions->SetTraceGzPath(traceGzPath);
     }
 
+    // Hands over a binary data file that is loading ahead of the replay, so that LoadBinaryData()
+    // only waits for the load to finish when the replay asks for the file.
+    void setPreloadedBinaryData(const std::string &fileName,
+                                std::future<std::vector<uint8_t>> &&binaryData);
+
   private:
     template <typename FuncT, typename... ArgsT>
     typename std::invoke_result<FuncT, ArgsT...>::type callFunc(const char *funcName, ArgsT... args)
@@ -112,6 +118,8 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
 
     std::unique_ptr<Library> mTraceLibrary;
     std::vector<uint8_t> mBinaryData;
+    std::string mPreloadedBinaryDataFileName;
+    std::future<std::vector<uint8_t>> mPreloadedBinaryData;
     std::string mBinaryDataDir;
     std::string mDebugOutputDir;
     angle::TraceInfo mTraceInfo;
@@ -119,6 +127,14 @@ class TraceLibrary : angle::NonCopyable, angle::TraceCallbacks
 };
 
 bool LoadTraceNamesFromJSON(const std::string jsonFilePath, std::vector<std::string> *namesOut);
+
+// Reads a binary data file of a trace, decompressing it if needed.  Returns false if the file
+// can't be opened.
+bool LoadBinaryDataFile(const std::string &binaryDataDir,
+                        const std::string &debugOutputDir,
+                        const char *fileName,
+                        bool isCompressed,
+                        std::vector<uint8_t> *binaryDataOut);
 bool LoadTraceInfoFromJSON(const std::string &traceName,
                            const std::string &traceJsonPath,
                            TraceInfo *traceInfoOut);
@@ -75,6 +75,7 @@ ANGLE_TRACE_LOADER_EXPORT PFNEGLACQUIREEXTERNALCONTEXTANGLEPROC t_eglAcquireExte
 ANGLE_TRACE_LOADER_EXPORT PFNEGLRELEASEEXTERNALCONTEXTANGLEPROC t_eglReleaseExternalContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNEGLQUERYDISPLAYATTRIBANGLEPROC t_eglQueryDisplayAttribANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNEGLQUERYSTRINGIANGLEPROC t_eglQueryStringiANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNEGLHANDLEMEMORYPRESSUREANGLEPROC t_eglHandleMemoryPressureANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNEGLCOPYMETALSHAREDEVENTANGLEPROC t_eglCopyMetalSharedEventANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNEGLSETVALIDATIONENABLEDANGLEPROC t_eglSetValidationEnabledANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNEGLFORCEGPUSWITCHANGLEPROC t_eglForceGPUSwitchANGLE;
@@ -230,6 +231,8 @@ void LoadTraceEGL(LoadProc loadProc)
         reinterpret_cast<PFNEGLQUERYDISPLAYATTRIBANGLEPROC>(loadProc("eglQueryDisplayAttribANGLE"));
     t_eglQueryStringiANGLE =
         reinterpret_cast<PFNEGLQUERYSTRINGIANGLEPROC>(loadProc("eglQueryStringiANGLE"));
+    t_eglHandleMemoryPressureANGLE = reinterpret_cast<PFNEGLHANDLEMEMORYPRESSUREANGLEPROC>(
+        loadProc("eglHandleMemoryPressureANGLE"));
     t_eglCopyMetalSharedEventANGLE = reinterpret_cast<PFNEGLCOPYMETALSHAREDEVENTANGLEPROC>(
         loadProc("eglCopyMetalSharedEventANGLE"));
     t_eglSetValidationEnabledANGLE = reinterpret_cast<PFNEGLSETVALIDATIONENABLEDANGLEPROC>(
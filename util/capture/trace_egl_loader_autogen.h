@@ -76,6 +76,7 @@
 #define eglReleaseExternalContextANGLE t_eglReleaseExternalContextANGLE
 #define eglQueryDisplayAttribANGLE t_eglQueryDisplayAttribANGLE
 #define eglQueryStringiANGLE t_eglQueryStringiANGLE
+#define eglHandleMemoryPressureANGLE t_eglHandleMemoryPressureANGLE
 #define eglCopyMetalSharedEventANGLE t_eglCopyMetalSharedEventANGLE
 #define eglSetValidationEnabledANGLE t_eglSetValidationEnabledANGLE
 #define eglForceGPUSwitchANGLE t_eglForceGPUSwitchANGLE
@@ -204,6 +205,7 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNEGLRELEASEEXTERNALCONTEXTANGLEPROC
     t_eglReleaseExternalContextANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNEGLQUERYDISPLAYATTRIBANGLEPROC t_eglQueryDisplayAttribANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNEGLQUERYSTRINGIANGLEPROC t_eglQueryStringiANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNEGLHANDLEMEMORYPRESSUREANGLEPROC t_eglHandleMemoryPressureANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNEGLCOPYMETALSHAREDEVENTANGLEPROC t_eglCopyMetalSharedEventANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNEGLSETVALIDATIONENABLEDANGLEPROC t_eglSetValidationEnabledANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNEGLFORCEGPUSWITCHANGLEPROC t_eglForceGPUSwitchANGLE;
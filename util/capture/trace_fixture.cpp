@@ -11,7 +11,12 @@
 
 #include "angle_trace_gl.h"
 
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 
 namespace
 {
@@ -68,10 +73,15 @@ ValidateSerializedStateCallback gValidateSerializedStateCallback;
 std::unordered_map<GLuint, std::vector<GLint>> gInternalUniformLocationsMap;
 
 constexpr size_t kMaxClientArrays = 16;
+
+// Sizes of the scratch buffers, which threads running side contexts allocate for themselves.
+size_t gMaxClientArraySize   = 0;
+size_t gReadBufferSize       = 0;
+size_t gResourceIDBufferSize = 0;
 }  // namespace
 
 GLint **gUniformLocations;
-GLuint gCurrentProgram = 0;
+ANGLE_REPLAY_THREAD_LOCAL GLuint gCurrentProgram = 0;
 
 // TODO(jmadill): Hide from the traces. http://anglebug.com/42266223
 BlockIndexesMap gUniformBlockIndexes;
@@ -115,9 +125,9 @@ void UpdateCurrentProgram(GLuint program)
 }
 
 uint8_t *gBinaryData;
-uint8_t *gReadBuffer;
-uint8_t *gClientArrays[kMaxClientArrays];
-GLuint *gResourceIDBuffer;
+ANGLE_REPLAY_THREAD_LOCAL uint8_t *gReadBuffer;
+ANGLE_REPLAY_THREAD_LOCAL uint8_t *gClientArrays[kMaxClientArrays];
+ANGLE_REPLAY_THREAD_LOCAL GLuint *gResourceIDBuffer;
 SyncResourceMap gSyncMap;
 ContextMap gContextMap;
 GLuint gShareContextId;
@@ -166,6 +176,122 @@ GLuint *AllocateZeroedUints(size_t count)
     return AllocateZeroedValues<GLuint>(count);
 }
 
+namespace
+{
+// Runs the replay functions of a side context in a threaded replay.
+class ContextThread final
+{
+  public:
+    explicit ContextThread(GLuint contextID)
+        : mContextID(contextID), mThread(&ContextThread::threadMain, this)
+    {}
+
+    ~ContextThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mExit = true;
+        }
+        mWorkCondition.notify_one();
+        mThread.join();
+    }
+
+    // A null function releases the context.
+    void run(void (*replayFunc)(void))
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mReplayFuncs.push_back(replayFunc);
+        }
+        mWorkCondition.notify_one();
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mIdleCondition.wait(lock, [this] { return mReplayFuncs.empty() && !mIsRunning; });
+    }
+
+  private:
+    void threadMain()
+    {
+        for (uint8_t *&clientArray : gClientArrays)
+        {
+            clientArray = new uint8_t[gMaxClientArraySize];
+        }
+        gReadBuffer       = new uint8_t[gReadBufferSize];
+        gResourceIDBuffer = AllocateZeroedUints(gResourceIDBufferSize);
+
+        bool isCurrent = false;
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true)
+        {
+            mWorkCondition.wait(lock, [this] { return mExit || !mReplayFuncs.empty(); });
+            if (mReplayFuncs.empty())
+            {
+                break;
+            }
+
+            void (*replayFunc)(void) = mReplayFuncs.front();
+            mReplayFuncs.pop_front();
+            mIsRunning = true;
+            lock.unlock();
+
+            if (replayFunc == nullptr)
+            {
+                if (isCurrent)
+                {
+                    eglMakeCurrent(gEGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+                    isCurrent = false;
+                }
+            }
+            else
+            {
+                if (!isCurrent)
+                {
+                    eglMakeCurrent(gEGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                                   gContextMap2[mContextID]);
+                    isCurrent = true;
+                }
+                replayFunc();
+            }
+
+            lock.lock();
+            mIsRunning = false;
+            if (mReplayFuncs.empty())
+            {
+                mIdleCondition.notify_all();
+            }
+        }
+        lock.unlock();
+
+        if (isCurrent)
+        {
+            eglMakeCurrent(gEGLDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+        }
+
+        for (uint8_t *&clientArray : gClientArrays)
+        {
+            delete[] clientArray;
+        }
+        delete[] gReadBuffer;
+        delete[] gResourceIDBuffer;
+    }
+
+    GLuint mContextID;
+    std::mutex mMutex;
+    std::condition_variable mWorkCondition;
+    std::condition_variable mIdleCondition;
+    std::deque<void (*)(void)> mReplayFuncs;
+    bool mIsRunning = false;
+    bool mExit      = false;
+    std::thread mThread;
+};
+
+// Only accessed by the replay thread.
+std::unordered_map<GLuint, std::unique_ptr<ContextThread>> gContextThreads;
+}  // namespace
+
 void InitializeReplay4(const char *binaryDataFileName,
                        size_t maxClientArraySize,
                        size_t readBufferSize,
@@ -236,8 +362,9 @@ void InitializeReplay3(const char *binaryDataFileName,
                       maxShaderProgram, maxSurface, maxTexture, maxTransformFeedback,
                       maxVertexArray);
 
-    gSyncMap2         = AllocateZeroedValues<GLsync>(maxSync);
-    gResourceIDBuffer = AllocateZeroedUints(resourceIDBufferSize);
+    gSyncMap2             = AllocateZeroedValues<GLsync>(maxSync);
+    gResourceIDBuffer     = AllocateZeroedUints(resourceIDBufferSize);
+    gResourceIDBufferSize = resourceIDBufferSize;
 }
 
 void InitializeReplay2(const char *binaryDataFileName,
@@ -302,6 +429,9 @@ void InitializeReplay(const char *binaryDataFileName,
 
     gReadBuffer = new uint8_t[readBufferSize];
 
+    gMaxClientArraySize = maxClientArraySize;
+    gReadBufferSize     = readBufferSize;
+
     gBufferMap            = AllocateZeroedUints(maxBuffer);
     gFenceNVMap           = AllocateZeroedUints(maxFenceNV);
     gFramebufferMap       = AllocateZeroedUints(maxFramebuffer);
@@ -324,6 +454,8 @@ void InitializeReplay(const char *binaryDataFileName,
 
 void FinishReplay()
 {
+    gContextThreads.clear();
+
     for (uint8_t *&clientArray : gClientArrays)
     {
         delete[] clientArray;
@@ -708,6 +840,33 @@ void SetCurrentContextID(GLuint id)
     gContextMap2[id] = eglGetCurrentContext();
 }
 
+void RunOnContextThread(GLuint contextID, void (*replayFunc)(void))
+{
+    std::unique_ptr<ContextThread> &contextThread = gContextThreads[contextID];
+    if (!contextThread)
+    {
+        contextThread = std::make_unique<ContextThread>(contextID);
+    }
+    contextThread->run(replayFunc);
+}
+
+void WaitForContextThread(GLuint contextID)
+{
+    gContextThreads[contextID]->wait();
+}
+
+void WaitForContextThreads(void)
+{
+    for (auto &contextThread : gContextThreads)
+    {
+        contextThread.second->run(nullptr);
+    }
+    for (auto &contextThread : gContextThreads)
+    {
+        contextThread.second->wait();
+    }
+}
+
 ANGLE_REPLAY_EXPORT PFNEGLCREATEIMAGEPROC r_eglCreateImage;
 ANGLE_REPLAY_EXPORT PFNEGLCREATEIMAGEKHRPROC r_eglCreateImageKHR;
 ANGLE_REPLAY_EXPORT PFNEGLDESTROYIMAGEPROC r_eglDestroyImage;
@@ -20,6 +20,14 @@
 #include "trace_interface.h"
 #include "traces_export.h"
 
+// The scratch buffers the replay calls use are per thread, as threaded replays run the calls of
+// side contexts on threads of their own.
+#if defined(__cplusplus)
+#    define ANGLE_REPLAY_THREAD_LOCAL thread_local
+#else
+#    define ANGLE_REPLAY_THREAD_LOCAL _Thread_local
+#endif  // defined(__cplusplus)
+
 #if defined(__cplusplus)
 #    include <cstdio>
 #    include <cstring>
@@ -70,7 +78,7 @@ ANGLE_REPLAY_EXPORT void SetupEntryPoints(angle::TraceCallbacks *traceCallbacks,
 
 // Maps from <captured Program ID, captured location> to run-time location.
 extern GLint **gUniformLocations;
-extern GLuint gCurrentProgram;
+extern ANGLE_REPLAY_THREAD_LOCAL GLuint gCurrentProgram;
 
 void UpdateUniformLocation(GLuint program, const char *name, GLint location, GLint count);
 void DeleteUniformLocations(GLuint program);
@@ -81,9 +89,9 @@ void UpdateCurrentProgram(GLuint program);
 // Global state
 
 extern uint8_t *gBinaryData;
-extern uint8_t *gReadBuffer;
-extern uint8_t *gClientArrays[];
-extern GLuint *gResourceIDBuffer;
+extern ANGLE_REPLAY_THREAD_LOCAL uint8_t *gReadBuffer;
+extern ANGLE_REPLAY_THREAD_LOCAL uint8_t *gClientArrays[];
+extern ANGLE_REPLAY_THREAD_LOCAL GLuint *gResourceIDBuffer;
 
 extern GLuint *gBufferMap;
 extern GLuint *gFenceNVMap;
@@ -272,6 +280,14 @@ void CreatePbufferSurface(EGLDisplay dpy,
 void CreateNativeClientBufferANDROID(const EGLint *attrib_list, uintptr_t clientBuffer);
 void CreateContext(GLuint contextID);
 
+// Threaded replays queue the calls of side contexts on a thread per context, which makes the
+// context current before it runs them.  WaitForContextThreads() waits for all of them at the end
+// of the frame and releases their contexts, so the contexts can be made current on the replay
+// thread again.
+void RunOnContextThread(GLuint contextID, void (*replayFunc)(void));
+void WaitForContextThread(GLuint contextID);
+void WaitForContextThreads(void);
+
 void ValidateSerializedState(const char *serializedState, const char *fileName, uint32_t line);
 #define VALIDATE_CHECKPOINT(STATE) ValidateSerializedState(STATE, __FILE__, __LINE__)
 
@@ -4,7 +4,7 @@
 // found in the LICENSE file.
 //
 // trace_interpreter.cpp:
-//   Parser and interpreter for the C-based replays.
+//   Parser and interpreter for the C-based replays, and the binary call stream cached from them.
 //
 
 #include "trace_interpreter.h"
@@ -34,16 +34,396 @@ void ReplayTraceFunction(const TraceFunction &func, const TraceFunctionMap &cust
     }
 }
 
+void AddTraceFunction(const std::string &funcName, TraceFunction &func, TraceFunctionMap &functions)
+{
+    // Run initialize immediately so we can load the binary data.
+    if (funcName == "InitReplay")
+    {
+        ReplayTraceFunction(func, {});
+        func.clear();
+    }
+    functions[funcName] = std::move(func);
+}
+
+size_t GetFileSizeOrZero(const std::string &path)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr)
+    {
+        return 0;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fclose(fp);
+    return size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+uint32_t GetStringArrayOffset(const Token &token, const char *prefixString)
+{
+    const char *offsetString = &token[strlen(prefixString)];
+    return atoi(offsetString);
+}
+
+// The call stream is a binary form of the parsed trace functions, cached next to the trace so
+// later runs skip parsing the C sources.  Parameter values are stored as-is, except for pointers
+// into the replay's global buffers, which are stored as offsets and relocated on load.  Records
+// are kept in parse order, so InitReplay runs before the functions that point into its buffers.
+constexpr char kCallStreamMagic[8]         = "ANGLECS";
+constexpr uint32_t kCallStreamVersion      = 1;
+constexpr const char *kCallStreamExtension = ".calls";
+
+enum class CallStreamRecord : uint8_t
+{
+    String,
+    Function,
+};
+
+enum class CallStreamParamKind : uint8_t
+{
+    Value,
+    InlineString,
+    BinaryData,
+    ReadBuffer,
+    ResourceIDBuffer,
+    ClientArray,
+    StringArray,
+};
+
+class CallStreamWriter : angle::NonCopyable
+{
+  public:
+    explicit CallStreamWriter(uint64_t sourceSize)
+    {
+        writeBytes(kCallStreamMagic, sizeof(kCallStreamMagic));
+        write<uint32_t>(kCallStreamVersion);
+        write<uint32_t>(sizeof(void *));
+        write<uint32_t>(sizeof(ParamValue));
+        write<uint64_t>(sourceSize);
+    }
+
+    void addString(const std::string &name, const TraceString &traceStr)
+    {
+        write(CallStreamRecord::String);
+        writeString(name);
+        write<uint32_t>(static_cast<uint32_t>(traceStr.strings.size()));
+        for (const std::string &str : traceStr.strings)
+        {
+            writeString(str);
+        }
+    }
+
+    void beginFunction(const std::string &name)
+    {
+        write(CallStreamRecord::Function);
+        writeString(name);
+        mCallCountOffset = mData.size();
+        mCallCount       = 0;
+        write<uint32_t>(0);
+    }
+
+    void addCall(const CallCapture &call, const Token *paramTokens)
+    {
+        write(call.entryPoint);
+        if (call.entryPoint == EntryPoint::Invalid)
+        {
+            writeString(call.customFunctionName);
+        }
+
+        const std::vector<ParamCapture> &captures = call.params.getParamCaptures();
+        write<uint32_t>(static_cast<uint32_t>(captures.size()));
+        for (size_t paramIndex = 0; paramIndex < captures.size(); ++paramIndex)
+        {
+            addParam(captures[paramIndex], paramTokens[paramIndex]);
+        }
+
+        mCallCount++;
+    }
+
+    void endFunction()
+    {
+        memcpy(&mData[mCallCountOffset], &mCallCount, sizeof(mCallCount));
+    }
+
+    bool save(const std::string &path) const
+    {
+        FILE *fp = fopen(path.c_str(), "wb");
+        if (fp == nullptr)
+        {
+            return false;
+        }
+        size_t written = fwrite(mData.data(), 1, mData.size(), fp);
+        fclose(fp);
+        return written == mData.size();
+    }
+
+  private:
+    // Mirrors the pointer tokens handled by PackConstPointerParameter and
+    // PackMutablePointerParameter.
+    void addParam(const ParamCapture &param, const Token &token)
+    {
+        write(param.type);
+
+        if (param.type == ParamType::TGLcharConstPointerPointer)
+        {
+            write(CallStreamParamKind::StringArray);
+            writeString(token);
+        }
+        else if (!param.data.empty())
+        {
+            write(CallStreamParamKind::InlineString);
+            write<uint32_t>(static_cast<uint32_t>(param.data[0].size()));
+            writeBytes(param.data[0].data(), param.data[0].size());
+        }
+        else if (BeginsWith(token, "&gBinaryData["))
+        {
+            write(CallStreamParamKind::BinaryData);
+            write<uint32_t>(GetStringArrayOffset(token, "&gBinaryData["));
+        }
+        else if (BeginsWith(token, "&gReadBuffer["))
+        {
+            write(CallStreamParamKind::ReadBuffer);
+            write<uint32_t>(GetStringArrayOffset(token, "&gReadBuffer["));
+        }
+        else if (strcmp(token, "gReadBuffer") == 0)
+        {
+            write(CallStreamParamKind::ReadBuffer);
+            write<uint32_t>(0);
+        }
+        else if (strcmp(token, "gResourceIDBuffer") == 0)
+        {
+            write(CallStreamParamKind::ResourceIDBuffer);
+        }
+        else if (BeginsWith(token, "gClientArrays["))
+        {
+            write(CallStreamParamKind::ClientArray);
+            write<uint32_t>(GetStringArrayOffset(token, "gClientArrays["));
+        }
+        else
+        {
+            write(CallStreamParamKind::Value);
+            writeBytes(&param.value, sizeof(param.value));
+        }
+    }
+
+    template <typename T>
+    void write(T value)
+    {
+        writeBytes(&value, sizeof(value));
+    }
+
+    void writeString(const std::string &str)
+    {
+        write<uint32_t>(static_cast<uint32_t>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+
+    void writeBytes(const void *bytes, size_t size)
+    {
+        const uint8_t *begin = reinterpret_cast<const uint8_t *>(bytes);
+        mData.insert(mData.end(), begin, begin + size);
+    }
+
+    std::vector<uint8_t> mData;
+    size_t mCallCountOffset = 0;
+    uint32_t mCallCount     = 0;
+};
+
+// Decodes the call stream in place.  Inline strings point straight into |data|, which must
+// outlive the decoded functions.
+class CallStreamReader : angle::NonCopyable
+{
+  public:
+    CallStreamReader(const std::vector<uint8_t> &data,
+                     TraceFunctionMap &functionsIn,
+                     TraceStringMap &stringsIn)
+        : mData(data), mFunctions(functionsIn), mStrings(stringsIn), mIndex(0)
+    {}
+
+    bool checkHeader(uint64_t sourceSize)
+    {
+        if (mData.size() < sizeof(kCallStreamMagic) + 3 * sizeof(uint32_t) + sizeof(uint64_t) ||
+            memcmp(mData.data(), kCallStreamMagic, sizeof(kCallStreamMagic)) != 0)
+        {
+            return false;
+        }
+        mIndex = sizeof(kCallStreamMagic);
+
+        return read<uint32_t>() == kCallStreamVersion && read<uint32_t>() == sizeof(void *) &&
+               read<uint32_t>() == sizeof(ParamValue) && read<uint64_t>() == sourceSize;
+    }
+
+    void readAll()
+    {
+        while (mIndex < mData.size())
+        {
+            switch (read<CallStreamRecord>())
+            {
+                case CallStreamRecord::String:
+                    readString();
+                    break;
+                case CallStreamRecord::Function:
+                    readFunction();
+                    break;
+                default:
+                    printf("Corrupt trace call stream at offset %zu\n", mIndex);
+                    UNREACHABLE();
+                    return;
+            }
+        }
+    }
+
+  private:
+    void readString()
+    {
+        std::string name = readStdString();
+        TraceString traceStr;
+
+        uint32_t count = read<uint32_t>();
+        for (uint32_t index = 0; index < count; ++index)
+        {
+            traceStr.strings.push_back(readStdString());
+        }
+        for (const std::string &cppstr : traceStr.strings)
+        {
+            traceStr.pointers.push_back(cppstr.c_str());
+        }
+
+        mStrings[name] = std::move(traceStr);
+    }
+
+    void readFunction()
+    {
+        std::string funcName = readStdString();
+        TraceFunction func;
+
+        uint32_t callCount = read<uint32_t>();
+        func.reserve(callCount);
+        for (uint32_t callIndex = 0; callIndex < callCount; ++callIndex)
+        {
+            EntryPoint entryPoint = read<EntryPoint>();
+            std::string customFunctionName;
+            if (entryPoint == EntryPoint::Invalid)
+            {
+                customFunctionName = readStdString();
+            }
+
+            ParamBuffer params;
+            uint32_t paramCount = read<uint32_t>();
+            for (uint32_t paramIndex = 0; paramIndex < paramCount; ++paramIndex)
+            {
+                readParam(params);
+            }
+
+            if (entryPoint == EntryPoint::Invalid)
+            {
+                func.emplace_back(customFunctionName, std::move(params));
+            }
+            else
+            {
+                func.emplace_back(entryPoint, std::move(params));
+            }
+        }
+
+        AddTraceFunction(funcName, func, mFunctions);
+    }
+
+    void readParam(ParamBuffer &params)
+    {
+        ParamType type = read<ParamType>();
+        ParamCapture param(params.getNextParamName(), type);
+
+        switch (read<CallStreamParamKind>())
+        {
+            case CallStreamParamKind::Value:
+                memcpy(&param.value, readBytes(sizeof(param.value)), sizeof(param.value));
+                break;
+            case CallStreamParamKind::InlineString:
+            {
+                uint32_t size = read<uint32_t>();
+                setPointer(&param.value, readBytes(size));
+                break;
+            }
+            case CallStreamParamKind::BinaryData:
+                ASSERT(gBinaryData);
+                setPointer(&param.value, &gBinaryData[read<uint32_t>()]);
+                break;
+            case CallStreamParamKind::ReadBuffer:
+                setPointer(&param.value, &gReadBuffer[read<uint32_t>()]);
+                break;
+            case CallStreamParamKind::ResourceIDBuffer:
+                setPointer(&param.value, gResourceIDBuffer);
+                break;
+            case CallStreamParamKind::ClientArray:
+                setPointer(&param.value, gClientArrays[read<uint32_t>()]);
+                break;
+            case CallStreamParamKind::StringArray:
+            {
+                std::string name = readStdString();
+                auto iter        = mStrings.find(name);
+                if (iter == mStrings.end())
+                {
+                    printf("Could not find string: %s\n", name.c_str());
+                    UNREACHABLE();
+                    break;
+                }
+                setPointer(&param.value, iter->second.pointers.data());
+                break;
+            }
+            default:
+                UNREACHABLE();
+                break;
+        }
+
+        params.addParam(std::move(param));
+    }
+
+    // All pointer members of ParamValue share its storage, so the type of the pointer is
+    // irrelevant here.
+    static void setPointer(ParamValue *value, const void *pointer)
+    {
+        memcpy(value, &pointer, sizeof(pointer));
+    }
+
+    template <typename T>
+    T read()
+    {
+        T value;
+        memcpy(&value, readBytes(sizeof(value)), sizeof(value));
+        return value;
+    }
+
+    std::string readStdString()
+    {
+        uint32_t size = read<uint32_t>();
+        return std::string(reinterpret_cast<const char *>(readBytes(size)), size);
+    }
+
+    const uint8_t *readBytes(size_t size)
+    {
+        ASSERT(mIndex + size <= mData.size());
+        const uint8_t *bytes = &mData[mIndex];
+        mIndex += size;
+        return bytes;
+    }
+
+    const std::vector<uint8_t> &mData;
+    TraceFunctionMap &mFunctions;
+    TraceStringMap &mStrings;
+    size_t mIndex;
+};
+
 class Parser : angle::NonCopyable
 {
   public:
     Parser(const std::string &stream,
            TraceFunctionMap &functionsIn,
            TraceStringMap &stringsIn,
+           CallStreamWriter *callStreamWriter,
            bool verboseLogging)
         : mStream(stream),
           mFunctions(functionsIn),
           mStrings(stringsIn),
+          mCallStreamWriter(callStreamWriter),
           mIndex(0),
           mVerboseLogging(verboseLogging)
     {}
@@ -210,6 +590,11 @@ class Parser : angle::NonCopyable
             return;
         }
 
+        if (mCallStreamWriter)
+        {
+            mCallStreamWriter->beginFunction(funcName);
+        }
+
         skipLine();
         ASSERT(peek() == '{');
         skipLine();
@@ -265,12 +650,20 @@ class Parser : angle::NonCopyable
 
             // We pass in the strings for specific use with C string array parameters.
             CallCapture call = ParseCallCapture(nameToken, numParams, paramTokens, mStrings);
+            if (mCallStreamWriter)
+            {
+                mCallStreamWriter->addCall(call, paramTokens);
+            }
             func.push_back(std::move(call));
             skipLine();
         }
         skipLine();
 
-        addFunction(funcName, func);
+        if (mCallStreamWriter)
+        {
+            mCallStreamWriter->endFunction();
+        }
+        AddTraceFunction(funcName, func, mFunctions);
     }
 
     void readMultilineString()
@@ -309,23 +702,17 @@ class Parser : angle::NonCopyable
             traceStr.pointers.push_back(cppstr.c_str());
         }
 
-        mStrings[name] = std::move(traceStr);
-    }
-
-    void addFunction(const std::string &funcName, TraceFunction &func)
-    {
-        // Run initialize immediately so we can load the binary data.
-        if (funcName == "InitReplay")
+        if (mCallStreamWriter)
         {
-            ReplayTraceFunction(func, {});
-            func.clear();
+            mCallStreamWriter->addString(name, traceStr);
         }
-        mFunctions[funcName] = std::move(func);
+        mStrings[name] = std::move(traceStr);
     }
 
     const std::string &mStream;
     TraceFunctionMap &mFunctions;
     TraceStringMap &mStrings;
+    CallStreamWriter *mCallStreamWriter;
     size_t mIndex;
     bool mVerboseLogging = false;
 };
@@ -430,12 +817,6 @@ void PackIntParameter(ParamBuffer &params, ParamType paramType, const Token &tok
     params.addUnnamedParam(paramType, value);
 }
 
-uint32_t GetStringArrayOffset(const Token &token, const char *prefixString)
-{
-    const char *offsetString = &token[strlen(prefixString)];
-    return atoi(offsetString);
-}
-
 template <typename PointerT>
 void PackMemPointer(ParamBuffer &params, ParamType paramType, uint32_t offset, uint8_t *mem)
 {
@@ -520,11 +901,17 @@ class TraceInterpreter : angle::NonCopyable
 
   private:
     void runTraceFunction(const char *name) const;
-    void parseTraceUncompressed();
-    void parseTraceGz();
+    void parseTraceUncompressed(CallStreamWriter *callStreamWriter);
+    void parseTraceGz(CallStreamWriter *callStreamWriter);
+
+    std::string getCallStreamPath() const;
+    uint64_t getTraceSourceSize() const;
+    bool loadCallStream(const std::string &path, uint64_t sourceSize);
 
     TraceFunctionMap mTraceFunctions;
     TraceStringMap mTraceStrings;
+    // Backs the inline strings of the functions loaded from a call stream.
+    std::vector<uint8_t> mCallStreamData;
     bool mVerboseLogging = true;
 };
 
@@ -535,7 +922,7 @@ void TraceInterpreter::replayFrame(uint32_t frameIndex)
     runTraceFunction(funcName);
 }
 
-void TraceInterpreter::parseTraceUncompressed()
+void TraceInterpreter::parseTraceUncompressed(CallStreamWriter *callStreamWriter)
 {
     for (const std::string &file : gTraceInfo.traceFiles)
     {
@@ -562,12 +949,13 @@ void TraceInterpreter::parseTraceUncompressed()
             UNREACHABLE();
         }
 
-        Parser parser(fileData, mTraceFunctions, mTraceStrings, mVerboseLogging);
+        Parser parser(fileData, mTraceFunctions, mTraceStrings, callStreamWriter,
+                      mVerboseLogging);
         parser.parse();
     }
 }
 
-void TraceInterpreter::parseTraceGz()
+void TraceInterpreter::parseTraceGz(CallStreamWriter *callStreamWriter)
 {
     if (mVerboseLogging)
     {
@@ -603,19 +991,102 @@ void TraceInterpreter::parseTraceGz()
         exit(1);
     }
 
-    Parser parser(uncompressedData, mTraceFunctions, mTraceStrings, mVerboseLogging);
+    Parser parser(uncompressedData, mTraceFunctions, mTraceStrings, callStreamWriter,
+                  mVerboseLogging);
     parser.parse();
 }
 
-void TraceInterpreter::setupReplay()
+std::string TraceInterpreter::getCallStreamPath() const
 {
     if (!gTraceGzPath.empty())
     {
-        parseTraceGz();
+        return gTraceGzPath + kCallStreamExtension;
     }
-    else
+
+    std::stringstream pathStream;
+    pathStream << gBinaryDataDir << GetPathSeparator() << gTraceInfo.name
+               << kCallStreamExtension;
+    return pathStream.str();
+}
+
+// A change in the size of the trace sources invalidates the call stream cached from them.
+uint64_t TraceInterpreter::getTraceSourceSize() const
+{
+    if (!gTraceGzPath.empty())
+    {
+        return GetFileSizeOrZero(gTraceGzPath);
+    }
+
+    uint64_t size = 0;
+    for (const std::string &file : gTraceInfo.traceFiles)
     {
-        parseTraceUncompressed();
+        if (ShouldParseFile(file))
+        {
+            std::stringstream pathStream;
+            pathStream << gBinaryDataDir << GetPathSeparator() << file;
+            size += GetFileSizeOrZero(pathStream.str());
+        }
+    }
+    return size;
+}
+
+bool TraceInterpreter::loadCallStream(const std::string &path, uint64_t sourceSize)
+{
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr)
+    {
+        return false;
+    }
+
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+
+    mCallStreamData.resize(size > 0 ? size : 0);
+    size_t readSize = fread(mCallStreamData.data(), 1, mCallStreamData.size(), fp);
+    fclose(fp);
+
+    CallStreamReader reader(mCallStreamData, mTraceFunctions, mTraceStrings);
+    if (readSize != mCallStreamData.size() || !reader.checkHeader(sourceSize))
+    {
+        if (mVerboseLogging)
+        {
+            printf("Ignoring stale trace call stream %s\n", path.c_str());
+        }
+        mCallStreamData.clear();
+        return false;
+    }
+
+    if (mVerboseLogging)
+    {
+        printf("Loading functions from %s\n", path.c_str());
+    }
+    reader.readAll();
+    return true;
+}
+
+void TraceInterpreter::setupReplay()
+{
+    const std::string callStreamPath = getCallStreamPath();
+    const uint64_t sourceSize        = getTraceSourceSize();
+
+    if (!loadCallStream(callStreamPath, sourceSize))
+    {
+        CallStreamWriter callStreamWriter(sourceSize);
+        if (!gTraceGzPath.empty())
+        {
+            parseTraceGz(&callStreamWriter);
+        }
+        else
+        {
+            parseTraceUncompressed(&callStreamWriter);
+        }
+
+        // The call stream is only a cache, the trace can still be replayed without it.
+        if (!callStreamWriter.save(callStreamPath) && mVerboseLogging)
+        {
+            printf("Could not write trace call stream %s\n", callStreamPath.c_str());
+        }
     }
 
     if (mTraceFunctions.count("SetupReplay") == 0)
@@ -392,6 +392,13 @@ CallCapture ParseCallCapture(const Token &nameToken,
                                                                                        strings);
         return CallCapture(EntryPoint::EGLHandleGPUSwitchANGLE, std::move(params));
     }
+    if (strcmp(nameToken, "eglHandleMemoryPressureANGLE") == 0)
+    {
+        ParamBuffer params =
+            ParseParameters<std::remove_pointer<PFNEGLHANDLEMEMORYPRESSUREANGLEPROC>::type>(
+                paramTokens, strings);
+        return CallCapture(EntryPoint::EGLHandleMemoryPressureANGLE, std::move(params));
+    }
     if (strcmp(nameToken, "eglInitialize") == 0)
     {
         ParamBuffer params =
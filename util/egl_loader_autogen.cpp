@@ -73,6 +73,7 @@ ANGLE_UTIL_EXPORT PFNEGLACQUIREEXTERNALCONTEXTANGLEPROC l_eglAcquireExternalCont
 ANGLE_UTIL_EXPORT PFNEGLRELEASEEXTERNALCONTEXTANGLEPROC l_eglReleaseExternalContextANGLE;
 ANGLE_UTIL_EXPORT PFNEGLQUERYDISPLAYATTRIBANGLEPROC l_eglQueryDisplayAttribANGLE;
 ANGLE_UTIL_EXPORT PFNEGLQUERYSTRINGIANGLEPROC l_eglQueryStringiANGLE;
+ANGLE_UTIL_EXPORT PFNEGLHANDLEMEMORYPRESSUREANGLEPROC l_eglHandleMemoryPressureANGLE;
 ANGLE_UTIL_EXPORT PFNEGLCOPYMETALSHAREDEVENTANGLEPROC l_eglCopyMetalSharedEventANGLE;
 ANGLE_UTIL_EXPORT PFNEGLSETVALIDATIONENABLEDANGLEPROC l_eglSetValidationEnabledANGLE;
 ANGLE_UTIL_EXPORT PFNEGLFORCEGPUSWITCHANGLEPROC l_eglForceGPUSwitchANGLE;
@@ -225,6 +226,8 @@ void LoadUtilEGL(LoadProc loadProc)
         reinterpret_cast<PFNEGLQUERYDISPLAYATTRIBANGLEPROC>(loadProc("eglQueryDisplayAttribANGLE"));
     l_eglQueryStringiANGLE =
         reinterpret_cast<PFNEGLQUERYSTRINGIANGLEPROC>(loadProc("eglQueryStringiANGLE"));
+    l_eglHandleMemoryPressureANGLE = reinterpret_cast<PFNEGLHANDLEMEMORYPRESSUREANGLEPROC>(
+        loadProc("eglHandleMemoryPressureANGLE"));
     l_eglCopyMetalSharedEventANGLE = reinterpret_cast<PFNEGLCOPYMETALSHAREDEVENTANGLEPROC>(
         loadProc("eglCopyMetalSharedEventANGLE"));
     l_eglSetValidationEnabledANGLE = reinterpret_cast<PFNEGLSETVALIDATIONENABLEDANGLEPROC>(
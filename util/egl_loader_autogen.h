@@ -76,6 +76,7 @@
 #define eglReleaseExternalContextANGLE l_eglReleaseExternalContextANGLE
 #define eglQueryDisplayAttribANGLE l_eglQueryDisplayAttribANGLE
 #define eglQueryStringiANGLE l_eglQueryStringiANGLE
+#define eglHandleMemoryPressureANGLE l_eglHandleMemoryPressureANGLE
 #define eglCopyMetalSharedEventANGLE l_eglCopyMetalSharedEventANGLE
 #define eglSetValidationEnabledANGLE l_eglSetValidationEnabledANGLE
 #define eglForceGPUSwitchANGLE l_eglForceGPUSwitchANGLE
@@ -197,6 +198,7 @@ ANGLE_UTIL_EXPORT extern PFNEGLACQUIREEXTERNALCONTEXTANGLEPROC l_eglAcquireExter
 ANGLE_UTIL_EXPORT extern PFNEGLRELEASEEXTERNALCONTEXTANGLEPROC l_eglReleaseExternalContextANGLE;
 ANGLE_UTIL_EXPORT extern PFNEGLQUERYDISPLAYATTRIBANGLEPROC l_eglQueryDisplayAttribANGLE;
 ANGLE_UTIL_EXPORT extern PFNEGLQUERYSTRINGIANGLEPROC l_eglQueryStringiANGLE;
+ANGLE_UTIL_EXPORT extern PFNEGLHANDLEMEMORYPRESSUREANGLEPROC l_eglHandleMemoryPressureANGLE;
 ANGLE_UTIL_EXPORT extern PFNEGLCOPYMETALSHAREDEVENTANGLEPROC l_eglCopyMetalSharedEventANGLE;
 ANGLE_UTIL_EXPORT extern PFNEGLSETVALIDATIONENABLEDANGLEPROC l_eglSetValidationEnabledANGLE;
 ANGLE_UTIL_EXPORT extern PFNEGLFORCEGPUSWITCHANGLEPROC l_eglForceGPUSwitchANGLE;